@@ -0,0 +1,848 @@
+/*
+ * bench_libsm.c
+ * Benchmark runner for codecs, builders and analytics kernels, reporting JSON
+ *
+ * Every case reports ns/op over a number of repetitions, and with glibc the
+ * allocations and bytes allocated per op. Compare two builds by running both
+ * with the same options, pinned to the same cpu.
+ */
+
+#define _GNU_SOURCE
+
+#include "libsm.h"
+#include "pathPrediction.h"
+#include <getopt.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define SLOT        512
+#define CORPUS_SIZE 256
+#define MAX_REPS    1000
+#define SPAT_SIGNALS 16
+
+
+/*
+ * Allocation counting. glibc lets the executable interpose malloc and friends,
+ * including for the calls made by libsm, j2735 and j2540.
+ */
+#if defined(__GLIBC__)
+#define BENCH_COUNT_ALLOCATIONS 1
+
+extern void* __libc_malloc(size_t size);
+extern void* __libc_calloc(size_t count, size_t size);
+extern void* __libc_realloc(void* ptr, size_t size);
+extern void __libc_free(void* ptr);
+
+static bool counting;
+static uint64_t allocations;
+static uint64_t allocatedBytes;
+
+
+void* malloc(size_t size)
+{
+    if (counting) {
+        allocations++;
+        allocatedBytes += size;
+    }
+    return __libc_malloc(size);
+}
+
+
+void* calloc(size_t count, size_t size)
+{
+    if (counting) {
+        allocations++;
+        allocatedBytes += count * size;
+    }
+    return __libc_calloc(count, size);
+}
+
+
+void* realloc(void* ptr, size_t size)
+{
+    if (counting) {
+        allocations++;
+        allocatedBytes += size;
+    }
+    return __libc_realloc(ptr, size);
+}
+
+
+void free(void* ptr)
+{
+    __libc_free(ptr);
+}
+#else
+#define BENCH_COUNT_ALLOCATIONS 0
+
+static bool counting;
+static uint64_t allocations;
+static uint64_t allocatedBytes;
+#endif
+
+
+/*
+ * Same vectors as test/smoketest.c
+ */
+static uint8_t const bsmNoPartII[]
+        = { 0x00, 0x14, 0x25, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xA4, 0xE9, 0x00,
+            0xEB, 0x49, 0xD2, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x80,
+            0xFD, 0xFA, 0x1F, 0xA1, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00 };
+static uint8_t const bsmPartII[] = { 0x00, 0x14, 0x30, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+                                     0xFF, 0xF5, 0xA4, 0xE9, 0x00, 0xEB, 0x49, 0xD2, 0x00,
+                                     0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+                                     0x80, 0xFD, 0xFA, 0x1F, 0xA1, 0x00, 0x7F, 0xFF, 0x80,
+                                     0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x48, 0x00, 0x40,
+                                     0x20, 0x20, 0x34, 0x00, 0xAA, 0x00 };
+static uint8_t const psm[] = { 0x00, 0x20, 0x1A, 0x00, 0x00, 0x04, 0x00, 0x14, 0x15, 0x09,
+                               0x09, 0x09, 0x08, 0x4E, 0xF7, 0xF7, 0x91, 0x39, 0xBA, 0x86,
+                               0x22, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x50, 0x10, 0xE0 };
+
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+
+// xorshift, so every run uses the same corpora
+static uint32_t nextRandom(uint32_t* state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+
+/*
+ * Generated corpora
+ */
+
+// A moving vehicle with path history and prediction
+static MessageFrame_t* buildBsm(uint32_t* seed)
+{
+    MessageFrame_t* mf = libsm_alloc_init_mf_bsm();
+    BasicSafetyMessage_t* bsm = &mf->value.choice.BasicSafetyMessage;
+    BSMcoreData_t* core = &bsm->coreData;
+    core->msgCnt = nextRandom(seed) % 128;
+    core->secMark = nextRandom(seed) % 60000;
+    core->lat = 334150000 + (long)(nextRandom(seed) % 100000);
+    core->Long = -1119260000 + (long)(nextRandom(seed) % 100000);
+    core->elev = nextRandom(seed) % 4000;
+    core->speed = nextRandom(seed) % 2000;
+    core->heading = nextRandom(seed) % 28800;
+    core->size.width = 200;
+    core->size.length = 480;
+    libsm_init_bsm_path_history(bsm);
+    VehicleSafetyExtensions_t* vse = libsm_get_partII_elem(
+            bsm,
+            BSMpartIIExtension__partII_Value_PR_VehicleSafetyExtensions);
+    int const crumbs = 1 + (int)(nextRandom(seed) % 15);
+    for (int i = 0; i < crumbs; i++) {
+        PathHistoryPoint_t* point = libsm_alloc_init_PathHistoryPoint();
+        point->latOffset = -2000 + (long)(nextRandom(seed) % 4000);
+        point->lonOffset = -2000 + (long)(nextRandom(seed) % 4000);
+        point->timeOffset = 10 * (i + 1);
+        ASN_SEQUENCE_ADD(&vse->pathHistory->crumbData.list, point);
+    }
+    libsm_set_path_prediction(bsm, nextRandom(seed) % 201, 32767);
+    return mf;
+}
+
+
+static MessageFrame_t* buildSpat(uint32_t* seed)
+{
+    MessageFrame_t* mf = libsm_alloc_init_mf_spat();
+    IntersectionState_t* intersection = libsm_get_spat(mf)->intersections.list.array[0];
+    intersection->id.id = nextRandom(seed) % 65536;
+    intersection->revision = nextRandom(seed) % 128;
+    for (int s = 1; s < 8; s++) {
+        MovementState_t* state = libsm_add_spat_intersectionState_movementState(intersection);
+        state->signalGroup = s;
+        state->state_time_speed.list.array[0]->eventState = nextRandom(seed) % 10;
+    }
+    return mf;
+}
+
+
+// An intersection of 8 approach lanes with 6 nodes each
+static MessageFrame_t* buildMap(uint32_t* seed)
+{
+    MessageFrame_t* mf = libsm_alloc_init_mf_map();
+    MapData_t* map = libsm_get_map(mf);
+    map->msgIssueRevision = nextRandom(seed) % 128;
+    IntersectionGeometry_t* geometry = libsm_add_map_intersectionGeometry(
+            map, nextRandom(seed) % 65536, 334150000, -1119260000);
+    for (int l = 0; l < 8; l++) {
+        uint8_t const direction = l % 2 ? LIBSM_MAP_EGRESS : LIBSM_MAP_INGRESS;
+        GenericLane_t* lane = libsm_add_map_genericLane(
+                geometry, l + 1, direction, LaneTypeAttributes_PR_vehicle);
+        libsm_add_map_nodeXY(lane, -1400 + 360 * l, -1500);
+        for (int n = 1; n < 6; n++) {
+            libsm_add_map_nodeXY(lane, (long)(nextRandom(seed) % 100) - 50, -800 * n);
+        }
+        libsm_add_map_connection(lane, (l + 3) % 8 + 1, l / 2 + 1);
+    }
+    return mf;
+}
+
+
+static MessageFrame_t* buildTim(uint32_t* seed)
+{
+    MessageFrame_t* mf = libsm_alloc_init_partial_mf_tim();
+    TravelerInformation_t* tim = libsm_get_tim(mf);
+    tim->msgCnt = nextRandom(seed) % 128;
+
+    TravelerDataFrame_t* frame = libsm_alloc_init_partial_TravelerDataFrame();
+    libsm_init_TravelerDataFrame_msgId_choice_FurtherInfoID(frame);
+    ASN_SEQUENCE_ADD(&frame->regions.list, libsm_alloc_init_GeographicalPath());
+    ITIScodesAndText_t* advisory = libsm_alloc_init_ITIScodesAndText();
+    char text[32];
+    snprintf(text, sizeof(text), "Stop sign %u ahead", nextRandom(seed) % 1000);
+    ITIScodesAndText__Member* member = libsm_alloc_init_ITIScodesAndText__Member_text(text);
+    ASN_SEQUENCE_ADD(&advisory->list, &member->item);
+    frame->content.choice.advisory = advisory;
+    frame->content.present = TravelerDataFrame__content_PR_advisory;
+    ASN_SEQUENCE_ADD(&tim->dataFrames.list, frame);
+    return mf;
+}
+
+
+// RTCM corrections of two 200 octet messages
+static MessageFrame_t* buildRtcm(uint32_t* seed)
+{
+    MessageFrame_t* mf = calloc(1, sizeof(MessageFrame_t));
+    mf->messageId = DSRCmsgID_rtcmCorrections;
+    mf->value.present = MessageFrame__value_PR_RTCMcorrections;
+    RTCMcorrections_t* rtcm = &mf->value.choice.RTCMcorrections;
+    rtcm->msgCnt = nextRandom(seed) % 128;
+    rtcm->rev = RTCM_Revision_rtcmRev3;
+    for (int m = 0; m < 2; m++) {
+        char octets[200];
+        for (size_t o = 0; o < sizeof(octets); o++) {
+            octets[o] = (char)nextRandom(seed);
+        }
+        ASN_SEQUENCE_ADD(&rtcm->msgs.list,
+                         OCTET_STRING_new_fromBuf(&asn_DEF_RTCMmessage, octets, sizeof(octets)));
+    }
+    return mf;
+}
+
+
+/*
+ * Cases
+ */
+
+typedef struct benchCase_s {
+    char const* name;
+    void (*run)(struct benchCase_s* c);
+    uint8_t const* vector;                    /**< one UPER message */
+    size_t vectorLen;
+    MessageFrame_t* (*build)(uint32_t* seed); /**< or a generated corpus */
+
+    // filled in by prepareCase, run cycles through the corpus
+    size_t count;
+    size_t next;
+    uint8_t* uper;
+    size_t* lens;
+    MessageFrame_t** mfs;
+} benchCase_t;
+
+static volatile uint64_t sink;
+
+
+static void fail(benchCase_t const* c, char const* what)
+{
+    fprintf(stderr, "%s: %s failed\n", c->name, what);
+    exit(1);
+}
+
+
+static size_t nextIndex(benchCase_t* c)
+{
+    size_t const i = c->next;
+    c->next = i + 1 == c->count ? 0 : i + 1;
+    return i;
+}
+
+
+static void runDecode(benchCase_t* c)
+{
+    size_t const i = nextIndex(c);
+    MessageFrame_t mf = { 0 };
+    if (libsm_decode_messageframe(c->uper + i * SLOT, c->lens[i], &mf) != LIBSM_OK) {
+        fail(c, "decoding");
+    }
+    sink += (uint64_t)mf.messageId;
+    ASN_STRUCT_RESET(asn_DEF_MessageFrame, &mf);
+}
+
+
+static void runDecodeBorrowed(benchCase_t* c)
+{
+    size_t const i = nextIndex(c);
+    uint8_t memory[SLOT];
+    asn_borrow_arena_t arena = { memory, sizeof(memory), 0 };
+    MessageFrame_t mf = { 0 };
+    if (libsm_decode_messageframe_borrowed(c->uper + i * SLOT, c->lens[i], &mf, 64, &arena)
+        != LIBSM_OK) {
+        fail(c, "decoding");
+    }
+    sink += (uint64_t)mf.messageId + arena.used;
+    ASN_STRUCT_RESET(asn_DEF_MessageFrame, &mf);
+}
+
+
+// decode, rewrite coreData and encode again, as a relay does
+static void relayBsm(benchCase_t* c, asn_TYPE_descriptor_t const* const* opaque)
+{
+    size_t const i = nextIndex(c);
+    uint8_t const* uper = c->uper + i * SLOT;
+    MessageFrame_t mf = { 0 };
+    libsm_rval_e rval;
+    if (opaque != NULL) {
+        rval = libsm_decode_messageframe_opaque(uper, c->lens[i], &mf, opaque);
+    } else {
+        rval = libsm_decode_messageframe(uper, c->lens[i], &mf);
+    }
+    if (rval != LIBSM_OK) {
+        fail(c, "decoding");
+    }
+    BSMcoreData_t* core = &mf.value.choice.BasicSafetyMessage.coreData;
+    core->msgCnt = (core->msgCnt + 1) % 128;
+    uint8_t encoded[SLOT];
+    size_t len = sizeof(encoded);
+    if (libsm_encode_messageframe(&mf, encoded, &len) != LIBSM_OK) {
+        fail(c, "encoding");
+    }
+    sink += len;
+    ASN_STRUCT_RESET(asn_DEF_MessageFrame, &mf);
+}
+
+
+static void runRelayBsm(benchCase_t* c)
+{
+    relayBsm(c, NULL);
+}
+
+
+static void runRelayBsmOpaque(benchCase_t* c)
+{
+    relayBsm(c, libsm_bsm_extension_types);
+}
+
+
+// anonymize a copy of a captured BSM, patched in place or re-encoded without its path history
+static void anonymizeBsm(benchCase_t* c, bool dropPathHistory)
+{
+    size_t const i = nextIndex(c);
+    uint8_t encoded[SLOT];
+    size_t len = c->lens[i];
+    memcpy(encoded, c->uper + i * SLOT, len);
+    libsm_anonymize_t anon;
+    libsm_anonymize_default(&anon);
+    anon.dropPathHistory = dropPathHistory;
+    if (libsm_anonymize_frame(&anon, encoded, &len) != LIBSM_OK) {
+        fail(c, "anonymizing");
+    }
+    sink += len + encoded[len / 2];
+}
+
+
+static void runAnonymizeBsmInPlace(benchCase_t* c)
+{
+    anonymizeBsm(c, false);
+}
+
+
+static void runAnonymizeBsmReencode(benchCase_t* c)
+{
+    anonymizeBsm(c, true);
+}
+
+
+static void runEncode(benchCase_t* c)
+{
+    uint8_t encoded[SLOT];
+    size_t len = sizeof(encoded);
+    if (libsm_encode_messageframe(c->mfs[nextIndex(c)], encoded, &len) != LIBSM_OK) {
+        fail(c, "encoding");
+    }
+    sink += len;
+}
+
+
+static int countJer(void const* buffer, size_t size, void* key)
+{
+    (void)buffer;
+    *(size_t*)key += size;
+    return 0;
+}
+
+
+static void runJer(benchCase_t* c)
+{
+    size_t len = 0;
+    asn_enc_rval_t const rval = jer_encode(&asn_DEF_MessageFrame,
+                                           c->mfs[nextIndex(c)],
+                                           JER_F_MINIFIED,
+                                           countJer,
+                                           &len);
+    if (rval.encoded < 0) {
+        fail(c, "JER encoding");
+    }
+    sink += len;
+}
+
+
+static void runBuildBsm(benchCase_t* c)
+{
+    (void)c;
+    MessageFrame_t* mf = libsm_alloc_init_mf_bsm();
+    sink += (uint64_t)mf->messageId;
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
+
+
+static void runBuildPsm(benchCase_t* c)
+{
+    (void)c;
+    MessageFrame_t* mf = libsm_alloc_init_mf_psm();
+    sink += (uint64_t)mf->messageId;
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
+
+
+static void runBuildSpat(benchCase_t* c)
+{
+    (void)c;
+    MessageFrame_t* mf = libsm_alloc_init_mf_spat();
+    sink += (uint64_t)mf->messageId;
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
+
+
+// One intersection with 16 signal groups, as a signal controller reports it every 100 ms
+static size_t spatController(benchCase_t* c, libsm_spat_signal_t* signals)
+{
+    size_t const i = nextIndex(c);
+    for (size_t s = 0; s < SPAT_SIGNALS; s++) {
+        signals[s].signalGroup = (uint8_t)(s + 1);
+        signals[s].eventState = (uint8_t)((i + s) % 10);
+        signals[s].minEndTime = (uint16_t)((i * 10 + s * 50) % 36000);
+        signals[s].maxEndTime = (uint16_t)((i * 10 + s * 50 + 300) % 36000);
+    }
+    return i;
+}
+
+
+static void runEncodeSpatClassic(benchCase_t* c)
+{
+    libsm_spat_signal_t signals[SPAT_SIGNALS];
+    size_t const i = spatController(c, signals);
+    MessageFrame_t* mf = libsm_alloc_init_mf_spat();
+    IntersectionState_t* intersection = libsm_get_spat(mf)->intersections.list.array[0];
+    intersection->id.id = (long)(i % 100);
+    intersection->revision = (long)(i % 128);
+    for (size_t s = 0; s < SPAT_SIGNALS; s++) {
+        MovementState_t* state
+                = s == 0 ? intersection->states.list.array[0]
+                         : libsm_add_spat_intersectionState_movementState(intersection);
+        MovementEvent_t* event = state->state_time_speed.list.array[0];
+        state->signalGroup = signals[s].signalGroup;
+        event->eventState = signals[s].eventState;
+        event->timing = calloc(1, sizeof(TimeChangeDetails_t));
+        event->timing->minEndTime = signals[s].minEndTime;
+        event->timing->maxEndTime = calloc(1, sizeof(SPAT_TimeMark_t));
+        *event->timing->maxEndTime = signals[s].maxEndTime;
+    }
+    uint8_t encoded[SLOT];
+    size_t len = sizeof(encoded);
+    if (libsm_encode_messageframe(mf, encoded, &len) != LIBSM_OK) {
+        fail(c, "encoding");
+    }
+    sink += len;
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
+
+
+static void runEncodeSpatBuilder(benchCase_t* c)
+{
+    static libsm_spat_builder_t builder;
+    if (builder.pool == NULL && libsm_spat_builder_init(&builder, 1, SPAT_SIGNALS) != LIBSM_OK) {
+        fail(c, "builder");
+    }
+    libsm_spat_signal_t signals[SPAT_SIGNALS];
+    size_t const i = spatController(c, signals);
+    libsm_spat_intersection_t const intersection = {
+        .id = (uint16_t)(i % 100),
+        .revision = (uint8_t)(i % 128),
+        .moy = LIBSM_SPAT_MOY_UNKNOWN,
+        .timeStamp = LIBSM_SPAT_DSECOND_UNKNOWN,
+        .signals = signals,
+        .signalCount = SPAT_SIGNALS,
+    };
+    uint8_t encoded[SLOT];
+    size_t len = sizeof(encoded);
+    if (libsm_spat_builder_encode(&builder, &intersection, 1, encoded, &len) != LIBSM_OK) {
+        fail(c, "encoding");
+    }
+    sink += len;
+}
+
+
+// A broadcast tick of a MAP that has not changed since the last
+static void runMapUperCache(benchCase_t* c)
+{
+    static libsm_map_uper_cache_t cache;
+    if (cache.entries == NULL && libsm_map_uper_cache_init(&cache, CORPUS_SIZE, SLOT) != LIBSM_OK) {
+        fail(c, "cache");
+    }
+    uint8_t const* encoded;
+    size_t len;
+    if (libsm_map_uper_cache_get(&cache, c->mfs[nextIndex(c)], &encoded, &len) != LIBSM_OK) {
+        fail(c, "encoding");
+    }
+    sink += len + encoded[0];
+}
+
+
+// Codes spread over the categories, about one in ten is not a code
+static void runItisFromCode(benchCase_t* c)
+{
+    libsm_itis_t const* itis = libsm_itis_from_code(257 + (long)(nextIndex(c) * 53));
+    sink += itis != NULL ? itis->code : 1;
+}
+
+
+static void runItisFromName(benchCase_t* c)
+{
+    static char const* const names[] = {
+        "stop and go traffic", "accident", "prepare-to-stop", "speed_limit",
+        "hOV lanes", "information-available-on-TV", "winding road to left", "no such phrase",
+    };
+    char const* name = names[nextIndex(c) % (sizeof(names) / sizeof(names[0]))];
+    libsm_itis_t const* itis = libsm_itis_from_name(name, strlen(name));
+    sink += itis != NULL ? itis->code : 1;
+}
+
+
+static void runVehicleClassFromStr(benchCase_t* c)
+{
+    static char* names[] = {
+        "passenger-Vehicle-TypeUnknown", "truck_axleCnt2", "equipped-CargoTrailer",
+        "emergency-TypeOther", "motorcycle-Touring", "no-such-class",
+    };
+    sink += (uint64_t)libsm_basic_vehicle_class_from_str(
+            names[nextIndex(c) % (sizeof(names) / sizeof(names[0]))]);
+}
+
+
+// JSON to UPER spends its time on the names of ENUMERATED values
+static void runJerDecodeEnum(benchCase_t* c)
+{
+    static char const* names[] = {
+        "\"neutral\"", "\"forwardGears\"", "\"reverseGears\"", "\"unavailable\"",
+    };
+    char const* name = names[nextIndex(c) % (sizeof(names) / sizeof(names[0]))];
+    long state;
+    void* sptr = &state;
+    asn_dec_rval_t const rval
+            = jer_decode(NULL, &asn_DEF_TransmissionState, &sptr, name, strlen(name));
+    if (rval.code != RC_OK) {
+        fail(c, "JER decoding");
+    }
+    sink += (uint64_t)state;
+}
+
+
+static void runPerCalculate(benchCase_t* c)
+{
+    static PERSlidingInterval_t arr[PER_SUBINTERVAL_COUNT];
+    size_t const i = nextIndex(c);
+    for (size_t w = 0; w < PER_SUBINTERVAL_COUNT; w++) {
+        arr[w].first = (Common_MsgCount_t)((i + w * 10) % 128);
+        arr[w].last = (Common_MsgCount_t)((i + w * 10 + 9) % 128);
+        arr[w].received = 8 + (i + w) % 3;
+    }
+    sink += libsm_per_calculate(arr);
+}
+
+
+static void runPathPrediction(benchCase_t* c)
+{
+    PathPrediction_t pp;
+    size_t const i = nextIndex(c);
+    libsm_calculatePathPrediction(&pp, 5.0 + (double)(i % 30), -20.0 + (double)(i % 40));
+    sink += (uint64_t)pp.radiusOfCurve + (uint64_t)pp.confidence;
+}
+
+
+static benchCase_t cases[] = {
+    { "uper_decode_bsm", runDecode, bsmNoPartII, sizeof(bsmNoPartII), NULL },
+    { "uper_decode_bsm_part_ii", runDecode, bsmPartII, sizeof(bsmPartII), NULL },
+    { "uper_decode_bsm_corpus", runDecode, NULL, 0, buildBsm },
+    { "uper_decode_psm", runDecode, psm, sizeof(psm), NULL },
+    { "uper_decode_spat", runDecode, NULL, 0, buildSpat },
+    { "uper_decode_map", runDecode, NULL, 0, buildMap },
+    { "uper_decode_tim", runDecode, NULL, 0, buildTim },
+    { "relay_bsm", runRelayBsm, NULL, 0, buildBsm },
+    { "relay_bsm_opaque", runRelayBsmOpaque, NULL, 0, buildBsm },
+    { "anonymize_bsm_in_place", runAnonymizeBsmInPlace, NULL, 0, buildBsm },
+    { "anonymize_bsm_reencode", runAnonymizeBsmReencode, NULL, 0, buildBsm },
+    { "uper_decode_rtcm", runDecode, NULL, 0, buildRtcm },
+    { "uper_decode_rtcm_borrowed", runDecodeBorrowed, NULL, 0, buildRtcm },
+    { "uper_encode_bsm", runEncode, bsmNoPartII, sizeof(bsmNoPartII), NULL },
+    { "uper_encode_bsm_part_ii", runEncode, bsmPartII, sizeof(bsmPartII), NULL },
+    { "uper_encode_bsm_corpus", runEncode, NULL, 0, buildBsm },
+    { "uper_encode_psm", runEncode, psm, sizeof(psm), NULL },
+    { "uper_encode_spat", runEncode, NULL, 0, buildSpat },
+    { "uper_encode_map", runEncode, NULL, 0, buildMap },
+    { "map_uper_cache_get", runMapUperCache, NULL, 0, buildMap },
+    { "uper_encode_tim", runEncode, NULL, 0, buildTim },
+    { "jer_encode_bsm_part_ii", runJer, bsmPartII, sizeof(bsmPartII), NULL },
+    { "jer_encode_bsm_corpus", runJer, NULL, 0, buildBsm },
+    { "build_mf_bsm", runBuildBsm, NULL, 0, NULL },
+    { "build_mf_psm", runBuildPsm, NULL, 0, NULL },
+    { "build_mf_spat", runBuildSpat, NULL, 0, NULL },
+    { "encode_spat_16_classic", runEncodeSpatClassic, NULL, 0, NULL },
+    { "encode_spat_16_builder", runEncodeSpatBuilder, NULL, 0, NULL },
+    { "itis_from_code", runItisFromCode, NULL, 0, NULL },
+    { "itis_from_name", runItisFromName, NULL, 0, NULL },
+    { "basic_vehicle_class_from_str", runVehicleClassFromStr, NULL, 0, NULL },
+    { "jer_decode_enum", runJerDecodeEnum, NULL, 0, NULL },
+    { "per_calculate", runPerCalculate, NULL, 0, NULL },
+    { "path_prediction", runPathPrediction, NULL, 0, NULL },
+};
+
+
+// UPER encoded and decoded copies of the case's messages, made before timing
+static void prepareCase(benchCase_t* c)
+{
+    c->next = 0;
+    if (c->vector == NULL && c->build == NULL) {
+        c->count = CORPUS_SIZE;
+        return;
+    }
+    c->count = c->vector != NULL ? 1 : CORPUS_SIZE;
+    c->uper = malloc(c->count * SLOT);
+    c->lens = malloc(c->count * sizeof(size_t));
+    c->mfs = calloc(c->count, sizeof(MessageFrame_t*));
+    if (c->uper == NULL || c->lens == NULL || c->mfs == NULL) {
+        fail(c, "allocation");
+    }
+    uint32_t seed = 38;
+    for (size_t i = 0; i < c->count; i++) {
+        c->lens[i] = SLOT;
+        if (c->vector != NULL) {
+            memcpy(c->uper, c->vector, c->vectorLen);
+            c->lens[i] = c->vectorLen;
+            c->mfs[i] = calloc(1, sizeof(MessageFrame_t));
+            if (c->mfs[i] == NULL
+                || libsm_decode_messageframe(c->uper, c->lens[i], c->mfs[i]) != LIBSM_OK) {
+                fail(c, "decoding");
+            }
+        } else {
+            c->mfs[i] = c->build(&seed);
+            if (libsm_encode_messageframe(c->mfs[i], c->uper + i * SLOT, &c->lens[i])
+                != LIBSM_OK) {
+                fail(c, "encoding");
+            }
+        }
+    }
+}
+
+
+static void releaseCase(benchCase_t* c)
+{
+    if (c->mfs != NULL) {
+        for (size_t i = 0; i < c->count; i++) {
+            ASN_STRUCT_FREE(asn_DEF_MessageFrame, c->mfs[i]);
+        }
+    }
+    free(c->uper);
+    free(c->lens);
+    free(c->mfs);
+    c->uper = NULL;
+    c->lens = NULL;
+    c->mfs = NULL;
+}
+
+
+static double timeRuns(benchCase_t* c, uint64_t iterations)
+{
+    double const start = nowSeconds();
+    for (uint64_t i = 0; i < iterations; i++) {
+        c->run(c);
+    }
+    return nowSeconds() - start;
+}
+
+
+static int compareDouble(void const* a, void const* b)
+{
+    double const x = *(double const*)a;
+    double const y = *(double const*)b;
+    return (x > y) - (x < y);
+}
+
+
+static void benchmark(benchCase_t* c,
+                      uint64_t warmup,
+                      uint64_t iterations,
+                      double minTime,
+                      int repetitions,
+                      bool first)
+{
+    prepareCase(c);
+    timeRuns(c, warmup);
+    // enough iterations for a repetition to last minTime
+    if (iterations == 0) {
+        iterations = 1;
+        while (timeRuns(c, iterations) < minTime && iterations < (UINT64_C(1) << 40)) {
+            iterations *= 2;
+        }
+    }
+
+    double ns[MAX_REPS];
+    allocations = 0;
+    allocatedBytes = 0;
+    for (int r = 0; r < repetitions; r++) {
+        counting = true;
+        double const elapsed = timeRuns(c, iterations);
+        counting = false;
+        ns[r] = elapsed / (double)iterations * 1e9;
+    }
+    double const ops = (double)iterations * repetitions;
+    releaseCase(c);
+
+    qsort(ns, (size_t)repetitions, sizeof(double), compareDouble);
+    double mean = 0;
+    for (int r = 0; r < repetitions; r++) {
+        mean += ns[r] / repetitions;
+    }
+    printf("%s    {\n", first ? "" : ",\n");
+    printf("      \"name\": \"%s\",\n", c->name);
+    printf("      \"iterations\": %llu,\n", (unsigned long long)iterations);
+    printf("      \"ns_per_op\": { \"min\": %.2f, \"median\": %.2f, \"mean\": %.2f, "
+           "\"max\": %.2f },\n",
+           ns[0],
+           ns[repetitions / 2],
+           mean,
+           ns[repetitions - 1]);
+    if (BENCH_COUNT_ALLOCATIONS) {
+        printf("      \"allocs_per_op\": %.2f,\n", (double)allocations / ops);
+        printf("      \"bytes_per_op\": %.1f\n", (double)allocatedBytes / ops);
+    } else {
+        printf("      \"allocs_per_op\": null,\n");
+        printf("      \"bytes_per_op\": null\n");
+    }
+    printf("    }");
+    fflush(stdout);
+}
+
+
+int main(int argc, char** argv)
+{
+    uint64_t warmup = 1000;
+    uint64_t iterations = 0;
+    double minTime = 0.05;
+    int repetitions = 5;
+    int cpu = -1;
+    char const* filter = NULL;
+    int opt;
+    int option_index = 0;
+
+    static struct option long_options[] = { { "help", no_argument, NULL, 'h' },
+                                            { "list", no_argument, NULL, 'l' },
+                                            { "filter", required_argument, NULL, 'f' },
+                                            { "warmup", required_argument, NULL, 'w' },
+                                            { "iterations", required_argument, NULL, 'n' },
+                                            { "min-time", required_argument, NULL, 't' },
+                                            { "repetitions", required_argument, NULL, 'r' },
+                                            { "cpu", required_argument, NULL, 'c' },
+                                            { NULL, 0, NULL, 0 } };
+
+    while ((opt = getopt_long(argc, argv, "hlf:w:n:t:r:c:", long_options, &option_index))
+           != -1) {
+        switch (opt) {
+            case 'h':
+                printf("Benchmark libsm codecs, builders and analytics kernels, and print\n");
+                printf("the results as JSON.\n");
+                printf("USAGE:  %s [options]\n", argv[0]);
+                printf("Options:\n");
+                printf("  -l, --list\t\tList the cases and exit\n");
+                printf("  -f, --filter\t\tOnly run cases whose name contains this\n");
+                printf("  -w, --warmup\t\tUntimed ops before each case (default: 1000)\n");
+                printf("  -n, --iterations\tOps per repetition, 0 to calibrate (default: 0)\n");
+                printf("  -t, --min-time\tSeconds per repetition to calibrate for "
+                       "(default: 0.05)\n");
+                printf("  -r, --repetitions\tRepetitions per case (default: 5)\n");
+                printf("  -c, --cpu\t\tPin to this cpu\n");
+                exit(0);
+            case 'l':
+                for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+                    printf("%s\n", cases[i].name);
+                }
+                exit(0);
+            case 'f':
+                filter = optarg;
+                break;
+            case 'w':
+                warmup = strtoull(optarg, NULL, 10);
+                break;
+            case 'n':
+                iterations = strtoull(optarg, NULL, 10);
+                break;
+            case 't':
+                minTime = atof(optarg);
+                break;
+            case 'r':
+                repetitions = atoi(optarg);
+                break;
+            case 'c':
+                cpu = atoi(optarg);
+                break;
+            default:
+                exit(2);
+        }
+    }
+    if (repetitions < 1 || repetitions > MAX_REPS || minTime <= 0) {
+        fprintf(stderr, "bad arguments\n");
+        return 2;
+    }
+    if (cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+            perror("sched_setaffinity");
+            return 1;
+        }
+    }
+
+    printf("{\n");
+    printf("  \"library\": \"%s\",\n", VERSION_LIBSM);
+    printf("  \"warmup\": %llu,\n", (unsigned long long)warmup);
+    printf("  \"repetitions\": %d,\n", repetitions);
+    printf("  \"cpu\": %d,\n", cpu);
+    printf("  \"benchmarks\": [\n");
+    bool first = true;
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        if (filter == NULL || strstr(cases[i].name, filter) != NULL) {
+            benchmark(&cases[i], warmup, iterations, minTime, repetitions, first);
+            first = false;
+        }
+    }
+    printf("\n  ]\n}\n");
+    return 0;
+}
@@ -0,0 +1,239 @@
+/*
+ * stress_libsm.c
+ * Decode and encode a shared corpus from many threads at once, and check every result
+ *
+ * Threads share one read-only corpus and nothing else, the way worker pools share
+ * one libsm. Each message goes through the generic and the specialised UPER codec
+ * and the OER transcoder, and is rebuilt by the corpus generator, and all results
+ * have to match the corpus byte for byte. Build with -DLIBSM_TSAN=ON to run it
+ * under ThreadSanitizer.
+ */
+
+#include "libsm.h"
+#include "pathPrediction.h"
+#include <getopt.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define SLOT 4096
+
+
+typedef struct {
+    libsm_corpus_config_t config;
+    uint8_t* uper;
+    size_t* uperLens;
+    uint8_t* oer;
+    size_t* oerLens;
+    uint64_t size;
+} corpus_t;
+
+typedef struct {
+    corpus_t const* corpus;
+    uint64_t first;
+    uint64_t count;
+    uint64_t failures;
+    pthread_t thread;
+} worker_t;
+
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+
+static bool sameBytes(uint8_t const* a, size_t aLen, uint8_t const* b, size_t bLen)
+{
+    return aLen == bLen && memcmp(a, b, aLen) == 0;
+}
+
+
+// Decode with one codec and encode with the other, the bytes have to come back
+static bool uperRoundTrip(uint8_t const* uper, size_t len, bool fast)
+{
+    MessageFrame_t mf = { 0 };
+    uint8_t encoded[SLOT];
+    size_t encodedLen = sizeof(encoded);
+    libsm_rval_e rval = fast ? libsm_uper_fast_decode_messageframe(uper, len, &mf)
+                             : libsm_decode_messageframe(uper, len, &mf);
+    if (rval == LIBSM_OK) {
+        rval = fast ? libsm_encode_messageframe(&mf, encoded, &encodedLen)
+                    : libsm_uper_fast_encode_messageframe(&mf, encoded, &encodedLen);
+    }
+    ASN_STRUCT_RESET(asn_DEF_MessageFrame, &mf);
+    return rval == LIBSM_OK && sameBytes(uper, len, encoded, encodedLen);
+}
+
+
+// The deprecated path prediction keeps a context per thread, fed the same as ctx
+static bool pathPredictionMatches(libsm_pp_ctx_t* ctx, uint64_t index)
+{
+    PathPrediction_t shared = { 0 };
+    PathPrediction_t own = { 0 };
+    double const speed = (double)(index % 40);
+    double const yawRate = (double)(index % 21) - 10.0;
+    libsm_calculatePathPrediction(&shared, speed, yawRate);
+    libsm_calculatePathPrediction_ctx(ctx, &own, speed, yawRate);
+    return shared.radiusOfCurve == own.radiusOfCurve && shared.confidence == own.confidence;
+}
+
+
+static void* work(void* arg)
+{
+    worker_t* worker = arg;
+    corpus_t const* corpus = worker->corpus;
+    libsm_pp_ctx_t ctx;
+    libsm_pp_ctx_init(&ctx);
+    for (uint64_t n = 0; n < worker->count; n++) {
+        uint64_t const i = (worker->first + n) % corpus->size;
+        uint8_t const* uper = corpus->uper + i * SLOT;
+        size_t const uperLen = corpus->uperLens[i];
+        uint8_t buffer[SLOT];
+        size_t len = sizeof(buffer);
+        bool ok = uperRoundTrip(uper, uperLen, n % 2 == 1);
+
+        switch (n % 4) {
+            case 0:
+                ok = ok && libsm_transcode_uper_to_oer(uper, uperLen, buffer, &len) == LIBSM_OK
+                     && sameBytes(buffer, len, corpus->oer + i * SLOT, corpus->oerLens[i]);
+                break;
+            case 1:
+                ok = ok
+                     && libsm_transcode_oer_to_uper(
+                                corpus->oer + i * SLOT, corpus->oerLens[i], buffer, &len)
+                                == LIBSM_OK
+                     && sameBytes(buffer, len, uper, uperLen);
+                break;
+            case 2:
+                ok = ok && libsm_corpus_message(&corpus->config, i, buffer, &len) == LIBSM_OK
+                     && sameBytes(buffer, len, uper, uperLen);
+                break;
+            default:
+                ok = ok && pathPredictionMatches(&ctx, worker->first + n);
+                break;
+        }
+        if (!ok) {
+            worker->failures++;
+        }
+    }
+    return NULL;
+}
+
+
+int main(int argc, char** argv)
+{
+    long threads = sysconf(_SC_NPROCESSORS_ONLN);
+    uint64_t messages = 2000000;
+    corpus_t corpus = { .size = 4096 };
+    libsm_corpus_default_config(&corpus.config);
+    int opt;
+    int option_index = 0;
+
+    static struct option long_options[] = { { "help", no_argument, NULL, 'h' },
+                                            { "threads", required_argument, NULL, 't' },
+                                            { "messages", required_argument, NULL, 'n' },
+                                            { "corpus", required_argument, NULL, 'c' },
+                                            { "seed", required_argument, NULL, 's' },
+                                            { NULL, 0, NULL, 0 } };
+
+    while ((opt = getopt_long(argc, argv, "ht:n:c:s:", long_options, &option_index)) != -1) {
+        switch (opt) {
+            case 'h':
+                printf("Decode, encode and transcode a shared corpus from many threads, and\n");
+                printf("check every result. Exits with 1 if any result is wrong.\n");
+                printf("USAGE:  %s [options]\n", argv[0]);
+                printf("Options:\n");
+                printf("  -t, --threads\t\tThreads (default: online cpus)\n");
+                printf("  -n, --messages\tMessages over all threads (default: 2000000)\n");
+                printf("  -c, --corpus\t\tMessages in the corpus (default: 4096)\n");
+                printf("  -s, --seed\t\tSeed of the corpus (default: 1)\n");
+                exit(0);
+            case 't':
+                threads = atol(optarg);
+                break;
+            case 'n':
+                messages = strtoull(optarg, NULL, 0);
+                break;
+            case 'c':
+                corpus.size = strtoull(optarg, NULL, 0);
+                break;
+            case 's':
+                corpus.config.seed = strtoull(optarg, NULL, 0);
+                break;
+            default:
+                exit(2);
+        }
+    }
+    if (threads < 1 || corpus.size < 1) {
+        fprintf(stderr, "bad arguments\n");
+        return 2;
+    }
+
+    corpus.uper = malloc(corpus.size * SLOT);
+    corpus.uperLens = malloc(corpus.size * sizeof(size_t));
+    corpus.oer = malloc(corpus.size * SLOT);
+    corpus.oerLens = malloc(corpus.size * sizeof(size_t));
+    worker_t* workers = calloc((size_t)threads, sizeof(worker_t));
+    if (corpus.uper == NULL || corpus.uperLens == NULL || corpus.oer == NULL
+        || corpus.oerLens == NULL || workers == NULL) {
+        fprintf(stderr, "allocation failed\n");
+        return 1;
+    }
+    for (uint64_t i = 0; i < corpus.size; i++) {
+        corpus.uperLens[i] = SLOT;
+        corpus.oerLens[i] = SLOT;
+        if (libsm_corpus_message(&corpus.config, i, corpus.uper + i * SLOT, &corpus.uperLens[i])
+                    != LIBSM_OK
+            || libsm_transcode_uper_to_oer(corpus.uper + i * SLOT,
+                                           corpus.uperLens[i],
+                                           corpus.oer + i * SLOT,
+                                           &corpus.oerLens[i])
+                       != LIBSM_OK) {
+            fprintf(stderr, "building message %" PRIu64 " failed\n", i);
+            return 1;
+        }
+    }
+
+    double const start = nowSeconds();
+    uint64_t first = 0;
+    for (long t = 0; t < threads; t++) {
+        workers[t].corpus = &corpus;
+        workers[t].first = first;
+        workers[t].count = messages / (uint64_t)threads
+                           + ((uint64_t)t < messages % (uint64_t)threads);
+        first += workers[t].count;
+        if (pthread_create(&workers[t].thread, NULL, work, &workers[t]) != 0) {
+            fprintf(stderr, "starting thread %ld failed\n", t);
+            return 1;
+        }
+    }
+    uint64_t failures = 0;
+    for (long t = 0; t < threads; t++) {
+        pthread_join(workers[t].thread, NULL);
+        failures += workers[t].failures;
+    }
+    double const elapsed = nowSeconds() - start;
+
+    printf("{\"threads\": %ld, \"messages\": %" PRIu64 ", \"seconds\": %.3f, "
+           "\"messages_per_second\": %.0f, \"failures\": %" PRIu64 "}\n",
+           threads,
+           messages,
+           elapsed,
+           (double)messages / elapsed,
+           failures);
+
+    free(corpus.uper);
+    free(corpus.uperLens);
+    free(corpus.oer);
+    free(corpus.oerLens);
+    free(workers);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,162 @@
+/*
+ * benchConflict.c
+ * Step time of the conflict engine with many actors around one intersection
+ */
+
+#include "libsm.h"
+#include <getopt.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define REF_LAT  334150000
+#define REF_LONG -1119260000
+#define EPOCH_MS 1704067200000ULL
+
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+
+// xorshift, so every run simulates the same actors
+static uint32_t nextRandom(uint32_t* state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+
+static void countEvent(void* user, libsm_conflict_event_t const* event)
+{
+    (void)event;
+    (*(uint64_t*)user)++;
+}
+
+
+int main(int argc, char** argv)
+{
+    size_t actors = 4000;
+    size_t steps = 600;
+    double areaM = 400.0;
+    int opt;
+    int option_index = 0;
+    uint32_t seed = 31;
+
+    static struct option long_options[] = { { "help", no_argument, NULL, 'h' },
+                                            { "actors", required_argument, NULL, 'a' },
+                                            { "steps", required_argument, NULL, 's' },
+                                            { "area", required_argument, NULL, 'r' },
+                                            { NULL, 0, NULL, 0 } };
+
+    while ((opt = getopt_long(argc, argv, "ha:s:r:", long_options, &option_index)) != -1) {
+        switch (opt) {
+            case 'h':
+                printf("Simulate pedestrians and vehicles moving through a square around an\n");
+                printf("intersection at 10 Hz, update the conflict engine and step it every 100 ms.\n");
+                printf("USAGE:  %s [options]\n", argv[0]);
+                printf("Options:\n");
+                printf("  -a, --actors\tNumber of actors, a quarter are VRUs (default: 4000)\n");
+                printf("  -s, --steps\tNumber of 100 ms steps (default: 600)\n");
+                printf("  -r, --area\tSide of the square in meters (default: 400)\n");
+                exit(0);
+            case 'a':
+                actors = strtoul(optarg, NULL, 10);
+                break;
+            case 's':
+                steps = strtoul(optarg, NULL, 10);
+                break;
+            case 'r':
+                areaM = strtod(optarg, NULL);
+                break;
+            default:
+                exit(2);
+        }
+    }
+
+    double const metersPerUnit = Latitude_m_per_unit;
+    double const cosLat = cos((double)REF_LAT / Latitude_unit_deg * (M_PI / 180.0));
+    libsm_conflict_config_t config;
+    libsm_conflict_t eng;
+    uint64_t events = 0;
+
+    libsm_conflict_default_config(&config, REF_LAT, REF_LONG);
+    config.maxActors = actors;
+    if (libsm_conflict_init(&eng, &config, countEvent, &events) != LIBSM_OK) {
+        fprintf(stderr, "init failed\n");
+        return 1;
+    }
+
+    double* state = calloc(actors * 4, sizeof(double));
+    if (state == NULL) {
+        fprintf(stderr, "allocation failed\n");
+        return 1;
+    }
+    for (size_t a = 0; a < actors; a++) {
+        double const speed = (a % 4 == 0) ? 1.0 + (nextRandom(&seed) % 100) / 100.0
+                                          : 5.0 + (nextRandom(&seed) % 1000) / 100.0;
+        double const heading = (double)(nextRandom(&seed) % 360) * (M_PI / 180.0);
+        state[a * 4 + 0] = ((double)(nextRandom(&seed) % 10000) / 10000.0 - 0.5) * areaM;
+        state[a * 4 + 1] = ((double)(nextRandom(&seed) % 10000) / 10000.0 - 0.5) * areaM;
+        state[a * 4 + 2] = speed;
+        state[a * 4 + 3] = heading;
+    }
+
+    double updateTime = 0.0;
+    double stepTime = 0.0;
+    double worstStep = 0.0;
+
+    for (size_t step = 0; step < steps; step++) {
+        uint64_t const timeMs = EPOCH_MS + step * 100;
+
+        double start = nowSeconds();
+        for (size_t a = 0; a < actors; a++) {
+            double* s = &state[a * 4];
+            s[0] += s[2] * 0.1 * sin(s[3]);
+            s[1] += s[2] * 0.1 * cos(s[3]);
+            // wrap around inside the square
+            s[0] = fmod(s[0] + 1.5 * areaM, areaM) - 0.5 * areaM;
+            s[1] = fmod(s[1] + 1.5 * areaM, areaM) - 0.5 * areaM;
+
+            libsm_traj_sample_t const sample = {
+                .source = (a % 4 == 0) ? LIBSM_TRAJ_SOURCE_PSM : LIBSM_TRAJ_SOURCE_BSM,
+                .id = (uint32_t)a,
+                .secMark = (uint16_t)(timeMs % 60000),
+                .lat = REF_LAT + lround(s[1] / metersPerUnit),
+                .Long = REF_LONG + lround(s[0] / (metersPerUnit * cosLat)),
+                .speed = (uint16_t)lround(s[2] / 0.02),
+                .heading = (uint16_t)lround(s[3] * (180.0 / M_PI) / 0.0125),
+                .rxTimeMs = timeMs,
+            };
+            libsm_conflict_update(&eng, &sample);
+        }
+        updateTime += nowSeconds() - start;
+
+        start = nowSeconds();
+        libsm_conflict_step(&eng, timeMs);
+        double const elapsed = nowSeconds() - start;
+        stepTime += elapsed;
+        worstStep = elapsed > worstStep ? elapsed : worstStep;
+    }
+
+    printf("actors: %zu in %.0f m square, steps: %zu\n", actors, areaM, steps);
+    printf("update: %.1f ns/report\n", updateTime / ((double)actors * (double)steps) * 1e9);
+    printf("step:   %.1f us mean, %.1f us worst, %.1f pairs/step\n",
+           stepTime / (double)steps * 1e6,
+           worstStep * 1e6,
+           (double)eng.stats.pairsChecked / (double)steps);
+    printf("events: %lu\n", (unsigned long)events);
+
+    libsm_conflict_free(&eng);
+    free(state);
+    return 0;
+}
@@ -0,0 +1,139 @@
+/*
+ * benchGeohash.c
+ * Throughput of the batch geohash encoder against a textbook bisection
+ */
+
+#include "libsm.h"
+#include <getopt.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+
+// xorshift, so every run uses the same points
+static uint32_t nextRandom(uint32_t* state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+
+// one bit at a time, in degrees, the way most geohash code does it
+static uint64_t referenceGeohash(Latitude_t lat, Longitude_t Long, unsigned precision)
+{
+    double latRange[2] = { -90.0, 90.0 };
+    double longRange[2] = { -180.0, 180.0 };
+    double const latDeg = (double)lat / Latitude_unit_deg;
+    double const longDeg = (double)Long / Latitude_unit_deg;
+    uint64_t hash = 0;
+
+    for (unsigned bit = 0; bit < 5 * precision; bit++) {
+        double* range = (bit % 2 == 0) ? longRange : latRange;
+        double const value = (bit % 2 == 0) ? longDeg : latDeg;
+        double const mid = (range[0] + range[1]) / 2;
+
+        hash <<= 1;
+        if (value >= mid) {
+            hash |= 1;
+            range[0] = mid;
+        } else {
+            range[1] = mid;
+        }
+    }
+    return hash;
+}
+
+
+int main(int argc, char** argv)
+{
+    size_t points = 4000000;
+    unsigned precision = 8;
+    int opt;
+    int option_index = 0;
+    uint32_t seed = 2735;
+
+    static struct option long_options[] = { { "help", no_argument, NULL, 'h' },
+                                            { "points", required_argument, NULL, 'n' },
+                                            { "precision", required_argument, NULL, 'p' },
+                                            { NULL, 0, NULL, 0 } };
+
+    while ((opt = getopt_long(argc, argv, "hn:p:", long_options, &option_index)) != -1) {
+        switch (opt) {
+            case 'h':
+                printf("Geohash random points around Phoenix with libsm_geohash_encode_batch\n");
+                printf("and with a scalar bisection, and check that they agree.\n");
+                printf("USAGE:  %s [options]\n", argv[0]);
+                printf("Options:\n");
+                printf("  -n, --points\tNumber of points (default: 4000000)\n");
+                printf("  -p, --precision\tGeohash characters, 1 to 12 (default: 8)\n");
+                exit(0);
+            case 'n':
+                points = strtoul(optarg, NULL, 10);
+                break;
+            case 'p':
+                precision = (unsigned)strtoul(optarg, NULL, 10);
+                break;
+            default:
+                exit(2);
+        }
+    }
+    if (precision < 1 || precision > LIBSM_GEOHASH_MAX_PRECISION) {
+        fprintf(stderr, "precision must be 1 to %d\n", LIBSM_GEOHASH_MAX_PRECISION);
+        return 2;
+    }
+
+    Latitude_t* lat = malloc(points * sizeof(Latitude_t));
+    Longitude_t* Long = malloc(points * sizeof(Longitude_t));
+    uint64_t* hash = malloc(points * sizeof(uint64_t));
+    uint64_t* reference = malloc(points * sizeof(uint64_t));
+    if (lat == NULL || Long == NULL || hash == NULL || reference == NULL) {
+        fprintf(stderr, "allocation failed\n");
+        return 1;
+    }
+    // a 1 degree square around the metro area
+    for (size_t i = 0; i < points; i++) {
+        lat[i] = 329000000 + (Latitude_t)(nextRandom(&seed) % 10000000);
+        Long[i] = -1124000000 + (Longitude_t)(nextRandom(&seed) % 10000000);
+    }
+
+    double start = nowSeconds();
+    for (size_t i = 0; i < points; i++) {
+        reference[i] = referenceGeohash(lat[i], Long[i], precision);
+    }
+    double const referenceTime = nowSeconds() - start;
+
+    start = nowSeconds();
+    libsm_geohash_encode_batch(lat, Long, points, precision, hash);
+    double const batchTime = nowSeconds() - start;
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < points; i++) {
+        mismatches += hash[i] != reference[i];
+    }
+
+    printf("points: %zu, precision: %u\n", points, precision);
+    printf("bisection: %.2f ns/point\n", referenceTime / (double)points * 1e9);
+    printf("batch:     %.2f ns/point, %.1fx\n",
+           batchTime / (double)points * 1e9,
+           referenceTime / batchTime);
+    printf("mismatches: %zu\n", mismatches);
+
+    free(reference);
+    free(hash);
+    free(Long);
+    free(lat);
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,277 @@
+/*
+ * benchHex.c
+ * Compare the hex codec variants with the per byte conversions the tools and JER used before
+ */
+
+#include "asn_hex.h"
+#include "libsm.h"
+#include <getopt.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_BYTES 4096
+
+typedef void (*encodeFn)(uint8_t const*, size_t, char*);
+typedef void (*decodeFn)(char const*, size_t, uint8_t*);
+
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+
+// xorshift, so every run uses the same bytes
+static uint32_t nextRandom(uint32_t* state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+
+// The nibble table loop of the JER encoders
+static void encodeNibbles(uint8_t const* bytes, size_t len, char* hex)
+{
+    const char* const h2c = "0123456789ABCDEF";
+    for (size_t i = 0; i < len; i++) {
+        *hex++ = h2c[(bytes[i] >> 4) & 0x0F];
+        *hex++ = h2c[bytes[i] & 0x0F];
+    }
+}
+
+
+static void encodeSprintf(uint8_t const* bytes, size_t len, char* hex)
+{
+    for (size_t i = 0; i < len; i++) {
+        sprintf(hex + 2 * i, "%02X", bytes[i]);
+    }
+}
+
+
+static void encodeScalar(uint8_t const* bytes, size_t len, char* hex)
+{
+    asn_hex_encode_with(ASN_HEX_SCALAR, bytes, len, hex, 0);
+}
+
+
+static void encodeSsse3(uint8_t const* bytes, size_t len, char* hex)
+{
+    asn_hex_encode_with(ASN_HEX_SSSE3, bytes, len, hex, 0);
+}
+
+
+static void encodeAvx2(uint8_t const* bytes, size_t len, char* hex)
+{
+    asn_hex_encode_with(ASN_HEX_AVX2, bytes, len, hex, 0);
+}
+
+
+// validator.c before
+static void decodeStrtol(char const* hex, size_t len, uint8_t* bytes)
+{
+    char buf[8];
+    for (size_t i = 0; i < len; i += 2) {
+        sprintf(buf, "%c%c", hex[i], hex[i + 1]);
+        bytes[i / 2] = (uint8_t)strtol(buf, NULL, 16);
+    }
+}
+
+
+// decodeToJER.c before
+static void decodeSscanf(char const* hex, size_t len, uint8_t* bytes)
+{
+    for (size_t i = 0; i < len / 2; i++) {
+        sscanf(&hex[i * 2], "%2hhx", &bytes[i]);
+    }
+}
+
+
+// The switch per char of the JER decoders
+static void decodeSwitch(char const* hex, size_t len, uint8_t* bytes)
+{
+    unsigned clv = 0;
+    int half = 0;
+    for (size_t i = 0; i < len; i++) {
+        int const ch = (unsigned char)hex[i];
+        if (ch >= '0' && ch <= '9') {
+            clv = (clv << 4) + (unsigned)(ch - '0');
+        } else if (ch >= 'A' && ch <= 'F') {
+            clv = (clv << 4) + (unsigned)(ch - 'A' + 10);
+        } else if (ch >= 'a' && ch <= 'f') {
+            clv = (clv << 4) + (unsigned)(ch - 'a' + 10);
+        } else {
+            return;
+        }
+        if (half++) {
+            half = 0;
+            *bytes++ = (uint8_t)clv;
+        }
+    }
+}
+
+
+static void decodeScalar(char const* hex, size_t len, uint8_t* bytes)
+{
+    asn_hex_decode_with(ASN_HEX_SCALAR, hex, len, bytes);
+}
+
+
+static void decodeSsse3(char const* hex, size_t len, uint8_t* bytes)
+{
+    asn_hex_decode_with(ASN_HEX_SSSE3, hex, len, bytes);
+}
+
+
+static void decodeAvx2(char const* hex, size_t len, uint8_t* bytes)
+{
+    asn_hex_decode_with(ASN_HEX_AVX2, hex, len, bytes);
+}
+
+
+typedef struct {
+    char const* name;
+    encodeFn encode;
+    decodeFn decode;
+    int impl; /* asn_hex_impl_e, or -1 for the conversions from before */
+} variant_t;
+
+static variant_t const variants[] = {
+    { "sprintf", encodeSprintf, NULL, -1 },
+    { "nibble table", encodeNibbles, NULL, -1 },
+    { "strtol", NULL, decodeStrtol, -1 },
+    { "sscanf", NULL, decodeSscanf, -1 },
+    { "switch", NULL, decodeSwitch, -1 },
+    { "asn_hex scalar", encodeScalar, decodeScalar, ASN_HEX_SCALAR },
+    { "asn_hex ssse3", encodeSsse3, decodeSsse3, ASN_HEX_SSSE3 },
+    { "asn_hex avx2", encodeAvx2, decodeAvx2, ASN_HEX_AVX2 },
+};
+
+
+// Best of rounds, in ns per byte
+static double timeVariant(variant_t const* v,
+                          bool encode,
+                          uint8_t const* bytes,
+                          char const* hex,
+                          size_t len,
+                          uint64_t totalBytes,
+                          int rounds)
+{
+    static char encoded[2 * MAX_BYTES + 1];
+    static uint8_t decoded[MAX_BYTES];
+    uint64_t const reps = totalBytes / len + 1;
+    double best = INFINITY;
+    for (int r = 0; r < rounds; r++) {
+        double const start = nowSeconds();
+        for (uint64_t i = 0; i < reps; i++) {
+            if (encode) {
+                v->encode(bytes, len, encoded);
+            } else {
+                v->decode(hex, 2 * len, decoded);
+            }
+            // keep the compiler from dropping the results
+            __asm__ volatile("" : : "r"(encoded), "r"(decoded) : "memory");
+        }
+        double const elapsed = nowSeconds() - start;
+        best = elapsed < best ? elapsed : best;
+    }
+    return best / (double)(reps * len) * 1e9;
+}
+
+
+int main(int argc, char** argv)
+{
+    uint64_t totalBytes = 4 * 1024 * 1024;
+    int rounds = 5;
+    int opt;
+    int option_index = 0;
+
+    static struct option long_options[] = { { "help", no_argument, NULL, 'h' },
+                                            { "bytes", required_argument, NULL, 'n' },
+                                            { "rounds", required_argument, NULL, 'r' },
+                                            { NULL, 0, NULL, 0 } };
+
+    while ((opt = getopt_long(argc, argv, "hn:r:", long_options, &option_index)) != -1) {
+        switch (opt) {
+            case 'h':
+                printf("Time hex encoding and decoding of TemporaryID, MessageFrame and large\n");
+                printf("sizes with every variant, in ns per byte.\n");
+                printf("USAGE:  %s [options]\n", argv[0]);
+                printf("Options:\n");
+                printf("  -n, --bytes\t\tBytes converted per round and size (default: 4194304)\n");
+                printf("  -r, --rounds\t\tRounds, the best counts (default: 5)\n");
+                exit(0);
+            case 'n':
+                totalBytes = strtoull(optarg, NULL, 0);
+                break;
+            case 'r':
+                rounds = atoi(optarg);
+                break;
+            default:
+                exit(2);
+        }
+    }
+    if (rounds < 1) {
+        fprintf(stderr, "bad arguments\n");
+        return 2;
+    }
+
+    // a TemporaryID, a typical BSM with Part II, and a long string
+    size_t const sizes[] = { 4, 64, MAX_BYTES };
+    uint8_t bytes[MAX_BYTES];
+    uint8_t check[MAX_BYTES];
+    char hex[2 * MAX_BYTES + 1];
+    uint32_t seed = 2463534242u;
+    for (size_t i = 0; i < MAX_BYTES; i++) {
+        bytes[i] = (uint8_t)nextRandom(&seed);
+    }
+    asn_hex_encode_with(ASN_HEX_SCALAR, bytes, MAX_BYTES, hex, 0);
+
+    static char const* const implNames[] = { "scalar", "ssse3", "avx2" };
+    printf("asn_hex_encode and asn_hex_decode use %s\n", implNames[asn_hex_best()]);
+    printf("%-16s %-7s %12s %12s %12s\n", "variant", "", "4 B", "64 B", "4096 B");
+    for (size_t v = 0; v < sizeof(variants) / sizeof(variants[0]); v++) {
+        variant_t const* variant = &variants[v];
+        if (variant->impl >= 0 && !asn_hex_supported((asn_hex_impl_e)variant->impl)) {
+            continue;
+        }
+        for (int encode = 1; encode >= 0; encode--) {
+            if ((encode && variant->encode == NULL) || (!encode && variant->decode == NULL)) {
+                continue;
+            }
+            printf("%-16s %-7s", variant->name, encode ? "encode" : "decode");
+            for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+                double const ns
+                        = timeVariant(variant, encode, bytes, hex, sizes[s], totalBytes, rounds);
+                printf(" %9.2f ns", ns);
+            }
+            printf("\n");
+
+            // every variant has to give the same result
+            if (encode) {
+                char again[2 * MAX_BYTES + 1];
+                variant->encode(bytes, MAX_BYTES, again);
+                if (memcmp(again, hex, 2 * MAX_BYTES) != 0) {
+                    fprintf(stderr, "%s encodes wrong\n", variant->name);
+                    return 1;
+                }
+            } else {
+                variant->decode(hex, 2 * MAX_BYTES, check);
+                if (memcmp(check, bytes, sizeof(check)) != 0) {
+                    fprintf(stderr, "%s decodes wrong\n", variant->name);
+                    return 1;
+                }
+            }
+        }
+    }
+    return 0;
+}
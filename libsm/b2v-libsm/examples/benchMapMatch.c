@@ -0,0 +1,200 @@
+/*
+ * benchMapMatch.c
+ * Compile a MAP with a grid of intersections and measure map matching throughput
+ */
+
+#include "libsm.h"
+#include <getopt.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define REF_LAT       334150000
+#define REF_LONG      -1119260000
+#define SPACING_M     200.0
+#define LANES_PER_LEG 4
+
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+
+// xorshift, so every run matches the same positions
+static uint32_t nextRandom(uint32_t* state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+
+static NodeXY_t* node(long x, long y)
+{
+    NodeXY_t* n = calloc(1, sizeof(NodeXY_t));
+    n->delta.present = NodeOffsetPointXY_PR_node_XY6;
+    n->delta.choice.node_XY6 = calloc(1, sizeof(Node_XY_32b_t));
+    n->delta.choice.node_XY6->x = x;
+    n->delta.choice.node_XY6->y = y;
+    return n;
+}
+
+
+/*
+ * One intersection every SPACING_M meters, four legs of LANES_PER_LEG lanes,
+ * half ingress and half egress, each lane running 90 m away from the center.
+ */
+static MapData_t* buildMap(int side)
+{
+    double const metersPerUnit = Latitude_m_per_unit;
+    double const cosLat = cos((double)REF_LAT / Latitude_unit_deg * (M_PI / 180.0));
+    MapData_t* map = calloc(1, sizeof(MapData_t));
+    map->intersections = calloc(1, sizeof(IntersectionGeometryList_t));
+
+    for (int i = 0; i < side * side; i++) {
+        IntersectionGeometry_t* geometry = calloc(1, sizeof(IntersectionGeometry_t));
+        geometry->id.id = i + 1;
+        geometry->refPoint.lat = REF_LAT + lround((i / side) * SPACING_M / metersPerUnit);
+        geometry->refPoint.Long =
+                REF_LONG + lround((i % side) * SPACING_M / (metersPerUnit * cosLat));
+        ASN_SEQUENCE_ADD(&map->intersections->list, geometry);
+
+        for (int leg = 0; leg < 4; leg++) {
+            for (int l = 0; l < LANES_PER_LEG; l++) {
+                // leg 0 runs north, 1 east, 2 south, 3 west, lanes side by side across it
+                long const across = (long)(l - LANES_PER_LEG / 2) * 360 + 180;
+                long const ax = leg % 2 ? 0 : (leg == 0 ? across : -across);
+                long const ay = leg % 2 ? (leg == 1 ? -across : across) : 0;
+                long const ux = leg == 1 ? 1 : (leg == 3 ? -1 : 0);
+                long const uy = leg == 0 ? 1 : (leg == 2 ? -1 : 0);
+                GenericLane_t* lane = calloc(1, sizeof(GenericLane_t));
+                lane->laneID = leg * LANES_PER_LEG + l + 1;
+                libsm_init_bit_string(&lane->laneAttributes.directionalUse, 2);
+                lane->laneAttributes.directionalUse.buf[0] = l < LANES_PER_LEG / 2 ? 0x80 : 0x40;
+                lane->nodeList.present = NodeListXY_PR_nodes;
+                lane->nodeList.choice.nodes = calloc(1, sizeof(NodeSetXY_t));
+                ASN_SEQUENCE_ADD(&lane->nodeList.choice.nodes->list,
+                                 node(ax + ux * 1200, ay + uy * 1200));
+                for (int n = 0; n < 3; n++) {
+                    ASN_SEQUENCE_ADD(&lane->nodeList.choice.nodes->list,
+                                     node(ux * 2600, uy * 2600));
+                }
+                ASN_SEQUENCE_ADD(&geometry->laneSet.list, lane);
+            }
+        }
+    }
+    return map;
+}
+
+
+int main(int argc, char** argv)
+{
+    int side = 10;
+    size_t count = 1000000;
+    int rounds = 5;
+    int opt;
+    int option_index = 0;
+    uint32_t seed = 32;
+
+    static struct option long_options[] = { { "help", no_argument, NULL, 'h' },
+                                            { "side", required_argument, NULL, 's' },
+                                            { "count", required_argument, NULL, 'n' },
+                                            { "rounds", required_argument, NULL, 'r' },
+                                            { NULL, 0, NULL, 0 } };
+
+    while ((opt = getopt_long(argc, argv, "hs:n:r:", long_options, &option_index)) != -1) {
+        switch (opt) {
+            case 'h':
+                printf("Compile a MAP with side x side intersections and match random positions\n");
+                printf("against it.\n");
+                printf("USAGE:  %s [options]\n", argv[0]);
+                printf("Options:\n");
+                printf("  -s, --side\tIntersections per side of the grid (default: 10)\n");
+                printf("  -n, --count\tPositions matched per round (default: 1000000)\n");
+                printf("  -r, --rounds\tRounds (default: 5)\n");
+                exit(0);
+            case 's':
+                side = atoi(optarg);
+                break;
+            case 'n':
+                count = strtoul(optarg, NULL, 10);
+                break;
+            case 'r':
+                rounds = atoi(optarg);
+                break;
+            default:
+                exit(2);
+        }
+    }
+    if (side < 1 || count == 0) {
+        fprintf(stderr, "bad arguments\n");
+        return 2;
+    }
+
+    MapData_t* mapData = buildMap(side);
+    libsm_map_t map;
+    double start = nowSeconds();
+    if (libsm_map_compile(mapData, NULL, &map) != LIBSM_OK) {
+        fprintf(stderr, "compile failed\n");
+        return 1;
+    }
+    double const compileTime = nowSeconds() - start;
+
+    Latitude_t* lats = malloc(count * sizeof(Latitude_t));
+    Longitude_t* longs = malloc(count * sizeof(Longitude_t));
+    Heading_t* headings = malloc(count * sizeof(Heading_t));
+    libsm_map_match_t* matches = malloc(count * sizeof(libsm_map_match_t));
+    if (lats == NULL || longs == NULL || headings == NULL || matches == NULL) {
+        fprintf(stderr, "allocation failed\n");
+        return 1;
+    }
+    double const extent = (side - 1) * SPACING_M + 200.0;
+    for (size_t i = 0; i < count; i++) {
+        double const east = (nextRandom(&seed) % 100000) / 100000.0 * extent - 100.0;
+        double const north = (nextRandom(&seed) % 100000) / 100000.0 * extent - 100.0;
+        lats[i] = map.originLat + lround(north / map.metersPerLat);
+        longs[i] = map.originLong + lround(east / map.metersPerLong);
+        headings[i] = (Heading_t)(nextRandom(&seed) % 28800);
+    }
+
+    double best = INFINITY;
+    size_t matched = 0;
+    for (int r = 0; r < rounds; r++) {
+        start = nowSeconds();
+        libsm_map_match_batch(&map, lats, longs, headings, count, matches);
+        double const elapsed = nowSeconds() - start;
+        best = elapsed < best ? elapsed : best;
+    }
+    for (size_t i = 0; i < count; i++) {
+        matched += matches[i].matched;
+    }
+
+    printf("intersections: %d, lanes: %zu, points: %zu, cells: %u x %u of %.0f m\n",
+           side * side,
+           map.laneCount,
+           map.pointCount,
+           map.cellsX,
+           map.cellsY,
+           map.cellSizeM);
+    printf("compile: %.2f ms\n", compileTime * 1e3);
+    printf("match:   %.1f ns/position, %.2f M positions/s, %.1f %% matched\n",
+           best / (double)count * 1e9,
+           (double)count / best / 1e6,
+           100.0 * (double)matched / (double)count);
+
+    libsm_map_free(&map);
+    ASN_STRUCT_FREE(asn_DEF_MapData, mapData);
+    free(lats);
+    free(longs);
+    free(headings);
+    free(matches);
+    return 0;
+}
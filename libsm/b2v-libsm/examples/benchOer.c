@@ -0,0 +1,219 @@
+/*
+ * benchOer.c
+ * Compare UPER and OER on BSM and PSM MessageFrames: size, decoding and transcoding time
+ */
+
+#include "libsm.h"
+#include <getopt.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define SLOT 512
+
+typedef libsm_rval_e (*decodeFn)(uint8_t const*, size_t, MessageFrame_t*);
+typedef MessageFrame_t* (*buildFn)(uint32_t*, bool);
+
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+
+// xorshift, so every run uses the same messages
+static uint32_t nextRandom(uint32_t* state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+
+// A moving vehicle, with path history and prediction when partII is set
+static MessageFrame_t* buildBsm(uint32_t* seed, bool partII)
+{
+    MessageFrame_t* mf = libsm_alloc_init_mf_bsm();
+    BSMcoreData_t* core = &mf->value.choice.BasicSafetyMessage.coreData;
+    core->msgCnt = nextRandom(seed) % 128;
+    core->secMark = nextRandom(seed) % 60000;
+    core->lat = 334150000 + (long)(nextRandom(seed) % 100000);
+    core->Long = -1119260000 + (long)(nextRandom(seed) % 100000);
+    core->elev = nextRandom(seed) % 4000;
+    core->speed = nextRandom(seed) % 2000;
+    core->heading = nextRandom(seed) % 28800;
+    core->size.width = 200;
+    core->size.length = 480;
+    if (partII) {
+        libsm_init_bsm_path_history(&mf->value.choice.BasicSafetyMessage);
+        libsm_set_path_prediction(&mf->value.choice.BasicSafetyMessage, 100, 32767);
+    }
+    return mf;
+}
+
+
+// A walking pedestrian, with path history when partII is set
+static MessageFrame_t* buildPsm(uint32_t* seed, bool partII)
+{
+    MessageFrame_t* mf = libsm_alloc_init_mf_psm();
+    PersonalSafetyMessage_t* psm = &mf->value.choice.PersonalSafetyMessage;
+    psm->basicType = PersonalDeviceUserType_aPEDESTRIAN;
+    psm->msgCnt = nextRandom(seed) % 128;
+    psm->secMark = nextRandom(seed) % 60000;
+    psm->position.lat = 334150000 + (long)(nextRandom(seed) % 100000);
+    psm->position.Long = -1119260000 + (long)(nextRandom(seed) % 100000);
+    psm->speed = nextRandom(seed) % 150;
+    psm->heading = nextRandom(seed) % 28800;
+    if (partII) {
+        libsm_init_psm_path_history(psm);
+    }
+    return mf;
+}
+
+
+static double timeDecode(decodeFn decode, uint8_t* encoded, size_t* lens, int count, int rounds)
+{
+    double best = INFINITY;
+    for (int r = 0; r < rounds; r++) {
+        double const start = nowSeconds();
+        for (int i = 0; i < count; i++) {
+            MessageFrame_t mf = { 0 };
+            if (decode(encoded + i * SLOT, lens[i], &mf) != LIBSM_OK) {
+                fprintf(stderr, "decoding failed\n");
+                exit(1);
+            }
+            ASN_STRUCT_RESET(asn_DEF_MessageFrame, &mf);
+        }
+        double const elapsed = nowSeconds() - start;
+        best = elapsed < best ? elapsed : best;
+    }
+    return best / count * 1e9;
+}
+
+
+// Encode count messages of one type both ways, then time decoding and transcoding them
+static int benchMessages(char const* name, buildFn build, bool partII, int count, int rounds)
+{
+    uint32_t seed = 37;
+    uint8_t* uper = malloc((size_t)count * SLOT);
+    uint8_t* oer = malloc((size_t)count * SLOT);
+    size_t* uperLens = malloc(count * sizeof(size_t));
+    size_t* oerLens = malloc(count * sizeof(size_t));
+    uint8_t const** messages = malloc(count * sizeof(uint8_t const*));
+    size_t archiveSize = (size_t)count * SLOT;
+    uint8_t* archive = malloc(archiveSize);
+    if (uper == NULL || oer == NULL || uperLens == NULL || oerLens == NULL || messages == NULL
+        || archive == NULL) {
+        fprintf(stderr, "allocation failed\n");
+        return 1;
+    }
+    size_t uperTotal = 0;
+    size_t oerTotal = 0;
+    for (int i = 0; i < count; i++) {
+        MessageFrame_t* mf = build(&seed, partII);
+        uperLens[i] = SLOT;
+        oerLens[i] = SLOT;
+        if (libsm_encode_messageframe(mf, uper + i * SLOT, &uperLens[i]) != LIBSM_OK
+            || libsm_encode_messageframe_oer(mf, oer + i * SLOT, &oerLens[i]) != LIBSM_OK) {
+            fprintf(stderr, "%s encoding failed\n", name);
+            return 1;
+        }
+        ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+        messages[i] = uper + i * SLOT;
+        uperTotal += uperLens[i];
+        oerTotal += oerLens[i];
+    }
+
+    double const uperDecode = timeDecode(libsm_decode_messageframe, uper, uperLens, count, rounds);
+    double const oerDecode =
+            timeDecode(libsm_decode_messageframe_oer, oer, oerLens, count, rounds);
+
+    double best = INFINITY;
+    for (int r = 0; r < rounds; r++) {
+        size_t len = archiveSize;
+        size_t done;
+        double const start = nowSeconds();
+        if (libsm_transcode_uper_to_oer_archive(messages, uperLens, count, archive, &len, &done)
+            != LIBSM_OK) {
+            fprintf(stderr, "%s transcoding failed at message %zu\n", name, done);
+            return 1;
+        }
+        double const elapsed = nowSeconds() - start;
+        best = elapsed < best ? elapsed : best;
+    }
+
+    printf("%s:\n", name);
+    printf("  size: UPER %.1f bytes/msg, OER %.1f bytes/msg\n",
+           (double)uperTotal / count,
+           (double)oerTotal / count);
+    printf("  decode: UPER %.0f ns/msg, OER %.0f ns/msg\n", uperDecode, oerDecode);
+    printf("  UPER to OER archive: %.0f ns/msg\n", best / count * 1e9);
+
+    free(uper);
+    free(oer);
+    free(uperLens);
+    free(oerLens);
+    free(messages);
+    free(archive);
+    return 0;
+}
+
+
+int main(int argc, char** argv)
+{
+    int count = 10000;
+    int rounds = 10;
+    bool partII = false;
+    int opt;
+    int option_index = 0;
+
+    static struct option long_options[] = { { "help", no_argument, NULL, 'h' },
+                                            { "count", required_argument, NULL, 'n' },
+                                            { "rounds", required_argument, NULL, 'r' },
+                                            { "part-ii", no_argument, NULL, 'p' },
+                                            { NULL, 0, NULL, 0 } };
+
+    while ((opt = getopt_long(argc, argv, "hn:r:p", long_options, &option_index)) != -1) {
+        switch (opt) {
+            case 'h':
+                printf("Encode random BSMs and PSMs as UPER and OER, then time decoding both\n");
+                printf("and transcoding all of them into an OER archive.\n");
+                printf("USAGE:  %s [options]\n", argv[0]);
+                printf("Options:\n");
+                printf("  -n, --count\tMessages per round (default: 10000)\n");
+                printf("  -r, --rounds\tRounds (default: 10)\n");
+                printf("  -p, --part-ii\tAdd path history, and path prediction to the BSMs\n");
+                exit(0);
+            case 'n':
+                count = atoi(optarg);
+                break;
+            case 'r':
+                rounds = atoi(optarg);
+                break;
+            case 'p':
+                partII = true;
+                break;
+            default:
+                exit(2);
+        }
+    }
+    if (count < 1 || rounds < 1) {
+        fprintf(stderr, "bad arguments\n");
+        return 2;
+    }
+
+    printf("messages: %d of each type\n", count);
+    if (benchMessages("BSM", buildBsm, partII, count, rounds) != 0
+        || benchMessages("PSM", buildPsm, partII, count, rounds) != 0) {
+        return 1;
+    }
+    return 0;
+}
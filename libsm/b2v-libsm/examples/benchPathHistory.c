@@ -0,0 +1,146 @@
+/*
+ * benchPathHistory.c
+ * Throughput of the incremental path history generator across many simulated devices
+ */
+
+#include "libsm.h"
+#include <getopt.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define ORIGIN_LAT  334150000
+#define ORIGIN_LONG -1119260000
+
+
+typedef struct {
+    double east;
+    double north;
+    double heading;
+    double speed;
+} walker_t;
+
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+
+// xorshift, so every run simulates the same walks
+static uint32_t nextRandom(uint32_t* state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+
+int main(int argc, char** argv)
+{
+    size_t devices = 10000;
+    size_t steps = 600;
+    int opt;
+    int option_index = 0;
+    uint32_t seed = 2945;
+
+    static struct option long_options[] = { { "help", no_argument, NULL, 'h' },
+                                            { "devices", required_argument, NULL, 'd' },
+                                            { "steps", required_argument, NULL, 's' },
+                                            { NULL, 0, NULL, 0 } };
+
+    while ((opt = getopt_long(argc, argv, "hd:s:", long_options, &option_index)) != -1) {
+        switch (opt) {
+            case 'h':
+                printf("Simulate devices walking at 10 Hz, feed every fix to a path history\n");
+                printf("generator and fill a PSM path history for every device every step.\n");
+                printf("USAGE:  %s [options]\n", argv[0]);
+                printf("Options:\n");
+                printf("  -d, --devices\tNumber of simulated devices (default: 10000)\n");
+                printf("  -s, --steps\tNumber of 100 ms steps (default: 600)\n");
+                exit(0);
+            case 'd':
+                devices = strtoul(optarg, NULL, 10);
+                break;
+            case 's':
+                steps = strtoul(optarg, NULL, 10);
+                break;
+            default:
+                exit(2);
+        }
+    }
+
+    double const metersPerUnit = Latitude_m_per_unit;
+    double const cosLat = cos((double)ORIGIN_LAT / Latitude_unit_deg * (M_PI / 180.0));
+
+    libsm_ph_gen_t* gens = calloc(devices, sizeof(libsm_ph_gen_t));
+    walker_t* walkers = calloc(devices, sizeof(walker_t));
+    PathHistory_t** histories = calloc(devices, sizeof(PathHistory_t*));
+    if (gens == NULL || walkers == NULL || histories == NULL) {
+        fprintf(stderr, "allocation failed\n");
+        return 1;
+    }
+    for (size_t d = 0; d < devices; d++) {
+        libsm_ph_gen_init(&gens[d]);
+        histories[d] = libsm_alloc_init_path_history();
+        walkers[d].heading = (double)(nextRandom(&seed) % 360) * (M_PI / 180.0);
+        walkers[d].speed = 1.0 + (double)(nextRandom(&seed) % 100) / 50.0;
+    }
+
+    double addTime = 0.0;
+    double fillTime = 0.0;
+    size_t points = 0;
+
+    for (size_t step = 0; step < steps; step++) {
+        // move everyone, turning a little at random
+        for (size_t d = 0; d < devices; d++) {
+            walker_t* w = &walkers[d];
+            w->heading += ((double)(nextRandom(&seed) % 21) - 10.0) * (M_PI / 180.0);
+            w->east += w->speed * 0.1 * sin(w->heading);
+            w->north += w->speed * 0.1 * cos(w->heading);
+        }
+
+        double start = nowSeconds();
+        for (size_t d = 0; d < devices; d++) {
+            libsm_ph_fix_t const fix = {
+                .lat = ORIGIN_LAT + lround(walkers[d].north / metersPerUnit),
+                .Long = ORIGIN_LONG + lround(walkers[d].east / (metersPerUnit * cosLat)),
+                .elev = Elevation_unavailable,
+                .timeMs = step * 100,
+            };
+            libsm_ph_gen_add_fix(&gens[d], &fix);
+        }
+        addTime += nowSeconds() - start;
+
+        start = nowSeconds();
+        for (size_t d = 0; d < devices; d++) {
+            if (libsm_ph_gen_fill_path_history(&gens[d], histories[d]) == LIBSM_OK) {
+                points += histories[d]->crumbData.list.count;
+            }
+        }
+        fillTime += nowSeconds() - start;
+    }
+
+    double const fixes = (double)devices * (double)steps;
+    printf("devices: %zu, steps: %zu\n", devices, steps);
+    printf("add fix: %.1f ns/fix, %.2f Mfix/s\n", addTime / fixes * 1e9, fixes / addTime / 1e6);
+    printf("fill:    %.1f ns/fill, %.2f Mfill/s, %.2f points/fill\n",
+           fillTime / fixes * 1e9,
+           fixes / fillTime / 1e6,
+           (double)points / fixes);
+
+    for (size_t d = 0; d < devices; d++) {
+        ASN_STRUCT_FREE(asn_DEF_PathHistory, histories[d]);
+    }
+    free(histories);
+    free(walkers);
+    free(gens);
+    return 0;
+}
@@ -0,0 +1,158 @@
+/*
+ * benchPipeline.c
+ * Measure ingest pipeline throughput on a BSM/PSM mix, from one worker up to every cpu
+ */
+
+#include "libsm.h"
+#include <getopt.h>
+#include <inttypes.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#define SLOT 4096
+
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+
+// What a consumer does at the least: look at the position
+static void consume(void* user, unsigned worker, MessageFrame_t* mf)
+{
+    atomic_long* checksum = user;
+    (void)worker;
+    long const lat = libsm_mf_has_bsm(mf) ? mf->value.choice.BasicSafetyMessage.coreData.lat
+                                          : mf->value.choice.PersonalSafetyMessage.position.lat;
+    atomic_fetch_add_explicit(checksum, lat, memory_order_relaxed);
+}
+
+
+// 1, 2, 4 ... and the most workers last
+static long nextWorkers(long workers, long maxWorkers)
+{
+    return workers < maxWorkers && workers * 2 > maxWorkers ? maxWorkers : workers * 2;
+}
+
+
+int main(int argc, char** argv)
+{
+    long maxWorkers = sysconf(_SC_NPROCESSORS_ONLN);
+    uint64_t messages = 1000000;
+    uint64_t corpusSize = 4096;
+    libsm_pipeline_config_t config;
+    libsm_pipeline_default_config(&config);
+    libsm_corpus_config_t corpusConfig;
+    libsm_corpus_default_config(&corpusConfig);
+    corpusConfig.spatWeight = 0;
+    corpusConfig.timWeight = 0;
+    int opt;
+    int option_index = 0;
+
+    static struct option long_options[] = { { "help", no_argument, NULL, 'h' },
+                                            { "workers", required_argument, NULL, 'w' },
+                                            { "messages", required_argument, NULL, 'n' },
+                                            { "corpus", required_argument, NULL, 'c' },
+                                            { "batch", required_argument, NULL, 'b' },
+                                            { NULL, 0, NULL, 0 } };
+
+    while ((opt = getopt_long(argc, argv, "hw:n:c:b:", long_options, &option_index)) != -1) {
+        switch (opt) {
+            case 'h':
+                printf("Push a corpus of BSMs and PSMs through the ingest pipeline with 1, 2, 4\n");
+                printf("... up to the given number of workers, and print frames per second.\n");
+                printf("USAGE:  %s [options]\n", argv[0]);
+                printf("Options:\n");
+                printf("  -w, --workers\t\tMost workers (default: online cpus)\n");
+                printf("  -n, --messages\tMessages per run (default: 1000000)\n");
+                printf("  -c, --corpus\t\tMessages in the corpus (default: 4096)\n");
+                printf("  -b, --batch\t\tFrames per batch (default: 64)\n");
+                exit(0);
+            case 'w':
+                maxWorkers = atol(optarg);
+                break;
+            case 'n':
+                messages = strtoull(optarg, NULL, 0);
+                break;
+            case 'c':
+                corpusSize = strtoull(optarg, NULL, 0);
+                break;
+            case 'b':
+                config.batchSize = (unsigned)atoi(optarg);
+                break;
+            default:
+                exit(2);
+        }
+    }
+    if (maxWorkers < 1 || corpusSize < 1) {
+        fprintf(stderr, "bad arguments\n");
+        return 2;
+    }
+
+    uint8_t* corpus = malloc(corpusSize * SLOT);
+    size_t* lens = malloc(corpusSize * sizeof(size_t));
+    if (corpus == NULL || lens == NULL) {
+        fprintf(stderr, "allocation failed\n");
+        return 1;
+    }
+    for (uint64_t i = 0; i < corpusSize; i++) {
+        lens[i] = SLOT;
+        if (libsm_corpus_message(&corpusConfig, i, corpus + i * SLOT, &lens[i]) != LIBSM_OK) {
+            fprintf(stderr, "building message %" PRIu64 " failed\n", i);
+            return 1;
+        }
+    }
+
+    printf("%8s %12s %10s %10s %10s\n", "workers", "frames/s", "speedup", "stolen", "stalls");
+    double base = 0.0;
+    for (long workers = 1; workers <= maxWorkers; workers = nextWorkers(workers, maxWorkers)) {
+        libsm_pipeline_t pipeline;
+        atomic_long checksum = 0;
+        config.workers = (unsigned)workers;
+        libsm_rval_e rval = libsm_pipeline_init(&pipeline, &config);
+        if (rval == LIBSM_OK) {
+            libsm_pipeline_set_sink(&pipeline, DSRCmsgID_basicSafetyMessage, consume, &checksum);
+            libsm_pipeline_set_sink(&pipeline, DSRCmsgID_personalSafetyMessage, consume, &checksum);
+            rval = libsm_pipeline_start(&pipeline);
+        }
+        if (rval != LIBSM_OK) {
+            fprintf(stderr, "starting the pipeline failed: %s\n", libsm_str_err(rval));
+            return 1;
+        }
+
+        double const start = nowSeconds();
+        for (uint64_t n = 0; n < messages; n++) {
+            uint64_t const i = n % corpusSize;
+            libsm_pipeline_submit(&pipeline, corpus + i * SLOT, lens[i]);
+        }
+        libsm_pipeline_drain(&pipeline);
+        double const elapsed = nowSeconds() - start;
+
+        libsm_pipeline_stats_t stats;
+        libsm_pipeline_stats(&pipeline, &stats);
+        libsm_pipeline_free(&pipeline);
+        if (stats.decoded != messages) {
+            fprintf(stderr, "%" PRIu64 " of %" PRIu64 " frames decoded\n", stats.decoded, messages);
+            return 1;
+        }
+        double const rate = (double)messages / elapsed;
+        base = workers == 1 ? rate : base;
+        printf("%8ld %12.0f %9.2fx %10" PRIu64 " %10" PRIu64 "\n",
+               workers,
+               rate,
+               rate / base,
+               stats.stolen,
+               stats.stalls);
+    }
+
+    free(corpus);
+    free(lens);
+    return 0;
+}
@@ -0,0 +1,181 @@
+/*
+ * benchTimRegion.c
+ * Compile many TIM regions and measure bulk point-in-region throughput
+ */
+
+#include "libsm.h"
+#include <getopt.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define REF_LAT  334150000
+#define REF_LONG -1119260000
+#define EXTENT_M 10000.0
+
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+
+// xorshift, so every run uses the same regions and positions
+static uint32_t nextRandom(uint32_t* state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+
+static double randomMeters(uint32_t* seed)
+{
+    return (nextRandom(seed) % 100000) / 100000.0 * EXTENT_M;
+}
+
+
+/*
+ * A TIM with one frame and one path of 8 LL nodes wandering 400 m from a random
+ * anchor, 7.2 m wide, a road closure on a few blocks.
+ */
+static TravelerInformation_t* buildTim(uint32_t* seed, double metersPerLat, double metersPerLong)
+{
+    TravelerInformation_t* tim = calloc(1, sizeof(TravelerInformation_t));
+    TravelerDataFrame_t* frame = libsm_alloc_init_partial_TravelerDataFrame();
+    GeographicalPath_t* path = libsm_alloc_init_GeographicalPath();
+    path->anchor = libsm_alloc_init_Position3D();
+    path->anchor->lat = REF_LAT + lround(randomMeters(seed) / metersPerLat);
+    path->anchor->Long = REF_LONG + lround(randomMeters(seed) / metersPerLong);
+    path->laneWidth = libsm_alloc_init_LaneWidth();
+    *path->laneWidth = 720;
+    libsm_init_partial_GeographicalPath_description_choice_path(path);
+    NodeListLL_t* list = libsm_alloc_init_partial_NodeListLL();
+    list->choice.nodes = libsm_alloc_init_partial_NodeSetLL();
+    for (int n = 0; n < 8; n++) {
+        int const dLat = (int)(nextRandom(seed) % 9000) - 4500;
+        int const dLong = (int)(nextRandom(seed) % 9000) - 4500;
+        ASN_SEQUENCE_ADD(&list->choice.nodes->list,
+                         libsm_alloc_init_NodeLL(NodeOffsetPointLL_PR_node_LL6, dLat, dLong));
+    }
+    path->description->choice.path->offset.present = OffsetSystem__offset_PR_ll;
+    path->description->choice.path->offset.choice.ll = list;
+    ASN_SEQUENCE_ADD(&frame->regions.list, path);
+    ASN_SEQUENCE_ADD(&tim->dataFrames.list, frame);
+    return tim;
+}
+
+
+static void countHit(void* user, size_t position, libsm_tim_region_t const* region)
+{
+    (void)position;
+    (void)region;
+    (*(size_t*)user)++;
+}
+
+
+int main(int argc, char** argv)
+{
+    int timCount = 500;
+    size_t count = 10000;
+    int rounds = 20;
+    int opt;
+    int option_index = 0;
+    uint32_t seed = 34;
+
+    static struct option long_options[] = { { "help", no_argument, NULL, 'h' },
+                                            { "tims", required_argument, NULL, 't' },
+                                            { "count", required_argument, NULL, 'n' },
+                                            { "rounds", required_argument, NULL, 'r' },
+                                            { NULL, 0, NULL, 0 } };
+
+    while ((opt = getopt_long(argc, argv, "ht:n:r:", long_options, &option_index)) != -1) {
+        switch (opt) {
+            case 'h':
+                printf("Compile TIMs with random paths over a 10 km square and match random\n");
+                printf("positions against all of them.\n");
+                printf("USAGE:  %s [options]\n", argv[0]);
+                printf("Options:\n");
+                printf("  -t, --tims\tActive TIMs (default: 500)\n");
+                printf("  -n, --count\tPositions matched per round (default: 10000)\n");
+                printf("  -r, --rounds\tRounds (default: 20)\n");
+                exit(0);
+            case 't':
+                timCount = atoi(optarg);
+                break;
+            case 'n':
+                count = strtoul(optarg, NULL, 10);
+                break;
+            case 'r':
+                rounds = atoi(optarg);
+                break;
+            default:
+                exit(2);
+        }
+    }
+    if (timCount < 1 || count == 0) {
+        fprintf(stderr, "bad arguments\n");
+        return 2;
+    }
+
+    double const metersPerLat = Latitude_m_per_unit;
+    double const metersPerLong =
+            metersPerLat * cos((double)REF_LAT / Latitude_unit_deg * (M_PI / 180.0));
+    libsm_tim_regions_t set;
+    libsm_tim_regions_init(&set, 3.6);
+    double compileTime = 0;
+    for (int t = 0; t < timCount; t++) {
+        TravelerInformation_t* tim = buildTim(&seed, metersPerLat, metersPerLong);
+        double const start = nowSeconds();
+        if (libsm_tim_regions_add(&set, tim, (uint32_t)t) != LIBSM_OK) {
+            fprintf(stderr, "compile failed\n");
+            return 1;
+        }
+        compileTime += nowSeconds() - start;
+        ASN_STRUCT_FREE(asn_DEF_TravelerInformation, tim);
+    }
+
+    Latitude_t* lats = malloc(count * sizeof(Latitude_t));
+    Longitude_t* longs = malloc(count * sizeof(Longitude_t));
+    Heading_t* headings = malloc(count * sizeof(Heading_t));
+    if (lats == NULL || longs == NULL || headings == NULL) {
+        fprintf(stderr, "allocation failed\n");
+        return 1;
+    }
+    for (size_t i = 0; i < count; i++) {
+        lats[i] = REF_LAT + lround(randomMeters(&seed) / metersPerLat);
+        longs[i] = REF_LONG + lround(randomMeters(&seed) / metersPerLong);
+        headings[i] = (Heading_t)(nextRandom(&seed) % 28800);
+    }
+
+    double best = INFINITY;
+    size_t hits = 0;
+    for (int r = 0; r < rounds; r++) {
+        hits = 0;
+        double const start = nowSeconds();
+        libsm_tim_regions_match(&set, lats, longs, headings, count, countHit, &hits);
+        double const elapsed = nowSeconds() - start;
+        best = elapsed < best ? elapsed : best;
+    }
+
+    printf("tims: %d, regions: %zu, points: %zu\n", timCount, set.regionCount, set.pointCount);
+    printf("compile: %.1f us/TIM\n", compileTime / timCount * 1e6);
+    printf("match:   %.2f ms per %zu positions, %.1f ns/(position, region), %zu hits\n",
+           best * 1e3,
+           count,
+           best / ((double)count * (double)set.regionCount) * 1e9,
+           hits);
+
+    libsm_tim_regions_free(&set);
+    free(lats);
+    free(longs);
+    free(headings);
+    return 0;
+}
@@ -0,0 +1,201 @@
+/*
+ * benchUperFast.c
+ * Compare the generic and the specialised UPER codec on BSM or PSM MessageFrames
+ */
+
+#include "libsm.h"
+#include <getopt.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+typedef libsm_rval_e (*encodeFn)(MessageFrame_t*, uint8_t*, size_t*);
+typedef libsm_rval_e (*decodeFn)(uint8_t const*, size_t, MessageFrame_t*);
+
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+
+// xorshift, so every run uses the same messages
+static uint32_t nextRandom(uint32_t* state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+
+// A moving vehicle, with path history and prediction when partII is set
+static MessageFrame_t* buildBsm(uint32_t* seed, bool partII)
+{
+    MessageFrame_t* mf = libsm_alloc_init_mf_bsm();
+    BSMcoreData_t* core = &mf->value.choice.BasicSafetyMessage.coreData;
+    core->msgCnt = nextRandom(seed) % 128;
+    core->secMark = nextRandom(seed) % 60000;
+    core->lat = 334150000 + (long)(nextRandom(seed) % 100000);
+    core->Long = -1119260000 + (long)(nextRandom(seed) % 100000);
+    core->elev = nextRandom(seed) % 4000;
+    core->speed = nextRandom(seed) % 2000;
+    core->heading = nextRandom(seed) % 28800;
+    core->size.width = 200;
+    core->size.length = 480;
+    if (partII) {
+        libsm_init_bsm_path_history(&mf->value.choice.BasicSafetyMessage);
+        libsm_set_path_prediction(&mf->value.choice.BasicSafetyMessage, 100, 32767);
+    }
+    return mf;
+}
+
+
+// A pedestrian walking
+static MessageFrame_t* buildPsm(uint32_t* seed)
+{
+    MessageFrame_t* mf = libsm_alloc_init_mf_psm();
+    PersonalSafetyMessage_t* psm = &mf->value.choice.PersonalSafetyMessage;
+    psm->basicType = PersonalDeviceUserType_aPEDESTRIAN;
+    psm->msgCnt = nextRandom(seed) % 128;
+    psm->secMark = nextRandom(seed) % 60000;
+    psm->position.lat = 334150000 + (long)(nextRandom(seed) % 100000);
+    psm->position.Long = -1119260000 + (long)(nextRandom(seed) % 100000);
+    psm->speed = nextRandom(seed) % 200;
+    psm->heading = nextRandom(seed) % 28800;
+    return mf;
+}
+
+
+static double timeEncode(encodeFn encode, MessageFrame_t** mfs, int count, int rounds)
+{
+    uint8_t buffer[512];
+    double best = INFINITY;
+    for (int r = 0; r < rounds; r++) {
+        double const start = nowSeconds();
+        for (int i = 0; i < count; i++) {
+            size_t len = sizeof(buffer);
+            if (encode(mfs[i], buffer, &len) != LIBSM_OK) {
+                fprintf(stderr, "encoding failed\n");
+                exit(1);
+            }
+        }
+        double const elapsed = nowSeconds() - start;
+        best = elapsed < best ? elapsed : best;
+    }
+    return best / count * 1e9;
+}
+
+
+static double timeDecode(decodeFn decode, uint8_t* encoded, size_t* lens, int count, int rounds)
+{
+    double best = INFINITY;
+    for (int r = 0; r < rounds; r++) {
+        double const start = nowSeconds();
+        for (int i = 0; i < count; i++) {
+            MessageFrame_t mf = { 0 };
+            if (decode(encoded + i * 512, lens[i], &mf) != LIBSM_OK) {
+                fprintf(stderr, "decoding failed\n");
+                exit(1);
+            }
+            ASN_STRUCT_RESET(asn_DEF_MessageFrame, &mf);
+        }
+        double const elapsed = nowSeconds() - start;
+        best = elapsed < best ? elapsed : best;
+    }
+    return best / count * 1e9;
+}
+
+
+int main(int argc, char** argv)
+{
+    int count = 10000;
+    int rounds = 10;
+    bool partII = false;
+    bool psm = false;
+    int opt;
+    int option_index = 0;
+    uint32_t seed = 35;
+
+    static struct option long_options[] = { { "help", no_argument, NULL, 'h' },
+                                            { "count", required_argument, NULL, 'n' },
+                                            { "rounds", required_argument, NULL, 'r' },
+                                            { "part-ii", no_argument, NULL, 'p' },
+                                            { "psm", no_argument, NULL, 's' },
+                                            { NULL, 0, NULL, 0 } };
+
+    while ((opt = getopt_long(argc, argv, "hn:r:ps", long_options, &option_index)) != -1) {
+        switch (opt) {
+            case 'h':
+                printf("Encode and decode random BSMs or PSMs with the generic and the\n");
+                printf("specialised UPER codec.\n");
+                printf("USAGE:  %s [options]\n", argv[0]);
+                printf("Options:\n");
+                printf("  -n, --count\tMessages per round (default: 10000)\n");
+                printf("  -r, --rounds\tRounds (default: 10)\n");
+                printf("  -p, --part-ii\tAdd path history and path prediction to BSMs\n");
+                printf("  -s, --psm\tPSMs instead of BSMs\n");
+                exit(0);
+            case 'n':
+                count = atoi(optarg);
+                break;
+            case 'r':
+                rounds = atoi(optarg);
+                break;
+            case 'p':
+                partII = true;
+                break;
+            case 's':
+                psm = true;
+                break;
+            default:
+                exit(2);
+        }
+    }
+    if (count < 1 || rounds < 1) {
+        fprintf(stderr, "bad arguments\n");
+        return 2;
+    }
+
+    MessageFrame_t** mfs = malloc(count * sizeof(MessageFrame_t*));
+    uint8_t* encoded = malloc((size_t)count * 512);
+    size_t* lens = malloc(count * sizeof(size_t));
+    if (mfs == NULL || encoded == NULL || lens == NULL) {
+        fprintf(stderr, "allocation failed\n");
+        return 1;
+    }
+    for (int i = 0; i < count; i++) {
+        mfs[i] = psm ? buildPsm(&seed) : buildBsm(&seed, partII);
+        lens[i] = 512;
+        if (libsm_encode_messageframe(mfs[i], encoded + i * 512, &lens[i]) != LIBSM_OK) {
+            fprintf(stderr, "encoding failed\n");
+            return 1;
+        }
+    }
+
+    double const genericEncode = timeEncode(libsm_encode_messageframe, mfs, count, rounds);
+    double const fastEncode = timeEncode(libsm_uper_fast_encode_messageframe, mfs, count, rounds);
+    double const genericDecode =
+            timeDecode(libsm_decode_messageframe, encoded, lens, count, rounds);
+    double const fastDecode =
+            timeDecode(libsm_uper_fast_decode_messageframe, encoded, lens, count, rounds);
+
+    printf("messages: %d, %zu bytes each\n", count, lens[0]);
+    printf("encode: generic %.0f ns/msg, specialised %.0f ns/msg\n", genericEncode, fastEncode);
+    printf("decode: generic %.0f ns/msg, specialised %.0f ns/msg\n", genericDecode, fastDecode);
+
+    for (int i = 0; i < count; i++) {
+        ASN_STRUCT_FREE(asn_DEF_MessageFrame, mfs[i]);
+    }
+    free(mfs);
+    free(encoded);
+    free(lens);
+    return 0;
+}
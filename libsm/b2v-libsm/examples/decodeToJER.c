@@ -42,8 +42,9 @@ int main(int argc, char** argv)
                 buf = calloc(len, sizeof(uint8_t));
 
                 /* Convert input hex string to byte array */
-                for (size_t i = 0; i < len; ++i) {
-                    sscanf(&optarg[i * 2], "%2hhx", &buf[i]);
+                if (libsm_hex_decode(optarg, strlen(optarg), buf, &len) != LIBSM_OK) {
+                    fprintf(stderr, "The input is not a hex string.\n");
+                    len = 0;
                 }
 
                 break;
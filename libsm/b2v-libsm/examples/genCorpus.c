@@ -0,0 +1,170 @@
+/*
+ * genCorpus.c
+ * Write a seeded synthetic corpus of UPER MessageFrames, for load and regression testing
+ */
+
+#include "libsm.h"
+#include <getopt.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SLOT 4096
+
+
+static bool parseRange(char const* arg, unsigned* min, unsigned* max)
+{
+    char end;
+    if (sscanf(arg, "%u-%u%c", min, max, &end) == 2) {
+        return true;
+    }
+    if (sscanf(arg, "%u%c", min, &end) == 1) {
+        *max = *min;
+        return true;
+    }
+    return false;
+}
+
+
+// One line per message, a table DuckDB or pyarrow can turn into Parquet as is
+static bool writeCsv(FILE* out, uint64_t index, uint8_t const* encoded, size_t len)
+{
+    MessageFrame_t mf = { 0 };
+    long messageId = -1;
+    if (libsm_decode_messageframe(encoded, len, &mf) == LIBSM_OK) {
+        messageId = mf.messageId;
+    }
+    ASN_STRUCT_RESET(asn_DEF_MessageFrame, &mf);
+
+    char hex[2 * SLOT + 1];
+    libsm_hex_encode(encoded, len, hex, sizeof(hex), true);
+    return fprintf(out, "%" PRIu64 ",%ld,%zu,%s\n", index, messageId, len, hex) > 0;
+}
+
+
+int main(int argc, char** argv)
+{
+    libsm_corpus_config_t config;
+    libsm_corpus_default_config(&config);
+    uint64_t count = 1000000;
+    uint64_t first = 0;
+    char const* output = NULL;
+    bool csv = false;
+    int opt;
+    int option_index = 0;
+
+    static struct option long_options[] = { { "help", no_argument, NULL, 'h' },
+                                            { "count", required_argument, NULL, 'n' },
+                                            { "first", required_argument, NULL, 'b' },
+                                            { "seed", required_argument, NULL, 's' },
+                                            { "mix", required_argument, NULL, 'm' },
+                                            { "part-ii", required_argument, NULL, 'p' },
+                                            { "path-history", required_argument, NULL, 'H' },
+                                            { "intersections", required_argument, NULL, 'i' },
+                                            { "output", required_argument, NULL, 'o' },
+                                            { "csv", no_argument, NULL, 'c' },
+                                            { NULL, 0, NULL, 0 } };
+
+    while ((opt = getopt_long(argc, argv, "hn:b:s:m:p:H:i:o:c", long_options, &option_index))
+           != -1) {
+        switch (opt) {
+            case 'h':
+                printf("Write a seeded synthetic corpus of valid UPER MessageFrames. The same\n");
+                printf("options give the same corpus, and message i does not depend on --count\n");
+                printf("or --first, so corpora can be written in shards.\n");
+                printf("Records are the message length as 4 bytes big endian, then the message.\n");
+                printf("USAGE:  %s [options]\n", argv[0]);
+                printf("Options:\n");
+                printf("  -n, --count\t\tMessages (default: 1000000)\n");
+                printf("  -b, --first\t\tIndex of the first message (default: 0)\n");
+                printf("  -s, --seed\t\tSeed (default: 1)\n");
+                printf("  -m, --mix\t\tWeights of BSM:PSM:SPAT:TIM (default: 70:15:10:5)\n");
+                printf("  -p, --part-ii\t\tPercentage of BSMs with path history and prediction "
+                       "(default: 50)\n");
+                printf("  -H, --path-history\tPathHistoryPoints per Part II, N or MIN-MAX "
+                       "(default: 1-23)\n");
+                printf("  -i, --intersections\tIntersections per SPAT, N or MIN-MAX "
+                       "(default: 1-4)\n");
+                printf("  -o, --output\t\tOutput file (default: stdout)\n");
+                printf("  -c, --csv\t\tWrite index,messageId,length,hex lines instead\n");
+                exit(0);
+            case 'n':
+                count = strtoull(optarg, NULL, 0);
+                break;
+            case 'b':
+                first = strtoull(optarg, NULL, 0);
+                break;
+            case 's':
+                config.seed = strtoull(optarg, NULL, 0);
+                break;
+            case 'm':
+                if (sscanf(optarg,
+                           "%u:%u:%u:%u",
+                           &config.bsmWeight,
+                           &config.psmWeight,
+                           &config.spatWeight,
+                           &config.timWeight)
+                    != 4) {
+                    fprintf(stderr, "bad mix %s\n", optarg);
+                    exit(2);
+                }
+                break;
+            case 'p':
+                config.partIIPercent = (unsigned)atoi(optarg);
+                break;
+            case 'H':
+                if (!parseRange(optarg, &config.pathHistoryMin, &config.pathHistoryMax)) {
+                    fprintf(stderr, "bad path history length %s\n", optarg);
+                    exit(2);
+                }
+                break;
+            case 'i':
+                if (!parseRange(optarg, &config.intersectionsMin, &config.intersectionsMax)) {
+                    fprintf(stderr, "bad intersection count %s\n", optarg);
+                    exit(2);
+                }
+                break;
+            case 'o':
+                output = optarg;
+                break;
+            case 'c':
+                csv = true;
+                break;
+            default:
+                exit(2);
+        }
+    }
+
+    FILE* out = output != NULL ? fopen(output, csv ? "w" : "wb") : stdout;
+    if (out == NULL) {
+        perror(output);
+        return 1;
+    }
+    if (csv) {
+        fprintf(out, "index,messageId,length,uper\n");
+    }
+
+    uint8_t encoded[SLOT];
+    for (uint64_t i = first; i < first + count; i++) {
+        size_t len = sizeof(encoded);
+        libsm_rval_e rval = libsm_corpus_message(&config, i, encoded, &len);
+        if (rval != LIBSM_OK) {
+            fprintf(stderr, "message %" PRIu64 ": %s\n", i, libsm_str_err(rval));
+            return rval == LIBSM_FAIL_NO_VALID_PARAMETER ? 2 : 1;
+        }
+        bool const written = csv ? writeCsv(out, i, encoded, len)
+                                 : libsm_corpus_write_record(out, encoded, len) == LIBSM_OK;
+        if (!written) {
+            perror(output != NULL ? output : "stdout");
+            return 1;
+        }
+    }
+
+    if (fclose(out) != 0) {
+        perror(output != NULL ? output : "stdout");
+        return 1;
+    }
+    return 0;
+}
@@ -28,8 +28,6 @@ static void usage(char* name)
 
 static int parseArgs(int argc, char* argv[], uint8_t* msgf, size_t* len, int* debug)
 {
-    char buf[8];
-
     int opt;
     int option_index = 0;
 
@@ -73,14 +71,10 @@ static int parseArgs(int argc, char* argv[], uint8_t* msgf, size_t* len, int* de
         exit(3);
     }
 
-    *len = 0;
-    msgLen = strlen(argv[optind]);
-    const char* msg = argv[optind];
-
-    for (int i = 0; i < msgLen; i += 2) {
-        sprintf(buf, "%c%c", msg[i], msg[i + 1]);
-        uint8_t byte = strtol(buf, NULL, 16);
-        msgf[(*len)++] = byte;
+    libsm_rval_e const rval = libsm_hex_decode(argv[optind], (size_t)msgLen, msgf, len);
+    if (rval != LIBSM_OK) {
+        fprintf(stderr, "your messageframe is not a string of hex bytes\n");
+        return rval;
     }
 
     if (*debug > 1) {
@@ -6,8 +6,12 @@
 #include <asn_application.h>
 #include <asn_internal.h>
 #include <BIT_STRING.h>
+#include <asn_hex.h>
 #include "INTEGER.h"
 
+/* Bytes converted to hexadecimal at a time */
+#define ASN_HEX_CHUNK 64
+
 asn_enc_rval_t
 BIT_STRING_encode_jer(const asn_TYPE_descriptor_t *td,
                       const asn_jer_constraints_t *constraints,
@@ -15,9 +19,9 @@ BIT_STRING_encode_jer(const asn_TYPE_descriptor_t *td,
                       enum jer_encoder_flags_e flags,
                       asn_app_consume_bytes_f *cb, void *app_key) {
     asn_enc_rval_t er = {0, 0, 0};
-    const char * const h2c = "0123456789ABCDEF";
-    char scratch[16 * 3 + 4];
+    char scratch[2 * ASN_HEX_CHUNK + 1];
     char *p = scratch;
+    size_t chunk;
     const BIT_STRING_t *st = (const BIT_STRING_t *)sptr;
     const asn_jer_constraints_t* cts = constraints ?
         constraints : td->encoding_constraints.jer_constraints;
@@ -42,13 +46,11 @@ BIT_STRING_encode_jer(const asn_TYPE_descriptor_t *td,
      */
     if(cts->size != -1) { /* Fixed size */
         *p++ = '"';
-        for(int i = 0; buf < end; buf++, i++) {
-            if(!(i % 16) && (i || st->size > 16)) {
-                ASN__CALLBACK(scratch, p-scratch);
-                p = scratch;
-            }
-            *p++ = h2c[*buf >> 4];
-            *p++ = h2c[*buf & 0x0F];
+        for(; buf < end; buf += chunk) {
+            chunk = end - buf < ASN_HEX_CHUNK ? end - buf : ASN_HEX_CHUNK;
+            asn_hex_encode(buf, chunk, p, 0);
+            ASN__CALLBACK(scratch, p - scratch + 2 * chunk);
+            p = scratch;
         }
 
         ASN__CALLBACK(scratch, p - scratch);
@@ -57,8 +59,8 @@ BIT_STRING_encode_jer(const asn_TYPE_descriptor_t *td,
         if(buf == end) {
             int ubits = st->bits_unused;
             uint8_t v = *buf & (0xff << ubits);
-            *p++ = h2c[v >> 4];
-            *p++ = h2c[v & 0x0F];
+            asn_hex_encode(&v, 1, p, 0);
+            p += 2;
             ASN__CALLBACK(scratch, p - scratch);
             p = scratch;
         }
@@ -73,13 +75,11 @@ BIT_STRING_encode_jer(const asn_TYPE_descriptor_t *td,
             ASN__CALLBACK("\"value\":", 8);
         }
         *p++ = '"';
-        for(int i = 0; buf < end; buf++, i++) {
-            if(!(i % 16) && (i || st->size > 16)) {
-                ASN__CALLBACK(scratch, p-scratch);
-                p = scratch;
-            }
-            *p++ = h2c[*buf >> 4];
-            *p++ = h2c[*buf & 0x0F];
+        for(; buf < end; buf += chunk) {
+            chunk = end - buf < ASN_HEX_CHUNK ? end - buf : ASN_HEX_CHUNK;
+            asn_hex_encode(buf, chunk, p, 0);
+            ASN__CALLBACK(scratch, p - scratch + 2 * chunk);
+            p = scratch;
         }
 
         ASN__CALLBACK(scratch, p - scratch);
@@ -88,8 +88,8 @@ BIT_STRING_encode_jer(const asn_TYPE_descriptor_t *td,
         if(buf == end) {
             int ubits = st->bits_unused;
             uint8_t v = *buf & (0xff << ubits);
-            *p++ = h2c[v >> 4];
-            *p++ = h2c[v & 0x0F];
+            asn_hex_encode(&v, 1, p, 0);
+            p += 2;
             ASN__CALLBACK(scratch, p - scratch);
             p = scratch;
         }
@@ -192,40 +192,14 @@ BIT_STRING_decode_jer(const asn_codec_ctx_t *opt_codec_ctx,
     if(!nptr) RETURN(RC_FAIL);
     st->buf = (uint8_t *)nptr;
     uint8_t *buf = st->buf;
-    unsigned int clv = 0;
-    int half = 0;
-
-    for(; p < p1; p++) {
-        int ch = *(const unsigned char *)p;
-        switch(ch) {
-        case 0x30: case 0x31: case 0x32: case 0x33: case 0x34:  /*01234*/
-        case 0x35: case 0x36: case 0x37: case 0x38: case 0x39:  /*56789*/
-            clv = (clv << 4) + (ch - 0x30);
-            break;
-        case 0x41: case 0x42: case 0x43:  /* ABC */
-        case 0x44: case 0x45: case 0x46:  /* DEF */
-            clv = (clv << 4) + (ch - 0x41 + 10);
-            break;
-        case 0x61: case 0x62: case 0x63:  /* abc */
-        case 0x64: case 0x65: case 0x66:  /* def */
-            clv = (clv << 4) + (ch - 0x61 + 10);
-            break;
-        default:
-            *buf = 0;  /* JIC */
-            RETURN(RC_FAIL);
-        }
-        if(half++) {
-            half = 0;
-            *buf++ = clv;
-        }
-    }
 
-    /*
-     * Check partial decoding.
-     */
-    if(half) {
+    /* An odd number of digits is a partial byte, which fails too */
+    if(asn_hex_decode(p, p1 - p, buf) < 0) {
+        *buf = 0;  /* JIC */
         RETURN(RC_FAIL);
     }
+    buf += (p1 - p) / 2;
+    p = p1;
 
     st->size = buf - st->buf;  /* Adjust the buffer size */
     st->buf[st->size] = 0;  /* Courtesy termination */
@@ -11,6 +11,7 @@ NativeInteger_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
                           const asn_TYPE_descriptor_t *td,
                           const asn_per_constraints_t *constraints, void **sptr,
                           asn_per_data_t *pd) {
+    ASN_STATS_TYPE(td);
     const asn_INTEGER_specifics_t *specs =
         (const asn_INTEGER_specifics_t *)td->specifics;
     asn_dec_rval_t rval;
@@ -49,9 +50,12 @@ NativeInteger_encode_uper(const asn_TYPE_descriptor_t *td,
                           const void *sptr, asn_per_outp_t *po) {
     const asn_INTEGER_specifics_t *specs =
         (const asn_INTEGER_specifics_t *)td->specifics;
-    asn_enc_rval_t er = {0,0,0};
     long native;
+    intmax_t value;
+    uint8_t buf[sizeof(intmax_t)];
+    uint8_t *start = buf;
     INTEGER_t tmpint;
+    size_t i;
 
     if(!sptr) ASN__ENCODE_FAILED;
 
@@ -59,12 +63,21 @@ NativeInteger_encode_uper(const asn_TYPE_descriptor_t *td,
 
     ASN_DEBUG("Encoding NativeInteger %s %ld (UPER)", td->name, native);
 
+    /*
+     * The same minimal two's complement octets as asn_long2INTEGER, or
+     * asn_ulong2INTEGER for unsigned types, on the stack, so encoding an
+     * integer does not allocate.
+     */
+    value = (specs && specs->field_unsigned) ? (intmax_t)(unsigned long)native : native;
+    for(i = 0; i < sizeof(buf); i++)
+        buf[i] = (uint8_t)((uintmax_t)value >> (8 * (sizeof(buf) - 1 - i)));
+    while(start < buf + sizeof(buf) - 1
+          && ((start[0] == 0x00 && !(start[1] & 0x80))
+              || (start[0] == 0xff && (start[1] & 0x80))))
+        start++;
+
     memset(&tmpint, 0, sizeof(tmpint));
-    if((specs&&specs->field_unsigned)
-        ? asn_ulong2INTEGER(&tmpint, native)
-        : asn_long2INTEGER(&tmpint, native))
-        ASN__ENCODE_FAILED;
-    er = INTEGER_encode_uper(td, constraints, &tmpint, po);
-    ASN_STRUCT_FREE_CONTENTS_ONLY(asn_DEF_INTEGER, &tmpint);
-    return er;
+    tmpint.buf = start;
+    tmpint.size = (buf + sizeof(buf)) - start;
+    return INTEGER_encode_uper(td, constraints, &tmpint, po);
 }
@@ -106,26 +106,29 @@ void
 OCTET_STRING_free(const asn_TYPE_descriptor_t *td, void *sptr,
                   enum asn_struct_free_method method) {
 	OCTET_STRING_t *st = (OCTET_STRING_t *)sptr;
+    const asn_OCTET_STRING_specifics_t *specs;
+    asn_struct_ctx_t *ctx;
 
 	if(!td || !st)
 		return;
 
 	ASN_DEBUG("Freeing %s as OCTET STRING", td->name);
 
-	if(st->buf) {
-		FREEMEM(st->buf);
-		st->buf = 0;
-	}
-
-#if !defined(ASN_DISABLE_BER_SUPPORT)
-    const asn_OCTET_STRING_specifics_t *specs;
-    asn_struct_ctx_t *ctx;
-
     specs = td->specifics
             ? (const asn_OCTET_STRING_specifics_t *)td->specifics
             : &asn_SPC_OCTET_STRING_specs;
     ctx = (asn_struct_ctx_t *)((char *)st + specs->ctx_offset);
 
+	if(st->buf) {
+		/* Borrowed octets belong to the decoded buffer */
+		if(ctx->phase != ASN_OCTET_STRING_BORROWED)
+			FREEMEM(st->buf);
+		st->buf = 0;
+	}
+	if(ctx->phase == ASN_OCTET_STRING_BORROWED)
+		ctx->phase = 0;
+
+#if !defined(ASN_DISABLE_BER_SUPPORT)
     /*
      * Remove decode-time stack.
      */
@@ -173,7 +176,9 @@ OCTET_STRING_fromBuf(OCTET_STRING_t *st, const char *str, int len) {
 	 * Clear the OCTET STRING.
 	 */
 	if(str == NULL) {
-		FREEMEM(st->buf);
+		if(!OCTET_STRING_is_borrowed(st))
+			FREEMEM(st->buf);
+		st->_asn_ctx.phase = 0;
 		st->buf = 0;
 		st->size = 0;
 		return 0;
@@ -190,7 +195,9 @@ OCTET_STRING_fromBuf(OCTET_STRING_t *st, const char *str, int len) {
 
 	memcpy(buf, str, len);
 	((uint8_t *)buf)[len] = '\0';	/* Couldn't use memcpy(len+1)! */
-	FREEMEM(st->buf);
+	if(!OCTET_STRING_is_borrowed(st))
+		FREEMEM(st->buf);
+	st->_asn_ctx.phase = 0;
 	st->buf = (uint8_t *)buf;
 	st->size = len;
 
@@ -264,7 +271,8 @@ OCTET_STRING_copy(const asn_TYPE_descriptor_t *td, void **aptr,
 
     if(!b) {
         if(a) {
-            FREEMEM(a->buf);
+            if(!OCTET_STRING_is_borrowed(a))
+                FREEMEM(a->buf);
             a->buf = 0;
             a->size = 0;
             FREEMEM(a);
@@ -283,7 +291,9 @@ OCTET_STRING_copy(const asn_TYPE_descriptor_t *td, void **aptr,
     memcpy(buf, b->buf, b->size);
     ((uint8_t *)buf)[b->size] = '\0';
 
-    FREEMEM(a->buf);
+    if(!OCTET_STRING_is_borrowed(a))
+        FREEMEM(a->buf);
+    a->_asn_ctx.phase = 0;
     a->buf = (uint8_t *)buf;
     a->size = b->size;
 
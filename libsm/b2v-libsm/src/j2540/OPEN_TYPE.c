@@ -64,3 +64,93 @@ asn_TYPE_operation_t asn_OP_OPEN_TYPE = {
 #endif  /* !defined(ASN_DISABLE_RFILL_SUPPORT) */
     0  /* Use generic outmost tag fetcher */
 };
+
+static asn_struct_ctx_t *
+OPEN_TYPE__ctx(const asn_TYPE_descriptor_t *td, const void *sptr) {
+    const asn_CHOICE_specifics_t *specs =
+        (const asn_CHOICE_specifics_t *)td->specifics;
+    return (asn_struct_ctx_t *)((const char *)sptr + specs->ctx_offset);
+}
+
+const asn_open_type_opaque_t *
+OPEN_TYPE_get_opaque(const asn_TYPE_descriptor_t *td, const void *sptr) {
+    const asn_struct_ctx_t *ctx;
+
+    if(!td || !sptr) return NULL;
+    ctx = OPEN_TYPE__ctx(td, sptr);
+    if(ctx->phase != ASN_OPEN_TYPE_OPAQUE) return NULL;
+    return (const asn_open_type_opaque_t *)ctx->ptr;
+}
+
+void
+OPEN_TYPE_free(const asn_TYPE_descriptor_t *td, void *ptr,
+               enum asn_struct_free_method method) {
+    asn_struct_ctx_t *ctx;
+
+    if(!td || !ptr) return;
+
+    ctx = OPEN_TYPE__ctx(td, ptr);
+    if(ctx->phase == ASN_OPEN_TYPE_OPAQUE) {
+        FREEMEM(ctx->ptr);
+        ctx->ptr = 0;
+        ctx->phase = 0;
+    }
+    CHOICE_free(td, ptr, method);
+}
+
+int
+OPEN_TYPE_compare(const asn_TYPE_descriptor_t *td, const void *aptr,
+                  const void *bptr) {
+    const asn_open_type_opaque_t *a = OPEN_TYPE_get_opaque(td, aptr);
+    const asn_open_type_opaque_t *b = OPEN_TYPE_get_opaque(td, bptr);
+    int ret;
+
+    if(!a && !b) return CHOICE_compare(td, aptr, bptr);
+
+    /* Opaque ones before decoded ones, they are not comparable */
+    if(!a) return 1;
+    if(!b) return -1;
+    ret = memcmp(a->buf, b->buf, a->size < b->size ? a->size : b->size);
+    if(ret) return ret < 0 ? -1 : 1;
+    if(a->size != b->size) return a->size < b->size ? -1 : 1;
+    return 0;
+}
+
+int
+OPEN_TYPE_copy(const asn_TYPE_descriptor_t *td, void **aptr,
+               const void *bptr) {
+    const asn_open_type_opaque_t *b = OPEN_TYPE_get_opaque(td, bptr);
+    const asn_CHOICE_specifics_t *specs;
+    asn_open_type_opaque_t *a;
+    asn_struct_ctx_t *ctx;
+
+    if(!b) return CHOICE_copy(td, aptr, bptr);
+
+    specs = (const asn_CHOICE_specifics_t *)td->specifics;
+    if(*aptr) {
+        ASN_STRUCT_RESET(*td, *aptr);
+    } else {
+        *aptr = CALLOC(1, specs->struct_size);
+        if(!*aptr) return -1;
+    }
+
+    /* The octets follow the structure */
+    a = (asn_open_type_opaque_t *)MALLOC(sizeof(*a) + b->size);
+    if(!a) return -1;
+    a->buf = (uint8_t *)(a + 1);
+    a->size = b->size;
+    memcpy(a->buf, b->buf, b->size);
+
+    ctx = OPEN_TYPE__ctx(td, *aptr);
+    ctx->ptr = a;
+    ctx->phase = ASN_OPEN_TYPE_OPAQUE;
+    return 0;
+}
+
+int
+OPEN_TYPE_constraint(const asn_TYPE_descriptor_t *td, const void *sptr,
+                     asn_app_constraint_failed_f *ctfailcb, void *app_key) {
+    /* Nothing to check until it is materialized */
+    if(OPEN_TYPE_get_opaque(td, sptr)) return 0;
+    return CHOICE_constraint(td, sptr, ctfailcb, app_key);
+}
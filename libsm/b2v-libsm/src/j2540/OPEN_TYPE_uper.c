@@ -8,6 +8,74 @@
 #include <constr_CHOICE.h>
 #include <uper_opentype.h>
 
+/*
+ * Whether the context keeps the open types of the parent type encoded.
+ */
+static int
+OPEN_TYPE__uper_is_opaque(const asn_codec_ctx_t *opt_codec_ctx,
+                          const asn_TYPE_descriptor_t *td) {
+    const asn_TYPE_descriptor_t *const *type;
+
+    if(!opt_codec_ctx || !opt_codec_ctx->opaque_open_types) return 0;
+    for(type = opt_codec_ctx->opaque_open_types; *type; type++) {
+        if(*type == td) return 1;
+    }
+    return 0;
+}
+
+/*
+ * Keep the open type as it is encoded, length determinant and all, so that
+ * OPEN_TYPE_encode_uper() puts the same bits back.
+ */
+static asn_dec_rval_t
+OPEN_TYPE__uper_get_opaque(const asn_TYPE_member_t *elm, void **memb_ptr2,
+                           asn_per_data_t *pd) {
+    const asn_CHOICE_specifics_t *specs =
+        (const asn_CHOICE_specifics_t *)elm->type->specifics;
+    asn_dec_rval_t rv = {RC_OK, 0};
+    asn_open_type_opaque_t *opaque;
+    asn_struct_ctx_t *ctx;
+    asn_per_data_t start = *pd;
+    size_t bits;
+    int repeat;
+
+    do {
+        ssize_t chunk_bytes = uper_get_length(pd, -1, 0, &repeat);
+        if(chunk_bytes < 0
+           || pd->nbits - pd->nboff < ((size_t)chunk_bytes << 3)) {
+            ASN__DECODE_STARVED;
+        }
+        pd->nboff += (size_t)chunk_bytes << 3;
+        pd->moved += (size_t)chunk_bytes << 3;
+    } while(repeat);
+    bits = pd->moved - start.moved;
+
+    if(*memb_ptr2) {
+        ASN_STRUCT_RESET(*elm->type, *memb_ptr2);
+    } else {
+        *memb_ptr2 = CALLOC(1, specs->struct_size);
+        if(!*memb_ptr2) ASN__DECODE_FAILED;
+    }
+
+    /* The octets follow the structure */
+    opaque = (asn_open_type_opaque_t *)MALLOC(sizeof(*opaque) + (bits >> 3));
+    if(!opaque) ASN__DECODE_FAILED;
+    opaque->buf = (uint8_t *)(opaque + 1);
+    opaque->size = bits >> 3;
+    if(per_get_many_bits(&start, opaque->buf, 0, bits)) {
+        FREEMEM(opaque);
+        ASN__DECODE_FAILED;
+    }
+
+    ctx = (asn_struct_ctx_t *)((char *)*memb_ptr2 + specs->ctx_offset);
+    ctx->ptr = opaque;
+    ctx->phase = ASN_OPEN_TYPE_OPAQUE;
+
+    ASN_DEBUG("Kept open type %s encoded in %ld bytes", elm->type->name,
+              (long)opaque->size);
+    return rv;
+}
+
 asn_dec_rval_t
 OPEN_TYPE_uper_get(const asn_codec_ctx_t *opt_codec_ctx,
                    const asn_TYPE_descriptor_t *td, void *sptr,
@@ -22,6 +90,20 @@ OPEN_TYPE_uper_get(const asn_codec_ctx_t *opt_codec_ctx,
         ASN__DECODE_FAILED;
     }
 
+    /* Fetch the pointer to this member */
+    assert(elm->flags == ATF_OPEN_TYPE);
+    if(elm->flags & ATF_POINTER) {
+        memb_ptr2 = (void **)((char *)sptr + elm->memb_offset);
+    } else {
+        memb_ptr = (char *)sptr + elm->memb_offset;
+        memb_ptr2 = &memb_ptr;
+    }
+
+    /* Of any type, the selector need not know it */
+    if(!pd->refill && OPEN_TYPE__uper_is_opaque(opt_codec_ctx, td)) {
+        return OPEN_TYPE__uper_get_opaque(elm, memb_ptr2, pd);
+    }
+
     if(!elm->type_selector) {
         ASN_DEBUG("Type selector is not defined for Open Type %s->%s->%s",
                   td->name, elm->name, elm->type->name);
@@ -33,15 +115,11 @@ OPEN_TYPE_uper_get(const asn_codec_ctx_t *opt_codec_ctx,
         ASN__DECODE_FAILED;
     }
 
-    /* Fetch the pointer to this member */
-    assert(elm->flags == ATF_OPEN_TYPE);
-    if(elm->flags & ATF_POINTER) {
-        memb_ptr2 = (void **)((char *)sptr + elm->memb_offset);
-    } else {
-        memb_ptr = (char *)sptr + elm->memb_offset;
-        memb_ptr2 = &memb_ptr;
-    }
     if(*memb_ptr2 != NULL) {
+        /* An opaque one is absent, set_presence() would keep it */
+        if(OPEN_TYPE_get_opaque(elm->type, *memb_ptr2)) {
+            ASN_STRUCT_RESET(*elm->type, *memb_ptr2);
+        }
         /* Make sure we reset the structure first before encoding */
         if(CHOICE_variant_set_presence(elm->type, *memb_ptr2, 0)
            != 0) {
@@ -88,10 +166,20 @@ OPEN_TYPE_encode_uper(const asn_TYPE_descriptor_t *td,
     const void *memb_ptr;   /* Pointer to the member */
     asn_TYPE_member_t *elm; /* CHOICE's element */
     asn_enc_rval_t er = {0,0,0};
+    const asn_open_type_opaque_t *opaque;
     unsigned present;
 
     (void)constraints;
 
+    /* Exactly as it was decoded */
+    opaque = OPEN_TYPE_get_opaque(td, sptr);
+    if(opaque) {
+        if(per_put_many_bits(po, opaque->buf, opaque->size << 3))
+            ASN__ENCODE_FAILED;
+        er.encoded = 0;
+        ASN__ENCODED_OK(er);
+    }
+
     present = CHOICE_variant_get_presence(td, sptr);
     if(present == 0 || present > td->elements_count) {
         ASN__ENCODE_FAILED;
@@ -120,3 +208,56 @@ OPEN_TYPE_encode_uper(const asn_TYPE_descriptor_t *td,
     er.encoded = 0;
     ASN__ENCODED_OK(er);
 }
+
+int
+OPEN_TYPE_uper_materialize(const asn_TYPE_descriptor_t *td, void *sptr,
+                           const asn_TYPE_member_t *elm) {
+    const asn_CHOICE_specifics_t *specs =
+        (const asn_CHOICE_specifics_t *)elm->type->specifics;
+    asn_open_type_opaque_t *opaque;
+    asn_struct_ctx_t *ctx;
+    asn_per_data_t pd;
+    asn_dec_rval_t rv;
+    void *memb_ptr;
+    void **memb_ptr2;
+
+    if(!(elm->flags & ATF_OPEN_TYPE)) return -1;
+    if(elm->flags & ATF_POINTER) {
+        memb_ptr2 = (void **)((char *)sptr + elm->memb_offset);
+    } else {
+        memb_ptr = (char *)sptr + elm->memb_offset;
+        memb_ptr2 = &memb_ptr;
+    }
+    if(!*memb_ptr2) return 0;
+    opaque = (asn_open_type_opaque_t *)OPEN_TYPE_get_opaque(elm->type,
+                                                            *memb_ptr2);
+    if(!opaque) return 0;
+
+    /* Decoded from the kept octets as from the message */
+    ctx = (asn_struct_ctx_t *)((char *)*memb_ptr2 + specs->ctx_offset);
+    ctx->ptr = 0;
+    ctx->phase = 0;
+    memset(&pd, 0, sizeof(pd));
+    pd.buffer = opaque->buf;
+    pd.nbits = opaque->size << 3;
+    rv = OPEN_TYPE_uper_get(0, td, sptr, elm, &pd);
+    if(rv.code == RC_OK && pd.nbits == pd.nboff) {
+        FREEMEM(opaque);
+        return 0;
+    }
+
+    /* Opaque as before */
+    if(*memb_ptr2) {
+        ASN_STRUCT_RESET(*elm->type, *memb_ptr2);
+    } else {
+        *memb_ptr2 = CALLOC(1, specs->struct_size);
+        if(!*memb_ptr2) {
+            FREEMEM(opaque);
+            return -1;
+        }
+    }
+    ctx = (asn_struct_ctx_t *)((char *)*memb_ptr2 + specs->ctx_offset);
+    ctx->ptr = opaque;
+    ctx->phase = ASN_OPEN_TYPE_OPAQUE;
+    return -1;
+}
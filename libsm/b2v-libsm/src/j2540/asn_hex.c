@@ -0,0 +1,255 @@
+/*
+ * Hexadecimal conversion, see asn_hex.h.
+ * Not part of asn1c, copied into the generated code by tooling/asn1c.sh.
+ */
+#include <asn_hex.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define	ASN_HEX_X86	1
+#include <immintrin.h>
+#else
+#define	ASN_HEX_X86	0
+#endif
+
+static const char asn__hex_upper[] = "0123456789ABCDEF";
+static const char asn__hex_lower[] = "0123456789abcdef";
+
+static int
+asn__hex_nibble(unsigned int c) {
+	if(c - '0' < 10) return (int)(c - '0');
+	c |= 0x20;
+	if(c - 'a' < 6) return (int)(c - 'a' + 10);
+	return -1;
+}
+
+static void
+asn__hex_encode_scalar(const uint8_t *src, size_t size, char *dst, int lower) {
+	const char *digits = lower ? asn__hex_lower : asn__hex_upper;
+	for(size_t i = 0; i < size; i++) {
+		*dst++ = digits[src[i] >> 4];
+		*dst++ = digits[src[i] & 0x0F];
+	}
+}
+
+static int
+asn__hex_decode_scalar(const char *src, size_t size, uint8_t *dst) {
+	for(size_t i = 0; i < size; i += 2) {
+		int hi = asn__hex_nibble((unsigned char)src[i]);
+		int lo = asn__hex_nibble((unsigned char)src[i + 1]);
+		if((hi | lo) < 0) return -1;
+		*dst++ = (uint8_t)((hi << 4) | lo);
+	}
+	return 0;
+}
+
+#if ASN_HEX_X86
+
+static asn_hex_impl_e asn__hex_best_impl = ASN_HEX_SCALAR;
+
+/* Pick the variant once, when the library is loaded */
+__attribute__((constructor)) static void
+asn__hex_dispatch(void) {
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("avx2"))
+		asn__hex_best_impl = ASN_HEX_AVX2;
+	else if(__builtin_cpu_supports("ssse3"))
+		asn__hex_best_impl = ASN_HEX_SSSE3;
+}
+
+/* 16 bytes a step: split into nibbles, look the digits up, interleave */
+__attribute__((target("ssse3"))) static void
+asn__hex_encode_ssse3(const uint8_t *src, size_t size, char *dst, int lower) {
+	const __m128i digits = _mm_loadu_si128(
+		(const __m128i *)(lower ? asn__hex_lower : asn__hex_upper));
+	const __m128i mask = _mm_set1_epi8(0x0F);
+	size_t i = 0;
+	for(; i + 16 <= size; i += 16) {
+		__m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+		__m128i hi = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(v, 4), mask));
+		__m128i lo = _mm_shuffle_epi8(digits, _mm_and_si128(v, mask));
+		_mm_storeu_si128((__m128i *)(dst + 2 * i), _mm_unpacklo_epi8(hi, lo));
+		_mm_storeu_si128((__m128i *)(dst + 2 * i + 16), _mm_unpackhi_epi8(hi, lo));
+	}
+	asn__hex_encode_scalar(src + i, size - i, dst + 2 * i, lower);
+}
+
+/* Nibble values of 16 digits, and 0xFF in *ok where a digit is valid */
+__attribute__((target("ssse3"))) static __m128i
+asn__hex_nibbles_ssse3(__m128i v, __m128i *ok) {
+	__m128i d = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+	__m128i l = _mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+	__m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(9)), d);
+	__m128i is_letter = _mm_cmpeq_epi8(_mm_min_epu8(l, _mm_set1_epi8(5)), l);
+	*ok = _mm_or_si128(is_digit, is_letter);
+	return _mm_or_si128(_mm_and_si128(is_digit, d),
+	                    _mm_and_si128(is_letter, _mm_add_epi8(l, _mm_set1_epi8(10))));
+}
+
+/* 32 digits a step: nibbles, then hi * 16 + lo per pair, then pack to bytes */
+__attribute__((target("ssse3"))) static int
+asn__hex_decode_ssse3(const char *src, size_t size, uint8_t *dst) {
+	const __m128i weights = _mm_set1_epi16(0x0110);
+	size_t i = 0;
+	for(; i + 32 <= size; i += 32) {
+		__m128i ok_a, ok_b;
+		__m128i a = asn__hex_nibbles_ssse3(
+			_mm_loadu_si128((const __m128i *)(src + i)), &ok_a);
+		__m128i b = asn__hex_nibbles_ssse3(
+			_mm_loadu_si128((const __m128i *)(src + i + 16)), &ok_b);
+		if(_mm_movemask_epi8(_mm_and_si128(ok_a, ok_b)) != 0xFFFF) return -1;
+		_mm_storeu_si128((__m128i *)(dst + i / 2),
+		                 _mm_packus_epi16(_mm_maddubs_epi16(a, weights),
+		                                  _mm_maddubs_epi16(b, weights)));
+	}
+	return asn__hex_decode_scalar(src + i, size - i, dst + i / 2);
+}
+
+/* As the SSSE3 variant, 32 bytes a step, fixing up the order across lanes */
+__attribute__((target("avx2"))) static void
+asn__hex_encode_avx2(const uint8_t *src, size_t size, char *dst, int lower) {
+	const __m256i digits = _mm256_broadcastsi128_si256(_mm_loadu_si128(
+		(const __m128i *)(lower ? asn__hex_lower : asn__hex_upper)));
+	const __m256i mask = _mm256_set1_epi8(0x0F);
+	size_t i = 0;
+	for(; i + 32 <= size; i += 32) {
+		__m256i v = _mm256_loadu_si256((const __m256i *)(src + i));
+		__m256i hi = _mm256_shuffle_epi8(digits,
+		                                 _mm256_and_si256(_mm256_srli_epi16(v, 4), mask));
+		__m256i lo = _mm256_shuffle_epi8(digits, _mm256_and_si256(v, mask));
+		__m256i a = _mm256_unpacklo_epi8(hi, lo);
+		__m256i b = _mm256_unpackhi_epi8(hi, lo);
+		_mm256_storeu_si256((__m256i *)(dst + 2 * i), _mm256_permute2x128_si256(a, b, 0x20));
+		_mm256_storeu_si256((__m256i *)(dst + 2 * i + 32),
+		                    _mm256_permute2x128_si256(a, b, 0x31));
+	}
+	asn__hex_encode_scalar(src + i, size - i, dst + 2 * i, lower);
+}
+
+__attribute__((target("avx2"))) static __m256i
+asn__hex_nibbles_avx2(__m256i v, __m256i *ok) {
+	__m256i d = _mm256_sub_epi8(v, _mm256_set1_epi8('0'));
+	__m256i l = _mm256_sub_epi8(_mm256_or_si256(v, _mm256_set1_epi8(0x20)),
+	                            _mm256_set1_epi8('a'));
+	__m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8(9)), d);
+	__m256i is_letter = _mm256_cmpeq_epi8(_mm256_min_epu8(l, _mm256_set1_epi8(5)), l);
+	*ok = _mm256_or_si256(is_digit, is_letter);
+	return _mm256_or_si256(_mm256_and_si256(is_digit, d),
+	                       _mm256_and_si256(is_letter,
+	                                        _mm256_add_epi8(l, _mm256_set1_epi8(10))));
+}
+
+__attribute__((target("avx2"))) static int
+asn__hex_decode_avx2(const char *src, size_t size, uint8_t *dst) {
+	const __m256i weights = _mm256_set1_epi16(0x0110);
+	size_t i = 0;
+	for(; i + 64 <= size; i += 64) {
+		__m256i ok_a, ok_b;
+		__m256i a = asn__hex_nibbles_avx2(
+			_mm256_loadu_si256((const __m256i *)(src + i)), &ok_a);
+		__m256i b = asn__hex_nibbles_avx2(
+			_mm256_loadu_si256((const __m256i *)(src + i + 32)), &ok_b);
+		if(_mm256_movemask_epi8(_mm256_and_si256(ok_a, ok_b)) != -1) return -1;
+		__m256i packed = _mm256_packus_epi16(_mm256_maddubs_epi16(a, weights),
+		                                     _mm256_maddubs_epi16(b, weights));
+		_mm256_storeu_si256((__m256i *)(dst + i / 2),
+		                    _mm256_permute4x64_epi64(packed, 0xD8));
+	}
+	return asn__hex_decode_scalar(src + i, size - i, dst + i / 2);
+}
+
+#endif	/* ASN_HEX_X86 */
+
+asn_hex_impl_e
+asn_hex_best(void) {
+#if ASN_HEX_X86
+	return asn__hex_best_impl;
+#else
+	return ASN_HEX_SCALAR;
+#endif
+}
+
+int
+asn_hex_supported(asn_hex_impl_e impl) {
+	switch(impl) {
+	case ASN_HEX_SCALAR:
+		return 1;
+#if ASN_HEX_X86
+	case ASN_HEX_SSSE3:
+		return __builtin_cpu_supports("ssse3") != 0;
+	case ASN_HEX_AVX2:
+		return __builtin_cpu_supports("avx2") != 0;
+#endif
+	default:
+		return 0;
+	}
+}
+
+void
+asn_hex_encode_with(asn_hex_impl_e impl, const uint8_t *src, size_t size,
+                    char *dst, int lower) {
+#if ASN_HEX_X86
+	if(impl == ASN_HEX_AVX2 && asn_hex_supported(impl)) {
+		asn__hex_encode_avx2(src, size, dst, lower);
+		return;
+	}
+	if(impl == ASN_HEX_SSSE3 && asn_hex_supported(impl)) {
+		asn__hex_encode_ssse3(src, size, dst, lower);
+		return;
+	}
+#else
+	(void)impl;
+#endif
+	asn__hex_encode_scalar(src, size, dst, lower);
+}
+
+ssize_t
+asn_hex_decode_with(asn_hex_impl_e impl, const char *src, size_t size,
+                    uint8_t *dst) {
+	int rv;
+
+	if(size & 1) return -1;
+#if ASN_HEX_X86
+	if(impl == ASN_HEX_AVX2 && asn_hex_supported(impl))
+		rv = asn__hex_decode_avx2(src, size, dst);
+	else if(impl == ASN_HEX_SSSE3 && asn_hex_supported(impl))
+		rv = asn__hex_decode_ssse3(src, size, dst);
+	else
+#else
+	(void)impl;
+#endif
+		rv = asn__hex_decode_scalar(src, size, dst);
+	return rv < 0 ? -1 : (ssize_t)(size / 2);
+}
+
+void
+asn_hex_encode(const uint8_t *src, size_t size, char *dst, int lower) {
+#if ASN_HEX_X86
+	switch(asn__hex_best_impl) {
+	case ASN_HEX_AVX2:
+		asn__hex_encode_avx2(src, size, dst, lower);
+		return;
+	case ASN_HEX_SSSE3:
+		asn__hex_encode_ssse3(src, size, dst, lower);
+		return;
+	default:
+		break;
+	}
+#endif
+	asn__hex_encode_scalar(src, size, dst, lower);
+}
+
+ssize_t
+asn_hex_decode(const char *src, size_t size, uint8_t *dst) {
+	int rv;
+
+	if(size & 1) return -1;
+#if ASN_HEX_X86
+	if(asn__hex_best_impl == ASN_HEX_AVX2)
+		rv = asn__hex_decode_avx2(src, size, dst);
+	else if(asn__hex_best_impl == ASN_HEX_SSSE3)
+		rv = asn__hex_decode_ssse3(src, size, dst);
+	else
+#endif
+		rv = asn__hex_decode_scalar(src, size, dst);
+	return rv < 0 ? -1 : (ssize_t)(size / 2);
+}
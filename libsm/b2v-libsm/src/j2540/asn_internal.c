@@ -48,3 +48,7 @@ asn__format_to_callback(int (*cb)(const void *, size_t, void *key), void *key,
     return wrote;
 }
 
+
+#if ASN_EMIT_DEBUG == 1 && __STDC_VERSION__ >= 199901L && !defined(ASN_THREAD_SAFE)
+ASN_THREAD_LOCAL int asn_debug_indent;
+#endif
@@ -34,10 +34,20 @@ extern "C" {
 #define	ASN1C_ENVIRONMENT_VERSION	923	/* Compile-time version */
 int get_asn1c_environment_version(void);	/* Run-time version */
 
+#if	LIBSM_STATS
+#include "asn_stats.h"
+#define	CALLOC(nmemb, size)	asn_stats_calloc(nmemb, size)
+#define	MALLOC(size)		asn_stats_malloc(size)
+#define	REALLOC(oldptr, size)	asn_stats_realloc(oldptr, size)
+#define	FREEMEM(ptr)		asn_stats_free(ptr)
+#define	ASN_STATS_TYPE(td)	asn_stats_set_type(td)
+#else
 #define	CALLOC(nmemb, size)	calloc(nmemb, size)
 #define	MALLOC(size)		malloc(size)
 #define	REALLOC(oldptr, size)	realloc(oldptr, size)
 #define	FREEMEM(ptr)		free(ptr)
+#define	ASN_STATS_TYPE(td)	do{}while(0)
+#endif
 
 #define	asn_debug_indent	0
 #define ASN_DEBUG_INDENT_ADD(i) do{}while(0)
@@ -60,7 +70,7 @@ int get_asn1c_environment_version(void);	/* Run-time version */
 #else	/* !ASN_THREAD_SAFE */
 #undef  ASN_DEBUG_INDENT_ADD
 #undef  asn_debug_indent
-int asn_debug_indent;
+extern ASN_THREAD_LOCAL int asn_debug_indent;
 #define ASN_DEBUG_INDENT_ADD(i) do { asn_debug_indent += i; } while(0)
 #endif	/* ASN_THREAD_SAFE */
 #define	ASN_DEBUG(fmt, args...)	do {			\
@@ -182,4 +182,13 @@ typedef	unsigned int	uint32_t;
 #endif
 #endif
 
+/* Storage of state that is per thread */
+#if __STDC_VERSION__ >= 201112L
+#define ASN_THREAD_LOCAL _Thread_local
+#elif defined(_MSC_VER)
+#define ASN_THREAD_LOCAL __declspec(thread)
+#else
+#define ASN_THREAD_LOCAL __thread
+#endif
+
 #endif	/* ASN_SYSTEM_H */
@@ -20,6 +20,7 @@ SEQUENCE_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
                      const asn_TYPE_descriptor_t *td,
                      const asn_per_constraints_t *constraints, void **sptr,
                      asn_per_data_t *pd) {
+    ASN_STATS_TYPE(td);
     const asn_SEQUENCE_specifics_t *specs = (const asn_SEQUENCE_specifics_t *)td->specifics;
     void *st = *sptr;  /* Target structure. */
     int extpresent;    /* Extension additions are present */
@@ -119,6 +120,7 @@ SEQUENCE_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
                                              elm->encoding_constraints.per_constraints,
                                              memb_ptr2, pd);
         }
+        ASN_STATS_TYPE(td);
         if(rv.code != RC_OK) {
             ASN_DEBUG("Failed decode %s in %s",
                       elm->name, td->name);
@@ -184,6 +186,7 @@ SEQUENCE_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
             rv = uper_open_type_get(opt_codec_ctx, elm->type,
                                     elm->encoding_constraints.per_constraints,
                                     memb_ptr2, pd);
+            ASN_STATS_TYPE(td);
             if(rv.code != RC_OK) {
                 FREEMEM(epres);
                 return rv;
@@ -11,6 +11,7 @@ SET_OF_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
                    const asn_TYPE_descriptor_t *td,
                    const asn_per_constraints_t *constraints, void **sptr,
                    asn_per_data_t *pd) {
+    ASN_STATS_TYPE(td);
     asn_dec_rval_t rv = {RC_OK, 0};
     const asn_SET_OF_specifics_t *specs = (const asn_SET_OF_specifics_t *)td->specifics;
     const asn_TYPE_member_t *elm = td->elements;  /* Single one */
@@ -73,6 +74,7 @@ SET_OF_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
             ASN_DEBUG("%s SET OF %s decoded %d, %p",
                       td->name, elm->type->name, rv.code, ptr);
             if(rv.code == RC_OK) {
+                ASN_STATS_TYPE(td);
                 if(ASN_SET_ADD(list, ptr) == 0) {
                     if(rv.consumed == 0 && nelems > 200) {
                         /* Protect from SET OF NULL compression bombs. */
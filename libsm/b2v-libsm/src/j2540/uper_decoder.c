@@ -81,6 +81,7 @@ uper_decode(const asn_codec_ctx_t *opt_codec_ctx,
 	if(!td->op->uper_decoder)
 		ASN__DECODE_FAILED;	/* PER is not compiled in */
 	rval = td->op->uper_decoder(opt_codec_ctx, td, 0, sptr, &pd);
+	ASN_STATS_TYPE(0);
 	if(rval.code == RC_OK) {
 		/* Return the number of consumed bits */
 		rval.consumed = ((pd.buffer - (const uint8_t *)buffer) << 3)
@@ -24,7 +24,9 @@ uper_encode(const asn_TYPE_descriptor_t *td,
     po.op_key = app_key;
     po.flushed_bytes = 0;
 
+    ASN_STATS_TYPE(td);
     er = td->op->uper_encoder(td, constraints, sptr, &po);
+    ASN_STATS_TYPE(0);
     if(er.encoded != -1) {
         size_t bits_to_flush;
 
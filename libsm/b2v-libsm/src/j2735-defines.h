@@ -67,6 +67,8 @@
 //  1/10 microdegrees <-> degrees
 #define Latitude_unit_deg 1e7
 #define Latitude_unit Latitude_unit_deg
+//  1/10 microdegree of latitude <-> m, on a sphere of the WGS 84 equatorial radius (needs math.h)
+#define Latitude_m_per_unit ((M_PI / 180.0) * 6378137.0 / Latitude_unit_deg)
 
 #define Longitude_min -1799999999
 #define Longitude_max 1800000000
@@ -16,7 +16,7 @@ BIT_STRING_random_fill(const asn_TYPE_descriptor_t *td, void **sptr,
     asn_random_fill_result_t result_ok = {ARFILL_OK, 1};
     asn_random_fill_result_t result_failed = {ARFILL_FAILED, 0};
     asn_random_fill_result_t result_skipped = {ARFILL_SKIPPED, 0};
-    static unsigned lengths[] = {0,     1,     2,     3,     4,     8,
+    static const unsigned lengths[] = {0,     1,     2,     3,     4,     8,
                                  126,   127,   128,   16383, 16384, 16385,
                                  65534, 65535, 65536, 65537};
     uint8_t *buf;
@@ -23,6 +23,7 @@ BIT_STRING_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
                        const asn_TYPE_descriptor_t *td,
                        const asn_per_constraints_t *constraints, void **sptr,
                        asn_per_data_t *pd) {
+    ASN_STATS_TYPE(td);
     const asn_OCTET_STRING_specifics_t *specs = td->specifics
         ? (const asn_OCTET_STRING_specifics_t *)td->specifics
         : &asn_SPC_BIT_STRING_specs;
@@ -11,6 +11,7 @@ BOOLEAN_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
                     const asn_TYPE_descriptor_t *td,
                     const asn_per_constraints_t *constraints, void **sptr,
                     asn_per_data_t *pd) {
+    ASN_STATS_TYPE(td);
     asn_dec_rval_t rv;
     BOOLEAN_t *st = (BOOLEAN_t *)*sptr;
 
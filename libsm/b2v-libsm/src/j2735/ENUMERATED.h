@@ -40,6 +40,9 @@ extern asn_TYPE_operation_t asn_OP_ENUMERATED;
 #if !defined(ASN_DISABLE_JER_SUPPORT)
 jer_type_decoder_f ENUMERATED_decode_jer;
 #define ENUMERATED_encode_jer INTEGER_encode_jer
+/* The value of the quoted name at lstart, NULL if there is none */
+const asn_INTEGER_enum_map_t *ENUMERATED_jer_map_enum2value(
+    const asn_INTEGER_specifics_t *specs, const char *lstart, const char *lstop);
 #endif  /* !defined(ASN_DISABLE_JER_SUPPORT) */
 
 #if !defined(ASN_DISABLE_OER_SUPPORT)
@@ -31,7 +31,7 @@ ENUMERATED__jer_compar_enum2value(const void *kp, const void *am) {
     return name[0] ? -1 : 0;
 }
 
-static const asn_INTEGER_enum_map_t *
+const asn_INTEGER_enum_map_t *
 ENUMERATED_jer_map_enum2value(const asn_INTEGER_specifics_t *specs, const char *lstart,
                        const char *lstop) {
     const asn_INTEGER_enum_map_t *el_found;
@@ -6,48 +6,42 @@
 #include <asn_internal.h>
 #include <NativeEnumerated.h>
 
+static enum jer_pbd_rval
+NativeEnumerated__jer_body_decode(const asn_TYPE_descriptor_t *td, void *sptr,
+                                  const void *chunk_buf, size_t chunk_size) {
+    const char *lstart = (const char *)chunk_buf;
+    const char *lstop = lstart + chunk_size;
+    const char *lp;
+
+    for(lp = lstart; lp < lstop; lp++) {
+        if(*lp == 0x22 /* '"' */) {
+            const asn_INTEGER_enum_map_t *el = ENUMERATED_jer_map_enum2value(
+                (const asn_INTEGER_specifics_t *)td->specifics, lp, lstop);
+            if(!el) {
+                ASN_DEBUG("Unknown identifier for ENUMERATED");
+                break;
+            }
+            ASN_DEBUG("Found \"%s\" => %ld", el->enum_name, el->nat_value);
+            *(long *)sptr = el->nat_value;
+            return JPBD_BODY_CONSUMED;
+        }
+    }
+    return JPBD_BROKEN_ENCODING;
+}
+
 /*
  * Decode the chunk of JSON text encoding ENUMERATED.
+ * The name goes straight into the native long, without an INTEGER_t in
+ * between, so decoding does not allocate beyond the long itself.
  */
 asn_dec_rval_t
 NativeEnumerated_decode_jer(const asn_codec_ctx_t *opt_codec_ctx,
                          const asn_TYPE_descriptor_t *td,
                          const asn_jer_constraints_t *constraints, void **sptr,
                          const void *buf_ptr, size_t size) {
-    const asn_INTEGER_specifics_t *specs =
-        (const asn_INTEGER_specifics_t *)td->specifics;
-    asn_dec_rval_t rval;
-    INTEGER_t st;
-    void *st_ptr = (void *)&st;
-    long *native = (long *)*sptr;
-
-    if(!native) {
-        native = (long *)(*sptr = CALLOC(1, sizeof(*native)));
-        if(!native) ASN__DECODE_FAILED;
-    }
-
-    memset(&st, 0, sizeof(st));
-    rval = ENUMERATED_decode_jer(opt_codec_ctx, td, constraints, &st_ptr, buf_ptr, size);
-    if(rval.code == RC_OK) {
-        long l;
-        if((specs&&specs->field_unsigned)
-            ? asn_INTEGER2ulong(&st, (unsigned long *)&l) /* sic */
-            : asn_INTEGER2long(&st, &l)) {
-            rval.code = RC_FAIL;
-            rval.consumed = 0;
-        } else {
-            *native = l;
-        }
-    } else {
-        /*
-         * Cannot restart from the middle;
-         * there is no place to save state in the native type.
-         * Request a continuation from the very beginning.
-         */
-        rval.consumed = 0;
-    }
-    ASN_STRUCT_FREE_CONTENTS_ONLY(asn_DEF_INTEGER, &st);
-    return rval;
+    (void)constraints;
+    return jer_decode_primitive(opt_codec_ctx, td, sptr, sizeof(long),
+                                buf_ptr, size, NativeEnumerated__jer_body_decode);
 }
 
 asn_enc_rval_t
@@ -68,9 +62,11 @@ NativeEnumerated_encode_jer(const asn_TYPE_descriptor_t *td,
 
     el = INTEGER_map_value2enum(specs, *native);
     if(el) {
-        er.encoded =
-            asn__format_to_callback(cb, app_key, "\"%s\"", el->enum_name);
-        if(er.encoded < 0) ASN__ENCODE_FAILED;
+        if(cb("\"", 1, app_key) < 0
+           || cb(el->enum_name, el->enum_len, app_key) < 0
+           || cb("\"", 1, app_key) < 0)
+            ASN__ENCODE_FAILED;
+        er.encoded = (ssize_t)el->enum_len + 2;
         ASN__ENCODED_OK(er);
     } else {
         ASN_DEBUG(
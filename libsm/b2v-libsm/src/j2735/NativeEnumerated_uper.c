@@ -11,6 +11,7 @@ NativeEnumerated_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
                              const asn_TYPE_descriptor_t *td,
                              const asn_per_constraints_t *constraints,
                              void **sptr, asn_per_data_t *pd) {
+    ASN_STATS_TYPE(td);
     const asn_INTEGER_specifics_t *specs = td->specifics;
     asn_dec_rval_t rval = { RC_OK, 0 };
     long *native = (long *)*sptr;
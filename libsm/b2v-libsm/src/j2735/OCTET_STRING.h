@@ -21,6 +21,15 @@ typedef struct OCTET_STRING {
 extern asn_TYPE_descriptor_t asn_DEF_OCTET_STRING;
 extern asn_TYPE_operation_t asn_OP_OCTET_STRING;
 
+/*
+ * The decoding phase of an OCTET STRING that does not own its buf, as
+ * decoded with asn_codec_ctx_t borrow_min. OCTET_STRING_free() leaves the
+ * buf alone.
+ */
+#define ASN_OCTET_STRING_BORROWED	(-1)
+#define OCTET_STRING_is_borrowed(st)	\
+	((st)->_asn_ctx.phase == ASN_OCTET_STRING_BORROWED)
+
 asn_struct_free_f OCTET_STRING_free;
 
 #if !defined(ASN_DISABLE_PRINT_SUPPORT)
@@ -6,6 +6,10 @@
 #include <asn_internal.h>
 #include <OCTET_STRING.h>
 #include <BIT_STRING.h>  /* for .bits_unused member */
+#include <asn_hex.h>
+
+/* Bytes converted to hexadecimal at a time */
+#define ASN_HEX_CHUNK 64
 
 asn_enc_rval_t
 OCTET_STRING_encode_jer(const asn_TYPE_descriptor_t *td,
@@ -13,14 +17,12 @@ OCTET_STRING_encode_jer(const asn_TYPE_descriptor_t *td,
                         const void *sptr, int ilevel,
                         enum jer_encoder_flags_e flags,
                         asn_app_consume_bytes_f *cb, void *app_key) {
-    const char * const h2c = "0123456789ABCDEF";
     const OCTET_STRING_t *st = (const OCTET_STRING_t *)sptr;
     asn_enc_rval_t er = { 0, 0, 0 };
-    char scratch[16 * 3 + 4];
-    char *p = scratch;
+    char scratch[2 * ASN_HEX_CHUNK];
     uint8_t *buf;
     uint8_t *end;
-    size_t i;
+    size_t chunk;
 
     (void)ilevel;
     (void)flags;
@@ -36,16 +38,10 @@ OCTET_STRING_encode_jer(const asn_TYPE_descriptor_t *td,
     buf = st->buf;
     end = buf + st->size;
     ASN__CALLBACK("\"", 1);
-    for(i = 0; buf < end; buf++, i++) {
-      if(!(i % 16) && (i || st->size > 16)) {
-        ASN__CALLBACK(scratch, p-scratch);
-        p = scratch;
-      }
-      *p++ = h2c[(*buf >> 4) & 0x0F];
-      *p++ = h2c[*buf & 0x0F];
-    }
-    if(p - scratch) {
-      ASN__CALLBACK(scratch, p-scratch);  /* Dump the rest */
+    for(; buf < end; buf += chunk) {
+      chunk = end - buf < ASN_HEX_CHUNK ? end - buf : ASN_HEX_CHUNK;
+      asn_hex_encode(buf, chunk, scratch, 0);
+      ASN__CALLBACK(scratch, 2 * chunk);
     }
     ASN__CALLBACK("\"", 1);
 
@@ -244,6 +240,12 @@ static ssize_t OCTET_STRING__convert_hexadecimal(void *sptr, const void *chunk_b
     st->buf = (uint8_t *)nptr;
     buf = st->buf + st->size;
 
+    /* Most strings are plain hexadecimal, convert those in bulk */
+    if(asn_hex_decode(p, chunk_size, buf) >= 0) {
+        buf += chunk_size / 2;
+        p = pend;
+    }
+
     /*
      * If something like " a b c " appears here, the " a b":3 will be
      * converted, and the rest skipped. That is, unless buf_size is greater
@@ -21,11 +21,46 @@ static asn_per_constraints_t asn_DEF_OCTET_STRING_constraints = {
     0, 0
 };
 
+/*
+ * Borrow len octets for st, see asn_codec_ctx_t borrow_min: point into
+ * the decoded buffer when aligned, else copy them into the arena once.
+ * RETURN VALUES:
+ *  0: Borrowed.
+ *  1: Not borrowed, decode as usual.
+ * -1: Not enough bits.
+ */
+static int
+OCTET_STRING_per_borrow(const asn_codec_ctx_t *ctx, OCTET_STRING_t *st,
+                        asn_per_data_t *pd, size_t len) {
+    asn_borrow_arena_t *arena = ctx->borrow_arena;
+
+    if(pd->nbits - pd->nboff < 8 * len)
+        return pd->refill ? 1 : -1;
+
+    if(!pd->refill && !(pd->nboff & 7)) {
+        st->buf = (uint8_t *)pd->buffer + (pd->nboff >> 3);
+        pd->nboff += 8 * len;
+        pd->moved += 8 * len;
+    } else if(arena && arena->size - arena->used >= len) {
+        if(per_get_many_bits(pd, arena->buf + arena->used, 0, 8 * len))
+            return -1;
+        st->buf = arena->buf + arena->used;
+        arena->used += len;
+    } else {
+        return 1;
+    }
+
+    st->size = len;
+    st->_asn_ctx.phase = ASN_OCTET_STRING_BORROWED;
+    return 0;
+}
+
 asn_dec_rval_t
 OCTET_STRING_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
                          const asn_TYPE_descriptor_t *td,
                          const asn_per_constraints_t *constraints, void **sptr,
                          asn_per_data_t *pd) {
+    ASN_STATS_TYPE(td);
     const asn_OCTET_STRING_specifics_t *specs = td->specifics
         ? (const asn_OCTET_STRING_specifics_t *)td->specifics
         : &asn_SPC_OCTET_STRING_specs;
@@ -44,8 +79,7 @@ OCTET_STRING_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
     } bpc;  /* Bytes per character */
     unsigned int unit_bits;
     unsigned int canonical_unit_bits;
-
-    (void)opt_codec_ctx;
+    int borrow;
 
     if(pc) {
         cval = &pc->value;
@@ -88,6 +122,11 @@ OCTET_STRING_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
     if(!st) {
         st = (OCTET_STRING_t *)(*sptr = CALLOC(1, specs->struct_size));
         if(!st) RETURN(RC_FAIL);
+    } else if(OCTET_STRING_is_borrowed(st)) {
+        /* Not ours to free or reuse */
+        st->buf = 0;
+        st->size = 0;
+        st->_asn_ctx.phase = 0;
     }
 
     ASN_DEBUG("PER Decoding %s size %"ASN_PRIdMAX" .. %"ASN_PRIdMAX" bits %d",
@@ -103,7 +142,12 @@ OCTET_STRING_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
         }
     }
 
-    if(csiz->effective_bits >= 0) {
+    /* Octets as they are, which OCTET_STRING_per_get_characters() copies */
+    borrow = opt_codec_ctx && opt_codec_ctx->borrow_min
+             && csiz->effective_bits != 0 && bpc == OS__BPC_CHAR
+             && unit_bits == 8 && (unsigned long)cval->upper_bound <= 256;
+
+    if(csiz->effective_bits >= 0 && !borrow) {
         FREEMEM(st->buf);
         if(bpc) {
             st->size = csiz->upper_bound * bpc;
@@ -158,6 +202,12 @@ OCTET_STRING_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
                   (long)csiz->effective_bits, (long)raw_len,
                   repeat ? "repeat" : "once", td->name);
         len_bytes = raw_len * bpc;
+        if(borrow && !st->size && !repeat
+           && (size_t)raw_len >= opt_codec_ctx->borrow_min) {
+            ret = OCTET_STRING_per_borrow(opt_codec_ctx, st, pd, raw_len);
+            if(ret < 0) RETURN(RC_WMORE);
+            if(ret == 0) return rval;  /* Not nul-terminated */
+        }
         p = REALLOC(st->buf, st->size + len_bytes + 1);
         if(!p) RETURN(RC_FAIL);
         st->buf = (uint8_t *)p;
@@ -26,16 +26,34 @@ extern "C" {
         consumed_myself += num;          \
     } while(0)
 
-#define OPEN_TYPE_free CHOICE_free
+/*
+ * An open type kept as it was encoded, with its length determinant, by a
+ * decoder given asn_codec_ctx_t opaque_open_types. Its CHOICE is absent,
+ * the value is in the CHOICE's context until materialized.
+ */
+typedef struct asn_open_type_opaque_s {
+	uint8_t *buf;	/* The encoding, in whole octets */
+	size_t size;	/* Octets in buf */
+} asn_open_type_opaque_t;
+
+#define ASN_OPEN_TYPE_OPAQUE	(-1)	/* Phase of the context */
+
+/*
+ * The encoding of an opaque open type, NULL for a decoded one.
+ */
+const asn_open_type_opaque_t *OPEN_TYPE_get_opaque(
+    const asn_TYPE_descriptor_t *type_descriptor, const void *struct_ptr);
+
+asn_struct_free_f OPEN_TYPE_free;
 
 #if !defined(ASN_DISABLE_PRINT_SUPPORT)
 #define OPEN_TYPE_print CHOICE_print
 #endif  /* !defined(ASN_DISABLE_PRINT_SUPPORT) */
 
-#define OPEN_TYPE_compare CHOICE_compare
-#define OPEN_TYPE_copy    CHOICE_copy
+asn_struct_compare_f OPEN_TYPE_compare;
+asn_struct_copy_f    OPEN_TYPE_copy;
 
-#define OPEN_TYPE_constraint CHOICE_constraint
+asn_constr_check_f OPEN_TYPE_constraint;
 
 #if !defined(ASN_DISABLE_BER_SUPPORT)
 asn_dec_rval_t OPEN_TYPE_ber_get(
@@ -96,6 +114,15 @@ asn_enc_rval_t OPEN_TYPE_encode_uper(
     const asn_TYPE_descriptor_t *type_descriptor,
     const asn_per_constraints_t *constraints, const void *struct_ptr,
     asn_per_outp_t *per_output);
+
+/*
+ * Decode an opaque open type member of the parent structure in place.
+ * Returns 0 if it is decoded now or already was, -1 if it is left opaque.
+ */
+int OPEN_TYPE_uper_materialize(
+    const asn_TYPE_descriptor_t *parent_type,
+    void *parent_structure,
+    const asn_TYPE_member_t *element);
 #endif  /* !defined(ASN_DISABLE_UPER_SUPPORT) */
 #if !defined(ASN_DISABLE_APER_SUPPORT)
 asn_dec_rval_t OPEN_TYPE_aper_get(
@@ -35,8 +35,8 @@ asn_bit_data_new_contiguous(const void *data, size_t size_bits) {
 
 char *
 asn_bit_data_string(asn_bit_data_t *pd) {
-	static char buf[2][32];
-	static int n;
+	static ASN_THREAD_LOCAL char buf[2][32];
+	static ASN_THREAD_LOCAL int n;
 	n = (n+1) % 2;
     snprintf(buf[n], sizeof(buf[n]),
              "{m=%" ASN_PRI_SIZE " span %" ASN_PRI_SIZE "[%" ASN_PRI_SIZE
@@ -11,6 +11,16 @@ extern "C" {
 
 struct asn_TYPE_descriptor_s;	/* Forward declaration */
 
+/*
+ * Caller's memory for the OCTET STRINGs a borrowing decoder has to copy,
+ * see asn_codec_ctx_t. Strings are placed from used on, used grows.
+ */
+typedef struct asn_borrow_arena_s {
+	uint8_t *buf;
+	size_t size;
+	size_t used;
+} asn_borrow_arena_t;
+
 /*
  * This structure defines a set of parameters that may be passed
  * to every ASN.1 encoder or decoder function.
@@ -33,6 +43,25 @@ typedef struct asn_codec_ctx_s {
 	 * stack size is rather limited.
 	 */
 	size_t  max_stack_size; /* 0 disables stack bounds checking */
+
+	/*
+	 * UPER decoders borrow OCTET STRINGs of at least borrow_min octets
+	 * instead of copying them to the heap, 0 disables borrowing.
+	 * A byte aligned one points into the decoded buffer, any other one is
+	 * copied into borrow_arena, or to the heap as usual if that is NULL or
+	 * full. The buffer and the arena must outlive the decoded structure,
+	 * which must not write to the borrowed octets. Borrowed strings are
+	 * not NUL terminated, and freeing the structure leaves them alone,
+	 * see OCTET_STRING_is_borrowed().
+	 */
+	size_t  borrow_min;
+	asn_borrow_arena_t *borrow_arena;
+
+	/*
+	 * NULL terminated types whose open type members UPER decoders keep
+	 * encoded, see OPEN_TYPE_get_opaque(). NULL decodes all of them.
+	 */
+	const struct asn_TYPE_descriptor_s *const *opaque_open_types;
 } asn_codec_ctx_t;
 
 /*
@@ -0,0 +1,59 @@
+/*
+ * Hexadecimal conversion for the ASN.1 support code and the tools.
+ * Not part of asn1c, copied into the generated code by tooling/asn1c.sh.
+ *
+ * There is a scalar variant and, on x86 with GCC or clang, SSSE3 and AVX2
+ * variants. asn_hex_encode and asn_hex_decode use the best one the cpu
+ * supports, picked once when the library is loaded.
+ */
+#ifndef	ASN_HEX_H
+#define	ASN_HEX_H
+
+#include <asn_system.h>		/* for ssize_t */
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+typedef enum asn_hex_impl_e {
+	ASN_HEX_SCALAR,
+	ASN_HEX_SSSE3,
+	ASN_HEX_AVX2
+} asn_hex_impl_e;
+
+/*
+ * Write 2 * size hex digits of src to dst, not terminated.
+ * Upper case digits unless lower is set.
+ */
+void asn_hex_encode(const uint8_t *src, size_t size, char *dst, int lower);
+
+/*
+ * Convert size hex digits of src, either case, to size / 2 bytes in dst.
+ * Returns size / 2, or -1 if size is odd or src has anything but hex digits,
+ * in which case dst holds garbage.
+ */
+ssize_t asn_hex_decode(const char *src, size_t size, uint8_t *dst);
+
+/*
+ * The variant asn_hex_encode and asn_hex_decode use.
+ */
+asn_hex_impl_e asn_hex_best(void);
+
+/*
+ * Whether the cpu runs a variant.
+ */
+int asn_hex_supported(asn_hex_impl_e impl);
+
+/*
+ * As above with a given variant, or the scalar one if the cpu does not run it.
+ */
+void asn_hex_encode_with(asn_hex_impl_e impl, const uint8_t *src, size_t size,
+                         char *dst, int lower);
+ssize_t asn_hex_decode_with(asn_hex_impl_e impl, const char *src, size_t size,
+                            uint8_t *dst);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* ASN_HEX_H */
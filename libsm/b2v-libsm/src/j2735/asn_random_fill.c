@@ -21,6 +21,24 @@ asn_random_fill(const struct asn_TYPE_descriptor_s *td, void **struct_ptr,
     }
 }
 
+/* xorshift32, per thread, so fills are reentrant and the same on every libc */
+static ASN_THREAD_LOCAL uint32_t asn_random_state = 2463534242u;
+
+void
+asn_random_seed(unsigned int seed) {
+    asn_random_state = seed ? seed : 2463534242u;
+}
+
+static long
+asn__random(void) {
+    uint32_t x = asn_random_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    asn_random_state = x;
+    return (long)(x >> 1);
+}
+
 static uintmax_t
 asn__intmax_range(intmax_t lb, intmax_t ub) {
     assert(lb <= ub);
@@ -55,11 +73,7 @@ asn_random_between(intmax_t lb, intmax_t rb) {
 
         for(; got_entropy < range;) {
             got_entropy = (got_entropy << 24) | max;
-#ifdef HAVE_RANDOM
-            value = (value << 24) | (random() % max);
-#else
-            value = (value << 24) | (rand() % max);
-#endif
+            value = (value << 24) | (asn__random() % max);
         }
 
         return lb + (intmax_t)(value % (range + 1));
@@ -48,4 +48,9 @@ int asn_random_fill(const struct asn_TYPE_descriptor_s *td, void **struct_ptr,
  */
 intmax_t asn_random_between(intmax_t min, intmax_t max);
 
+/*
+ * Seed the generator of the calling thread, asn_random_fill draws from it.
+ */
+void asn_random_seed(unsigned int seed);
+
 #endif	/* ASN_RANDOM_FILL */
@@ -0,0 +1,65 @@
+/*
+ * Allocation accounting for the ASN.1 support code.
+ * Not part of asn1c, copied into the generated code by tooling/asn1c.sh.
+ *
+ * With LIBSM_STATS defined, CALLOC, MALLOC, REALLOC and FREEMEM count every
+ * allocation in thread local counters, per type descriptor. An allocation is
+ * charged to the type whose UPER decoder made it, or to the type being UPER
+ * encoded. Anything else is charged to no type (type NULL).
+ * Without LIBSM_STATS the macros are plain calloc, malloc, realloc and free.
+ */
+#ifndef	ASN_STATS_H
+#define	ASN_STATS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+struct asn_TYPE_descriptor_s;	/* Forward declaration */
+
+typedef struct asn_stats_counters_s {
+	const struct asn_TYPE_descriptor_s *type;	/* NULL: no type */
+	uint64_t allocations;	/* calloc, malloc and realloc calls */
+	uint64_t frees;		/* Frees of blocks counted here */
+	uint64_t bytes;		/* Bytes requested by those calls */
+	uint64_t live_bytes;	/* Bytes allocated and not freed yet */
+	uint64_t peak_bytes;	/* Highest live_bytes */
+} asn_stats_counters_t;
+
+void *asn_stats_calloc(size_t nmemb, size_t size);
+void *asn_stats_malloc(size_t size);
+void *asn_stats_realloc(void *oldptr, size_t size);
+void asn_stats_free(void *ptr);
+
+/*
+ * Charge the following allocations of this thread to td, NULL for no type.
+ */
+void asn_stats_set_type(const struct asn_TYPE_descriptor_s *td);
+
+/*
+ * Copy the counters of this thread.
+ * total: Sum over all types.
+ * untracked_frees: FREEMEM of blocks this thread did not count, e.g.
+ *                  allocated by plain calloc or by another thread.
+ * types: Room for capacity per type counters, may be NULL.
+ * RETURN VALUES:
+ *  The number of types with counters, which may be more than capacity.
+ */
+size_t asn_stats_get(asn_stats_counters_t *total, uint64_t *untracked_frees,
+                     asn_stats_counters_t *types, size_t capacity);
+
+/*
+ * Zero the counters of this thread and forget its live blocks.
+ * Also releases the memory of the accounting itself, call it before a
+ * thread exits.
+ */
+void asn_stats_reset(void);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* ASN_STATS_H */
@@ -12,6 +12,7 @@ CHOICE_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
                    const asn_TYPE_descriptor_t *td,
                    const asn_per_constraints_t *constraints, void **sptr,
                    asn_per_data_t *pd) {
+    ASN_STATS_TYPE(td);
     const asn_CHOICE_specifics_t *specs =
         (const asn_CHOICE_specifics_t *)td->specifics;
     asn_dec_rval_t rv;
@@ -90,6 +91,7 @@ CHOICE_decode_uper(const asn_codec_ctx_t *opt_codec_ctx,
                                 memb_ptr2, pd);
     }
 
+    ASN_STATS_TYPE(td);
     if(rv.code != RC_OK)
         ASN_DEBUG("Failed to decode %s in %s (CHOICE) %d",
                   elm->name, td->name, rv.code);
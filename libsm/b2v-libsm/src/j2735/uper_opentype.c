@@ -7,6 +7,9 @@
 #include <uper_support.h>
 #include <uper_opentype.h>
 
+/* Bytes of an open type encoded without allocating */
+#define UPER_OPEN_TYPE_LOCAL 512
+
 typedef struct uper_ugot_key {
 	asn_per_data_t oldpd;	/* Old per data source */
 	size_t unclaimed;
@@ -25,19 +28,30 @@ int
 uper_open_type_put(const asn_TYPE_descriptor_t *td,
                    const asn_per_constraints_t *constraints, const void *sptr,
                    asn_per_outp_t *po) {
-    void *buf;
+    uint8_t local[UPER_OPEN_TYPE_LOCAL];
+    void *buf = 0;
     void *bptr;
     ssize_t size;
+    asn_enc_rval_t er;
 
     ASN_DEBUG("Open type put %s ...", td->name);
 
-    size = uper_encode_to_new_buffer(td, constraints, sptr, &buf);
-    if(size <= 0) return -1;
+    /* Most open types fit on the stack, only larger ones need the heap */
+    er = uper_encode_to_buffer(td, constraints, sptr, local, sizeof(local));
+    if(er.encoded > 0) {
+        size = (er.encoded + 7) >> 3;
+    } else if(er.encoded == 0) {
+        local[0] = 0;
+        size = 1;
+    } else {
+        size = uper_encode_to_new_buffer(td, constraints, sptr, &buf);
+        if(size <= 0) return -1;
+    }
 
     ASN_DEBUG("Open type put %s of length %" ASN_PRI_SSIZE " + overhead (1byte?)", td->name,
               size);
 
-    bptr = buf;
+    bptr = buf ? buf : local;
     do {
         int need_eom = 0;
         ssize_t may_save = uper_put_length(po, size, &need_eom);
@@ -60,6 +74,52 @@ uper_open_type_put(const asn_TYPE_descriptor_t *td,
     return 0;
 }
 
+/*
+ * Decode an open type of a single chunk where it is instead of copying it,
+ * so that the OCTET STRINGs borrowed from it outlive the call.
+ */
+static asn_dec_rval_t
+uper_open_type_get_inplace(const asn_codec_ctx_t *ctx,
+                           const asn_TYPE_descriptor_t *td,
+                           const asn_per_constraints_t *constraints,
+                           void **sptr, asn_per_data_t *pd, size_t bytes) {
+	asn_dec_rval_t rv;
+	asn_per_data_t spd;
+	size_t padding;
+
+	if(pd->nbits - pd->nboff < (bytes << 3))
+		ASN__DECODE_STARVED;
+
+	spd = *pd;
+	spd.nbits = pd->nboff + (bytes << 3);
+	spd.moved = 0;
+	pd->nboff += bytes << 3;
+	pd->moved += bytes << 3;
+
+	ASN_DEBUG("Getting open type %s in place, %ld bytes", td->name,
+		(long)bytes);
+
+	ASN_DEBUG_INDENT_ADD(+4);
+	rv = td->op->uper_decoder(ctx, td, constraints, sptr, &spd);
+	ASN_DEBUG_INDENT_ADD(-4);
+
+	if(rv.code != RC_OK) {
+		rv.code = RC_FAIL; /* No one would give us more */
+		return rv;
+	}
+
+	/* Check padding validity, as uper_open_type_get_simple() does */
+	padding = spd.nbits - spd.nboff;
+	if(((padding > 0 && padding < 8) || (padding == 8 && spd.moved == 0))
+	   && per_get_few_bits(&spd, padding) == 0)
+		return rv;
+	if(padding >= 8) {
+		ASN_DEBUG("Too large padding %d in open type", (int)padding);
+		ASN__DECODE_FAILED;
+	}
+	return rv;
+}
+
 static asn_dec_rval_t
 uper_open_type_get_simple(const asn_codec_ctx_t *ctx,
                           const asn_TYPE_descriptor_t *td,
@@ -84,6 +144,10 @@ uper_open_type_get_simple(const asn_codec_ctx_t *ctx,
 			FREEMEM(buf);
 			ASN__DECODE_STARVED;
 		}
+		/* Borrowed OCTET STRINGs must not point into a copy */
+		if(!bufLen && !repeat && !pd->refill && ctx && ctx->borrow_min)
+			return uper_open_type_get_inplace(ctx, td, constraints, sptr,
+			                                  pd, chunk_bytes);
 		if(bufLen + chunk_bytes > bufSize) {
 			void *ptr;
 			bufSize = chunk_bytes + (bufSize << 2);
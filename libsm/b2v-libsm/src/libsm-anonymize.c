@@ -0,0 +1,600 @@
+/**
+ * @brief Anonymization of captured UPER MessageFrames, in place
+ */
+
+#include "libsm-anonymize.h"
+#include "libsm.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+
+// ext bit, partII and regional presence, and BSMcoreData up to accuracy
+#define ANON_BSM_CORE_BITS 293
+#define ANON_BSM_CORE_BYTES ((ANON_BSM_CORE_BITS + 7) / 8)
+
+// bit offsets in a BSM, and widths, of the members that are rewritten
+#define ANON_BSM_PART_II_BIT 1
+#define ANON_BSM_MSG_CNT_BIT 3
+#define ANON_BSM_ID_BIT 10
+#define ANON_BSM_SEC_MARK_BIT 42
+#define ANON_BSM_LAT_BIT 58
+#define ANON_BSM_LONG_BIT 89
+#define ANON_BSM_ELEV_BIT 121
+
+// ext bit, 18 presence bits, basicType (0..4,...), secMark, msgCnt, id, Position3D and the
+// members up to heading when there is no elevation
+#define ANON_PSM_CORE_BITS 204
+#define ANON_PSM_CORE_BYTES ((ANON_PSM_CORE_BITS + 7) / 8)
+
+// bit offsets in a PSM whose basicType is not extended, lat and Long follow the ext bit and
+// the elevation and regional presence bits of Position3D
+#define ANON_PSM_PATH_HISTORY_BIT 2
+#define ANON_PSM_BASIC_TYPE_BIT 19
+#define ANON_PSM_SEC_MARK_BIT 23
+#define ANON_PSM_MSG_CNT_BIT 39
+#define ANON_PSM_ID_BIT 46
+#define ANON_PSM_POSITION_BIT 78
+#define ANON_PSM_LAT_BIT 81
+#define ANON_PSM_LONG_BIT 112
+#define ANON_PSM_ELEV_BIT 144
+
+#define ANON_MSG_CNT_BITS 7
+#define ANON_SEC_MARK_BITS 16
+#define ANON_LAT_BITS 31
+#define ANON_LONG_BITS 32
+#define ANON_ELEV_BITS 16
+
+// constraints, the unavailable values are the lower or upper bound
+#define ANON_LAT_MIN (-900000000L)
+#define ANON_LAT_MAX 900000000L
+#define ANON_LAT_UNAVAILABLE 900000001L
+#define ANON_LONG_MIN (-1799999999L)
+#define ANON_LONG_MAX 1800000000L
+#define ANON_LONG_UNAVAILABLE 1800000001L
+#define ANON_ELEV_MIN (-4095L)
+#define ANON_ELEV_MAX 61439L
+#define ANON_ELEV_UNAVAILABLE (-4096L)
+#define ANON_SEC_MARK_MAX 59999L
+
+// first byte of the hashed values, so a pseudonym tells nothing of a jitter, the
+// msgCnt goes in the low seven bits of the jitter one
+#define ANON_DOMAIN_ID 0x00
+#define ANON_DOMAIN_JITTER 0x80
+
+typedef enum {
+    ANON_UNTOUCHED,
+    ANON_PATCHED,
+    ANON_REENCODED,
+} anon_outcome_e;
+
+typedef struct {
+    libsm_anonymize_t const* anon;
+    uint8_t* data;
+    size_t const* offsets;
+    size_t* lens;
+    libsm_rval_e* results;
+    size_t first;
+    size_t count;
+    libsm_anonymize_stats_t stats;
+} anon_run_t;
+
+
+static inline uint64_t anon_rotl(uint64_t x, unsigned b)
+{
+    return (x << b) | (x >> (64 - b));
+}
+
+
+static inline uint64_t anon_le64(uint8_t const* p)
+{
+    uint64_t v = 0;
+    for (int i = 7; i >= 0; i--) {
+        v = (v << 8) | p[i];
+    }
+    return v;
+}
+
+
+#define ANON_SIPROUND(v0, v1, v2, v3) \
+    do {                              \
+        v0 += v1;                     \
+        v1 = anon_rotl(v1, 13);       \
+        v1 ^= v0;                     \
+        v0 = anon_rotl(v0, 32);       \
+        v2 += v3;                     \
+        v3 = anon_rotl(v3, 16);       \
+        v3 ^= v2;                     \
+        v0 += v3;                     \
+        v3 = anon_rotl(v3, 21);       \
+        v3 ^= v0;                     \
+        v2 += v1;                     \
+        v1 = anon_rotl(v1, 17);       \
+        v1 ^= v2;                     \
+        v2 = anon_rotl(v2, 32);       \
+    } while (0)
+
+
+// SipHash-2-4 of a message of less than eight bytes
+static uint64_t anon_siphash(uint8_t const key[LIBSM_ANONYMIZE_KEY_SIZE],
+                             uint8_t const* in,
+                             size_t len)
+{
+    uint64_t const k0 = anon_le64(key);
+    uint64_t const k1 = anon_le64(key + 8);
+    uint64_t v0 = k0 ^ 0x736f6d6570736575ULL;
+    uint64_t v1 = k1 ^ 0x646f72616e646f6dULL;
+    uint64_t v2 = k0 ^ 0x6c7967656e657261ULL;
+    uint64_t v3 = k1 ^ 0x7465646279746573ULL;
+
+    uint64_t m = (uint64_t)len << 56;
+    for (size_t i = 0; i < len; i++) {
+        m |= (uint64_t)in[i] << (8 * i);
+    }
+    v3 ^= m;
+    ANON_SIPROUND(v0, v1, v2, v3);
+    ANON_SIPROUND(v0, v1, v2, v3);
+    v0 ^= m;
+    v2 ^= 0xff;
+    for (int i = 0; i < 4; i++) {
+        ANON_SIPROUND(v0, v1, v2, v3);
+    }
+    return v0 ^ v1 ^ v2 ^ v3;
+}
+
+
+static inline long anon_clamp(long v, long lo, long hi)
+{
+    return v < lo ? lo : v > hi ? hi : v;
+}
+
+
+static inline long anon_round(long v, long grid)
+{
+    if (grid <= 1) {
+        return v;
+    }
+    return v >= 0 ? (v + grid / 2) / grid * grid : -((-v + grid / 2) / grid * grid);
+}
+
+
+static inline long anon_jitter(uint64_t h, long jitter)
+{
+    return jitter > 0 ? (long)(h % (uint64_t)(2 * jitter + 1)) - jitter : 0;
+}
+
+
+/*
+ * Rewrites the members common to BSMs and PSMs. The jitter is keyed by the
+ * original id, msgCnt and secMark, so it changes from message to message but
+ * is the same for a message and its repetitions
+ */
+static void anon_rewrite(libsm_anonymize_t const* anon,
+                         long msgCnt,
+                         uint8_t id[4],
+                         long* secMark,
+                         long* lat,
+                         long* Long,
+                         long* elev)
+{
+    uint8_t const salt[7] = { (uint8_t)(ANON_DOMAIN_JITTER | msgCnt), id[0], id[1], id[2], id[3],
+                              (uint8_t)(*secMark >> 8), (uint8_t)*secMark };
+    uint64_t const h = anon->positionJitter > 0 ? anon_siphash(anon->key, salt, sizeof(salt)) : 0;
+
+    if (*lat != ANON_LAT_UNAVAILABLE) {
+        long const v = anon_round(*lat, anon->positionGrid) + anon_jitter(h, anon->positionJitter);
+        *lat = anon_clamp(v, ANON_LAT_MIN, ANON_LAT_MAX);
+    }
+    if (*Long != ANON_LONG_UNAVAILABLE) {
+        long const v = anon_round(*Long, anon->positionGrid)
+                       + anon_jitter(h >> 32, anon->positionJitter);
+        *Long = anon_clamp(v, ANON_LONG_MIN, ANON_LONG_MAX);
+    }
+    if (elev != NULL && *elev != ANON_ELEV_UNAVAILABLE) {
+        *elev = anon_clamp(anon_round(*elev, anon->elevationGrid), ANON_ELEV_MIN, ANON_ELEV_MAX);
+    }
+    if (*secMark <= ANON_SEC_MARK_MAX && anon->secMarkGrid > 1) {
+        *secMark -= *secMark % anon->secMarkGrid;
+    }
+    if (anon->pseudonymizeId) {
+        uint8_t const in[5] = { ANON_DOMAIN_ID, id[0], id[1], id[2], id[3] };
+        uint64_t const p = anon_siphash(anon->key, in, sizeof(in));
+        for (int i = 0; i < 4; i++) {
+            id[i] = (uint8_t)(p >> (8 * i));
+        }
+    }
+}
+
+
+// bits at a bit offset, at most 32 and never across more than five bytes
+static inline uint32_t anon_get_bits(uint8_t const* buf, size_t offset, unsigned bits)
+{
+    uint8_t const* p = buf + offset / 8;
+    uint64_t w = 0;
+    for (int i = 0; i < 5; i++) {
+        w = (w << 8) | p[i];
+    }
+    return (uint32_t)((w >> (40 - offset % 8 - bits)) & ((1ULL << bits) - 1));
+}
+
+
+static inline void anon_put_bits(uint8_t* buf, size_t offset, unsigned bits, uint32_t value)
+{
+    uint8_t* p = buf + offset / 8;
+    uint64_t w = 0;
+    for (int i = 0; i < 5; i++) {
+        w = (w << 8) | p[i];
+    }
+    unsigned const shift = 40 - offset % 8 - bits;
+    uint64_t const mask = ((1ULL << bits) - 1) << shift;
+    w = (w & ~mask) | ((uint64_t)value << shift);
+    for (int i = 4; i >= 0; i--) {
+        p[i] = (uint8_t)w;
+        w >>= 8;
+    }
+}
+
+
+/*
+ * The BSM or PSM inside a MessageFrame of one, and its length, or NULL when the
+ * skim can not rewrite it: a fragmented length, too short, or extended
+ */
+static uint8_t* anon_skim(uint8_t* encoded, size_t len, size_t* length)
+{
+    size_t header = 3;
+    *length = encoded[2];
+    if (encoded[2] & 0x80) {
+        if ((encoded[2] & 0x40) || len < 4) {
+            return NULL;
+        }
+        header = 4;
+        *length = (size_t)(encoded[2] & 0x3F) << 8 | encoded[3];
+    }
+    uint8_t* value = encoded + header;
+    if (*length == 0 || len - header < *length || (value[0] & 0x80)) {
+        return NULL;
+    }
+    return value;
+}
+
+
+static inline bool anon_bit(uint8_t const* buf, size_t offset)
+{
+    return buf[offset / 8] & (0x80 >> offset % 8);
+}
+
+
+static inline void anon_get_id(uint8_t const* buf, size_t offset, uint8_t id[4])
+{
+    uint32_t const raw = anon_get_bits(buf, offset, 32);
+    for (int i = 0; i < 4; i++) {
+        id[i] = (uint8_t)(raw >> (24 - 8 * i));
+    }
+}
+
+
+static inline void anon_put_id(uint8_t* buf, size_t offset, uint8_t const id[4])
+{
+    anon_put_bits(buf, offset, 32,
+                  (uint32_t)id[0] << 24 | (uint32_t)id[1] << 16 | (uint32_t)id[2] << 8 | id[3]);
+}
+
+
+// false when lat or Long is outside its constraint
+static inline bool anon_get_position(uint8_t const* buf,
+                                     size_t latBit,
+                                     size_t longBit,
+                                     long* lat,
+                                     long* Long)
+{
+    uint32_t const latRaw = anon_get_bits(buf, latBit, ANON_LAT_BITS);
+    uint32_t const longRaw = anon_get_bits(buf, longBit, ANON_LONG_BITS);
+    if (latRaw > ANON_LAT_UNAVAILABLE - ANON_LAT_MIN
+        || longRaw > (uint32_t)(ANON_LONG_UNAVAILABLE - ANON_LONG_MIN)) {
+        return false;
+    }
+    *lat = (long)latRaw + ANON_LAT_MIN;
+    *Long = (long)longRaw + ANON_LONG_MIN;
+    return true;
+}
+
+
+// false when the BSM has to be decoded, and it is left alone
+static bool anon_patch_bsm(libsm_anonymize_t const* anon, uint8_t* bsm, size_t length)
+{
+    long lat;
+    long Long;
+    if (length < ANON_BSM_CORE_BYTES
+        || (anon->dropPathHistory && anon_bit(bsm, ANON_BSM_PART_II_BIT))
+        || !anon_get_position(bsm, ANON_BSM_LAT_BIT, ANON_BSM_LONG_BIT, &lat, &Long)) {
+        return false;
+    }
+    long const msgCnt = anon_get_bits(bsm, ANON_BSM_MSG_CNT_BIT, ANON_MSG_CNT_BITS);
+    uint8_t id[4];
+    anon_get_id(bsm, ANON_BSM_ID_BIT, id);
+    long secMark = anon_get_bits(bsm, ANON_BSM_SEC_MARK_BIT, ANON_SEC_MARK_BITS);
+    long elev = (long)anon_get_bits(bsm, ANON_BSM_ELEV_BIT, ANON_ELEV_BITS) + ANON_ELEV_UNAVAILABLE;
+
+    anon_rewrite(anon, msgCnt, id, &secMark, &lat, &Long, &elev);
+
+    anon_put_id(bsm, ANON_BSM_ID_BIT, id);
+    anon_put_bits(bsm, ANON_BSM_SEC_MARK_BIT, ANON_SEC_MARK_BITS, (uint32_t)secMark);
+    anon_put_bits(bsm, ANON_BSM_LAT_BIT, ANON_LAT_BITS, (uint32_t)(lat - ANON_LAT_MIN));
+    anon_put_bits(bsm, ANON_BSM_LONG_BIT, ANON_LONG_BITS, (uint32_t)(Long - ANON_LONG_MIN));
+    anon_put_bits(bsm, ANON_BSM_ELEV_BIT, ANON_ELEV_BITS, (uint32_t)(elev - ANON_ELEV_UNAVAILABLE));
+    return true;
+}
+
+
+/*
+ * false when the PSM has to be decoded, and it is left alone. An extended basicType has a
+ * variable length and moves everything after it, an extended Position3D may carry additions
+ * that a re-encode would drop
+ */
+static bool anon_patch_psm(libsm_anonymize_t const* anon, uint8_t* psm, size_t length)
+{
+    long lat;
+    long Long;
+    if (length < ANON_PSM_CORE_BYTES || anon_bit(psm, ANON_PSM_BASIC_TYPE_BIT)
+        || anon_bit(psm, ANON_PSM_POSITION_BIT)
+        || (anon->dropPathHistory && anon_bit(psm, ANON_PSM_PATH_HISTORY_BIT))
+        || !anon_get_position(psm, ANON_PSM_LAT_BIT, ANON_PSM_LONG_BIT, &lat, &Long)) {
+        return false;
+    }
+    long const msgCnt = anon_get_bits(psm, ANON_PSM_MSG_CNT_BIT, ANON_MSG_CNT_BITS);
+    uint8_t id[4];
+    anon_get_id(psm, ANON_PSM_ID_BIT, id);
+    long secMark = anon_get_bits(psm, ANON_PSM_SEC_MARK_BIT, ANON_SEC_MARK_BITS);
+    bool const hasElev = anon_bit(psm, ANON_PSM_POSITION_BIT + 1);
+    long elev = hasElev ? (long)anon_get_bits(psm, ANON_PSM_ELEV_BIT, ANON_ELEV_BITS)
+                                  + ANON_ELEV_UNAVAILABLE
+                        : 0;
+
+    anon_rewrite(anon, msgCnt, id, &secMark, &lat, &Long, hasElev ? &elev : NULL);
+
+    anon_put_id(psm, ANON_PSM_ID_BIT, id);
+    anon_put_bits(psm, ANON_PSM_SEC_MARK_BIT, ANON_SEC_MARK_BITS, (uint32_t)secMark);
+    anon_put_bits(psm, ANON_PSM_LAT_BIT, ANON_LAT_BITS, (uint32_t)(lat - ANON_LAT_MIN));
+    anon_put_bits(psm, ANON_PSM_LONG_BIT, ANON_LONG_BITS, (uint32_t)(Long - ANON_LONG_MIN));
+    if (hasElev) {
+        anon_put_bits(psm, ANON_PSM_ELEV_BIT, ANON_ELEV_BITS,
+                      (uint32_t)(elev - ANON_ELEV_UNAVAILABLE));
+    }
+    return true;
+}
+
+
+static void anon_drop_part_ii_path_history(BasicSafetyMessage_t* bsm)
+{
+    if (bsm->partII == NULL) {
+        return;
+    }
+    for (int i = 0; i < bsm->partII->list.count; i++) {
+        BSMpartIIExtension_t* ext = bsm->partII->list.array[i];
+        struct BSMpartIIExtension__partII_Value* value = &ext->partII_Value;
+        if (value->present == BSMpartIIExtension__partII_Value_PR_VehicleSafetyExtensions) {
+            VehicleSafetyExtensions_t* vse = &value->choice.VehicleSafetyExtensions;
+            ASN_STRUCT_FREE(asn_DEF_PathHistory, vse->pathHistory);
+            vse->pathHistory = NULL;
+        }
+    }
+}
+
+
+static libsm_rval_e anon_reencode(libsm_anonymize_t const* anon, uint8_t* encoded, size_t* len)
+{
+    MessageFrame_t mf = { 0 };
+    if (libsm_uper_fast_decode_messageframe(encoded, *len, &mf) != LIBSM_OK) {
+        ASN_STRUCT_RESET(asn_DEF_MessageFrame, &mf);
+        return LIBSM_FAIL_DECODING;
+    }
+
+    if (mf.value.present == MessageFrame__value_PR_BasicSafetyMessage) {
+        BasicSafetyMessage_t* bsm = &mf.value.choice.BasicSafetyMessage;
+        BSMcoreData_t* core = &bsm->coreData;
+        anon_rewrite(anon, core->msgCnt, core->id.buf, &core->secMark, &core->lat, &core->Long,
+                     &core->elev);
+        if (anon->dropPathHistory) {
+            anon_drop_part_ii_path_history(bsm);
+        }
+    } else if (mf.value.present == MessageFrame__value_PR_PersonalSafetyMessage) {
+        PersonalSafetyMessage_t* psm = &mf.value.choice.PersonalSafetyMessage;
+        anon_rewrite(anon, psm->msgCnt, psm->id.buf, &psm->secMark, &psm->position.lat,
+                     &psm->position.Long, psm->position.elevation);
+        if (anon->dropPathHistory) {
+            ASN_STRUCT_FREE(asn_DEF_PathHistory, psm->pathHistory);
+            psm->pathHistory = NULL;
+        }
+    }
+
+    // encoded is only overwritten once the new frame is whole
+    uint8_t* out = malloc(*len);
+    if (out == NULL) {
+        ASN_STRUCT_RESET(asn_DEF_MessageFrame, &mf);
+        return LIBSM_ALLOC_ERR;
+    }
+    size_t outLen = *len;
+    libsm_rval_e const rval = libsm_uper_fast_encode_messageframe(&mf, out, &outLen);
+    ASN_STRUCT_RESET(asn_DEF_MessageFrame, &mf);
+    if (rval != LIBSM_OK) {
+        free(out);
+        return LIBSM_FAIL_ENCODING;
+    }
+    memcpy(encoded, out, outLen);
+    *len = outLen;
+    free(out);
+    return LIBSM_OK;
+}
+
+
+static libsm_rval_e anon_frame(libsm_anonymize_t const* anon,
+                               uint8_t* encoded,
+                               size_t* len,
+                               anon_outcome_e* outcome)
+{
+    *outcome = ANON_UNTOUCHED;
+    if (*len < 3 || (encoded[0] & 0x80)) {
+        return LIBSM_FAIL_DECODING;
+    }
+    long const messageId = (encoded[0] & 0x7F) << 8 | encoded[1];
+    if (messageId != DSRCmsgID_basicSafetyMessage && messageId != DSRCmsgID_personalSafetyMessage) {
+        return LIBSM_OK;
+    }
+
+    size_t length;
+    uint8_t* value = anon_skim(encoded, *len, &length);
+    if (value != NULL
+        && (messageId == DSRCmsgID_basicSafetyMessage ? anon_patch_bsm(anon, value, length)
+                                                      : anon_patch_psm(anon, value, length))) {
+        *outcome = ANON_PATCHED;
+        return LIBSM_OK;
+    }
+
+    libsm_rval_e const rval = anon_reencode(anon, encoded, len);
+    if (rval == LIBSM_OK) {
+        *outcome = ANON_REENCODED;
+    }
+    return rval;
+}
+
+
+static libsm_rval_e anon_check(libsm_anonymize_t const* anon)
+{
+    if (anon->positionGrid < 0 || anon->positionJitter < 0 || anon->elevationGrid < 0
+        || anon->secMarkGrid < 0 || anon->positionJitter > ANON_LAT_MAX) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    return LIBSM_OK;
+}
+
+
+static void* anon_run(void* arg)
+{
+    anon_run_t* run = arg;
+    for (size_t i = run->first; i < run->first + run->count; i++) {
+        anon_outcome_e outcome;
+        libsm_rval_e const rval
+                = anon_frame(run->anon, run->data + run->offsets[i], &run->lens[i], &outcome);
+        if (run->results != NULL) {
+            run->results[i] = rval;
+        }
+        if (rval != LIBSM_OK) {
+            run->stats.failed++;
+        } else if (outcome == ANON_PATCHED) {
+            run->stats.patched++;
+        } else if (outcome == ANON_REENCODED) {
+            run->stats.reencoded++;
+        } else {
+            run->stats.untouched++;
+        }
+    }
+    return NULL;
+}
+
+
+libsm_rval_e libsm_anonymize_default(libsm_anonymize_t* anon)
+{
+    if (anon == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    memset(anon, 0, sizeof(*anon));
+    anon->pseudonymizeId = true;
+    anon->positionGrid = 10000;
+    anon->elevationGrid = 100;
+    anon->secMarkGrid = 1000;
+    anon->dropPathHistory = true;
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_anonymize_frame(libsm_anonymize_t const* anon, uint8_t* encoded, size_t* len)
+{
+    if (anon == NULL || encoded == NULL || len == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    libsm_rval_e const rval = anon_check(anon);
+    if (rval != LIBSM_OK) {
+        return rval;
+    }
+    anon_outcome_e outcome;
+    return anon_frame(anon, encoded, len, &outcome);
+}
+
+
+libsm_rval_e libsm_anonymize_batch(libsm_anonymize_t const* anon,
+                                   uint8_t* data,
+                                   size_t const* offsets,
+                                   size_t* lens,
+                                   libsm_rval_e* results,
+                                   size_t count,
+                                   unsigned threads,
+                                   libsm_anonymize_stats_t* stats)
+{
+    if (anon == NULL || data == NULL || offsets == NULL || lens == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    libsm_rval_e const rval = anon_check(anon);
+    if (rval != LIBSM_OK) {
+        return rval;
+    }
+    if (threads == 0) {
+        long const cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = cpus > 0 ? (unsigned)cpus : 1;
+    }
+    if (threads > count) {
+        threads = count > 0 ? (unsigned)count : 1;
+    }
+
+    anon_run_t* runs = calloc(threads, sizeof(anon_run_t));
+    pthread_t* ids = calloc(threads, sizeof(pthread_t));
+    bool* started = calloc(threads, sizeof(bool));
+    if (runs == NULL || ids == NULL || started == NULL) {
+        free(runs);
+        free(ids);
+        free(started);
+        return LIBSM_ALLOC_ERR;
+    }
+
+    // the first count % threads runs take one frame more
+    size_t first = 0;
+    for (unsigned t = 0; t < threads; t++) {
+        anon_run_t* run = &runs[t];
+        run->anon = anon;
+        run->data = data;
+        run->offsets = offsets;
+        run->lens = lens;
+        run->results = results;
+        run->first = first;
+        run->count = count / threads + (t < count % threads);
+        first += run->count;
+    }
+    // the calling thread takes the last run, and those no thread was started for
+    for (unsigned t = 0; t + 1 < threads; t++) {
+        started[t] = pthread_create(&ids[t], NULL, anon_run, &runs[t]) == 0;
+    }
+    for (unsigned t = 0; t < threads; t++) {
+        if (t + 1 == threads || !started[t]) {
+            anon_run(&runs[t]);
+        }
+    }
+
+    libsm_anonymize_stats_t total = { 0 };
+    for (unsigned t = 0; t < threads; t++) {
+        if (started[t]) {
+            pthread_join(ids[t], NULL);
+        }
+        total.patched += runs[t].stats.patched;
+        total.reencoded += runs[t].stats.reencoded;
+        total.untouched += runs[t].stats.untouched;
+        total.failed += runs[t].stats.failed;
+    }
+    free(runs);
+    free(ids);
+    free(started);
+    if (stats != NULL) {
+        *stats = total;
+    }
+    return total.failed > 0 ? LIBSM_FAIL : LIBSM_OK;
+}
@@ -0,0 +1,121 @@
+/**
+ * @brief Anonymization of captured UPER MessageFrames, in place
+ *
+ * Before a capture is published the TemporaryIDs are replaced by pseudonyms,
+ * positions, elevations and times are coarsened, and path histories can be
+ * dropped. The pseudonym of an id, and the jitter added to a position, are
+ * keyed hashes (SipHash-2-4) of the original values under a secret key: the
+ * same key gives the same output for the same capture, and without it the
+ * original ids can not be recovered.
+ *
+ * A BSM or a PSM is not decoded. A skim of its header finds the members that
+ * are rewritten, which all sit at fixed bit offsets: in BSMcoreData before
+ * accuracy, and in a PSM whose basicType is not extended up to Position3D.
+ * id, secMark, lat, Long and elevation are patched in the UPER bytes, so the
+ * frame keeps its size. Only removing the path history of a BSM with a Part II
+ * or of a PSM with one, and a frame the skim can not read (an extension, a
+ * value outside its constraint) are decoded, rewritten and encoded again, and
+ * may get shorter. Other messages carry nothing of a vehicle or a person and
+ * are left as they are.
+ *
+ * Values that are unavailable stay unavailable, and every rewritten value
+ * stays within its J2735 constraint. Grids and jitter are in the units of the
+ * fields: 1/10 micro degree for positions, 10 cm for elevations, ms for secMarks.
+ */
+
+#ifndef LIBSM_ANONYMIZE_H
+#define LIBSM_ANONYMIZE_H
+
+#include "libsm-error.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/** @brief Bytes of the secret key of the pseudonyms */
+#define LIBSM_ANONYMIZE_KEY_SIZE 16
+
+/** @brief What to rewrite */
+typedef struct {
+    uint8_t key[LIBSM_ANONYMIZE_KEY_SIZE]; /**< @brief secret of pseudonyms and jitter */
+    bool pseudonymizeId;                   /**< @brief replace TemporaryIDs by pseudonyms */
+    long positionGrid;    /**< @brief lat and Long to the nearest multiple, 0 keeps them */
+    long positionJitter;  /**< @brief then up to this much either way, 0 for none */
+    long elevationGrid;   /**< @brief elevations to the nearest multiple, 0 keeps them */
+    long secMarkGrid;     /**< @brief secMarks down to a multiple, 0 keeps them */
+    bool dropPathHistory; /**< @brief remove the path histories of BSMs and PSMs */
+} libsm_anonymize_t;
+
+/** @brief What happened to the frames of a batch */
+typedef struct {
+    uint64_t patched;   /**< @brief BSMs and PSMs rewritten in place */
+    uint64_t reencoded; /**< @brief frames decoded, rewritten and encoded again */
+    uint64_t untouched; /**< @brief frames of other types */
+    uint64_t failed;    /**< @brief frames that did not decode or encode */
+} libsm_anonymize_stats_t;
+
+
+/**
+ * @brief Set the default policy
+ *
+ * Pseudonymized ids, positions to 0.001 degree (about 110 m), elevations to
+ * 10 m, secMarks to the second, and no path histories. The key is all zero,
+ * set a secret one.
+ *
+ * @param anon The policy to initialize
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG anon was NULL
+ */
+libsm_rval_e libsm_anonymize_default(libsm_anonymize_t* anon);
+
+
+/**
+ * @brief Anonymize one frame
+ *
+ * @param anon The policy
+ * @param encoded The UPER MessageFrame, rewritten
+ * @param len In its size, out its size after, never more
+ *
+ * @retval LIBSM_OK Operation successful, also for frames of other types
+ * @retval LIBSM_FAIL_NULL_ARG An argument was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER A grid or the jitter is negative, or the jitter more
+ *         than 90 degrees
+ * @retval LIBSM_FAIL_DECODING The frame did not decode, it is left as it was
+ * @retval LIBSM_FAIL_ENCODING The frame did not encode again, it is left as it was
+ */
+libsm_rval_e libsm_anonymize_frame(libsm_anonymize_t const* anon, uint8_t* encoded, size_t* len);
+
+
+/**
+ * @brief Anonymize a batch of frames on several threads
+ *
+ * Frame i is lens[i] bytes at data + offsets[i]. The batch is cut into one run
+ * of frames per thread, the calling thread takes one of them.
+ *
+ * @param anon The policy
+ * @param data The frames, rewritten
+ * @param offsets Where each frame starts in data
+ * @param lens In the size of each frame, out its size after
+ * @param results Out the result of libsm_anonymize_frame for each frame, or NULL
+ * @param count Frames in the batch
+ * @param threads Threads to use, 0 for one per online cpu
+ * @param stats Out what happened to the frames, or NULL
+ *
+ * @retval LIBSM_OK Every frame was anonymized
+ * @retval LIBSM_FAIL_NULL_ARG anon, data, offsets or lens was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER As for libsm_anonymize_frame
+ * @retval LIBSM_FAIL Some frames failed, see results
+ */
+libsm_rval_e libsm_anonymize_batch(libsm_anonymize_t const* anon,
+                                   uint8_t* data,
+                                   size_t const* offsets,
+                                   size_t* lens,
+                                   libsm_rval_e* results,
+                                   size_t count,
+                                   unsigned threads,
+                                   libsm_anonymize_stats_t* stats);
+
+
+#endif // LIBSM_ANONYMIZE_H
@@ -0,0 +1,451 @@
+/**
+ * @brief VRU to vehicle conflict detection over PSM and BSM reports
+ */
+
+#include "libsm-conflict.h"
+#include "j2735-defines.h"
+#include "libsm-hash.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#define CONFLICT_SPEED_UNIT     0.02   // m/s per Speed_t and Velocity_t unit
+#define CONFLICT_HEADING_UNIT   0.0125 // degrees per Heading_t unit
+
+
+struct libsm_conflict_actor {
+    uint64_t key;
+    bool inUse;
+    bool vru;
+    uint32_t id;
+    uint64_t timeMs; /**< @brief time of the report */
+    double state[4]; /**< @brief east, north, velocity east, velocity north at timeMs */
+
+    // filled in by every step
+    double stepState[4];
+    int64_t cellX;
+    int64_t cellY;
+    int32_t nextInCell;
+};
+
+
+// a VRU/vehicle pair reported within repeatMs
+struct libsm_conflict_recent {
+    uint64_t key; /**< @brief VRU id in the high half, vehicle id in the low half */
+    bool inUse;
+    uint64_t eventMs;
+};
+
+
+void libsm_conflict_default_config(libsm_conflict_config_t* config,
+                                   Latitude_t refLat,
+                                   Longitude_t refLong)
+{
+    if (config == NULL) {
+        return;
+    }
+    config->refLat = refLat;
+    config->refLong = refLong;
+    config->maxActors = 4096;
+    config->cellSizeM = 10.0;
+    config->searchRadiusM = 50.0;
+    config->collisionRadiusM = 1.5;
+    config->horizonS = 5.0;
+    config->ttcThresholdS = 3.0;
+    config->petThresholdS = 2.0;
+    config->actorTimeoutMs = 2000;
+    config->repeatMs = 1000;
+    config->maxPairChecks = 0;
+}
+
+
+libsm_rval_e libsm_conflict_init(libsm_conflict_t* eng,
+                                 libsm_conflict_config_t const* config,
+                                 libsm_conflict_emit_f emit,
+                                 void* user)
+{
+    if (eng == NULL || config == NULL || emit == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    *eng = (libsm_conflict_t){ 0 };
+    if (config->maxActors == 0 || config->maxActors > INT32_MAX || !(config->cellSizeM > 0)
+        || !(config->searchRadiusM > 0) || !(config->collisionRadiusM > 0)
+        || !(config->horizonS > 0)) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    eng->config = *config;
+    eng->emit = emit;
+    eng->user = user;
+    eng->metersPerLat = Latitude_m_per_unit;
+    eng->metersPerLong = Latitude_m_per_unit
+                         * cos((double)config->refLat / Latitude_unit_deg * (M_PI / 180.0));
+
+    size_t const tableSize = libsm_index_size(config->maxActors);
+    eng->indexMask = tableSize - 1;
+    eng->cellMask = tableSize - 1;
+
+    eng->actors = calloc(config->maxActors, sizeof(libsm_conflict_actor_t));
+    eng->freeList = malloc(config->maxActors * sizeof(int32_t));
+    eng->index = libsm_index_alloc(tableSize);
+    eng->cells = malloc(tableSize * sizeof(int32_t));
+    eng->recent = calloc(config->maxActors, sizeof(libsm_conflict_recent_t));
+    eng->recentFreeList = malloc(config->maxActors * sizeof(int32_t));
+    eng->recentIndex = libsm_index_alloc(tableSize);
+    if (eng->actors == NULL || eng->freeList == NULL || eng->index == NULL || eng->cells == NULL
+        || eng->recent == NULL || eng->recentFreeList == NULL || eng->recentIndex == NULL) {
+        libsm_conflict_free(eng);
+        return LIBSM_ALLOC_ERR;
+    }
+    for (size_t i = 0; i < config->maxActors; i++) {
+        eng->freeList[i] = (int32_t)(config->maxActors - 1 - i);
+        eng->recentFreeList[i] = (int32_t)(config->maxActors - 1 - i);
+    }
+    eng->freeCount = config->maxActors;
+    eng->recentFreeCount = config->maxActors;
+    return LIBSM_OK;
+}
+
+
+void libsm_conflict_free(libsm_conflict_t* eng)
+{
+    if (eng == NULL) {
+        return;
+    }
+    free(eng->actors);
+    free(eng->freeList);
+    free(eng->index);
+    free(eng->cells);
+    free(eng->recent);
+    free(eng->recentFreeList);
+    free(eng->recentIndex);
+    eng->actors = NULL;
+    eng->freeList = NULL;
+    eng->index = NULL;
+    eng->cells = NULL;
+    eng->recent = NULL;
+    eng->recentFreeList = NULL;
+    eng->recentIndex = NULL;
+}
+
+
+void libsm_conflict_to_local(libsm_conflict_t const* eng,
+                             Latitude_t lat,
+                             Longitude_t Long,
+                             double* east,
+                             double* north)
+{
+    *east = (double)(Long - eng->config.refLong) * eng->metersPerLong;
+    *north = (double)(lat - eng->config.refLat) * eng->metersPerLat;
+}
+
+
+static uint64_t conflict_actor_key(void const* actors, int32_t i)
+{
+    return ((libsm_conflict_actor_t const*)actors)[i].key;
+}
+
+
+// index slot holding key, or the empty slot where it would go
+static size_t conflict_lookup(libsm_conflict_t const* eng, uint64_t key)
+{
+    return libsm_index_find(eng->index, eng->indexMask, key, conflict_actor_key, eng->actors);
+}
+
+
+static void conflict_remove(libsm_conflict_t* eng, libsm_conflict_actor_t* actor)
+{
+    libsm_index_remove(eng->index, eng->indexMask, conflict_lookup(eng, actor->key),
+                       conflict_actor_key, eng->actors);
+    actor->inUse = false;
+    eng->freeList[eng->freeCount++] = (int32_t)(actor - eng->actors);
+}
+
+
+static uint64_t conflict_recent_key(void const* recent, int32_t i)
+{
+    return ((libsm_conflict_recent_t const*)recent)[i].key;
+}
+
+
+static void conflict_recent_remove(libsm_conflict_t* eng, libsm_conflict_recent_t* recent)
+{
+    size_t const slot = libsm_index_find(eng->recentIndex, eng->indexMask, recent->key,
+                                         conflict_recent_key, eng->recent);
+    libsm_index_remove(eng->recentIndex, eng->indexMask, slot, conflict_recent_key, eng->recent);
+    recent->inUse = false;
+    eng->recentFreeList[eng->recentFreeCount++] = (int32_t)(recent - eng->recent);
+}
+
+
+// false when the pair was already reported within repeatMs, otherwise remembers it
+static bool conflict_recent_claim(libsm_conflict_t* eng, uint32_t vruId, uint32_t vehicleId,
+                                  uint64_t nowMs)
+{
+    if (eng->config.repeatMs == 0) {
+        return true;
+    }
+    uint64_t const key = ((uint64_t)vruId << 32) | vehicleId;
+    size_t const slot = libsm_index_find(eng->recentIndex, eng->indexMask, key,
+                                         conflict_recent_key, eng->recent);
+    if (eng->recentIndex[slot] >= 0) {
+        libsm_conflict_recent_t* recent = &eng->recent[eng->recentIndex[slot]];
+        if (nowMs >= recent->eventMs && nowMs - recent->eventMs < eng->config.repeatMs) {
+            return false;
+        }
+        recent->eventMs = nowMs;
+        return true;
+    }
+    // all slots taken by pairs within repeatMs, report without remembering
+    if (eng->recentFreeCount == 0) {
+        return true;
+    }
+    int32_t const index = eng->recentFreeList[--eng->recentFreeCount];
+    eng->recent[index] = (libsm_conflict_recent_t){
+        .key = key,
+        .inUse = true,
+        .eventMs = nowMs,
+    };
+    eng->recentIndex[slot] = index;
+    return true;
+}
+
+
+libsm_rval_e libsm_conflict_update(libsm_conflict_t* eng, libsm_traj_sample_t const* sample)
+{
+    if (eng == NULL || sample == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (sample->lat < Latitude_min || sample->lat > Latitude_max || sample->Long < Longitude_min
+        || sample->Long > Longitude_max) {
+        return LIBSM_OK;
+    }
+
+    uint64_t const key = ((uint64_t)sample->source << 32) | sample->id;
+    uint64_t const timeMs = libsm_traj_sample_time(sample);
+    size_t const slot = conflict_lookup(eng, key);
+    libsm_conflict_actor_t* actor;
+
+    if (eng->index[slot] >= 0) {
+        actor = &eng->actors[eng->index[slot]];
+        if (timeMs < actor->timeMs) {
+            return LIBSM_OK;
+        }
+    } else {
+        if (eng->freeCount == 0) {
+            eng->stats.dropped++;
+            return LIBSM_OK;
+        }
+        int32_t const index = eng->freeList[--eng->freeCount];
+        actor = &eng->actors[index];
+        *actor = (libsm_conflict_actor_t){
+            .key = key,
+            .inUse = true,
+            .vru = sample->source == LIBSM_TRAJ_SOURCE_PSM,
+            .id = sample->id,
+        };
+        eng->index[slot] = index;
+    }
+    eng->stats.updates++;
+
+    double speed = 0.0;
+    double heading = 0.0;
+    // Speed_unavailable and Velocity_unavailable are both 8191
+    if (sample->speed != Velocity_unavailable && sample->heading != Heading_unavailable) {
+        speed = sample->speed * CONFLICT_SPEED_UNIT;
+        heading = sample->heading * CONFLICT_HEADING_UNIT * (M_PI / 180.0);
+    }
+    actor->timeMs = timeMs;
+    libsm_conflict_to_local(eng, sample->lat, sample->Long, &actor->state[0], &actor->state[1]);
+    // heading is clockwise from north
+    actor->state[2] = speed * sin(heading);
+    actor->state[3] = speed * cos(heading);
+    return LIBSM_OK;
+}
+
+
+void libsm_conflict_pair(libsm_conflict_config_t const* config,
+                         double const a[4],
+                         double const b[4],
+                         double* ttcS,
+                         double* petS)
+{
+    double const px = b[0] - a[0];
+    double const py = b[1] - a[1];
+    double const vx = b[2] - a[2];
+    double const vy = b[3] - a[3];
+    double const radius = config->collisionRadiusM;
+    double const c = px * px + py * py - radius * radius;
+
+    // first time |p + v t| <= radius
+    *ttcS = -1.0;
+    if (c <= 0) {
+        *ttcS = 0.0;
+    } else {
+        double const vv = vx * vx + vy * vy;
+        double const pv = px * vx + py * vy;
+        double const discriminant = pv * pv - vv * c;
+        if (vv > 0 && pv < 0 && discriminant >= 0) {
+            double const t = (-pv - sqrt(discriminant)) / vv;
+            if (t <= config->horizonS) {
+                *ttcS = t;
+            }
+        }
+    }
+
+    // where a[0..1] + a[2..3] s meets b[0..1] + b[2..3] u
+    *petS = -1.0;
+    double const cross = a[2] * b[3] - a[3] * b[2];
+    if (fabs(cross) > 1e-9) {
+        double const s = (px * b[3] - py * b[2]) / cross;
+        double const u = (px * a[3] - py * a[2]) / cross;
+        if (s >= 0 && u >= 0 && s <= config->horizonS && u <= config->horizonS) {
+            *petS = fabs(s - u);
+        }
+    }
+}
+
+
+static size_t conflict_cell(libsm_conflict_t const* eng, int64_t x, int64_t y)
+{
+    return (size_t)libsm_mix64(((uint64_t)x << 32) ^ (uint64_t)(uint32_t)y) & eng->cellMask;
+}
+
+
+// conflicts of one VRU, false when the pair budget ran out
+static bool conflict_check_vru(libsm_conflict_t* eng,
+                               libsm_conflict_actor_t* vru,
+                               uint64_t nowMs,
+                               size_t* budget)
+{
+    libsm_conflict_config_t const* config = &eng->config;
+    int64_t const reach = (int64_t)ceil(config->searchRadiusM / config->cellSizeM);
+    double const radius2 = config->searchRadiusM * config->searchRadiusM;
+
+    for (int64_t dy = -reach; dy <= reach; dy++) {
+        for (int64_t dx = -reach; dx <= reach; dx++) {
+            int64_t const cellX = vru->cellX + dx;
+            int64_t const cellY = vru->cellY + dy;
+            int32_t i = eng->cells[conflict_cell(eng, cellX, cellY)];
+
+            for (; i >= 0; i = eng->actors[i].nextInCell) {
+                libsm_conflict_actor_t* vehicle = &eng->actors[i];
+                // different cells can share a bucket
+                if (vehicle->cellX != cellX || vehicle->cellY != cellY) {
+                    continue;
+                }
+                double const ex = vehicle->stepState[0] - vru->stepState[0];
+                double const ny = vehicle->stepState[1] - vru->stepState[1];
+                double const distance2 = ex * ex + ny * ny;
+                if (distance2 > radius2) {
+                    continue;
+                }
+                if (*budget == 0) {
+                    return false;
+                }
+                (*budget)--;
+                eng->stats.pairsChecked++;
+
+                double ttc;
+                double pet;
+                libsm_conflict_pair(config, vru->stepState, vehicle->stepState, &ttc, &pet);
+                bool const conflict = (ttc >= 0 && ttc <= config->ttcThresholdS)
+                                      || (pet >= 0 && pet <= config->petThresholdS);
+                if (!conflict) {
+                    continue;
+                }
+                if (!conflict_recent_claim(eng, vru->id, vehicle->id, nowMs)) {
+                    continue;
+                }
+
+                libsm_conflict_event_t const event = {
+                    .timeMs = nowMs,
+                    .vruId = vru->id,
+                    .vehicleId = vehicle->id,
+                    .ttcS = ttc,
+                    .petS = pet,
+                    .distanceM = sqrt(distance2),
+                    .vruEast = vru->stepState[0],
+                    .vruNorth = vru->stepState[1],
+                    .vehicleEast = vehicle->stepState[0],
+                    .vehicleNorth = vehicle->stepState[1],
+                };
+                eng->stats.events++;
+                eng->emit(eng->user, &event);
+            }
+        }
+    }
+    return true;
+}
+
+
+libsm_rval_e libsm_conflict_step(libsm_conflict_t* eng, uint64_t nowMs)
+{
+    if (eng == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    libsm_conflict_config_t const* config = &eng->config;
+
+    eng->stats.steps++;
+    memset(eng->cells, 0xFF, (eng->cellMask + 1) * sizeof(int32_t));
+
+    // expire, extrapolate to nowMs and put the vehicles in the grid
+    size_t vruCount = 0;
+    for (size_t i = 0; i < config->maxActors; i++) {
+        libsm_conflict_actor_t* actor = &eng->actors[i];
+        if (!actor->inUse) {
+            continue;
+        }
+        if (nowMs > actor->timeMs && nowMs - actor->timeMs > config->actorTimeoutMs) {
+            conflict_remove(eng, actor);
+            eng->stats.expired++;
+            continue;
+        }
+        double const dt = ((double)nowMs - (double)actor->timeMs) / 1000.0;
+        actor->stepState[0] = actor->state[0] + actor->state[2] * dt;
+        actor->stepState[1] = actor->state[1] + actor->state[3] * dt;
+        actor->stepState[2] = actor->state[2];
+        actor->stepState[3] = actor->state[3];
+        actor->cellX = (int64_t)floor(actor->stepState[0] / config->cellSizeM);
+        actor->cellY = (int64_t)floor(actor->stepState[1] / config->cellSizeM);
+
+        if (actor->vru) {
+            vruCount++;
+        } else {
+            size_t const cell = conflict_cell(eng, actor->cellX, actor->cellY);
+            actor->nextInCell = eng->cells[cell];
+            eng->cells[cell] = (int32_t)i;
+        }
+    }
+    // forget the pairs that may be reported again
+    for (size_t i = 0; i < config->maxActors && eng->recentFreeCount < config->maxActors; i++) {
+        libsm_conflict_recent_t* recent = &eng->recent[i];
+        if (recent->inUse
+            && (nowMs < recent->eventMs || nowMs - recent->eventMs >= config->repeatMs)) {
+            conflict_recent_remove(eng, recent);
+        }
+    }
+    if (vruCount == 0) {
+        eng->nextVru = 0;
+        return LIBSM_OK;
+    }
+
+    // VRUs in actor order, starting where the last step ran out of budget
+    size_t budget = config->maxPairChecks ? config->maxPairChecks : SIZE_MAX;
+    size_t const start = eng->nextVru % config->maxActors;
+    for (size_t n = 0; n < config->maxActors; n++) {
+        size_t const i = (start + n) % config->maxActors;
+        libsm_conflict_actor_t* vru = &eng->actors[i];
+        if (!vru->inUse || !vru->vru) {
+            continue;
+        }
+        if (!conflict_check_vru(eng, vru, nowMs, &budget)) {
+            eng->nextVru = i;
+            eng->stats.budgetExhausted++;
+            return LIBSM_OK;
+        }
+    }
+    eng->nextVru = 0;
+    return LIBSM_OK;
+}
@@ -0,0 +1,194 @@
+/**
+ * @brief VRU to vehicle conflict detection over PSM and BSM reports
+ *
+ * Feed the latest report of every actor with libsm_conflict_update, PSMs are
+ * VRUs and BSMs are vehicles, then call libsm_conflict_step at the rate events
+ * are wanted. A step extrapolates every actor to the step time in local east/north
+ * meters around the reference point, buckets them in a uniform grid, and only
+ * looks at VRU/vehicle pairs within searchRadiusM of each other. Each pair gets:
+ * - time to collision: when the constant velocity paths come within
+ *   collisionRadiusM of each other, and
+ * - predicted post encroachment time: the time between the two actors
+ *   passing the point where their paths cross.
+ * Pairs under either threshold are reported through the callback.
+ *
+ * Time only comes from the reports, so archives can be replayed as fast as
+ * they can be read.
+ * A step costs O(actors + nearby pairs), and maxPairChecks caps the pairs per
+ * step. When the cap is hit, the next step starts with the VRUs that were
+ * skipped.
+ */
+
+#ifndef LIBSM_CONFLICT_H
+#define LIBSM_CONFLICT_H
+
+#include "libsm-error.h"
+#include "libsm-trajectory.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/** @brief One conflict between a VRU and a vehicle */
+typedef struct {
+    uint64_t timeMs;    /**< @brief step time */
+    uint32_t vruId;     /**< @brief PSM TemporaryID */
+    uint32_t vehicleId; /**< @brief BSM TemporaryID */
+    double ttcS;        /**< @brief time to collision, negative if they do not collide */
+    double petS;        /**< @brief predicted post encroachment time, negative if none */
+    double distanceM;   /**< @brief current distance */
+    double vruEast;     /**< @brief meters from the reference point */
+    double vruNorth;
+    double vehicleEast;
+    double vehicleNorth;
+} libsm_conflict_event_t;
+
+typedef void (*libsm_conflict_emit_f)(void* user, libsm_conflict_event_t const* event);
+
+/** @brief Engine settings, see libsm_conflict_default_config */
+typedef struct {
+    Latitude_t refLat;       /**< @brief reference point, usually the intersection center */
+    Longitude_t refLong;
+    size_t maxActors;        /**< @brief actors tracked at once, updates beyond are dropped */
+    double cellSizeM;        /**< @brief grid cell size */
+    double searchRadiusM;    /**< @brief pairs further apart are not checked */
+    double collisionRadiusM; /**< @brief distance that counts as a collision */
+    double horizonS;         /**< @brief how far ahead paths are extrapolated */
+    double ttcThresholdS;    /**< @brief report pairs with a time to collision below this */
+    double petThresholdS;    /**< @brief report pairs with a post encroachment time below this */
+    uint64_t actorTimeoutMs; /**< @brief actors not heard from for this long are dropped */
+    uint64_t repeatMs;       /**< @brief do not report the same pair again within this,
+                                         up to maxActors pairs are remembered */
+    size_t maxPairChecks;    /**< @brief pairs checked per step, 0 for no limit */
+} libsm_conflict_config_t;
+
+/** @brief Counters */
+typedef struct {
+    uint64_t updates;         /**< @brief reports taken */
+    uint64_t dropped;         /**< @brief reports dropped, the actor table was full */
+    uint64_t expired;         /**< @brief actors timed out */
+    uint64_t steps;
+    uint64_t pairsChecked;
+    uint64_t events;
+    uint64_t budgetExhausted; /**< @brief steps that stopped at maxPairChecks */
+} libsm_conflict_stats_t;
+
+typedef struct libsm_conflict_actor libsm_conflict_actor_t;
+typedef struct libsm_conflict_recent libsm_conflict_recent_t;
+
+/** @brief Engine state */
+typedef struct {
+    libsm_conflict_config_t config;
+    libsm_conflict_emit_f emit;
+    void* user;
+    double metersPerLat;
+    double metersPerLong;
+
+    libsm_conflict_actor_t* actors; /**< @brief maxActors actors */
+    int32_t* freeList;
+    size_t freeCount;
+    int32_t* index;       /**< @brief open addressing table of actor indices, -1 empty */
+    size_t indexMask;
+    int32_t* cells;       /**< @brief grid buckets, first actor index or -1 */
+    size_t cellMask;
+    size_t nextVru;       /**< @brief where the next step starts when the budget ran out */
+
+    libsm_conflict_recent_t* recent; /**< @brief maxActors pairs reported within repeatMs */
+    int32_t* recentFreeList;
+    size_t recentFreeCount;
+    int32_t* recentIndex; /**< @brief like index, for recent */
+
+    libsm_conflict_stats_t stats;
+} libsm_conflict_t;
+
+
+/**
+ * @brief Default settings around a reference point
+ *
+ * 4096 actors, 10 m cells, 50 m search radius, 1.5 m collision radius,
+ * 5 s horizon, report TTC under 3 s and PET under 2 s, 2 s timeout,
+ * repeat after 1 s, no pair limit.
+ */
+void libsm_conflict_default_config(libsm_conflict_config_t* config,
+                                   Latitude_t refLat,
+                                   Longitude_t refLong);
+
+
+/**
+ * @brief Initialize an engine
+ *
+ * @param eng The engine, free with libsm_conflict_free
+ * @param config Settings
+ * @param emit Called with every conflict
+ * @param user Passed to emit
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG An argument other than user was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER maxActors is 0, or a distance is not positive
+ * @retval LIBSM_ALLOC_ERR Allocation error
+ */
+libsm_rval_e libsm_conflict_init(libsm_conflict_t* eng,
+                                 libsm_conflict_config_t const* config,
+                                 libsm_conflict_emit_f emit,
+                                 void* user);
+
+
+/**
+ * @brief Free an engine
+ */
+void libsm_conflict_free(libsm_conflict_t* eng);
+
+
+/**
+ * @brief Convert a position to meters east and north of the reference point
+ */
+void libsm_conflict_to_local(libsm_conflict_t const* eng,
+                             Latitude_t lat,
+                             Longitude_t Long,
+                             double* east,
+                             double* north);
+
+
+/**
+ * @brief Take the latest report of an actor
+ *
+ * Reports older than the one already held, and reports without a position,
+ * are ignored.
+ *
+ * @param eng The engine
+ * @param sample The report, see libsm_traj_sample_from_psm and libsm_traj_sample_from_bsm
+ *
+ * @retval LIBSM_OK Operation successful, including ignored reports
+ * @retval LIBSM_FAIL_NULL_ARG eng or sample was NULL
+ */
+libsm_rval_e libsm_conflict_update(libsm_conflict_t* eng, libsm_traj_sample_t const* sample);
+
+
+/**
+ * @brief Check all nearby VRU/vehicle pairs at nowMs and report conflicts
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG eng was NULL
+ */
+libsm_rval_e libsm_conflict_step(libsm_conflict_t* eng, uint64_t nowMs);
+
+
+/**
+ * @brief Time to collision and post encroachment time of two constant velocity actors
+ *
+ * @param config collisionRadiusM and horizonS are used
+ * @param a East, north, velocity east and velocity north, in meters and meters per second
+ * @param b The same for the other actor
+ * @param ttcS Time until they are within collisionRadiusM, negative if never within horizonS
+ * @param petS Time between them passing the crossing point of their paths,
+ *             negative if the paths do not cross within horizonS
+ */
+void libsm_conflict_pair(libsm_conflict_config_t const* config,
+                         double const a[4],
+                         double const b[4],
+                         double* ttcS,
+                         double* petS);
+
+
+#endif // LIBSM_CONFLICT_H
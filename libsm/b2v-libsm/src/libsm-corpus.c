@@ -0,0 +1,351 @@
+#include "libsm-corpus.h"
+#include "libsm-hash.h"
+#include "libsm.h"
+
+#include <stdlib.h>
+
+
+// Upper bound asn_random_fill may use for one value, enough for every type filled here
+#define FILL_LENGTH 256
+
+#define PATH_HISTORY_POINTS_MAX 23
+#define INTERSECTIONS_MAX 32
+#define MOVEMENTS_MAX 8
+
+
+// xorshift, for the shape of a message
+static uint32_t nextRandom(uint32_t* state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+
+static uint32_t between(uint32_t* state, unsigned min, unsigned max)
+{
+    return min + nextRandom(state) % (max - min + 1);
+}
+
+
+// Replace the value at member with a random one that satisfies the constraints of td
+static libsm_rval_e fill(asn_TYPE_descriptor_t* td, void* member)
+{
+    if (member == NULL) {
+        return LIBSM_ALLOC_ERR;
+    }
+    ASN_STRUCT_RESET(*td, member);
+    return asn_random_fill(td, &member, FILL_LENGTH) == 0 ? LIBSM_OK : LIBSM_ALLOC_ERR;
+}
+
+
+static libsm_rval_e buildBsm(libsm_corpus_config_t const* config,
+                             uint32_t* state,
+                             MessageFrame_t* mf)
+{
+    BasicSafetyMessage_t* bsm = libsm_get_bsm(mf);
+    libsm_rval_e rval = fill(&asn_DEF_BSMcoreData, &bsm->coreData);
+    if (rval != LIBSM_OK || nextRandom(state) % 100 >= config->partIIPercent) {
+        return rval;
+    }
+
+    if (libsm_init_bsm_path_history(bsm) != LIBSM_OK
+        || libsm_set_path_prediction(bsm, 0, 0) != LIBSM_OK) {
+        return LIBSM_ALLOC_ERR;
+    }
+    VehicleSafetyExtensions_t* vse =
+            libsm_get_partII_elem(bsm, BSMpartIIExtension__partII_Value_PR_VehicleSafetyExtensions);
+    PathHistory_t* pathHistory = vse->pathHistory;
+    unsigned const points = between(state, config->pathHistoryMin, config->pathHistoryMax);
+    // the builder starts the list with one point
+    while ((unsigned)pathHistory->crumbData.list.count < points) {
+        PathHistoryPoint_t* point = libsm_alloc_init_PathHistoryPoint();
+        if (point == NULL || ASN_SEQUENCE_ADD(&pathHistory->crumbData.list, point) != 0) {
+            free(point);
+            return LIBSM_ALLOC_ERR;
+        }
+    }
+    for (int i = 0; i < pathHistory->crumbData.list.count && rval == LIBSM_OK; i++) {
+        rval = fill(&asn_DEF_PathHistoryPoint, pathHistory->crumbData.list.array[i]);
+    }
+    if (rval == LIBSM_OK) {
+        rval = fill(&asn_DEF_FullPositionVector, pathHistory->initialPosition);
+    }
+    if (rval == LIBSM_OK) {
+        rval = fill(&asn_DEF_PathPrediction, vse->pathPrediction);
+    }
+    return rval;
+}
+
+
+static libsm_rval_e buildPsm(MessageFrame_t* mf)
+{
+    PersonalSafetyMessage_t* psm = libsm_get_psm(mf);
+    struct {
+        asn_TYPE_descriptor_t* td;
+        void* member;
+    } const fields[] = {
+        { &asn_DEF_PersonalDeviceUserType, &psm->basicType },
+        { &asn_DEF_DSecond, &psm->secMark },
+        { &asn_DEF_Common_MsgCount, &psm->msgCnt },
+        { &asn_DEF_TemporaryID, &psm->id },
+        { &asn_DEF_Latitude, &psm->position.lat },
+        { &asn_DEF_Longitude, &psm->position.Long },
+        { &asn_DEF_PositionalAccuracy, &psm->accuracy },
+        { &asn_DEF_Velocity, &psm->speed },
+        { &asn_DEF_Heading, &psm->heading },
+    };
+    for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++) {
+        libsm_rval_e const rval = fill(fields[i].td, fields[i].member);
+        if (rval != LIBSM_OK) {
+            return rval;
+        }
+    }
+    return LIBSM_OK;
+}
+
+
+static libsm_rval_e buildMovementState(uint32_t* state, MovementState_t* movement)
+{
+    libsm_rval_e rval = fill(&asn_DEF_SignalGroupID, &movement->signalGroup);
+    if (rval == LIBSM_OK && nextRandom(state) % 2
+        && libsm_add_spat_movementState_movementEvent(movement) == NULL) {
+        rval = LIBSM_ALLOC_ERR;
+    }
+    for (int i = 0; i < movement->state_time_speed.list.count && rval == LIBSM_OK; i++) {
+        MovementEvent_t* event = movement->state_time_speed.list.array[i];
+        rval = fill(&asn_DEF_MovementPhaseState, &event->eventState);
+        // timing is left out by the builder, so asn_random_fill allocates it
+        if (rval == LIBSM_OK
+            && asn_random_fill(&asn_DEF_TimeChangeDetails, (void**)&event->timing, FILL_LENGTH)
+                       != 0) {
+            rval = LIBSM_ALLOC_ERR;
+        }
+    }
+    return rval;
+}
+
+
+static libsm_rval_e buildSpat(libsm_corpus_config_t const* config,
+                              uint32_t* state,
+                              MessageFrame_t* mf)
+{
+    SPAT_t* spat = libsm_get_spat(mf);
+    unsigned const intersections =
+            between(state, config->intersectionsMin, config->intersectionsMax);
+    // the builder starts the list with one intersection, of one movement
+    while ((unsigned)spat->intersections.list.count < intersections) {
+        if (libsm_add_spat_intersectionState(spat) == NULL) {
+            return LIBSM_ALLOC_ERR;
+        }
+    }
+    for (int i = 0; i < spat->intersections.list.count; i++) {
+        IntersectionState_t* intersection = spat->intersections.list.array[i];
+        libsm_rval_e rval = fill(&asn_DEF_IntersectionID, &intersection->id.id);
+        if (rval == LIBSM_OK) {
+            rval = fill(&asn_DEF_Common_MsgCount, &intersection->revision);
+        }
+        unsigned const movements = between(state, 1, MOVEMENTS_MAX);
+        while (rval == LIBSM_OK && (unsigned)intersection->states.list.count < movements) {
+            if (libsm_add_spat_intersectionState_movementState(intersection) == NULL) {
+                rval = LIBSM_ALLOC_ERR;
+            }
+        }
+        for (int s = 0; s < intersection->states.list.count && rval == LIBSM_OK; s++) {
+            rval = buildMovementState(state, intersection->states.list.array[s]);
+        }
+        if (rval != LIBSM_OK) {
+            return rval;
+        }
+    }
+    return LIBSM_OK;
+}
+
+
+static libsm_rval_e buildTim(uint32_t* state, MessageFrame_t* mf)
+{
+    TravelerInformation_t* tim = libsm_get_tim(mf);
+    libsm_rval_e rval = fill(&asn_DEF_Common_MsgCount, &tim->msgCnt);
+    if (rval != LIBSM_OK) {
+        return rval;
+    }
+
+    TravelerDataFrame_t* frame = libsm_alloc_init_partial_TravelerDataFrame();
+    if (frame == NULL) {
+        return LIBSM_ALLOC_ERR;
+    }
+    if (ASN_SEQUENCE_ADD(&tim->dataFrames.list, frame) != 0) {
+        ASN_STRUCT_FREE(asn_DEF_TravelerDataFrame, frame);
+        return LIBSM_ALLOC_ERR;
+    }
+    GeographicalPath_t* path = libsm_alloc_init_GeographicalPath();
+    ITIScodesAndText_t* advisory = libsm_alloc_init_ITIScodesAndText();
+    frame->content.present = TravelerDataFrame__content_PR_advisory;
+    frame->content.choice.advisory = advisory;
+    if (advisory == NULL || path == NULL
+        || libsm_init_TravelerDataFrame_msgId_choice_FurtherInfoID(frame) != LIBSM_OK
+        || ASN_SEQUENCE_ADD(&frame->regions.list, path) != 0) {
+        ASN_STRUCT_FREE(asn_DEF_GeographicalPath, path);
+        return LIBSM_ALLOC_ERR;
+    }
+
+    // some ITIS codes, and a line of text now and then
+    unsigned const items = between(state, 1, 4);
+    for (unsigned i = 0; i < items; i++) {
+        ITIScodesAndText__Member* member;
+        if (i > 0 && nextRandom(state) % 4 == 0) {
+            char text[32];
+            snprintf(text, sizeof(text), "Advisory %u", nextRandom(state) % 10000);
+            member = libsm_alloc_init_ITIScodesAndText__Member_text(text);
+        } else {
+            ITIScodes_t code = 0;
+            if (fill(&asn_DEF_ITIScodes, &code) != LIBSM_OK) {
+                return LIBSM_ALLOC_ERR;
+            }
+            member = libsm_alloc_init_ITIScodesAndText__Member_itis(code);
+        }
+        if (member == NULL || ASN_SEQUENCE_ADD(&advisory->list, member) != 0) {
+            free(member);
+            return LIBSM_ALLOC_ERR;
+        }
+    }
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_corpus_default_config(libsm_corpus_config_t* config)
+{
+    if (config == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    config->seed = 1;
+    config->bsmWeight = 70;
+    config->psmWeight = 15;
+    config->spatWeight = 10;
+    config->timWeight = 5;
+    config->partIIPercent = 50;
+    config->pathHistoryMin = 1;
+    config->pathHistoryMax = PATH_HISTORY_POINTS_MAX;
+    config->intersectionsMin = 1;
+    config->intersectionsMax = 4;
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_corpus_build(libsm_corpus_config_t const* config,
+                                uint64_t index,
+                                MessageFrame_t** mf)
+{
+    if (config == NULL || mf == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    *mf = NULL;
+    unsigned const weights = config->bsmWeight + config->psmWeight + config->spatWeight
+                             + config->timWeight;
+    if (weights == 0 || config->partIIPercent > 100 || config->pathHistoryMin < 1
+        || config->pathHistoryMin > config->pathHistoryMax
+        || config->pathHistoryMax > PATH_HISTORY_POINTS_MAX || config->intersectionsMin < 1
+        || config->intersectionsMin > config->intersectionsMax
+        || config->intersectionsMax > INTERSECTIONS_MAX) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+
+    // neighbouring seeds and indexes give unrelated messages
+    uint64_t const seed = libsm_mix64(config->seed + (index + 1) * 0x9e3779b97f4a7c15ULL);
+    uint32_t state = (uint32_t)seed != 0 ? (uint32_t)seed : 1;
+    asn_random_seed((unsigned)(seed >> 32));
+
+    libsm_rval_e rval;
+    unsigned kind = nextRandom(&state) % weights;
+    if (kind < config->bsmWeight) {
+        *mf = libsm_alloc_init_mf_bsm();
+        rval = *mf != NULL ? buildBsm(config, &state, *mf) : LIBSM_ALLOC_ERR;
+    } else if ((kind -= config->bsmWeight) < config->psmWeight) {
+        *mf = libsm_alloc_init_mf_psm();
+        rval = *mf != NULL ? buildPsm(*mf) : LIBSM_ALLOC_ERR;
+    } else if ((kind -= config->psmWeight) < config->spatWeight) {
+        *mf = libsm_alloc_init_mf_spat();
+        rval = *mf != NULL ? buildSpat(config, &state, *mf) : LIBSM_ALLOC_ERR;
+    } else {
+        *mf = libsm_alloc_init_partial_mf_tim();
+        rval = *mf != NULL ? buildTim(&state, *mf) : LIBSM_ALLOC_ERR;
+    }
+    if (rval != LIBSM_OK) {
+        ASN_STRUCT_FREE(asn_DEF_MessageFrame, *mf);
+        *mf = NULL;
+    }
+    return rval;
+}
+
+
+libsm_rval_e libsm_corpus_message(libsm_corpus_config_t const* config,
+                                  uint64_t index,
+                                  uint8_t* encoded,
+                                  size_t* len)
+{
+    if (encoded == NULL || len == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    MessageFrame_t* mf;
+    libsm_rval_e rval = libsm_corpus_build(config, index, &mf);
+    if (rval == LIBSM_OK) {
+        rval = libsm_encode_messageframe(mf, encoded, len);
+        ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    }
+    return rval;
+}
+
+
+libsm_rval_e libsm_corpus_write_record(FILE* file, uint8_t const* encoded, size_t len)
+{
+    if (file == NULL || encoded == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (len > UINT32_MAX) {
+        return LIBSM_FAIL_ENCODING_BUFF_SIZE;
+    }
+    uint8_t const prefix[LIBSM_CORPUS_PREFIX_SIZE] = {
+        (uint8_t)(len >> 24), (uint8_t)(len >> 16), (uint8_t)(len >> 8), (uint8_t)len
+    };
+    if (fwrite(prefix, 1, sizeof(prefix), file) != sizeof(prefix)
+        || fwrite(encoded, 1, len, file) != len) {
+        return LIBSM_FAIL;
+    }
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_corpus_read_record(FILE* file, uint8_t* encoded, size_t* len)
+{
+    if (file == NULL || encoded == NULL || len == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    uint8_t prefix[LIBSM_CORPUS_PREFIX_SIZE];
+    size_t const got = fread(prefix, 1, sizeof(prefix), file);
+    if (got == 0) {
+        return LIBSM_FAIL;
+    }
+    if (got != sizeof(prefix)) {
+        return LIBSM_FAIL_DECODING;
+    }
+    size_t const size = (size_t)prefix[0] << 24 | (size_t)prefix[1] << 16
+                        | (size_t)prefix[2] << 8 | prefix[3];
+    if (size > *len) {
+        *len = size;
+        // skip the record, reading so pipes work too
+        for (size_t left = size; left > 0; left--) {
+            if (fgetc(file) == EOF) {
+                return LIBSM_FAIL_DECODING;
+            }
+        }
+        return LIBSM_FAIL_DECODING_BUFF_SIZE;
+    }
+    if (fread(encoded, 1, size, file) != size) {
+        return LIBSM_FAIL_DECODING;
+    }
+    *len = size;
+    return LIBSM_OK;
+}
@@ -0,0 +1,129 @@
+/**
+ * @brief Seeded synthetic corpora of UPER MessageFrames
+ *
+ * Messages are shaped by the libsm_alloc_init builders (BSMs with Part II path
+ * history and prediction, PSMs, SPATs with several intersections and TIMs with
+ * advisories), and their fields are drawn with asn_random_fill, so every value
+ * is within its J2735 constraint. Each message is encoded before it is handed
+ * out, so a corpus only holds valid frames.
+ *
+ * Message i of a corpus only depends on the configuration, the seed and i: a
+ * message a codec disagrees on can be rebuilt on its own, and a longer corpus
+ * starts with the shorter one. asn_random_fill draws from a generator of the
+ * calling thread, which is reseeded for every message, so corpora are the same
+ * on every platform and threads can build messages of one corpus in parallel.
+ *
+ * A corpus file is a sequence of records, each one a MessageFrame prefixed
+ * with its length as a 4 byte big endian integer.
+ */
+
+#ifndef LIBSM_CORPUS_H
+#define LIBSM_CORPUS_H
+
+#include "MessageFrame.h"
+#include "libsm-error.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+
+/** @brief Bytes of the length prefix of a record */
+#define LIBSM_CORPUS_PREFIX_SIZE 4
+
+/** @brief What a corpus is made of */
+typedef struct {
+    uint64_t seed;             /**< @brief any value, the same seed gives the same corpus */
+    unsigned bsmWeight;        /**< @brief relative share of BSMs */
+    unsigned psmWeight;        /**< @brief relative share of PSMs */
+    unsigned spatWeight;       /**< @brief relative share of SPATs */
+    unsigned timWeight;        /**< @brief relative share of TIMs */
+    unsigned partIIPercent;    /**< @brief BSMs with path history and prediction, 0 to 100 */
+    unsigned pathHistoryMin;   /**< @brief fewest PathHistoryPoints in a Part II, 1 to 23 */
+    unsigned pathHistoryMax;   /**< @brief most PathHistoryPoints in a Part II, 1 to 23 */
+    unsigned intersectionsMin; /**< @brief fewest intersections in a SPAT, 1 to 32 */
+    unsigned intersectionsMax; /**< @brief most intersections in a SPAT, 1 to 32 */
+} libsm_corpus_config_t;
+
+
+/**
+ * @brief Set the default configuration
+ *
+ * Seed 1, 70% BSMs, 15% PSMs, 10% SPATs and 5% TIMs, half of the BSMs with a
+ * Part II of 1 to 23 PathHistoryPoints, and SPATs of 1 to 4 intersections.
+ *
+ * @param config The configuration to initialize
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG config was NULL
+ */
+libsm_rval_e libsm_corpus_default_config(libsm_corpus_config_t* config);
+
+
+/**
+ * @brief Build message index of a corpus
+ *
+ * @param config The corpus
+ * @param index Position of the message in the corpus
+ * @param mf Out the message, free with ASN_STRUCT_FREE
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG An argument was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER The weights are all 0, or a count is out of range
+ * @retval LIBSM_ALLOC_ERR Allocation error
+ */
+libsm_rval_e libsm_corpus_build(libsm_corpus_config_t const* config,
+                                uint64_t index,
+                                MessageFrame_t** mf);
+
+
+/**
+ * @brief Build and UPER encode message index of a corpus
+ *
+ * @param config The corpus
+ * @param index Position of the message in the corpus
+ * @param encoded Output buffer
+ * @param len In the size of encoded, out the number of bytes encoded
+ *
+ * @retval LIBSM_OK Operation successful
+ * @return Otherwise the result of libsm_corpus_build or libsm_encode_messageframe
+ */
+libsm_rval_e libsm_corpus_message(libsm_corpus_config_t const* config,
+                                  uint64_t index,
+                                  uint8_t* encoded,
+                                  size_t* len);
+
+
+/**
+ * @brief Write a length prefixed record
+ *
+ * @param file Output file
+ * @param encoded The message
+ * @param len Size of encoded
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG An argument was NULL
+ * @retval LIBSM_FAIL_ENCODING_BUFF_SIZE len does not fit the prefix
+ * @retval LIBSM_FAIL Writing failed
+ */
+libsm_rval_e libsm_corpus_write_record(FILE* file, uint8_t const* encoded, size_t len);
+
+
+/**
+ * @brief Read the next length prefixed record
+ *
+ * @param file Input file
+ * @param encoded Output buffer
+ * @param len In the size of encoded, out the size of the message
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG An argument was NULL
+ * @retval LIBSM_FAIL_DECODING_BUFF_SIZE encoded is too small, len is set to the
+ *                                       size needed and the record is skipped
+ * @retval LIBSM_FAIL_DECODING The file ends inside a record
+ * @retval LIBSM_FAIL The file ends before the record
+ */
+libsm_rval_e libsm_corpus_read_record(FILE* file, uint8_t* encoded, size_t* len);
+
+
+#endif // LIBSM_CORPUS_H
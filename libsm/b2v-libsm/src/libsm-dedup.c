@@ -0,0 +1,293 @@
+/**
+ * @brief Streaming duplicate and repeat detection for UPER-encoded MessageFrames
+ */
+
+#include "libsm-dedup.h"
+#include "libsm-hash.h"
+
+#include <DSRCmsgID.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+
+// How far a lookup walks before giving up and evicting the oldest entry it passed
+#define DEDUP_PROBE_LIMIT 16
+
+// MessageFrame: extension bit, messageId (0..32767), then the open type length
+#define DEDUP_MF_HEADER_BITS 16
+
+// BasicSafetyMessage: extension bit, partII and regional presence bits.
+// BSMcoreData has neither, so msgCnt, id and secMark follow directly.
+#define DEDUP_BSM_PREAMBLE_BITS 3
+
+// PersonalSafetyMessage: extension bit and 18 OPTIONAL presence bits,
+// then basicType (0..4,...) which is an extension bit and 3 bits,
+// then secMark, msgCnt and id.
+#define DEDUP_PSM_PREAMBLE_BITS   19
+#define DEDUP_PSM_BASIC_TYPE_BITS 3
+
+// key layout: tag, type, TemporaryID, msgCnt, secMark
+#define DEDUP_KEY_SKIMMED  (1ULL << 63)
+#define DEDUP_KEY_PSM      (1ULL << 62)
+#define DEDUP_KEY_ID_SHIFT 23
+#define DEDUP_KEY_CNT_SHIFT 16
+
+
+uint64_t libsm_dedup_hash(const uint8_t* data, size_t len)
+{
+    uint64_t h = 0x9E3779B97F4A7C15ULL ^ (uint64_t)len;
+    uint64_t word;
+
+    while (len >= sizeof(word)) {
+        memcpy(&word, data, sizeof(word));
+        h = (h ^ libsm_mix64(word)) * 0x9E3779B97F4A7C15ULL;
+        data += sizeof(word);
+        len -= sizeof(word);
+    }
+    if (len > 0) {
+        word = 0;
+        memcpy(&word, data, len);
+        h = (h ^ libsm_mix64(word)) * 0x9E3779B97F4A7C15ULL;
+    }
+    return libsm_mix64(h);
+}
+
+
+// read bits MSB first, as PER lays them out. false if past the end
+static bool dedup_read_bits(const uint8_t* buf, size_t len, size_t* bitPos, int bits, uint32_t* out)
+{
+    uint32_t value = 0;
+
+    if (*bitPos + (size_t)bits > len * 8) {
+        return false;
+    }
+    for (int i = 0; i < bits; i++) {
+        size_t const pos = *bitPos + (size_t)i;
+        value = (value << 1) | ((buf[pos >> 3] >> (7 - (pos & 7))) & 1);
+    }
+    *bitPos += (size_t)bits;
+    *out = value;
+    return true;
+}
+
+
+libsm_rval_e libsm_dedup_key_from_uper(const uint8_t* encoded, size_t len, uint64_t* key)
+{
+    size_t bitPos = 0;
+    uint32_t header;
+    uint32_t lengthBits;
+    uint32_t skip;
+    uint32_t basicTypeExtended;
+    uint32_t msgCnt;
+    uint32_t id;
+    uint32_t secMark;
+    uint64_t type = 0;
+
+    if (encoded == NULL || key == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (!dedup_read_bits(encoded, len, &bitPos, DEDUP_MF_HEADER_BITS, &header)) {
+        return LIBSM_FAIL_DECODING;
+    }
+    uint32_t const messageId = header & 0x7FFF;
+
+    // open type length determinant, short or long form. Fragmented frames are not skimmed
+    if (!dedup_read_bits(encoded, len, &bitPos, 2, &lengthBits)) {
+        return LIBSM_FAIL_DECODING;
+    }
+    if (lengthBits == 3) {
+        return LIBSM_FAIL_DECODING;
+    }
+    bitPos += (lengthBits == 2) ? 14 : 6;
+
+    switch (messageId) {
+        case DSRCmsgID_basicSafetyMessage:
+            bitPos += DEDUP_BSM_PREAMBLE_BITS;
+            if (!dedup_read_bits(encoded, len, &bitPos, 7, &msgCnt)
+                || !dedup_read_bits(encoded, len, &bitPos, 32, &id)
+                || !dedup_read_bits(encoded, len, &bitPos, 16, &secMark)) {
+                return LIBSM_FAIL_DECODING;
+            }
+            break;
+        case DSRCmsgID_personalSafetyMessage:
+            bitPos += DEDUP_PSM_PREAMBLE_BITS;
+            // an extended basicType has a variable length, leave those to the content hash
+            if (!dedup_read_bits(encoded, len, &bitPos, 1, &basicTypeExtended)
+                || basicTypeExtended
+                || !dedup_read_bits(encoded, len, &bitPos, DEDUP_PSM_BASIC_TYPE_BITS, &skip)
+                || !dedup_read_bits(encoded, len, &bitPos, 16, &secMark)
+                || !dedup_read_bits(encoded, len, &bitPos, 7, &msgCnt)
+                || !dedup_read_bits(encoded, len, &bitPos, 32, &id)) {
+                return LIBSM_FAIL_DECODING;
+            }
+            type = DEDUP_KEY_PSM;
+            break;
+        default:
+            return LIBSM_FAIL_DECODING;
+    }
+
+    *key = DEDUP_KEY_SKIMMED | type | ((uint64_t)id << DEDUP_KEY_ID_SHIFT)
+           | ((uint64_t)msgCnt << DEDUP_KEY_CNT_SHIFT) | (uint64_t)secMark;
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_dedup_init(libsm_dedup_t* dedup, size_t capacity, uint64_t windowMs)
+{
+    if (dedup == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (capacity == 0 || windowMs == 0) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    *dedup = (libsm_dedup_t){ 0 };
+
+    size_t rounded = 1;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+    dedup->capacity = rounded;
+    dedup->windowMs = windowMs;
+
+    for (int i = 0; i < 2; i++) {
+        dedup->generation[i] = calloc(rounded, sizeof(libsm_dedup_entry_t));
+        if (dedup->generation[i] == NULL) {
+            libsm_dedup_free(dedup);
+            return LIBSM_ALLOC_ERR;
+        }
+    }
+    return LIBSM_OK;
+}
+
+
+void libsm_dedup_free(libsm_dedup_t* dedup)
+{
+    if (dedup == NULL) {
+        return;
+    }
+    free(dedup->generation[0]);
+    free(dedup->generation[1]);
+    dedup->generation[0] = NULL;
+    dedup->generation[1] = NULL;
+}
+
+
+static void dedup_rotate(libsm_dedup_t* dedup, uint64_t nowMs)
+{
+    if (!dedup->started) {
+        dedup->started = true;
+        dedup->generationStartMs = nowMs;
+        return;
+    }
+    uint64_t const age = nowMs - dedup->generationStartMs;
+    if (age < dedup->windowMs) {
+        return;
+    }
+
+    size_t const bytes = dedup->capacity * sizeof(libsm_dedup_entry_t);
+    uint8_t const previous = dedup->current ^ 1;
+    if (age >= 2 * dedup->windowMs) {
+        // quiet for long enough that everything has expired
+        memset(dedup->generation[dedup->current], 0, bytes);
+    }
+    memset(dedup->generation[previous], 0, bytes);
+    dedup->current = previous;
+    dedup->generationStartMs = nowMs;
+}
+
+
+// find key in a generation. If it is not there, *slot is where it should go
+static libsm_dedup_entry_t* dedup_find(libsm_dedup_t const* dedup,
+                                       libsm_dedup_entry_t* table,
+                                       uint64_t key,
+                                       libsm_dedup_entry_t** slot)
+{
+    size_t const mask = dedup->capacity - 1;
+    size_t index = (size_t)libsm_mix64(key) & mask;
+    libsm_dedup_entry_t* oldest = &table[index];
+
+    for (int probe = 0; probe < DEDUP_PROBE_LIMIT; probe++) {
+        libsm_dedup_entry_t* entry = &table[index];
+        if (entry->key == key) {
+            return entry;
+        }
+        if (entry->key == 0) {
+            *slot = entry;
+            return NULL;
+        }
+        if (entry->lastSeenMs < oldest->lastSeenMs) {
+            oldest = entry;
+        }
+        index = (index + 1) & mask;
+    }
+    *slot = oldest;
+    return NULL;
+}
+
+
+libsm_rval_e libsm_dedup_check(libsm_dedup_t* dedup,
+                               const uint8_t* encoded,
+                               size_t len,
+                               uint64_t nowMs,
+                               libsm_dedup_result_t* result)
+{
+    libsm_dedup_entry_t* slot = NULL;
+    libsm_dedup_entry_t* ignored = NULL;
+    uint64_t key;
+
+    if (dedup == NULL || encoded == NULL || result == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (len == 0) {
+        return LIBSM_FAIL_DECODING_BUFF_SIZE;
+    }
+
+    dedup_rotate(dedup, nowMs);
+
+    uint64_t const contentHash = libsm_dedup_hash(encoded, len);
+    if (libsm_dedup_key_from_uper(encoded, len, &key) != LIBSM_OK) {
+        key = (contentHash & ~DEDUP_KEY_SKIMMED) | 1;
+    }
+
+    libsm_dedup_entry_t* table = dedup->generation[dedup->current];
+    libsm_dedup_entry_t* entry = dedup_find(dedup, table, key, &slot);
+    if (entry == NULL) {
+        // carry anything seen in the previous generation forward
+        libsm_dedup_entry_t* older
+                = dedup_find(dedup, dedup->generation[dedup->current ^ 1], key, &ignored);
+        if (older != NULL) {
+            *slot = *older;
+            entry = slot;
+        }
+    }
+
+    *result = (libsm_dedup_result_t){ 0 };
+    result->key = key;
+
+    if (entry == NULL) {
+        *slot = (libsm_dedup_entry_t){
+            .key = key,
+            .contentHash = contentHash,
+            .firstSeenMs = nowMs,
+            .lastSeenMs = nowMs,
+            .copies = 0,
+        };
+        result->status = LIBSM_DEDUP_FIRST_SEEN;
+        return LIBSM_OK;
+    }
+
+    result->sinceFirstMs = nowMs - entry->firstSeenMs;
+    result->sincePreviousMs = nowMs - entry->lastSeenMs;
+    if (entry->contentHash != contentHash) {
+        result->status = LIBSM_DEDUP_CONFLICT;
+        result->copies = entry->copies;
+        return LIBSM_OK;
+    }
+
+    entry->copies++;
+    entry->lastSeenMs = nowMs;
+    result->status = LIBSM_DEDUP_REPEAT;
+    result->copies = entry->copies;
+    return LIBSM_OK;
+}
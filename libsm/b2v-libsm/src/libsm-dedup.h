@@ -0,0 +1,126 @@
+/**
+ * @brief Streaming duplicate and repeat detection for UPER-encoded MessageFrames
+ *
+ * Meant to run ahead of libsm_decode_messageframe, so relayed copies of the
+ * same message do not have to be decoded again.
+ *
+ * Messages are keyed on (messageId, TemporaryID, msgCnt, secMark), skimmed
+ * straight out of the UPER bytes for BSMs and PSMs. A 64-bit hash of the whole
+ * frame is kept as a second tier to tell a byte-exact copy from a different
+ * message that happens to reuse the same key. Other message types are keyed
+ * on the content hash alone.
+ *
+ * Memory is bounded: two fixed size generations of windowMs each, a message is
+ * remembered for between windowMs and 2 * windowMs after it was last seen.
+ */
+
+#ifndef LIBSM_DEDUP_H
+#define LIBSM_DEDUP_H
+
+#include "libsm-error.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/** @brief What libsm_dedup_check found */
+typedef enum {
+    LIBSM_DEDUP_FIRST_SEEN, // Not seen within the window, decode it.
+    LIBSM_DEDUP_REPEAT,     // A byte-exact copy of a message already seen.
+    LIBSM_DEDUP_CONFLICT,   // Same id/msgCnt/secMark as a seen message, but different bytes.
+} libsm_dedup_status_e;
+
+/** @brief Result of checking one frame */
+typedef struct {
+    libsm_dedup_status_e status;
+    uint32_t copies;          /**< @brief copies seen before this one, 0 if first seen */
+    uint64_t sinceFirstMs;    /**< @brief time since the first copy */
+    uint64_t sincePreviousMs; /**< @brief time since the previous copy */
+    uint64_t key;             /**< @brief the key the frame was filed under */
+} libsm_dedup_result_t;
+
+/** @brief One remembered message */
+typedef struct {
+    uint64_t key; /**< @brief 0 for an empty slot */
+    uint64_t contentHash;
+    uint64_t firstSeenMs;
+    uint64_t lastSeenMs;
+    uint32_t copies;
+} libsm_dedup_entry_t;
+
+/** @brief Deduplicator state */
+typedef struct {
+    libsm_dedup_entry_t* generation[2]; /**< @brief current and previous generation */
+    size_t capacity;                    /**< @brief entries per generation, a power of two */
+    uint64_t windowMs;                  /**< @brief length of a generation */
+    uint64_t generationStartMs;         /**< @brief when the current generation started */
+    uint8_t current;                    /**< @brief index into generation */
+    bool started;
+} libsm_dedup_t;
+
+
+/**
+ * @brief Initialize a deduplicator
+ *
+ * @param dedup The deduplicator to initialize, free with libsm_dedup_free
+ * @param capacity Messages remembered per window, rounded up to a power of two
+ * @param windowMs How long a message is remembered for, at least
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG dedup was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER capacity or windowMs was 0
+ * @retval LIBSM_ALLOC_ERR Allocation error
+ */
+libsm_rval_e libsm_dedup_init(libsm_dedup_t* dedup, size_t capacity, uint64_t windowMs);
+
+
+/**
+ * @brief Free the tables of a deduplicator, the struct itself belongs to the caller
+ */
+void libsm_dedup_free(libsm_dedup_t* dedup);
+
+
+/**
+ * @brief Read the dedup key out of a UPER-encoded MessageFrame without decoding it
+ *
+ * @param encoded UPER-encoded MessageFrame
+ * @param len Length of encoded
+ * @param key The key, (messageId, TemporaryID, msgCnt, secMark) packed into 64 bits
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG encoded or key was NULL
+ * @retval LIBSM_FAIL_DECODING Not a BSM or PSM, or too short to contain the fields
+ */
+libsm_rval_e libsm_dedup_key_from_uper(const uint8_t* encoded, size_t len, uint64_t* key);
+
+
+/**
+ * @brief 64-bit hash of a byte buffer, used for the content tier
+ */
+uint64_t libsm_dedup_hash(const uint8_t* data, size_t len);
+
+
+/**
+ * @brief Check a frame against the recently seen frames, and remember it
+ *
+ * nowMs must not go backwards between calls.
+ *
+ * @param dedup The deduplicator
+ * @param encoded UPER-encoded MessageFrame
+ * @param len Length of encoded
+ * @param nowMs Receive time in milliseconds
+ * @param result What was found
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG An argument was NULL
+ * @retval LIBSM_FAIL_DECODING_BUFF_SIZE len was 0
+ */
+libsm_rval_e libsm_dedup_check(libsm_dedup_t* dedup,
+                               const uint8_t* encoded,
+                               size_t len,
+                               uint64_t nowMs,
+                               libsm_dedup_result_t* result);
+
+
+#endif // LIBSM_DEDUP_H
@@ -0,0 +1,53 @@
+#include "libsm-enum.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "libsm-enumTable.h"
+
+
+// the hashes of tooling/gen-enums.sh, over the type, ':' and the name with _ as -
+static void enum_hash(char const* s, size_t len, uint32_t* h1, uint32_t* h2)
+{
+    for (size_t i = 0; i < len; i++) {
+        uint32_t const c = s[i] == '_' ? '-' : (unsigned char)s[i];
+        *h1 = *h1 * 33u + c;
+        *h2 = *h2 * 131u + c;
+    }
+}
+
+
+libsm_enum_t const* libsm_enum_from_name(asn_TYPE_descriptor_t const* td,
+                                         char const* name,
+                                         size_t len)
+{
+    if (td == NULL || td->name == NULL || name == NULL) {
+        return NULL;
+    }
+
+    uint32_t h1 = 5381;
+    uint32_t h2 = 0;
+    enum_hash(td->name, strlen(td->name), &h1, &h2);
+    enum_hash(":", 1, &h1, &h2);
+    enum_hash(name, len, &h1, &h2);
+
+    uint32_t const d = enumDisplacements[h1 % LIBSM_ENUM_BUCKETS];
+    uint32_t const h3 = (h1 >> 16) | 1u;
+    uint16_t const slot = enumSlots[(h2 + d * h3) % LIBSM_ENUM_SLOTS];
+    if (slot == 0) {
+        return NULL;
+    }
+
+    // the one candidate, a hash of anything else can land on it too
+    libsm_enum_t const* e = &enumNames[slot - 1];
+    if (strcmp(e->type, td->name) != 0 || strlen(e->name) != len) {
+        return NULL;
+    }
+    for (size_t i = 0; i < len; i++) {
+        char const c = name[i] == '_' ? '-' : name[i];
+        if (c != e->name[i]) {
+            return NULL;
+        }
+    }
+    return e;
+}
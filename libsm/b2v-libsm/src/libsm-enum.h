@@ -0,0 +1,45 @@
+/**
+ * @brief Names of ENUMERATED and named INTEGER values
+ *
+ * Every value name of the ENUMERATED and named INTEGER types of J2735, in a
+ * perfect hash generated from src/j2735 by tooling/gen-enums.sh. A lookup
+ * hashes the name once and compares with at most one entry, whatever the
+ * number of names of the type.
+ *
+ * Names are the ASN.1 ones, "passenger-Vehicle-TypeUnknown". Lookups also take
+ * them with _, the C spelling.
+ */
+
+#ifndef LIBSM_ENUM_H
+#define LIBSM_ENUM_H
+
+#include "asn_application.h"
+
+#include <stddef.h>
+
+
+/** @brief One value name */
+typedef struct {
+    char const* type; /**< @brief ASN.1 name of the type */
+    char const* name; /**< @brief ASN.1 name of the value */
+    long value;
+} libsm_enum_t;
+
+
+/**
+ * @brief The value of a type with a name
+ *
+ * Case matters, - and _ are the same.
+ *
+ * @param td The type, &asn_DEF_BasicVehicleClass
+ * @param name The name, need not be NUL terminated
+ * @param len Its length
+ *
+ * @return The value, NULL if the type has none with the name
+ */
+libsm_enum_t const* libsm_enum_from_name(asn_TYPE_descriptor_t const* td,
+                                         char const* name,
+                                         size_t len);
+
+
+#endif // LIBSM_ENUM_H
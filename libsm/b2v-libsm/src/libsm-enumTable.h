@@ -0,0 +1,1177 @@
+/*
+ * Generated by tooling/gen-enums.sh from the ENUMERATED and named INTEGER types in
+ * src/j2735, do not edit
+ * Included by libsm-enum.c only
+ */
+
+#ifndef LIBSM_ENUM_TABLE_H
+#define LIBSM_ENUM_TABLE_H
+
+#define LIBSM_ENUM_COUNT 1001
+#define LIBSM_ENUM_BUCKETS 256
+#define LIBSM_ENUM_SLOTS 2048
+
+// sorted by type and value, the aliases last
+static libsm_enum_t const enumNames[LIBSM_ENUM_COUNT] = {
+    { "AccelerationConfidence", "unavailable", 0 },
+    { "AccelerationConfidence", "accl-100-00", 1 },
+    { "AccelerationConfidence", "accl-010-00", 2 },
+    { "AccelerationConfidence", "accl-005-00", 3 },
+    { "AccelerationConfidence", "accl-001-00", 4 },
+    { "AccelerationConfidence", "accl-000-10", 5 },
+    { "AccelerationConfidence", "accl-000-05", 6 },
+    { "AccelerationConfidence", "accl-000-01", 7 },
+    { "AdvisorySpeedType", "none", 0 },
+    { "AdvisorySpeedType", "greenwave", 1 },
+    { "AdvisorySpeedType", "ecoDrive", 2 },
+    { "AdvisorySpeedType", "transit", 3 },
+    { "AltitudeConfidence", "alt-000-01", 0 },
+    { "AltitudeConfidence", "alt-000-02", 1 },
+    { "AltitudeConfidence", "alt-000-05", 2 },
+    { "AltitudeConfidence", "alt-000-10", 3 },
+    { "AltitudeConfidence", "alt-000-20", 4 },
+    { "AltitudeConfidence", "alt-000-50", 5 },
+    { "AltitudeConfidence", "alt-001-00", 6 },
+    { "AltitudeConfidence", "alt-002-00", 7 },
+    { "AltitudeConfidence", "alt-005-00", 8 },
+    { "AltitudeConfidence", "alt-010-00", 9 },
+    { "AltitudeConfidence", "alt-020-00", 10 },
+    { "AltitudeConfidence", "alt-050-00", 11 },
+    { "AltitudeConfidence", "alt-100-00", 12 },
+    { "AltitudeConfidence", "alt-200-00", 13 },
+    { "AltitudeConfidence", "outOfRange", 14 },
+    { "AltitudeConfidence", "unavailable", 15 },
+    { "AnimalPropelledType", "unavailable", 0 },
+    { "AnimalPropelledType", "otherTypes", 1 },
+    { "AnimalPropelledType", "animalMounted", 2 },
+    { "AnimalPropelledType", "animalDrawnCarriage", 3 },
+    { "AnimalType", "unavailable", 0 },
+    { "AnimalType", "serviceUse", 1 },
+    { "AnimalType", "pet", 2 },
+    { "AnimalType", "farm", 3 },
+    { "AntiLockBrakeStatus", "unavailable", 0 },
+    { "AntiLockBrakeStatus", "off", 1 },
+    { "AntiLockBrakeStatus", "on", 2 },
+    { "AntiLockBrakeStatus", "engaged", 3 },
+    { "Attachment", "unavailable", 0 },
+    { "Attachment", "stroller", 1 },
+    { "Attachment", "bicycleTrailer", 2 },
+    { "Attachment", "cart", 3 },
+    { "Attachment", "wheelchair", 4 },
+    { "Attachment", "otherWalkAssistAttachments", 5 },
+    { "Attachment", "pet", 6 },
+    { "AuxiliaryBrakeStatus", "unavailable", 0 },
+    { "AuxiliaryBrakeStatus", "off", 1 },
+    { "AuxiliaryBrakeStatus", "on", 2 },
+    { "AuxiliaryBrakeStatus", "reserved", 3 },
+    { "BasicVehicleClass", "unknownVehicleClass", 0 },
+    { "BasicVehicleClass", "specialVehicleClass", 1 },
+    { "BasicVehicleClass", "passenger-Vehicle-TypeUnknown", 10 },
+    { "BasicVehicleClass", "passenger-Vehicle-TypeOther", 11 },
+    { "BasicVehicleClass", "lightTruck-Vehicle-TypeUnknown", 20 },
+    { "BasicVehicleClass", "lightTruck-Vehicle-TypeOther", 21 },
+    { "BasicVehicleClass", "truck-Vehicle-TypeUnknown", 25 },
+    { "BasicVehicleClass", "truck-Vehicle-TypeOther", 26 },
+    { "BasicVehicleClass", "truck-axleCnt2", 27 },
+    { "BasicVehicleClass", "truck-axleCnt3", 28 },
+    { "BasicVehicleClass", "truck-axleCnt4", 29 },
+    { "BasicVehicleClass", "truck-axleCnt4Trailer", 30 },
+    { "BasicVehicleClass", "truck-axleCnt5Trailer", 31 },
+    { "BasicVehicleClass", "truck-axleCnt6Trailer", 32 },
+    { "BasicVehicleClass", "truck-axleCnt5MultiTrailer", 33 },
+    { "BasicVehicleClass", "truck-axleCnt6MultiTrailer", 34 },
+    { "BasicVehicleClass", "truck-axleCnt7MultiTrailer", 35 },
+    { "BasicVehicleClass", "motorcycle-TypeUnknown", 40 },
+    { "BasicVehicleClass", "motorcycle-TypeOther", 41 },
+    { "BasicVehicleClass", "motorcycle-Cruiser-Standard", 42 },
+    { "BasicVehicleClass", "motorcycle-SportUnclad", 43 },
+    { "BasicVehicleClass", "motorcycle-SportTouring", 44 },
+    { "BasicVehicleClass", "motorcycle-SuperSport", 45 },
+    { "BasicVehicleClass", "motorcycle-Touring", 46 },
+    { "BasicVehicleClass", "motorcycle-Trike", 47 },
+    { "BasicVehicleClass", "motorcycle-wPassengers", 48 },
+    { "BasicVehicleClass", "transit-TypeUnknown", 50 },
+    { "BasicVehicleClass", "transit-TypeOther", 51 },
+    { "BasicVehicleClass", "transit-BRT", 52 },
+    { "BasicVehicleClass", "transit-ExpressBus", 53 },
+    { "BasicVehicleClass", "transit-LocalBus", 54 },
+    { "BasicVehicleClass", "transit-SchoolBus", 55 },
+    { "BasicVehicleClass", "transit-FixedGuideway", 56 },
+    { "BasicVehicleClass", "transit-Paratransit", 57 },
+    { "BasicVehicleClass", "transit-Paratransit-Ambulance", 58 },
+    { "BasicVehicleClass", "emergency-TypeUnknown", 60 },
+    { "BasicVehicleClass", "emergency-TypeOther", 61 },
+    { "BasicVehicleClass", "emergency-Fire-Light-Vehicle", 62 },
+    { "BasicVehicleClass", "emergency-Fire-Heavy-Vehicle", 63 },
+    { "BasicVehicleClass", "emergency-Fire-Paramedic-Vehicle", 64 },
+    { "BasicVehicleClass", "emergency-Fire-Ambulance-Vehicle", 65 },
+    { "BasicVehicleClass", "emergency-Police-Light-Vehicle", 66 },
+    { "BasicVehicleClass", "emergency-Police-Heavy-Vehicle", 67 },
+    { "BasicVehicleClass", "emergency-Other-Responder", 68 },
+    { "BasicVehicleClass", "emergency-Other-Ambulance", 69 },
+    { "BasicVehicleClass", "otherTraveler-TypeUnknown", 80 },
+    { "BasicVehicleClass", "otherTraveler-TypeOther", 81 },
+    { "BasicVehicleClass", "otherTraveler-Pedestrian", 82 },
+    { "BasicVehicleClass", "otherTraveler-Visually-Disabled", 83 },
+    { "BasicVehicleClass", "otherTraveler-Physically-Disabled", 84 },
+    { "BasicVehicleClass", "otherTraveler-Bicycle", 85 },
+    { "BasicVehicleClass", "otherTraveler-Vulnerable-Roadworker", 86 },
+    { "BasicVehicleClass", "infrastructure-TypeUnknown", 90 },
+    { "BasicVehicleClass", "infrastructure-Fixed", 91 },
+    { "BasicVehicleClass", "infrastructure-Movable", 92 },
+    { "BasicVehicleClass", "equipped-CargoTrailer", 93 },
+    { "BasicVehicleRole", "basicVehicle", 0 },
+    { "BasicVehicleRole", "publicTransport", 1 },
+    { "BasicVehicleRole", "specialTransport", 2 },
+    { "BasicVehicleRole", "dangerousGoods", 3 },
+    { "BasicVehicleRole", "roadWork", 4 },
+    { "BasicVehicleRole", "roadRescue", 5 },
+    { "BasicVehicleRole", "emergency", 6 },
+    { "BasicVehicleRole", "safetyCar", 7 },
+    { "BasicVehicleRole", "none-unknown", 8 },
+    { "BasicVehicleRole", "truck", 9 },
+    { "BasicVehicleRole", "motorcycle", 10 },
+    { "BasicVehicleRole", "roadSideSource", 11 },
+    { "BasicVehicleRole", "police", 12 },
+    { "BasicVehicleRole", "fire", 13 },
+    { "BasicVehicleRole", "ambulance", 14 },
+    { "BasicVehicleRole", "dot", 15 },
+    { "BasicVehicleRole", "transit", 16 },
+    { "BasicVehicleRole", "slowMoving", 17 },
+    { "BasicVehicleRole", "stopNgo", 18 },
+    { "BasicVehicleRole", "cyclist", 19 },
+    { "BasicVehicleRole", "pedestrian", 20 },
+    { "BasicVehicleRole", "nonMotorized", 21 },
+    { "BasicVehicleRole", "military", 22 },
+    { "BrakeAppliedPressure", "unavailable", 0 },
+    { "BrakeAppliedPressure", "minPressure", 1 },
+    { "BrakeAppliedPressure", "bkLvl-2", 2 },
+    { "BrakeAppliedPressure", "bkLvl-3", 3 },
+    { "BrakeAppliedPressure", "bkLvl-4", 4 },
+    { "BrakeAppliedPressure", "bkLvl-5", 5 },
+    { "BrakeAppliedPressure", "bkLvl-6", 6 },
+    { "BrakeAppliedPressure", "bkLvl-7", 7 },
+    { "BrakeAppliedPressure", "bkLvl-8", 8 },
+    { "BrakeAppliedPressure", "bkLvl-9", 9 },
+    { "BrakeAppliedPressure", "bkLvl-10", 10 },
+    { "BrakeAppliedPressure", "bkLvl-11", 11 },
+    { "BrakeAppliedPressure", "bkLvl-12", 12 },
+    { "BrakeAppliedPressure", "bkLvl-13", 13 },
+    { "BrakeAppliedPressure", "bkLvl-14", 14 },
+    { "BrakeAppliedPressure", "maxPressure", 15 },
+    { "BrakeBoostApplied", "unavailable", 0 },
+    { "BrakeBoostApplied", "off", 1 },
+    { "BrakeBoostApplied", "on", 2 },
+    { "DSRCmsgID", "reservedMessageId-D", 0 },
+    { "DSRCmsgID", "alaCarteMessage-D", 1 },
+    { "DSRCmsgID", "basicSafetyMessage-D", 2 },
+    { "DSRCmsgID", "basicSafetyMessageVerbose-D", 3 },
+    { "DSRCmsgID", "commonSafetyRequest-D", 4 },
+    { "DSRCmsgID", "emergencyVehicleAlert-D", 5 },
+    { "DSRCmsgID", "intersectionCollision-D", 6 },
+    { "DSRCmsgID", "mapData-D", 7 },
+    { "DSRCmsgID", "nmeaCorrections-D", 8 },
+    { "DSRCmsgID", "probeDataManagement-D", 9 },
+    { "DSRCmsgID", "probeVehicleData-D", 10 },
+    { "DSRCmsgID", "roadSideAlert-D", 11 },
+    { "DSRCmsgID", "rtcmCorrections-D", 12 },
+    { "DSRCmsgID", "signalPhaseAndTimingMessage-D", 13 },
+    { "DSRCmsgID", "signalRequestMessage-D", 14 },
+    { "DSRCmsgID", "signalStatusMessage-D", 15 },
+    { "DSRCmsgID", "travelerInformation-D", 16 },
+    { "DSRCmsgID", "uperFrame-D", 17 },
+    { "DSRCmsgID", "mapData", 18 },
+    { "DSRCmsgID", "signalPhaseAndTimingMessage", 19 },
+    { "DSRCmsgID", "basicSafetyMessage", 20 },
+    { "DSRCmsgID", "commonSafetyRequest", 21 },
+    { "DSRCmsgID", "emergencyVehicleAlert", 22 },
+    { "DSRCmsgID", "intersectionCollision", 23 },
+    { "DSRCmsgID", "nmeaCorrections", 24 },
+    { "DSRCmsgID", "probeDataManagement", 25 },
+    { "DSRCmsgID", "probeVehicleData", 26 },
+    { "DSRCmsgID", "roadSideAlert", 27 },
+    { "DSRCmsgID", "rtcmCorrections", 28 },
+    { "DSRCmsgID", "signalRequestMessage", 29 },
+    { "DSRCmsgID", "signalStatusMessage", 30 },
+    { "DSRCmsgID", "travelerInformation", 31 },
+    { "DSRCmsgID", "personalSafetyMessage", 32 },
+    { "DSRCmsgID", "testMessage00", 240 },
+    { "DSRCmsgID", "testMessage01", 241 },
+    { "DSRCmsgID", "testMessage02", 242 },
+    { "DSRCmsgID", "testMessage03", 243 },
+    { "DSRCmsgID", "testMessage04", 244 },
+    { "DSRCmsgID", "testMessage05", 245 },
+    { "DSRCmsgID", "testMessage06", 246 },
+    { "DSRCmsgID", "testMessage07", 247 },
+    { "DSRCmsgID", "testMessage08", 248 },
+    { "DSRCmsgID", "testMessage09", 249 },
+    { "DSRCmsgID", "testMessage10", 250 },
+    { "DSRCmsgID", "testMessage11", 251 },
+    { "DSRCmsgID", "testMessage12", 252 },
+    { "DSRCmsgID", "testMessage13", 253 },
+    { "DSRCmsgID", "testMessage14", 254 },
+    { "DSRCmsgID", "testMessage15", 255 },
+    { "DayOfWeek", "unknown", 0 },
+    { "DayOfWeek", "monday", 1 },
+    { "DayOfWeek", "tuesday", 2 },
+    { "DayOfWeek", "wednesday", 3 },
+    { "DayOfWeek", "thursday", 4 },
+    { "DayOfWeek", "friday", 5 },
+    { "DayOfWeek", "saturday", 6 },
+    { "DayOfWeek", "sunday", 7 },
+    { "DirectionOfUse", "unavailable", 0 },
+    { "DirectionOfUse", "forward", 1 },
+    { "DirectionOfUse", "reverse", 2 },
+    { "DirectionOfUse", "both", 3 },
+    { "DistanceUnits", "centimeter", 0 },
+    { "DistanceUnits", "cm2-5", 1 },
+    { "DistanceUnits", "decimeter", 2 },
+    { "DistanceUnits", "meter", 3 },
+    { "DistanceUnits", "kilometer", 4 },
+    { "DistanceUnits", "foot", 5 },
+    { "DistanceUnits", "yard", 6 },
+    { "DistanceUnits", "mile", 7 },
+    { "ElevationConfidence", "unavailable", 0 },
+    { "ElevationConfidence", "elev-500-00", 1 },
+    { "ElevationConfidence", "elev-200-00", 2 },
+    { "ElevationConfidence", "elev-100-00", 3 },
+    { "ElevationConfidence", "elev-050-00", 4 },
+    { "ElevationConfidence", "elev-020-00", 5 },
+    { "ElevationConfidence", "elev-010-00", 6 },
+    { "ElevationConfidence", "elev-005-00", 7 },
+    { "ElevationConfidence", "elev-002-00", 8 },
+    { "ElevationConfidence", "elev-001-00", 9 },
+    { "ElevationConfidence", "elev-000-50", 10 },
+    { "ElevationConfidence", "elev-000-20", 11 },
+    { "ElevationConfidence", "elev-000-10", 12 },
+    { "ElevationConfidence", "elev-000-05", 13 },
+    { "ElevationConfidence", "elev-000-02", 14 },
+    { "ElevationConfidence", "elev-000-01", 15 },
+    { "EmissionType", "typeA", 0 },
+    { "EmissionType", "typeB", 1 },
+    { "EmissionType", "typeC", 2 },
+    { "EmissionType", "typeD", 3 },
+    { "EmissionType", "typeE", 4 },
+    { "EssPrecipSituation", "other", 1 },
+    { "EssPrecipSituation", "unknown", 2 },
+    { "EssPrecipSituation", "noPrecipitation", 3 },
+    { "EssPrecipSituation", "unidentifiedSlight", 4 },
+    { "EssPrecipSituation", "unidentifiedModerate", 5 },
+    { "EssPrecipSituation", "unidentifiedHeavy", 6 },
+    { "EssPrecipSituation", "snowSlight", 7 },
+    { "EssPrecipSituation", "snowModerate", 8 },
+    { "EssPrecipSituation", "snowHeavy", 9 },
+    { "EssPrecipSituation", "rainSlight", 10 },
+    { "EssPrecipSituation", "rainModerate", 11 },
+    { "EssPrecipSituation", "rainHeavy", 12 },
+    { "EssPrecipSituation", "frozenPrecipitationSlight", 13 },
+    { "EssPrecipSituation", "frozenPrecipitationModerate", 14 },
+    { "EssPrecipSituation", "frozenPrecipitationHeavy", 15 },
+    { "EssPrecipYesNo", "precip", 1 },
+    { "EssPrecipYesNo", "noPrecip", 2 },
+    { "EssPrecipYesNo", "error", 3 },
+    { "Extent", "useInstantlyOnly", 0 },
+    { "Extent", "useFor3meters", 1 },
+    { "Extent", "useFor10meters", 2 },
+    { "Extent", "useFor50meters", 3 },
+    { "Extent", "useFor100meters", 4 },
+    { "Extent", "useFor500meters", 5 },
+    { "Extent", "useFor1000meters", 6 },
+    { "Extent", "useFor5000meters", 7 },
+    { "Extent", "useFor10000meters", 8 },
+    { "Extent", "useFor50000meters", 9 },
+    { "Extent", "useFor100000meters", 10 },
+    { "Extent", "useFor500000meters", 11 },
+    { "Extent", "useFor1000000meters", 12 },
+    { "Extent", "useFor5000000meters", 13 },
+    { "Extent", "useFor10000000meters", 14 },
+    { "Extent", "forever", 15 },
+    { "FuelType", "unknownFuel", 0 },
+    { "FuelType", "gasoline", 1 },
+    { "FuelType", "ethanol", 2 },
+    { "FuelType", "diesel", 3 },
+    { "FuelType", "electric", 4 },
+    { "FuelType", "hybrid", 5 },
+    { "FuelType", "hydrogen", 6 },
+    { "FuelType", "natGasLiquid", 7 },
+    { "FuelType", "natGasComp", 8 },
+    { "FuelType", "propane", 9 },
+    { "GenericLocations", "on-bridges", 7937 },
+    { "GenericLocations", "in-tunnels", 7938 },
+    { "GenericLocations", "entering-or-leaving-tunnels", 7939 },
+    { "GenericLocations", "on-ramps", 7940 },
+    { "GenericLocations", "in-road-construction-area", 7941 },
+    { "GenericLocations", "around-a-curve", 7942 },
+    { "GenericLocations", "on-minor-roads", 7943 },
+    { "GenericLocations", "in-the-opposing-lanes", 7944 },
+    { "GenericLocations", "adjacent-to-roadway", 7945 },
+    { "GenericLocations", "on-bend", 7946 },
+    { "GenericLocations", "entire-intersection", 7947 },
+    { "GenericLocations", "in-the-median", 7948 },
+    { "GenericLocations", "moved-to-side-of-road", 7949 },
+    { "GenericLocations", "moved-to-shoulder", 7950 },
+    { "GenericLocations", "on-the-roadway", 7951 },
+    { "GenericLocations", "in-shaded-areas", 7952 },
+    { "GenericLocations", "in-low-lying-areas", 7953 },
+    { "GenericLocations", "in-the-downtown-area", 7954 },
+    { "GenericLocations", "in-the-inner-city-area", 7955 },
+    { "GenericLocations", "in-parts", 7956 },
+    { "GenericLocations", "in-some-places", 7957 },
+    { "GenericLocations", "in-the-ditch", 7958 },
+    { "GenericLocations", "in-the-valley", 7959 },
+    { "GenericLocations", "on-hill-top", 7960 },
+    { "GenericLocations", "near-the-foothills", 7961 },
+    { "GenericLocations", "at-high-altitudes", 7962 },
+    { "GenericLocations", "near-the-lake", 7963 },
+    { "GenericLocations", "near-the-shore", 7964 },
+    { "GenericLocations", "over-the-crest-of-a-hill", 7965 },
+    { "GenericLocations", "other-than-on-the-roadway", 7966 },
+    { "GenericLocations", "near-the-beach", 7967 },
+    { "GenericLocations", "near-beach-access-point", 7968 },
+    { "GenericLocations", "lower-level", 7969 },
+    { "GenericLocations", "upper-level", 7970 },
+    { "GenericLocations", "airport", 7971 },
+    { "GenericLocations", "concourse", 7972 },
+    { "GenericLocations", "gate", 7973 },
+    { "GenericLocations", "baggage-claim", 7974 },
+    { "GenericLocations", "customs-point", 7975 },
+    { "GenericLocations", "station", 7976 },
+    { "GenericLocations", "platform", 7977 },
+    { "GenericLocations", "dock", 7978 },
+    { "GenericLocations", "depot", 7979 },
+    { "GenericLocations", "ev-charging-point", 7980 },
+    { "GenericLocations", "information-welcome-point", 7981 },
+    { "GenericLocations", "at-rest-area", 7982 },
+    { "GenericLocations", "at-service-area", 7983 },
+    { "GenericLocations", "at-weigh-station", 7984 },
+    { "GenericLocations", "picnic-areas", 7985 },
+    { "GenericLocations", "rest-area", 7986 },
+    { "GenericLocations", "service-stations", 7987 },
+    { "GenericLocations", "toilets", 7988 },
+    { "GenericLocations", "on-the-right", 7989 },
+    { "GenericLocations", "on-the-left", 7990 },
+    { "GenericLocations", "in-the-center", 7991 },
+    { "GenericLocations", "in-the-opposite-direction", 7992 },
+    { "GenericLocations", "cross-traffic", 7993 },
+    { "GenericLocations", "northbound-traffic", 7994 },
+    { "GenericLocations", "eastbound-traffic", 7995 },
+    { "GenericLocations", "southbound-traffic", 7996 },
+    { "GenericLocations", "westbound-traffic", 7997 },
+    { "GenericLocations", "north", 7998 },
+    { "GenericLocations", "south", 7999 },
+    { "GenericLocations", "east", 8000 },
+    { "GenericLocations", "west", 8001 },
+    { "GenericLocations", "northeast", 8002 },
+    { "GenericLocations", "northwest", 8003 },
+    { "GenericLocations", "southeast", 8004 },
+    { "GenericLocations", "southwest", 8005 },
+    { "GenericLocations", "mountain-pass", 8006 },
+    { "GenericLocations", "reservation-center", 8007 },
+    { "GenericLocations", "nearby-basin", 8008 },
+    { "GenericLocations", "on-tracks", 8009 },
+    { "GenericLocations", "dip", 8010 },
+    { "GenericLocations", "traffic-circle", 8011 },
+    { "GenericLocations", "park-and-ride-lot", 8012 },
+    { "GenericLocations", "to", 8014 },
+    { "GenericLocations", "by", 8015 },
+    { "GenericLocations", "through", 8016 },
+    { "GenericLocations", "area-of", 8017 },
+    { "GenericLocations", "under", 8018 },
+    { "GenericLocations", "over", 8019 },
+    { "GenericLocations", "from", 8020 },
+    { "GenericLocations", "approaching", 8021 },
+    { "GenericLocations", "entering-at", 8022 },
+    { "GenericLocations", "exiting-at", 8023 },
+    { "GenericLocations", "across-tracks", 8024 },
+    { "GenericLocations", "in-street", 8025 },
+    { "GenericLocations", "on-curve", 8026 },
+    { "GenericLocations", "shoulder", 8027 },
+    { "GenericLocations", "crossover", 8028 },
+    { "GenericLocations", "cross-road", 8029 },
+    { "GenericLocations", "side-road", 8030 },
+    { "GenericLocations", "bus-stop", 8031 },
+    { "GenericLocations", "intersection", 8032 },
+    { "GenericLocations", "roadside-park", 8033 },
+    { "HeadingConfidence", "unavailable", 0 },
+    { "HeadingConfidence", "prec10deg", 1 },
+    { "HeadingConfidence", "prec05deg", 2 },
+    { "HeadingConfidence", "prec01deg", 3 },
+    { "HeadingConfidence", "prec0-1deg", 4 },
+    { "HeadingConfidence", "prec0-05deg", 5 },
+    { "HeadingConfidence", "prec0-01deg", 6 },
+    { "HeadingConfidence", "prec0-0125deg", 7 },
+    { "Holiday", "weekday", 0 },
+    { "Holiday", "holiday", 1 },
+    { "HumanPropelledType", "unavailable", 0 },
+    { "HumanPropelledType", "otherTypes", 1 },
+    { "HumanPropelledType", "onFoot", 2 },
+    { "HumanPropelledType", "skateboard", 3 },
+    { "HumanPropelledType", "pushOrKickScooter", 4 },
+    { "HumanPropelledType", "wheelchair", 5 },
+    { "IncidentResponseEquipment", "ground-fire-suppression", 9985 },
+    { "IncidentResponseEquipment", "heavy-ground-equipment", 9986 },
+    { "IncidentResponseEquipment", "aircraft", 9988 },
+    { "IncidentResponseEquipment", "marine-equipment", 9989 },
+    { "IncidentResponseEquipment", "support-equipment", 9990 },
+    { "IncidentResponseEquipment", "medical-rescue-unit", 9991 },
+    { "IncidentResponseEquipment", "other", 9993 },
+    { "IncidentResponseEquipment", "ground-fire-suppression-other", 9994 },
+    { "IncidentResponseEquipment", "engine", 9995 },
+    { "IncidentResponseEquipment", "truck-or-aerial", 9996 },
+    { "IncidentResponseEquipment", "quint", 9997 },
+    { "IncidentResponseEquipment", "tanker-pumper-combination", 9998 },
+    { "IncidentResponseEquipment", "brush-truck", 10000 },
+    { "IncidentResponseEquipment", "aircraft-rescue-firefighting", 10001 },
+    { "IncidentResponseEquipment", "heavy-ground-equipment-other", 10004 },
+    { "IncidentResponseEquipment", "dozer-or-plow", 10005 },
+    { "IncidentResponseEquipment", "tractor", 10006 },
+    { "IncidentResponseEquipment", "tanker-or-tender", 10008 },
+    { "IncidentResponseEquipment", "aircraft-other", 10024 },
+    { "IncidentResponseEquipment", "aircraft-fixed-wing-tanker", 10025 },
+    { "IncidentResponseEquipment", "helitanker", 10026 },
+    { "IncidentResponseEquipment", "helicopter", 10027 },
+    { "IncidentResponseEquipment", "marine-equipment-other", 10034 },
+    { "IncidentResponseEquipment", "fire-boat-with-pump", 10035 },
+    { "IncidentResponseEquipment", "boat-no-pump", 10036 },
+    { "IncidentResponseEquipment", "support-apparatus-other", 10044 },
+    { "IncidentResponseEquipment", "breathing-apparatus-support", 10045 },
+    { "IncidentResponseEquipment", "light-and-air-unit", 10046 },
+    { "IncidentResponseEquipment", "medical-rescue-unit-other", 10054 },
+    { "IncidentResponseEquipment", "rescue-unit", 10055 },
+    { "IncidentResponseEquipment", "urban-search-rescue-unit", 10056 },
+    { "IncidentResponseEquipment", "high-angle-rescue", 10057 },
+    { "IncidentResponseEquipment", "crash-fire-rescue", 10058 },
+    { "IncidentResponseEquipment", "bLS-unit", 10059 },
+    { "IncidentResponseEquipment", "aLS-unit", 10060 },
+    { "IncidentResponseEquipment", "mobile-command-post", 10075 },
+    { "IncidentResponseEquipment", "chief-officer-car", 10076 },
+    { "IncidentResponseEquipment", "hAZMAT-unit", 10077 },
+    { "IncidentResponseEquipment", "type-i-hand-crew", 10078 },
+    { "IncidentResponseEquipment", "type-ii-hand-crew", 10079 },
+    { "IncidentResponseEquipment", "privately-owned-vehicle", 10083 },
+    { "IncidentResponseEquipment", "other-apparatus-resource", 10084 },
+    { "IncidentResponseEquipment", "ambulance", 10085 },
+    { "IncidentResponseEquipment", "bomb-squad-van", 10086 },
+    { "IncidentResponseEquipment", "combine-harvester", 10087 },
+    { "IncidentResponseEquipment", "construction-vehicle", 10088 },
+    { "IncidentResponseEquipment", "farm-tractor", 10089 },
+    { "IncidentResponseEquipment", "grass-cutting-machines", 10090 },
+    { "IncidentResponseEquipment", "hAZMAT-containment-tow", 10091 },
+    { "IncidentResponseEquipment", "heavy-tow", 10092 },
+    { "IncidentResponseEquipment", "hedge-cutting-machines", 10093 },
+    { "IncidentResponseEquipment", "light-tow", 10094 },
+    { "IncidentResponseEquipment", "mobile-crane", 10095 },
+    { "IncidentResponseEquipment", "refuse-collection-vehicle", 10096 },
+    { "IncidentResponseEquipment", "resurfacing-vehicle", 10097 },
+    { "IncidentResponseEquipment", "road-sweeper", 10098 },
+    { "IncidentResponseEquipment", "roadside-litter-collection-crews", 10099 },
+    { "IncidentResponseEquipment", "salvage-vehicle", 10100 },
+    { "IncidentResponseEquipment", "sand-truck", 10101 },
+    { "IncidentResponseEquipment", "snowplow", 10102 },
+    { "IncidentResponseEquipment", "steam-roller", 10103 },
+    { "IncidentResponseEquipment", "swat-team-van", 10104 },
+    { "IncidentResponseEquipment", "track-laying-vehicle", 10105 },
+    { "IncidentResponseEquipment", "unknown-vehicle", 10106 },
+    { "IncidentResponseEquipment", "white-lining-vehicle", 10107 },
+    { "IncidentResponseEquipment", "dump-truck", 10108 },
+    { "IncidentResponseEquipment", "supervisor-vehicle", 10109 },
+    { "IncidentResponseEquipment", "snow-blower", 10110 },
+    { "IncidentResponseEquipment", "rotary-snow-blower", 10111 },
+    { "IncidentResponseEquipment", "road-grader", 10112 },
+    { "IncidentResponseEquipment", "steam-truck", 10113 },
+    { "IncidentResponseEquipment", "flatbed-tow", 10114 },
+    { "LayerType", "none", 0 },
+    { "LayerType", "mixedContent", 1 },
+    { "LayerType", "generalMapData", 2 },
+    { "LayerType", "intersectionData", 3 },
+    { "LayerType", "curveData", 4 },
+    { "LayerType", "roadwaySectionData", 5 },
+    { "LayerType", "parkingAreaData", 6 },
+    { "LayerType", "sharedLaneData", 7 },
+    { "LightbarInUse", "unavailable", 0 },
+    { "LightbarInUse", "notInUse", 1 },
+    { "LightbarInUse", "inUse", 2 },
+    { "LightbarInUse", "yellowCautionLights", 3 },
+    { "LightbarInUse", "schooldBusLights", 4 },
+    { "LightbarInUse", "arrowSignsActive", 5 },
+    { "LightbarInUse", "slowMovingVehicle", 6 },
+    { "LightbarInUse", "freqStops", 7 },
+    { "Location-quality", "loc-qual-bt1m", 0 },
+    { "Location-quality", "loc-qual-bt5m", 1 },
+    { "Location-quality", "loc-qual-bt12m", 2 },
+    { "Location-quality", "loc-qual-bt50m", 3 },
+    { "Location-quality", "loc-qual-bt125m", 4 },
+    { "Location-quality", "loc-qual-bt500m", 5 },
+    { "Location-quality", "loc-qual-bt1250m", 6 },
+    { "Location-quality", "loc-qual-unknown", 7 },
+    { "Location-tech", "loc-tech-unknown", 0 },
+    { "Location-tech", "loc-tech-GNSS", 1 },
+    { "Location-tech", "loc-tech-DGPS", 2 },
+    { "Location-tech", "loc-tech-RTK", 3 },
+    { "Location-tech", "loc-tech-PPP", 4 },
+    { "Location-tech", "loc-tech-drGPS", 5 },
+    { "Location-tech", "loc-tech-drDGPS", 6 },
+    { "Location-tech", "loc-tech-dr", 7 },
+    { "Location-tech", "loc-tech-nav", 8 },
+    { "Location-tech", "loc-tech-fault", 9 },
+    { "MUTCDCode", "none", 0 },
+    { "MUTCDCode", "regulatory", 1 },
+    { "MUTCDCode", "warning", 2 },
+    { "MUTCDCode", "maintenance", 3 },
+    { "MUTCDCode", "motoristService", 4 },
+    { "MUTCDCode", "guide", 5 },
+    { "MUTCDCode", "rec", 6 },
+    { "MotorizedPropelledType", "unavailable", 0 },
+    { "MotorizedPropelledType", "otherTypes", 1 },
+    { "MotorizedPropelledType", "wheelChair", 2 },
+    { "MotorizedPropelledType", "bicycle", 3 },
+    { "MotorizedPropelledType", "scooter", 4 },
+    { "MotorizedPropelledType", "selfBalancingDevice", 5 },
+    { "MovementPhaseState", "unavailable", 0 },
+    { "MovementPhaseState", "dark", 1 },
+    { "MovementPhaseState", "stop-Then-Proceed", 2 },
+    { "MovementPhaseState", "stop-And-Remain", 3 },
+    { "MovementPhaseState", "pre-Movement", 4 },
+    { "MovementPhaseState", "permissive-Movement-Allowed", 5 },
+    { "MovementPhaseState", "protected-Movement-Allowed", 6 },
+    { "MovementPhaseState", "permissive-clearance", 7 },
+    { "MovementPhaseState", "protected-clearance", 8 },
+    { "MovementPhaseState", "caution-Conflicting-Traffic", 9 },
+    { "MultiVehicleResponse", "unavailable", 0 },
+    { "MultiVehicleResponse", "singleVehicle", 1 },
+    { "MultiVehicleResponse", "multiVehicle", 2 },
+    { "MultiVehicleResponse", "reserved", 3 },
+    { "NMEA-Revision", "unknown", 0 },
+    { "NMEA-Revision", "reserved", 1 },
+    { "NMEA-Revision", "rev1", 2 },
+    { "NMEA-Revision", "rev2", 3 },
+    { "NMEA-Revision", "rev3", 4 },
+    { "NMEA-Revision", "rev4", 5 },
+    { "NMEA-Revision", "rev5", 6 },
+    { "NodeAttributeLL", "reserved", 0 },
+    { "NodeAttributeLL", "stopLine", 1 },
+    { "NodeAttributeLL", "roundedCapStyleA", 2 },
+    { "NodeAttributeLL", "roundedCapStyleB", 3 },
+    { "NodeAttributeLL", "mergePoint", 4 },
+    { "NodeAttributeLL", "divergePoint", 5 },
+    { "NodeAttributeLL", "downstreamStopLine", 6 },
+    { "NodeAttributeLL", "downstreamStartNode", 7 },
+    { "NodeAttributeLL", "closedToTraffic", 8 },
+    { "NodeAttributeLL", "safeIsland", 9 },
+    { "NodeAttributeLL", "curbPresentAtStepOff", 10 },
+    { "NodeAttributeLL", "hydrantPresent", 11 },
+    { "NodeAttributeXY", "reserved", 0 },
+    { "NodeAttributeXY", "stopLine", 1 },
+    { "NodeAttributeXY", "roundedCapStyleA", 2 },
+    { "NodeAttributeXY", "roundedCapStyleB", 3 },
+    { "NodeAttributeXY", "mergePoint", 4 },
+    { "NodeAttributeXY", "divergePoint", 5 },
+    { "NodeAttributeXY", "downstreamStopLine", 6 },
+    { "NodeAttributeXY", "downstreamStartNode", 7 },
+    { "NodeAttributeXY", "closedToTraffic", 8 },
+    { "NodeAttributeXY", "safeIsland", 9 },
+    { "NodeAttributeXY", "curbPresentAtStepOff", 10 },
+    { "NodeAttributeXY", "hydrantPresent", 11 },
+    { "NumberOfParticipantsInCluster", "unavailable", 0 },
+    { "NumberOfParticipantsInCluster", "small", 1 },
+    { "NumberOfParticipantsInCluster", "medium", 2 },
+    { "NumberOfParticipantsInCluster", "large", 3 },
+    { "PartII-Id", "vehicleSafetyExt", 0 },
+    { "PartII-Id", "specialVehicleExt", 1 },
+    { "PartII-Id", "supplementalVehicleExt", 2 },
+    { "PersonalDeviceUserType", "unavailable", 0 },
+    { "PersonalDeviceUserType", "aPEDESTRIAN", 1 },
+    { "PersonalDeviceUserType", "aPEDALCYCLIST", 2 },
+    { "PersonalDeviceUserType", "aPUBLICSAFETYWORKER", 3 },
+    { "PersonalDeviceUserType", "anANIMAL", 4 },
+    { "PositionConfidence", "unavailable", 0 },
+    { "PositionConfidence", "a500m", 1 },
+    { "PositionConfidence", "a200m", 2 },
+    { "PositionConfidence", "a100m", 3 },
+    { "PositionConfidence", "a50m", 4 },
+    { "PositionConfidence", "a20m", 5 },
+    { "PositionConfidence", "a10m", 6 },
+    { "PositionConfidence", "a5m", 7 },
+    { "PositionConfidence", "a2m", 8 },
+    { "PositionConfidence", "a1m", 9 },
+    { "PositionConfidence", "a50cm", 10 },
+    { "PositionConfidence", "a20cm", 11 },
+    { "PositionConfidence", "a10cm", 12 },
+    { "PositionConfidence", "a5cm", 13 },
+    { "PositionConfidence", "a2cm", 14 },
+    { "PositionConfidence", "a1cm", 15 },
+    { "PrioritizationResponseStatus", "unknown", 0 },
+    { "PrioritizationResponseStatus", "requested", 1 },
+    { "PrioritizationResponseStatus", "processing", 2 },
+    { "PrioritizationResponseStatus", "watchOtherTraffic", 3 },
+    { "PrioritizationResponseStatus", "granted", 4 },
+    { "PrioritizationResponseStatus", "rejected", 5 },
+    { "PrioritizationResponseStatus", "maxPresence", 6 },
+    { "PrioritizationResponseStatus", "reserviceLocked", 7 },
+    { "PriorityRequestType", "priorityRequestTypeReserved", 0 },
+    { "PriorityRequestType", "priorityRequest", 1 },
+    { "PriorityRequestType", "priorityRequestUpdate", 2 },
+    { "PriorityRequestType", "priorityCancellation", 3 },
+    { "PublicSafetyEventResponderWorkerType", "unavailable", 0 },
+    { "PublicSafetyEventResponderWorkerType", "towOperater", 1 },
+    { "PublicSafetyEventResponderWorkerType", "fireAndEMSWorker", 2 },
+    { "PublicSafetyEventResponderWorkerType", "aDOTWorker", 3 },
+    { "PublicSafetyEventResponderWorkerType", "lawEnforcement", 4 },
+    { "PublicSafetyEventResponderWorkerType", "hazmatResponder", 5 },
+    { "PublicSafetyEventResponderWorkerType", "animalControlWorker", 6 },
+    { "PublicSafetyEventResponderWorkerType", "otherPersonnel", 7 },
+    { "RTCM-Revision", "unknown", 0 },
+    { "RTCM-Revision", "rtcmRev2", 1 },
+    { "RTCM-Revision", "rtcmRev3", 2 },
+    { "RTCM-Revision", "reserved", 3 },
+    { "RainSensor", "none", 0 },
+    { "RainSensor", "lightMist", 1 },
+    { "RainSensor", "heavyMist", 2 },
+    { "RainSensor", "lightRainOrDrizzle", 3 },
+    { "RainSensor", "rain", 4 },
+    { "RainSensor", "moderateRain", 5 },
+    { "RainSensor", "heavyRain", 6 },
+    { "RainSensor", "heavyDownpour", 7 },
+    { "RegionId", "noRegion", 0 },
+    { "RegionId", "addGrpA", 1 },
+    { "RegionId", "addGrpB", 2 },
+    { "RegionId", "addGrpC", 3 },
+    { "RequestImportanceLevel", "requestImportanceLevelUnKnown", 0 },
+    { "RequestImportanceLevel", "requestImportanceLevel1", 1 },
+    { "RequestImportanceLevel", "requestImportanceLevel2", 2 },
+    { "RequestImportanceLevel", "requestImportanceLevel3", 3 },
+    { "RequestImportanceLevel", "requestImportanceLevel4", 4 },
+    { "RequestImportanceLevel", "requestImportanceLevel5", 5 },
+    { "RequestImportanceLevel", "requestImportanceLevel6", 6 },
+    { "RequestImportanceLevel", "requestImportanceLevel7", 7 },
+    { "RequestImportanceLevel", "requestImportanceLevel8", 8 },
+    { "RequestImportanceLevel", "requestImportanceLevel9", 9 },
+    { "RequestImportanceLevel", "requestImportanceLevel10", 10 },
+    { "RequestImportanceLevel", "requestImportanceLevel11", 11 },
+    { "RequestImportanceLevel", "requestImportanceLevel12", 12 },
+    { "RequestImportanceLevel", "requestImportanceLevel13", 13 },
+    { "RequestImportanceLevel", "requestImportanceLevel14", 14 },
+    { "RequestImportanceLevel", "requestImportanceReserved", 15 },
+    { "RequestSubRole", "requestSubRoleUnKnown", 0 },
+    { "RequestSubRole", "requestSubRole1", 1 },
+    { "RequestSubRole", "requestSubRole2", 2 },
+    { "RequestSubRole", "requestSubRole3", 3 },
+    { "RequestSubRole", "requestSubRole4", 4 },
+    { "RequestSubRole", "requestSubRole5", 5 },
+    { "RequestSubRole", "requestSubRole6", 6 },
+    { "RequestSubRole", "requestSubRole7", 7 },
+    { "RequestSubRole", "requestSubRole8", 8 },
+    { "RequestSubRole", "requestSubRole9", 9 },
+    { "RequestSubRole", "requestSubRole10", 10 },
+    { "RequestSubRole", "requestSubRole11", 11 },
+    { "RequestSubRole", "requestSubRole12", 12 },
+    { "RequestSubRole", "requestSubRole13", 13 },
+    { "RequestSubRole", "requestSubRole14", 14 },
+    { "RequestSubRole", "requestSubRoleReserved", 15 },
+    { "RequestedItem", "reserved", 0 },
+    { "RequestedItem", "itemA", 1 },
+    { "RequestedItem", "itemB", 2 },
+    { "RequestedItem", "itemC", 3 },
+    { "RequestedItem", "itemD", 4 },
+    { "RequestedItem", "itemE", 5 },
+    { "RequestedItem", "itemF", 6 },
+    { "RequestedItem", "itemG", 7 },
+    { "RequestedItem", "itemI", 8 },
+    { "RequestedItem", "itemJ", 9 },
+    { "RequestedItem", "itemK", 10 },
+    { "RequestedItem", "itemL", 11 },
+    { "RequestedItem", "itemM", 12 },
+    { "RequestedItem", "itemN", 13 },
+    { "RequestedItem", "itemO", 14 },
+    { "RequestedItem", "itemP", 15 },
+    { "RequestedItem", "itemQ", 16 },
+    { "ResponderGroupAffected", "emergency-vehicle-units", 9729 },
+    { "ResponderGroupAffected", "federal-law-enforcement-units", 9730 },
+    { "ResponderGroupAffected", "state-police-units", 9731 },
+    { "ResponderGroupAffected", "county-police-units", 9732 },
+    { "ResponderGroupAffected", "local-police-units", 9733 },
+    { "ResponderGroupAffected", "ambulance-units", 9734 },
+    { "ResponderGroupAffected", "rescue-units", 9735 },
+    { "ResponderGroupAffected", "fire-units", 9736 },
+    { "ResponderGroupAffected", "hAZMAT-units", 9737 },
+    { "ResponderGroupAffected", "light-tow-unit", 9738 },
+    { "ResponderGroupAffected", "heavy-tow-unit", 9739 },
+    { "ResponderGroupAffected", "freeway-service-patrols", 9740 },
+    { "ResponderGroupAffected", "transportation-response-units", 9741 },
+    { "ResponderGroupAffected", "private-contractor-response-units", 9742 },
+    { "ResponseType", "notInUseOrNotEquipped", 0 },
+    { "ResponseType", "emergency", 1 },
+    { "ResponseType", "nonEmergency", 2 },
+    { "ResponseType", "pursuit", 3 },
+    { "ResponseType", "stationary", 4 },
+    { "ResponseType", "slowMoving", 5 },
+    { "ResponseType", "stopAndGoMovement", 6 },
+    { "RestrictionAppliesTo", "none", 0 },
+    { "RestrictionAppliesTo", "equippedTransit", 1 },
+    { "RestrictionAppliesTo", "equippedTaxis", 2 },
+    { "RestrictionAppliesTo", "equippedOther", 3 },
+    { "RestrictionAppliesTo", "emissionCompliant", 4 },
+    { "RestrictionAppliesTo", "equippedBicycle", 5 },
+    { "RestrictionAppliesTo", "weightCompliant", 6 },
+    { "RestrictionAppliesTo", "heightCompliant", 7 },
+    { "RestrictionAppliesTo", "pedestrians", 8 },
+    { "RestrictionAppliesTo", "slowMovingPersons", 9 },
+    { "RestrictionAppliesTo", "wheelchairUsers", 10 },
+    { "RestrictionAppliesTo", "visualDisabilities", 11 },
+    { "RestrictionAppliesTo", "audioDisabilities", 12 },
+    { "RestrictionAppliesTo", "otherUnknownDisabilities", 13 },
+    { "SegmentAttributeLL", "reserved", 0 },
+    { "SegmentAttributeLL", "doNotBlock", 1 },
+    { "SegmentAttributeLL", "whiteLine", 2 },
+    { "SegmentAttributeLL", "mergingLaneLeft", 3 },
+    { "SegmentAttributeLL", "mergingLaneRight", 4 },
+    { "SegmentAttributeLL", "curbOnLeft", 5 },
+    { "SegmentAttributeLL", "curbOnRight", 6 },
+    { "SegmentAttributeLL", "loadingzoneOnLeft", 7 },
+    { "SegmentAttributeLL", "loadingzoneOnRight", 8 },
+    { "SegmentAttributeLL", "turnOutPointOnLeft", 9 },
+    { "SegmentAttributeLL", "turnOutPointOnRight", 10 },
+    { "SegmentAttributeLL", "adjacentParkingOnLeft", 11 },
+    { "SegmentAttributeLL", "adjacentParkingOnRight", 12 },
+    { "SegmentAttributeLL", "adjacentBikeLaneOnLeft", 13 },
+    { "SegmentAttributeLL", "adjacentBikeLaneOnRight", 14 },
+    { "SegmentAttributeLL", "sharedBikeLane", 15 },
+    { "SegmentAttributeLL", "bikeBoxInFront", 16 },
+    { "SegmentAttributeLL", "transitStopOnLeft", 17 },
+    { "SegmentAttributeLL", "transitStopOnRight", 18 },
+    { "SegmentAttributeLL", "transitStopInLane", 19 },
+    { "SegmentAttributeLL", "sharedWithTrackedVehicle", 20 },
+    { "SegmentAttributeLL", "safeIsland", 21 },
+    { "SegmentAttributeLL", "lowCurbsPresent", 22 },
+    { "SegmentAttributeLL", "rumbleStripPresent", 23 },
+    { "SegmentAttributeLL", "audibleSignalingPresent", 24 },
+    { "SegmentAttributeLL", "adaptiveTimingPresent", 25 },
+    { "SegmentAttributeLL", "rfSignalRequestPresent", 26 },
+    { "SegmentAttributeLL", "partialCurbIntrusion", 27 },
+    { "SegmentAttributeLL", "taperToLeft", 28 },
+    { "SegmentAttributeLL", "taperToRight", 29 },
+    { "SegmentAttributeLL", "taperToCenterLine", 30 },
+    { "SegmentAttributeLL", "parallelParking", 31 },
+    { "SegmentAttributeLL", "headInParking", 32 },
+    { "SegmentAttributeLL", "freeParking", 33 },
+    { "SegmentAttributeLL", "timeRestrictionsOnParking", 34 },
+    { "SegmentAttributeLL", "costToPark", 35 },
+    { "SegmentAttributeLL", "midBlockCurbPresent", 36 },
+    { "SegmentAttributeLL", "unEvenPavementPresent", 37 },
+    { "SegmentAttributeXY", "reserved", 0 },
+    { "SegmentAttributeXY", "doNotBlock", 1 },
+    { "SegmentAttributeXY", "whiteLine", 2 },
+    { "SegmentAttributeXY", "mergingLaneLeft", 3 },
+    { "SegmentAttributeXY", "mergingLaneRight", 4 },
+    { "SegmentAttributeXY", "curbOnLeft", 5 },
+    { "SegmentAttributeXY", "curbOnRight", 6 },
+    { "SegmentAttributeXY", "loadingzoneOnLeft", 7 },
+    { "SegmentAttributeXY", "loadingzoneOnRight", 8 },
+    { "SegmentAttributeXY", "turnOutPointOnLeft", 9 },
+    { "SegmentAttributeXY", "turnOutPointOnRight", 10 },
+    { "SegmentAttributeXY", "adjacentParkingOnLeft", 11 },
+    { "SegmentAttributeXY", "adjacentParkingOnRight", 12 },
+    { "SegmentAttributeXY", "adjacentBikeLaneOnLeft", 13 },
+    { "SegmentAttributeXY", "adjacentBikeLaneOnRight", 14 },
+    { "SegmentAttributeXY", "sharedBikeLane", 15 },
+    { "SegmentAttributeXY", "bikeBoxInFront", 16 },
+    { "SegmentAttributeXY", "transitStopOnLeft", 17 },
+    { "SegmentAttributeXY", "transitStopOnRight", 18 },
+    { "SegmentAttributeXY", "transitStopInLane", 19 },
+    { "SegmentAttributeXY", "sharedWithTrackedVehicle", 20 },
+    { "SegmentAttributeXY", "safeIsland", 21 },
+    { "SegmentAttributeXY", "lowCurbsPresent", 22 },
+    { "SegmentAttributeXY", "rumbleStripPresent", 23 },
+    { "SegmentAttributeXY", "audibleSignalingPresent", 24 },
+    { "SegmentAttributeXY", "adaptiveTimingPresent", 25 },
+    { "SegmentAttributeXY", "rfSignalRequestPresent", 26 },
+    { "SegmentAttributeXY", "partialCurbIntrusion", 27 },
+    { "SegmentAttributeXY", "taperToLeft", 28 },
+    { "SegmentAttributeXY", "taperToRight", 29 },
+    { "SegmentAttributeXY", "taperToCenterLine", 30 },
+    { "SegmentAttributeXY", "parallelParking", 31 },
+    { "SegmentAttributeXY", "headInParking", 32 },
+    { "SegmentAttributeXY", "freeParking", 33 },
+    { "SegmentAttributeXY", "timeRestrictionsOnParking", 34 },
+    { "SegmentAttributeXY", "costToPark", 35 },
+    { "SegmentAttributeXY", "midBlockCurbPresent", 36 },
+    { "SegmentAttributeXY", "unEvenPavementPresent", 37 },
+    { "SirenInUse", "unavailable", 0 },
+    { "SirenInUse", "notInUse", 1 },
+    { "SirenInUse", "inUse", 2 },
+    { "SirenInUse", "reserved", 3 },
+    { "SpeedConfidence", "unavailable", 0 },
+    { "SpeedConfidence", "prec100ms", 1 },
+    { "SpeedConfidence", "prec10ms", 2 },
+    { "SpeedConfidence", "prec5ms", 3 },
+    { "SpeedConfidence", "prec1ms", 4 },
+    { "SpeedConfidence", "prec0-1ms", 5 },
+    { "SpeedConfidence", "prec0-05ms", 6 },
+    { "SpeedConfidence", "prec0-01ms", 7 },
+    { "SpeedLimitType", "unknown", 0 },
+    { "SpeedLimitType", "maxSpeedInSchoolZone", 1 },
+    { "SpeedLimitType", "maxSpeedInSchoolZoneWhenChildrenArePresent", 2 },
+    { "SpeedLimitType", "maxSpeedInConstructionZone", 3 },
+    { "SpeedLimitType", "vehicleMinSpeed", 4 },
+    { "SpeedLimitType", "vehicleMaxSpeed", 5 },
+    { "SpeedLimitType", "vehicleNightMaxSpeed", 6 },
+    { "SpeedLimitType", "truckMinSpeed", 7 },
+    { "SpeedLimitType", "truckMaxSpeed", 8 },
+    { "SpeedLimitType", "truckNightMaxSpeed", 9 },
+    { "SpeedLimitType", "vehiclesWithTrailersMinSpeed", 10 },
+    { "SpeedLimitType", "vehiclesWithTrailersMaxSpeed", 11 },
+    { "SpeedLimitType", "vehiclesWithTrailersNightMaxSpeed", 12 },
+    { "StabilityControlStatus", "unavailable", 0 },
+    { "StabilityControlStatus", "off", 1 },
+    { "StabilityControlStatus", "on", 2 },
+    { "StabilityControlStatus", "engaged", 3 },
+    { "SteeringWheelAngleConfidence", "unavailable", 0 },
+    { "SteeringWheelAngleConfidence", "prec2deg", 1 },
+    { "SteeringWheelAngleConfidence", "prec1deg", 2 },
+    { "SteeringWheelAngleConfidence", "prec0-02deg", 3 },
+    { "SummerTime", "notInSummerTime", 0 },
+    { "SummerTime", "inSummerTime", 1 },
+    { "ThrottleConfidence", "unavailable", 0 },
+    { "ThrottleConfidence", "prec10percent", 1 },
+    { "ThrottleConfidence", "prec1percent", 2 },
+    { "ThrottleConfidence", "prec0-5percent", 3 },
+    { "TimeConfidence", "unavailable", 0 },
+    { "TimeConfidence", "time-100-000", 1 },
+    { "TimeConfidence", "time-050-000", 2 },
+    { "TimeConfidence", "time-020-000", 3 },
+    { "TimeConfidence", "time-010-000", 4 },
+    { "TimeConfidence", "time-002-000", 5 },
+    { "TimeConfidence", "time-001-000", 6 },
+    { "TimeConfidence", "time-000-500", 7 },
+    { "TimeConfidence", "time-000-200", 8 },
+    { "TimeConfidence", "time-000-100", 9 },
+    { "TimeConfidence", "time-000-050", 10 },
+    { "TimeConfidence", "time-000-020", 11 },
+    { "TimeConfidence", "time-000-010", 12 },
+    { "TimeConfidence", "time-000-005", 13 },
+    { "TimeConfidence", "time-000-002", 14 },
+    { "TimeConfidence", "time-000-001", 15 },
+    { "TimeConfidence", "time-000-000-5", 16 },
+    { "TimeConfidence", "time-000-000-2", 17 },
+    { "TimeConfidence", "time-000-000-1", 18 },
+    { "TimeConfidence", "time-000-000-05", 19 },
+    { "TimeConfidence", "time-000-000-02", 20 },
+    { "TimeConfidence", "time-000-000-01", 21 },
+    { "TimeConfidence", "time-000-000-005", 22 },
+    { "TimeConfidence", "time-000-000-002", 23 },
+    { "TimeConfidence", "time-000-000-001", 24 },
+    { "TimeConfidence", "time-000-000-000-5", 25 },
+    { "TimeConfidence", "time-000-000-000-2", 26 },
+    { "TimeConfidence", "time-000-000-000-1", 27 },
+    { "TimeConfidence", "time-000-000-000-05", 28 },
+    { "TimeConfidence", "time-000-000-000-02", 29 },
+    { "TimeConfidence", "time-000-000-000-01", 30 },
+    { "TimeConfidence", "time-000-000-000-005", 31 },
+    { "TimeConfidence", "time-000-000-000-002", 32 },
+    { "TimeConfidence", "time-000-000-000-001", 33 },
+    { "TimeConfidence", "time-000-000-000-000-5", 34 },
+    { "TimeConfidence", "time-000-000-000-000-2", 35 },
+    { "TimeConfidence", "time-000-000-000-000-1", 36 },
+    { "TimeConfidence", "time-000-000-000-000-05", 37 },
+    { "TimeConfidence", "time-000-000-000-000-02", 38 },
+    { "TimeConfidence", "time-000-000-000-000-01", 39 },
+    { "TirePressureThresholdDetection", "noData", 0 },
+    { "TirePressureThresholdDetection", "overPressure", 1 },
+    { "TirePressureThresholdDetection", "noWarningPressure", 2 },
+    { "TirePressureThresholdDetection", "underPressure", 3 },
+    { "TirePressureThresholdDetection", "extremeUnderPressure", 4 },
+    { "TirePressureThresholdDetection", "undefined", 5 },
+    { "TirePressureThresholdDetection", "errorIndicator", 6 },
+    { "TirePressureThresholdDetection", "notAvailable", 7 },
+    { "TractionControlStatus", "unavailable", 0 },
+    { "TractionControlStatus", "off", 1 },
+    { "TractionControlStatus", "on", 2 },
+    { "TractionControlStatus", "engaged", 3 },
+    { "TransitVehicleOccupancy", "occupancyUnknown", 0 },
+    { "TransitVehicleOccupancy", "occupancyEmpty", 1 },
+    { "TransitVehicleOccupancy", "occupancyVeryLow", 2 },
+    { "TransitVehicleOccupancy", "occupancyLow", 3 },
+    { "TransitVehicleOccupancy", "occupancyMed", 4 },
+    { "TransitVehicleOccupancy", "occupancyHigh", 5 },
+    { "TransitVehicleOccupancy", "occupancyNearlyFull", 6 },
+    { "TransitVehicleOccupancy", "occupancyFull", 7 },
+    { "TransmissionState", "neutral", 0 },
+    { "TransmissionState", "park", 1 },
+    { "TransmissionState", "forwardGears", 2 },
+    { "TransmissionState", "reverseGears", 3 },
+    { "TransmissionState", "reserved1", 4 },
+    { "TransmissionState", "reserved2", 5 },
+    { "TransmissionState", "reserved3", 6 },
+    { "TransmissionState", "unavailable", 7 },
+    { "TravelerInfoType", "unknown", 0 },
+    { "TravelerInfoType", "advisory", 1 },
+    { "TravelerInfoType", "roadSignage", 2 },
+    { "TravelerInfoType", "commercialSignage", 3 },
+    { "VehicleGroupAffected", "all-vehicles", 9217 },
+    { "VehicleGroupAffected", "bicycles", 9218 },
+    { "VehicleGroupAffected", "motorcycles", 9219 },
+    { "VehicleGroupAffected", "cars", 9220 },
+    { "VehicleGroupAffected", "light-vehicles", 9221 },
+    { "VehicleGroupAffected", "cars-and-light-vehicles", 9222 },
+    { "VehicleGroupAffected", "cars-with-trailers", 9223 },
+    { "VehicleGroupAffected", "cars-with-recreational-trailers", 9224 },
+    { "VehicleGroupAffected", "vehicles-with-trailers", 9225 },
+    { "VehicleGroupAffected", "heavy-vehicles", 9226 },
+    { "VehicleGroupAffected", "trucks", 9227 },
+    { "VehicleGroupAffected", "buses", 9228 },
+    { "VehicleGroupAffected", "articulated-buses", 9229 },
+    { "VehicleGroupAffected", "school-buses", 9230 },
+    { "VehicleGroupAffected", "vehicles-with-semi-trailers", 9231 },
+    { "VehicleGroupAffected", "vehicles-with-double-trailers", 9232 },
+    { "VehicleGroupAffected", "high-profile-vehicles", 9233 },
+    { "VehicleGroupAffected", "wide-vehicles", 9234 },
+    { "VehicleGroupAffected", "long-vehicles", 9235 },
+    { "VehicleGroupAffected", "hazardous-loads", 9236 },
+    { "VehicleGroupAffected", "exceptional-loads", 9237 },
+    { "VehicleGroupAffected", "abnormal-loads", 9238 },
+    { "VehicleGroupAffected", "convoys", 9239 },
+    { "VehicleGroupAffected", "maintenance-vehicles", 9240 },
+    { "VehicleGroupAffected", "delivery-vehicles", 9241 },
+    { "VehicleGroupAffected", "vehicles-with-even-numbered-license-plates", 9242 },
+    { "VehicleGroupAffected", "vehicles-with-odd-numbered-license-plates", 9243 },
+    { "VehicleGroupAffected", "vehicles-with-parking-permits", 9244 },
+    { "VehicleGroupAffected", "vehicles-with-catalytic-converters", 9245 },
+    { "VehicleGroupAffected", "vehicles-without-catalytic-converters", 9246 },
+    { "VehicleGroupAffected", "gas-powered-vehicles", 9247 },
+    { "VehicleGroupAffected", "diesel-powered-vehicles", 9248 },
+    { "VehicleGroupAffected", "lPG-vehicles", 9249 },
+    { "VehicleGroupAffected", "military-convoys", 9250 },
+    { "VehicleGroupAffected", "military-vehicles", 9251 },
+    { "VehicleStatusDeviceTypeTag", "unknown", 0 },
+    { "VehicleStatusDeviceTypeTag", "lights", 1 },
+    { "VehicleStatusDeviceTypeTag", "wipers", 2 },
+    { "VehicleStatusDeviceTypeTag", "brakes", 3 },
+    { "VehicleStatusDeviceTypeTag", "stab", 4 },
+    { "VehicleStatusDeviceTypeTag", "trac", 5 },
+    { "VehicleStatusDeviceTypeTag", "abs", 6 },
+    { "VehicleStatusDeviceTypeTag", "sunS", 7 },
+    { "VehicleStatusDeviceTypeTag", "rainS", 8 },
+    { "VehicleStatusDeviceTypeTag", "airTemp", 9 },
+    { "VehicleStatusDeviceTypeTag", "steering", 10 },
+    { "VehicleStatusDeviceTypeTag", "vertAccelThres", 11 },
+    { "VehicleStatusDeviceTypeTag", "vertAccel", 12 },
+    { "VehicleStatusDeviceTypeTag", "hozAccelLong", 13 },
+    { "VehicleStatusDeviceTypeTag", "hozAccelLat", 14 },
+    { "VehicleStatusDeviceTypeTag", "hozAccelCon", 15 },
+    { "VehicleStatusDeviceTypeTag", "accel4way", 16 },
+    { "VehicleStatusDeviceTypeTag", "confidenceSet", 17 },
+    { "VehicleStatusDeviceTypeTag", "obDist", 18 },
+    { "VehicleStatusDeviceTypeTag", "obDirect", 19 },
+    { "VehicleStatusDeviceTypeTag", "yaw", 20 },
+    { "VehicleStatusDeviceTypeTag", "yawRateCon", 21 },
+    { "VehicleStatusDeviceTypeTag", "dateTime", 22 },
+    { "VehicleStatusDeviceTypeTag", "fullPos", 23 },
+    { "VehicleStatusDeviceTypeTag", "position2D", 24 },
+    { "VehicleStatusDeviceTypeTag", "position3D", 25 },
+    { "VehicleStatusDeviceTypeTag", "vehicle", 26 },
+    { "VehicleStatusDeviceTypeTag", "speedHeadC", 27 },
+    { "VehicleStatusDeviceTypeTag", "speedC", 28 },
+    { "VehicleType", "none", 0 },
+    { "VehicleType", "unknown", 1 },
+    { "VehicleType", "special", 2 },
+    { "VehicleType", "moto", 3 },
+    { "VehicleType", "car", 4 },
+    { "VehicleType", "carOther", 5 },
+    { "VehicleType", "bus", 6 },
+    { "VehicleType", "axleCnt2", 7 },
+    { "VehicleType", "axleCnt3", 8 },
+    { "VehicleType", "axleCnt4", 9 },
+    { "VehicleType", "axleCnt4Trailer", 10 },
+    { "VehicleType", "axleCnt5Trailer", 11 },
+    { "VehicleType", "axleCnt6Trailer", 12 },
+    { "VehicleType", "axleCnt5MultiTrailer", 13 },
+    { "VehicleType", "axleCnt6MultiTrailer", 14 },
+    { "VehicleType", "axleCnt7MultiTrailer", 15 },
+    { "WheelEndElectFault", "isOk", 0 },
+    { "WheelEndElectFault", "isNotDefined", 1 },
+    { "WheelEndElectFault", "isError", 2 },
+    { "WheelEndElectFault", "isNotSupported", 3 },
+    { "WheelSensorStatus", "off", 0 },
+    { "WheelSensorStatus", "on", 1 },
+    { "WheelSensorStatus", "notDefined", 2 },
+    { "WheelSensorStatus", "notSupported", 3 },
+    { "WiperStatus", "unavailable", 0 },
+    { "WiperStatus", "off", 1 },
+    { "WiperStatus", "intermittent", 2 },
+    { "WiperStatus", "low", 3 },
+    { "WiperStatus", "high", 4 },
+    { "WiperStatus", "washerInUse", 5 },
+    { "WiperStatus", "automaticPresent", 6 },
+    { "YawRateConfidence", "unavailable", 0 },
+    { "YawRateConfidence", "degSec-100-00", 1 },
+    { "YawRateConfidence", "degSec-010-00", 2 },
+    { "YawRateConfidence", "degSec-005-00", 3 },
+    { "YawRateConfidence", "degSec-001-00", 4 },
+    { "YawRateConfidence", "degSec-000-10", 5 },
+    { "YawRateConfidence", "degSec-000-05", 6 },
+    { "YawRateConfidence", "degSec-000-01", 7 },
+    { "PersonalDeviceUserType", "pedestrian", 1 },
+    { "PersonalDeviceUserType", "pedalcyclist", 2 },
+    { "PersonalDeviceUserType", "public safety worker", 3 },
+    { "PersonalDeviceUserType", "animal", 4 },
+};
+
+// displacement of each bucket
+static uint16_t const enumDisplacements[LIBSM_ENUM_BUCKETS] = {
+    4, 1, 1, 2, 0, 3, 3, 0, 0, 2, 5, 3,
+    6, 0, 3, 3, 0, 2, 1, 1, 0, 0, 2, 1,
+    0, 5, 3, 0, 0, 0, 2, 0, 3, 2, 0, 0,
+    6, 8, 1, 0, 0, 0, 3, 2, 5, 1, 6, 8,
+    2, 0, 10, 1, 3, 1, 5, 4, 4, 6, 4, 0,
+    0, 1, 3, 2, 0, 0, 2, 2, 1, 0, 0, 2,
+    2, 5, 0, 2, 13, 0, 1, 8, 1, 0, 0, 6,
+    0, 7, 2, 11, 2, 2, 0, 1, 1, 3, 0, 0,
+    1, 1, 0, 4, 0, 4, 2, 0, 1, 1, 3, 12,
+    4, 4, 2, 3, 4, 4, 0, 1, 0, 2, 3, 2,
+    1, 4, 1, 1, 1, 2, 4, 0, 9, 13, 2, 1,
+    0, 0, 0, 4, 0, 2, 3, 0, 1, 3, 0, 2,
+    0, 5, 34, 4, 1, 0, 1, 2, 30, 2, 0, 5,
+    2, 3, 0, 6, 0, 1, 0, 0, 1, 0, 4, 3,
+    1, 7, 6, 0, 14, 1, 8, 0, 0, 8, 0, 1,
+    13, 0, 11, 0, 0, 0, 0, 0, 0, 0, 5, 11,
+    3, 2, 2, 0, 0, 1, 1, 3, 0, 1, 1, 1,
+    2, 1, 0, 13, 1, 0, 1, 3, 7, 3, 2, 5,
+    2, 10, 0, 2, 0, 6, 0, 3, 1, 3, 0, 1,
+    5, 6, 1, 0, 0, 1, 4, 6, 0, 2, 9, 3,
+    9, 13, 3, 0, 2, 0, 0, 1, 3, 0, 2, 0,
+    1, 0, 4, 0,
+};
+
+// 1 + index into enumNames, 0 for a free slot
+static uint16_t const enumSlots[LIBSM_ENUM_SLOTS] = {
+    223, 73, 0, 914, 195, 872, 692, 0, 0, 608, 0, 90, 0, 0, 0, 986,
+    57, 589, 827, 0, 495, 0, 0, 0, 484, 892, 907, 525, 414, 870, 645, 0,
+    0, 48, 725, 0, 342, 0, 955, 203, 0, 398, 851, 0, 0, 321, 0, 0,
+    128, 0, 240, 0, 828, 0, 0, 282, 0, 0, 75, 434, 0, 923, 353, 0,
+    22, 0, 0, 9, 977, 897, 426, 0, 357, 0, 460, 0, 89, 490, 0, 130,
+    0, 857, 0, 0, 0, 970, 198, 724, 54, 0, 0, 0, 248, 207, 408, 976,
+    0, 0, 717, 0, 0, 471, 0, 0, 0, 0, 0, 0, 32, 0, 924, 556,
+    452, 0, 0, 735, 106, 0, 167, 819, 0, 867, 0, 0, 507, 0, 0, 0,
+    0, 996, 209, 0, 650, 758, 928, 0, 235, 0, 753, 0, 0, 578, 601, 273,
+    755, 883, 225, 919, 406, 411, 0, 0, 393, 352, 94, 974, 0, 0, 267, 96,
+    0, 0, 0, 0, 355, 961, 0, 615, 489, 0, 83, 176, 675, 0, 212, 202,
+    12, 0, 0, 0, 0, 0, 292, 0, 0, 256, 0, 0, 0, 0, 270, 611,
+    227, 0, 736, 216, 0, 447, 0, 530, 442, 808, 0, 0, 0, 954, 358, 0,
+    762, 727, 0, 432, 363, 0, 0, 0, 0, 0, 0, 419, 0, 201, 0, 0,
+    0, 444, 0, 893, 920, 0, 0, 59, 181, 114, 0, 91, 0, 0, 0, 761,
+    0, 361, 0, 0, 941, 0, 0, 0, 0, 634, 571, 636, 0, 565, 0, 889,
+    0, 164, 0, 0, 115, 305, 401, 381, 155, 0, 958, 770, 0, 0, 519, 0,
+    0, 599, 559, 0, 0, 117, 0, 425, 0, 0, 173, 691, 0, 582, 0, 869,
+    0, 0, 0, 0, 0, 294, 965, 750, 0, 0, 0, 0, 0, 0, 932, 746,
+    0, 374, 548, 116, 0, 0, 0, 550, 0, 568, 658, 0, 704, 0, 0, 430,
+    933, 229, 577, 0, 163, 0, 0, 0, 0, 297, 15, 0, 0, 800, 0, 247,
+    625, 0, 690, 521, 45, 443, 0, 435, 318, 461, 0, 0, 0, 570, 133, 887,
+    888, 0, 0, 0, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 639, 0, 0, 0, 523, 0, 101, 0, 973, 0, 0, 404, 26,
+    0, 0, 0, 0, 651, 0, 0, 286, 847, 0, 0, 0, 845, 0, 868, 0,
+    180, 0, 2, 287, 0, 0, 0, 0, 0, 131, 711, 214, 14, 24, 0, 983,
+    980, 898, 0, 764, 0, 331, 0, 147, 943, 730, 298, 0, 0, 0, 0, 871,
+    0, 657, 676, 659, 777, 40, 662, 0, 343, 664, 665, 666, 667, 668, 669, 0,
+    0, 0, 276, 505, 0, 910, 987, 617, 376, 573, 284, 603, 978, 0, 0, 0,
+    0, 760, 0, 472, 749, 389, 0, 864, 36, 440, 205, 469, 757, 364, 937, 0,
+    0, 585, 0, 677, 0, 0, 0, 0, 0, 0, 339, 244, 0, 0, 596, 772,
+    13, 538, 790, 0, 0, 0, 77, 200, 127, 0, 544, 0, 0, 81, 0, 0,
+    145, 728, 387, 0, 492, 916, 0, 423, 0, 688, 0, 302, 98, 0, 0, 0,
+    0, 0, 619, 264, 0, 0, 0, 0, 0, 917, 468, 388, 0, 0, 751, 233,
+    0, 149, 807, 272, 0, 0, 4, 410, 0, 0, 0, 595, 0, 421, 291, 522,
+    367, 476, 0, 306, 0, 913, 0, 0, 0, 863, 0, 177, 146, 993, 0, 0,
+    0, 0, 0, 0, 183, 0, 0, 0, 0, 569, 838, 17, 0, 699, 172, 549,
+    0, 0, 132, 0, 0, 493, 789, 780, 47, 29, 0, 0, 693, 0, 953, 0,
+    118, 0, 967, 217, 0, 0, 747, 0, 204, 0, 274, 0, 0, 741, 0, 0,
+    148, 99, 16, 0, 535, 0, 0, 0, 826, 555, 960, 27, 427, 0, 820, 68,
+    18, 0, 0, 0, 0, 653, 162, 0, 0, 581, 895, 335, 0, 0, 1000, 0,
+    792, 431, 795, 0, 360, 989, 781, 0, 0, 85, 854, 0, 362, 0, 0, 266,
+    726, 483, 0, 805, 796, 0, 560, 0, 0, 0, 590, 0, 745, 0, 0, 0,
+    999, 600, 0, 0, 638, 855, 846, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    618, 778, 715, 0, 0, 769, 0, 6, 0, 743, 196, 197, 0, 771, 607, 0,
+    375, 208, 856, 269, 0, 0, 784, 488, 60, 0, 62, 249, 885, 7, 626, 336,
+    628, 0, 0, 631, 0, 558, 0, 169, 0, 0, 0, 931, 674, 0, 0, 220,
+    0, 0, 661, 0, 107, 0, 862, 875, 0, 0, 860, 0, 500, 946, 0, 0,
+    0, 0, 0, 0, 416, 64, 515, 0, 0, 554, 445, 0, 92, 0, 948, 583,
+    65, 708, 213, 0, 853, 0, 193, 0, 865, 0, 586, 0, 824, 0, 0, 0,
+    0, 0, 880, 0, 473, 474, 816, 499, 104, 814, 76, 0, 985, 0, 0, 219,
+    886, 0, 0, 494, 0, 734, 0, 0, 0, 0, 994, 0, 56, 0, 0, 683,
+    378, 0, 0, 731, 850, 775, 251, 0, 482, 50, 0, 520, 402, 479, 896, 0,
+    0, 337, 0, 0, 0, 818, 112, 0, 0, 0, 997, 877, 0, 0, 436, 0,
+    0, 71, 604, 509, 0, 0, 0, 0, 400, 740, 697, 311, 454, 0, 0, 0,
+    424, 684, 517, 0, 670, 0, 949, 0, 0, 157, 0, 382, 0, 0, 385, 944,
+    0, 237, 982, 0, 0, 281, 528, 0, 191, 514, 754, 0, 0, 0, 0, 0,
+    606, 786, 0, 51, 837, 74, 280, 0, 0, 0, 0, 295, 0, 702, 767, 0,
+    0, 344, 0, 0, 906, 660, 0, 246, 446, 981, 0, 0, 0, 412, 296, 531,
+    532, 533, 534, 0, 0, 0, 705, 0, 478, 151, 313, 0, 591, 574, 0, 882,
+    0, 759, 0, 788, 365, 0, 386, 0, 268, 945, 0, 915, 111, 0, 0, 245,
+    0, 718, 0, 0, 0, 673, 0, 0, 396, 0, 0, 0, 975, 0, 0, 0,
+    384, 0, 126, 438, 849, 0, 721, 0, 0, 0, 308, 564, 0, 0, 0, 0,
+    206, 0, 0, 63, 0, 0, 0, 0, 0, 766, 379, 0, 0, 0, 254, 0,
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 832, 37, 0, 0, 0, 0, 0,
+    971, 0, 956, 0, 0, 835, 0, 874, 0, 566, 0, 0, 0, 0, 0, 0,
+    0, 283, 34, 0, 873, 557, 0, 0, 0, 253, 0, 0, 722, 0, 543, 380,
+    403, 0, 0, 348, 811, 0, 0, 0, 100, 938, 843, 0, 0, 491, 0, 0,
+    0, 0, 723, 0, 904, 0, 480, 0, 0, 0, 0, 0, 428, 0, 0, 333,
+    174, 646, 330, 0, 0, 0, 0, 0, 908, 218, 0, 178, 990, 0, 161, 0,
+    0, 420, 397, 891, 0, 0, 0, 0, 0, 0, 309, 0, 171, 0, 496, 0,
+    3, 632, 457, 0, 0, 984, 926, 463, 0, 952, 0, 20, 0, 0, 785, 797,
+    31, 102, 0, 0, 243, 413, 78, 992, 962, 232, 123, 0, 0, 0, 317, 451,
+    0, 0, 0, 0, 0, 0, 0, 0, 834, 0, 0, 641, 642, 643, 644, 449,
+    562, 813, 300, 152, 0, 0, 0, 0, 0, 567, 21, 612, 0, 0, 11, 238,
+    0, 366, 497, 0, 242, 0, 0, 0, 82, 0, 141, 142, 0, 144, 301, 0,
+    513, 485, 0, 0, 536, 783, 0, 323, 512, 0, 584, 0, 464, 624, 0, 0,
+    465, 825, 0, 655, 957, 901, 0, 0, 833, 429, 0, 679, 861, 0, 129, 0,
+    319, 0, 0, 33, 0, 340, 0, 477, 0, 0, 0, 260, 475, 0, 0, 259,
+    326, 0, 0, 0, 231, 0, 97, 0, 0, 929, 226, 456, 0, 210, 0, 0,
+    290, 0, 0, 801, 706, 940, 0, 829, 0, 0, 0, 0, 186, 187, 459, 383,
+    190, 314, 804, 0, 903, 539, 806, 261, 0, 858, 394, 369, 0, 263, 0, 109,
+    0, 0, 876, 0, 0, 848, 964, 0, 0, 0, 621, 899, 623, 794, 0, 124,
+    415, 0, 622, 0, 0, 0, 0, 0, 179, 0, 0, 587, 121, 0, 0, 350,
+    0, 0, 289, 0, 30, 930, 0, 0, 822, 879, 0, 0, 0, 0, 0, 0,
+    0, 0, 890, 0, 592, 55, 0, 902, 325, 0, 0, 840, 921, 188, 839, 0,
+    43, 72, 799, 0, 720, 199, 0, 486, 0, 39, 88, 0, 0, 105, 686, 0,
+    823, 0, 0, 44, 502, 252, 681, 230, 175, 0, 939, 547, 0, 275, 418, 0,
+    38, 0, 0, 52, 0, 918, 0, 842, 0, 234, 815, 654, 0, 194, 467, 278,
+    347, 372, 458, 0, 70, 701, 0, 763, 773, 0, 545, 487, 0, 0, 0, 947,
+    277, 329, 748, 368, 542, 299, 526, 0, 0, 0, 0, 0, 170, 0, 537, 0,
+    293, 787, 0, 739, 0, 0, 345, 279, 0, 250, 696, 0, 341, 546, 0, 0,
+    182, 0, 422, 0, 0, 1, 841, 405, 991, 831, 0, 0, 0, 0, 0, 0,
+    0, 0, 698, 0, 10, 0, 0, 0, 884, 511, 0, 682, 0, 0, 732, 441,
+    285, 498, 0, 503, 0, 588, 0, 689, 925, 0, 0, 979, 0, 0, 635, 0,
+    0, 0, 0, 685, 377, 966, 0, 968, 0, 0, 0, 0, 0, 988, 680, 0,
+    58, 817, 0, 881, 0, 303, 614, 0, 648, 649, 602, 0, 959, 322, 462, 0,
+    0, 700, 0, 719, 0, 616, 951, 963, 0, 150, 0, 35, 0, 0, 0, 0,
+    8, 110, 575, 0, 0, 0, 0, 563, 0, 506, 866, 768, 158, 527, 0, 433,
+    304, 0, 0, 0, 0, 905, 0, 160, 798, 113, 0, 0, 0, 0, 0, 437,
+    0, 0, 508, 0, 0, 687, 0, 0, 84, 809, 0, 627, 0, 0, 935, 0,
+    0, 0, 998, 900, 0, 0, 241, 108, 518, 0, 501, 0, 481, 0, 166, 0,
+    23, 911, 395, 0, 0, 0, 0, 215, 0, 0, 53, 271, 0, 942, 122, 0,
+    0, 165, 0, 0, 0, 0, 0, 793, 0, 0, 0, 0, 0, 0, 0, 782,
+    0, 0, 716, 466, 0, 744, 87, 0, 652, 0, 694, 0, 605, 0, 95, 0,
+    0, 510, 756, 0, 0, 541, 714, 0, 0, 66, 579, 703, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 504, 803, 0, 356,
+    936, 0, 324, 0, 0, 0, 0, 859, 0, 995, 647, 0, 0, 288, 257, 0,
+    0, 0, 239, 0, 934, 0, 0, 0, 0, 320, 439, 307, 0, 844, 0, 0,
+    0, 262, 810, 0, 0, 0, 125, 0, 972, 0, 0, 553, 0, 516, 561, 0,
+    640, 0, 0, 0, 830, 0, 93, 0, 0, 0, 42, 0, 0, 0, 0, 371,
+    346, 0, 0, 86, 0, 0, 0, 0, 159, 399, 168, 0, 0, 774, 0, 0,
+    572, 103, 580, 455, 0, 0, 765, 224, 370, 950, 598, 709, 0, 0, 0, 0,
+    0, 0, 663, 0, 390, 0, 0, 338, 0, 0, 0, 671, 0, 332, 0, 0,
+    609, 0, 0, 0, 211, 354, 0, 524, 0, 0, 0, 0, 0, 69, 0, 0,
+    134, 135, 136, 137, 138, 139, 140, 552, 0, 529, 0, 0, 0, 0, 0, 0,
+    143, 0, 0, 894, 594, 0, 779, 316, 597, 0, 922, 613, 0, 0, 912, 0,
+    0, 258, 0, 221, 0, 327, 417, 0, 710, 0, 0, 729, 0, 927, 0, 0,
+    0, 25, 737, 392, 61, 0, 0, 620, 120, 0, 222, 0, 1001, 310, 0, 312,
+    707, 878, 0, 0, 0, 328, 637, 0, 0, 0, 821, 713, 0, 0, 0, 0,
+    184, 185, 0, 0, 0, 189, 752, 0, 192, 630, 19, 0, 0, 448, 0, 351,
+    315, 0, 852, 0, 672, 0, 156, 453, 0, 656, 154, 450, 0, 80, 0, 265,
+    0, 0, 0, 409, 236, 0, 0, 373, 0, 0, 0, 407, 0, 67, 0, 695,
+    0, 391, 712, 0, 0, 255, 0, 0, 228, 0, 0, 0, 836, 0, 0, 0,
+    49, 46, 0, 551, 0, 742, 969, 629, 576, 0, 470, 633, 0, 802, 733, 610,
+    0, 0, 0, 0, 0, 0, 119, 359, 334, 909, 0, 0, 0, 0, 0, 349,
+    776, 678, 0, 0, 0, 0, 0, 738, 791, 0, 0, 0, 0, 540, 28, 0,
+    0, 0, 0, 0, 0, 0, 812, 0, 0, 0, 0, 593, 0, 0, 0, 153,
+};
+
+#endif // LIBSM_ENUM_TABLE_H
@@ -0,0 +1,292 @@
+/**
+ * @brief Geohash conversion for J2735 integer coordinates
+ */
+
+#include "libsm-geohash.h"
+#include "j2735-defines.h"
+
+#include <stdbool.h>
+
+
+// Every geohash is computed at 30 bits per axis and shifted down to precision
+#define GH_AXIS_BITS 30
+#define GH_FULL_BITS (2 * GH_AXIS_BITS)
+#define GH_AXIS_MAX  ((1U << GH_AXIS_BITS) - 1)
+
+// the geohash grid covers [-90, 90] x [-180, 180] degrees
+#define GH_LAT_ORIGIN  (-900000000L)
+#define GH_LAT_SPAN    1800000000ULL
+#define GH_LONG_ORIGIN (-1800000000L)
+#define GH_LONG_SPAN   3600000000ULL
+
+static const char ghAlphabet[] = "0123456789bcdefghjkmnpqrstuvwxyz";
+
+
+// Index of the 30 bit cell containing offset, offset in [0, span].
+// offset * 2^30 is exact in a double and the division is correctly rounded. The
+// exact quotient is a multiple of 1/3515625 for both spans, so the rounding
+// error (at most 2^-24) can never carry it across an integer and the floor
+// is exact.
+static inline uint32_t gh_quantize(double offset, double span)
+{
+    uint32_t const index = (uint32_t)(int32_t)(offset * (double)(1U << GH_AXIS_BITS) / span);
+    return index > GH_AXIS_MAX ? GH_AXIS_MAX : index;
+}
+
+
+// put the low 30 bits of x in the even bits of the result
+static inline uint64_t gh_spread(uint64_t x)
+{
+    x &= GH_AXIS_MAX;
+    x = (x | (x << 16)) & 0x0000FFFF0000FFFFULL;
+    x = (x | (x << 8)) & 0x00FF00FF00FF00FFULL;
+    x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    x = (x | (x << 2)) & 0x3333333333333333ULL;
+    x = (x | (x << 1)) & 0x5555555555555555ULL;
+    return x;
+}
+
+
+// inverse of gh_spread
+static inline uint32_t gh_compact(uint64_t x)
+{
+    x &= 0x5555555555555555ULL;
+    x = (x | (x >> 1)) & 0x3333333333333333ULL;
+    x = (x | (x >> 2)) & 0x0F0F0F0F0F0F0F0FULL;
+    x = (x | (x >> 4)) & 0x00FF00FF00FF00FFULL;
+    x = (x | (x >> 8)) & 0x0000FFFF0000FFFFULL;
+    x = (x | (x >> 16)) & 0x00000000FFFFFFFFULL;
+    return (uint32_t)x;
+}
+
+
+// longitude takes the odd bits, so it comes first in every character
+static inline uint64_t gh_interleave(uint32_t latIndex, uint32_t longIndex)
+{
+    return (gh_spread(longIndex) << 1) | gh_spread(latIndex);
+}
+
+
+static inline uint64_t gh_point(long lat, long Long, unsigned shift)
+{
+    // clamped so the int32 conversions below are well defined
+    lat = lat < GH_LAT_ORIGIN ? GH_LAT_ORIGIN : lat;
+    lat = lat > -GH_LAT_ORIGIN ? -GH_LAT_ORIGIN : lat;
+    Long = Long < GH_LONG_ORIGIN ? GH_LONG_ORIGIN : Long;
+    Long = Long > -GH_LONG_ORIGIN ? -GH_LONG_ORIGIN : Long;
+
+    double const latOffset = (double)(int32_t)lat - (double)GH_LAT_ORIGIN;
+    double const longOffset = (double)(int32_t)Long - (double)GH_LONG_ORIGIN;
+    uint64_t const full = gh_interleave(gh_quantize(latOffset, (double)GH_LAT_SPAN),
+                                        gh_quantize(longOffset, (double)GH_LONG_SPAN));
+    return full >> shift;
+}
+
+
+static inline bool gh_precision_valid(unsigned precision)
+{
+    return precision >= 1 && precision <= LIBSM_GEOHASH_MAX_PRECISION;
+}
+
+
+// split a geohash into its per axis cell indices
+static void gh_split(uint64_t hash,
+                     unsigned precision,
+                     uint32_t* latIndex,
+                     unsigned* latBits,
+                     uint32_t* longIndex,
+                     unsigned* longBits)
+{
+    unsigned const bits = 5 * precision;
+    uint64_t const full = hash << (GH_FULL_BITS - bits);
+
+    *longBits = (bits + 1) / 2;
+    *latBits = bits / 2;
+    *longIndex = gh_compact(full >> 1) >> (GH_AXIS_BITS - *longBits);
+    *latIndex = gh_compact(full) >> (GH_AXIS_BITS - *latBits);
+}
+
+
+static uint64_t gh_join(uint32_t latIndex,
+                        unsigned latBits,
+                        uint32_t longIndex,
+                        unsigned longBits,
+                        unsigned precision)
+{
+    uint64_t const full = gh_interleave(latIndex << (GH_AXIS_BITS - latBits),
+                                        longIndex << (GH_AXIS_BITS - longBits));
+    return full >> (GH_FULL_BITS - 5 * precision);
+}
+
+
+// smallest integer offset in cell index out of 2^bits cells of span
+static inline uint64_t gh_cell_start(uint64_t index, unsigned bits, uint64_t span)
+{
+    return (index * span + (1ULL << bits) - 1) >> bits;
+}
+
+
+libsm_rval_e libsm_geohash_encode(Latitude_t lat, Longitude_t Long, unsigned precision, uint64_t* hash)
+{
+    if (hash == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (!gh_precision_valid(precision)) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    if (lat < Latitude_min || lat > Latitude_max || Long < Longitude_min || Long > Longitude_max) {
+        return LIBSM_FAIL_CONSTRAINT;
+    }
+    *hash = gh_point(lat, Long, GH_FULL_BITS - 5 * precision);
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_geohash_encode_batch(const Latitude_t* lat,
+                                        const Longitude_t* Long,
+                                        size_t count,
+                                        unsigned precision,
+                                        uint64_t* hash)
+{
+    if (lat == NULL || Long == NULL || hash == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (!gh_precision_valid(precision)) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+
+    unsigned const shift = GH_FULL_BITS - 5 * precision;
+    for (size_t i = 0; i < count; i++) {
+        hash[i] = gh_point(lat[i], Long[i], shift);
+    }
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_geohash_decode(uint64_t hash, unsigned precision, libsm_geohash_box_t* box)
+{
+    uint32_t latIndex;
+    uint32_t longIndex;
+    unsigned latBits;
+    unsigned longBits;
+
+    if (box == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (!gh_precision_valid(precision)) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    gh_split(hash, precision, &latIndex, &latBits, &longIndex, &longBits);
+
+    uint64_t const latEnd = gh_cell_start((uint64_t)latIndex + 1, latBits, GH_LAT_SPAN);
+    uint64_t const longEnd = gh_cell_start((uint64_t)longIndex + 1, longBits, GH_LONG_SPAN);
+
+    box->minLat = GH_LAT_ORIGIN + (long)gh_cell_start(latIndex, latBits, GH_LAT_SPAN);
+    box->minLong = GH_LONG_ORIGIN + (long)gh_cell_start(longIndex, longBits, GH_LONG_SPAN);
+    // the last cell also holds the upper edge of the grid
+    box->maxLat = GH_LAT_ORIGIN + (long)(latEnd == GH_LAT_SPAN ? latEnd : latEnd - 1);
+    box->maxLong = GH_LONG_ORIGIN + (long)(longEnd == GH_LONG_SPAN ? longEnd : longEnd - 1);
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_geohash_neighbor(uint64_t hash,
+                                    unsigned precision,
+                                    int dLat,
+                                    int dLong,
+                                    uint64_t* neighbor)
+{
+    uint32_t latIndex;
+    uint32_t longIndex;
+    unsigned latBits;
+    unsigned longBits;
+
+    if (neighbor == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (!gh_precision_valid(precision)) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    gh_split(hash, precision, &latIndex, &latBits, &longIndex, &longBits);
+
+    int64_t const lat = (int64_t)latIndex + dLat;
+    if (lat < 0 || lat >= (int64_t)1 << latBits) {
+        return LIBSM_FAIL_CONSTRAINT;
+    }
+    // two's complement wraps negative longitudes around for free
+    uint64_t const Long = ((uint64_t)longIndex + (uint64_t)(int64_t)dLong) & ((1ULL << longBits) - 1);
+
+    *neighbor = gh_join((uint32_t)lat, latBits, (uint32_t)Long, longBits, precision);
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_geohash_range(uint64_t hash,
+                                 unsigned precision,
+                                 unsigned rangePrecision,
+                                 uint64_t* first,
+                                 uint64_t* last)
+{
+    if (first == NULL || last == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (!gh_precision_valid(precision) || !gh_precision_valid(rangePrecision)
+        || rangePrecision < precision) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    unsigned const shift = 5 * (rangePrecision - precision);
+    *first = hash << shift;
+    *last = *first | ((1ULL << shift) - 1);
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_geohash_to_string(uint64_t hash, unsigned precision, char* out)
+{
+    if (out == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (!gh_precision_valid(precision)) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    for (unsigned i = 0; i < precision; i++) {
+        out[precision - 1 - i] = ghAlphabet[(hash >> (5 * i)) & 0x1F];
+    }
+    out[precision] = '\0';
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_geohash_from_string(const char* text, uint64_t* hash, unsigned* precision)
+{
+    uint64_t value = 0;
+    unsigned length = 0;
+
+    if (text == NULL || hash == NULL || precision == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    for (; text[length] != '\0'; length++) {
+        char c = text[length];
+        uint64_t digit = 0;
+
+        if (length == LIBSM_GEOHASH_MAX_PRECISION) {
+            return LIBSM_FAIL_NO_VALID_PARAMETER;
+        }
+        if (c >= 'A' && c <= 'Z') {
+            c = (char)(c - 'A' + 'a');
+        }
+        while (digit < 32 && ghAlphabet[digit] != c) {
+            digit++;
+        }
+        if (digit == 32) {
+            return LIBSM_FAIL_NO_VALID_PARAMETER;
+        }
+        value = (value << 5) | digit;
+    }
+    if (length == 0) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    *hash = value;
+    *precision = length;
+    return LIBSM_OK;
+}
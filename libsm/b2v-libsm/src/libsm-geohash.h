@@ -0,0 +1,166 @@
+/**
+ * @brief Geohash conversion for J2735 integer coordinates
+ *
+ * Geohashes are handled as integers: the 5 * precision interleaved bits,
+ * right aligned, longitude bit first. The string form is only needed at the
+ * edges, libsm_geohash_to_string and libsm_geohash_from_string convert.
+ *
+ * Coordinates are quantized with exact integer arithmetic, a point on a cell
+ * edge belongs to the cell above/east of it, same as the usual bisection.
+ * Up to 12 characters (60 bits) are supported.
+ */
+
+#ifndef LIBSM_GEOHASH_H
+#define LIBSM_GEOHASH_H
+
+#include "libsm-error.h"
+#include <Latitude.h>
+#include <Longitude.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+#define LIBSM_GEOHASH_MAX_PRECISION 12
+
+/**
+ * @brief The coordinates inside a geohash cell, inclusive
+ *
+ * Every point in the box encodes to the geohash, and no point outside of it does.
+ */
+typedef struct {
+    Latitude_t minLat;
+    Latitude_t maxLat;
+    Longitude_t minLong;
+    Longitude_t maxLong;
+} libsm_geohash_box_t;
+
+
+/**
+ * @brief Geohash of a single point
+ *
+ * @param lat Latitude, 1/10 microdegree
+ * @param Long Longitude, 1/10 microdegree
+ * @param precision Number of geohash characters, 1 to LIBSM_GEOHASH_MAX_PRECISION
+ * @param hash The geohash
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG hash was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER precision out of range
+ * @retval LIBSM_FAIL_CONSTRAINT lat or Long is out of range or unavailable
+ */
+libsm_rval_e libsm_geohash_encode(Latitude_t lat, Longitude_t Long, unsigned precision, uint64_t* hash);
+
+
+/**
+ * @brief Geohash of many points
+ *
+ * The loop is branch free so the compiler can vectorize it. Out of range and
+ * unavailable coordinates are clamped instead of reported, filter them first
+ * if that matters.
+ *
+ * @param lat count latitudes
+ * @param Long count longitudes
+ * @param count Number of points
+ * @param precision Number of geohash characters, 1 to LIBSM_GEOHASH_MAX_PRECISION
+ * @param hash count geohashes
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG An array was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER precision out of range
+ */
+libsm_rval_e libsm_geohash_encode_batch(const Latitude_t* lat,
+                                        const Longitude_t* Long,
+                                        size_t count,
+                                        unsigned precision,
+                                        uint64_t* hash);
+
+
+/**
+ * @brief Bounding box of a geohash
+ *
+ * @param hash The geohash
+ * @param precision Number of characters in hash
+ * @param box The coordinates inside the cell
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG box was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER precision out of range
+ */
+libsm_rval_e libsm_geohash_decode(uint64_t hash, unsigned precision, libsm_geohash_box_t* box);
+
+
+/**
+ * @brief The geohash dLat cells north and dLong cells east of hash
+ *
+ * Longitude wraps around at the antimeridian, latitude does not.
+ *
+ * @param hash The geohash
+ * @param precision Number of characters in hash
+ * @param dLat Cells north, negative for south
+ * @param dLong Cells east, negative for west
+ * @param neighbor The neighboring geohash
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG neighbor was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER precision out of range
+ * @retval LIBSM_FAIL_CONSTRAINT The neighbor would be past a pole
+ */
+libsm_rval_e libsm_geohash_neighbor(uint64_t hash,
+                                    unsigned precision,
+                                    int dLat,
+                                    int dLong,
+                                    uint64_t* neighbor);
+
+
+/**
+ * @brief The range of longer geohashes that start with hash
+ *
+ * With hashes sorted at one precision, a prefix filter becomes a range check.
+ *
+ * @param hash The prefix
+ * @param precision Number of characters in hash
+ * @param rangePrecision Precision of the range, at least precision
+ * @param first The first geohash starting with hash
+ * @param last The last geohash starting with hash
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG first or last was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER A precision out of range
+ */
+libsm_rval_e libsm_geohash_range(uint64_t hash,
+                                 unsigned precision,
+                                 unsigned rangePrecision,
+                                 uint64_t* first,
+                                 uint64_t* last);
+
+
+/**
+ * @brief Write a geohash as base 32 text
+ *
+ * @param hash The geohash
+ * @param precision Number of characters
+ * @param out At least precision + 1 bytes, NUL terminated
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG out was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER precision out of range
+ */
+libsm_rval_e libsm_geohash_to_string(uint64_t hash, unsigned precision, char* out);
+
+
+/**
+ * @brief Parse base 32 geohash text, as in "9t9p75yd"
+ *
+ * @param text NUL terminated geohash, upper or lower case
+ * @param hash The geohash
+ * @param precision Number of characters parsed
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG An argument was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER Empty, too long, or not a geohash character
+ */
+libsm_rval_e libsm_geohash_from_string(const char* text, uint64_t* hash, unsigned* precision);
+
+
+#endif // LIBSM_GEOHASH_H
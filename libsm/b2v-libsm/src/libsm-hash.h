@@ -0,0 +1,111 @@
+/**
+ * @brief Hashing helpers shared by the libsm modules
+ *
+ * Not part of the API, the functions are inline for the modules' hot paths.
+ *
+ * A libsm index is a linear probing hash table of int32_t entry numbers, -1
+ * for an empty slot, whose size is a power of two. The keys stay in the
+ * module's own array of entries, a libsm_index_key_f reads them back.
+ */
+
+#ifndef LIBSM_HASH_H
+#define LIBSM_HASH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+
+/**
+ * @brief The splitmix64 finalizer
+ *
+ * Spreads keys that differ in a few low bits, such as TemporaryIDs and
+ * intersection ids, over all 64 bits, so masking off the low bits gives a
+ * good table slot.
+ */
+static inline uint64_t libsm_mix64(uint64_t x)
+{
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return x;
+}
+
+
+/** @brief The key of entry i of entries */
+typedef uint64_t (*libsm_index_key_f)(void const* entries, int32_t i);
+
+
+/** @brief Slots for an index at most half full with count entries */
+static inline size_t libsm_index_size(size_t count)
+{
+    size_t size = 1;
+    while (size < 2 * count) {
+        size <<= 1;
+    }
+    return size;
+}
+
+
+/** @brief An index of size slots, all empty, or NULL */
+static inline int32_t* libsm_index_alloc(size_t size)
+{
+    int32_t* index = malloc(size * sizeof(int32_t));
+    if (index != NULL) {
+        for (size_t i = 0; i < size; i++) {
+            index[i] = -1;
+        }
+    }
+    return index;
+}
+
+
+/** @brief The slot holding key, or the empty slot where it would go */
+static inline size_t libsm_index_find(int32_t const* index,
+                                      size_t mask,
+                                      uint64_t key,
+                                      libsm_index_key_f keyOf,
+                                      void const* entries)
+{
+    size_t slot = (size_t)libsm_mix64(key) & mask;
+    while (index[slot] >= 0 && keyOf(entries, index[slot]) != key) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+
+/**
+ * @brief Empty a slot
+ *
+ * Linear probing removal without tombstones: the entries that probed past
+ * slot are shifted back, so lookups never stop early.
+ */
+static inline void libsm_index_remove(int32_t* index,
+                                      size_t mask,
+                                      size_t slot,
+                                      libsm_index_key_f keyOf,
+                                      void const* entries)
+{
+    size_t next = slot;
+    for (;;) {
+        next = (next + 1) & mask;
+        if (index[next] < 0) {
+            break;
+        }
+        size_t const home = (size_t)libsm_mix64(keyOf(entries, index[next])) & mask;
+        bool const between = (slot <= next) ? (slot < home && home <= next)
+                                            : (slot < home || home <= next);
+        if (!between) {
+            index[slot] = index[next];
+            slot = next;
+        }
+    }
+    index[slot] = -1;
+}
+
+
+#endif // LIBSM_HASH_H
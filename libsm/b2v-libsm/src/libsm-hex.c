@@ -0,0 +1,37 @@
+#include "libsm-hex.h"
+
+#include <asn_hex.h>
+
+
+libsm_rval_e libsm_hex_encode(uint8_t const* bytes,
+                              size_t len,
+                              char* hex,
+                              size_t hexSize,
+                              bool lower)
+{
+    if ((bytes == NULL && len > 0) || hex == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (hexSize < 2 * len + 1) {
+        return LIBSM_FAIL_ENCODING_BUFF_SIZE;
+    }
+    asn_hex_encode(bytes, len, hex, lower);
+    hex[2 * len] = '\0';
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_hex_decode(char const* hex, size_t hexLen, uint8_t* bytes, size_t* len)
+{
+    if ((hex == NULL && hexLen > 0) || bytes == NULL || len == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (hexLen / 2 > *len) {
+        return LIBSM_FAIL_DECODING_BUFF_SIZE;
+    }
+    if (asn_hex_decode(hex, hexLen, bytes) < 0) {
+        return LIBSM_FAIL_DECODING;
+    }
+    *len = hexLen / 2;
+    return LIBSM_OK;
+}
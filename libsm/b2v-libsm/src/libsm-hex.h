@@ -0,0 +1,55 @@
+/**
+ * @brief Hexadecimal conversion of encoded messages
+ *
+ * Thin wrappers around asn_hex, the codec the JER encoders and decoders of
+ * j2735 and j2540 use. It converts 16 or 32 bytes per step with SSSE3 or
+ * AVX2 where the cpu has them, picked once when the library is loaded.
+ */
+
+#ifndef LIBSM_HEX_H
+#define LIBSM_HEX_H
+
+#include "libsm-error.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/**
+ * @brief Convert bytes to a NUL terminated hex string
+ *
+ * @param bytes The bytes
+ * @param len Number of bytes
+ * @param hex The string, 2 * len + 1 chars
+ * @param hexSize Size of hex
+ * @param lower Lower case digits instead of upper case
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG An argument was NULL
+ * @retval LIBSM_FAIL_ENCODING_BUFF_SIZE hex is too small
+ */
+libsm_rval_e libsm_hex_encode(uint8_t const* bytes,
+                              size_t len,
+                              char* hex,
+                              size_t hexSize,
+                              bool lower);
+
+
+/**
+ * @brief Convert a hex string, either case and without separators, to bytes
+ *
+ * @param hex The digits, need not be terminated
+ * @param hexLen Number of digits
+ * @param bytes The bytes
+ * @param len In: size of bytes, out: number of bytes written
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG An argument was NULL
+ * @retval LIBSM_FAIL_DECODING hexLen is odd, or hex has a char that is not a digit
+ * @retval LIBSM_FAIL_DECODING_BUFF_SIZE bytes is too small
+ */
+libsm_rval_e libsm_hex_decode(char const* hex, size_t hexLen, uint8_t* bytes, size_t* len);
+
+
+#endif // LIBSM_HEX_H
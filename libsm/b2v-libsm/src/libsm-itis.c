@@ -0,0 +1,193 @@
+#include "libsm-itis.h"
+#include "libsm.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "libsm-itisTable.h"
+
+
+libsm_itis_t const* libsm_itis_from_code(long code)
+{
+    size_t low = 0;
+    size_t high = LIBSM_ITIS_COUNT;
+    while (low < high) {
+        size_t const mid = low + (high - low) / 2;
+        if (itisByCode[mid].code < code) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    if (low < LIBSM_ITIS_COUNT && itisByCode[low].code == code) {
+        return &itisByCode[low];
+    }
+    return NULL;
+}
+
+
+// strcmp of a name with _ or spaces against an ASN.1 name
+static int itis_compare_name(char const* key, size_t len, char const* name)
+{
+    for (size_t i = 0; i < len; i++) {
+        unsigned char const k = key[i] == '_' || key[i] == ' ' ? '-' : (unsigned char)key[i];
+        unsigned char const n = (unsigned char)name[i];
+        if (k != n) {
+            return n == '\0' ? 1 : (int)k - (int)n;
+        }
+    }
+    return name[len] == '\0' ? 0 : -1;
+}
+
+
+libsm_itis_t const* libsm_itis_from_name(char const* name, size_t len)
+{
+    if (name == NULL) {
+        return NULL;
+    }
+    size_t low = 0;
+    size_t high = LIBSM_ITIS_COUNT;
+    while (low < high) {
+        size_t const mid = low + (high - low) / 2;
+        libsm_itis_t const* itis = &itisByCode[itisByName[mid]];
+        int const cmp = itis_compare_name(name, len, itis->name);
+        if (cmp == 0) {
+            return itis;
+        }
+        if (cmp > 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return NULL;
+}
+
+
+char const* libsm_itis_category(libsm_itis_t const* itis)
+{
+    if (itis == NULL || itis->category >= sizeof(itisCategories) / sizeof(itisCategories[0])) {
+        return "";
+    }
+    return itisCategories[itis->category];
+}
+
+
+ITIScodesAndText__Member* libsm_alloc_init_ITIScodesAndText__Member_phrase(char const* phrase)
+{
+    if (phrase == NULL) {
+        return NULL;
+    }
+    libsm_itis_t const* itis = libsm_itis_from_name(phrase, strlen(phrase));
+    if (itis != NULL) {
+        return libsm_alloc_init_ITIScodesAndText__Member_itis(itis->code);
+    }
+    return libsm_alloc_init_ITIScodesAndText__Member_text((char*)phrase);
+}
+
+
+// appends to text, remembers when it did not fit
+typedef struct {
+    char* text;
+    size_t size;
+    size_t len;
+    bool full;
+} itis_writer_t;
+
+
+static void itis_write(itis_writer_t* w, char const* bytes, size_t len)
+{
+    if (w->full || w->size - w->len < len) {
+        w->full = true;
+        return;
+    }
+    memcpy(w->text + w->len, bytes, len);
+    w->len += len;
+}
+
+
+static void itis_write_phrase(itis_writer_t* w, char const* name)
+{
+    size_t const len = strlen(name);
+    char* start = w->text + w->len;
+    itis_write(w, name, len);
+    if (!w->full) {
+        for (size_t i = 0; i < len; i++) {
+            if (start[i] == '-') {
+                start[i] = ' ';
+            }
+        }
+    }
+}
+
+
+static void itis_render(itis_writer_t* w, ITIScodesAndText_t const* content)
+{
+    for (int i = 0; i < content->list.count; i++) {
+        ITIScodesAndText__Member const* member = content->list.array[i];
+        if (i > 0) {
+            itis_write(w, ", ", 2);
+        }
+        if (member->item.present == ITIScodesAndText__Member__item_PR_itis) {
+            libsm_itis_t const* itis = libsm_itis_from_code(member->item.choice.itis);
+            if (itis != NULL) {
+                itis_write_phrase(w, itis->name);
+            } else {
+                char number[24];
+                int const n = snprintf(number, sizeof(number), "%ld", member->item.choice.itis);
+                itis_write(w, number, (size_t)n);
+            }
+        } else if (member->item.present == ITIScodesAndText__Member__item_PR_text) {
+            itis_write(w,
+                       (char const*)member->item.choice.text.buf,
+                       member->item.choice.text.size);
+        }
+    }
+}
+
+
+libsm_rval_e libsm_itis_render(ITIScodesAndText_t const* content,
+                               char* text,
+                               size_t size,
+                               size_t* len)
+{
+    if (content == NULL || text == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    itis_writer_t w = { text, size, 0, false };
+    itis_render(&w, content);
+    itis_write(&w, "", 1);
+    if (w.full) {
+        return LIBSM_FAIL_ENCODING_BUFF_SIZE;
+    }
+    w.len--;
+    if (len != NULL) {
+        *len = w.len;
+    }
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_itis_render_batch(ITIScodesAndText_t const* const* contents,
+                                     size_t count,
+                                     char* text,
+                                     size_t size,
+                                     size_t* offsets)
+{
+    if (contents == NULL || text == NULL || offsets == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    itis_writer_t w = { text, size, 0, false };
+    for (size_t i = 0; i < count; i++) {
+        if (contents[i] == NULL) {
+            return LIBSM_FAIL_NULL_ARG;
+        }
+        offsets[i] = w.len;
+        itis_render(&w, contents[i]);
+        itis_write(&w, "", 1);
+        if (w.full) {
+            return LIBSM_FAIL_ENCODING_BUFF_SIZE;
+        }
+    }
+    return LIBSM_OK;
+}
@@ -0,0 +1,117 @@
+/**
+ * @brief ITIS code and phrase lookup
+ *
+ * Every code of the J2540 ITIS categories, with its ASN.1 name and category, in
+ * tables generated from src/j2540 by tooling/gen-itis.sh. Codes are found by
+ * binary search over the codes, names by binary search over the names, so
+ * neither scans the ~2500 codes.
+ *
+ * Names are the ASN.1 ones, "stop-and-go-traffic". Lookups also take them with
+ * _ or spaces, the C enum and the phrase spelling. Rendering writes the phrase,
+ * "stop and go traffic".
+ */
+
+#ifndef LIBSM_ITIS_H
+#define LIBSM_ITIS_H
+
+// j2540 first, see libsm-TIM.h
+#include "j2540/ITIScodes.h"
+
+#include "ITIScodesAndText.h"
+#include "libsm-error.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/** @brief One ITIS code */
+typedef struct {
+    uint16_t code;    /**< @brief ITIScodes_t */
+    uint8_t category; /**< @brief see libsm_itis_category */
+    char const* name; /**< @brief ASN.1 name */
+} libsm_itis_t;
+
+
+/**
+ * @brief The ITIS code with a value
+ *
+ * @return The code, NULL if it is not an ITIS code
+ */
+libsm_itis_t const* libsm_itis_from_code(long code);
+
+
+/**
+ * @brief The ITIS code with a name or phrase
+ *
+ * Case matters, -, _ and space are the same.
+ *
+ * @param name The name, need not be NUL terminated
+ * @param len Its length
+ *
+ * @return The code, NULL if there is none with the name
+ */
+libsm_itis_t const* libsm_itis_from_name(char const* name, size_t len);
+
+
+/**
+ * @brief The ASN.1 type of the category of a code, "TrafficConditions"
+ */
+char const* libsm_itis_category(libsm_itis_t const* itis);
+
+
+/**
+ * @brief alloc-init a ITIScodesAndText__Member from a phrase
+ *
+ * Known phrases become their code, anything else is kept as text.
+ *
+ * @param phrase A name or phrase, len 1..500 if it is kept as text
+ *
+ * @return A pointer to a configured ITIScodesAndText__Member, else NULL
+ */
+ITIScodesAndText__Member* libsm_alloc_init_ITIScodesAndText__Member_phrase(char const* phrase);
+
+
+/**
+ * @brief Render ITIS content as text
+ *
+ * Codes become their phrase, unknown ones their number, text is copied. Members
+ * are separated by ", ".
+ *
+ * @param content The codes and text
+ * @param text Buffer for the NUL terminated text
+ * @param size Size of text
+ * @param len Length of the text without the NUL, may be NULL
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG content or text was NULL
+ * @retval LIBSM_FAIL_ENCODING_BUFF_SIZE text is too small
+ */
+libsm_rval_e libsm_itis_render(ITIScodesAndText_t const* content,
+                               char* text,
+                               size_t size,
+                               size_t* len);
+
+
+/**
+ * @brief libsm_itis_render over many contents, into one buffer
+ *
+ * The texts follow each other, each NUL terminated.
+ *
+ * @param contents The codes and text of each
+ * @param count Number of contents
+ * @param text Buffer for the texts
+ * @param size Size of text
+ * @param offsets Where in text each one starts, count of them
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG An argument was NULL
+ * @retval LIBSM_FAIL_ENCODING_BUFF_SIZE text is too small
+ */
+libsm_rval_e libsm_itis_render_batch(ITIScodesAndText_t const* const* contents,
+                                     size_t count,
+                                     char* text,
+                                     size_t size,
+                                     size_t* offsets);
+
+
+#endif // LIBSM_ITIS_H
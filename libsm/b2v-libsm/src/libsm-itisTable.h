@@ -0,0 +1,2737 @@
+/*
+ * Generated by tooling/gen-itis.sh from the ITIS enums in src/j2540, do not edit
+ * Included by libsm-itis.c only
+ */
+
+#ifndef LIBSM_ITIS_TABLE_H
+#define LIBSM_ITIS_TABLE_H
+
+#define LIBSM_ITIS_COUNT 2456
+
+static char const* const itisCategories[] = {
+    "",
+    "AccidentsAndIncidents",
+    "AdviceInstructionsMandatory",
+    "AdviceInstructionsRecommendations",
+    "AlternateRoute",
+    "AssetStatus",
+    "Closures",
+    "DelayStatusCancellation",
+    "DeviceStatus",
+    "Disasters",
+    "Disturbances",
+    "GenericLocations",
+    "IncidentResponseEquipment",
+    "IncidentResponseStatus",
+    "LaneRoadway",
+    "LargeNumbers",
+    "MUTCDLocations",
+    "MobileSituation",
+    "NamedObjects",
+    "Objects",
+    "Obstruction",
+    "ParkingInformation",
+    "PavementConditions",
+    "Precipitation",
+    "Qualifiers",
+    "RecreationalObjectsAndActivities",
+    "RegulatoryAndWarningSigns",
+    "ResponderGroupAffected",
+    "RestrictionClass",
+    "RoadsideAssets",
+    "Roadwork",
+    "SmallNumbers",
+    "SpecialEvents",
+    "SportingEvents",
+    "StatesAndTerritories",
+    "StreetSuffixes",
+    "Structures",
+    "SuggestionAdvice",
+    "SystemInformation",
+    "Temperature",
+    "TrafficConditions",
+    "TransitMode",
+    "TransitOperations",
+    "TravelerGroupAffected",
+    "Units",
+    "UnusualDriving",
+    "ValidManeuvers",
+    "VehicleGroupAffected",
+    "VisibilityAndAirQuality",
+    "WarningAdvice",
+    "WeatherConditions",
+    "Winds",
+    "WinterDrivingIndex",
+    "WinterDrivingRestrictions",
+};
+
+// sorted by code
+static libsm_itis_t const itisByCode[LIBSM_ITIS_COUNT] = {
+    { 257, 40, "stopped-traffic" },
+    { 258, 40, "stop-and-go-traffic" },
+    { 259, 40, "slow-traffic" },
+    { 260, 40, "heavy-traffic" },
+    { 261, 40, "traffic-building" },
+    { 262, 40, "long-queues" },
+    { 263, 40, "traffic-congestion" },
+    { 264, 40, "traffic-lighter-than-normal" },
+    { 265, 40, "traffic-heavier-than-normal" },
+    { 266, 40, "traffic-much-heavier-than-normal" },
+    { 267, 40, "current-speed" },
+    { 268, 40, "speed-limit" },
+    { 269, 40, "travel-time" },
+    { 272, 40, "merging-traffic" },
+    { 273, 40, "contraflow" },
+    { 378, 40, "contraflow-canceled" },
+    { 379, 40, "traffic-flowing-freely" },
+    { 380, 40, "traffic-easing" },
+    { 381, 40, "traffic-returned-to-normal" },
+    { 382, 40, "no-problems-to-report" },
+    { 383, 40, "traffic-congestion-cleared" },
+    { 513, 1, "accident" },
+    { 514, 1, "serious-accident" },
+    { 515, 1, "injury-accident" },
+    { 516, 1, "minor-accident" },
+    { 517, 1, "multi-vehicle-accident" },
+    { 518, 1, "numerous-accidents" },
+    { 519, 1, "accident-involving-a-bicycle" },
+    { 520, 1, "accident-involving-a-bus" },
+    { 521, 1, "accident-involving-a-motorcycle" },
+    { 522, 1, "accident-involving-a-pedestrian" },
+    { 523, 1, "accident-involving-a-train" },
+    { 524, 1, "accident-involving-a-truck" },
+    { 525, 1, "accident-involving-hazardous-materials" },
+    { 526, 1, "earlier-accident" },
+    { 527, 1, "medical-emergency" },
+    { 528, 1, "secondary-accident" },
+    { 529, 1, "rescue-and-recovery-work-REMOVED" },
+    { 530, 1, "accident-investigation-work" },
+    { 531, 1, "incident" },
+    { 532, 1, "stalled-vehicle" },
+    { 533, 1, "abandoned-vehicle" },
+    { 534, 1, "disabled-vehicle" },
+    { 535, 1, "disabled-truck" },
+    { 536, 1, "disabled-semi-trailer" },
+    { 537, 1, "disabled-bus" },
+    { 538, 1, "disabled-train" },
+    { 539, 1, "vehicle-spun-out" },
+    { 540, 1, "vehicle-on-fire" },
+    { 541, 1, "vehicle-in-water" },
+    { 542, 1, "vehicles-slowing-to-look-at-accident" },
+    { 543, 1, "jackknifed-semi-trailer" },
+    { 544, 1, "jackknifed-trailer-home" },
+    { 545, 1, "jackknifed-trailer" },
+    { 546, 1, "spillage-occurring-from-moving-vehicle" },
+    { 547, 1, "acid-spill" },
+    { 548, 1, "chemical-spill" },
+    { 549, 1, "fuel-spill" },
+    { 550, 1, "hazardous-materials-spill" },
+    { 551, 1, "oil-spill" },
+    { 552, 1, "spilled-load" },
+    { 553, 1, "toxic-spill" },
+    { 554, 1, "overturned-vehicle" },
+    { 555, 1, "overturned-truck" },
+    { 556, 1, "overturned-semi-trailer" },
+    { 557, 1, "overturned-bus" },
+    { 558, 1, "derailed-train" },
+    { 559, 1, "stuck-vehicle" },
+    { 560, 1, "truck-stuck-under-bridge" },
+    { 561, 1, "bus-stuck-under-bridge" },
+    { 562, 1, "accident-involving-a-semi-trailer" },
+    { 638, 1, "accident-cleared" },
+    { 639, 1, "incident-cleared" },
+    { 769, 6, "closed-to-traffic" },
+    { 770, 6, "closed" },
+    { 771, 6, "closed-ahead" },
+    { 772, 6, "closed-intermittently" },
+    { 773, 6, "closed-for-repairs" },
+    { 774, 6, "closed-for-the-season" },
+    { 775, 6, "blocked" },
+    { 776, 6, "blocked-ahead" },
+    { 777, 6, "reduced-to-one-lane" },
+    { 778, 6, "reduced-to-two-lanes" },
+    { 779, 6, "reduced-to-three-lanes" },
+    { 780, 6, "collapse" },
+    { 781, 6, "out" },
+    { 891, 6, "open-to-traffic" },
+    { 892, 6, "open" },
+    { 893, 6, "reopened-to-traffic" },
+    { 894, 6, "clearing" },
+    { 895, 6, "cleared-from-road" },
+    { 1025, 30, "road-construction" },
+    { 1026, 30, "major-road-construction" },
+    { 1027, 30, "long-term-road-construction" },
+    { 1028, 30, "construction-work" },
+    { 1029, 30, "paving-operations" },
+    { 1030, 30, "work-in-the-median" },
+    { 1031, 30, "road-reconstruction" },
+    { 1032, 30, "opposing-traffic" },
+    { 1033, 30, "narrow-lanes" },
+    { 1034, 30, "construction-traffic-merging" },
+    { 1035, 30, "single-line-traffic-alternating-directions" },
+    { 1036, 30, "road-maintenance-operations" },
+    { 1037, 30, "road-marking-operations" },
+    { 1038, 30, "bridge-maintenance-operations" },
+    { 1039, 30, "bridge-construction" },
+    { 1040, 30, "bridge-demolition-work" },
+    { 1041, 30, "blasting" },
+    { 1042, 30, "avalanche-control-activities" },
+    { 1043, 30, "water-main-work" },
+    { 1044, 30, "gas-main-work" },
+    { 1045, 30, "work-on-underground-cables" },
+    { 1046, 30, "work-on-underground-services" },
+    { 1047, 30, "new-road-construction-layout" },
+    { 1048, 30, "new-road-layout" },
+    { 1049, 30, "temporary-lane-markings" },
+    { 1050, 30, "temporary-traffic-lights" },
+    { 1051, 30, "emergency-maintenance" },
+    { 1052, 30, "cracks" },
+    { 1053, 30, "bumps" },
+    { 1054, 30, "storm-drain" },
+    { 1055, 30, "overgrown-grass" },
+    { 1056, 30, "overgrown-brushshrubs" },
+    { 1057, 30, "overgrown-trees" },
+    { 1058, 30, "crack-REMOVE" },
+    { 1059, 30, "drop-off" },
+    { 1060, 30, "seismic-retrofit" },
+    { 1061, 30, "road-widening" },
+    { 1062, 30, "utility-work" },
+    { 1146, 30, "road-maintenance-cleared" },
+    { 1147, 30, "normal-road-layout-restored" },
+    { 1148, 30, "road-work-clearance-in-progress" },
+    { 1149, 30, "road-construction-cleared" },
+    { 1150, 30, "normal-traffic-lanes-restored" },
+    { 1151, 30, "road-work-cleared" },
+    { 1281, 20, "obstruction-on-roadway" },
+    { 1282, 20, "object-on-roadway" },
+    { 1283, 20, "objects-falling-from-moving-vehicle" },
+    { 1284, 20, "debris-on-roadway" },
+    { 1285, 20, "storm-damage" },
+    { 1286, 20, "people-on-roadway" },
+    { 1287, 20, "bicyclists-on-roadway" },
+    { 1288, 20, "sightseers-obstructing-access" },
+    { 1289, 20, "large-numbers-of-visitors" },
+    { 1290, 20, "animal-on-roadway" },
+    { 1291, 20, "large-animal-on-roadway" },
+    { 1292, 20, "herd-of-animals-on-roadway" },
+    { 1293, 20, "animal-struck" },
+    { 1294, 20, "fallen-trees" },
+    { 1295, 20, "downed-power-lines" },
+    { 1296, 20, "downed-cables" },
+    { 1297, 20, "subsidence" },
+    { 1298, 20, "road-surface-collapse" },
+    { 1299, 20, "pavement-buckled" },
+    { 1300, 20, "pothole" },
+    { 1301, 20, "flooding" },
+    { 1302, 20, "broken-water-main" },
+    { 1303, 20, "collapsed-sewer" },
+    { 1304, 20, "sewer-overflow" },
+    { 1305, 20, "gas-leak" },
+    { 1306, 20, "snowmelt" },
+    { 1307, 20, "mudslide" },
+    { 1308, 20, "avalanche" },
+    { 1309, 20, "rockfall" },
+    { 1310, 20, "landslide" },
+    { 1311, 20, "over-turned-trees" },
+    { 1312, 20, "tree-limbs" },
+    { 1314, 20, "utility-pole-down" },
+    { 1315, 20, "advertising-signs" },
+    { 1316, 20, "frost-heave" },
+    { 1317, 20, "frost-jacking" },
+    { 1318, 20, "washboard" },
+    { 1319, 20, "wash-out" },
+    { 1406, 20, "clearance-work" },
+    { 1407, 20, "obstruction-cleared" },
+    { 1537, 7, "delays" },
+    { 1538, 7, "short-delays" },
+    { 1539, 7, "long-delays" },
+    { 1540, 7, "very-long-delays" },
+    { 1541, 7, "delays-of-uncertain-duration" },
+    { 1542, 7, "delayed-until-further-notice" },
+    { 1543, 7, "busy" },
+    { 1544, 7, "very-busy" },
+    { 1545, 7, "crowded" },
+    { 1546, 7, "overcrowded" },
+    { 1547, 7, "cancellations" },
+    { 1548, 7, "route-canceled-and-no-replacement" },
+    { 1549, 7, "service-canceled" },
+    { 1550, 7, "service-suspended" },
+    { 1551, 7, "service-withdrawn" },
+    { 1552, 7, "service-fully-booked" },
+    { 1553, 7, "all-services-fully-booked" },
+    { 1554, 7, "next-departure" },
+    { 1555, 7, "next-arrival" },
+    { 1556, 7, "very-frequent-service" },
+    { 1557, 7, "frequent-service" },
+    { 1558, 7, "fairly-frequent-service" },
+    { 1559, 7, "regular-service" },
+    { 1560, 7, "irregular-service" },
+    { 1561, 7, "not-operating" },
+    { 1562, 7, "system-busy" },
+    { 1563, 7, "system-very-busy" },
+    { 1564, 7, "system-crowded" },
+    { 1565, 7, "system-overcrowded" },
+    { 1566, 7, "deleted-travel-time" },
+    { 1567, 7, "headway" },
+    { 1568, 7, "extra-services-in-operation" },
+    { 1660, 7, "delays-clearing" },
+    { 1661, 7, "delays-cleared" },
+    { 1662, 7, "normal-services-resumed" },
+    { 1663, 7, "operating" },
+    { 1793, 45, "vehicle-traveling-wrong-way" },
+    { 1794, 45, "reckless-driver" },
+    { 1795, 45, "prohibited-vehicle-on-roadway" },
+    { 1796, 45, "emergency-vehicles-on-roadway" },
+    { 1797, 45, "high-speed-emergency-vehicles" },
+    { 1798, 45, "high-speed-chase" },
+    { 1918, 45, "dangerous-vehicle-warning-cleared" },
+    { 1919, 45, "emergency-vehicle-warning-cleared" },
+    { 2049, 17, "abnormal-load" },
+    { 2050, 17, "wide-load" },
+    { 2051, 17, "long-load" },
+    { 2052, 17, "slow-vehicle" },
+    { 2053, 17, "farm-equipment" },
+    { 2054, 17, "horse-drawn-vehicles" },
+    { 2055, 17, "overheight-load" },
+    { 2056, 17, "overweight-load" },
+    { 2057, 17, "tracked-vehicle" },
+    { 2058, 17, "vehicle-carrying-hazardous-materials" },
+    { 2059, 17, "slow-moving-maintenance-vehicle" },
+    { 2060, 17, "convoy" },
+    { 2061, 17, "military-convoy" },
+    { 2062, 17, "refugee-convoy" },
+    { 2063, 17, "motorcade" },
+    { 2064, 17, "mobile-situation-repositioning" },
+    { 2065, 17, "winter-maintenance-vehicles" },
+    { 2066, 17, "snowplows" },
+    { 2172, 17, "slow-moving-maintenance-vehicle-warning-cleared" },
+    { 2173, 17, "exceptional-load-warning-cleared" },
+    { 2174, 17, "hazardous-load-warning-cleared" },
+    { 2175, 17, "convoy-cleared" },
+    { 2305, 8, "lane-control-signs-not-working" },
+    { 2306, 8, "lane-control-signs-working-incorrectly" },
+    { 2307, 8, "lane-control-signs-operating" },
+    { 2308, 8, "variable-message-signs-not-working" },
+    { 2309, 8, "variable-message-signs-working-incorrectly" },
+    { 2310, 8, "variable-message-signs-operating" },
+    { 2311, 8, "emergency-telephones-not-working" },
+    { 2312, 8, "emergency-telephone-number-not-working" },
+    { 2313, 8, "traffic-lights-not-working" },
+    { 2314, 8, "traffic-lights-working-incorrectly" },
+    { 2315, 8, "ramp-control-signals-not-working" },
+    { 2316, 8, "ramp-control-signals-working-incorrectly" },
+    { 2317, 8, "temporary-traffic-lights-not-working" },
+    { 2318, 8, "temporary-traffic-lights-working-incorrectly" },
+    { 2319, 8, "traffic-signal-control-computer-not-working" },
+    { 2320, 8, "traffic-signal-timings-changed" },
+    { 2321, 8, "overheight-warning-system-triggered" },
+    { 2322, 8, "equipment-failure" },
+    { 2323, 8, "railroad-crossing-equipment-failure" },
+    { 2324, 8, "tunnel-ventilation-not-working" },
+    { 2325, 8, "power-failure" },
+    { 2326, 8, "widespread-power-outages" },
+    { 2327, 8, "technical-problems" },
+    { 2328, 8, "sign-down" },
+    { 2329, 8, "lines-in-road-faded" },
+    { 2330, 8, "damaged-light-standard" },
+    { 2331, 8, "traffic-signal-stuck-on-flash" },
+    { 2332, 8, "guide-rail" },
+    { 2333, 8, "fencing" },
+    { 2334, 8, "light-standard-hanging-by-wires" },
+    { 2335, 8, "call-box" },
+    { 2336, 8, "signal-cabinet" },
+    { 2337, 8, "detector" },
+    { 2338, 8, "improper-use-of-State-vehicle-or-equipment" },
+    { 2339, 8, "bulb-out" },
+    { 2340, 8, "not-yet-operational" },
+    { 2341, 8, "not-yet-installed" },
+    { 2428, 8, "electronic-signs-repaired" },
+    { 2429, 8, "emergency-call-facilities-restored" },
+    { 2430, 8, "traffic-signals-repaired" },
+    { 2431, 8, "railroad-crossing-equipment-now-working-normally" },
+    { 2561, 28, "restrictions" },
+    { 2562, 28, "ramp-restrictions" },
+    { 2563, 28, "truck-restriction" },
+    { 2564, 28, "speed-restriction" },
+    { 2565, 28, "noise-restriction" },
+    { 2566, 28, "traffic-regulations-have-been-changed" },
+    { 2567, 28, "local-access-only" },
+    { 2568, 28, "no-trailers" },
+    { 2569, 28, "no-high-profile-vehicles" },
+    { 2570, 28, "hazardous-materials-truck-restriction" },
+    { 2571, 28, "no-through-traffic" },
+    { 2572, 28, "no-motor-vehicles" },
+    { 2573, 28, "width-limit" },
+    { 2574, 28, "height-limit" },
+    { 2575, 28, "length-limit" },
+    { 2576, 28, "axle-load-limit" },
+    { 2577, 28, "gross-weight-limit" },
+    { 2578, 28, "axle-count-limit" },
+    { 2579, 28, "carpool-lane-available" },
+    { 2580, 28, "carpool-restrictions-changed" },
+    { 2581, 28, "hOV-2-no-single-occupant-vehicles" },
+    { 2582, 28, "hOV-3-no-vehicles-with-less-than-three-occupants" },
+    { 2583, 28, "bus-lane-available-for-all-vehicles" },
+    { 2584, 28, "truck-lane-available-for-all-vehicles" },
+    { 2585, 28, "permits-call-in-basis" },
+    { 2586, 28, "permits-temporarily-closed" },
+    { 2587, 28, "permits-closed" },
+    { 2588, 28, "road-use-permits-required" },
+    { 2675, 28, "permits-open" },
+    { 2676, 28, "restrictions-for-high-profile-vehicles-lifted" },
+    { 2677, 28, "width-limit-lifted" },
+    { 2678, 28, "height-limit-lifted" },
+    { 2679, 28, "length-limit-lifted" },
+    { 2680, 28, "axle-load-limit-lifted" },
+    { 2681, 28, "weight-limit-lifted" },
+    { 2682, 28, "axle-count-limit-lifted" },
+    { 2683, 28, "carpool-restrictions-lifted" },
+    { 2684, 28, "lane-restrictions-lifted" },
+    { 2685, 28, "ramp-restrictions-lifted" },
+    { 2686, 28, "motor-vehicle-restrictions-lifted" },
+    { 2687, 28, "restrictions-lifted" },
+    { 2817, 13, "unconfirmed-report" },
+    { 2818, 13, "initial-response-en-route" },
+    { 2819, 13, "follow-up-response-en-route" },
+    { 2820, 13, "initial-response-on-scene" },
+    { 2821, 13, "follow-up-response-on-scene" },
+    { 2822, 13, "confirmed-report" },
+    { 2823, 13, "scene-is-unsecured-at-this-time" },
+    { 2824, 13, "response-scene-secured" },
+    { 2825, 13, "rescue-and-recovery-work-in-progress" },
+    { 2826, 13, "extraction-in-progress" },
+    { 2827, 13, "clearance-work-in-progress" },
+    { 2828, 13, "body-removal-operations" },
+    { 2829, 13, "fire-containment-contained" },
+    { 2830, 13, "fire-containment-not-contained" },
+    { 2831, 13, "event-cleared" },
+    { 2832, 13, "traffic-clearing" },
+    { 2833, 13, "incident-closed" },
+    { 3073, 9, "flash-flood" },
+    { 3074, 9, "major-flood" },
+    { 3075, 9, "reservoir-failure" },
+    { 3076, 9, "levee-failure" },
+    { 3077, 9, "tsunami" },
+    { 3078, 9, "tidal-wave" },
+    { 3079, 9, "volcanic-eruption" },
+    { 3080, 9, "ash-fall" },
+    { 3081, 9, "lava-flow" },
+    { 3082, 9, "serious-fire" },
+    { 3083, 9, "forest-fire" },
+    { 3084, 9, "wildfire" },
+    { 3085, 9, "building-fire" },
+    { 3086, 9, "brush-fire" },
+    { 3087, 9, "grass-fire" },
+    { 3088, 9, "fire-danger-extreme" },
+    { 3089, 9, "fire-danger-very-high" },
+    { 3090, 9, "fire-danger-high" },
+    { 3091, 9, "fire-danger-medium" },
+    { 3092, 9, "fire-danger-low" },
+    { 3093, 9, "earthquake-damage" },
+    { 3094, 9, "air-crash" },
+    { 3095, 9, "rail-crash" },
+    { 3096, 9, "toxic-release" },
+    { 3097, 9, "toxic-leak" },
+    { 3098, 9, "radioactive-release" },
+    { 3099, 9, "radiation-hazard" },
+    { 3100, 9, "reactor-leakage" },
+    { 3101, 9, "explosion" },
+    { 3102, 9, "major-hazardous-materials-fire" },
+    { 3103, 9, "major-hazardous-materials-release" },
+    { 3199, 9, "disaster-cleared" },
+    { 3329, 10, "assault" },
+    { 3330, 10, "crime" },
+    { 3331, 10, "robbery" },
+    { 3332, 10, "fare-dispute" },
+    { 3333, 10, "shooting" },
+    { 3334, 10, "gunfire-on-roadway" },
+    { 3335, 10, "suicide" },
+    { 3336, 10, "fight" },
+    { 3337, 10, "gang-fight" },
+    { 3338, 10, "person-harassment" },
+    { 3339, 10, "person-injured" },
+    { 3340, 10, "unruly-passenger" },
+    { 3341, 10, "person-intoxicated" },
+    { 3342, 10, "crowd-control-problem" },
+    { 3343, 10, "demonstration" },
+    { 3344, 10, "march" },
+    { 3345, 10, "public-disturbance" },
+    { 3346, 10, "riot" },
+    { 3347, 10, "civil-unrest" },
+    { 3348, 10, "civil-emergency" },
+    { 3349, 10, "strike" },
+    { 3350, 10, "public-transit-strike" },
+    { 3351, 10, "stampede" },
+    { 3352, 10, "teargas-used" },
+    { 3353, 10, "security-alert" },
+    { 3354, 10, "security-incident" },
+    { 3355, 10, "checkpoint" },
+    { 3356, 10, "bomb-alert" },
+    { 3357, 10, "terrorist-incident" },
+    { 3358, 10, "high-velocity-shell-fire" },
+    { 3359, 10, "explosives-in-use" },
+    { 3360, 10, "air-raid" },
+    { 3361, 10, "weapons-of-mass-destruction-threat" },
+    { 3362, 10, "military-operations" },
+    { 3363, 10, "sick-customer" },
+    { 3454, 10, "security-problem-cleared" },
+    { 3455, 10, "traffic-disturbance-cleared" },
+    { 3585, 33, "sports-event" },
+    { 3586, 33, "game" },
+    { 3587, 33, "tournament" },
+    { 3588, 33, "track-and-field-event" },
+    { 3589, 33, "baseball-game" },
+    { 3590, 33, "basketball-game" },
+    { 3591, 33, "boxing-match" },
+    { 3592, 33, "football-game" },
+    { 3593, 33, "soccer-game" },
+    { 3594, 33, "golf-tournament" },
+    { 3595, 33, "hockey-game" },
+    { 3596, 33, "tennis-tournament" },
+    { 3597, 33, "wrestling-match" },
+    { 3598, 33, "road-race" },
+    { 3599, 33, "automobile-race" },
+    { 3600, 33, "bicycle-race" },
+    { 3601, 33, "race-event" },
+    { 3602, 33, "marathon" },
+    { 3603, 33, "horse-show" },
+    { 3604, 33, "rodeo" },
+    { 3605, 33, "water-sports-event" },
+    { 3606, 33, "winter-sports-event" },
+    { 3607, 33, "skating-event" },
+    { 3608, 33, "dog-sled-race" },
+    { 3711, 33, "sporting-event-ended" },
+    { 3841, 32, "major-event" },
+    { 3842, 32, "airshow" },
+    { 3843, 32, "hot-air-ballooning" },
+    { 3844, 32, "concert" },
+    { 3845, 32, "state-occasion" },
+    { 3846, 32, "vIP-visit" },
+    { 3847, 32, "show" },
+    { 3848, 32, "festival" },
+    { 3849, 32, "exhibition" },
+    { 3850, 32, "performing-arts" },
+    { 3851, 32, "outdoor-market" },
+    { 3852, 32, "fair" },
+    { 3853, 32, "carnival" },
+    { 3854, 32, "fireworks-display" },
+    { 3855, 32, "trade-expo" },
+    { 3856, 32, "movie-filming" },
+    { 3857, 32, "presidential-visit" },
+    { 3858, 32, "parade" },
+    { 3859, 32, "procession" },
+    { 3860, 32, "funeral-procession" },
+    { 3861, 32, "crowd" },
+    { 3862, 32, "holiday-traffic-crowds" },
+    { 3967, 32, "event-ended" },
+    { 4097, 21, "normal-parking-restrictions-lifted" },
+    { 4098, 21, "parking-meter-restrictions-lifted" },
+    { 4099, 21, "special-parking-restrictions-in-force" },
+    { 4100, 21, "full-parking-lot" },
+    { 4101, 21, "full-parking-garage" },
+    { 4102, 21, "all-parking-lots-full" },
+    { 4103, 21, "no-parking-spaces-available" },
+    { 4104, 21, "only-a-few-spaces-available" },
+    { 4105, 21, "spaces-available" },
+    { 4106, 21, "no-parking" },
+    { 4107, 21, "parking-on-one-side-of-street-only" },
+    { 4108, 21, "parking-on-both-sides-of-street" },
+    { 4109, 21, "parallel-parking-only" },
+    { 4110, 21, "parking-meters-not-available" },
+    { 4111, 21, "use-of-parking-meters-restricted" },
+    { 4112, 21, "event-parking" },
+    { 4113, 21, "handicapped-parking" },
+    { 4114, 21, "long-term-parking" },
+    { 4115, 21, "overnight-parking" },
+    { 4116, 21, "short-term-parking" },
+    { 4117, 21, "parking-by-permit-only" },
+    { 4118, 21, "emergency-parking-only" },
+    { 4119, 21, "emergency-stopping-only" },
+    { 4120, 21, "parking" },
+    { 4121, 21, "stopping" },
+    { 4122, 21, "standing" },
+    { 4123, 21, "tow-away-zone" },
+    { 4124, 21, "school-zone" },
+    { 4125, 21, "speed-zone" },
+    { 4126, 21, "loading-zone" },
+    { 4127, 21, "state-law" },
+    { 4128, 21, "van-accessible" },
+    { 4222, 21, "special-parking-restrictions-lifted" },
+    { 4223, 21, "no-parking-information-available" },
+    { 4353, 38, "information-available-on-radio" },
+    { 4354, 38, "information-available-on-TV" },
+    { 4355, 38, "call-to-get-information" },
+    { 4356, 38, "information-available-via-Internet" },
+    { 4357, 38, "test-message" },
+    { 4358, 38, "no-information-available" },
+    { 4359, 38, "null-description" },
+    { 4360, 38, "information-service-is-being-suspended" },
+    { 4361, 38, "police-assistance" },
+    { 4362, 38, "police-monitor-CB" },
+    { 4363, 38, "emergency-notification" },
+    { 4364, 38, "in-emergency-dial-911" },
+    { 4365, 38, "travel-Info-call-511" },
+    { 4366, 38, "car-pool-information" },
+    { 4478, 38, "information-service-resumed" },
+    { 4479, 38, "message-canceled" },
+    { 4609, 50, "overcast" },
+    { 4610, 50, "cloudy" },
+    { 4611, 50, "mostly-cloudy" },
+    { 4612, 50, "partly-cloudy" },
+    { 4613, 50, "partly-sunny" },
+    { 4614, 50, "mostly-sunny" },
+    { 4615, 50, "sunny" },
+    { 4616, 50, "fair-skies" },
+    { 4617, 50, "clear-skies" },
+    { 4618, 50, "mostly-clear" },
+    { 4619, 50, "mostly-dry" },
+    { 4620, 50, "dry" },
+    { 4621, 50, "uV-index-very-high" },
+    { 4622, 50, "uV-index-high" },
+    { 4623, 50, "uV-index-moderate" },
+    { 4624, 50, "uV-index-low" },
+    { 4625, 50, "uV-index-very-low" },
+    { 4626, 50, "barometric-pressure" },
+    { 4627, 50, "ozone-alert" },
+    { 4628, 50, "lighting-unknown" },
+    { 4629, 50, "artificial-exterior-light" },
+    { 4630, 50, "artificial-interior-light" },
+    { 4631, 50, "darkness" },
+    { 4632, 50, "dusk" },
+    { 4633, 50, "dawn" },
+    { 4634, 50, "moonlight" },
+    { 4635, 50, "daylight" },
+    { 4735, 50, "weather-forecast-withdrawn" },
+    { 4865, 23, "severe-weather" },
+    { 4866, 23, "blizzard" },
+    { 4867, 23, "heavy-snow" },
+    { 4868, 23, "snow" },
+    { 4869, 23, "light-snow" },
+    { 4870, 23, "snow-showers" },
+    { 4871, 23, "winter-storm" },
+    { 4872, 23, "ice-glaze" },
+    { 4873, 23, "heavy-frost" },
+    { 4874, 23, "frost" },
+    { 4875, 23, "ice-storm" },
+    { 4876, 23, "sleet" },
+    { 4877, 23, "rain-and-snow-mixed" },
+    { 4878, 23, "rain-changing-to-snow" },
+    { 4879, 23, "damaging-hail" },
+    { 4880, 23, "hail" },
+    { 4881, 23, "thunderstorms" },
+    { 4882, 23, "thundershowers" },
+    { 4883, 23, "extremely-heavy-downpour" },
+    { 4884, 23, "heavy-rain" },
+    { 4885, 23, "rain" },
+    { 4886, 23, "light-rain" },
+    { 4887, 23, "drizzle" },
+    { 4888, 23, "showers" },
+    { 4889, 23, "dew" },
+    { 4991, 23, "precipitation-cleared" },
+    { 5121, 51, "tornado" },
+    { 5122, 51, "hurricane" },
+    { 5123, 51, "hurricane-force-winds" },
+    { 5124, 51, "tropical-storm" },
+    { 5125, 51, "gale-force-winds" },
+    { 5126, 51, "storm-force-winds" },
+    { 5127, 51, "strong-winds" },
+    { 5128, 51, "moderate-winds" },
+    { 5129, 51, "light-winds" },
+    { 5130, 51, "calm" },
+    { 5131, 51, "gusty-winds" },
+    { 5132, 51, "crosswinds" },
+    { 5133, 51, "windy" },
+    { 5246, 51, "strong-winds-have-eased" },
+    { 5247, 51, "strong-wind-forecast-withdrawn" },
+    { 5377, 48, "dense-fog" },
+    { 5378, 48, "fog" },
+    { 5379, 48, "patchy-fog" },
+    { 5380, 48, "freezing-fog" },
+    { 5381, 48, "mist" },
+    { 5382, 48, "haze" },
+    { 5383, 48, "visibility-reduced" },
+    { 5384, 48, "white-out" },
+    { 5385, 48, "blowing-snow" },
+    { 5386, 48, "smoke-hazard" },
+    { 5387, 48, "spray-hazard" },
+    { 5388, 48, "low-sun-glare" },
+    { 5389, 48, "snow-glare" },
+    { 5390, 48, "blowing-dust" },
+    { 5391, 48, "blowing-sand" },
+    { 5392, 48, "dust-storms" },
+    { 5393, 48, "sandstorms" },
+    { 5394, 48, "air-quality-good" },
+    { 5395, 48, "air-quality-fair" },
+    { 5396, 48, "air-quality-poor" },
+    { 5397, 48, "air-quality-very-poor" },
+    { 5398, 48, "severe-exhaust-pollution" },
+    { 5399, 48, "smog-alert" },
+    { 5400, 48, "pollen-count-high" },
+    { 5401, 48, "pollen-count-medium" },
+    { 5402, 48, "pollen-count-low" },
+    { 5403, 48, "swarms-of-insects" },
+    { 5404, 48, "visibility-blocked" },
+    { 5405, 48, "ice-fog" },
+    { 5499, 48, "fog-clearing" },
+    { 5500, 48, "visibility-improved" },
+    { 5501, 48, "fog-forecast-withdrawn" },
+    { 5502, 48, "pollution-alert-ended" },
+    { 5503, 48, "air-quality-improved" },
+    { 5633, 39, "maximum-temperature" },
+    { 5634, 39, "temperature" },
+    { 5635, 39, "minimum-temperature" },
+    { 5636, 39, "current-temperature" },
+    { 5637, 39, "heat-index" },
+    { 5638, 39, "extreme-heat" },
+    { 5639, 39, "hot" },
+    { 5640, 39, "hotter" },
+    { 5641, 39, "heat" },
+    { 5642, 39, "warmer" },
+    { 5643, 39, "warm" },
+    { 5644, 39, "mild" },
+    { 5645, 39, "cool" },
+    { 5646, 39, "cooler" },
+    { 5647, 39, "cold" },
+    { 5648, 39, "colder" },
+    { 5649, 39, "very-cold" },
+    { 5650, 39, "extreme-cold" },
+    { 5651, 39, "wind-chill" },
+    { 5652, 39, "dewpoint" },
+    { 5653, 39, "relative-humidity" },
+    { 5758, 39, "temperatures-close-to-the-seasonal-norm" },
+    { 5759, 39, "less-extreme-temperatures" },
+    { 5889, 22, "impassable" },
+    { 5890, 22, "almost-impassable" },
+    { 5891, 22, "passable-with-care" },
+    { 5892, 22, "passable" },
+    { 5893, 22, "surface-water-hazard" },
+    { 5894, 22, "danger-of-hydroplaning" },
+    { 5895, 22, "wet-pavement" },
+    { 5896, 22, "treated-pavement" },
+    { 5897, 22, "slippery" },
+    { 5898, 22, "mud-on-roadway" },
+    { 5899, 22, "leaves-on-roadway" },
+    { 5900, 22, "loose-sand-on-roadway" },
+    { 5901, 22, "loose-gravel" },
+    { 5902, 22, "fuel-on-roadway" },
+    { 5903, 22, "oil-on-roadway" },
+    { 5904, 22, "road-surface-in-poor-condition" },
+    { 5905, 22, "melting-tar" },
+    { 5906, 22, "ice" },
+    { 5907, 22, "icy-patches" },
+    { 5908, 22, "black-ice" },
+    { 5909, 22, "ice-pellets-on-roadway" },
+    { 5910, 22, "ice-build-up" },
+    { 5911, 22, "freezing-rain" },
+    { 5912, 22, "wet-and-icy-roads" },
+    { 5913, 22, "melting-snow" },
+    { 5914, 22, "slush" },
+    { 5915, 22, "frozen-slush" },
+    { 5916, 22, "snow-on-roadway" },
+    { 5917, 22, "packed-snow" },
+    { 5918, 22, "packed-snow-patches" },
+    { 5919, 22, "plowed-snow" },
+    { 5920, 22, "wet-snow" },
+    { 5921, 22, "fresh-snow" },
+    { 5922, 22, "powder-snow" },
+    { 5923, 22, "granular-snow" },
+    { 5924, 22, "frozen-snow" },
+    { 5925, 22, "crusted-snow" },
+    { 5926, 22, "deep-snow" },
+    { 5927, 22, "snow-drifts" },
+    { 5928, 22, "drifting-snow" },
+    { 5929, 22, "expected-snow-accumulation" },
+    { 5930, 22, "current-snow-accumulation" },
+    { 5931, 22, "rough-road" },
+    { 5932, 22, "sand" },
+    { 5933, 22, "gravel" },
+    { 5934, 22, "paved" },
+    { 5935, 22, "uneven-lanes" },
+    { 5936, 22, "rough-crossing" },
+    { 5937, 22, "at-grade-level-crossing" },
+    { 5938, 22, "low-ground-clearance" },
+    { 6011, 22, "dry-pavement" },
+    { 6012, 22, "snow-cleared" },
+    { 6013, 22, "pavement-conditions-improved" },
+    { 6014, 22, "skid-hazard-reduced" },
+    { 6015, 22, "pavement-conditions-cleared" },
+    { 6145, 53, "winter-equipment-recommended" },
+    { 6146, 53, "winter-equipment-required" },
+    { 6147, 53, "snow-chains-recommended" },
+    { 6148, 53, "snow-chains-required" },
+    { 6149, 53, "snow-chains-prohibited" },
+    { 6150, 53, "studded-tires-prohibited" },
+    { 6151, 53, "snow-tires-recommended" },
+    { 6152, 53, "snow-tires-required" },
+    { 6153, 53, "four-wheel-drive-recommended" },
+    { 6154, 53, "four-wheel-drive-required" },
+    { 6155, 53, "snow-tires-or-chains-recommended" },
+    { 6156, 53, "snow-tires-or-chains-required" },
+    { 6271, 53, "winter-driving-requirements-lifted" },
+    { 6401, 52, "driving-conditions-good" },
+    { 6402, 52, "driving-conditions-fair" },
+    { 6403, 52, "difficult-driving-conditions" },
+    { 6404, 52, "very-difficult-driving-conditions" },
+    { 6405, 52, "hazardous-driving-conditions" },
+    { 6406, 52, "extremely-hazardous-driving-conditions" },
+    { 6657, 37, "why-not-ride-share" },
+    { 6658, 37, "is-this-your-no-ride-day" },
+    { 6659, 37, "why-not-use-transit" },
+    { 6660, 37, "why-not-park-and-ride" },
+    { 6661, 37, "why-not-try-paratransit" },
+    { 6662, 37, "why-not-travel-by-rail" },
+    { 6663, 37, "why-not-use-the-subway" },
+    { 6664, 37, "why-not-try-rapid-transit" },
+    { 6665, 37, "why-not-travel-by-bus" },
+    { 6666, 37, "your-parking-ticket-covers-the-return-ride" },
+    { 6667, 37, "avoid-the-rush-hour" },
+    { 6668, 37, "do-not-allow-unnecessary-gaps" },
+    { 6669, 37, "follow-the-vehicle-in-front-smoothly" },
+    { 6670, 37, "do-not-slow-down-unnecessarily" },
+    { 6671, 37, "watch-for-muggers" },
+    { 6672, 37, "watch-for-pickpockets" },
+    { 6673, 37, "watch-for-thieves" },
+    { 6674, 37, "sorry-for-any-delay" },
+    { 6675, 37, "thank-you-for-your-understanding" },
+    { 6676, 37, "we-appreciate-your-patience" },
+    { 6677, 37, "we-are-grateful-for-your-cooperation" },
+    { 6678, 37, "share-the-road" },
+    { 6913, 49, "risk" },
+    { 6914, 49, "watch" },
+    { 6915, 49, "warning" },
+    { 6916, 49, "alert" },
+    { 6917, 49, "danger" },
+    { 6918, 49, "danger-of-explosion" },
+    { 6919, 49, "danger-of-fire" },
+    { 6920, 49, "extra-police-patrols-in-operation" },
+    { 6921, 49, "look-out-for-vehicles-stopped-under-bridges" },
+    { 6922, 49, "increased-risk-of-accident" },
+    { 6923, 49, "rescue-and-recovery-work-in-progress-at-sceneREMOVED" },
+    { 6924, 49, "police-at-scene" },
+    { 6925, 49, "emergency-vehicles-at-scene" },
+    { 6926, 49, "traffic-being-directed-around-accident-area" },
+    { 6927, 49, "police-directing-traffic" },
+    { 6928, 49, "rescue-workers-directing-traffic" },
+    { 6929, 49, "repairs-in-progress" },
+    { 6930, 49, "pilot-car-in-operation" },
+    { 6931, 49, "look-out-for-flagger" },
+    { 6932, 49, "police-checks-in-operation" },
+    { 6933, 49, "mandatory-speed-limit-in-force" },
+    { 6934, 49, "speed-limit-in-force-for-heavy-vehicles" },
+    { 6935, 49, "lockdown" },
+    { 6936, 49, "security-check-point" },
+    { 6937, 49, "truck-check-point" },
+    { 6938, 49, "single-occupancy-vehicle-check-point" },
+    { 6939, 49, "look" },
+    { 6940, 49, "photo-enforced" },
+    { 6941, 49, "traffic-laws" },
+    { 6942, 49, "use-low-gear" },
+    { 6943, 49, "bridge-ices-before-road" },
+    { 6944, 49, "speed-checked-by-radar" },
+    { 6945, 49, "speed-checked-by-aircraft" },
+    { 6946, 49, "fines" },
+    { 6947, 49, "fines-higher" },
+    { 6948, 49, "fines-doubled" },
+    { 6949, 49, "fines-tripled" },
+    { 6950, 49, "behind-you" },
+    { 6951, 49, "traffic-signs" },
+    { 6952, 49, "look-out-for-workers" },
+    { 6953, 49, "ride-with-traffic" },
+    { 6954, 49, "prepare-to-evacuate-area" },
+    { 6955, 49, "avoid" },
+    { 7033, 49, "evacuation-canceled" },
+    { 7034, 49, "warning-canceled" },
+    { 7035, 49, "watch-canceled" },
+    { 7036, 49, "alert-canceled" },
+    { 7037, 49, "ended" },
+    { 7038, 49, "cleared" },
+    { 7039, 49, "canceled" },
+    { 7169, 3, "drive-carefully" },
+    { 7170, 3, "drive-with-extreme-caution" },
+    { 7171, 3, "approach-with-care" },
+    { 7172, 3, "keep-your-distance" },
+    { 7173, 3, "increase-normal-following-distance" },
+    { 7174, 3, "test-your-brakes" },
+    { 7175, 3, "cross-intersection-with-care" },
+    { 7176, 3, "pass-with-care" },
+    { 7177, 3, "use-low-beam-headlights" },
+    { 7178, 3, "use-fog-lights" },
+    { 7179, 3, "use-hazard-warning-lights" },
+    { 7180, 3, "do-not-leave-your-vehicle" },
+    { 7181, 3, "leave-your-vehicle-and-proceed-to-next-safe-place" },
+    { 7182, 3, "turn-off-engine" },
+    { 7183, 3, "close-all-windows-turn-off-heater-air-conditioner-and-vents" },
+    { 7184, 3, "turn-off-air-conditioner-to-prevent-engine-overheating" },
+    { 7185, 3, "turn-off-mobile-phones-and-two-way-radios" },
+    { 7186, 3, "prepare-to-stop" },
+    { 7187, 3, "stop-at-next-rest-area" },
+    { 7188, 3, "stop-at-next-safe-place" },
+    { 7189, 3, "only-travel-if-absolutely-necessary" },
+    { 7190, 3, "drive-to-another-service-area" },
+    { 7191, 3, "use-through-traffic-lanes" },
+    { 7192, 3, "use-local-traffic-lanes" },
+    { 7193, 3, "use-left-hand-parallel-roadway" },
+    { 7194, 3, "use-right-hand-parallel-roadway" },
+    { 7195, 3, "use-heavy-vehicle-lane" },
+    { 7196, 3, "observe-recommended-speed" },
+    { 7197, 3, "facing-traffic" },
+    { 7198, 3, "push-button" },
+    { 7199, 3, "to-cross-street" },
+    { 7200, 3, "pass" },
+    { 7201, 3, "be-prepared-to-stop" },
+    { 7202, 3, "signals-sequenced-for-speed" },
+    { 7203, 3, "maintain-top-safe-speed" },
+    { 7204, 3, "evacuate-area-voluntarily" },
+    { 7205, 3, "shelter-in-place" },
+    { 7425, 2, "keep-to-the-right" },
+    { 7426, 2, "keep-to-the-left" },
+    { 7427, 2, "use-right-lane" },
+    { 7428, 2, "use-left-lane" },
+    { 7429, 2, "heavy-vehicles-use-right-lane" },
+    { 7430, 2, "heavy-vehicles-use-left-lane" },
+    { 7431, 2, "observe-signals" },
+    { 7432, 2, "observe-signs" },
+    { 7433, 2, "no-passing" },
+    { 7434, 2, "no-smoking" },
+    { 7435, 2, "no-open-flames" },
+    { 7436, 2, "use-shoulder-as-lane" },
+    { 7437, 2, "do-not-drive-on-the-shoulder" },
+    { 7438, 2, "allow-emergency-vehicles-to-pass" },
+    { 7439, 2, "clear-a-lane-for-emergency-vehicles" },
+    { 7440, 2, "pull-over-to-the-edge-of-the-roadway" },
+    { 7441, 2, "wait-for-escort-vehicle" },
+    { 7442, 2, "in-emergency-wait-for-police-patrol" },
+    { 7443, 2, "reduce-your-speed" },
+    { 7444, 2, "observe-speed-limits" },
+    { 7445, 2, "check-point" },
+    { 7446, 2, "entry-requirements" },
+    { 7447, 2, "insurance-requirements" },
+    { 7448, 2, "firearms-requirements" },
+    { 7449, 2, "pet-requirements" },
+    { 7450, 2, "stay-in-lane" },
+    { 7451, 2, "merge" },
+    { 7452, 2, "slower-traffic-keep-right" },
+    { 7453, 2, "keep-off" },
+    { 7454, 2, "evacuate-area-immediately" },
+    { 7547, 2, "shoulder-travel-no-longer-allowed" },
+    { 7681, 24, "above" },
+    { 7682, 24, "below" },
+    { 7683, 24, "in" },
+    { 7684, 24, "around" },
+    { 7685, 24, "after" },
+    { 7686, 24, "before" },
+    { 7687, 24, "at" },
+    { 7688, 24, "on" },
+    { 7689, 24, "near" },
+    { 7690, 24, "from-the" },
+    { 7691, 24, "terminal" },
+    { 7692, 24, "falling-slowly" },
+    { 7693, 24, "falling" },
+    { 7694, 24, "falling-quickly" },
+    { 7695, 24, "rising-slowly" },
+    { 7696, 24, "rising" },
+    { 7697, 24, "rising-quickly" },
+    { 7698, 24, "steady" },
+    { 7699, 24, "likely" },
+    { 7700, 24, "changing-to" },
+    { 7701, 24, "mostly" },
+    { 7702, 24, "partly" },
+    { 7703, 24, "minus" },
+    { 7704, 24, "weather-ended" },
+    { 7705, 24, "expected" },
+    { 7706, 24, "low" },
+    { 7707, 24, "mid" },
+    { 7708, 24, "high" },
+    { 7709, 24, "upper" },
+    { 7710, 24, "unseasonably" },
+    { 7711, 24, "reported" },
+    { 7712, 24, "advice" },
+    { 7713, 24, "due-to" },
+    { 7714, 24, "proceed-to" },
+    { 7715, 24, "transferred-to" },
+    { 7716, 24, "use" },
+    { 7717, 24, "affecting" },
+    { 7718, 24, "blocking" },
+    { 7719, 24, "connecting" },
+    { 7720, 24, "finished" },
+    { 7721, 24, "for" },
+    { 7722, 24, "or" },
+    { 7723, 24, "and" },
+    { 7724, 24, "later" },
+    { 7725, 24, "level" },
+    { 7726, 24, "shortly" },
+    { 7727, 24, "soon" },
+    { 7728, 24, "service" },
+    { 7729, 24, "damaged" },
+    { 7730, 24, "out-of-order" },
+    { 7731, 24, "vandalism" },
+    { 7732, 24, "on-State-right-of-way" },
+    { 7733, 24, "graffiti" },
+    { 7734, 24, "found-property" },
+    { 7735, 24, "begin-time" },
+    { 7736, 24, "added" },
+    { 7737, 24, "end-time" },
+    { 7738, 24, "no" },
+    { 7739, 24, "do-not" },
+    { 7740, 24, "block" },
+    { 7741, 24, "except" },
+    { 7742, 24, "day" },
+    { 7743, 24, "night" },
+    { 7744, 24, "any-time" },
+    { 7745, 24, "has" },
+    { 7746, 24, "may-have" },
+    { 7747, 24, "only" },
+    { 7748, 24, "lifted" },
+    { 7749, 24, "empty" },
+    { 7750, 24, "turning" },
+    { 7751, 24, "u-turn" },
+    { 7752, 24, "wait-for" },
+    { 7753, 24, "when-flashing" },
+    { 7754, 24, "duration" },
+    { 7755, 24, "cross" },
+    { 7756, 24, "when-wet" },
+    { 7757, 24, "must" },
+    { 7758, 24, "oncoming" },
+    { 7759, 24, "may-exceed" },
+    { 7760, 24, "to-request" },
+    { 7761, 24, "exempt" },
+    { 7762, 24, "skewed" },
+    { 7763, 24, "when-children-are-present" },
+    { 7764, 24, "lower" },
+    { 7765, 24, "middle" },
+    { 7766, 24, "major" },
+    { 7767, 24, "minor" },
+    { 7937, 11, "on-bridges" },
+    { 7938, 11, "in-tunnels" },
+    { 7939, 11, "entering-or-leaving-tunnels" },
+    { 7940, 11, "on-ramps" },
+    { 7941, 11, "in-road-construction-area" },
+    { 7942, 11, "around-a-curve" },
+    { 7943, 11, "on-minor-roads" },
+    { 7944, 11, "in-the-opposing-lanes" },
+    { 7945, 11, "adjacent-to-roadway" },
+    { 7946, 11, "on-bend" },
+    { 7947, 11, "entire-intersection" },
+    { 7948, 11, "in-the-median" },
+    { 7949, 11, "moved-to-side-of-road" },
+    { 7950, 11, "moved-to-shoulder" },
+    { 7951, 11, "on-the-roadway" },
+    { 7952, 11, "in-shaded-areas" },
+    { 7953, 11, "in-low-lying-areas" },
+    { 7954, 11, "in-the-downtown-area" },
+    { 7955, 11, "in-the-inner-city-area" },
+    { 7956, 11, "in-parts" },
+    { 7957, 11, "in-some-places" },
+    { 7958, 11, "in-the-ditch" },
+    { 7959, 11, "in-the-valley" },
+    { 7960, 11, "on-hill-top" },
+    { 7961, 11, "near-the-foothills" },
+    { 7962, 11, "at-high-altitudes" },
+    { 7963, 11, "near-the-lake" },
+    { 7964, 11, "near-the-shore" },
+    { 7965, 11, "over-the-crest-of-a-hill" },
+    { 7966, 11, "other-than-on-the-roadway" },
+    { 7967, 11, "near-the-beach" },
+    { 7968, 11, "near-beach-access-point" },
+    { 7969, 11, "lower-level" },
+    { 7970, 11, "upper-level" },
+    { 7971, 11, "airport" },
+    { 7972, 11, "concourse" },
+    { 7973, 11, "gate" },
+    { 7974, 11, "baggage-claim" },
+    { 7975, 11, "customs-point" },
+    { 7976, 11, "station" },
+    { 7977, 11, "platform" },
+    { 7978, 11, "dock" },
+    { 7979, 11, "depot" },
+    { 7980, 11, "ev-charging-point" },
+    { 7981, 11, "information-welcome-point" },
+    { 7982, 11, "at-rest-area" },
+    { 7983, 11, "at-service-area" },
+    { 7984, 11, "at-weigh-station" },
+    { 7985, 11, "picnic-areas" },
+    { 7986, 11, "rest-area" },
+    { 7987, 11, "service-stations" },
+    { 7988, 11, "toilets" },
+    { 7989, 11, "on-the-right" },
+    { 7990, 11, "on-the-left" },
+    { 7991, 11, "in-the-center" },
+    { 7992, 11, "in-the-opposite-direction" },
+    { 7993, 11, "cross-traffic" },
+    { 7994, 11, "northbound-traffic" },
+    { 7995, 11, "eastbound-traffic" },
+    { 7996, 11, "southbound-traffic" },
+    { 7997, 11, "westbound-traffic" },
+    { 7998, 11, "north" },
+    { 7999, 11, "south" },
+    { 8000, 11, "east" },
+    { 8001, 11, "west" },
+    { 8002, 11, "northeast" },
+    { 8003, 11, "northwest" },
+    { 8004, 11, "southeast" },
+    { 8005, 11, "southwest" },
+    { 8006, 11, "mountain-pass" },
+    { 8007, 11, "reservation-center" },
+    { 8008, 11, "nearby-basin" },
+    { 8009, 11, "on-tracks" },
+    { 8010, 11, "dip" },
+    { 8011, 11, "traffic-circle" },
+    { 8012, 11, "park-and-ride-lot" },
+    { 8014, 11, "to" },
+    { 8015, 11, "by" },
+    { 8016, 11, "through" },
+    { 8017, 11, "area-of" },
+    { 8018, 11, "under" },
+    { 8019, 11, "over" },
+    { 8020, 11, "from" },
+    { 8021, 11, "approaching" },
+    { 8022, 11, "entering-at" },
+    { 8023, 11, "exiting-at" },
+    { 8024, 11, "across-tracks" },
+    { 8025, 11, "in-street" },
+    { 8026, 11, "on-curve" },
+    { 8027, 11, "shoulder" },
+    { 8028, 11, "crossover" },
+    { 8029, 11, "cross-road" },
+    { 8030, 11, "side-road" },
+    { 8031, 11, "bus-stop" },
+    { 8032, 11, "intersection" },
+    { 8033, 11, "roadside-park" },
+    { 8034, 11, "coast" },
+    { 8193, 14, "all-roadways" },
+    { 8194, 14, "through-lanes" },
+    { 8195, 14, "left-lane" },
+    { 8196, 14, "right-lane" },
+    { 8197, 14, "center-lane" },
+    { 8198, 14, "middle-lanes" },
+    { 8199, 14, "middle-two-lanes" },
+    { 8200, 14, "right-turning-lanes" },
+    { 8201, 14, "left-turning-lanes" },
+    { 8202, 14, "right-exit-ramp" },
+    { 8203, 14, "right-entrance-ramp" },
+    { 8204, 14, "left-exit-ramp" },
+    { 8205, 14, "left-entrance-ramp" },
+    { 8206, 14, "hard-shoulder" },
+    { 8207, 14, "soft-shoulder" },
+    { 8208, 14, "right-shoulder" },
+    { 8209, 14, "left-shoulder" },
+    { 8210, 14, "right-hand-parallel-lanes" },
+    { 8211, 14, "left-hand-parallel-lanes" },
+    { 8212, 14, "connecting-lanes" },
+    { 8213, 14, "express-lanes" },
+    { 8214, 14, "local-lanes" },
+    { 8215, 14, "toll-lanes" },
+    { 8216, 14, "electronic-toll-lanes" },
+    { 8217, 14, "toll-plaza" },
+    { 8218, 14, "inspection-lane" },
+    { 8219, 14, "hOV-lanes" },
+    { 8220, 14, "bus-lanes" },
+    { 8221, 14, "carpool-lanes" },
+    { 8222, 14, "truck-lanes" },
+    { 8223, 14, "emergency-lanes" },
+    { 8224, 14, "passing-lanes" },
+    { 8225, 14, "climbing-lanes" },
+    { 8226, 14, "slow-lane" },
+    { 8227, 14, "service-road" },
+    { 8228, 14, "cycle-lane" },
+    { 8229, 14, "bridge" },
+    { 8230, 14, "overpass" },
+    { 8231, 14, "elevated-lanes" },
+    { 8232, 14, "underpass" },
+    { 8233, 14, "tunnel" },
+    { 8234, 14, "escape-ramp" },
+    { 8235, 14, "highways" },
+    { 8236, 14, "upper-deck-lanes" },
+    { 8237, 14, "lower-deck-lanes" },
+    { 8238, 14, "reversible-lanes" },
+    { 8239, 14, "right-exit-lanes" },
+    { 8240, 14, "left-exit-lanes" },
+    { 8241, 14, "right-merging-lanes" },
+    { 8242, 14, "left-merging-lanes" },
+    { 8243, 14, "right-second-exit-ramp" },
+    { 8244, 14, "left-second-exit-ramp" },
+    { 8245, 14, "right-second-entrance-ramp" },
+    { 8246, 14, "left-second-entrance-ramp" },
+    { 8247, 14, "all-exit-lanes" },
+    { 8248, 14, "all-entry-lanes" },
+    { 8249, 14, "either-shoulder" },
+    { 8250, 14, "tracks" },
+    { 8251, 14, "sidewalk" },
+    { 8252, 14, "median" },
+    { 8253, 14, "shoulder-work" },
+    { 8449, 4, "detour-where-possible" },
+    { 8450, 4, "no-detour-available" },
+    { 8451, 4, "follow-signs" },
+    { 8452, 4, "follow-detour-signs" },
+    { 8453, 4, "follow-special-detour-markers" },
+    { 8454, 4, "do-not-follow-detour-signs" },
+    { 8455, 4, "detour-in-operation" },
+    { 8456, 4, "follow-local-detour" },
+    { 8457, 4, "compulsory-detour-in-operation" },
+    { 8458, 4, "no-suitable-detour-available" },
+    { 8459, 4, "detour-is-no-longer-recommended" },
+    { 8460, 4, "local-drivers-are-recommended-to-avoid-the-area" },
+    { 8461, 4, "trucks-are-recommended-to-avoid-the-area" },
+    { 8462, 4, "consider-alternate-route" },
+    { 8463, 4, "consider-alternate-parking" },
+    { 8464, 4, "consider-alternate-destination" },
+    { 8465, 4, "consider-alternate-area" },
+    { 8466, 4, "snow-route" },
+    { 8467, 4, "emergency-snow-route" },
+    { 8468, 4, "evacuation-route" },
+    { 8469, 4, "truck-route" },
+    { 8470, 4, "hazardous-materials-route" },
+    { 8471, 4, "detour" },
+    { 8705, 44, "square-feet" },
+    { 8706, 44, "square-meters" },
+    { 8707, 44, "acres" },
+    { 8708, 44, "hectares" },
+    { 8709, 44, "inches" },
+    { 8710, 44, "feet" },
+    { 8711, 44, "mile" },
+    { 8712, 44, "miles" },
+    { 8713, 44, "nautical-miles" },
+    { 8714, 44, "millimeters" },
+    { 8715, 44, "meters" },
+    { 8716, 44, "kilometer" },
+    { 8717, 44, "kilometers" },
+    { 8718, 44, "feet-per-second" },
+    { 8719, 44, "meters-per-second" },
+    { 8720, 44, "mPH" },
+    { 8721, 44, "kPH" },
+    { 8722, 44, "knots" },
+    { 8723, 44, "aM" },
+    { 8724, 44, "pM" },
+    { 8725, 44, "weekends" },
+    { 8726, 44, "holiday" },
+    { 8727, 44, "seconds" },
+    { 8728, 44, "minutes" },
+    { 8729, 44, "hours" },
+    { 8730, 44, "days" },
+    { 8731, 44, "weeks" },
+    { 8732, 44, "months" },
+    { 8733, 44, "degrees-Angle" },
+    { 8734, 44, "degrees-Celsius" },
+    { 8735, 44, "degrees-Fahrenheit" },
+    { 8736, 44, "grams" },
+    { 8737, 44, "kilograms" },
+    { 8738, 44, "ounces" },
+    { 8739, 44, "pounds" },
+    { 8740, 44, "tons" },
+    { 8741, 44, "fluid-ounces" },
+    { 8742, 44, "gallons" },
+    { 8743, 44, "milliliters" },
+    { 8744, 44, "liters" },
+    { 8745, 44, "kilograms-per-lane-mile" },
+    { 8746, 44, "tons-per-lane-mile" },
+    { 8747, 44, "dollar" },
+    { 8748, 44, "percent" },
+    { 8749, 44, "time-delimiter" },
+    { 8750, 44, "dollars" },
+    { 8751, 44, "flight-number" },
+    { 8752, 44, "person-people" },
+    { 8753, 44, "response-plan" },
+    { 8754, 44, "placard-type" },
+    { 8755, 44, "placard-number" },
+    { 8756, 44, "fM" },
+    { 8757, 44, "grade" },
+    { 8758, 44, "nSunday" },
+    { 8759, 44, "nMonday" },
+    { 8760, 44, "nTuesday" },
+    { 8761, 44, "nWednesday" },
+    { 8762, 44, "nThursday" },
+    { 8763, 44, "nFriday" },
+    { 8764, 44, "nSaturday" },
+    { 8765, 44, "weekdays" },
+    { 8766, 44, "elevation" },
+    { 8767, 44, "other-times" },
+    { 8961, 41, "travel" },
+    { 8962, 41, "transit" },
+    { 8963, 41, "bus" },
+    { 8964, 41, "trolleybus" },
+    { 8965, 41, "rail" },
+    { 8966, 41, "commuter-rail" },
+    { 8967, 41, "subway" },
+    { 8968, 41, "rapid-transit" },
+    { 8969, 41, "light-rail" },
+    { 8970, 41, "streetcar" },
+    { 8971, 41, "dial-a-ride" },
+    { 8972, 41, "park-and-ride" },
+    { 8973, 41, "shuttle" },
+    { 8974, 41, "free-shuttle" },
+    { 8975, 41, "airport-shuttle" },
+    { 8976, 41, "taxies" },
+    { 8977, 41, "ferry" },
+    { 8978, 41, "passenger-ferry" },
+    { 8979, 41, "vehicle-ferry" },
+    { 8980, 41, "aerial-tramway" },
+    { 8981, 41, "automated-guideway" },
+    { 8982, 41, "cable-cars" },
+    { 8983, 41, "monorail" },
+    { 8984, 41, "air-travel" },
+    { 8985, 41, "hitch-hitching" },
+    { 8986, 41, "walk" },
+    { 9217, 47, "all-vehicles" },
+    { 9218, 47, "bicycles" },
+    { 9219, 47, "motorcycles" },
+    { 9220, 47, "cars" },
+    { 9221, 47, "light-vehicles" },
+    { 9222, 47, "cars-and-light-vehicles" },
+    { 9223, 47, "cars-with-trailers" },
+    { 9224, 47, "cars-with-recreational-trailers" },
+    { 9225, 47, "vehicles-with-trailers" },
+    { 9226, 47, "heavy-vehicles" },
+    { 9227, 47, "trucks" },
+    { 9228, 47, "buses" },
+    { 9229, 47, "articulated-buses" },
+    { 9230, 47, "school-buses" },
+    { 9231, 47, "vehicles-with-semi-trailers" },
+    { 9232, 47, "vehicles-with-double-trailers" },
+    { 9233, 47, "high-profile-vehicles" },
+    { 9234, 47, "wide-vehicles" },
+    { 9235, 47, "long-vehicles" },
+    { 9236, 47, "hazardous-loads" },
+    { 9237, 47, "exceptional-loads" },
+    { 9238, 47, "abnormal-loads" },
+    { 9239, 47, "convoys" },
+    { 9240, 47, "maintenance-vehicles" },
+    { 9241, 47, "delivery-vehicles" },
+    { 9242, 47, "vehicles-with-even-numbered-license-plates" },
+    { 9243, 47, "vehicles-with-odd-numbered-license-plates" },
+    { 9244, 47, "vehicles-with-parking-permits" },
+    { 9245, 47, "vehicles-with-catalytic-converters" },
+    { 9246, 47, "vehicles-without-catalytic-converters" },
+    { 9247, 47, "gas-powered-vehicles" },
+    { 9248, 47, "diesel-powered-vehicles" },
+    { 9249, 47, "lPG-vehicles" },
+    { 9250, 47, "military-convoys" },
+    { 9251, 47, "military-vehicles" },
+    { 9252, 47, "electric-powered-vehicles" },
+    { 9253, 47, "hybrid-powered-vehicles" },
+    { 9254, 47, "inherently-low-emission-vehicles" },
+    { 9255, 47, "commercial-vehicles" },
+    { 9256, 47, "runaway-vehicles" },
+    { 9257, 47, "vehicles-with-lugs" },
+    { 9258, 47, "motor-driven-cycles" },
+    { 9259, 47, "recreational-vehicles" },
+    { 9260, 47, "non-motorized-vehicles" },
+    { 9261, 47, "traffic" },
+    { 9473, 43, "through-traffic" },
+    { 9474, 43, "holiday-traffic" },
+    { 9475, 43, "residents" },
+    { 9476, 43, "visitors" },
+    { 9477, 43, "long-distance-traffic" },
+    { 9478, 43, "local-traffic" },
+    { 9479, 43, "regional-traffic" },
+    { 9480, 43, "arrivals" },
+    { 9481, 43, "departures" },
+    { 9482, 43, "airline-travelers" },
+    { 9483, 43, "commuter-airline-travelers" },
+    { 9484, 43, "domestic-airline-travelers" },
+    { 9485, 43, "international-airline-travelers" },
+    { 9486, 43, "pedestrians" },
+    { 9487, 43, "bicyclists" },
+    { 9729, 27, "emergency-vehicle-units" },
+    { 9730, 27, "federal-law-enforcement-units" },
+    { 9731, 27, "state-police-units" },
+    { 9732, 27, "county-police-units" },
+    { 9733, 27, "local-police-units" },
+    { 9734, 27, "ambulance-units" },
+    { 9735, 27, "rescue-units" },
+    { 9736, 27, "fire-units" },
+    { 9737, 27, "hAZMAT-units" },
+    { 9738, 27, "light-tow-unit" },
+    { 9739, 27, "heavy-tow-unit" },
+    { 9740, 27, "freeway-service-patrols" },
+    { 9741, 27, "transportation-response-units" },
+    { 9742, 27, "private-contractor-response-units" },
+    { 9743, 27, "private-tow-units" },
+    { 9985, 12, "ground-fire-suppression" },
+    { 9986, 12, "heavy-ground-equipment" },
+    { 9988, 12, "aircraft" },
+    { 9989, 12, "marine-equipment" },
+    { 9990, 12, "support-equipment" },
+    { 9991, 12, "medical-rescue-unit" },
+    { 9993, 12, "other" },
+    { 9994, 12, "ground-fire-suppression-other" },
+    { 9995, 12, "engine" },
+    { 9996, 12, "truck-or-aerial" },
+    { 9997, 12, "quint" },
+    { 9998, 12, "tanker-pumper-combination" },
+    { 10000, 12, "brush-truck" },
+    { 10001, 12, "aircraft-rescue-firefighting" },
+    { 10004, 12, "heavy-ground-equipment-other" },
+    { 10005, 12, "dozer-or-plow" },
+    { 10006, 12, "tractor" },
+    { 10008, 12, "tanker-or-tender" },
+    { 10024, 12, "aircraft-other" },
+    { 10025, 12, "aircraft-fixed-wing-tanker" },
+    { 10026, 12, "helitanker" },
+    { 10027, 12, "helicopter" },
+    { 10034, 12, "marine-equipment-other" },
+    { 10035, 12, "fire-boat-with-pump" },
+    { 10036, 12, "boat-no-pump" },
+    { 10044, 12, "support-apparatus-other" },
+    { 10045, 12, "breathing-apparatus-support" },
+    { 10046, 12, "light-and-air-unit" },
+    { 10054, 12, "medical-rescue-unit-other" },
+    { 10055, 12, "rescue-unit" },
+    { 10056, 12, "urban-search-rescue-unit" },
+    { 10057, 12, "high-angle-rescue" },
+    { 10058, 12, "crash-fire-rescue" },
+    { 10059, 12, "bLS-unit" },
+    { 10060, 12, "aLS-unit" },
+    { 10075, 12, "mobile-command-post" },
+    { 10076, 12, "chief-officer-car" },
+    { 10077, 12, "hAZMAT-unit" },
+    { 10078, 12, "type-i-hand-crew" },
+    { 10079, 12, "type-ii-hand-crew" },
+    { 10083, 12, "privately-owned-vehicle" },
+    { 10084, 12, "other-apparatus-resource" },
+    { 10085, 12, "ambulance" },
+    { 10086, 12, "bomb-squad-van" },
+    { 10087, 12, "combine-harvester" },
+    { 10088, 12, "construction-vehicle" },
+    { 10089, 12, "farm-tractor" },
+    { 10090, 12, "grass-cutting-machines" },
+    { 10091, 12, "hAZMAT-containment-tow" },
+    { 10092, 12, "heavy-tow" },
+    { 10093, 12, "hedge-cutting-machines" },
+    { 10094, 12, "light-tow" },
+    { 10095, 12, "mobile-crane" },
+    { 10096, 12, "refuse-collection-vehicle" },
+    { 10097, 12, "resurfacing-vehicle" },
+    { 10098, 12, "road-sweeper" },
+    { 10099, 12, "roadside-litter-collection-crews" },
+    { 10100, 12, "salvage-vehicle" },
+    { 10101, 12, "sand-truck" },
+    { 10102, 12, "snowplow" },
+    { 10103, 12, "steam-roller" },
+    { 10104, 12, "swat-team-van" },
+    { 10105, 12, "track-laying-vehicle" },
+    { 10106, 12, "unknown-vehicle" },
+    { 10107, 12, "white-lining-vehicle" },
+    { 10108, 12, "dump-truck" },
+    { 10109, 12, "supervisor-vehicle" },
+    { 10110, 12, "snow-blower" },
+    { 10111, 12, "rotary-snow-blower" },
+    { 10112, 12, "road-grader" },
+    { 10113, 12, "steam-truck" },
+    { 10114, 12, "flatbed-tow" },
+    { 10115, 12, "survey-crews" },
+    { 10240, 5, "unknown-status" },
+    { 10241, 5, "ready-for-use" },
+    { 10242, 5, "working-normally" },
+    { 10243, 5, "working-autonomously" },
+    { 10244, 5, "working-incorrectly" },
+    { 10245, 5, "not-working" },
+    { 10246, 5, "normal-maintenance" },
+    { 10247, 5, "in-route-to-use" },
+    { 10248, 5, "returning-from-use" },
+    { 10249, 5, "out-of-service" },
+    { 10250, 5, "off-duty" },
+    { 10251, 5, "on-patrol" },
+    { 10252, 5, "on-call" },
+    { 10253, 5, "on-break" },
+    { 10254, 5, "mandatory-time-off" },
+    { 10255, 5, "low-on-fuel" },
+    { 10256, 5, "low-on-water" },
+    { 10257, 5, "low-charge" },
+    { 10258, 5, "missing" },
+    { 10496, 29, "none" },
+    { 10497, 29, "light-pole" },
+    { 10498, 29, "utility-pole" },
+    { 10499, 29, "gantry-way" },
+    { 10500, 29, "sign-support" },
+    { 10501, 29, "signal-pole" },
+    { 10502, 29, "signage-public" },
+    { 10503, 29, "signage-private" },
+    { 10504, 29, "cones" },
+    { 10505, 29, "cones-post-type" },
+    { 10506, 29, "cones-glue-post" },
+    { 10507, 29, "cones-other" },
+    { 10508, 29, "barriers" },
+    { 10509, 29, "barrier-Aframe" },
+    { 10510, 29, "barriers-heavy-duty" },
+    { 10511, 29, "barricade-type-III" },
+    { 10512, 29, "barricade-small" },
+    { 10513, 29, "barricade-lights" },
+    { 10514, 29, "beacon" },
+    { 10515, 29, "t-stand" },
+    { 10516, 29, "a-stand" },
+    { 10517, 29, "drums" },
+    { 10518, 29, "impact-attenuator" },
+    { 10519, 29, "barricade-tape" },
+    { 10520, 29, "safety-fence" },
+    { 10521, 29, "temp-pavement-markings" },
+    { 10522, 29, "speed-bumps" },
+    { 10523, 29, "temp-curbs" },
+    { 10524, 29, "parking-blocks" },
+    { 10525, 29, "signboard-fixed" },
+    { 10526, 29, "signboard-portable" },
+    { 10527, 29, "har" },
+    { 10528, 29, "har-AM" },
+    { 10529, 29, "har-FM" },
+    { 10530, 29, "har-DSRC" },
+    { 10531, 29, "traffic-light" },
+    { 10532, 29, "lane-control-signal" },
+    { 10533, 29, "traffic-detector" },
+    { 10534, 29, "vehicle-detector" },
+    { 10535, 29, "system-alarm" },
+    { 10536, 29, "arrow-board" },
+    { 10537, 29, "fixed-VMS" },
+    { 10538, 29, "mobile-VMS" },
+    { 10539, 29, "ramp-control" },
+    { 10540, 29, "gate-control" },
+    { 10541, 29, "temporary-traffic-light" },
+    { 10542, 29, "over-height-warning-system" },
+    { 10543, 29, "over-weight-warning-system" },
+    { 10544, 29, "emergency-telephones" },
+    { 10545, 29, "railroad-crossing-equipment" },
+    { 10546, 29, "tunnel-ventilation" },
+    { 10547, 29, "ccTV" },
+    { 10548, 29, "environmental-sensor" },
+    { 10549, 29, "switch" },
+    { 10550, 29, "signal" },
+    { 10551, 29, "third-rail" },
+    { 10552, 29, "overhead-power" },
+    { 10553, 29, "concrete-tie" },
+    { 10554, 29, "wooden-tie" },
+    { 10555, 29, "escalator" },
+    { 10556, 29, "elevator" },
+    { 10557, 29, "track" },
+    { 10558, 29, "drawbridge" },
+    { 10559, 29, "manhole-cover" },
+    { 10560, 29, "culvert" },
+    { 10561, 29, "snow-poles" },
+    { 10562, 29, "guide-poles" },
+    { 10563, 29, "expansion-joint" },
+    { 10564, 29, "shifted-plate" },
+    { 10565, 29, "solid-barrier" },
+    { 10566, 29, "moveable-barrier" },
+    { 10567, 29, "sand-barrel" },
+    { 10568, 29, "overhead-sign" },
+    { 10569, 29, "ground-sign" },
+    { 10570, 29, "emergency-signal" },
+    { 10571, 29, "countdown-pedestrian-sign" },
+    { 10572, 29, "stripe" },
+    { 10573, 29, "island" },
+    { 10753, 42, "unknown-transit-problem" },
+    { 10754, 42, "sleeping-customer" },
+    { 10755, 42, "assault-on-passenger" },
+    { 10756, 42, "assault-on-employee" },
+    { 10757, 42, "broken-seat" },
+    { 10758, 42, "bus-alarm" },
+    { 10759, 42, "crime-or-drug-deal" },
+    { 10760, 42, "eating-on-board" },
+    { 10761, 42, "equipment-problem-with-air-conditioning" },
+    { 10762, 42, "equipment-problem-with-air-system" },
+    { 10763, 42, "equipment-problem-with-brakes" },
+    { 10764, 42, "equipment-problem-with-chassis-or-suspension" },
+    { 10765, 42, "equipment-problem-with-cooling-system" },
+    { 10766, 42, "equipment-problem-with-doors" },
+    { 10767, 42, "equipment-problem-with-electrical" },
+    { 10768, 42, "equipment-problem-with-engine" },
+    { 10769, 42, "equipment-problem-with-exterior-or-body" },
+    { 10770, 42, "equipment-problem-with-fare-collection" },
+    { 10771, 42, "equipment-problem-with-fuel-or-exhaust" },
+    { 10772, 42, "equipment-problem-with-horn" },
+    { 10773, 42, "equipment-problem-with-interior" },
+    { 10774, 42, "equipment-problem-with-liftkneeling" },
+    { 10775, 42, "equipment-problem-with-lights" },
+    { 10776, 42, "equipment-problem-with-lubrication" },
+    { 10777, 42, "equipment-problem-with-radio-or-communication" },
+    { 10778, 42, "equipment-problem-with-signs" },
+    { 10779, 42, "equipment-problem-with-steering" },
+    { 10780, 42, "equipment-problem-with-tires" },
+    { 10781, 42, "equipment-problem-with-transmission" },
+    { 10782, 42, "equipment-problem-with-unknown-alarm" },
+    { 10783, 42, "equipment-problem-with-wipers" },
+    { 10784, 42, "fare-dispute-expired-pass" },
+    { 10785, 42, "fare-dispute-expired-transfer" },
+    { 10786, 42, "fare-dispute-expired-upgrade" },
+    { 10787, 42, "fare-dispute-other" },
+    { 10788, 42, "fare-dispute-refuses-to-pay" },
+    { 10789, 42, "lift-passenger-cycle-completed" },
+    { 10790, 42, "lift-passenger-ready-to-alight" },
+    { 10791, 42, "lift-passenger-ready-to-board" },
+    { 10792, 42, "lost-article" },
+    { 10793, 42, "objects-thrown" },
+    { 10794, 42, "passenger-accident-alighting" },
+    { 10795, 42, "passenger-accident-boarding" },
+    { 10796, 42, "passenger-accident-fallen-on-board" },
+    { 10797, 42, "passenger-load" },
+    { 10798, 42, "passenger-accident-other" },
+    { 10799, 42, "passenger-sick-or-injured" },
+    { 10800, 42, "right-of-way" },
+    { 10801, 42, "theft" },
+    { 10802, 42, "theft-of-service" },
+    { 10803, 42, "waiting-to-get-relief-for-schedule-break" },
+    { 10804, 42, "waiting-to-get-relief-after-run-is-finished" },
+    { 10805, 42, "waiting-to-provide-relief" },
+    { 11009, 19, "unknown-object" },
+    { 11010, 19, "tire" },
+    { 11011, 19, "rim" },
+    { 11012, 19, "retread" },
+    { 11013, 19, "trash" },
+    { 11014, 19, "cargo" },
+    { 11015, 19, "diesel" },
+    { 11016, 19, "gasoline" },
+    { 11017, 19, "anti-freeze" },
+    { 11018, 19, "seat-belts" },
+    { 11019, 19, "litter-container" },
+    { 11020, 19, "all-Terrain-vehicle" },
+    { 11021, 19, "seaplane" },
+    { 11022, 19, "chairlift" },
+    { 11023, 19, "fishing-pier" },
+    { 11024, 19, "railroad-cross-buck" },
+    { 11025, 19, "telephone" },
+    { 11026, 19, "fallout" },
+    { 11027, 19, "medical" },
+    { 11028, 19, "chemical" },
+    { 11029, 19, "welfare" },
+    { 11030, 19, "evacuation" },
+    { 11031, 19, "left-arrow-signal" },
+    { 11032, 19, "ahead-arrow-signal" },
+    { 11033, 19, "right-arrow-signal" },
+    { 11034, 19, "green-light-signal" },
+    { 11035, 19, "green-arrow-signal" },
+    { 11036, 19, "yellow-light-signal" },
+    { 11037, 19, "yellow-arrow-signal" },
+    { 11038, 19, "red-light-signal" },
+    { 11039, 19, "red-arrow-signal" },
+    { 11040, 19, "extended-green-signal" },
+    { 11041, 19, "advance-arrow-signal" },
+    { 11042, 19, "pedestrian-Signal-Stop" },
+    { 11043, 19, "pedestrian-Signal-Caution" },
+    { 11044, 19, "pedestrian-Signal-Walk" },
+    { 11045, 19, "pedestrian-Signal-Light" },
+    { 11046, 19, "pedestrian-Signal-Time-Display" },
+    { 11047, 19, "train" },
+    { 11048, 19, "horn" },
+    { 11049, 19, "deer" },
+    { 11050, 19, "cattle" },
+    { 11051, 19, "horse" },
+    { 11052, 19, "golf-cart" },
+    { 11053, 19, "food-services" },
+    { 11054, 19, "ambulance-staging-point" },
+    { 11055, 19, "roadside-table" },
+    { 11056, 19, "services" },
+    { 11059, 19, "motorist-services" },
+    { 11060, 19, "alternative-fuel" },
+    { 11061, 19, "propane-gas" },
+    { 11062, 19, "registration" },
+    { 11063, 19, "decontamination" },
+    { 11064, 19, "emergency" },
+    { 11264, 46, "prohibit-None-Allowed-LU-LT-L45-S-R45-RT-RU" },
+    { 11265, 46, "prohibit-RU-Allowed-LU-LT-L45-S-R45-RT" },
+    { 11266, 46, "prohibit-RT-Allowed-LU-LT-L45-S-R45-RU" },
+    { 11267, 46, "prohibit-RT-RU-Allowed-LU-LT-L45-S-R45" },
+    { 11268, 46, "prohibit-R45-Allowed-LU-LT-L45-S-RT-RU" },
+    { 11269, 46, "prohibit-R45-RU-Allowed-LU-LT-L45-S-RT" },
+    { 11270, 46, "prohibit-R45-RT-Allowed-LU-LT-L45-S-RU" },
+    { 11271, 46, "prohibit-R45-RT-RU-Allowed-LU-LT-L45-S" },
+    { 11272, 46, "prohibit-S-Allowed-LU-LT-L45-R45-RT-RU" },
+    { 11273, 46, "prohibit-S-RU-Allowed-LU-LT-L45-R45-RT" },
+    { 11274, 46, "prohibit-S-RT-Allowed-LU-LT-L45-R45-RU" },
+    { 11275, 46, "prohibit-S-RT-RU-Allowed-LU-LT-L45-R45" },
+    { 11276, 46, "prohibit-S-R45-Allowed-LU-LT-L45-RT-RU" },
+    { 11277, 46, "prohibit-S-R45-RU-Allowed-LU-LT-L45-RT" },
+    { 11278, 46, "prohibit-S-R45-RT-Allowed-LU-LT-L45-RU" },
+    { 11279, 46, "prohibit-S-R45-RT-RU-Allowed-LU-LT-L45" },
+    { 11280, 46, "prohibit-L45-Allowed-LU-LT-S-R45-RT-RU" },
+    { 11281, 46, "prohibit-L45-RU-Allowed-LU-LT-S-R45-RT" },
+    { 11282, 46, "prohibit-L45-RT-Allowed-LU-LT-S-R45-RU" },
+    { 11283, 46, "prohibit-L45-RT-RU-Allowed-LU-LT-S-R45" },
+    { 11284, 46, "prohibit-L45-R45-Allowed-LU-LT-S-RT-RU" },
+    { 11285, 46, "prohibit-L45-R45-RU-Allowed-LU-LT-S-RT" },
+    { 11286, 46, "prohibit-L45-R45-RT-Allowed-LU-LT-S-RU" },
+    { 11287, 46, "prohibit-L45-R45-RT-RU-Allowed-LU-LT-S" },
+    { 11288, 46, "prohibit-L45-S-Allowed-LU-LT-R45-RT-RU" },
+    { 11289, 46, "prohibit-L45-S-RU-Allowed-LU-LT-R45-RT" },
+    { 11290, 46, "prohibit-L45-S-RT-Allowed-LU-LT-R45-RU" },
+    { 11291, 46, "prohibit-L45-S-RT-RU-Allowed-LU-LT-R45" },
+    { 11292, 46, "prohibit-L45-S-R45-Allowed-LU-LT-RT-RU" },
+    { 11293, 46, "prohibit-L45-S-R45-RU-Allowed-LU-LT-RT" },
+    { 11294, 46, "prohibit-L45-S-R45-RT-Allowed-LU-LT-RU" },
+    { 11295, 46, "prohibit-L45-S-R45-RT-RU-Allowed-LU-LT" },
+    { 11296, 46, "prohibit-LT-Allowed-LU-L45-S-R45-RT-RU" },
+    { 11297, 46, "prohibit-LT-RU-Allowed-LU-L45-S-R45-RT" },
+    { 11298, 46, "prohibit-LT-RT-Allowed-LU-L45-S-R45-RU" },
+    { 11299, 46, "prohibit-LT-RT-RU-Allowed-LU-L45-S-R45" },
+    { 11300, 46, "prohibit-LT-R45-Allowed-LU-L45-S-RT-RU" },
+    { 11301, 46, "prohibit-LT-R45-RU-Allowed-LU-L45-S-RT" },
+    { 11302, 46, "prohibit-LT-R45-RT-Allowed-LU-L45-S-RU" },
+    { 11303, 46, "prohibit-LT-R45-RT-RU-Allowed-LU-L45-S" },
+    { 11304, 46, "prohibit-LT-S-Allowed-LU-L45-R45-RT-RU" },
+    { 11305, 46, "prohibit-LT-S-RU-Allowed-LU-L45-R45-RT" },
+    { 11306, 46, "prohibit-LT-S-RT-Allowed-LU-L45-R45-RU" },
+    { 11307, 46, "prohibit-LT-S-RT-RU-Allowed-LU-L45-R45" },
+    { 11308, 46, "prohibit-LT-S-R45-Allowed-LU-L45-RT-RU" },
+    { 11309, 46, "prohibit-LT-S-R45-RU-Allowed-LU-L45-RT" },
+    { 11310, 46, "prohibit-LT-S-R45-RT-Allowed-LU-L45-RU" },
+    { 11311, 46, "prohibit-LT-S-R45-RT-RU-Allowed-LU-L45" },
+    { 11312, 46, "prohibit-LT-L45-Allowed-LU-S-R45-RT-RU" },
+    { 11313, 46, "prohibit-LT-L45-RU-Allowed-LU-S-R45-RT" },
+    { 11314, 46, "prohibit-LT-L45-RT-Allowed-LU-S-R45-RU" },
+    { 11315, 46, "prohibit-LT-L45-RT-RU-Allowed-LU-S-R45" },
+    { 11316, 46, "prohibit-LT-L45-R45-Allowed-LU-S-RT-RU" },
+    { 11317, 46, "prohibit-LT-L45-R45-RU-Allowed-LU-S-RT" },
+    { 11318, 46, "prohibit-LT-L45-R45-RT-Allowed-LU-S-RU" },
+    { 11319, 46, "prohibit-LT-L45-R45-RT-RU-Allowed-LU-S" },
+    { 11320, 46, "prohibit-LT-L45-S-Allowed-LU-R45-RT-RU" },
+    { 11321, 46, "prohibit-LT-L45-S-RU-Allowed-LU-R45-RT" },
+    { 11322, 46, "prohibit-LT-L45-S-RT-Allowed-LU-R45-RU" },
+    { 11323, 46, "prohibit-LT-L45-S-RT-RU-Allowed-LU-R45" },
+    { 11324, 46, "prohibit-LT-L45-S-R45-Allowed-LU-RT-RU" },
+    { 11325, 46, "prohibit-LT-L45-S-R45-RU-Allowed-LU-RT" },
+    { 11326, 46, "prohibit-LT-L45-S-R45-RT-Allowed-LU-RU" },
+    { 11327, 46, "prohibit-LT-L45-S-R45-RT-RU-Allowed-LU" },
+    { 11328, 46, "prohibit-LU-Allowed-LT-L45-S-R45-RT-RU" },
+    { 11329, 46, "prohibit-LU-RU-Allowed-LT-L45-S-R45-RT" },
+    { 11330, 46, "prohibit-LU-RT-Allowed-LT-L45-S-R45-RU" },
+    { 11331, 46, "prohibit-LU-RT-RU-Allowed-LT-L45-S-R45" },
+    { 11332, 46, "prohibit-LU-R45-Allowed-LT-L45-S-RT-RU" },
+    { 11333, 46, "prohibit-LU-R45-RU-Allowed-LT-L45-S-RT" },
+    { 11334, 46, "prohibit-LU-R45-RT-Allowed-LT-L45-S-RU" },
+    { 11335, 46, "prohibit-LU-R45-RT-RU-Allowed-LT-L45-S" },
+    { 11336, 46, "prohibit-LU-S-Allowed-LT-L45-R45-RT-RU" },
+    { 11337, 46, "prohibit-LU-S-RU-Allowed-LT-L45-R45-RT" },
+    { 11338, 46, "prohibit-LU-S-RT-Allowed-LT-L45-R45-RU" },
+    { 11339, 46, "prohibit-LU-S-RT-RU-Allowed-LT-L45-R45" },
+    { 11340, 46, "prohibit-LU-S-R45-Allowed-LT-L45-RT-RU" },
+    { 11341, 46, "prohibit-LU-S-R45-RU-Allowed-LT-L45-RT" },
+    { 11342, 46, "prohibit-LU-S-R45-RT-Allowed-LT-L45-RU" },
+    { 11343, 46, "prohibit-LU-S-R45-RT-RU-Allowed-LT-L45" },
+    { 11344, 46, "prohibit-LU-L45-Allowed-LT-S-R45-RT-RU" },
+    { 11345, 46, "prohibit-LU-L45-RU-Allowed-LT-S-R45-RT" },
+    { 11346, 46, "prohibit-LU-L45-RT-Allowed-LT-S-R45-RU" },
+    { 11347, 46, "prohibit-LU-L45-RT-RU-Allowed-LT-S-R45" },
+    { 11348, 46, "prohibit-LU-L45-R45-Allowed-LT-S-RT-RU" },
+    { 11349, 46, "prohibit-LU-L45-R45-RU-Allowed-LT-S-RT" },
+    { 11350, 46, "prohibit-LU-L45-R45-RT-Allowed-LT-S-RU" },
+    { 11351, 46, "prohibit-LU-L45-R45-RT-RU-Allowed-LT-S" },
+    { 11352, 46, "prohibit-LU-L45-S-Allowed-LT-R45-RT-RU" },
+    { 11353, 46, "prohibit-LU-L45-S-RU-Allowed-LT-R45-RT" },
+    { 11354, 46, "prohibit-LU-L45-S-RT-Allowed-LT-R45-RU" },
+    { 11355, 46, "prohibit-LU-L45-S-RT-RU-Allowed-LT-R45" },
+    { 11356, 46, "prohibit-LU-L45-S-R45-Allowed-LT-RT-RU" },
+    { 11357, 46, "prohibit-LU-L45-S-R45-RU-Allowed-LT-RT" },
+    { 11358, 46, "prohibit-LU-L45-S-R45-RT-Allowed-LT-RU" },
+    { 11359, 46, "prohibit-LU-L45-S-R45-RT-RU-Allowed-LT" },
+    { 11360, 46, "prohibit-LU-LT-Allowed-L45-S-R45-RT-RU" },
+    { 11361, 46, "prohibit-LU-LT-RU-Allowed-L45-S-R45-RT" },
+    { 11362, 46, "prohibit-LU-LT-RT-Allowed-L45-S-R45-RU" },
+    { 11363, 46, "prohibit-LU-LT-RT-RU-Allowed-L45-S-R45" },
+    { 11364, 46, "prohibit-LU-LT-R45-Allowed-L45-S-RT-RU" },
+    { 11365, 46, "prohibit-LU-LT-R45-RU-Allowed-L45-S-RT" },
+    { 11366, 46, "prohibit-LU-LT-R45-RT-Allowed-L45-S-RU" },
+    { 11367, 46, "prohibit-LU-LT-R45-RT-RU-Allowed-L45-S" },
+    { 11368, 46, "prohibit-LU-LT-S-Allowed-L45-R45-RT-RU" },
+    { 11369, 46, "prohibit-LU-LT-S-RU-Allowed-L45-R45-RT" },
+    { 11370, 46, "prohibit-LU-LT-S-RT-Allowed-L45-R45-RU" },
+    { 11371, 46, "prohibit-LU-LT-S-RT-RU-Allowed-L45-R45" },
+    { 11372, 46, "prohibit-LU-LT-S-R45-Allowed-L45-RT-RU" },
+    { 11373, 46, "prohibit-LU-LT-S-R45-RU-Allowed-L45-RT" },
+    { 11374, 46, "prohibit-LU-LT-S-R45-RT-Allowed-L45-RU" },
+    { 11375, 46, "prohibit-LU-LT-S-R45-RT-RU-Allowed-L45" },
+    { 11376, 46, "prohibit-LU-LT-L45-Allowed-S-R45-RT-RU" },
+    { 11377, 46, "prohibit-LU-LT-L45-RU-Allowed-S-R45-RT" },
+    { 11378, 46, "prohibit-LU-LT-L45-RT-Allowed-S-R45-RU" },
+    { 11379, 46, "prohibit-LU-LT-L45-RT-RU-Allowed-S-R45" },
+    { 11380, 46, "prohibit-LU-LT-L45-R45-Allowed-S-RT-RU" },
+    { 11381, 46, "prohibit-LU-LT-L45-R45-RU-Allowed-S-RT" },
+    { 11382, 46, "prohibit-LU-LT-L45-R45-RT-Allowed-S-RU" },
+    { 11383, 46, "prohibit-LU-LT-L45-R45-RT-RU-Allowed-S" },
+    { 11384, 46, "prohibit-LU-LT-L45-S-Allowed-R45-RT-RU" },
+    { 11385, 46, "prohibit-LU-LT-L45-S-RU-Allowed-R45-RT" },
+    { 11386, 46, "prohibit-LU-LT-L45-S-RT-Allowed-R45-RU" },
+    { 11387, 46, "prohibit-LU-LT-L45-S-RT-RU-Allowed-R45" },
+    { 11388, 46, "prohibit-LU-LT-L45-S-R45-Allowed-RT-RU" },
+    { 11389, 46, "prohibit-LU-LT-L45-S-R45-RU-Allowed-RT" },
+    { 11390, 46, "prohibit-LU-LT-L45-S-R45-RT-Allowed-RU" },
+    { 11391, 46, "prohibit-LU-LT-L45-S-R45-RT-RU-Allowed-None" },
+    { 11521, 15, "n1-16th" },
+    { 11522, 15, "n1-10th" },
+    { 11523, 15, "n1-8th" },
+    { 11524, 15, "n1-4th" },
+    { 11525, 15, "n1-3rd" },
+    { 11526, 15, "n1-2" },
+    { 11527, 15, "n3-4" },
+    { 11531, 15, "n300" },
+    { 11532, 15, "n350" },
+    { 11533, 15, "n400" },
+    { 11534, 15, "n450" },
+    { 11535, 15, "n500" },
+    { 11536, 15, "n550" },
+    { 11537, 15, "n600" },
+    { 11538, 15, "n650" },
+    { 11539, 15, "n700" },
+    { 11540, 15, "n750" },
+    { 11541, 15, "n800" },
+    { 11542, 15, "n850" },
+    { 11543, 15, "n900" },
+    { 11544, 15, "n950" },
+    { 11545, 15, "n1000" },
+    { 11546, 15, "n1100" },
+    { 11547, 15, "n1200" },
+    { 11548, 15, "n1300" },
+    { 11549, 15, "n1400" },
+    { 11550, 15, "n1500" },
+    { 11551, 15, "n1600" },
+    { 11552, 15, "n1700" },
+    { 11553, 15, "n1800" },
+    { 11554, 15, "n1900" },
+    { 11555, 15, "n2000" },
+    { 11556, 15, "n2100" },
+    { 11557, 15, "n2200" },
+    { 11558, 15, "n2300" },
+    { 11559, 15, "n2400" },
+    { 11560, 15, "n2500" },
+    { 11561, 15, "n2600" },
+    { 11562, 15, "n2700" },
+    { 11563, 15, "n2800" },
+    { 11564, 15, "n2900" },
+    { 11565, 15, "n3000" },
+    { 11566, 15, "n3500" },
+    { 11567, 15, "n4000" },
+    { 11568, 15, "n4500" },
+    { 11569, 15, "n5000" },
+    { 11570, 15, "n5500" },
+    { 11571, 15, "n6000" },
+    { 11572, 15, "n6500" },
+    { 11573, 15, "n7000" },
+    { 11574, 15, "n7500" },
+    { 11575, 15, "n8000" },
+    { 11576, 15, "n8500" },
+    { 11577, 15, "n9000" },
+    { 11578, 15, "n9500" },
+    { 11579, 15, "n10000" },
+    { 11580, 15, "n11000" },
+    { 11581, 15, "n12000" },
+    { 11582, 15, "n13000" },
+    { 11583, 15, "n14000" },
+    { 11584, 15, "n15000" },
+    { 11585, 15, "n16000" },
+    { 11586, 15, "n17000" },
+    { 11587, 15, "n18000" },
+    { 11588, 15, "n19000" },
+    { 11589, 15, "n20000" },
+    { 11590, 15, "n21000" },
+    { 11591, 15, "n22000" },
+    { 11592, 15, "n23000" },
+    { 11593, 15, "n24000" },
+    { 11594, 15, "n25000" },
+    { 11595, 15, "n26000" },
+    { 11596, 15, "n27000" },
+    { 11597, 15, "n28000" },
+    { 11598, 15, "n29000" },
+    { 11599, 15, "n30000" },
+    { 11600, 15, "n35000" },
+    { 11601, 15, "n40000" },
+    { 11602, 15, "n45000" },
+    { 11603, 15, "n50000" },
+    { 11604, 15, "n55000" },
+    { 11605, 15, "n60000" },
+    { 11606, 15, "n65000" },
+    { 11607, 15, "n70000" },
+    { 11608, 15, "n75000" },
+    { 11609, 15, "n80000" },
+    { 11610, 15, "n85000" },
+    { 11611, 15, "n90000" },
+    { 11612, 15, "n95000" },
+    { 11613, 15, "n100000" },
+    { 11777, 18, "name-follows" },
+    { 11778, 18, "freeway" },
+    { 11779, 18, "us-Route" },
+    { 11780, 18, "state-Route" },
+    { 11781, 18, "interstate" },
+    { 11782, 18, "business-Loop" },
+    { 11783, 18, "alternative" },
+    { 11784, 18, "county-Route" },
+    { 11785, 18, "forest-Route" },
+    { 11786, 18, "farm-to-Market-Route" },
+    { 11787, 18, "eisenhower-Interstate-System" },
+    { 11788, 18, "americas-Byways" },
+    { 11789, 18, "national-Network-Route" },
+    { 11790, 18, "scenic-Area" },
+    { 11791, 18, "parking-Area" },
+    { 11792, 18, "weight-Station" },
+    { 11793, 18, "road" },
+    { 11794, 18, "exit" },
+    { 11795, 18, "historical-route" },
+    { 11796, 18, "state-line" },
+    { 11797, 18, "spur" },
+    { 11798, 18, "junction" },
+    { 11799, 18, "bicycle-route" },
+    { 11800, 18, "bicycle-interstate-route" },
+    { 11801, 18, "national-park" },
+    { 12033, 25, "bear-viewing-area" },
+    { 12034, 25, "deer-viewing-area" },
+    { 12035, 25, "drinking-water" },
+    { 12036, 25, "environmental-study-area" },
+    { 12037, 25, "falling-rocks" },
+    { 12038, 25, "firearms" },
+    { 12039, 25, "leashed-pets" },
+    { 12040, 25, "point-of-interest" },
+    { 12041, 25, "smoking" },
+    { 12042, 25, "dog" },
+    { 12043, 25, "tent-camping" },
+    { 12044, 25, "trailer-camping" },
+    { 12045, 25, "first-aid" },
+    { 12046, 25, "handicapped" },
+    { 12047, 25, "mechanic" },
+    { 12048, 25, "trailer-sanitary-station" },
+    { 12049, 25, "viewing-area" },
+    { 12050, 25, "campfire" },
+    { 12051, 25, "locker" },
+    { 12052, 25, "sleeping" },
+    { 12053, 25, "trail" },
+    { 12054, 25, "climbing" },
+    { 12055, 25, "rock-climbing" },
+    { 12056, 25, "hunting" },
+    { 12057, 25, "playground" },
+    { 12058, 25, "rock-collecting" },
+    { 12059, 25, "spelunking" },
+    { 12060, 25, "bicycle-trail" },
+    { 12061, 25, "hiking-trail" },
+    { 12062, 25, "horse-trail" },
+    { 12063, 25, "trail-interpretive-auto" },
+    { 12064, 25, "trail-interpretive-pedestrian" },
+    { 12065, 25, "trail-road-for-4WD-vehicles" },
+    { 12066, 25, "trail-for-trail-bikes" },
+    { 12067, 25, "archer" },
+    { 12068, 25, "hang-glider" },
+    { 12069, 25, "boat-tours" },
+    { 12070, 25, "canoeing" },
+    { 12071, 25, "diving" },
+    { 12072, 25, "scuba-diving" },
+    { 12073, 25, "fishing" },
+    { 12074, 25, "marine-recreation-area" },
+    { 12075, 25, "motorboating" },
+    { 12076, 25, "boat-ramp" },
+    { 12077, 25, "rowboating" },
+    { 12078, 25, "sailboating" },
+    { 12079, 25, "water-skiing" },
+    { 12080, 25, "surfing" },
+    { 12081, 25, "swimming" },
+    { 12082, 25, "wading" },
+    { 12083, 25, "hand-launch" },
+    { 12084, 25, "kayak" },
+    { 12085, 25, "wind-surf" },
+    { 12086, 25, "ice-skating" },
+    { 12087, 25, "ski-jumping" },
+    { 12088, 25, "bobbing" },
+    { 12089, 25, "cross-country-skiing" },
+    { 12090, 25, "downhill-skiing" },
+    { 12091, 25, "sledding" },
+    { 12092, 25, "snowmobiling" },
+    { 12093, 25, "snowshoeing" },
+    { 12094, 25, "winter-recreation-area" },
+    { 12095, 25, "scenic-overlook" },
+    { 12289, 26, "regulatory-sign" },
+    { 12290, 26, "warning-sign" },
+    { 12291, 26, "information-sign" },
+    { 12292, 26, "construction-sign" },
+    { 12293, 26, "guide-sign" },
+    { 12294, 26, "stop" },
+    { 12295, 26, "yield" },
+    { 12296, 26, "to-oncoming-traffic" },
+    { 12297, 26, "four-way" },
+    { 12298, 26, "all-way" },
+    { 12299, 26, "zone" },
+    { 12300, 26, "narrows" },
+    { 12301, 26, "widens" },
+    { 12302, 26, "reduced" },
+    { 12303, 26, "combined" },
+    { 12304, 26, "minimum" },
+    { 12305, 26, "maximum" },
+    { 12306, 26, "divided-road" },
+    { 12307, 26, "double-arrow" },
+    { 12308, 26, "dead-end" },
+    { 12309, 26, "no-outlet" },
+    { 12310, 26, "wrong-way" },
+    { 12312, 26, "nDetour" },
+    { 12313, 26, "chevron" },
+    { 12314, 26, "do-not-enter" },
+    { 12315, 26, "t-intersection-to-the-side" },
+    { 12316, 26, "t-intersection-oncoming" },
+    { 12317, 26, "y-intersection-to-the-side" },
+    { 12318, 26, "y-intersection-oncoming" },
+    { 12319, 26, "four-way-divided-highway-crossing" },
+    { 12320, 26, "t-way-divided-highway-crossing" },
+    { 12321, 26, "light-rail-divided-highway-crossing" },
+    { 12322, 26, "light-rail-t-divided-highway-crossing" },
+    { 12323, 26, "side-road-to-right" },
+    { 12324, 26, "side-road-to-left" },
+    { 12325, 26, "side-road-to-right-at-angle" },
+    { 12326, 26, "side-road-to-left-at-angle" },
+    { 12327, 26, "entering-roadway-merge" },
+    { 12328, 26, "entering-roadway-added-lane" },
+    { 12329, 26, "one-way" },
+    { 12330, 26, "caution" },
+    { 12331, 26, "temporary" },
+    { 12545, 31, "n1" },
+    { 12546, 31, "n2" },
+    { 12547, 31, "n3" },
+    { 12548, 31, "n4" },
+    { 12549, 31, "n5" },
+    { 12550, 31, "n6" },
+    { 12551, 31, "n7" },
+    { 12552, 31, "n8" },
+    { 12553, 31, "n9" },
+    { 12554, 31, "n10" },
+    { 12555, 31, "n11" },
+    { 12556, 31, "n12" },
+    { 12557, 31, "n13" },
+    { 12558, 31, "n14" },
+    { 12559, 31, "n15" },
+    { 12560, 31, "n16" },
+    { 12561, 31, "n17" },
+    { 12562, 31, "n18" },
+    { 12563, 31, "n19" },
+    { 12564, 31, "n20" },
+    { 12565, 31, "n21" },
+    { 12566, 31, "n22" },
+    { 12567, 31, "n23" },
+    { 12568, 31, "n24" },
+    { 12569, 31, "n25" },
+    { 12570, 31, "n26" },
+    { 12571, 31, "n27" },
+    { 12572, 31, "n28" },
+    { 12573, 31, "n29" },
+    { 12574, 31, "n30" },
+    { 12575, 31, "n31" },
+    { 12576, 31, "n32" },
+    { 12577, 31, "n33" },
+    { 12578, 31, "n34" },
+    { 12579, 31, "n35" },
+    { 12580, 31, "n36" },
+    { 12581, 31, "n37" },
+    { 12582, 31, "n38" },
+    { 12583, 31, "n39" },
+    { 12584, 31, "n40" },
+    { 12585, 31, "n41" },
+    { 12586, 31, "n42" },
+    { 12587, 31, "n43" },
+    { 12588, 31, "n44" },
+    { 12589, 31, "n45" },
+    { 12590, 31, "n46" },
+    { 12591, 31, "n47" },
+    { 12592, 31, "n48" },
+    { 12593, 31, "n49" },
+    { 12594, 31, "n50" },
+    { 12595, 31, "n51" },
+    { 12596, 31, "n52" },
+    { 12597, 31, "n53" },
+    { 12598, 31, "n54" },
+    { 12599, 31, "n55" },
+    { 12600, 31, "n56" },
+    { 12601, 31, "n57" },
+    { 12602, 31, "n58" },
+    { 12603, 31, "n59" },
+    { 12604, 31, "n60" },
+    { 12605, 31, "n61" },
+    { 12606, 31, "n62" },
+    { 12607, 31, "n63" },
+    { 12608, 31, "n64" },
+    { 12609, 31, "n65" },
+    { 12610, 31, "n66" },
+    { 12611, 31, "n67" },
+    { 12612, 31, "n68" },
+    { 12613, 31, "n69" },
+    { 12614, 31, "n70" },
+    { 12615, 31, "n71" },
+    { 12616, 31, "n72" },
+    { 12617, 31, "n73" },
+    { 12618, 31, "n74" },
+    { 12619, 31, "n75" },
+    { 12620, 31, "n76" },
+    { 12621, 31, "n77" },
+    { 12622, 31, "n78" },
+    { 12623, 31, "n79" },
+    { 12624, 31, "n80" },
+    { 12625, 31, "n81" },
+    { 12626, 31, "n82" },
+    { 12627, 31, "n83" },
+    { 12628, 31, "n84" },
+    { 12629, 31, "n85" },
+    { 12630, 31, "n86" },
+    { 12631, 31, "n87" },
+    { 12632, 31, "n88" },
+    { 12633, 31, "n89" },
+    { 12634, 31, "n90" },
+    { 12635, 31, "n91" },
+    { 12636, 31, "n92" },
+    { 12637, 31, "n93" },
+    { 12638, 31, "n94" },
+    { 12639, 31, "n95" },
+    { 12640, 31, "n96" },
+    { 12641, 31, "n97" },
+    { 12642, 31, "n98" },
+    { 12643, 31, "n99" },
+    { 12644, 31, "n100" },
+    { 12645, 31, "n101" },
+    { 12646, 31, "n102" },
+    { 12647, 31, "n103" },
+    { 12648, 31, "n104" },
+    { 12649, 31, "n105" },
+    { 12650, 31, "n106" },
+    { 12651, 31, "n107" },
+    { 12652, 31, "n108" },
+    { 12653, 31, "n109" },
+    { 12654, 31, "n110" },
+    { 12655, 31, "n111" },
+    { 12656, 31, "n112" },
+    { 12657, 31, "n113" },
+    { 12658, 31, "n114" },
+    { 12659, 31, "n115" },
+    { 12660, 31, "n116" },
+    { 12661, 31, "n117" },
+    { 12662, 31, "n118" },
+    { 12663, 31, "n119" },
+    { 12664, 31, "n120" },
+    { 12665, 31, "n121" },
+    { 12666, 31, "n122" },
+    { 12667, 31, "n123" },
+    { 12668, 31, "n124" },
+    { 12669, 31, "n125" },
+    { 12670, 31, "n126" },
+    { 12671, 31, "n127" },
+    { 12672, 31, "n128" },
+    { 12673, 31, "n129" },
+    { 12674, 31, "n130" },
+    { 12675, 31, "n131" },
+    { 12676, 31, "n132" },
+    { 12677, 31, "n133" },
+    { 12678, 31, "n134" },
+    { 12679, 31, "n135" },
+    { 12680, 31, "n136" },
+    { 12681, 31, "n137" },
+    { 12682, 31, "n138" },
+    { 12683, 31, "n139" },
+    { 12684, 31, "n140" },
+    { 12685, 31, "n141" },
+    { 12686, 31, "n142" },
+    { 12687, 31, "n143" },
+    { 12688, 31, "n144" },
+    { 12689, 31, "n145" },
+    { 12690, 31, "n146" },
+    { 12691, 31, "n147" },
+    { 12692, 31, "n148" },
+    { 12693, 31, "n149" },
+    { 12694, 31, "n150" },
+    { 12695, 31, "n151" },
+    { 12696, 31, "n152" },
+    { 12697, 31, "n153" },
+    { 12698, 31, "n154" },
+    { 12699, 31, "n155" },
+    { 12700, 31, "n156" },
+    { 12701, 31, "n157" },
+    { 12702, 31, "n158" },
+    { 12703, 31, "n159" },
+    { 12704, 31, "n160" },
+    { 12705, 31, "n161" },
+    { 12706, 31, "n162" },
+    { 12707, 31, "n163" },
+    { 12708, 31, "n164" },
+    { 12709, 31, "n165" },
+    { 12710, 31, "n166" },
+    { 12711, 31, "n167" },
+    { 12712, 31, "n168" },
+    { 12713, 31, "n169" },
+    { 12714, 31, "n170" },
+    { 12715, 31, "n171" },
+    { 12716, 31, "n172" },
+    { 12717, 31, "n173" },
+    { 12718, 31, "n174" },
+    { 12719, 31, "n175" },
+    { 12720, 31, "n176" },
+    { 12721, 31, "n177" },
+    { 12722, 31, "n178" },
+    { 12723, 31, "n179" },
+    { 12724, 31, "n180" },
+    { 12725, 31, "n181" },
+    { 12726, 31, "n182" },
+    { 12727, 31, "n183" },
+    { 12728, 31, "n184" },
+    { 12729, 31, "n185" },
+    { 12730, 31, "n186" },
+    { 12731, 31, "n187" },
+    { 12732, 31, "n188" },
+    { 12733, 31, "n189" },
+    { 12734, 31, "n190" },
+    { 12735, 31, "n191" },
+    { 12736, 31, "n192" },
+    { 12737, 31, "n193" },
+    { 12738, 31, "n194" },
+    { 12739, 31, "n195" },
+    { 12740, 31, "n196" },
+    { 12741, 31, "n197" },
+    { 12742, 31, "n198" },
+    { 12743, 31, "n199" },
+    { 12744, 31, "n200" },
+    { 12745, 31, "n201" },
+    { 12746, 31, "n202" },
+    { 12747, 31, "n203" },
+    { 12748, 31, "n204" },
+    { 12749, 31, "n205" },
+    { 12750, 31, "n206" },
+    { 12751, 31, "n207" },
+    { 12752, 31, "n208" },
+    { 12753, 31, "n209" },
+    { 12754, 31, "n210" },
+    { 12755, 31, "n211" },
+    { 12756, 31, "n212" },
+    { 12757, 31, "n213" },
+    { 12758, 31, "n214" },
+    { 12759, 31, "n215" },
+    { 12760, 31, "n216" },
+    { 12761, 31, "n217" },
+    { 12762, 31, "n218" },
+    { 12763, 31, "n219" },
+    { 12764, 31, "n220" },
+    { 12765, 31, "n221" },
+    { 12766, 31, "n222" },
+    { 12767, 31, "n223" },
+    { 12768, 31, "n224" },
+    { 12769, 31, "n225" },
+    { 12770, 31, "n226" },
+    { 12771, 31, "n227" },
+    { 12772, 31, "n228" },
+    { 12773, 31, "n229" },
+    { 12774, 31, "n230" },
+    { 12775, 31, "n231" },
+    { 12776, 31, "n232" },
+    { 12777, 31, "n233" },
+    { 12778, 31, "n234" },
+    { 12779, 31, "n235" },
+    { 12780, 31, "n236" },
+    { 12781, 31, "n237" },
+    { 12782, 31, "n238" },
+    { 12783, 31, "n239" },
+    { 12784, 31, "n240" },
+    { 12785, 31, "n241" },
+    { 12786, 31, "n242" },
+    { 12787, 31, "n243" },
+    { 12788, 31, "n244" },
+    { 12789, 31, "n245" },
+    { 12790, 31, "n246" },
+    { 12791, 31, "n247" },
+    { 12792, 31, "n248" },
+    { 12793, 31, "n249" },
+    { 12794, 31, "n250" },
+    { 12795, 31, "n251" },
+    { 12796, 31, "n252" },
+    { 12797, 31, "n253" },
+    { 12798, 31, "n254" },
+    { 12799, 31, "n255" },
+    { 12801, 34, "alabama" },
+    { 12802, 34, "alaska" },
+    { 12803, 34, "american-Samoa" },
+    { 12804, 34, "arizona" },
+    { 12805, 34, "arkansas" },
+    { 12806, 34, "california" },
+    { 12807, 34, "colorado" },
+    { 12808, 34, "connecticut" },
+    { 12809, 34, "delaware" },
+    { 12810, 34, "district-of-Columbia" },
+    { 12811, 34, "florida" },
+    { 12812, 34, "georgia" },
+    { 12813, 34, "guam" },
+    { 12814, 34, "hawaii" },
+    { 12815, 34, "idaho" },
+    { 12816, 34, "illinois" },
+    { 12817, 34, "indiana" },
+    { 12818, 34, "iowa" },
+    { 12819, 34, "kansas" },
+    { 12820, 34, "kentucky" },
+    { 12821, 34, "louisiana" },
+    { 12822, 34, "maine" },
+    { 12823, 34, "maryland" },
+    { 12824, 34, "massachusetts" },
+    { 12825, 34, "michigan" },
+    { 12826, 34, "minnesota" },
+    { 12827, 34, "mississippi" },
+    { 12828, 34, "missouri" },
+    { 12829, 34, "montana" },
+    { 12830, 34, "nebraska" },
+    { 12831, 34, "nevada" },
+    { 12832, 34, "new-Hampshire" },
+    { 12833, 34, "new-Jersey" },
+    { 12834, 34, "new-Mexico" },
+    { 12835, 34, "new-York" },
+    { 12836, 34, "north-Carolina" },
+    { 12837, 34, "north-Dakota" },
+    { 12838, 34, "northern-Marianas-Islands" },
+    { 12839, 34, "ohio" },
+    { 12840, 34, "oklahoma" },
+    { 12841, 34, "oregon" },
+    { 12842, 34, "pennsylvania" },
+    { 12843, 34, "puerto-rico" },
+    { 12844, 34, "rhode-Island" },
+    { 12845, 34, "south-Carolina" },
+    { 12846, 34, "south-Dakota" },
+    { 12847, 34, "tennessee" },
+    { 12848, 34, "texas" },
+    { 12849, 34, "utah" },
+    { 12850, 34, "vermont" },
+    { 12851, 34, "virginia" },
+    { 12852, 34, "virgin-Islands" },
+    { 12853, 34, "washington" },
+    { 12854, 34, "west-Virginia" },
+    { 12855, 34, "wisconsin" },
+    { 12856, 34, "wyoming" },
+    { 13057, 36, "rest-room" },
+    { 13058, 36, "mens-rest-room" },
+    { 13059, 36, "womens-rest-room" },
+    { 13060, 36, "family-rest-room" },
+    { 13061, 36, "dam" },
+    { 13062, 36, "fish-hatchery" },
+    { 13063, 36, "information" },
+    { 13064, 36, "lighthouse" },
+    { 13065, 36, "lookout-tower" },
+    { 13066, 36, "ranger-station" },
+    { 13068, 36, "grocery-store" },
+    { 13069, 36, "lodging" },
+    { 13070, 36, "post-office" },
+    { 13072, 36, "picnic-shelter" },
+    { 13073, 36, "group-camping" },
+    { 13074, 36, "group-picnicking" },
+    { 13075, 36, "n24-hour-pharmacy" },
+    { 13076, 36, "kennel" },
+    { 13077, 36, "laundry-facilities" },
+    { 13078, 36, "shower-facilities" },
+    { 13079, 36, "amphitheater" },
+    { 13080, 36, "stable" },
+    { 13081, 36, "hospital" },
+    { 13082, 36, "emergency-medical-service-point" },
+    { 13083, 36, "library" },
+    { 13084, 36, "recycling-collection-center" },
+    { 13085, 36, "school" },
+    { 13313, 35, "alley" },
+    { 13314, 35, "annex" },
+    { 13315, 35, "arcade" },
+    { 13316, 35, "avenue" },
+    { 13317, 35, "bayoo" },
+    { 13318, 35, "beach" },
+    { 13319, 35, "bend" },
+    { 13320, 35, "bluff" },
+    { 13321, 35, "bottom" },
+    { 13322, 35, "boulevard" },
+    { 13323, 35, "branch" },
+    { 13324, 35, "nBridge" },
+    { 13325, 35, "brook" },
+    { 13326, 35, "burg" },
+    { 13327, 35, "bypass" },
+    { 13328, 35, "camp" },
+    { 13329, 35, "canyon" },
+    { 13330, 35, "cape" },
+    { 13331, 35, "causeway" },
+    { 13332, 35, "nCenter" },
+    { 13333, 35, "circle" },
+    { 13334, 35, "cliff" },
+    { 13335, 35, "club" },
+    { 13336, 35, "common" },
+    { 13337, 35, "corner" },
+    { 13338, 35, "course" },
+    { 13339, 35, "court" },
+    { 13340, 35, "cove" },
+    { 13341, 35, "creek" },
+    { 13342, 35, "crescent" },
+    { 13343, 35, "crest" },
+    { 13344, 35, "nCrossing" },
+    { 13345, 35, "crossroad" },
+    { 13346, 35, "curve" },
+    { 13347, 35, "dale" },
+    { 13348, 35, "nDam" },
+    { 13349, 35, "divide" },
+    { 13350, 35, "drive" },
+    { 13351, 35, "estate" },
+    { 13352, 35, "expressway" },
+    { 13353, 35, "extension" },
+    { 13354, 35, "fall" },
+    { 13355, 35, "nFerry" },
+    { 13356, 35, "field" },
+    { 13357, 35, "flat" },
+    { 13358, 35, "ford" },
+    { 13359, 35, "forest" },
+    { 13360, 35, "forge" },
+    { 13361, 35, "fork" },
+    { 13362, 35, "fort" },
+    { 13363, 35, "nFreeway" },
+    { 13364, 35, "garden" },
+    { 13365, 35, "gateway" },
+    { 13366, 35, "glen" },
+    { 13367, 35, "green" },
+    { 13368, 35, "grove" },
+    { 13369, 35, "harbor" },
+    { 13370, 35, "haven" },
+    { 13371, 35, "heights" },
+    { 13372, 35, "highway" },
+    { 13373, 35, "nHill" },
+    { 13374, 35, "hollow" },
+    { 13375, 35, "inlet" },
+    { 13376, 35, "nIsland" },
+    { 13377, 35, "isle" },
+    { 13378, 35, "nJunction" },
+    { 13379, 35, "key" },
+    { 13380, 35, "knoll" },
+    { 13381, 35, "lake" },
+    { 13382, 35, "land" },
+    { 13383, 35, "landing" },
+    { 13384, 35, "nLane" },
+    { 13385, 35, "light" },
+    { 13386, 35, "loaf" },
+    { 13387, 35, "lock" },
+    { 13388, 35, "lodge" },
+    { 13389, 35, "loop" },
+    { 13390, 35, "mall" },
+    { 13391, 35, "manor" },
+    { 13392, 35, "meadow" },
+    { 13393, 35, "mews" },
+    { 13394, 35, "mill" },
+    { 13395, 35, "mission" },
+    { 13396, 35, "motorway" },
+    { 13397, 35, "mount" },
+    { 13398, 35, "mountain" },
+    { 13399, 35, "neck" },
+    { 13400, 35, "orchard" },
+    { 13401, 35, "oval" },
+    { 13402, 35, "nOverpass" },
+    { 13403, 35, "park" },
+    { 13404, 35, "parkway" },
+    { 13405, 35, "nPass" },
+    { 13406, 35, "passage" },
+    { 13407, 35, "path" },
+    { 13408, 35, "pike" },
+    { 13409, 35, "pine" },
+    { 13410, 35, "plains" },
+    { 13411, 35, "plaza" },
+    { 13412, 35, "point" },
+    { 13413, 35, "port" },
+    { 13414, 35, "prairie" },
+    { 13415, 35, "radial" },
+    { 13416, 35, "ramp" },
+    { 13417, 35, "ranch" },
+    { 13418, 35, "rapid" },
+    { 13419, 35, "rest" },
+    { 13420, 35, "ridge" },
+    { 13421, 35, "river" },
+    { 13422, 35, "nRoad" },
+    { 13423, 35, "route" },
+    { 13424, 35, "row" },
+    { 13425, 35, "rue" },
+    { 13426, 35, "run" },
+    { 13427, 35, "shoal" },
+    { 13428, 35, "shore" },
+    { 13429, 35, "skyway" },
+    { 13430, 35, "spring" },
+    { 13431, 35, "nSpur" },
+    { 13432, 35, "square" },
+    { 13433, 35, "nStation" },
+    { 13434, 35, "stravenue" },
+    { 13435, 35, "stream" },
+    { 13436, 35, "street" },
+    { 13437, 35, "summit" },
+    { 13438, 35, "terrace" },
+    { 13439, 35, "throughway" },
+    { 13440, 35, "trace" },
+    { 13441, 35, "nTrack" },
+    { 13442, 35, "trafficway" },
+    { 13443, 35, "nTrail" },
+    { 13444, 35, "nTunnel" },
+    { 13445, 35, "turnpike" },
+    { 13446, 35, "nUnderpass" },
+    { 13447, 35, "union" },
+    { 13448, 35, "valley" },
+    { 13449, 35, "viaduct" },
+    { 13450, 35, "view" },
+    { 13451, 35, "village" },
+    { 13452, 35, "ville" },
+    { 13453, 35, "vista" },
+    { 13454, 35, "nWalk" },
+    { 13455, 35, "wall" },
+    { 13456, 35, "way" },
+    { 13457, 35, "well" },
+    { 13569, 16, "ahead" },
+    { 13570, 16, "here" },
+    { 13571, 16, "here-to" },
+    { 13572, 16, "here-to-alley" },
+    { 13573, 16, "here-to-corner" },
+    { 13574, 16, "here-to-sign" },
+    { 13575, 16, "between-signs" },
+    { 13576, 16, "this-side-of-street" },
+    { 13577, 16, "this-side-of-sign" },
+    { 13579, 16, "right" },
+    { 13580, 16, "left" },
+    { 13581, 16, "begin-point" },
+    { 13582, 16, "next" },
+    { 13583, 16, "ends-end" },
+    { 13584, 16, "other-Side" },
+    { 13585, 16, "crossing" },
+    { 13586, 16, "crosswalks" },
+    { 13587, 16, "center-strip" },
+    { 13588, 16, "lane" },
+    { 13589, 16, "hill" },
+    { 13590, 16, "both-ways-left-and-right" },
+    { 13591, 16, "both-ways-45-degree-angle-tilting-right" },
+    { 13592, 16, "both-ways-45-degree-angle-tilting-left" },
+    { 13593, 16, "both-directions-of-travel" },
+    { 13594, 16, "left-turn" },
+    { 13595, 16, "left-45-degree-arrow" },
+    { 13596, 16, "left-45-degree-turn" },
+    { 13597, 16, "ahead-and-to-the-left" },
+    { 13598, 16, "ahead-and-to-the-left-at-a-45-degree-angle" },
+    { 13599, 16, "right-turn" },
+    { 13600, 16, "right-45-degree-arrow" },
+    { 13601, 16, "right-45-degree-turn" },
+    { 13602, 16, "ahead-and-to-the-right" },
+    { 13603, 16, "ahead-and-to-the-right-at-a-45-degree-angle" },
+    { 13604, 16, "downward-left-45-degree" },
+    { 13605, 16, "downward-right-45-degree" },
+    { 13606, 16, "downward-left-and-right-45-degree" },
+    { 13609, 16, "right-arrow" },
+    { 13610, 16, "left-arrow" },
+    { 13611, 16, "starting-start" },
+    { 13613, 16, "chevron-right" },
+    { 13614, 16, "chevron-left" },
+    { 13615, 16, "right-turn-with-junction" },
+    { 13616, 16, "left-turn-with-junction" },
+    { 13617, 16, "hairpin-right" },
+    { 13618, 16, "hairpin-left" },
+    { 13619, 16, "truck-rollover-right" },
+    { 13620, 16, "truck-rollover-left" },
+    { 13621, 16, "n270-degree-turn-right" },
+    { 13622, 16, "n270-degree-turn-left" },
+    { 13623, 16, "two-lane-reverse-curve-to-right" },
+    { 13624, 16, "two-lane-reverse-curve-to-left" },
+    { 13625, 16, "three-lane-reverse-curve-to-right" },
+    { 13626, 16, "three-lane-reverse-curve-to-left" },
+    { 13627, 16, "double-reverse-curve-to-right" },
+    { 13628, 16, "double-reverse-curve-to-left" },
+    { 13629, 16, "two-lane-double-reverse-curve-to-right" },
+    { 13630, 16, "two-lane-double-reverse-curve-to-left" },
+    { 13631, 16, "three-lane-double-reverse-curve-to-right" },
+    { 13632, 16, "three-lane-double-reverse-curve-to-left" },
+    { 13633, 16, "between" },
+    { 13634, 16, "shelter" },
+    { 13635, 16, "center" },
+    { 13636, 16, "reverse-turn-to-right" },
+    { 13637, 16, "reverse-turn-to-left" },
+    { 13638, 16, "reverse-curve-to-right" },
+    { 13639, 16, "reverse-curve-to-left" },
+    { 13640, 16, "winding-road-to-right" },
+    { 13641, 16, "winding-road-to-left" },
+};
+
+// indices into itisByCode, sorted by name
+static uint16_t const itisByName[LIBSM_ITIS_COUNT] = {
+    1391, 1313, 1133, 41, 219, 1225, 847, 21, 71, 38, 27, 28,
+    29, 30, 70, 31, 32, 33, 55, 1117, 1020, 902, 942, 1534,
+    168, 878, 1197, 883, 851, 2387, 2414, 2415, 2419, 2420, 1525, 361,
+    594, 593, 609, 595, 596, 403, 1201, 1281, 1298, 1297, 1292, 1258,
+    968, 1192, 435, 2159, 2160, 732, 775, 1513, 1086, 1085, 462, 1031,
+    191, 1204, 1871, 2242, 829, 634, 1780, 1551, 1321, 1547, 1269, 2161,
+    1785, 2235, 889, 144, 147, 2243, 1510, 910, 781, 1017, 2244, 1833,
+    1013, 2162, 2163, 850, 939, 1256, 1411, 1216, 527, 528, 347, 372,
+    1452, 1451, 853, 681, 959, 979, 980, 981, 1198, 423, 162, 108,
+    2245, 771, 717, 299, 317, 297, 315, 1312, 971, 524, 1388, 1387,
+    1394, 1386, 1384, 1383, 1385, 413, 414, 2246, 811, 2247, 1389, 1799,
+    852, 2398, 901, 766, 848, 2248, 2447, 2393, 1797, 424, 1796, 1826,
+    1205, 1263, 141, 652, 107, 536, 906, 79, 80, 884, 589, 590,
+    584, 2249, 1303, 1842, 1835, 1854, 334, 399, 1322, 2410, 2409, 2408,
+    2407, 2250, 2251, 415, 2252, 1305, 1067, 105, 106, 759, 104, 1453,
+    156, 2254, 353, 1291, 352, 275, 119, 2255, 1180, 1454, 304, 1058,
+    1027, 69, 1215, 1779, 181, 1011, 2256, 1199, 2164, 271, 493, 570,
+    2257, 1816, 778, 185, 1836, 2258, 2259, 504, 1507, 446, 300, 1059,
+    301, 318, 1207, 1209, 1211, 1210, 1543, 2260, 1902, 1422, 2449, 1035,
+    2404, 1515, 866, 836, 398, 1521, 56, 1885, 2428, 2427, 1315, 2262,
+    391, 390, 830, 515, 173, 333, 777, 90, 89, 2263, 1820, 1063,
+    793, 74, 75, 77, 78, 76, 73, 508, 2264, 1030, 624, 625,
+    84, 157, 2165, 1323, 1876, 1242, 2265, 1259, 1183, 1100, 437, 969,
+    1428, 1379, 1381, 1382, 1380, 328, 2166, 885, 1050, 1108, 1107, 1106,
+    1105, 1865, 100, 1324, 94, 14, 15, 230, 240, 1226, 622, 623,
+    2266, 1446, 1781, 1267, 2267, 2268, 2269, 124, 118, 1311, 2270, 2271,
+    2272, 373, 1455, 921, 1855, 785, 1025, 990, 2402, 1024, 2274, 2403,
+    572, 454, 385, 183, 669, 1435, 674, 10, 613, 2275, 972, 1066,
+    2276, 2219, 895, 266, 549, 733, 734, 735, 638, 217, 529, 531,
+    908, 533, 1140, 1881, 138, 1554, 670, 1542, 1800, 1143, 1144, 1145,
+    2167, 180, 175, 208, 207, 179, 204, 1228, 386, 576, 1257, 976,
+    66, 273, 1114, 1098, 1102, 1092, 559, 629, 1188, 1508, 1235, 703,
+    1007, 45, 44, 46, 43, 42, 371, 2168, 2278, 1879, 1837, 905,
+    718, 828, 1886, 1097, 790, 720, 975, 1808, 432, 1157, 1160, 1260,
+    1880, 2442, 2441, 150, 149, 1856, 2421, 2423, 2422, 1294, 1433, 672,
+    1801, 2279, 779, 800, 780, 702, 701, 557, 125, 1392, 518, 683,
+    879, 1344, 920, 530, 591, 34, 360, 997, 992, 1456, 1784, 1087,
+    1239, 278, 1054, 1069, 1176, 1431, 1555, 279, 1061, 117, 2238, 501,
+    478, 1445, 1110, 479, 248, 1419, 247, 1264, 218, 741, 214, 915,
+    903, 776, 2400, 1287, 1018, 936, 1900, 1899, 944, 837, 1423, 1802,
+    258, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467,
+    1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479,
+    1430, 1072, 2280, 977, 845, 814, 1523, 772, 1111, 337, 456, 472,
+    907, 238, 1224, 927, 442, 1791, 1019, 1438, 871, 673, 368, 402,
+    1051, 2281, 1533, 2282, 736, 206, 332, 627, 615, 706, 553, 1166,
+    807, 445, 514, 196, 2283, 148, 859, 860, 1803, 858, 1519, 2218,
+    375, 1480, 1481, 1482, 1483, 1484, 223, 1783, 1325, 1265, 1120, 1128,
+    269, 1194, 441, 2285, 379, 762, 764, 763, 765, 886, 1302, 335,
+    336, 355, 357, 359, 358, 356, 1271, 1804, 839, 447, 1811, 2220,
+    1839, 1516, 1412, 340, 2286, 1350, 1161, 155, 2169, 1151, 577, 605,
+    607, 1095, 1099, 1094, 1096, 719, 325, 327, 1546, 416, 887, 2287,
+    2288, 1782, 350, 2289, 2290, 2291, 900, 1870, 1891, 696, 697, 1191,
+    1775, 1275, 579, 655, 195, 665, 1016, 856, 544, 169, 170, 659,
+    668, 646, 57, 461, 460, 453, 565, 1152, 410, 380, 1374, 2293,
+    159, 110, 1234, 1509, 970, 1415, 2294, 2170, 2295, 1545, 418, 1167,
+    899, 1146, 667, 1326, 354, 677, 2296, 1528, 1527, 2225, 298, 1279,
+    1286, 1444, 2229, 2230, 2297, 2171, 1437, 268, 1866, 377, 571, 1327,
+    1316, 1272, 302, 303, 1057, 550, 2432, 2431, 1849, 1812, 473, 1834,
+    1402, 1403, 1405, 1404, 2298, 1044, 911, 2299, 2172, 705, 239, 1223,
+    1113, 58, 291, 581, 205, 618, 614, 543, 1280, 1293, 554, 537,
+    1328, 1274, 3, 1213, 821, 820, 1118, 1329, 295, 313, 2300, 1300,
+    1299, 146, 2388, 2389, 2390, 2391, 2392, 874, 1310, 1220, 216, 215,
+    401, 2301, 1073, 1827, 2406, 1792, 1202, 419, 1136, 1250, 455, 2303,
+    1541, 1544, 224, 427, 1828, 2237, 616, 436, 617, 1139, 1822, 562,
+    563, 1240, 650, 654, 604, 542, 653, 1852, 545, 651, 2173, 2174,
+    1393, 633, 274, 849, 502, 833, 950, 953, 938, 1359, 949, 954,
+    1021, 988, 955, 951, 952, 945, 941, 989, 956, 935, 1119, 39,
+    72, 339, 783, 738, 2175, 2221, 492, 491, 494, 498, 505, 1864,
+    978, 1241, 324, 326, 23, 2304, 1056, 838, 1261, 1028, 1778, 2176,
+    198, 708, 1448, 2306, 51, 53, 52, 1795, 1131, 2177, 1850, 844,
+    817, 816, 782, 2232, 2178, 2308, 1147, 1155, 1126, 1127, 2309, 1132,
+    1236, 2310, 2311, 2312, 164, 2405, 1407, 241, 243, 242, 319, 145,
+    143, 890, 2233, 348, 1805, 791, 643, 2397, 2412, 2413, 2425, 1524,
+    1043, 1078, 1042, 1049, 1033, 1080, 1084, 1082, 1047, 2411, 2430, 1039,
+    296, 314, 632, 343, 891, 2239, 1485, 1486, 1487, 914, 2314, 1306,
+    1372, 1186, 1893, 1894, 556, 539, 270, 1330, 1273, 1208, 569, 2222,
+    526, 865, 265, 1154, 1512, 486, 2315, 288, 1103, 1052, 1268, 1254,
+    2316, 751, 1817, 2317, 2226, 177, 1253, 221, 5, 474, 93, 1222,
+    755, 747, 737, 768, 2223, 2318, 645, 644, 1488, 2179, 872, 1369,
+    682, 1367, 1368, 587, 930, 1075, 966, 1130, 2180, 813, 1227, 932,
+    434, 341, 369, 370, 92, 2319, 749, 1366, 1434, 2320, 426, 387,
+    1282, 1301, 1840, 2181, 2182, 1878, 610, 925, 912, 2321, 1813, 1090,
+    1520, 35, 1284, 1307, 657, 649, 2216, 842, 13, 506, 1125, 1129,
+    2322, 2183, 873, 931, 1036, 1037, 621, 1121, 1122, 231, 1237, 405,
+    1238, 2323, 1153, 1124, 1877, 612, 2184, 933, 24, 869, 1138, 1370,
+    2324, 2185, 2186, 580, 1413, 1314, 1331, 234, 568, 1200, 2187, 1142,
+    532, 867, 516, 509, 517, 512, 1245, 321, 1841, 233, 1206, 1550,
+    2325, 2326, 2327, 1003, 1441, 947, 946, 449, 642, 161, 25, 923,
+    1904, 1685, 1684, 1689, 1688, 1687, 1686, 1913, 2003, 1705, 1739, 1773,
+    2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 1914, 2013, 1706,
+    1740, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 1915, 2023,
+    1707, 1741, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 1916,
+    2033, 1708, 1742, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042,
+    1917, 2043, 1709, 1743, 2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051,
+    2052, 1918, 2053, 1710, 1744, 2054, 2055, 2056, 2057, 2058, 2059, 2060,
+    2061, 2062, 1919, 2063, 1711, 1745, 2064, 2065, 2066, 2067, 2068, 2069,
+    2070, 2071, 2072, 1920, 2073, 1712, 1746, 2074, 2075, 2076, 2077, 2078,
+    2079, 2080, 2081, 2082, 1921, 2083, 1713, 1747, 2084, 2085, 2086, 2087,
+    2088, 2089, 2090, 2091, 2092, 1922, 2093, 1714, 1748, 2094, 2095, 2096,
+    2097, 2098, 2099, 2100, 2101, 2102, 1905, 1923, 2103, 1715, 1749, 2104,
+    2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 1924, 2113, 1716, 1750,
+    2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 1925, 2123, 1717,
+    1751, 2124, 2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 1926, 2133,
+    1718, 1752, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 1927,
+    2231, 2143, 1719, 1753, 2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151,
+    2152, 1928, 2153, 1720, 1754, 2154, 2155, 2156, 2157, 2158, 1929, 1721,
+    1755, 1930, 2436, 2435, 1722, 1756, 1931, 1723, 1757, 1932, 1724, 1758,
+    1906, 1690, 1933, 1691, 1725, 1759, 1934, 1935, 1936, 1937, 1938, 1692,
+    1726, 1760, 1939, 1940, 1941, 1942, 1907, 1943, 1693, 1727, 1761, 1944,
+    1945, 1946, 1947, 1948, 1694, 1728, 1762, 1949, 1950, 1951, 1952, 1908,
+    1953, 1695, 1729, 1763, 1954, 1955, 1956, 1957, 1958, 1696, 1730, 1764,
+    1959, 1960, 1961, 1962, 1909, 1963, 1697, 1731, 1765, 1964, 1965, 1966,
+    1967, 1968, 1698, 1732, 1766, 1969, 1970, 1971, 1972, 1910, 1973, 1699,
+    1733, 1767, 1974, 1975, 1976, 1977, 1978, 1700, 1734, 1768, 1979, 1980,
+    1981, 1982, 1911, 1983, 1701, 1735, 1769, 1984, 1985, 1986, 1987, 1988,
+    1702, 1736, 1770, 1989, 1990, 1991, 1992, 1912, 1993, 1703, 1737, 1771,
+    1994, 1995, 1996, 1997, 1998, 1704, 1738, 1772, 1999, 2000, 2001, 2002,
+    2253, 2261, 2273, 2277, 1884, 2284, 2292, 1173, 2302, 2305, 2307, 2313,
+    1169, 2331, 2334, 2351, 1174, 2360, 2362, 1168, 1172, 2370, 2372, 1170,
+    2373, 2375, 2383, 1171, 1774, 99, 1873, 1786, 1798, 1123, 855, 965,
+    964, 958, 960, 961, 1005, 2188, 2328, 2189, 2190, 2191, 2192, 2193,
+    113, 114, 2399, 193, 192, 909, 904, 1093, 290, 496, 293, 826,
+    1882, 466, 490, 463, 824, 19, 825, 1101, 292, 289, 286, 1247,
+    1371, 1358, 457, 130, 209, 133, 995, 2194, 2195, 991, 999, 2196,
+    1000, 199, 1357, 277, 276, 497, 26, 136, 137, 1489, 806, 822,
+    823, 835, 174, 135, 1362, 2197, 647, 59, 2198, 854, 898, 943,
+    1365, 934, 1364, 1022, 957, 940, 1363, 937, 987, 986, 948, 1006,
+    924, 1901, 913, 464, 799, 87, 86, 210, 98, 888, 2329, 2199,
+    1285, 2401, 1320, 963, 1177, 1148, 85, 896, 1361, 444, 2330, 1015,
+    1417, 962, 165, 1418, 507, 184, 122, 121, 123, 1427, 1443, 225,
+    257, 475, 1068, 65, 64, 63, 62, 226, 525, 1134, 661, 662,
+    451, 469, 2332, 1189, 1009, 480, 1788, 1399, 477, 458, 470, 468,
+    467, 2333, 868, 510, 511, 810, 786, 636, 635, 2335, 1490, 1491,
+    1492, 1494, 1195, 1493, 1495, 1062, 578, 2336, 678, 153, 687, 685,
+    95, 1536, 1538, 1535, 1539, 1537, 1262, 2200, 140, 1158, 443, 306,
+    308, 310, 307, 381, 382, 384, 1162, 840, 756, 982, 2228, 2337,
+    746, 2338, 1165, 1164, 2339, 974, 1823, 2340, 663, 2341, 1806, 499,
+    740, 748, 743, 500, 599, 601, 600, 608, 2342, 2227, 154, 1149,
+    666, 261, 2343, 560, 770, 796, 450, 1277, 1278, 1319, 880, 452,
+    1572, 1576, 1578, 1579, 1577, 1574, 1575, 1573, 1580, 1584, 1586, 1587,
+    1585, 1582, 1583, 1581, 1588, 1604, 1608, 1610, 1611, 1609, 1606, 1607,
+    1605, 1612, 1616, 1618, 1619, 1617, 1614, 1615, 1613, 1592, 1594, 1595,
+    1593, 1590, 1591, 1589, 1596, 1600, 1602, 1603, 1601, 1598, 1599, 1597,
+    1620, 1636, 1640, 1642, 1643, 1641, 1638, 1639, 1637, 1644, 1648, 1650,
+    1651, 1649, 1646, 1647, 1645, 1652, 1668, 1672, 1674, 1675, 1673, 1670,
+    1671, 1669, 1676, 1680, 1682, 1683, 1681, 1678, 1679, 1677, 1656, 1658,
+    1659, 1657, 1654, 1655, 1653, 1660, 1664, 1666, 1667, 1665, 1662, 1663,
+    1661, 1624, 1626, 1627, 1625, 1622, 1623, 1621, 1628, 1632, 1634, 1635,
+    1633, 1630, 1631, 1629, 1556, 1560, 1562, 1563, 1561, 1558, 1559, 1557,
+    1564, 1568, 1570, 1571, 1569, 1566, 1567, 1565, 213, 1552, 388, 393,
+    2201, 831, 808, 1289, 425, 2344, 366, 365, 1182, 362, 1517, 1420,
+    259, 281, 555, 547, 548, 2345, 1414, 251, 252, 283, 320, 2346,
+    2224, 2347, 1185, 367, 1353, 212, 1246, 2240, 1532, 1531, 834, 1875,
+    81, 83, 82, 232, 1332, 1255, 1553, 197, 1862, 630, 88, 745,
+    877, 37, 331, 739, 1308, 1270, 744, 1004, 342, 1251, 1163, 330,
+    2348, 983, 2215, 282, 311, 322, 1333, 1505, 1360, 2453, 2452, 2451,
+    2450, 1076, 2202, 769, 2349, 2396, 2417, 2418, 2424, 1526, 1041, 1077,
+    1040, 1048, 1034, 1079, 1496, 1083, 1081, 1046, 2416, 2429, 1038, 1504,
+    389, 862, 863, 861, 729, 2350, 1790, 91, 132, 1348, 129, 102,
+    103, 422, 97, 152, 648, 1334, 309, 127, 131, 134, 1335, 1029,
+    1548, 374, 1821, 1824, 163, 428, 1347, 680, 675, 2352, 186, 2353,
+    1843, 2354, 2355, 1243, 1395, 1844, 1336, 676, 1442, 1337, 592, 329,
+    1787, 1861, 2241, 1217, 484, 1838, 1514, 1511, 36, 1137, 396, 752,
+    397, 407, 126, 22, 349, 894, 187, 190, 1065, 984, 188, 189,
+    1549, 597, 535, 158, 728, 2448, 815, 1439, 2356, 376, 2357, 176,
+    476, 892, 1023, 846, 1091, 440, 2234, 558, 1190, 406, 1026, 1896,
+    1898, 1895, 1897, 1089, 142, 264, 1375, 1378, 1377, 1425, 272, 1376,
+    812, 1400, 1401, 101, 754, 431, 928, 1853, 686, 2358, 1857, 1818,
+    1450, 546, 641, 1064, 229, 237, 2, 222, 843, 658, 598, 585,
+    1807, 538, 1346, 692, 690, 691, 684, 671, 588, 660, 1436, 1109,
+    540, 698, 699, 694, 695, 160, 1858, 1338, 236, 1859, 417, 1045,
+    1440, 893, 724, 996, 2203, 2204, 993, 1001, 1002, 465, 459, 489,
+    1397, 761, 760, 11, 750, 285, 485, 1825, 54, 60, 433, 409,
+    586, 2359, 1794, 2361, 1115, 1116, 2236, 40, 394, 482, 2426, 1777,
+    487, 1793, 438, 1266, 973, 841, 864, 1339, 1349, 1867, 1, 797,
+    798, 0, 481, 139, 120, 566, 2363, 2364, 2365, 1187, 392, 1447,
+    575, 567, 574, 67, 693, 151, 1184, 378, 2366, 513, 1345, 1304,
+    1283, 637, 1846, 1351, 602, 1340, 1847, 1424, 1410, 200, 202, 203,
+    201, 1888, 1887, 1390, 1892, 1296, 1290, 1193, 395, 263, 1518, 1398,
+    1396, 611, 631, 1903, 115, 1416, 116, 253, 254, 2205, 420, 1809,
+    857, 2367, 400, 495, 784, 2206, 725, 1497, 1498, 1426, 2395, 2394,
+    2446, 2445, 2440, 2439, 1012, 1032, 1249, 2368, 552, 551, 345, 1159,
+    1503, 1010, 809, 1869, 926, 985, 1053, 1055, 1150, 1156, 561, 411,
+    483, 364, 363, 61, 2369, 1432, 412, 1341, 227, 1088, 1295, 448,
+    1248, 742, 4, 1008, 338, 6, 20, 1408, 408, 17, 16, 8,
+    757, 1406, 7, 249, 250, 9, 287, 18, 255, 267, 256, 280,
+    767, 2371, 1819, 1832, 1829, 1830, 1831, 1810, 1814, 1540, 881, 1179,
+    1276, 1506, 1178, 503, 12, 640, 166, 1181, 564, 753, 305, 1060,
+    1288, 284, 2434, 2433, 1112, 68, 1214, 1104, 344, 1071, 1421, 260,
+    794, 792, 795, 916, 2374, 2444, 2443, 2438, 2437, 1317, 1318, 917,
+    520, 522, 521, 519, 523, 323, 1014, 1070, 679, 2376, 1502, 1352,
+    1449, 1342, 383, 876, 875, 1074, 967, 1309, 1776, 882, 788, 789,
+    805, 803, 819, 802, 787, 758, 471, 804, 818, 827, 801, 2207,
+    1373, 167, 128, 439, 2377, 488, 897, 244, 246, 245, 228, 1409,
+    1196, 49, 48, 47, 211, 50, 1232, 1219, 1229, 1244, 1230, 1231,
+    1218, 1212, 1233, 2208, 182, 626, 704, 194, 178, 2378, 2379, 1815,
+    2380, 2381, 2210, 2209, 603, 606, 582, 1252, 2382, 346, 1848, 918,
+    832, 1500, 1499, 1501, 1203, 2384, 620, 619, 731, 773, 1863, 172,
+    171, 2211, 730, 774, 721, 722, 723, 109, 1845, 429, 2385, 726,
+    727, 404, 870, 534, 1175, 1135, 1141, 1789, 316, 1522, 2386, 998,
+    2212, 994, 656, 639, 664, 929, 919, 922, 1343, 583, 710, 707,
+    715, 712, 711, 714, 713, 709, 220, 1221, 1874, 262, 294, 312,
+    351, 628, 1851, 2455, 2454, 573, 700, 688, 689, 235, 1860, 430,
+    541, 2213, 2217, 1429, 96, 111, 112, 1355, 1356, 1354, 421, 1883,
+    2214, 1890, 1889, 1530, 1529, 1868, 716, 1872,
+};
+
+#endif // LIBSM_ITIS_TABLE_H
@@ -0,0 +1,820 @@
+/**
+ * @brief MapData lane compiler and map matching
+ */
+
+#include "libsm-map.h"
+#include "ComputedLane.h"
+#include "Connection.h"
+#include "ConnectsToList.h"
+#include "GenericLane.h"
+#include "IntersectionGeometry.h"
+#include "IntersectionGeometryList.h"
+#include "Node-LLmD-64b.h"
+#include "Node-XY-20b.h"
+#include "Node-XY-22b.h"
+#include "Node-XY-24b.h"
+#include "Node-XY-26b.h"
+#include "Node-XY-28b.h"
+#include "Node-XY-32b.h"
+#include "NodeAttributeSetXY.h"
+#include "NodeSetXY.h"
+#include "NodeXY.h"
+#include "j2735-defines.h"
+#include "libsm.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#define MAP_HEADING_UNIT       0.0125 // degrees per Heading_t and Angle_t unit
+#define MAP_SCALE_UNIT         0.0005 // Scale-B12 is in 0.05 %
+#define MAP_HEADING_TOLERANCE  60.0   // degrees between the travel and lane direction
+
+
+struct libsm_map_cache_entry {
+    bool inUse;
+    libsm_map_key_t key;
+    uint64_t lastUsed;
+    libsm_map_t map;
+};
+
+// growing arrays while compiling
+typedef struct {
+    libsm_map_lane_t* lanes;
+    size_t laneCap;
+    libsm_map_point_t* points;
+    size_t pointCap;
+    libsm_map_connection_t* connections;
+    size_t connectionCap;
+} map_builder_t;
+
+
+void libsm_map_default_config(libsm_map_config_t* config)
+{
+    if (config == NULL) {
+        return;
+    }
+    config->cellSizeM = 10.0;
+    config->matchDistanceM = 5.0;
+    config->defaultWidthM = 3.6;
+    config->maxCells = 1 << 20;
+}
+
+
+static bool map_reserve(void** array, size_t* cap, size_t need, size_t elemSize)
+{
+    if (need <= *cap) {
+        return true;
+    }
+    size_t newCap = *cap ? *cap : 16;
+    while (newCap < need) {
+        newCap *= 2;
+    }
+    void* grown = realloc(*array, newCap * elemSize);
+    if (grown == NULL) {
+        return false;
+    }
+    *array = grown;
+    *cap = newCap;
+    return true;
+}
+
+
+// named bits of a BIT STRING, bit n of the result is named bit n
+static uint16_t map_bits(BIT_STRING_t const* bits)
+{
+    uint16_t result = 0;
+    if (bits == NULL || bits->buf == NULL) {
+        return 0;
+    }
+    size_t const count = bits->size * 8 - (size_t)bits->bits_unused;
+    for (size_t n = 0; n < count && n < 16; n++) {
+        if (bits->buf[n / 8] & (0x80 >> (n % 8))) {
+            result |= (uint16_t)(1u << n);
+        }
+    }
+    return result;
+}
+
+
+static uint32_t map_intersection_key(IntersectionReferenceID_t const* id)
+{
+    uint32_t const region = id->region ? (uint32_t)(*id->region & 0xFFFF) : 0;
+    return region << 16 | (uint32_t)(id->id & 0xFFFF);
+}
+
+
+// offset of a node from the previous one in meters, false for node kinds without one
+static bool map_node_delta(NodeOffsetPointXY_t const* delta, double* x, double* y)
+{
+    long dx;
+    long dy;
+    switch (delta->present) {
+        case NodeOffsetPointXY_PR_node_XY1:
+            dx = delta->choice.node_XY1->x;
+            dy = delta->choice.node_XY1->y;
+            break;
+        case NodeOffsetPointXY_PR_node_XY2:
+            dx = delta->choice.node_XY2->x;
+            dy = delta->choice.node_XY2->y;
+            break;
+        case NodeOffsetPointXY_PR_node_XY3:
+            dx = delta->choice.node_XY3->x;
+            dy = delta->choice.node_XY3->y;
+            break;
+        case NodeOffsetPointXY_PR_node_XY4:
+            dx = delta->choice.node_XY4->x;
+            dy = delta->choice.node_XY4->y;
+            break;
+        case NodeOffsetPointXY_PR_node_XY5:
+            dx = delta->choice.node_XY5->x;
+            dy = delta->choice.node_XY5->y;
+            break;
+        case NodeOffsetPointXY_PR_node_XY6:
+            dx = delta->choice.node_XY6->x;
+            dy = delta->choice.node_XY6->y;
+            break;
+        default:
+            return false;
+    }
+    *x = (double)dx / 100.0;
+    *y = (double)dy / 100.0;
+    return true;
+}
+
+
+// fill in lat/Long of a point from its east/north
+static void map_point_position(libsm_map_t const* map, libsm_map_point_t* point)
+{
+    point->lat = map->originLat + lround(point->north / map->metersPerLat);
+    point->Long = map->originLong + lround(point->east / map->metersPerLong);
+}
+
+
+static bool map_add_point(libsm_map_t* map,
+                          map_builder_t* builder,
+                          double east,
+                          double north,
+                          double widthM)
+{
+    if (!map_reserve((void**)&builder->points,
+                     &builder->pointCap,
+                     map->pointCount + 1,
+                     sizeof(libsm_map_point_t))) {
+        return false;
+    }
+    libsm_map_point_t* point = &builder->points[map->pointCount++];
+    *point = (libsm_map_point_t){ .east = east, .north = north, .widthM = widthM };
+    map_point_position(map, point);
+    return true;
+}
+
+
+// points of a lane given by nodes, false only on allocation errors
+static bool map_add_nodes(libsm_map_t* map,
+                          map_builder_t* builder,
+                          NodeSetXY_t const* nodes,
+                          double refEast,
+                          double refNorth,
+                          double widthM)
+{
+    double east = refEast;
+    double north = refNorth;
+    for (int n = 0; n < nodes->list.count; n++) {
+        NodeXY_t const* node = nodes->list.array[n];
+        double dx;
+        double dy;
+        if (node == NULL) {
+            continue;
+        }
+        if (map_node_delta(&node->delta, &dx, &dy)) {
+            east += dx;
+            north += dy;
+        } else if (node->delta.present == NodeOffsetPointXY_PR_node_LatLon
+                   && node->delta.choice.node_LatLon != NULL) {
+            Node_LLmD_64b_t const* ll = node->delta.choice.node_LatLon;
+            east = (double)(ll->lon - map->originLong) * map->metersPerLong;
+            north = (double)(ll->lat - map->originLat) * map->metersPerLat;
+        } else {
+            continue;
+        }
+        if (node->attributes != NULL && node->attributes->dWidth != NULL) {
+            widthM += (double)*node->attributes->dWidth / 100.0;
+        }
+        if (!map_add_point(map, builder, east, north, widthM)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+static double map_offset(long present, long small, long large)
+{
+    if (present == ComputedLane__offsetXaxis_PR_small) {
+        return (double)small / 100.0;
+    }
+    if (present == ComputedLane__offsetXaxis_PR_large) {
+        return (double)large / 100.0;
+    }
+    return 0.0;
+}
+
+
+// points of a computed lane: the reference lane scaled and rotated around its
+// first node, then moved by the offset
+static bool map_add_computed(libsm_map_t* map,
+                             map_builder_t* builder,
+                             ComputedLane_t const* computed,
+                             libsm_map_lane_t const* reference)
+{
+    double const dx = map_offset(computed->offsetXaxis.present,
+                                 computed->offsetXaxis.choice.small,
+                                 computed->offsetXaxis.choice.large);
+    double const dy = map_offset(computed->offsetYaxis.present,
+                                 computed->offsetYaxis.choice.small,
+                                 computed->offsetYaxis.choice.large);
+    double const scaleX = computed->scaleXaxis ? 1.0 + *computed->scaleXaxis * MAP_SCALE_UNIT : 1.0;
+    double const scaleY = computed->scaleYaxis ? 1.0 + *computed->scaleYaxis * MAP_SCALE_UNIT : 1.0;
+    double const angle =
+            computed->rotateXY ? *computed->rotateXY * MAP_HEADING_UNIT * (M_PI / 180.0) : 0.0;
+    double const c = cos(angle);
+    double const s = sin(angle);
+    uint32_t const first = reference->firstPoint;
+
+    for (uint32_t i = 0; i < reference->pointCount; i++) {
+        // builder->points may move while adding, so copy out first
+        libsm_map_point_t const ref = builder->points[first + i];
+        libsm_map_point_t const origin = builder->points[first];
+        double const x = (ref.east - origin.east) * scaleX;
+        double const y = (ref.north - origin.north) * scaleY;
+        // clockwise, like every other J2735 angle
+        double const east = origin.east + x * c + y * s + dx;
+        double const north = origin.north - x * s + y * c + dy;
+        if (!map_add_point(map, builder, east, north, ref.widthM)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+static bool map_add_connections(libsm_map_t* map,
+                                map_builder_t* builder,
+                                ConnectsToList_t const* connectsTo)
+{
+    if (connectsTo == NULL) {
+        return true;
+    }
+    if (!map_reserve((void**)&builder->connections,
+                     &builder->connectionCap,
+                     map->connectionCount + (size_t)connectsTo->list.count,
+                     sizeof(libsm_map_connection_t))) {
+        return false;
+    }
+    for (int c = 0; c < connectsTo->list.count; c++) {
+        Connection_t const* connection = connectsTo->list.array[c];
+        if (connection == NULL) {
+            continue;
+        }
+        builder->connections[map->connectionCount++] = (libsm_map_connection_t){
+            .laneId = (uint8_t)connection->connectingLane.lane,
+            .remoteIntersection = connection->remoteIntersection
+                                          ? map_intersection_key(connection->remoteIntersection)
+                                          : LIBSM_MAP_NO_REMOTE,
+            .signalGroup = connection->signalGroup ? (int32_t)*connection->signalGroup
+                                                   : LIBSM_MAP_NO_SIGNAL_GROUP,
+            .maneuvers = map_bits(connection->connectingLane.maneuver),
+        };
+    }
+    return true;
+}
+
+
+static libsm_map_lane_t const* map_find_reference(libsm_map_t const* map,
+                                                  map_builder_t const* builder,
+                                                  size_t firstLane,
+                                                  LaneID_t laneId)
+{
+    for (size_t l = firstLane; l < map->laneCount; l++) {
+        if (builder->lanes[l].laneId == laneId && !builder->lanes[l].computed) {
+            return &builder->lanes[l];
+        }
+    }
+    return NULL;
+}
+
+
+// one lane, computed lanes only on the second pass
+static bool map_add_lane(libsm_map_t* map,
+                         map_builder_t* builder,
+                         GenericLane_t const* lane,
+                         uint32_t intersection,
+                         size_t firstLane,
+                         double refEast,
+                         double refNorth,
+                         double widthM)
+{
+    bool const computed = lane->nodeList.present == NodeListXY_PR_computed;
+    uint32_t const firstPoint = (uint32_t)map->pointCount;
+    uint32_t const firstConnection = (uint32_t)map->connectionCount;
+    bool ok;
+
+    if (computed) {
+        ComputedLane_t const* spec = lane->nodeList.choice.computed;
+        libsm_map_lane_t const* reference =
+                spec ? map_find_reference(map, builder, firstLane, spec->referenceLaneId) : NULL;
+        if (reference == NULL) {
+            map->skippedLanes++;
+            return true;
+        }
+        ok = map_add_computed(map, builder, spec, reference);
+    } else if (lane->nodeList.present == NodeListXY_PR_nodes && lane->nodeList.choice.nodes) {
+        ok = map_add_nodes(map, builder, lane->nodeList.choice.nodes, refEast, refNorth, widthM);
+    } else {
+        map->skippedLanes++;
+        return true;
+    }
+    if (!ok) {
+        return false;
+    }
+    if (map->pointCount - firstPoint < 2) {
+        map->pointCount = firstPoint;
+        map->skippedLanes++;
+        return true;
+    }
+    if (!map_add_connections(map, builder, lane->connectsTo)
+        || !map_reserve((void**)&builder->lanes,
+                        &builder->laneCap,
+                        map->laneCount + 1,
+                        sizeof(libsm_map_lane_t))) {
+        return false;
+    }
+
+    uint16_t const direction = map_bits(&lane->laneAttributes.directionalUse);
+    libsm_map_lane_t* out = &builder->lanes[map->laneCount++];
+    *out = (libsm_map_lane_t){
+        .intersection = intersection,
+        .laneId = (uint8_t)lane->laneID,
+        .ingressApproach = lane->ingressApproach ? (uint8_t)*lane->ingressApproach : 0,
+        .egressApproach = lane->egressApproach ? (uint8_t)*lane->egressApproach : 0,
+        .direction = (uint8_t)((direction & 0x01 ? LIBSM_MAP_INGRESS : 0)
+                               | (direction & 0x02 ? LIBSM_MAP_EGRESS : 0)),
+        .laneType = (int)lane->laneAttributes.laneType.present,
+        .maneuvers = map_bits(lane->maneuvers),
+        .computed = computed,
+        .firstPoint = firstPoint,
+        .pointCount = (uint32_t)map->pointCount - firstPoint,
+        .firstConnection = firstConnection,
+        .connectionCount = (uint32_t)map->connectionCount - firstConnection,
+    };
+
+    double along = 0.0;
+    builder->points[firstPoint].alongM = 0.0;
+    for (uint32_t p = firstPoint + 1; p < map->pointCount; p++) {
+        along += hypot(builder->points[p].east - builder->points[p - 1].east,
+                       builder->points[p].north - builder->points[p - 1].north);
+        builder->points[p].alongM = along;
+    }
+    out->lengthM = along;
+    return true;
+}
+
+
+static bool map_add_intersection(libsm_map_t* map,
+                                 map_builder_t* builder,
+                                 IntersectionGeometry_t const* geometry)
+{
+    uint32_t const key = map_intersection_key(&geometry->id);
+    double const refEast = (double)(geometry->refPoint.Long - map->originLong) * map->metersPerLong;
+    double const refNorth = (double)(geometry->refPoint.lat - map->originLat) * map->metersPerLat;
+    double const widthM = geometry->laneWidth ? (double)*geometry->laneWidth / 100.0
+                                              : map->config.defaultWidthM;
+    size_t const firstLane = map->laneCount;
+
+    // lanes with nodes first, so computed lanes always find their reference
+    for (int pass = 0; pass < 2; pass++) {
+        for (int l = 0; l < geometry->laneSet.list.count; l++) {
+            GenericLane_t const* lane = geometry->laneSet.list.array[l];
+            if (lane == NULL
+                || (lane->nodeList.present == NodeListXY_PR_computed) != (pass == 1)) {
+                continue;
+            }
+            if (!map_add_lane(map, builder, lane, key, firstLane, refEast, refNorth, widthM)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+
+static void map_cell_range(libsm_map_t const* map,
+                           double lo,
+                           double hi,
+                           double min,
+                           uint32_t cells,
+                           uint32_t* first,
+                           uint32_t* last)
+{
+    double const a = floor((lo - min) / map->cellSizeM);
+    double const b = floor((hi - min) / map->cellSizeM);
+    *first = a < 0 ? 0 : (a >= cells ? cells - 1 : (uint32_t)a);
+    *last = b < 0 ? 0 : (b >= cells ? cells - 1 : (uint32_t)b);
+}
+
+
+// grid of segments, every segment is in every cell within matchDistanceM of it
+static bool map_build_grid(libsm_map_t* map)
+{
+    double const margin = map->config.matchDistanceM;
+    double minEast = INFINITY;
+    double minNorth = INFINITY;
+    double maxEast = -INFINITY;
+    double maxNorth = -INFINITY;
+
+    for (size_t p = 0; p < map->pointCount; p++) {
+        minEast = fmin(minEast, map->points[p].east);
+        minNorth = fmin(minNorth, map->points[p].north);
+        maxEast = fmax(maxEast, map->points[p].east);
+        maxNorth = fmax(maxNorth, map->points[p].north);
+    }
+    if (map->pointCount == 0) {
+        minEast = minNorth = maxEast = maxNorth = 0.0;
+    }
+    map->minEast = minEast - margin;
+    map->minNorth = minNorth - margin;
+    map->cellSizeM = map->config.cellSizeM;
+    for (;;) {
+        double const x = floor((maxEast + margin - map->minEast) / map->cellSizeM) + 1;
+        double const y = floor((maxNorth + margin - map->minNorth) / map->cellSizeM) + 1;
+        if (x * y <= (double)map->config.maxCells) {
+            map->cellsX = (uint32_t)x;
+            map->cellsY = (uint32_t)y;
+            break;
+        }
+        map->cellSizeM *= 2;
+    }
+
+    size_t const cellCount = (size_t)map->cellsX * map->cellsY;
+    map->cellStart = calloc(cellCount + 1, sizeof(uint32_t));
+    map->pointLane = malloc((map->pointCount ? map->pointCount : 1) * sizeof(uint32_t));
+    if (map->cellStart == NULL || map->pointLane == NULL) {
+        return false;
+    }
+
+    // count, then fill in the same order
+    for (int fill = 0; fill < 2; fill++) {
+        for (size_t l = 0; l < map->laneCount; l++) {
+            libsm_map_lane_t const* lane = &map->lanes[l];
+            for (uint32_t p = lane->firstPoint; p + 1 < lane->firstPoint + lane->pointCount; p++) {
+                libsm_map_point_t const* a = &map->points[p];
+                libsm_map_point_t const* b = &map->points[p + 1];
+                uint32_t x0, x1, y0, y1;
+                map_cell_range(map,
+                               fmin(a->east, b->east) - margin,
+                               fmax(a->east, b->east) + margin,
+                               map->minEast,
+                               map->cellsX,
+                               &x0,
+                               &x1);
+                map_cell_range(map,
+                               fmin(a->north, b->north) - margin,
+                               fmax(a->north, b->north) + margin,
+                               map->minNorth,
+                               map->cellsY,
+                               &y0,
+                               &y1);
+                for (uint32_t y = y0; y <= y1; y++) {
+                    for (uint32_t x = x0; x <= x1; x++) {
+                        size_t const cell = (size_t)y * map->cellsX + x;
+                        if (fill) {
+                            map->cellSegments[map->cellStart[cell + 1]++] = p;
+                        } else {
+                            map->cellStart[cell + 1]++;
+                        }
+                    }
+                }
+            }
+            if (fill) {
+                for (uint32_t p = 0; p < lane->pointCount; p++) {
+                    map->pointLane[lane->firstPoint + p] = (uint32_t)l;
+                }
+            }
+        }
+        if (!fill) {
+            // prefix sums, cellStart[c + 1] then counts up from cellStart[c] while filling
+            for (size_t c = 0; c < cellCount; c++) {
+                map->cellStart[c + 1] += map->cellStart[c];
+            }
+            size_t const total = map->cellStart[cellCount];
+            map->cellSegments = malloc((total ? total : 1) * sizeof(uint32_t));
+            if (map->cellSegments == NULL) {
+                return false;
+            }
+            memmove(&map->cellStart[1], &map->cellStart[0], cellCount * sizeof(uint32_t));
+            map->cellStart[0] = 0;
+        }
+    }
+    return true;
+}
+
+
+libsm_rval_e libsm_map_compile(MapData_t const* mapData,
+                               libsm_map_config_t const* config,
+                               libsm_map_t* map)
+{
+    if (mapData == NULL || map == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    *map = (libsm_map_t){ 0 };
+    if (config != NULL) {
+        map->config = *config;
+    } else {
+        libsm_map_default_config(&map->config);
+    }
+    if (!(map->config.cellSizeM > 0) || !(map->config.matchDistanceM > 0)
+        || !(map->config.defaultWidthM > 0) || map->config.maxCells == 0) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    IntersectionGeometryList_t const* intersections = mapData->intersections;
+    if (intersections == NULL || intersections->list.count == 0
+        || intersections->list.array[0] == NULL) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+
+    IntersectionGeometry_t const* first = intersections->list.array[0];
+    map->msgIssueRevision = (uint8_t)mapData->msgIssueRevision;
+    map->originLat = first->refPoint.lat;
+    map->originLong = first->refPoint.Long;
+    map->metersPerLat = Latitude_m_per_unit;
+    map->metersPerLong = Latitude_m_per_unit
+                         * cos((double)first->refPoint.lat / Latitude_unit_deg * (M_PI / 180.0));
+
+    map_builder_t builder = { 0 };
+    bool ok = true;
+    for (int i = 0; ok && i < intersections->list.count; i++) {
+        if (intersections->list.array[i] != NULL) {
+            ok = map_add_intersection(map, &builder, intersections->list.array[i]);
+        }
+    }
+    map->lanes = builder.lanes;
+    map->points = builder.points;
+    map->connections = builder.connections;
+    if (!ok || !map_build_grid(map)) {
+        libsm_map_free(map);
+        return LIBSM_ALLOC_ERR;
+    }
+    return LIBSM_OK;
+}
+
+
+void libsm_map_free(libsm_map_t* map)
+{
+    if (map == NULL) {
+        return;
+    }
+    free(map->lanes);
+    free(map->points);
+    free(map->connections);
+    free(map->cellStart);
+    free(map->cellSegments);
+    free(map->pointLane);
+    *map = (libsm_map_t){ 0 };
+}
+
+
+static double map_angle_diff(double a, double b)
+{
+    double d = fmod(fabs(a - b), 360.0);
+    return d > 180.0 ? 360.0 - d : d;
+}
+
+
+libsm_rval_e libsm_map_match(libsm_map_t const* map,
+                             Latitude_t lat,
+                             Longitude_t Long,
+                             Heading_t heading,
+                             libsm_map_match_t* match)
+{
+    if (map == NULL || match == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    *match = (libsm_map_match_t){ 0 };
+    if (map->cellStart == NULL) {
+        return LIBSM_OK;
+    }
+
+    double const east = (double)(Long - map->originLong) * map->metersPerLong;
+    double const north = (double)(lat - map->originLat) * map->metersPerLat;
+    double const cx = floor((east - map->minEast) / map->cellSizeM);
+    double const cy = floor((north - map->minNorth) / map->cellSizeM);
+    if (cx < 0 || cy < 0 || cx >= map->cellsX || cy >= map->cellsY) {
+        return LIBSM_OK;
+    }
+    bool const useHeading = heading >= 0 && heading < Heading_unavailable;
+    double const travel = (double)heading * MAP_HEADING_UNIT;
+    size_t const cell = (size_t)cy * map->cellsX + (size_t)cx;
+    double best = map->config.matchDistanceM;
+    double bestT = 0.0;
+    uint32_t bestSegment = 0;
+
+    for (uint32_t i = map->cellStart[cell]; i < map->cellStart[cell + 1]; i++) {
+        uint32_t const p = map->cellSegments[i];
+        libsm_map_point_t const* a = &map->points[p];
+        libsm_map_point_t const* b = &map->points[p + 1];
+        double const sx = b->east - a->east;
+        double const sy = b->north - a->north;
+        double const len2 = sx * sx + sy * sy;
+        double t = len2 > 0 ? ((east - a->east) * sx + (north - a->north) * sy) / len2 : 0.0;
+        t = t < 0 ? 0 : (t > 1 ? 1 : t);
+        double const d = hypot(east - (a->east + t * sx), north - (a->north + t * sy));
+        if (d > best || (match->matched && d == best)) {
+            continue;
+        }
+        if (useHeading && len2 > 0) {
+            // lanes are described from the stop line outwards, ingress traffic drives against
+            // the node order
+            uint8_t const direction = map->lanes[map->pointLane[p]].direction;
+            double const along = atan2(sx, sy) * (180.0 / M_PI);
+            bool const egress = map_angle_diff(travel, along) <= MAP_HEADING_TOLERANCE;
+            bool const ingress = map_angle_diff(travel, along + 180.0) <= MAP_HEADING_TOLERANCE;
+            if (direction != 0 && !((direction & LIBSM_MAP_EGRESS) && egress)
+                && !((direction & LIBSM_MAP_INGRESS) && ingress)) {
+                continue;
+            }
+        }
+        best = d;
+        bestT = t;
+        bestSegment = p;
+        match->matched = true;
+    }
+
+    if (match->matched) {
+        libsm_map_point_t const* a = &map->points[bestSegment];
+        libsm_map_point_t const* b = &map->points[bestSegment + 1];
+        libsm_map_lane_t const* lane = &map->lanes[map->pointLane[bestSegment]];
+        match->lane = map->pointLane[bestSegment];
+        match->intersection = lane->intersection;
+        match->laneId = lane->laneId;
+        match->distanceM = best;
+        match->alongM = a->alongM + bestT * (b->alongM - a->alongM);
+        match->inside = best <= 0.5 * (a->widthM + bestT * (b->widthM - a->widthM));
+    }
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_map_match_batch(libsm_map_t const* map,
+                                   Latitude_t const* lats,
+                                   Longitude_t const* longs,
+                                   Heading_t const* headings,
+                                   size_t count,
+                                   libsm_map_match_t* matches)
+{
+    if (map == NULL || (count > 0 && (lats == NULL || longs == NULL || matches == NULL))) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    for (size_t i = 0; i < count; i++) {
+        libsm_map_match(map,
+                        lats[i],
+                        longs[i],
+                        headings ? headings[i] : Heading_unavailable,
+                        &matches[i]);
+    }
+    return LIBSM_OK;
+}
+
+
+libsm_map_lane_t const* libsm_map_find_lane(libsm_map_t const* map,
+                                            uint32_t intersection,
+                                            uint8_t laneId)
+{
+    if (map == NULL) {
+        return NULL;
+    }
+    for (size_t l = 0; l < map->laneCount; l++) {
+        if (map->lanes[l].intersection == intersection && map->lanes[l].laneId == laneId) {
+            return &map->lanes[l];
+        }
+    }
+    return NULL;
+}
+
+
+bool libsm_map_key(MapData_t const* mapData, libsm_map_key_t* key)
+{
+    if (mapData == NULL || key == NULL || mapData->intersections == NULL
+        || mapData->intersections->list.count == 0
+        || mapData->intersections->list.count > LIBSM_MAP_MAX_INTERSECTIONS) {
+        return false;
+    }
+    *key = (libsm_map_key_t){ .count = (uint8_t)mapData->intersections->list.count };
+    for (uint8_t i = 0; i < key->count; i++) {
+        IntersectionGeometry_t const* geometry = mapData->intersections->list.array[i];
+        if (geometry == NULL) {
+            return false;
+        }
+        key->intersections[i] = map_intersection_key(&geometry->id);
+    }
+    return true;
+}
+
+
+bool libsm_map_key_equal(libsm_map_key_t const* a, libsm_map_key_t const* b)
+{
+    return a->count == b->count
+           && memcmp(a->intersections, b->intersections, a->count * sizeof(a->intersections[0]))
+                      == 0;
+}
+
+
+libsm_rval_e libsm_map_cache_init(libsm_map_cache_t* cache,
+                                  libsm_map_config_t const* config,
+                                  size_t capacity)
+{
+    if (cache == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    *cache = (libsm_map_cache_t){ 0 };
+    if (capacity == 0) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    if (config != NULL) {
+        cache->config = *config;
+    } else {
+        libsm_map_default_config(&cache->config);
+    }
+    cache->entries = calloc(capacity, sizeof(struct libsm_map_cache_entry));
+    if (cache->entries == NULL) {
+        return LIBSM_ALLOC_ERR;
+    }
+    cache->capacity = capacity;
+    return LIBSM_OK;
+}
+
+
+void libsm_map_cache_free(libsm_map_cache_t* cache)
+{
+    if (cache == NULL) {
+        return;
+    }
+    for (size_t i = 0; i < cache->capacity; i++) {
+        if (cache->entries[i].inUse) {
+            libsm_map_free(&cache->entries[i].map);
+        }
+    }
+    free(cache->entries);
+    *cache = (libsm_map_cache_t){ 0 };
+}
+
+
+libsm_rval_e libsm_map_cache_get(libsm_map_cache_t* cache,
+                                 MapData_t const* mapData,
+                                 libsm_map_t const** map)
+{
+    if (cache == NULL || mapData == NULL || map == NULL || cache->entries == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    *map = NULL;
+    libsm_map_key_t key;
+    if (!libsm_map_key(mapData, &key)) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+
+    struct libsm_map_cache_entry* slot = NULL;
+    cache->clock++;
+    for (size_t i = 0; i < cache->capacity; i++) {
+        struct libsm_map_cache_entry* entry = &cache->entries[i];
+        if (entry->inUse && libsm_map_key_equal(&entry->key, &key)) {
+            if (entry->map.msgIssueRevision == (uint8_t)mapData->msgIssueRevision) {
+                entry->lastUsed = cache->clock;
+                cache->hits++;
+                *map = &entry->map;
+                return LIBSM_OK;
+            }
+            slot = entry;
+            break;
+        }
+        if (slot == NULL || (slot->inUse && (!entry->inUse || entry->lastUsed < slot->lastUsed))) {
+            slot = entry;
+        }
+    }
+
+    libsm_map_t compiled;
+    libsm_rval_e const result = libsm_map_compile(mapData, &cache->config, &compiled);
+    if (result != LIBSM_OK) {
+        return result;
+    }
+    if (slot->inUse) {
+        libsm_map_free(&slot->map);
+    }
+    slot->inUse = true;
+    slot->key = key;
+    slot->lastUsed = cache->clock;
+    slot->map = compiled;
+    cache->compiles++;
+    *map = &slot->map;
+    return LIBSM_OK;
+}
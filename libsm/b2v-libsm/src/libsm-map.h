@@ -0,0 +1,270 @@
+/**
+ * @brief MapData lane compiler and map matching
+ *
+ * libsm_map_compile walks a decoded MapData once and produces a flat, immutable
+ * lane table: every lane of every intersection with its absolute polyline, width
+ * per node, connections and allowed maneuvers. Computed lanes are expanded from
+ * their reference lane. A uniform grid over the lane segments is packed in the
+ * same pass, so libsm_map_match answers "which lane and how far along it" for a
+ * position without touching the ASN.1 tree again.
+ *
+ * Positions are kept both as Latitude_t/Longitude_t and as east/north meters
+ * from the first intersection reference point.
+ *
+ * MAPs change rarely, libsm_map_cache_get only recompiles a map when its
+ * msgIssueRevision changes.
+ */
+
+#ifndef LIBSM_MAP_H
+#define LIBSM_MAP_H
+
+#include "Heading.h"
+#include "MapData.h"
+#include "MessageFrame.h"
+#include "libsm-error.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+#define LIBSM_MAP_NO_SIGNAL_GROUP -1
+#define LIBSM_MAP_NO_REMOTE       UINT32_MAX
+
+/** @brief IntersectionGeometryList is SIZE(1..32) */
+#define LIBSM_MAP_MAX_INTERSECTIONS 32
+
+/** @brief LaneDirection bits */
+#define LIBSM_MAP_INGRESS 0x01
+#define LIBSM_MAP_EGRESS  0x02
+
+/** @brief One lane node */
+typedef struct {
+    Latitude_t lat;
+    Longitude_t Long;
+    double east;   /**< @brief meters from the map origin */
+    double north;
+    double alongM; /**< @brief distance along the lane from the first node */
+    double widthM; /**< @brief lane width at this node */
+} libsm_map_point_t;
+
+/** @brief One entry of a lane connectsTo list */
+typedef struct {
+    uint8_t laneId;              /**< @brief connecting lane */
+    uint32_t remoteIntersection; /**< @brief LIBSM_MAP_NO_REMOTE for the same intersection */
+    int32_t signalGroup;         /**< @brief LIBSM_MAP_NO_SIGNAL_GROUP if not given */
+    uint16_t maneuvers;          /**< @brief AllowedManeuvers bits, bit n is named bit n */
+} libsm_map_connection_t;
+
+/** @brief One lane */
+typedef struct {
+    uint32_t intersection;    /**< @brief region << 16 | id */
+    uint8_t laneId;
+    uint8_t ingressApproach;  /**< @brief 0 if not given */
+    uint8_t egressApproach;   /**< @brief 0 if not given */
+    uint8_t direction;        /**< @brief LIBSM_MAP_INGRESS and/or LIBSM_MAP_EGRESS */
+    int laneType;             /**< @brief LaneTypeAttributes_PR */
+    uint16_t maneuvers;       /**< @brief AllowedManeuvers bits, 0 if not given */
+    bool computed;            /**< @brief expanded from a ComputedLane */
+    uint32_t firstPoint;      /**< @brief index into points */
+    uint32_t pointCount;
+    uint32_t firstConnection; /**< @brief index into connections */
+    uint32_t connectionCount;
+    double lengthM;
+} libsm_map_lane_t;
+
+/** @brief Compiler and index settings */
+typedef struct {
+    double cellSizeM;      /**< @brief grid cell size */
+    double matchDistanceM; /**< @brief furthest a position may be from a lane center line */
+    double defaultWidthM;  /**< @brief lane width when the MAP does not give one */
+    size_t maxCells;       /**< @brief cells are made larger when a map would need more */
+} libsm_map_config_t;
+
+/** @brief A compiled map, immutable once compiled */
+typedef struct {
+    libsm_map_config_t config;
+    uint8_t msgIssueRevision;
+    Latitude_t originLat;   /**< @brief reference point of the first intersection */
+    Longitude_t originLong;
+    double metersPerLat;
+    double metersPerLong;
+
+    libsm_map_lane_t* lanes;
+    size_t laneCount;
+    libsm_map_point_t* points;
+    size_t pointCount;
+    libsm_map_connection_t* connections;
+    size_t connectionCount;
+    size_t skippedLanes; /**< @brief lanes without nodes, or computed from a missing lane */
+
+    // grid over segments, a segment is identified by the index of its first point
+    double minEast;
+    double minNorth;
+    double cellSizeM;
+    uint32_t cellsX;
+    uint32_t cellsY;
+    uint32_t* cellStart; /**< @brief cellsX * cellsY + 1 offsets into cellSegments */
+    uint32_t* cellSegments;
+    uint32_t* pointLane; /**< @brief lane index of every point */
+} libsm_map_t;
+
+/** @brief Result of matching one position */
+typedef struct {
+    bool matched;
+    uint32_t lane;         /**< @brief index into lanes */
+    uint32_t intersection; /**< @brief region << 16 | id */
+    uint8_t laneId;
+    double distanceM;      /**< @brief distance from the lane center line */
+    double alongM;         /**< @brief distance along the lane from its first node */
+    bool inside;           /**< @brief within half the lane width */
+} libsm_map_match_t;
+
+/** @brief The intersections of a MAP, in order, see libsm_map_key */
+typedef struct {
+    uint8_t count;
+    uint32_t intersections[LIBSM_MAP_MAX_INTERSECTIONS]; /**< @brief region << 16 | id */
+} libsm_map_key_t;
+
+/** @brief Compiled maps by intersections, see libsm_map_cache_get */
+typedef struct {
+    libsm_map_config_t config;
+    size_t capacity;
+    struct libsm_map_cache_entry* entries;
+    uint64_t clock;
+    uint64_t hits;
+    uint64_t compiles;
+} libsm_map_cache_t;
+
+
+/**
+ * @brief Default settings
+ *
+ * 10 m cells, match within 5 m of a center line, 3.6 m lanes when no width is
+ * given, at most 1M cells.
+ */
+void libsm_map_default_config(libsm_map_config_t* config);
+
+
+/**
+ * @brief Compile a decoded MapData
+ *
+ * Only intersections are compiled, roadSegments are ignored.
+ *
+ * @param mapData The decoded MAP
+ * @param config Settings, NULL for the defaults
+ * @param map The compiled map, free with libsm_map_free
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG mapData or map was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER A setting is not positive, or there are no intersections
+ * @retval LIBSM_ALLOC_ERR Allocation error
+ */
+libsm_rval_e libsm_map_compile(MapData_t const* mapData,
+                               libsm_map_config_t const* config,
+                               libsm_map_t* map);
+
+
+/**
+ * @brief Free a compiled map
+ */
+void libsm_map_free(libsm_map_t* map);
+
+
+/**
+ * @brief Find the lane closest to a position
+ *
+ * @param map The compiled map
+ * @param lat Latitude
+ * @param Long Longitude
+ * @param heading Direction of travel, lanes only used the other way round are
+ *                skipped. Heading_unavailable to match any lane.
+ * @param match The closest lane within matchDistanceM, match->matched is false if none
+ *
+ * @retval LIBSM_OK Operation successful, matched or not
+ * @retval LIBSM_FAIL_NULL_ARG map or match was NULL
+ */
+libsm_rval_e libsm_map_match(libsm_map_t const* map,
+                             Latitude_t lat,
+                             Longitude_t Long,
+                             Heading_t heading,
+                             libsm_map_match_t* match);
+
+
+/**
+ * @brief libsm_map_match over arrays of positions
+ *
+ * @param headings NULL to match any lane
+ */
+libsm_rval_e libsm_map_match_batch(libsm_map_t const* map,
+                                   Latitude_t const* lats,
+                                   Longitude_t const* longs,
+                                   Heading_t const* headings,
+                                   size_t count,
+                                   libsm_map_match_t* matches);
+
+
+/**
+ * @brief Lane of a compiled map by intersection and lane ID, NULL if there is none
+ */
+libsm_map_lane_t const* libsm_map_find_lane(libsm_map_t const* map,
+                                            uint32_t intersection,
+                                            uint8_t laneId);
+
+
+/**
+ * @brief The key the MAP caches use: region << 16 | id of every intersection
+ *
+ * @return false if the MAP has no intersections, or more than LIBSM_MAP_MAX_INTERSECTIONS
+ */
+bool libsm_map_key(MapData_t const* mapData, libsm_map_key_t* key);
+
+
+/**
+ * @brief Whether two keys have the same intersections in the same order
+ */
+bool libsm_map_key_equal(libsm_map_key_t const* a, libsm_map_key_t const* b);
+
+
+/**
+ * @brief Initialize a cache of compiled maps
+ *
+ * @param cache The cache, free with libsm_map_cache_free
+ * @param config Settings the maps are compiled with, NULL for the defaults
+ * @param capacity Maps kept, the least recently used is dropped
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG cache was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER capacity was 0
+ * @retval LIBSM_ALLOC_ERR Allocation error
+ */
+libsm_rval_e libsm_map_cache_init(libsm_map_cache_t* cache,
+                                  libsm_map_config_t const* config,
+                                  size_t capacity);
+
+
+/**
+ * @brief Free a cache and all its maps
+ */
+void libsm_map_cache_free(libsm_map_cache_t* cache);
+
+
+/**
+ * @brief Compiled form of a MAP, compiling it only if its revision is new
+ *
+ * Maps are keyed by the reference IDs of all their intersections, see
+ * libsm_map_key. A map returned here stays valid until the same intersections
+ * come with another msgIssueRevision, the entry is dropped for a newer one, or
+ * the cache is freed.
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG An argument was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER The MAP has no intersections, or too many
+ * @retval LIBSM_ALLOC_ERR Allocation error
+ */
+libsm_rval_e libsm_map_cache_get(libsm_map_cache_t* cache,
+                                 MapData_t const* mapData,
+                                 libsm_map_t const** map);
+
+
+#endif // LIBSM_MAP_H
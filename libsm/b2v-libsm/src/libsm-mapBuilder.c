@@ -0,0 +1,428 @@
+/**
+ * Functions to generate J2735 MapData messages (MAP)
+ *
+ * Only the intersection geometry is covered, roadSegments, dataParameters and
+ * restrictionList are left for the caller.
+ *
+ * References:
+ * SAE J2735_202007.pdf (July 2020)
+ */
+
+#include "libsm-mapBuilder.h"
+#include "Connection.h"
+#include "ConnectsToList.h"
+#include "GenericLane.h"
+#include "IntersectionGeometry.h"
+#include "IntersectionGeometryList.h"
+#include "Node-XY-20b.h"
+#include "Node-XY-22b.h"
+#include "Node-XY-24b.h"
+#include "Node-XY-26b.h"
+#include "Node-XY-28b.h"
+#include "Node-XY-32b.h"
+#include "NodeSetXY.h"
+#include "NodeXY.h"
+#include "libsm.h"
+
+#include <stdlib.h>
+
+
+struct libsm_map_uper_entry {
+    bool inUse;
+    libsm_map_key_t key;
+    uint8_t msgIssueRevision;
+    uint64_t lastUsed;
+    size_t len;
+};
+
+
+MessageFrame_t* libsm_alloc_init_mf_map(void)
+{
+    MessageFrame_t* mf = calloc(1, sizeof(MessageFrame_t));
+    if (mf == NULL) {
+        return NULL;
+    }
+
+    mf->messageId = DSRCmsgID_mapData;
+    mf->value.present = MessageFrame__value_PR_MapData;
+
+    if (libsm_init_map(&mf->value.choice.MapData) != LIBSM_OK) {
+        ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+        return NULL;
+    }
+    return mf;
+}
+
+
+libsm_rval_e libsm_init_map(MapData_t* map)
+{
+    if (map == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+
+    map->msgIssueRevision = 0;
+    map->intersections = calloc(1, sizeof(IntersectionGeometryList_t));
+    if (map->intersections == NULL) {
+        return LIBSM_ALLOC_ERR;
+    }
+    return LIBSM_OK;
+}
+
+
+IntersectionGeometry_t* libsm_add_map_intersectionGeometry(MapData_t* map,
+                                                           IntersectionID_t id,
+                                                           Latitude_t lat,
+                                                           Longitude_t Long)
+{
+    if (map == NULL) {
+        return NULL;
+    }
+    if (map->intersections == NULL && libsm_init_map(map) != LIBSM_OK) {
+        return NULL;
+    }
+
+    IntersectionGeometry_t* geometry = calloc(1, sizeof(IntersectionGeometry_t));
+    if (geometry == NULL) {
+        return NULL;
+    }
+    geometry->id.id = id;
+    geometry->revision = 0;
+    geometry->refPoint.lat = lat;
+    geometry->refPoint.Long = Long;
+
+    if (ASN_SEQUENCE_ADD(&map->intersections->list, geometry)) {
+        free(geometry);
+        return NULL;
+    }
+    return geometry;
+}
+
+
+GenericLane_t* libsm_add_map_genericLane(IntersectionGeometry_t* geometry,
+                                         LaneID_t laneId,
+                                         uint8_t direction,
+                                         LaneTypeAttributes_PR laneType)
+{
+    if (geometry == NULL) {
+        return NULL;
+    }
+
+    // LaneAttributes-Vehicle is SIZE(8,...), the other lane types SIZE(16)
+    size_t typeBits;
+    switch (laneType) {
+        case LaneTypeAttributes_PR_vehicle:
+            typeBits = 8;
+            break;
+        case LaneTypeAttributes_PR_crosswalk:
+        case LaneTypeAttributes_PR_bikeLane:
+        case LaneTypeAttributes_PR_sidewalk:
+        case LaneTypeAttributes_PR_median:
+        case LaneTypeAttributes_PR_striping:
+        case LaneTypeAttributes_PR_trackedVehicle:
+        case LaneTypeAttributes_PR_parking:
+            typeBits = 16;
+            break;
+        case LaneTypeAttributes_PR_NOTHING:
+        default:
+            return NULL;
+    }
+
+    GenericLane_t* lane = calloc(1, sizeof(GenericLane_t));
+    if (lane == NULL) {
+        return NULL;
+    }
+    lane->laneID = laneId;
+    lane->laneAttributes.laneType.present = laneType;
+    // every lane type is a BIT STRING at the start of the union
+    if (libsm_init_bit_string(&lane->laneAttributes.directionalUse, 2) != LIBSM_OK
+        || libsm_init_bit_string(&lane->laneAttributes.sharedWith, 10) != LIBSM_OK
+        || libsm_init_bit_string(&lane->laneAttributes.laneType.choice.vehicle, typeBits)
+                   != LIBSM_OK) {
+        ASN_STRUCT_FREE(asn_DEF_GenericLane, lane);
+        return NULL;
+    }
+    // named bit 0, ingressPath, is the first bit
+    lane->laneAttributes.directionalUse.buf[0]
+            = (uint8_t)((direction & LIBSM_MAP_INGRESS ? 0x80 : 0)
+                        | (direction & LIBSM_MAP_EGRESS ? 0x40 : 0));
+
+    if (ASN_SEQUENCE_ADD(&geometry->laneSet.list, lane)) {
+        ASN_STRUCT_FREE(asn_DEF_GenericLane, lane);
+        return NULL;
+    }
+    return lane;
+}
+
+
+NodeOffsetPointXY_PR libsm_map_nodeXY_choice(long x, long y)
+{
+    long const ax = x < 0 ? -x - 1 : x;
+    long const ay = y < 0 ? -y - 1 : y;
+    long const larger = ax > ay ? ax : ay;
+
+    // Offset-B10 .. Offset-B14, then Offset-B16
+    if (larger < 512) {
+        return NodeOffsetPointXY_PR_node_XY1;
+    }
+    if (larger < 1024) {
+        return NodeOffsetPointXY_PR_node_XY2;
+    }
+    if (larger < 2048) {
+        return NodeOffsetPointXY_PR_node_XY3;
+    }
+    if (larger < 4096) {
+        return NodeOffsetPointXY_PR_node_XY4;
+    }
+    if (larger < 8192) {
+        return NodeOffsetPointXY_PR_node_XY5;
+    }
+    if (larger < 32768) {
+        return NodeOffsetPointXY_PR_node_XY6;
+    }
+    return NodeOffsetPointXY_PR_NOTHING;
+}
+
+
+NodeXY_t* libsm_alloc_init_NodeXY(long x, long y)
+{
+    NodeOffsetPointXY_PR const choice = libsm_map_nodeXY_choice(x, y);
+    if (choice == NodeOffsetPointXY_PR_NOTHING) {
+        return NULL;
+    }
+
+    NodeXY_t* node = calloc(1, sizeof(NodeXY_t));
+    if (node == NULL) {
+        return NULL;
+    }
+
+    // Node-XY-20b .. Node-XY-32b only differ in their constraints
+#define LIBSM_NODE_XY(member, type)                                                                \
+    case NodeOffsetPointXY_PR_##member:                                                            \
+        node->delta.choice.member = calloc(1, sizeof(type));                                       \
+        if (node->delta.choice.member == NULL) {                                                   \
+            free(node);                                                                            \
+            return NULL;                                                                           \
+        }                                                                                          \
+        node->delta.choice.member->x = x;                                                          \
+        node->delta.choice.member->y = y;                                                          \
+        break;
+
+    switch (choice) {
+        LIBSM_NODE_XY(node_XY1, Node_XY_20b_t)
+        LIBSM_NODE_XY(node_XY2, Node_XY_22b_t)
+        LIBSM_NODE_XY(node_XY3, Node_XY_24b_t)
+        LIBSM_NODE_XY(node_XY4, Node_XY_26b_t)
+        LIBSM_NODE_XY(node_XY5, Node_XY_28b_t)
+        LIBSM_NODE_XY(node_XY6, Node_XY_32b_t)
+        case NodeOffsetPointXY_PR_NOTHING:
+        case NodeOffsetPointXY_PR_node_LatLon:
+        case NodeOffsetPointXY_PR_regional:
+        default:
+            free(node);
+            return NULL;
+    }
+#undef LIBSM_NODE_XY
+    node->delta.present = choice;
+    return node;
+}
+
+
+NodeXY_t* libsm_add_map_nodeXY(GenericLane_t* lane, long x, long y)
+{
+    if (lane == NULL) {
+        return NULL;
+    }
+    if (lane->nodeList.present == NodeListXY_PR_NOTHING) {
+        lane->nodeList.choice.nodes = calloc(1, sizeof(NodeSetXY_t));
+        if (lane->nodeList.choice.nodes == NULL) {
+            return NULL;
+        }
+        lane->nodeList.present = NodeListXY_PR_nodes;
+    } else if (lane->nodeList.present != NodeListXY_PR_nodes) {
+        return NULL;
+    }
+
+    NodeXY_t* node = libsm_alloc_init_NodeXY(x, y);
+    if (node == NULL) {
+        return NULL;
+    }
+    if (ASN_SEQUENCE_ADD(&lane->nodeList.choice.nodes->list, node)) {
+        ASN_STRUCT_FREE(asn_DEF_NodeXY, node);
+        return NULL;
+    }
+    return node;
+}
+
+
+Connection_t* libsm_add_map_connection(GenericLane_t* lane,
+                                       LaneID_t connectingLane,
+                                       long signalGroup)
+{
+    if (lane == NULL) {
+        return NULL;
+    }
+    if (lane->connectsTo == NULL) {
+        lane->connectsTo = calloc(1, sizeof(ConnectsToList_t));
+        if (lane->connectsTo == NULL) {
+            return NULL;
+        }
+    }
+
+    Connection_t* connection = calloc(1, sizeof(Connection_t));
+    if (connection == NULL) {
+        return NULL;
+    }
+    connection->connectingLane.lane = connectingLane;
+    if (signalGroup != LIBSM_MAP_NO_SIGNAL_GROUP) {
+        connection->signalGroup = calloc(1, sizeof(SignalGroupID_t));
+        if (connection->signalGroup == NULL) {
+            free(connection);
+            return NULL;
+        }
+        *connection->signalGroup = signalGroup;
+    }
+
+    if (ASN_SEQUENCE_ADD(&lane->connectsTo->list, connection)) {
+        ASN_STRUCT_FREE(asn_DEF_Connection, connection);
+        return NULL;
+    }
+    return connection;
+}
+
+
+/**
+ * Checks if the given Message Frame contains a MAP message.
+ */
+bool libsm_mf_has_map(MessageFrame_t const* const mf)
+{
+    return mf->messageId == DSRCmsgID_mapData
+           && mf->value.present == MessageFrame__value_PR_MapData;
+}
+
+
+/**
+ * Getter that returns the MAP message in the provided Message Frame.
+ */
+MapData_t* libsm_get_map(MessageFrame_t* const mf)
+{
+    if (libsm_mf_has_map(mf)) {
+        return &mf->value.choice.MapData;
+    }
+    return NULL;
+}
+
+
+libsm_rval_e libsm_map_uper_cache_init(libsm_map_uper_cache_t* cache,
+                                       size_t capacity,
+                                       size_t slotSize)
+{
+    if (cache == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    *cache = (libsm_map_uper_cache_t){ 0 };
+    if (capacity == 0 || slotSize == 0) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    cache->entries = calloc(capacity, sizeof(struct libsm_map_uper_entry));
+    cache->slots = malloc(capacity * slotSize);
+    if (cache->entries == NULL || cache->slots == NULL) {
+        libsm_map_uper_cache_free(cache);
+        return LIBSM_ALLOC_ERR;
+    }
+    cache->capacity = capacity;
+    cache->slotSize = slotSize;
+    return LIBSM_OK;
+}
+
+
+void libsm_map_uper_cache_free(libsm_map_uper_cache_t* cache)
+{
+    if (cache == NULL) {
+        return;
+    }
+    free(cache->entries);
+    free(cache->slots);
+    *cache = (libsm_map_uper_cache_t){ 0 };
+}
+
+
+// cached encoding of the MAP of these intersections, NULL if there is none
+static struct libsm_map_uper_entry* map_uper_find(libsm_map_uper_cache_t const* cache,
+                                                  libsm_map_key_t const* key)
+{
+    for (size_t i = 0; i < cache->capacity; i++) {
+        struct libsm_map_uper_entry* entry = &cache->entries[i];
+        if (entry->inUse && libsm_map_key_equal(&entry->key, key)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+
+libsm_rval_e libsm_map_uper_cache_get(libsm_map_uper_cache_t* cache,
+                                      MessageFrame_t* mf,
+                                      uint8_t const** encoded,
+                                      size_t* len)
+{
+    if (cache == NULL || mf == NULL || encoded == NULL || len == NULL || cache->entries == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    *encoded = NULL;
+    *len = 0;
+    MapData_t const* mapData = libsm_get_map(mf);
+    libsm_map_key_t key;
+    if (!libsm_map_key(mapData, &key)) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+
+    uint8_t const revision = (uint8_t)mapData->msgIssueRevision;
+    cache->clock++;
+    struct libsm_map_uper_entry* slot = map_uper_find(cache, &key);
+    if (slot != NULL && slot->msgIssueRevision == revision) {
+        slot->lastUsed = cache->clock;
+        cache->hits++;
+        *encoded = cache->slots + (size_t)(slot - cache->entries) * cache->slotSize;
+        *len = slot->len;
+        return LIBSM_OK;
+    }
+    if (slot == NULL) {
+        slot = &cache->entries[0];
+        for (size_t i = 1; i < cache->capacity && slot->inUse; i++) {
+            struct libsm_map_uper_entry* entry = &cache->entries[i];
+            if (!entry->inUse || entry->lastUsed < slot->lastUsed) {
+                slot = entry;
+            }
+        }
+    }
+
+    uint8_t* bytes = cache->slots + (size_t)(slot - cache->entries) * cache->slotSize;
+    size_t size = cache->slotSize;
+    libsm_rval_e const result = libsm_encode_messageframe(mf, bytes, &size);
+    if (result != LIBSM_OK) {
+        slot->inUse = false;
+        return result;
+    }
+    slot->inUse = true;
+    slot->key = key;
+    slot->msgIssueRevision = revision;
+    slot->lastUsed = cache->clock;
+    slot->len = size;
+    cache->encodes++;
+    *encoded = bytes;
+    *len = size;
+    return LIBSM_OK;
+}
+
+
+void libsm_map_uper_cache_invalidate(libsm_map_uper_cache_t* cache, MapData_t const* mapData)
+{
+    libsm_map_key_t key;
+    if (cache == NULL || cache->entries == NULL || !libsm_map_key(mapData, &key)) {
+        return;
+    }
+    struct libsm_map_uper_entry* entry = map_uper_find(cache, &key);
+    if (entry != NULL) {
+        entry->inUse = false;
+    }
+}
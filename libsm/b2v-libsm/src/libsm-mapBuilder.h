@@ -0,0 +1,207 @@
+/**
+ * Public functions for MapData (MAP) messages
+ *
+ * Builders for the intersection geometry of a MAP: intersections, their lanes,
+ * the lane node lists and connections. Everything is calloced and added to its
+ * parent, ASN_STRUCT_FREE the MessageFrame when done.
+ *
+ * A MAP only changes with its msgIssueRevision, see libsm_map_uper_cache_get
+ * to encode it once per revision instead of once per broadcast.
+ */
+
+#ifndef B2V_LIBSM_LIBSM_MAP_BUILDER_H
+#define B2V_LIBSM_LIBSM_MAP_BUILDER_H
+
+#include "MapData.h"
+#include "MessageFrame.h"
+#include "libsm-error.h"
+#include "libsm-map.h"
+
+#include <stdbool.h>
+
+
+/** @brief UPER encoded MAPs by intersections, see libsm_map_uper_cache_get */
+typedef struct {
+    size_t capacity;
+    size_t slotSize;  /**< @brief bytes kept per MAP */
+    struct libsm_map_uper_entry* entries;
+    uint8_t* slots;   /**< @brief capacity * slotSize */
+    uint64_t clock;
+    uint64_t hits;
+    uint64_t encodes;
+} libsm_map_uper_cache_t;
+
+
+/**
+ * @brief Allocate and initialize a MapData message inside a messageframe
+ *
+ * msgIssueRevision is 0 and the intersection list is empty, a MAP needs at
+ * least one libsm_add_map_intersectionGeometry to encode.
+ *
+ * @return Pointer to MessageFrame_t, else NULL
+ */
+MessageFrame_t* libsm_alloc_init_mf_map(void);
+
+
+/**
+ * @brief Initialize an already allocated MapData
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG map was NULL
+ * @retval LIBSM_ALLOC_ERR Allocation error
+ */
+libsm_rval_e libsm_init_map(MapData_t* map);
+
+
+/**
+ * @brief alloc-init an intersection and add it to a MAP
+ *
+ * The intersection has revision 0 and no lanes, add 1 to 255 with
+ * libsm_add_map_genericLane.
+ *
+ * @param map The MAP
+ * @param id IntersectionID, without region
+ * @param lat Latitude of the reference point
+ * @param Long Longitude of the reference point
+ *
+ * @return Pointer to the added IntersectionGeometry_t, else NULL
+ */
+IntersectionGeometry_t* libsm_add_map_intersectionGeometry(MapData_t* map,
+                                                           IntersectionID_t id,
+                                                           Latitude_t lat,
+                                                           Longitude_t Long);
+
+
+/**
+ * @brief alloc-init a lane and add it to an intersection
+ *
+ * The lane type attributes of laneType are all clear, its node list is empty,
+ * add 2 to 63 nodes with libsm_add_map_nodeXY.
+ *
+ * @param geometry The intersection
+ * @param laneId LaneID, unique in the intersection
+ * @param direction LIBSM_MAP_INGRESS and/or LIBSM_MAP_EGRESS
+ * @param laneType Any LaneTypeAttributes_PR but NOTHING
+ *
+ * @return Pointer to the added GenericLane_t, else NULL
+ */
+GenericLane_t* libsm_add_map_genericLane(IntersectionGeometry_t* geometry,
+                                         LaneID_t laneId,
+                                         uint8_t direction,
+                                         LaneTypeAttributes_PR laneType);
+
+
+/**
+ * @brief The smallest node_XY choice that holds an offset
+ *
+ * @param x East offset from the previous node, in cm
+ * @param y North offset from the previous node, in cm
+ *
+ * @return node_XY1 to node_XY6, NodeOffsetPointXY_PR_NOTHING if an offset is
+ *         beyond +-327.67 m
+ */
+NodeOffsetPointXY_PR libsm_map_nodeXY_choice(long x, long y);
+
+
+/**
+ * @brief alloc-init a NodeXY with the smallest offset choice
+ *
+ * @param x East offset from the previous node, in cm
+ * @param y North offset from the previous node, in cm
+ *
+ * @return Pointer to NodeXY_t, NULL if the offset is too large or on allocation error
+ */
+NodeXY_t* libsm_alloc_init_NodeXY(long x, long y);
+
+
+/**
+ * @brief alloc-init a NodeXY with the smallest offset choice and add it to a lane
+ *
+ * The first node is the offset from the intersection reference point, every
+ * later one the offset from the node before.
+ *
+ * @param lane A lane with a node list, or none yet. Not a computed lane.
+ * @param x East offset, in cm
+ * @param y North offset, in cm
+ *
+ * @return Pointer to the added NodeXY_t, else NULL
+ */
+NodeXY_t* libsm_add_map_nodeXY(GenericLane_t* lane, long x, long y);
+
+
+/**
+ * @brief alloc-init a connection and add it to the connectsTo list of a lane
+ *
+ * @param lane The lane
+ * @param connectingLane The lane it connects to, in the same intersection
+ * @param signalGroup SignalGroupID, LIBSM_MAP_NO_SIGNAL_GROUP for none
+ *
+ * @return Pointer to the added Connection_t, else NULL
+ */
+Connection_t* libsm_add_map_connection(GenericLane_t* lane,
+                                       LaneID_t connectingLane,
+                                       long signalGroup);
+
+
+bool libsm_mf_has_map(MessageFrame_t const* const mf);
+
+
+MapData_t* libsm_get_map(MessageFrame_t* const mf);
+
+
+/**
+ * @brief Initialize a cache of UPER encoded MAPs
+ *
+ * @param cache The cache, free with libsm_map_uper_cache_free
+ * @param capacity MAPs kept, the least recently used is dropped
+ * @param slotSize Largest encoded MessageFrame kept, in bytes
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG cache was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER capacity or slotSize was 0
+ * @retval LIBSM_ALLOC_ERR Allocation error
+ */
+libsm_rval_e libsm_map_uper_cache_init(libsm_map_uper_cache_t* cache,
+                                       size_t capacity,
+                                       size_t slotSize);
+
+
+/**
+ * @brief Free a cache and all its encodings
+ */
+void libsm_map_uper_cache_free(libsm_map_uper_cache_t* cache);
+
+
+/**
+ * @brief UPER encoding of a MAP MessageFrame, encoding it only if its revision is new
+ *
+ * MAPs are keyed by the reference IDs of all their intersections, libsm_map_key.
+ * A MAP changed without a new msgIssueRevision keeps its old encoding until
+ * libsm_map_uper_cache_invalidate. The bytes stay valid until the same
+ * intersections come with another msgIssueRevision, the entry is dropped for a
+ * newer one, or the cache is freed.
+ *
+ * @param cache The cache
+ * @param mf A MessageFrame with a MAP
+ * @param encoded The encoded MessageFrame
+ * @param len Its size in bytes
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG An argument was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER mf is not a MAP, or the MAP has no intersections,
+ *                                       or more than IntersectionGeometryList allows
+ * @return Else as libsm_encode_messageframe into slotSize bytes
+ */
+libsm_rval_e libsm_map_uper_cache_get(libsm_map_uper_cache_t* cache,
+                                      MessageFrame_t* mf,
+                                      uint8_t const** encoded,
+                                      size_t* len);
+
+
+/**
+ * @brief Drop the encoding of the MAP of the same intersections, if there is one
+ */
+void libsm_map_uper_cache_invalidate(libsm_map_uper_cache_t* cache, MapData_t const* mapData);
+
+
+#endif // B2V_LIBSM_LIBSM_MAP_BUILDER_H
@@ -0,0 +1,1145 @@
+/**
+ * @brief BASIC-OER (X.696) codec for MessageFrames, and an OER archive format
+ */
+
+#include "libsm-oer.h"
+#include "libsm.h"
+#include "BOOLEAN.h"
+#include "NativeEnumerated.h"
+#include "NativeInteger.h"
+#include "OPEN_TYPE.h"
+#include "asn_SEQUENCE_OF.h"
+#include "constr_SEQUENCE_OF.h"
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+typedef struct {
+    uint8_t* out;
+    size_t size;
+    size_t pos;
+} oer_writer_t;
+
+typedef struct {
+    uint8_t const* in;
+    size_t end;
+    size_t pos;
+} oer_reader_t;
+
+
+static libsm_rval_e oer_put_value(oer_writer_t* w,
+                                  asn_TYPE_descriptor_t const* td,
+                                  asn_per_constraints_t const* constraints,
+                                  void const* sptr);
+static libsm_rval_e oer_get_value(oer_reader_t* r,
+                                  asn_TYPE_descriptor_t const* td,
+                                  asn_per_constraints_t const* constraints,
+                                  void* sptr);
+
+
+/*
+ * Writing and reading octets
+ */
+
+static libsm_rval_e oer_put_bytes(oer_writer_t* w, void const* bytes, size_t n)
+{
+    if (w->size - w->pos < n) {
+        return LIBSM_FAIL_ENCODING_BUFF_SIZE;
+    }
+    if (n) {
+        memcpy(w->out + w->pos, bytes, n);
+    }
+    w->pos += n;
+    return LIBSM_OK;
+}
+
+
+static libsm_rval_e oer_put_byte(oer_writer_t* w, uint8_t byte)
+{
+    return oer_put_bytes(w, &byte, 1);
+}
+
+
+// value in n big endian octets
+static libsm_rval_e oer_put_uint(oer_writer_t* w, uint64_t value, unsigned n)
+{
+    if (w->size - w->pos < n) {
+        return LIBSM_FAIL_ENCODING_BUFF_SIZE;
+    }
+    for (unsigned i = n; i > 0; i--) {
+        w->out[w->pos + i - 1] = (uint8_t)value;
+        value >>= 8;
+    }
+    w->pos += n;
+    return LIBSM_OK;
+}
+
+
+static bool oer_get_bytes(oer_reader_t* r, uint8_t const** bytes, size_t n)
+{
+    if (r->end - r->pos < n) {
+        return false;
+    }
+    *bytes = r->in + r->pos;
+    r->pos += n;
+    return true;
+}
+
+
+static bool oer_get_uint(oer_reader_t* r, uint64_t* value, unsigned n)
+{
+    uint8_t const* bytes;
+    if (!oer_get_bytes(r, &bytes, n)) {
+        return false;
+    }
+    uint64_t v = 0;
+    for (unsigned i = 0; i < n; i++) {
+        v = (v << 8) | bytes[i];
+    }
+    *value = v;
+    return true;
+}
+
+
+// fewest octets holding value as an unsigned number, at least one
+static unsigned oer_uint_bytes(uint64_t value)
+{
+    unsigned n = 1;
+    while (n < 8 && (value >> (8 * n)) != 0) {
+        n++;
+    }
+    return n;
+}
+
+
+// fewest octets holding value in two's complement, at least one
+static unsigned oer_int_bytes(int64_t value)
+{
+    unsigned n = 1;
+    while (n < 8) {
+        int64_t const half = INT64_C(1) << (8 * n - 1);
+        if (value >= -half && value < half) {
+            break;
+        }
+        n++;
+    }
+    return n;
+}
+
+
+// X.696 8.6, short form up to 127 then the number of length octets
+static libsm_rval_e oer_put_length(oer_writer_t* w, size_t length)
+{
+    if (length < 128) {
+        return oer_put_byte(w, (uint8_t)length);
+    }
+    unsigned const n = oer_uint_bytes(length);
+    libsm_rval_e const rval = oer_put_byte(w, (uint8_t)(0x80 | n));
+    return rval != LIBSM_OK ? rval : oer_put_uint(w, length, n);
+}
+
+
+// also checks that length octets follow
+static bool oer_get_length(oer_reader_t* r, size_t* length)
+{
+    uint8_t const* first;
+    if (!oer_get_bytes(r, &first, 1)) {
+        return false;
+    }
+    if (*first < 128) {
+        *length = *first;
+    } else {
+        unsigned const n = *first & 0x7F;
+        uint64_t value;
+        if (n == 0 || n > sizeof(size_t) || !oer_get_uint(r, &value, n)) {
+            return false;
+        }
+        *length = (size_t)value;
+    }
+    return *length <= r->end - r->pos;
+}
+
+
+/*
+ * Integers and enumerations, X.696 10 and 11
+ */
+
+/*
+ * Octets of a fixed size integer, 0 for a length prefixed one. Extensible
+ * constraints are not OER visible.
+ */
+static unsigned oer_integer_form(asn_per_constraints_t const* constraints, bool* isSigned)
+{
+    *isSigned = true;
+    if (constraints == NULL) {
+        return 0;
+    }
+    asn_per_constraint_t const* c = &constraints->value;
+    if ((c->flags & APC_EXTENSIBLE) || !(c->flags & (APC_SEMI_CONSTRAINED | APC_CONSTRAINED))) {
+        return 0;
+    }
+    if (c->lower_bound >= 0) {
+        *isSigned = false;
+        if (!(c->flags & APC_CONSTRAINED)) {
+            return 0;
+        }
+        uintmax_t const ub = (uintmax_t)c->upper_bound;
+        return ub <= UINT8_MAX ? 1 : ub <= UINT16_MAX ? 2 : ub <= UINT32_MAX ? 4 : 8;
+    }
+    if (!(c->flags & APC_CONSTRAINED)) {
+        return 0;
+    }
+    intmax_t const lb = c->lower_bound;
+    intmax_t const ub = c->upper_bound;
+    if (lb >= INT8_MIN && ub <= INT8_MAX) {
+        return 1;
+    }
+    if (lb >= INT16_MIN && ub <= INT16_MAX) {
+        return 2;
+    }
+    return lb >= INT32_MIN && ub <= INT32_MAX ? 4 : 8;
+}
+
+
+static libsm_rval_e oer_put_integer(oer_writer_t* w,
+                                    asn_per_constraints_t const* constraints,
+                                    long value)
+{
+    bool isSigned;
+    unsigned n = oer_integer_form(constraints, &isSigned);
+    if (constraints != NULL && !(constraints->value.flags & APC_EXTENSIBLE)) {
+        asn_per_constraint_t const* c = &constraints->value;
+        if ((c->flags & (APC_SEMI_CONSTRAINED | APC_CONSTRAINED)) && value < c->lower_bound) {
+            return LIBSM_FAIL_CONSTRAINT;
+        }
+        if ((c->flags & APC_CONSTRAINED) && value > c->upper_bound) {
+            return LIBSM_FAIL_CONSTRAINT;
+        }
+    }
+    if (n == 0) {
+        n = isSigned ? oer_int_bytes(value) : oer_uint_bytes((uint64_t)value);
+        libsm_rval_e const rval = oer_put_length(w, n);
+        if (rval != LIBSM_OK) {
+            return rval;
+        }
+    }
+    return oer_put_uint(w, (uint64_t)value, n);
+}
+
+
+static bool oer_get_integer(oer_reader_t* r, asn_per_constraints_t const* constraints, long* value)
+{
+    bool isSigned;
+    unsigned n = oer_integer_form(constraints, &isSigned);
+    if (n == 0) {
+        size_t length;
+        if (!oer_get_length(r, &length) || length == 0 || length > 8) {
+            return false;
+        }
+        n = (unsigned)length;
+    }
+    uint64_t raw;
+    if (!oer_get_uint(r, &raw, n)) {
+        return false;
+    }
+    if (isSigned) {
+        unsigned const shift = 64 - 8 * n;
+        *value = (long)((int64_t)(raw << shift) >> shift);
+    } else if (raw > LONG_MAX) {
+        return false;
+    } else {
+        *value = (long)raw;
+    }
+    // the fixed sizes hold more than the constraint allows, X.696 10.2 and 10.3
+    if (constraints != NULL && !(constraints->value.flags & APC_EXTENSIBLE)) {
+        asn_per_constraint_t const* c = &constraints->value;
+        if ((c->flags & (APC_SEMI_CONSTRAINED | APC_CONSTRAINED)) && *value < c->lower_bound) {
+            return false;
+        }
+        if ((c->flags & APC_CONSTRAINED) && *value > c->upper_bound) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+static libsm_rval_e oer_put_enumerated(oer_writer_t* w, long value)
+{
+    if (value >= 0 && value <= 127) {
+        return oer_put_byte(w, (uint8_t)value);
+    }
+    unsigned const n = oer_int_bytes(value);
+    libsm_rval_e const rval = oer_put_byte(w, (uint8_t)(0x80 | n));
+    return rval != LIBSM_OK ? rval : oer_put_uint(w, (uint64_t)value, n);
+}
+
+
+static bool oer_get_enumerated(oer_reader_t* r, long* value)
+{
+    uint8_t const* first;
+    if (!oer_get_bytes(r, &first, 1)) {
+        return false;
+    }
+    if (*first < 128) {
+        *value = *first;
+        return true;
+    }
+    unsigned const n = *first & 0x7F;
+    uint64_t raw;
+    if (n == 0 || n > 8 || !oer_get_uint(r, &raw, n)) {
+        return false;
+    }
+    unsigned const shift = 64 - 8 * n;
+    *value = (long)((int64_t)(raw << shift) >> shift);
+    return true;
+}
+
+
+/*
+ * Strings, X.696 13 to 15
+ */
+
+// SIZE(n) without extension marker, so no length is encoded
+static bool oer_fixed_size(asn_per_constraints_t const* constraints, size_t* size)
+{
+    if (constraints == NULL || constraints->size.flags != APC_CONSTRAINED
+        || constraints->size.lower_bound != constraints->size.upper_bound) {
+        return false;
+    }
+    *size = (size_t)constraints->size.lower_bound;
+    return true;
+}
+
+
+static libsm_rval_e oer_put_bit_string(oer_writer_t* w,
+                                       asn_per_constraints_t const* constraints,
+                                       BIT_STRING_t const* bits)
+{
+    if (bits->bits_unused < 0 || bits->bits_unused > 7 || (bits->size == 0 && bits->bits_unused)
+        || (bits->size && bits->buf == NULL)) {
+        return LIBSM_FAIL_ENCODING;
+    }
+    size_t const bitCount = bits->size * 8 - (size_t)bits->bits_unused;
+    size_t fixed;
+    libsm_rval_e rval = LIBSM_OK;
+    if (oer_fixed_size(constraints, &fixed)) {
+        if (bitCount != fixed) {
+            return LIBSM_FAIL_CONSTRAINT;
+        }
+    } else {
+        rval = oer_put_length(w, bits->size + 1);
+        if (rval == LIBSM_OK) {
+            rval = oer_put_byte(w, (uint8_t)bits->bits_unused);
+        }
+    }
+    if (rval != LIBSM_OK || bits->size == 0) {
+        return rval;
+    }
+    // unused bits are zero on the wire
+    rval = oer_put_bytes(w, bits->buf, bits->size);
+    if (rval == LIBSM_OK) {
+        w->out[w->pos - 1] &= (uint8_t)(0xFF << bits->bits_unused);
+    }
+    return rval;
+}
+
+
+static libsm_rval_e oer_get_bit_string(oer_reader_t* r,
+                                       asn_per_constraints_t const* constraints,
+                                       BIT_STRING_t* bits)
+{
+    size_t fixed;
+    size_t size;
+    int unused;
+    if (oer_fixed_size(constraints, &fixed)) {
+        size = (fixed + 7) / 8;
+        unused = (int)(size * 8 - fixed);
+    } else {
+        size_t length;
+        uint8_t const* first;
+        if (!oer_get_length(r, &length) || length == 0 || !oer_get_bytes(r, &first, 1)) {
+            return LIBSM_FAIL_DECODING;
+        }
+        size = length - 1;
+        unused = *first;
+        if (unused > 7 || (size == 0 && unused)) {
+            return LIBSM_FAIL_DECODING;
+        }
+    }
+    uint8_t const* bytes;
+    if (!oer_get_bytes(r, &bytes, size)) {
+        return LIBSM_FAIL_DECODING;
+    }
+    bits->buf = calloc(1, size + 1);
+    if (bits->buf == NULL) {
+        return LIBSM_ALLOC_ERR;
+    }
+    if (size) {
+        memcpy(bits->buf, bytes, size);
+        bits->buf[size - 1] &= (uint8_t)(0xFF << unused);
+    }
+    bits->size = size;
+    bits->bits_unused = unused;
+    return LIBSM_OK;
+}
+
+
+// OCTET STRING and IA5String
+static libsm_rval_e oer_put_octet_string(oer_writer_t* w,
+                                         asn_per_constraints_t const* constraints,
+                                         OCTET_STRING_t const* octets)
+{
+    if (octets->size && octets->buf == NULL) {
+        return LIBSM_FAIL_ENCODING;
+    }
+    size_t fixed;
+    if (oer_fixed_size(constraints, &fixed)) {
+        if (octets->size != fixed) {
+            return LIBSM_FAIL_CONSTRAINT;
+        }
+    } else {
+        libsm_rval_e const rval = oer_put_length(w, octets->size);
+        if (rval != LIBSM_OK) {
+            return rval;
+        }
+    }
+    return oer_put_bytes(w, octets->buf, octets->size);
+}
+
+
+static libsm_rval_e oer_get_octet_string(oer_reader_t* r,
+                                         asn_per_constraints_t const* constraints,
+                                         OCTET_STRING_t* octets)
+{
+    size_t size;
+    if (!oer_fixed_size(constraints, &size) && !oer_get_length(r, &size)) {
+        return LIBSM_FAIL_DECODING;
+    }
+    uint8_t const* bytes;
+    if (!oer_get_bytes(r, &bytes, size)) {
+        return LIBSM_FAIL_DECODING;
+    }
+    // NUL terminated, like asn1c does
+    octets->buf = malloc(size + 1);
+    if (octets->buf == NULL) {
+        return LIBSM_ALLOC_ERR;
+    }
+    memcpy(octets->buf, bytes, size);
+    octets->buf[size] = 0;
+    octets->size = size;
+    return LIBSM_OK;
+}
+
+
+/*
+ * Members and open types
+ */
+
+// size of the structure asn1c uses for td, 0 when this codec does not handle td
+static size_t oer_struct_size(asn_TYPE_descriptor_t const* td)
+{
+    asn_TYPE_operation_t const* op = td->op;
+    if (op == &asn_OP_SEQUENCE) {
+        return ((asn_SEQUENCE_specifics_t const*)td->specifics)->struct_size;
+    }
+    if (op == &asn_OP_CHOICE || op == &asn_OP_OPEN_TYPE) {
+        return ((asn_CHOICE_specifics_t const*)td->specifics)->struct_size;
+    }
+    if (op == &asn_OP_SEQUENCE_OF) {
+        return ((asn_SET_OF_specifics_t const*)td->specifics)->struct_size;
+    }
+    if (op == &asn_OP_NativeInteger || op == &asn_OP_NativeEnumerated) {
+        return sizeof(long);
+    }
+    if (op == &asn_OP_BOOLEAN) {
+        return sizeof(BOOLEAN_t);
+    }
+    if (op == &asn_OP_BIT_STRING || op == &asn_OP_OCTET_STRING || op == &asn_OP_IA5String) {
+        if (td->specifics) {
+            return ((asn_OCTET_STRING_specifics_t const*)td->specifics)->struct_size;
+        }
+        return op == &asn_OP_BIT_STRING ? sizeof(BIT_STRING_t) : sizeof(OCTET_STRING_t);
+    }
+    return 0;
+}
+
+
+// where a member is, NULL when it is an absent pointer
+static void const* oer_member(void const* sptr, asn_TYPE_member_t const* elm)
+{
+    void const* memb = (char const*)sptr + elm->memb_offset;
+    if (elm->flags & ATF_POINTER) {
+        memb = *(void const* const*)memb;
+    }
+    return memb;
+}
+
+
+// where to decode a member, allocating it when it is a pointer
+static libsm_rval_e oer_member_target(void* sptr, asn_TYPE_member_t const* elm, void** target)
+{
+    void* memb = (char*)sptr + elm->memb_offset;
+    if (!(elm->flags & ATF_POINTER)) {
+        *target = memb;
+        return LIBSM_OK;
+    }
+    size_t const size = oer_struct_size(elm->type);
+    if (size == 0) {
+        return LIBSM_FAIL_DECODING;
+    }
+    *(void**)memb = calloc(1, size);
+    if (*(void**)memb == NULL) {
+        return LIBSM_ALLOC_ERR;
+    }
+    *target = *(void**)memb;
+    return LIBSM_OK;
+}
+
+
+static asn_per_constraints_t const* oer_member_constraints(asn_TYPE_member_t const* elm)
+{
+    return elm->encoding_constraints.per_constraints;
+}
+
+
+// X.696 8.6 open type: a length determinant and the encoding
+static libsm_rval_e oer_put_wrapped(oer_writer_t* w,
+                                    asn_TYPE_descriptor_t const* td,
+                                    asn_per_constraints_t const* constraints,
+                                    void const* sptr)
+{
+    size_t const lengthPos = w->pos;
+    libsm_rval_e rval = oer_put_byte(w, 0);
+    if (rval != LIBSM_OK) {
+        return rval;
+    }
+    size_t const start = w->pos;
+    rval = oer_put_value(w, td, constraints, sptr);
+    if (rval != LIBSM_OK) {
+        return rval;
+    }
+    size_t const length = w->pos - start;
+    if (length < 128) {
+        w->out[lengthPos] = (uint8_t)length;
+        return LIBSM_OK;
+    }
+    // long form, move the encoding up to make room
+    unsigned const n = oer_uint_bytes(length);
+    if (w->size - w->pos < n) {
+        return LIBSM_FAIL_ENCODING_BUFF_SIZE;
+    }
+    memmove(w->out + start + n, w->out + start, length);
+    w->out[lengthPos] = (uint8_t)(0x80 | n);
+    w->pos = lengthPos + 1;
+    oer_put_uint(w, length, n);
+    w->pos += length;
+    return LIBSM_OK;
+}
+
+
+// the encoding must fill the open type exactly
+static libsm_rval_e oer_get_wrapped(oer_reader_t* r,
+                                    asn_TYPE_descriptor_t const* td,
+                                    asn_per_constraints_t const* constraints,
+                                    void* sptr)
+{
+    size_t length;
+    if (!oer_get_length(r, &length)) {
+        return LIBSM_FAIL_DECODING;
+    }
+    oer_reader_t inner = { r->in, r->pos + length, r->pos };
+    libsm_rval_e const rval = oer_get_value(&inner, td, constraints, sptr);
+    if (rval != LIBSM_OK) {
+        return rval;
+    }
+    if (inner.pos != inner.end) {
+        return LIBSM_FAIL_DECODING;
+    }
+    r->pos = inner.end;
+    return LIBSM_OK;
+}
+
+
+// a SEQUENCE member whose type is selected by another member, e.g. MessageFrame.value
+static libsm_rval_e oer_put_open_type(oer_writer_t* w,
+                                      asn_TYPE_member_t const* elm,
+                                      void const* memb)
+{
+    unsigned const present = CHOICE_variant_get_presence(elm->type, memb);
+    if (present == 0 || present > elm->type->elements_count) {
+        return LIBSM_FAIL_ENCODING;
+    }
+    asn_TYPE_member_t const* alt = &elm->type->elements[present - 1];
+    void const* value = oer_member(memb, alt);
+    if (value == NULL) {
+        return LIBSM_FAIL_ENCODING;
+    }
+    return oer_put_wrapped(w, alt->type, oer_member_constraints(alt), value);
+}
+
+
+static libsm_rval_e oer_get_open_type(oer_reader_t* r,
+                                      asn_TYPE_descriptor_t const* td,
+                                      void* sptr,
+                                      asn_TYPE_member_t const* elm,
+                                      void* memb)
+{
+    if (elm->type_selector == NULL) {
+        return LIBSM_FAIL_DECODING;
+    }
+    asn_type_selector_result_t const selected = elm->type_selector(td, sptr);
+    if (selected.presence_index == 0 || selected.presence_index > elm->type->elements_count
+        || CHOICE_variant_set_presence(elm->type, memb, selected.presence_index) != 0) {
+        return LIBSM_FAIL_DECODING;
+    }
+    asn_TYPE_member_t const* alt = &elm->type->elements[selected.presence_index - 1];
+    void* value;
+    libsm_rval_e const rval = oer_member_target(memb, alt, &value);
+    if (rval != LIBSM_OK) {
+        return rval;
+    }
+    return oer_get_wrapped(r, alt->type, oer_member_constraints(alt), value);
+}
+
+
+/*
+ * Constructed types, X.696 16 to 20
+ */
+
+static libsm_rval_e oer_put_sequence(oer_writer_t* w,
+                                     asn_TYPE_descriptor_t const* td,
+                                     void const* sptr)
+{
+    asn_SEQUENCE_specifics_t const* specs = td->specifics;
+    bool const extensible = specs->first_extension >= 0;
+    size_t const rootCount = extensible ? (size_t)specs->first_extension : td->elements_count;
+
+    bool extPresent = false;
+    for (size_t i = rootCount; i < td->elements_count; i++) {
+        extPresent |= oer_member(sptr, &td->elements[i]) != NULL;
+    }
+
+    // preamble: extension bit and presence of the optional root members
+    size_t bit = 0;
+    size_t const preambleBits = (extensible ? 1 : 0) + specs->roms_count;
+    size_t const preamblePos = w->pos;
+    if (w->size - w->pos < (preambleBits + 7) / 8) {
+        return LIBSM_FAIL_ENCODING_BUFF_SIZE;
+    }
+    memset(w->out + w->pos, 0, (preambleBits + 7) / 8);
+    w->pos += (preambleBits + 7) / 8;
+    if (extensible) {
+        w->out[preamblePos] |= (uint8_t)(extPresent ? 0x80 : 0);
+        bit++;
+    }
+    for (size_t i = 0; i < rootCount; i++) {
+        asn_TYPE_member_t const* elm = &td->elements[i];
+        void const* memb = oer_member(sptr, elm);
+        if (elm->optional) {
+            if (bit >= preambleBits) {
+                return LIBSM_FAIL_ENCODING;
+            }
+            if (memb != NULL) {
+                w->out[preamblePos + bit / 8] |= (uint8_t)(0x80 >> (bit % 8));
+            }
+            bit++;
+        }
+    }
+
+    for (size_t i = 0; i < rootCount; i++) {
+        asn_TYPE_member_t const* elm = &td->elements[i];
+        void const* memb = oer_member(sptr, elm);
+        libsm_rval_e rval;
+        if (memb == NULL) {
+            if (elm->optional) {
+                continue;
+            }
+            return LIBSM_FAIL_ENCODING;
+        }
+        if (elm->flags & ATF_OPEN_TYPE) {
+            rval = oer_put_open_type(w, elm, memb);
+        } else {
+            rval = oer_put_value(w, elm->type, oer_member_constraints(elm), memb);
+        }
+        if (rval != LIBSM_OK) {
+            return rval;
+        }
+    }
+
+    if (!extPresent) {
+        return LIBSM_OK;
+    }
+    // extension additions: a presence bit string, then each present one as an open type
+    size_t const additions = td->elements_count - rootCount;
+    size_t const bitmapBytes = (additions + 7) / 8;
+    libsm_rval_e rval = oer_put_length(w, bitmapBytes + 1);
+    if (rval == LIBSM_OK) {
+        rval = oer_put_byte(w, (uint8_t)(bitmapBytes * 8 - additions));
+    }
+    if (rval == LIBSM_OK && w->size - w->pos < bitmapBytes) {
+        rval = LIBSM_FAIL_ENCODING_BUFF_SIZE;
+    }
+    if (rval != LIBSM_OK) {
+        return rval;
+    }
+    memset(w->out + w->pos, 0, bitmapBytes);
+    for (size_t i = 0; i < additions; i++) {
+        if (oer_member(sptr, &td->elements[rootCount + i]) != NULL) {
+            w->out[w->pos + i / 8] |= (uint8_t)(0x80 >> (i % 8));
+        }
+    }
+    w->pos += bitmapBytes;
+    for (size_t i = rootCount; i < td->elements_count; i++) {
+        asn_TYPE_member_t const* elm = &td->elements[i];
+        void const* memb = oer_member(sptr, elm);
+        if (memb == NULL) {
+            continue;
+        }
+        rval = oer_put_wrapped(w, elm->type, oer_member_constraints(elm), memb);
+        if (rval != LIBSM_OK) {
+            return rval;
+        }
+    }
+    return LIBSM_OK;
+}
+
+
+static libsm_rval_e oer_get_sequence(oer_reader_t* r, asn_TYPE_descriptor_t const* td, void* sptr)
+{
+    asn_SEQUENCE_specifics_t const* specs = td->specifics;
+    bool const extensible = specs->first_extension >= 0;
+    size_t const rootCount = extensible ? (size_t)specs->first_extension : td->elements_count;
+    size_t const preambleBits = (extensible ? 1 : 0) + specs->roms_count;
+
+    uint8_t const* preamble;
+    if (!oer_get_bytes(r, &preamble, (preambleBits + 7) / 8)) {
+        return LIBSM_FAIL_DECODING;
+    }
+    size_t bit = 0;
+    bool extPresent = false;
+    if (extensible) {
+        extPresent = preamble[0] & 0x80;
+        bit++;
+    }
+
+    for (size_t i = 0; i < rootCount; i++) {
+        asn_TYPE_member_t const* elm = &td->elements[i];
+        if (elm->optional) {
+            if (bit >= preambleBits) {
+                return LIBSM_FAIL_DECODING;
+            }
+            bool const present = preamble[bit / 8] & (0x80 >> (bit % 8));
+            bit++;
+            if (!present) {
+                continue;
+            }
+        }
+        void* memb;
+        libsm_rval_e rval = oer_member_target(sptr, elm, &memb);
+        if (rval != LIBSM_OK) {
+            return rval;
+        }
+        if (elm->flags & ATF_OPEN_TYPE) {
+            rval = oer_get_open_type(r, td, sptr, elm, memb);
+        } else {
+            rval = oer_get_value(r, elm->type, oer_member_constraints(elm), memb);
+        }
+        if (rval != LIBSM_OK) {
+            return rval;
+        }
+    }
+
+    if (!extPresent) {
+        return LIBSM_OK;
+    }
+    size_t length;
+    uint8_t const* bitmap;
+    if (!oer_get_length(r, &length) || length < 2 || !oer_get_bytes(r, &bitmap, length)
+        || bitmap[0] > 7) {
+        return LIBSM_FAIL_DECODING;
+    }
+    size_t const bitCount = (length - 1) * 8 - bitmap[0];
+    for (size_t i = 0; i < bitCount; i++) {
+        if (!(bitmap[1 + i / 8] & (0x80 >> (i % 8)))) {
+            continue;
+        }
+        libsm_rval_e rval;
+        if (rootCount + i < td->elements_count) {
+            asn_TYPE_member_t const* elm = &td->elements[rootCount + i];
+            void* memb;
+            rval = oer_member_target(sptr, elm, &memb);
+            if (rval == LIBSM_OK) {
+                rval = oer_get_wrapped(r, elm->type, oer_member_constraints(elm), memb);
+            }
+        } else {
+            // an addition from a later version of the type
+            size_t skip;
+            rval = oer_get_length(r, &skip) ? LIBSM_OK : LIBSM_FAIL_DECODING;
+            r->pos += rval == LIBSM_OK ? skip : 0;
+        }
+        if (rval != LIBSM_OK) {
+            return rval;
+        }
+    }
+    return LIBSM_OK;
+}
+
+
+static libsm_rval_e oer_put_sequence_of(oer_writer_t* w,
+                                        asn_TYPE_descriptor_t const* td,
+                                        void const* sptr)
+{
+    asn_anonymous_sequence_ const* list = sptr;
+    asn_TYPE_member_t const* elm = &td->elements[0];
+    if (list->count < 0) {
+        return LIBSM_FAIL_ENCODING;
+    }
+    // quantity: the number of octets, then the count
+    unsigned const n = oer_uint_bytes((uint64_t)list->count);
+    libsm_rval_e rval = oer_put_byte(w, (uint8_t)n);
+    if (rval == LIBSM_OK) {
+        rval = oer_put_uint(w, (uint64_t)list->count, n);
+    }
+    for (int i = 0; rval == LIBSM_OK && i < list->count; i++) {
+        if (list->array[i] == NULL) {
+            return LIBSM_FAIL_ENCODING;
+        }
+        rval = oer_put_value(w, elm->type, oer_member_constraints(elm), list->array[i]);
+    }
+    return rval;
+}
+
+
+static libsm_rval_e oer_get_sequence_of(oer_reader_t* r,
+                                        asn_TYPE_descriptor_t const* td,
+                                        void* sptr)
+{
+    asn_anonymous_sequence_* list = sptr;
+    asn_TYPE_member_t const* elm = &td->elements[0];
+    uint8_t const* n;
+    uint64_t count;
+    if (!oer_get_bytes(r, &n, 1) || *n == 0 || *n > 4 || !oer_get_uint(r, &count, *n)) {
+        return LIBSM_FAIL_DECODING;
+    }
+    // every element takes at least an octet, so a bad count cannot allocate much
+    size_t const size = oer_struct_size(elm->type);
+    if (count > r->end - r->pos || count > INT32_MAX || size == 0) {
+        return LIBSM_FAIL_DECODING;
+    }
+    for (uint64_t i = 0; i < count; i++) {
+        void* item = calloc(1, size);
+        if (item == NULL) {
+            return LIBSM_ALLOC_ERR;
+        }
+        if (asn_sequence_add(list, item) != 0) {
+            free(item);
+            return LIBSM_ALLOC_ERR;
+        }
+        libsm_rval_e const rval = oer_get_value(r, elm->type, oer_member_constraints(elm), item);
+        if (rval != LIBSM_OK) {
+            return rval;
+        }
+    }
+    return LIBSM_OK;
+}
+
+
+// X.696 8.7 tag of the chosen alternative: class, then the number in 6 bits or base 128
+static libsm_rval_e oer_put_tag(oer_writer_t* w, ber_tlv_tag_t tag)
+{
+    uint8_t const tagClass = (uint8_t)((tag & 0x3) << 6);
+    ber_tlv_tag_t const number = tag >> 2;
+    if (number < 63) {
+        return oer_put_byte(w, tagClass | (uint8_t)number);
+    }
+    uint8_t bytes[1 + sizeof(number) * 8 / 7 + 1];
+    size_t n = sizeof(bytes);
+    ber_tlv_tag_t rest = number;
+    bytes[--n] = rest & 0x7F;
+    while ((rest >>= 7) != 0) {
+        bytes[--n] = 0x80 | (rest & 0x7F);
+    }
+    bytes[--n] = tagClass | 0x3F;
+    return oer_put_bytes(w, bytes + n, sizeof(bytes) - n);
+}
+
+
+static bool oer_get_tag(oer_reader_t* r, ber_tlv_tag_t* tag)
+{
+    uint8_t const* byte;
+    if (!oer_get_bytes(r, &byte, 1)) {
+        return false;
+    }
+    ber_tlv_tag_t const tagClass = *byte >> 6;
+    ber_tlv_tag_t number = *byte & 0x3F;
+    if (number == 0x3F) {
+        number = 0;
+        do {
+            if (number >> 21 || !oer_get_bytes(r, &byte, 1)) {
+                return false;
+            }
+            number = (number << 7) | (*byte & 0x7F);
+        } while (*byte & 0x80);
+    }
+    *tag = (number << 2) | tagClass;
+    return true;
+}
+
+
+static libsm_rval_e oer_put_choice(oer_writer_t* w,
+                                   asn_TYPE_descriptor_t const* td,
+                                   void const* sptr)
+{
+    asn_CHOICE_specifics_t const* specs = td->specifics;
+    unsigned const present = CHOICE_variant_get_presence(td, sptr);
+    if (present == 0 || present > td->elements_count) {
+        return LIBSM_FAIL_ENCODING;
+    }
+    asn_TYPE_member_t const* elm = &td->elements[present - 1];
+    void const* memb = oer_member(sptr, elm);
+    if (memb == NULL) {
+        return LIBSM_FAIL_ENCODING;
+    }
+    libsm_rval_e const rval = oer_put_tag(w, elm->tag);
+    if (rval != LIBSM_OK) {
+        return rval;
+    }
+    if (specs->ext_start >= 0 && present - 1 >= (unsigned)specs->ext_start) {
+        return oer_put_wrapped(w, elm->type, oer_member_constraints(elm), memb);
+    }
+    return oer_put_value(w, elm->type, oer_member_constraints(elm), memb);
+}
+
+
+static libsm_rval_e oer_get_choice(oer_reader_t* r, asn_TYPE_descriptor_t const* td, void* sptr)
+{
+    asn_CHOICE_specifics_t const* specs = td->specifics;
+    ber_tlv_tag_t tag;
+    if (!oer_get_tag(r, &tag)) {
+        return LIBSM_FAIL_DECODING;
+    }
+    unsigned present = 0;
+    for (unsigned i = 0; i < td->elements_count && present == 0; i++) {
+        present = td->elements[i].tag == tag ? i + 1 : 0;
+    }
+    if (present == 0 || CHOICE_variant_set_presence(td, sptr, present) != 0) {
+        return LIBSM_FAIL_DECODING;
+    }
+    asn_TYPE_member_t const* elm = &td->elements[present - 1];
+    void* memb;
+    libsm_rval_e const rval = oer_member_target(sptr, elm, &memb);
+    if (rval != LIBSM_OK) {
+        return rval;
+    }
+    if (specs->ext_start >= 0 && present - 1 >= (unsigned)specs->ext_start) {
+        return oer_get_wrapped(r, elm->type, oer_member_constraints(elm), memb);
+    }
+    return oer_get_value(r, elm->type, oer_member_constraints(elm), memb);
+}
+
+
+/*
+ * Any type
+ */
+
+static libsm_rval_e oer_put_value(oer_writer_t* w,
+                                  asn_TYPE_descriptor_t const* td,
+                                  asn_per_constraints_t const* constraints,
+                                  void const* sptr)
+{
+    asn_TYPE_operation_t const* op = td->op;
+    if (constraints == NULL) {
+        constraints = td->encoding_constraints.per_constraints;
+    }
+    if (op == &asn_OP_SEQUENCE) {
+        return oer_put_sequence(w, td, sptr);
+    }
+    if (op == &asn_OP_NativeInteger) {
+        return oer_put_integer(w, constraints, *(long const*)sptr);
+    }
+    if (op == &asn_OP_NativeEnumerated) {
+        return oer_put_enumerated(w, *(long const*)sptr);
+    }
+    if (op == &asn_OP_SEQUENCE_OF) {
+        return oer_put_sequence_of(w, td, sptr);
+    }
+    if (op == &asn_OP_CHOICE) {
+        return oer_put_choice(w, td, sptr);
+    }
+    if (op == &asn_OP_BIT_STRING) {
+        return oer_put_bit_string(w, constraints, sptr);
+    }
+    if (op == &asn_OP_OCTET_STRING || op == &asn_OP_IA5String) {
+        return oer_put_octet_string(w, constraints, sptr);
+    }
+    if (op == &asn_OP_BOOLEAN) {
+        return oer_put_byte(w, *(BOOLEAN_t const*)sptr ? 0xFF : 0x00);
+    }
+    return LIBSM_FAIL_ENCODING;
+}
+
+
+static libsm_rval_e oer_get_value(oer_reader_t* r,
+                                  asn_TYPE_descriptor_t const* td,
+                                  asn_per_constraints_t const* constraints,
+                                  void* sptr)
+{
+    asn_TYPE_operation_t const* op = td->op;
+    if (constraints == NULL) {
+        constraints = td->encoding_constraints.per_constraints;
+    }
+    if (op == &asn_OP_SEQUENCE) {
+        return oer_get_sequence(r, td, sptr);
+    }
+    if (op == &asn_OP_NativeInteger) {
+        return oer_get_integer(r, constraints, sptr) ? LIBSM_OK : LIBSM_FAIL_DECODING;
+    }
+    if (op == &asn_OP_NativeEnumerated) {
+        return oer_get_enumerated(r, sptr) ? LIBSM_OK : LIBSM_FAIL_DECODING;
+    }
+    if (op == &asn_OP_SEQUENCE_OF) {
+        return oer_get_sequence_of(r, td, sptr);
+    }
+    if (op == &asn_OP_CHOICE) {
+        return oer_get_choice(r, td, sptr);
+    }
+    if (op == &asn_OP_BIT_STRING) {
+        return oer_get_bit_string(r, constraints, sptr);
+    }
+    if (op == &asn_OP_OCTET_STRING || op == &asn_OP_IA5String) {
+        return oer_get_octet_string(r, constraints, sptr);
+    }
+    if (op == &asn_OP_BOOLEAN) {
+        uint8_t const* byte;
+        if (!oer_get_bytes(r, &byte, 1)) {
+            return LIBSM_FAIL_DECODING;
+        }
+        *(BOOLEAN_t*)sptr = *byte != 0;
+        return LIBSM_OK;
+    }
+    return LIBSM_FAIL_DECODING;
+}
+
+
+/*
+ * API
+ */
+
+libsm_rval_e libsm_encode_messageframe_oer(MessageFrame_t const* mf, uint8_t* encoded, size_t* len)
+{
+    if (mf == NULL || encoded == NULL || len == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    oer_writer_t w = { encoded, *len, 0 };
+    libsm_rval_e const rval = oer_put_value(&w, &asn_DEF_MessageFrame, NULL, mf);
+    if (rval == LIBSM_OK) {
+        *len = w.pos;
+    }
+    return rval;
+}
+
+
+libsm_rval_e libsm_decode_messageframe_oer(uint8_t const* encoded, size_t len, MessageFrame_t* mf)
+{
+    if (encoded == NULL || mf == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (len == 0) {
+        return LIBSM_FAIL_DECODING_BUFF_SIZE;
+    }
+    oer_reader_t r = { encoded, len, 0 };
+    return oer_get_value(&r, &asn_DEF_MessageFrame, NULL, mf);
+}
+
+
+libsm_rval_e libsm_transcode_uper_to_oer(uint8_t const* uper,
+                                         size_t uperLen,
+                                         uint8_t* oer,
+                                         size_t* oerLen)
+{
+    if (uper == NULL || oer == NULL || oerLen == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    MessageFrame_t mf = { 0 };
+    libsm_rval_e rval = libsm_decode_messageframe(uper, uperLen, &mf);
+    if (rval == LIBSM_OK) {
+        rval = libsm_encode_messageframe_oer(&mf, oer, oerLen);
+    }
+    ASN_STRUCT_RESET(asn_DEF_MessageFrame, &mf);
+    return rval;
+}
+
+
+libsm_rval_e libsm_transcode_oer_to_uper(uint8_t const* oer,
+                                         size_t oerLen,
+                                         uint8_t* uper,
+                                         size_t* uperLen)
+{
+    if (oer == NULL || uper == NULL || uperLen == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    MessageFrame_t mf = { 0 };
+    libsm_rval_e rval = libsm_decode_messageframe_oer(oer, oerLen, &mf);
+    if (rval == LIBSM_OK) {
+        rval = libsm_encode_messageframe(&mf, uper, uperLen);
+    }
+    ASN_STRUCT_RESET(asn_DEF_MessageFrame, &mf);
+    return rval;
+}
+
+
+libsm_rval_e libsm_transcode_uper_to_oer_archive(uint8_t const* const* messages,
+                                                 size_t const* lens,
+                                                 size_t count,
+                                                 uint8_t* archive,
+                                                 size_t* len,
+                                                 size_t* done)
+{
+    if (messages == NULL || lens == NULL || archive == NULL || len == NULL || done == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    oer_writer_t w = { archive, *len, 0 };
+    libsm_rval_e rval = LIBSM_OK;
+    *done = 0;
+    for (size_t i = 0; i < count && rval == LIBSM_OK; i++) {
+        MessageFrame_t mf = { 0 };
+        rval = messages[i] == NULL ? LIBSM_FAIL_NULL_ARG
+                                   : libsm_decode_messageframe(messages[i], lens[i], &mf);
+        size_t const start = w.pos;
+        if (rval == LIBSM_OK) {
+            rval = oer_put_wrapped(&w, &asn_DEF_MessageFrame, NULL, &mf);
+        }
+        ASN_STRUCT_RESET(asn_DEF_MessageFrame, &mf);
+        if (rval == LIBSM_OK) {
+            (*done)++;
+        } else {
+            w.pos = start;
+        }
+    }
+    *len = w.pos;
+    return rval;
+}
+
+
+libsm_rval_e libsm_oer_archive_next(uint8_t const* archive,
+                                    size_t len,
+                                    size_t* offset,
+                                    MessageFrame_t* mf)
+{
+    if (archive == NULL || offset == NULL || mf == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (*offset >= len) {
+        return LIBSM_FAIL_DECODING_BUFF_SIZE;
+    }
+    oer_reader_t r = { archive, len, *offset };
+    libsm_rval_e const rval = oer_get_wrapped(&r, &asn_DEF_MessageFrame, NULL, mf);
+    if (rval == LIBSM_OK) {
+        *offset = r.pos;
+    }
+    return rval;
+}
@@ -0,0 +1,136 @@
+/**
+ * @brief BASIC-OER (X.696) codec for MessageFrames, and an OER archive format
+ *
+ * UPER is what goes over the air, but its bit packing makes it slow to decode
+ * for archives and IPC. OER keeps every field on octet boundaries: constrained
+ * integers are fixed width, and everything else is length prefixed.
+ *
+ * The generated j2735 code is built with -no-gen-OER, so this codec walks the
+ * asn1c type descriptors. The OER visible bounds of each type are the non
+ * extensible value and size constraints, which are read from the PER
+ * constraints asn1c generates for the same ASN.1.
+ *
+ * An archive is a sequence of OER MessageFrames, each one prefixed with an OER
+ * length determinant, like an OER open type.
+ */
+
+#ifndef LIBSM_OER_H
+#define LIBSM_OER_H
+
+#include "MessageFrame.h"
+#include "libsm-error.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/**
+ * @brief Encode a MessageFrame as BASIC-OER
+ *
+ * @param mf The message
+ * @param encoded Output buffer
+ * @param len In the size of encoded, out the number of bytes encoded
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG An argument was NULL
+ * @retval LIBSM_FAIL_ENCODING_BUFF_SIZE encoded is too small
+ * @retval LIBSM_FAIL_CONSTRAINT A value does not fit its constraint
+ * @retval LIBSM_FAIL_ENCODING mf is incomplete or has a type OER does not support here
+ */
+libsm_rval_e libsm_encode_messageframe_oer(MessageFrame_t const* mf, uint8_t* encoded, size_t* len);
+
+
+/**
+ * @brief Decode a BASIC-OER MessageFrame
+ *
+ * @param encoded OER MessageFrame
+ * @param len Size of encoded
+ * @param mf Zeroed MessageFrame, free with ASN_STRUCT_FREE or ASN_STRUCT_RESET
+ *           whatever the result
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG An argument was NULL
+ * @retval LIBSM_FAIL_DECODING_BUFF_SIZE len is 0
+ * @retval LIBSM_FAIL_DECODING encoded is not a valid MessageFrame
+ * @retval LIBSM_ALLOC_ERR Allocation error
+ */
+libsm_rval_e libsm_decode_messageframe_oer(uint8_t const* encoded, size_t len, MessageFrame_t* mf);
+
+
+/**
+ * @brief Transcode a UPER MessageFrame to OER
+ *
+ * @param uper UPER MessageFrame
+ * @param uperLen Size of uper
+ * @param oer Output buffer
+ * @param oerLen In the size of oer, out the number of bytes encoded
+ *
+ * @return The result of libsm_decode_messageframe or libsm_encode_messageframe_oer
+ */
+libsm_rval_e libsm_transcode_uper_to_oer(uint8_t const* uper,
+                                         size_t uperLen,
+                                         uint8_t* oer,
+                                         size_t* oerLen);
+
+
+/**
+ * @brief Transcode an OER MessageFrame to UPER
+ *
+ * @param oer OER MessageFrame
+ * @param oerLen Size of oer
+ * @param uper Output buffer
+ * @param uperLen In the size of uper, out the number of bytes encoded
+ *
+ * @return The result of libsm_decode_messageframe_oer or libsm_encode_messageframe
+ */
+libsm_rval_e libsm_transcode_oer_to_uper(uint8_t const* oer,
+                                         size_t oerLen,
+                                         uint8_t* uper,
+                                         size_t* uperLen);
+
+
+/**
+ * @brief Transcode UPER MessageFrames into an OER archive
+ *
+ * @param messages UPER MessageFrames
+ * @param lens Size of each message
+ * @param count Number of messages
+ * @param archive Output buffer
+ * @param len In the size of archive, out the number of bytes used
+ * @param done Out the number of messages transcoded, which is the index of the
+ *             failing message unless LIBSM_OK is returned
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG An argument was NULL
+ * @return Otherwise the result of the failing message, as libsm_transcode_uper_to_oer
+ */
+libsm_rval_e libsm_transcode_uper_to_oer_archive(uint8_t const* const* messages,
+                                                 size_t const* lens,
+                                                 size_t count,
+                                                 uint8_t* archive,
+                                                 size_t* len,
+                                                 size_t* done);
+
+
+/**
+ * @brief Decode the next MessageFrame of an OER archive
+ *
+ * @param archive The archive
+ * @param len Size of archive
+ * @param offset In the offset of the record to decode, out the offset of the next one
+ * @param mf Zeroed MessageFrame, free with ASN_STRUCT_FREE or ASN_STRUCT_RESET
+ *           whatever the result
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG An argument was NULL
+ * @retval LIBSM_FAIL_DECODING_BUFF_SIZE No record left at offset
+ * @retval LIBSM_FAIL_DECODING The record is not a valid MessageFrame
+ * @retval LIBSM_ALLOC_ERR Allocation error
+ */
+libsm_rval_e libsm_oer_archive_next(uint8_t const* archive,
+                                    size_t len,
+                                    size_t* offset,
+                                    MessageFrame_t* mf);
+
+
+#endif // LIBSM_OER_H
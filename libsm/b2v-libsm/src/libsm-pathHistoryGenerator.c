@@ -0,0 +1,260 @@
+/**
+ * @brief Incremental J2945/1 concise path history generator
+ */
+
+#include "libsm-pathHistoryGenerator.h"
+#include "j2735-defines.h"
+#include "j2945-defines.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+
+#define PH_RING_MASK      (LIBSM_PH_GEN_RING_SIZE - 1)
+#define PH_LONG_WRAP      3600000000LL
+
+
+static int64_t ph_long_diff(Longitude_t to, Longitude_t from)
+{
+    int64_t diff = (int64_t)to - (int64_t)from;
+    if (diff > PH_LONG_WRAP / 2) {
+        diff -= PH_LONG_WRAP;
+    } else if (diff < -PH_LONG_WRAP / 2) {
+        diff += PH_LONG_WRAP;
+    }
+    return diff;
+}
+
+
+// path histories are short enough that one projection scale does for all of it
+static double ph_distance(libsm_ph_fix_t const* a, libsm_ph_fix_t const* b, double metersPerLong)
+{
+    double const dy = (double)(b->lat - a->lat) * Latitude_m_per_unit;
+    double const dx = (double)ph_long_diff(b->Long, a->Long) * metersPerLong;
+    return hypot(dx, dy);
+}
+
+
+static void ph_set_anchor(libsm_ph_gen_t* gen, libsm_ph_fix_t const* fix)
+{
+    gen->anchor = *fix;
+    gen->ring[gen->ringHead & PH_RING_MASK] = *fix;
+    gen->ringHead++;
+    if (gen->ringCount < LIBSM_PH_GEN_RING_SIZE) {
+        gen->ringCount++;
+    }
+
+    gen->metersPerLat = Latitude_m_per_unit;
+    gen->metersPerLong = Latitude_m_per_unit
+                         * cos((double)fix->lat / Latitude_unit_deg * (M_PI / 180.0));
+    gen->coneValid = false;
+}
+
+
+// Narrow the cone with a fix, returns false if the fix is outside the cone
+static bool ph_cone_accept(libsm_ph_gen_t* gen, libsm_ph_fix_t const* fix)
+{
+    double const dy = (double)(fix->lat - gen->anchor.lat) * gen->metersPerLat;
+    double const dx = (double)ph_long_diff(fix->Long, gen->anchor.Long) * gen->metersPerLong;
+    double const r = hypot(dx, dy);
+
+    // anything this close to the anchor is within the error of every chord
+    if (r <= gen->perpendicularDist) {
+        return true;
+    }
+    // the chord would get too long to be useful
+    if (r > gen->maxDistance) {
+        return false;
+    }
+
+    double const theta = atan2(dy, dx);
+    double const halfWidth = asin(gen->perpendicularDist / r);
+
+    if (!gen->coneValid) {
+        gen->coneReference = theta;
+        gen->coneLow = -halfWidth;
+        gen->coneHigh = halfWidth;
+        gen->coneValid = true;
+        return true;
+    }
+
+    double relative = theta - gen->coneReference;
+    if (relative > M_PI) {
+        relative -= 2.0 * M_PI;
+    } else if (relative < -M_PI) {
+        relative += 2.0 * M_PI;
+    }
+
+    if (relative < gen->coneLow || relative > gen->coneHigh) {
+        return false;
+    }
+    gen->coneLow = fmax(gen->coneLow, relative - halfWidth);
+    gen->coneHigh = fmin(gen->coneHigh, relative + halfWidth);
+    return true;
+}
+
+
+libsm_rval_e libsm_ph_gen_init(libsm_ph_gen_t* gen)
+{
+    if (gen == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    *gen = (libsm_ph_gen_t){ 0 };
+    gen->perpendicularDist = vruPathPerpendicularDist;
+    gen->minDistance = vruMinPHistDistance;
+    gen->maxDistance = vruMaxPHistDistance;
+    gen->maxPoints = vruMaxPHistPoints;
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_ph_gen_add_fix(libsm_ph_gen_t* gen, libsm_ph_fix_t const* fix)
+{
+    if (gen == NULL || fix == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (fix->lat == Latitude_unavailable || fix->Long == Longitude_unavailable) {
+        return LIBSM_FAIL_CONSTRAINT;
+    }
+
+    if (!gen->hasLast) {
+        ph_set_anchor(gen, fix);
+        gen->last = *fix;
+        gen->hasLast = true;
+        return LIBSM_OK;
+    }
+    if (fix->timeMs < gen->last.timeMs) {
+        return LIBSM_FAIL_CONSTRAINT;
+    }
+
+    if (!ph_cone_accept(gen, fix)) {
+        // the previous fix was the last one the chord could reach, so it
+        // becomes a concise point and the new fix starts a fresh cone from it
+        if (gen->last.timeMs != gen->anchor.timeMs) {
+            ph_set_anchor(gen, &gen->last);
+        }
+        (void)ph_cone_accept(gen, fix);
+    }
+    gen->last = *fix;
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_ph_gen_fill_path_history(libsm_ph_gen_t const* gen, PathHistory_t* ph)
+{
+    if (gen == NULL || ph == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+
+    libsm_ph_fix_t const* selected[LIBSM_PH_GEN_RING_SIZE];
+    size_t maxPoints = gen->maxPoints;
+    size_t count = 0;
+    double covered = 0.0;
+    libsm_ph_fix_t const* previous = &gen->last;
+
+    if (maxPoints > LIBSM_PH_GEN_RING_SIZE) {
+        maxPoints = LIBSM_PH_GEN_RING_SIZE;
+    }
+
+    // newest to oldest, stopping once maxDistance has been covered
+    for (uint32_t i = 0; i < gen->ringCount && count < maxPoints && covered < gen->maxDistance;
+         i++) {
+        libsm_ph_fix_t const* point = &gen->ring[(gen->ringHead - 1 - i) & PH_RING_MASK];
+        uint64_t const timeOffset = (gen->last.timeMs - point->timeMs) / 10;
+        int64_t const latOffset = (int64_t)point->lat - (int64_t)gen->last.lat;
+        int64_t const lonOffset = ph_long_diff(point->Long, gen->last.Long);
+
+        if (timeOffset < TimeOffset_min) {
+            continue;
+        }
+        if (timeOffset > TimeOffset_max || latOffset < OffsetLL_B18_min
+            || latOffset > OffsetLL_B18_max || lonOffset < OffsetLL_B18_min
+            || lonOffset > OffsetLL_B18_max) {
+            break;
+        }
+        double const distance = ph_distance(previous, point, gen->metersPerLong);
+        if (distance < gen->minDistance) {
+            continue;
+        }
+        covered += distance;
+        previous = point;
+        selected[count++] = point;
+    }
+
+    if (count == 0) {
+        return LIBSM_FAIL_CONSTRAINT;
+    }
+
+    // reuse the points that are already there, add or remove the difference
+    while ((size_t)ph->crumbData.list.count < count) {
+        PathHistoryPoint_t* point = libsm_alloc_init_PathHistoryPoint();
+        if (point == NULL) {
+            return LIBSM_ALLOC_ERR;
+        }
+        if (ASN_SEQUENCE_ADD(&ph->crumbData.list, point)) {
+            ASN_STRUCT_FREE(asn_DEF_PathHistoryPoint, point);
+            return LIBSM_ALLOC_ERR;
+        }
+    }
+    while ((size_t)ph->crumbData.list.count > count) {
+        ph->crumbData.list.count--;
+        ASN_STRUCT_FREE(asn_DEF_PathHistoryPoint,
+                        ph->crumbData.list.array[ph->crumbData.list.count]);
+        ph->crumbData.list.array[ph->crumbData.list.count] = NULL;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        PathHistoryPoint_t* out = ph->crumbData.list.array[i];
+        libsm_ph_fix_t const* point = selected[i];
+
+        if (out->speed || out->posAccuracy || out->heading) {
+            ASN_STRUCT_RESET(asn_DEF_PathHistoryPoint, out);
+        }
+        out->latOffset = point->lat - gen->last.lat;
+        out->lonOffset = ph_long_diff(point->Long, gen->last.Long);
+        out->timeOffset = (gen->last.timeMs - point->timeMs) / 10;
+        if (point->elev == Elevation_unavailable || gen->last.elev == Elevation_unavailable) {
+            out->elevationOffset = VertOffset_B12_unavailable;
+        } else {
+            long const elevationOffset = point->elev - gen->last.elev;
+            out->elevationOffset = RANGE_COERCE(VertOffset_B12, elevationOffset);
+        }
+    }
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_ph_gen_fill_psm(libsm_ph_gen_t const* gen, PersonalSafetyMessage_t* psm)
+{
+    if (gen == NULL || psm == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (psm->pathHistory == NULL) {
+        libsm_rval_e err = libsm_init_psm_path_history(psm);
+        if (err != LIBSM_OK) {
+            return err;
+        }
+    }
+    return libsm_ph_gen_fill_path_history(gen, psm->pathHistory);
+}
+
+
+libsm_rval_e libsm_ph_gen_fill_bsm(libsm_ph_gen_t const* gen, BasicSafetyMessage_t* bsm)
+{
+    if (gen == NULL || bsm == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    VehicleSafetyExtensions_t* vse = libsm_get_partII_elem(
+            bsm,
+            BSMpartIIExtension__partII_Value_PR_VehicleSafetyExtensions);
+
+    if (vse == NULL || vse->pathHistory == NULL) {
+        libsm_rval_e err = libsm_init_bsm_path_history(bsm);
+        if (err != LIBSM_OK) {
+            return err;
+        }
+        vse = libsm_get_partII_elem(bsm,
+                                    BSMpartIIExtension__partII_Value_PR_VehicleSafetyExtensions);
+    }
+    return libsm_ph_gen_fill_path_history(gen, vse->pathHistory);
+}
@@ -0,0 +1,131 @@
+/**
+ * @brief Incremental J2945/1 concise path history generator
+ *
+ * Feed GNSS fixes in one at a time with libsm_ph_gen_add_fix, and fill a
+ * PathHistory with libsm_ph_gen_fill_path_history whenever a message is sent.
+ *
+ * Each fix costs O(1): instead of re-running the concise representation over a
+ * breadcrumb buffer, the generator keeps the cone of directions (as seen from the
+ * last concise point) that keep every skipped fix within perpendicularDist of the
+ * chord. When a new fix falls outside that cone, the previous fix is committed as
+ * a concise point. Committed points live in a fixed size ring.
+ *
+ * REFERENCES: J2945/1 2020-04 Section 6.3.6.16 and A.5, J2945/9 2017-03 6.3.5.12
+ */
+
+#ifndef LIBSM_PATH_HISTORY_GENERATOR_H
+#define LIBSM_PATH_HISTORY_GENERATOR_H
+
+#include "libsm-error.h"
+#include "libsm.h"
+#include <MessageFrame.h>
+
+#include <stdint.h>
+
+
+/**
+ * Number of concise points kept, must be a power of two and
+ * larger than the maximum number of points a PathHistory can hold.
+ */
+#define LIBSM_PH_GEN_RING_SIZE 32
+
+/** @brief A single GNSS fix, in J2735 units */
+typedef struct {
+    Latitude_t lat;          /**< @brief 1/10 microdegree */
+    Longitude_t Long;        /**< @brief 1/10 microdegree */
+    Common_Elevation_t elev; /**< @brief 10 cm, or Elevation_unavailable */
+    uint64_t timeMs;         /**< @brief any monotonic millisecond clock */
+} libsm_ph_fix_t;
+
+/** @brief State for one device's path history */
+typedef struct {
+    double perpendicularDist; /**< @brief allowed error in meters */
+    double minDistance;       /**< @brief least distance between emitted points in meters */
+    double maxDistance;       /**< @brief distance covered by the path history in meters */
+    size_t maxPoints;         /**< @brief maximum PathHistoryPoints emitted */
+
+    libsm_ph_fix_t ring[LIBSM_PH_GEN_RING_SIZE]; /**< @brief concise points */
+    uint32_t ringHead;                           /**< @brief index of next write */
+    uint32_t ringCount;                          /**< @brief valid points in ring */
+
+    libsm_ph_fix_t anchor; /**< @brief the last concise point */
+    libsm_ph_fix_t last;   /**< @brief the most recent fix */
+    bool hasLast;          /**< @brief at least one fix has been added */
+
+    double metersPerLat;   /**< @brief local projection scale at the anchor */
+    double metersPerLong;  /**< @brief local projection scale at the anchor */
+    bool coneValid;        /**< @brief false until a fix leaves the anchor */
+    double coneReference;  /**< @brief direction that coneLow/coneHigh are relative to */
+    double coneLow;        /**< @brief radians, relative to coneReference */
+    double coneHigh;       /**< @brief radians, relative to coneReference */
+} libsm_ph_gen_t;
+
+
+/**
+ * @brief Initialize a generator with the J2945/9 VRU parameters
+ *
+ * vruPathPerpendicularDist, vruMinPHistDistance, vruMaxPHistDistance and
+ * vruMaxPHistPoints.
+ * The parameters may be changed afterwards, before the first fix is added.
+ *
+ * @param gen The generator to initialize
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG gen was NULL
+ */
+libsm_rval_e libsm_ph_gen_init(libsm_ph_gen_t* gen);
+
+
+/**
+ * @brief Add a GNSS fix
+ *
+ * Fixes must be added in time order.
+ *
+ * @param gen The generator for this device
+ * @param fix The new fix
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG gen or fix was NULL
+ * @retval LIBSM_FAIL_CONSTRAINT The fix has an unavailable position, or went backwards in time
+ */
+libsm_rval_e libsm_ph_gen_add_fix(libsm_ph_gen_t* gen, libsm_ph_fix_t const* fix);
+
+
+/**
+ * @brief Write the current concise path history into a PathHistory
+ *
+ * Offsets are relative to the most recent fix, which should be the position
+ * in the message carrying the path history. Concise points closer than
+ * minDistance to the previous point emitted, or to the most recent fix, are
+ * skipped.
+ * The PathHistoryPoints already in crumbData are reused, so steady state
+ * calls do not allocate. initialPosition and currGNSSstatus are left alone.
+ *
+ * @param gen The generator for this device
+ * @param ph The PathHistory to fill
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG gen or ph was NULL
+ * @retval LIBSM_FAIL_CONSTRAINT There is not enough history yet for one point
+ * @retval LIBSM_ALLOC_ERR Allocation error
+ */
+libsm_rval_e libsm_ph_gen_fill_path_history(libsm_ph_gen_t const* gen, PathHistory_t* ph);
+
+
+/**
+ * @brief Fill the path history of a PSM, allocating it if needed
+ *
+ * @see libsm_ph_gen_fill_path_history
+ */
+libsm_rval_e libsm_ph_gen_fill_psm(libsm_ph_gen_t const* gen, PersonalSafetyMessage_t* psm);
+
+
+/**
+ * @brief Fill the path history of a BSM, allocating Part II if needed
+ *
+ * @see libsm_ph_gen_fill_path_history
+ */
+libsm_rval_e libsm_ph_gen_fill_bsm(libsm_ph_gen_t const* gen, BasicSafetyMessage_t* bsm);
+
+
+#endif // LIBSM_PATH_HISTORY_GENERATOR_H
@@ -0,0 +1,564 @@
+#include "libsm-pipeline.h"
+#include "libsm.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define CACHE_LINE 64
+
+// spins before yielding, and yields before sleeping, when there is nothing to do
+#define IDLE_SPINS 64
+#define IDLE_YIELDS 16
+#define IDLE_SLEEP_NS 50000
+
+
+typedef struct {
+    uint32_t count;
+    size_t used;
+    uint32_t offsets[LIBSM_PIPELINE_BATCH_MAX];
+    uint32_t lens[LIBSM_PIPELINE_BATCH_MAX];
+    uint8_t* data;
+} pipeline_batch_t;
+
+typedef struct {
+    atomic_size_t sequence;
+    pipeline_batch_t* batch;
+} ring_cell_t;
+
+// Bounded MPMC queue, Vyukov's: one compare and swap per push or pop
+typedef struct {
+    ring_cell_t* cells;
+    size_t mask;
+    _Alignas(CACHE_LINE) atomic_size_t head;
+    _Alignas(CACHE_LINE) atomic_size_t tail;
+} ring_t;
+
+typedef struct {
+    _Alignas(CACHE_LINE) ring_t inbox;
+    struct libsm_pipeline_state* state;
+    libsm_pipeline_t const* pipeline;
+    unsigned index;
+    pthread_t thread;
+    atomic_uint_fast64_t decoded;
+    atomic_uint_fast64_t failed;
+    atomic_uint_fast64_t dropped;
+    atomic_uint_fast64_t stolen;
+} worker_t;
+
+struct libsm_pipeline_state {
+    worker_t* workers;
+    unsigned workerCount;
+    ring_t freeBatches;
+    pipeline_batch_t* batches;
+    uint8_t* arena;
+
+    // owned by the receiving thread
+    pipeline_batch_t* current;
+    unsigned nextWorker;
+    atomic_uint_fast64_t submitted;
+    atomic_uint_fast64_t stalls;
+
+    atomic_uint_fast64_t inFlight;
+    atomic_bool stopping;
+    bool running;
+};
+
+
+static bool ring_init(ring_t* ring, size_t capacity)
+{
+    ring->cells = calloc(capacity, sizeof(ring_cell_t));
+    if (ring->cells == NULL) {
+        return false;
+    }
+    for (size_t i = 0; i < capacity; i++) {
+        atomic_init(&ring->cells[i].sequence, i);
+    }
+    ring->mask = capacity - 1;
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    return true;
+}
+
+
+static bool ring_push(ring_t* ring, pipeline_batch_t* batch)
+{
+    size_t pos = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    for (;;) {
+        ring_cell_t* cell = &ring->cells[pos & ring->mask];
+        size_t const sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        intptr_t const diff = (intptr_t)sequence - (intptr_t)pos;
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(
+                        &ring->head, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)) {
+                cell->batch = batch;
+                atomic_store_explicit(&cell->sequence, pos + 1, memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = atomic_load_explicit(&ring->head, memory_order_relaxed);
+        }
+    }
+}
+
+
+static pipeline_batch_t* ring_pop(ring_t* ring)
+{
+    size_t pos = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    for (;;) {
+        ring_cell_t* cell = &ring->cells[pos & ring->mask];
+        size_t const sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        intptr_t const diff = (intptr_t)sequence - (intptr_t)(pos + 1);
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(
+                        &ring->tail, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)) {
+                pipeline_batch_t* batch = cell->batch;
+                atomic_store_explicit(&cell->sequence, pos + ring->mask + 1, memory_order_release);
+                return batch;
+            }
+        } else if (diff < 0) {
+            return NULL;
+        } else {
+            pos = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+        }
+    }
+}
+
+
+static void idle(unsigned* rounds)
+{
+    if (*rounds < IDLE_SPINS) {
+        (*rounds)++;
+    } else if (*rounds < IDLE_SPINS + IDLE_YIELDS) {
+        (*rounds)++;
+        sched_yield();
+    } else {
+        struct timespec const pause = { 0, IDLE_SLEEP_NS };
+        nanosleep(&pause, NULL);
+    }
+}
+
+
+static void count(atomic_uint_fast64_t* counter)
+{
+    // only the owning thread writes, so no read-modify-write is needed
+    atomic_store_explicit(counter,
+                          atomic_load_explicit(counter, memory_order_relaxed) + 1,
+                          memory_order_relaxed);
+}
+
+
+static libsm_pipeline_sink_t const* find_sink(libsm_pipeline_t const* pipeline,
+                                              long messageId,
+                                              libsm_pipeline_sink_t* fallback)
+{
+    for (size_t i = 0; i < pipeline->sinkCount; i++) {
+        if (pipeline->sinks[i].messageId == messageId) {
+            return pipeline->sinks[i].sink != NULL ? &pipeline->sinks[i] : NULL;
+        }
+    }
+    if (pipeline->defaultSink == NULL) {
+        return NULL;
+    }
+    fallback->messageId = messageId;
+    fallback->sink = pipeline->defaultSink;
+    fallback->user = pipeline->defaultUser;
+    return fallback;
+}
+
+
+static void process(worker_t* worker, pipeline_batch_t const* batch)
+{
+    libsm_pipeline_t const* pipeline = worker->pipeline;
+    for (uint32_t i = 0; i < batch->count; i++) {
+        uint8_t const* encoded = batch->data + batch->offsets[i];
+        size_t const len = batch->lens[i];
+
+        // classify: MessageFrame starts with its extension bit and a 15 bit messageId
+        libsm_pipeline_sink_t fallback;
+        libsm_pipeline_sink_t const* sink = NULL;
+        if (len >= 2 && (encoded[0] & 0x80) == 0) {
+            long const messageId = ((long)(encoded[0] & 0x7F) << 8) | encoded[1];
+            sink = find_sink(pipeline, messageId, &fallback);
+            if (sink == NULL) {
+                count(&worker->dropped);
+                continue;
+            }
+        }
+
+        MessageFrame_t mf = { 0 };
+        libsm_rval_e const rval = libsm_decode_messageframe(encoded, len, &mf);
+        if (rval == LIBSM_OK && sink == NULL) {
+            // an extended header, classify the decoded frame
+            sink = find_sink(pipeline, mf.messageId, &fallback);
+        }
+        if (rval != LIBSM_OK) {
+            count(&worker->failed);
+            if (pipeline->errorSink != NULL) {
+                pipeline->errorSink(pipeline->errorUser, worker->index, encoded, len, rval);
+            }
+        } else if (sink == NULL) {
+            count(&worker->dropped);
+        } else {
+            sink->sink(sink->user, worker->index, &mf);
+            count(&worker->decoded);
+        }
+        ASN_STRUCT_RESET(asn_DEF_MessageFrame, &mf);
+    }
+}
+
+
+static void* work(void* arg)
+{
+    worker_t* worker = arg;
+    struct libsm_pipeline_state* state = worker->state;
+    unsigned rounds = 0;
+    for (;;) {
+        pipeline_batch_t* batch = ring_pop(&worker->inbox);
+        for (unsigned k = 1; batch == NULL && k < state->workerCount; k++) {
+            batch = ring_pop(&state->workers[(worker->index + k) % state->workerCount].inbox);
+            if (batch != NULL) {
+                count(&worker->stolen);
+            }
+        }
+        if (batch == NULL) {
+            if (atomic_load_explicit(&state->stopping, memory_order_acquire)) {
+                return NULL;
+            }
+            idle(&rounds);
+            continue;
+        }
+        rounds = 0;
+
+        process(worker, batch);
+        batch->count = 0;
+        batch->used = 0;
+        // there are as many free slots as batches, so this cannot fail
+        ring_push(&state->freeBatches, batch);
+        atomic_fetch_sub_explicit(&state->inFlight, 1, memory_order_release);
+    }
+}
+
+
+// Hand the current batch to the next worker with room in its ring
+static void hand_over(struct libsm_pipeline_state* state)
+{
+    pipeline_batch_t* batch = state->current;
+    if (batch == NULL || batch->count == 0) {
+        return;
+    }
+    state->current = NULL;
+    atomic_fetch_add_explicit(&state->inFlight, 1, memory_order_relaxed);
+    // every batch fits in some ring, but one may briefly look full while a worker pops it
+    for (unsigned rounds = 0;; idle(&rounds)) {
+        for (unsigned k = 0; k < state->workerCount; k++) {
+            unsigned const w = (state->nextWorker + k) % state->workerCount;
+            if (ring_push(&state->workers[w].inbox, batch)) {
+                state->nextWorker = (w + 1) % state->workerCount;
+                return;
+            }
+        }
+    }
+}
+
+
+static libsm_rval_e submit(libsm_pipeline_t* pipeline,
+                           uint8_t const* encoded,
+                           size_t len,
+                           bool wait)
+{
+    if (pipeline == NULL || encoded == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    struct libsm_pipeline_state* state = pipeline->state;
+    if (state == NULL || !state->running) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    if (len == 0 || len > pipeline->config.batchBytes) {
+        return LIBSM_FAIL_DECODING_BUFF_SIZE;
+    }
+
+    pipeline_batch_t* batch = state->current;
+    if (batch != NULL
+        && (batch->count == pipeline->config.batchSize
+            || batch->used + len > pipeline->config.batchBytes)) {
+        hand_over(state);
+        batch = NULL;
+    }
+    if (batch == NULL) {
+        batch = ring_pop(&state->freeBatches);
+        if (batch == NULL) {
+            count(&state->stalls);
+            if (!wait) {
+                return LIBSM_FAIL;
+            }
+            for (unsigned rounds = 0; batch == NULL; idle(&rounds)) {
+                batch = ring_pop(&state->freeBatches);
+            }
+        }
+        state->current = batch;
+    }
+
+    memcpy(batch->data + batch->used, encoded, len);
+    batch->offsets[batch->count] = (uint32_t)batch->used;
+    batch->lens[batch->count] = (uint32_t)len;
+    batch->used += len;
+    batch->count++;
+    count(&state->submitted);
+    if (batch->count == pipeline->config.batchSize) {
+        hand_over(state);
+    }
+    return LIBSM_OK;
+}
+
+
+static void stop(struct libsm_pipeline_state* state, unsigned started)
+{
+    atomic_store_explicit(&state->stopping, true, memory_order_release);
+    for (unsigned w = 0; w < started; w++) {
+        pthread_join(state->workers[w].thread, NULL);
+    }
+    state->running = false;
+}
+
+
+libsm_rval_e libsm_pipeline_default_config(libsm_pipeline_config_t* config)
+{
+    if (config == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    config->workers = 0;
+    config->batchSize = 64;
+    config->batchBytes = 64 * 1024;
+    config->batchesPerWorker = 8;
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_pipeline_init(libsm_pipeline_t* pipeline, libsm_pipeline_config_t const* config)
+{
+    if (pipeline == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    memset(pipeline, 0, sizeof(*pipeline));
+    if (config != NULL) {
+        pipeline->config = *config;
+    } else {
+        libsm_pipeline_default_config(&pipeline->config);
+    }
+    libsm_pipeline_config_t* c = &pipeline->config;
+    if (c->workers == 0) {
+        long const cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        c->workers = cpus > 0 ? (unsigned)cpus : 1;
+    }
+    if (c->batchSize < 1 || c->batchSize > LIBSM_PIPELINE_BATCH_MAX || c->batchBytes < 1
+        || c->batchBytes > UINT32_MAX || c->batchesPerWorker < 1
+        || (c->batchesPerWorker & (c->batchesPerWorker - 1)) != 0) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+
+    struct libsm_pipeline_state* state = calloc(1, sizeof(*state));
+    if (state == NULL) {
+        return LIBSM_ALLOC_ERR;
+    }
+    pipeline->state = state;
+    size_t const batchCount = (size_t)c->workers * c->batchesPerWorker;
+    size_t freeCapacity = 1;
+    while (freeCapacity < batchCount) {
+        freeCapacity <<= 1;
+    }
+    state->workerCount = c->workers;
+    state->workers = aligned_alloc(CACHE_LINE,
+                                   (c->workers * sizeof(worker_t) + CACHE_LINE - 1)
+                                           / CACHE_LINE * CACHE_LINE);
+    if (state->workers != NULL) {
+        memset(state->workers, 0, c->workers * sizeof(worker_t));
+    }
+    state->batches = calloc(batchCount, sizeof(pipeline_batch_t));
+    state->arena = malloc(batchCount * c->batchBytes);
+    if (state->workers == NULL || state->batches == NULL || state->arena == NULL
+        || !ring_init(&state->freeBatches, freeCapacity)) {
+        libsm_pipeline_free(pipeline);
+        return LIBSM_ALLOC_ERR;
+    }
+    for (unsigned w = 0; w < c->workers; w++) {
+        worker_t* worker = &state->workers[w];
+        worker->state = state;
+        worker->pipeline = pipeline;
+        worker->index = w;
+        if (!ring_init(&worker->inbox, c->batchesPerWorker)) {
+            libsm_pipeline_free(pipeline);
+            return LIBSM_ALLOC_ERR;
+        }
+    }
+    for (size_t b = 0; b < batchCount; b++) {
+        state->batches[b].data = state->arena + b * c->batchBytes;
+        ring_push(&state->freeBatches, &state->batches[b]);
+    }
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_pipeline_set_sink(libsm_pipeline_t* pipeline,
+                                     long messageId,
+                                     libsm_pipeline_sink_f sink,
+                                     void* user)
+{
+    if (pipeline == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (pipeline->state == NULL || pipeline->state->running) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    if (messageId < 0) {
+        pipeline->defaultSink = sink;
+        pipeline->defaultUser = user;
+        return LIBSM_OK;
+    }
+    size_t i = 0;
+    while (i < pipeline->sinkCount && pipeline->sinks[i].messageId != messageId) {
+        i++;
+    }
+    if (i == LIBSM_PIPELINE_SINKS_MAX) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    pipeline->sinks[i].messageId = messageId;
+    pipeline->sinks[i].sink = sink;
+    pipeline->sinks[i].user = user;
+    if (i == pipeline->sinkCount) {
+        pipeline->sinkCount++;
+    }
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_pipeline_set_error_sink(libsm_pipeline_t* pipeline,
+                                           libsm_pipeline_error_f errorSink,
+                                           void* user)
+{
+    if (pipeline == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (pipeline->state == NULL || pipeline->state->running) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    pipeline->errorSink = errorSink;
+    pipeline->errorUser = user;
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_pipeline_start(libsm_pipeline_t* pipeline)
+{
+    if (pipeline == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    struct libsm_pipeline_state* state = pipeline->state;
+    if (state == NULL || state->running) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    atomic_store_explicit(&state->stopping, false, memory_order_relaxed);
+    state->running = true;
+    for (unsigned w = 0; w < state->workerCount; w++) {
+        if (pthread_create(&state->workers[w].thread, NULL, work, &state->workers[w]) != 0) {
+            stop(state, w);
+            return LIBSM_FAIL;
+        }
+    }
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_pipeline_submit(libsm_pipeline_t* pipeline, uint8_t const* encoded, size_t len)
+{
+    return submit(pipeline, encoded, len, true);
+}
+
+
+libsm_rval_e libsm_pipeline_try_submit(libsm_pipeline_t* pipeline,
+                                       uint8_t const* encoded,
+                                       size_t len)
+{
+    return submit(pipeline, encoded, len, false);
+}
+
+
+libsm_rval_e libsm_pipeline_flush(libsm_pipeline_t* pipeline)
+{
+    if (pipeline == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (pipeline->state == NULL || !pipeline->state->running) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    hand_over(pipeline->state);
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_pipeline_drain(libsm_pipeline_t* pipeline)
+{
+    libsm_rval_e const rval = libsm_pipeline_flush(pipeline);
+    if (rval != LIBSM_OK) {
+        return rval;
+    }
+    for (unsigned rounds = 0;
+         atomic_load_explicit(&pipeline->state->inFlight, memory_order_acquire) != 0;
+         idle(&rounds)) {
+    }
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_pipeline_stats(libsm_pipeline_t const* pipeline, libsm_pipeline_stats_t* stats)
+{
+    if (pipeline == NULL || stats == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    memset(stats, 0, sizeof(*stats));
+    struct libsm_pipeline_state* state = pipeline->state;
+    if (state == NULL) {
+        return LIBSM_OK;
+    }
+    stats->submitted = atomic_load_explicit(&state->submitted, memory_order_relaxed);
+    stats->stalls = atomic_load_explicit(&state->stalls, memory_order_relaxed);
+    for (unsigned w = 0; w < state->workerCount; w++) {
+        worker_t* worker = &state->workers[w];
+        stats->decoded += atomic_load_explicit(&worker->decoded, memory_order_relaxed);
+        stats->failed += atomic_load_explicit(&worker->failed, memory_order_relaxed);
+        stats->dropped += atomic_load_explicit(&worker->dropped, memory_order_relaxed);
+        stats->stolen += atomic_load_explicit(&worker->stolen, memory_order_relaxed);
+    }
+    return LIBSM_OK;
+}
+
+
+void libsm_pipeline_free(libsm_pipeline_t* pipeline)
+{
+    if (pipeline == NULL || pipeline->state == NULL) {
+        return;
+    }
+    struct libsm_pipeline_state* state = pipeline->state;
+    if (state->running) {
+        libsm_pipeline_drain(pipeline);
+        stop(state, state->workerCount);
+    }
+    if (state->workers != NULL) {
+        for (unsigned w = 0; w < state->workerCount; w++) {
+            free(state->workers[w].inbox.cells);
+        }
+    }
+    free(state->workers);
+    free(state->freeBatches.cells);
+    free(state->batches);
+    free(state->arena);
+    free(state);
+    pipeline->state = NULL;
+}
@@ -0,0 +1,223 @@
+/**
+ * @brief Staged ingest pipeline: receive, classify, decode and sink UPER MessageFrames
+ *
+ * The receiving thread hands frames to libsm_pipeline_submit, which copies them
+ * into batches of up to batchSize frames. A full batch goes to the ring of one
+ * worker, round robin. Workers take batches from their own ring, and steal from
+ * the rings of the others when theirs is empty. For each frame a worker reads
+ * the messageId from the UPER header, skips the frame if no sink wants that
+ * type, and otherwise decodes it and calls the sink. Processed batches go back
+ * to the receiving thread through a ring of free batches.
+ *
+ * The rings are bounded, lock-free MPMC queues. The only synchronisation is one
+ * ring operation per batch, not per frame. There are workers * batchesPerWorker
+ * batches. When all of them are in flight the receiving thread is throttled:
+ * libsm_pipeline_submit waits, libsm_pipeline_try_submit refuses the frame.
+ *
+ * Sinks run on the worker threads, concurrently, and get the index of the
+ * worker for per worker state. The MessageFrame is only valid during the call.
+ * Submit, flush and drain must be called from one thread at a time.
+ */
+
+#ifndef LIBSM_PIPELINE_H
+#define LIBSM_PIPELINE_H
+
+#include "MessageFrame.h"
+#include "libsm-error.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/** @brief Most frames in a batch */
+#define LIBSM_PIPELINE_BATCH_MAX 256
+
+/** @brief Most sinks for specific message types */
+#define LIBSM_PIPELINE_SINKS_MAX 16
+
+/** @brief Called with every decoded frame of the types the sink is set for */
+typedef void (*libsm_pipeline_sink_f)(void* user, unsigned worker, MessageFrame_t* mf);
+
+/** @brief Called with every frame that did not decode */
+typedef void (*libsm_pipeline_error_f)(void* user,
+                                       unsigned worker,
+                                       uint8_t const* encoded,
+                                       size_t len,
+                                       libsm_rval_e rval);
+
+/** @brief Sizes of a pipeline */
+typedef struct {
+    unsigned workers;          /**< @brief decoding threads, 0 for one per online cpu */
+    unsigned batchSize;        /**< @brief frames per batch, 1 to LIBSM_PIPELINE_BATCH_MAX */
+    size_t batchBytes;         /**< @brief bytes per batch, and so the largest frame */
+    unsigned batchesPerWorker; /**< @brief ring depth per worker, a power of two */
+} libsm_pipeline_config_t;
+
+/** @brief Counters of a pipeline, since it was initialized */
+typedef struct {
+    uint64_t submitted; /**< @brief frames accepted by submit */
+    uint64_t decoded;   /**< @brief frames handed to a sink */
+    uint64_t failed;    /**< @brief frames that did not decode */
+    uint64_t dropped;   /**< @brief frames of a type without a sink, never decoded */
+    uint64_t stolen;    /**< @brief batches a worker took from the ring of another */
+    uint64_t stalls;    /**< @brief times the receiving thread found no free batch */
+} libsm_pipeline_stats_t;
+
+/** @brief A sink for one message type */
+typedef struct {
+    long messageId;             /**< @brief DSRCmsgID of the type */
+    libsm_pipeline_sink_f sink; /**< @brief the callback */
+    void* user;                 /**< @brief passed to sink */
+} libsm_pipeline_sink_t;
+
+struct libsm_pipeline_state;
+
+/** @brief A pipeline, initialize with libsm_pipeline_init */
+typedef struct {
+    libsm_pipeline_config_t config;                     /**< @brief sizes in use */
+    libsm_pipeline_sink_t sinks[LIBSM_PIPELINE_SINKS_MAX]; /**< @brief per type sinks */
+    size_t sinkCount;                                   /**< @brief sinks in use */
+    libsm_pipeline_sink_f defaultSink;                  /**< @brief for the other types */
+    void* defaultUser;                                  /**< @brief passed to defaultSink */
+    libsm_pipeline_error_f errorSink;                   /**< @brief for frames that fail */
+    void* errorUser;                                    /**< @brief passed to errorSink */
+    struct libsm_pipeline_state* state;                 /**< @brief threads, rings and batches */
+} libsm_pipeline_t;
+
+
+/**
+ * @brief Set the default sizes
+ *
+ * One worker per online cpu, batches of 64 frames and 64 KiB, 8 batches per worker.
+ *
+ * @param config The configuration to initialize
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG config was NULL
+ */
+libsm_rval_e libsm_pipeline_default_config(libsm_pipeline_config_t* config);
+
+
+/**
+ * @brief Initialize a pipeline, without sinks
+ *
+ * @param pipeline The pipeline, free with libsm_pipeline_free
+ * @param config The sizes, NULL for the defaults
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG pipeline was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER A size is out of range
+ * @retval LIBSM_ALLOC_ERR Allocation error
+ */
+libsm_rval_e libsm_pipeline_init(libsm_pipeline_t* pipeline, libsm_pipeline_config_t const* config);
+
+
+/**
+ * @brief Set the sink for a message type, before libsm_pipeline_start
+ *
+ * @param pipeline The pipeline
+ * @param messageId DSRCmsgID of the type, or -1 for every type without its own sink
+ * @param sink The callback, NULL to skip the type
+ * @param user Passed to sink
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG pipeline was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER The pipeline runs, or there are too many sinks
+ */
+libsm_rval_e libsm_pipeline_set_sink(libsm_pipeline_t* pipeline,
+                                     long messageId,
+                                     libsm_pipeline_sink_f sink,
+                                     void* user);
+
+
+/**
+ * @brief Set the callback for frames that fail to decode, before libsm_pipeline_start
+ *
+ * @param pipeline The pipeline
+ * @param errorSink The callback, NULL to ignore failures
+ * @param user Passed to errorSink
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG pipeline was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER The pipeline runs
+ */
+libsm_rval_e libsm_pipeline_set_error_sink(libsm_pipeline_t* pipeline,
+                                           libsm_pipeline_error_f errorSink,
+                                           void* user);
+
+
+/**
+ * @brief Start the workers
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG pipeline was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER The pipeline runs already
+ * @retval LIBSM_FAIL A thread could not be started
+ */
+libsm_rval_e libsm_pipeline_start(libsm_pipeline_t* pipeline);
+
+
+/**
+ * @brief Submit a frame, waiting for a free batch if all are in flight
+ *
+ * @param pipeline A started pipeline
+ * @param encoded UPER MessageFrame, copied
+ * @param len Size of encoded
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG An argument was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER The pipeline does not run
+ * @retval LIBSM_FAIL_DECODING_BUFF_SIZE len is 0 or larger than batchBytes
+ */
+libsm_rval_e libsm_pipeline_submit(libsm_pipeline_t* pipeline, uint8_t const* encoded, size_t len);
+
+
+/**
+ * @brief Submit a frame if a batch is free
+ *
+ * @retval LIBSM_FAIL All batches are in flight, the frame was not taken
+ * @return Otherwise as libsm_pipeline_submit
+ */
+libsm_rval_e libsm_pipeline_try_submit(libsm_pipeline_t* pipeline,
+                                       uint8_t const* encoded,
+                                       size_t len);
+
+
+/**
+ * @brief Hand the partly filled batch to the workers
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG pipeline was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER The pipeline does not run
+ */
+libsm_rval_e libsm_pipeline_flush(libsm_pipeline_t* pipeline);
+
+
+/**
+ * @brief Flush, and wait until every frame submitted so far went through its sink
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG pipeline was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER The pipeline does not run
+ */
+libsm_rval_e libsm_pipeline_drain(libsm_pipeline_t* pipeline);
+
+
+/**
+ * @brief Read the counters, from any thread
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG An argument was NULL
+ */
+libsm_rval_e libsm_pipeline_stats(libsm_pipeline_t const* pipeline, libsm_pipeline_stats_t* stats);
+
+
+/**
+ * @brief Drain and stop a running pipeline, and free it
+ *
+ * @param pipeline The pipeline, may be NULL
+ */
+void libsm_pipeline_free(libsm_pipeline_t* pipeline);
+
+
+#endif // LIBSM_PIPELINE_H
@@ -0,0 +1,193 @@
+#include "libsm-spatBuilder.h"
+#include "libsm.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+
+/*
+ * Every node the largest SPaT needs, in flat arrays. The SEQUENCE OFs point at
+ * the arrays of pointers, a build only sets how many of them are in use.
+ */
+struct libsm_spat_pool {
+    MessageFrame_t mf;
+    IntersectionState_t* intersections;
+    IntersectionState_t** intersectionPtrs;
+    MinuteOfTheYear_t* moys;
+    DSecond_t* timeStamps;
+    uint8_t* status;
+    MovementState_t* states; // maxSignals per intersection
+    MovementState_t** statePtrs;
+    MovementEvent_t* events; // one per state
+    MovementEvent_t** eventPtrs;
+    TimeChangeDetails_t* timings;
+    SPAT_TimeMark_t* maxEndTimes;
+};
+
+
+static void free_pool(struct libsm_spat_pool* pool)
+{
+    free(pool->intersections);
+    free(pool->intersectionPtrs);
+    free(pool->moys);
+    free(pool->timeStamps);
+    free(pool->status);
+    free(pool->states);
+    free(pool->statePtrs);
+    free(pool->events);
+    free(pool->eventPtrs);
+    free(pool->timings);
+    free(pool->maxEndTimes);
+    free(pool);
+}
+
+
+libsm_rval_e libsm_spat_builder_init(libsm_spat_builder_t* builder,
+                                     size_t maxIntersections,
+                                     size_t maxSignals)
+{
+    if (builder == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    memset(builder, 0, sizeof(*builder));
+    if (maxIntersections < 1 || maxIntersections > LIBSM_SPAT_MAX_INTERSECTIONS || maxSignals < 1
+        || maxSignals > LIBSM_SPAT_MAX_SIGNALS) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+
+    struct libsm_spat_pool* pool = calloc(1, sizeof(*pool));
+    if (pool == NULL) {
+        return LIBSM_ALLOC_ERR;
+    }
+    size_t const movements = maxIntersections * maxSignals;
+    pool->intersections = calloc(maxIntersections, sizeof(IntersectionState_t));
+    pool->intersectionPtrs = calloc(maxIntersections, sizeof(IntersectionState_t*));
+    pool->moys = calloc(maxIntersections, sizeof(MinuteOfTheYear_t));
+    pool->timeStamps = calloc(maxIntersections, sizeof(DSecond_t));
+    pool->status = calloc(maxIntersections, 2);
+    pool->states = calloc(movements, sizeof(MovementState_t));
+    pool->statePtrs = calloc(movements, sizeof(MovementState_t*));
+    pool->events = calloc(movements, sizeof(MovementEvent_t));
+    pool->eventPtrs = calloc(movements, sizeof(MovementEvent_t*));
+    pool->timings = calloc(movements, sizeof(TimeChangeDetails_t));
+    pool->maxEndTimes = calloc(movements, sizeof(SPAT_TimeMark_t));
+    if (pool->intersections == NULL || pool->intersectionPtrs == NULL || pool->moys == NULL
+        || pool->timeStamps == NULL || pool->status == NULL || pool->states == NULL
+        || pool->statePtrs == NULL || pool->events == NULL || pool->eventPtrs == NULL
+        || pool->timings == NULL || pool->maxEndTimes == NULL) {
+        free_pool(pool);
+        return LIBSM_ALLOC_ERR;
+    }
+
+    // link the nodes once, builds only change counts and optional members
+    pool->mf.messageId = DSRCmsgID_signalPhaseAndTimingMessage;
+    pool->mf.value.present = MessageFrame__value_PR_SPAT;
+    SPAT_t* spat = &pool->mf.value.choice.SPAT;
+    spat->intersections.list.array = pool->intersectionPtrs;
+    spat->intersections.list.size = (int)maxIntersections;
+    for (size_t i = 0; i < maxIntersections; i++) {
+        IntersectionState_t* intersection = &pool->intersections[i];
+        pool->intersectionPtrs[i] = intersection;
+        intersection->status.buf = &pool->status[2 * i];
+        intersection->status.size = 2;
+        intersection->states.list.array = &pool->statePtrs[i * maxSignals];
+        intersection->states.list.size = (int)maxSignals;
+    }
+    for (size_t m = 0; m < movements; m++) {
+        pool->statePtrs[m] = &pool->states[m];
+        pool->eventPtrs[m] = &pool->events[m];
+        pool->states[m].state_time_speed.list.array = &pool->eventPtrs[m];
+        pool->states[m].state_time_speed.list.size = 1;
+        pool->states[m].state_time_speed.list.count = 1;
+    }
+
+    builder->maxIntersections = maxIntersections;
+    builder->maxSignals = maxSignals;
+    builder->mf = &pool->mf;
+    builder->pool = pool;
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_spat_builder_build(libsm_spat_builder_t* builder,
+                                      libsm_spat_intersection_t const* intersections,
+                                      size_t count)
+{
+    if (builder == NULL || builder->pool == NULL || intersections == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (count < 1 || count > builder->maxIntersections) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (intersections[i].signals == NULL) {
+            return LIBSM_FAIL_NULL_ARG;
+        }
+        if (intersections[i].signalCount < 1
+            || intersections[i].signalCount > builder->maxSignals) {
+            return LIBSM_FAIL_NO_VALID_PARAMETER;
+        }
+    }
+
+    struct libsm_spat_pool* pool = builder->pool;
+    pool->mf.value.choice.SPAT.intersections.list.count = (int)count;
+    for (size_t i = 0; i < count; i++) {
+        libsm_spat_intersection_t const* in = &intersections[i];
+        IntersectionState_t* out = &pool->intersections[i];
+        out->id.id = in->id;
+        out->revision = in->revision;
+        out->status.buf[0] = (uint8_t)(in->status >> 8);
+        out->status.buf[1] = (uint8_t)in->status;
+        pool->moys[i] = in->moy;
+        out->moy = in->moy != LIBSM_SPAT_MOY_UNKNOWN ? &pool->moys[i] : NULL;
+        pool->timeStamps[i] = in->timeStamp;
+        out->timeStamp = in->timeStamp != LIBSM_SPAT_DSECOND_UNKNOWN ? &pool->timeStamps[i] : NULL;
+
+        out->states.list.count = (int)in->signalCount;
+        for (size_t s = 0; s < in->signalCount; s++) {
+            libsm_spat_signal_t const* signal = &in->signals[s];
+            size_t const m = i * builder->maxSignals + s;
+            MovementEvent_t* event = &pool->events[m];
+            TimeChangeDetails_t* timing = &pool->timings[m];
+            pool->states[m].signalGroup = signal->signalGroup;
+            event->eventState = signal->eventState;
+
+            // no timing at all when neither end is known
+            timing->minEndTime = signal->minEndTime;
+            pool->maxEndTimes[m] = signal->maxEndTime;
+            timing->maxEndTime = signal->maxEndTime != LIBSM_SPAT_TIME_UNKNOWN
+                                         ? &pool->maxEndTimes[m]
+                                         : NULL;
+            event->timing = signal->minEndTime != LIBSM_SPAT_TIME_UNKNOWN
+                                            || timing->maxEndTime != NULL
+                                    ? timing
+                                    : NULL;
+        }
+    }
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_spat_builder_encode(libsm_spat_builder_t* builder,
+                                       libsm_spat_intersection_t const* intersections,
+                                       size_t count,
+                                       uint8_t* encoded,
+                                       size_t* len)
+{
+    libsm_rval_e const rval = libsm_spat_builder_build(builder, intersections, count);
+    if (rval != LIBSM_OK) {
+        return rval;
+    }
+    return libsm_encode_messageframe(builder->mf, encoded, len);
+}
+
+
+void libsm_spat_builder_free(libsm_spat_builder_t* builder)
+{
+    if (builder == NULL || builder->pool == NULL) {
+        return;
+    }
+    free_pool(builder->pool);
+    builder->pool = NULL;
+    builder->mf = NULL;
+}
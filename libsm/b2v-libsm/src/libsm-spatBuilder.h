@@ -0,0 +1,132 @@
+/**
+ * @brief Bulk SPaT builder from compact signal controller state
+ *
+ * libsm_add_spat_intersectionState and friends calloc every node, so building a
+ * SPaT every 100 ms is a storm of small allocations and an ASN_STRUCT_FREE.
+ * The builder allocates a SPaT skeleton for up to maxIntersections intersections
+ * of up to maxSignals signal groups once, in libsm_spat_builder_init. Each build
+ * points the SEQUENCE OFs of the skeleton at the nodes it needs and fills them in
+ * place from an array of libsm_spat_intersection_t, so building and encoding do
+ * not touch the heap.
+ *
+ * The MessageFrame belongs to the builder: read or encode it until the next
+ * build, never ASN_STRUCT_FREE it. One builder per thread.
+ */
+
+#ifndef LIBSM_SPAT_BUILDER_H
+#define LIBSM_SPAT_BUILDER_H
+
+#include "libsm-error.h"
+#include <MessageFrame.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/** @brief TimeMark for an unknown time, optional times with it are left out */
+#define LIBSM_SPAT_TIME_UNKNOWN 36001
+
+/** @brief MinuteOfTheYear for an unknown minute, left out */
+#define LIBSM_SPAT_MOY_UNKNOWN 527040
+
+/** @brief DSecond for an unknown timestamp, left out */
+#define LIBSM_SPAT_DSECOND_UNKNOWN 65535
+
+/** @brief Most intersections in one SPaT, IntersectionStateList SIZE(1..32) */
+#define LIBSM_SPAT_MAX_INTERSECTIONS 32
+
+/** @brief Most signal groups in one intersection, MovementList SIZE(1..255) */
+#define LIBSM_SPAT_MAX_SIGNALS 255
+
+/** @brief The state of one signal group */
+typedef struct {
+    uint8_t signalGroup;      /**< @brief SignalGroupID */
+    uint8_t eventState;       /**< @brief e_MovementPhaseState */
+    uint16_t minEndTime;      /**< @brief TimeMark, 1/10 s in the hour */
+    uint16_t maxEndTime;      /**< @brief TimeMark, or LIBSM_SPAT_TIME_UNKNOWN */
+} libsm_spat_signal_t;
+
+/** @brief The state of one intersection */
+typedef struct {
+    uint16_t id;                         /**< @brief IntersectionID */
+    uint8_t revision;                    /**< @brief MsgCount, 0 to 127 */
+    uint16_t status;                     /**< @brief IntersectionStatusObject, bit 0 is 0x8000 */
+    uint32_t moy;                        /**< @brief or LIBSM_SPAT_MOY_UNKNOWN */
+    uint16_t timeStamp;                  /**< @brief DSecond, or LIBSM_SPAT_DSECOND_UNKNOWN */
+    libsm_spat_signal_t const* signals;  /**< @brief one per MovementState */
+    size_t signalCount;                  /**< @brief 1 to maxSignals */
+} libsm_spat_intersection_t;
+
+struct libsm_spat_pool;
+
+/** @brief A reusable SPaT, initialize with libsm_spat_builder_init */
+typedef struct {
+    size_t maxIntersections;      /**< @brief capacity, intersections per SPaT */
+    size_t maxSignals;            /**< @brief capacity, signal groups per intersection */
+    MessageFrame_t* mf;           /**< @brief the SPaT built last */
+    struct libsm_spat_pool* pool; /**< @brief the preallocated nodes */
+} libsm_spat_builder_t;
+
+
+/**
+ * @brief Allocate the skeleton of a builder
+ *
+ * @param builder The builder, free with libsm_spat_builder_free
+ * @param maxIntersections 1 to LIBSM_SPAT_MAX_INTERSECTIONS
+ * @param maxSignals 1 to LIBSM_SPAT_MAX_SIGNALS
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG builder was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER A capacity is out of range
+ * @retval LIBSM_ALLOC_ERR Allocation error
+ */
+libsm_rval_e libsm_spat_builder_init(libsm_spat_builder_t* builder,
+                                     size_t maxIntersections,
+                                     size_t maxSignals);
+
+
+/**
+ * @brief Fill builder->mf with a SPaT of the given intersections
+ *
+ * Values are copied as they are, out of range values are caught by the encoder.
+ *
+ * @param builder An initialized builder
+ * @param intersections The intersections
+ * @param count 1 to maxIntersections
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG An argument was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER count or a signalCount is out of range
+ */
+libsm_rval_e libsm_spat_builder_build(libsm_spat_builder_t* builder,
+                                      libsm_spat_intersection_t const* intersections,
+                                      size_t count);
+
+
+/**
+ * @brief Build, and UPER encode the MessageFrame
+ *
+ * @param builder An initialized builder
+ * @param intersections The intersections
+ * @param count 1 to maxIntersections
+ * @param encoded Buffer for the MessageFrame
+ * @param len In: size of encoded, out: bytes written
+ *
+ * @return As libsm_spat_builder_build and libsm_encode_messageframe
+ */
+libsm_rval_e libsm_spat_builder_encode(libsm_spat_builder_t* builder,
+                                       libsm_spat_intersection_t const* intersections,
+                                       size_t count,
+                                       uint8_t* encoded,
+                                       size_t* len);
+
+
+/**
+ * @brief Free the skeleton
+ *
+ * @param builder The builder, may be NULL
+ */
+void libsm_spat_builder_free(libsm_spat_builder_t* builder);
+
+
+#endif // LIBSM_SPAT_BUILDER_H
@@ -0,0 +1,456 @@
+/**
+ * @brief Compact SPaT timelines with point in time signal state queries
+ */
+
+#include "libsm-spatTimeline.h"
+#include "MessageFrame.h"
+#include "MovementEvent.h"
+#include "MovementState.h"
+#include "TimeChangeDetails.h"
+#include "j2735-defines.h"
+#include "libsm-hash.h"
+#include "libsm.h"
+
+#include <stdlib.h>
+
+
+#define TIMELINE_MINUTE_MS 60000
+#define TIMELINE_HOUR_MS   3600000
+#define TIMELINE_DAY_MS    86400000
+
+
+static uint64_t timeline_key(uint32_t intersection, uint8_t signalGroup)
+{
+    return (uint64_t)intersection << 8 | signalGroup;
+}
+
+
+libsm_rval_e libsm_spat_timeline_init(libsm_spat_timeline_t* tl, uint64_t gapMs)
+{
+    if (tl == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    *tl = (libsm_spat_timeline_t){ 0 };
+    if (gapMs == 0) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    tl->gapMs = gapMs;
+    tl->indexMask = 63;
+    tl->index = libsm_index_alloc(tl->indexMask + 1);
+    if (tl->index == NULL) {
+        return LIBSM_ALLOC_ERR;
+    }
+    return LIBSM_OK;
+}
+
+
+void libsm_spat_timeline_free(libsm_spat_timeline_t* tl)
+{
+    if (tl == NULL) {
+        return;
+    }
+    for (size_t s = 0; s < tl->seriesCount; s++) {
+        free(tl->series[s].timeOffsetMs);
+        free(tl->series[s].eventState);
+        free(tl->series[s].minEndTime);
+        free(tl->series[s].maxEndTime);
+    }
+    free(tl->series);
+    free(tl->index);
+    *tl = (libsm_spat_timeline_t){ 0 };
+}
+
+
+static uint64_t timeline_series_key(void const* series, int32_t i)
+{
+    libsm_spat_series_t const* s = &((libsm_spat_series_t const*)series)[i];
+    return timeline_key(s->intersection, s->signalGroup);
+}
+
+
+static size_t timeline_lookup(libsm_spat_timeline_t const* tl, uint64_t key)
+{
+    return libsm_index_find(tl->index, tl->indexMask, key, timeline_series_key, tl->series);
+}
+
+
+static bool timeline_grow_index(libsm_spat_timeline_t* tl)
+{
+    size_t const size = (tl->indexMask + 1) * 2;
+    int32_t* index = libsm_index_alloc(size);
+    if (index == NULL) {
+        return false;
+    }
+    free(tl->index);
+    tl->index = index;
+    tl->indexMask = size - 1;
+    for (size_t s = 0; s < tl->seriesCount; s++) {
+        uint64_t const key = timeline_key(tl->series[s].intersection, tl->series[s].signalGroup);
+        tl->index[timeline_lookup(tl, key)] = (int32_t)s;
+    }
+    return true;
+}
+
+
+static libsm_spat_series_t* timeline_series(libsm_spat_timeline_t* tl,
+                                            uint32_t intersection,
+                                            uint8_t signalGroup)
+{
+    uint64_t const key = timeline_key(intersection, signalGroup);
+    size_t slot = timeline_lookup(tl, key);
+    if (tl->index[slot] >= 0) {
+        return &tl->series[tl->index[slot]];
+    }
+
+    // keep the table at most half full
+    if (2 * (tl->seriesCount + 1) > tl->indexMask + 1) {
+        if (!timeline_grow_index(tl)) {
+            return NULL;
+        }
+        slot = timeline_lookup(tl, key);
+    }
+    if (tl->seriesCount == tl->seriesCapacity) {
+        size_t const capacity = tl->seriesCapacity ? 2 * tl->seriesCapacity : 16;
+        libsm_spat_series_t* grown = realloc(tl->series, capacity * sizeof(libsm_spat_series_t));
+        if (grown == NULL) {
+            return NULL;
+        }
+        tl->series = grown;
+        tl->seriesCapacity = capacity;
+    }
+    libsm_spat_series_t* series = &tl->series[tl->seriesCount];
+    *series = (libsm_spat_series_t){ .intersection = intersection, .signalGroup = signalGroup };
+    tl->index[slot] = (int32_t)tl->seriesCount++;
+    return series;
+}
+
+
+static bool timeline_append(libsm_spat_timeline_t* tl,
+                            libsm_spat_series_t* series,
+                            uint64_t timeMs,
+                            uint8_t eventState,
+                            uint16_t minEndTime,
+                            uint16_t maxEndTime)
+{
+    if (series->count == series->capacity) {
+        size_t const capacity = series->capacity ? 2 * series->capacity : 16;
+        uint32_t* timeOffsetMs = realloc(series->timeOffsetMs, capacity * sizeof(uint32_t));
+        if (timeOffsetMs != NULL) {
+            series->timeOffsetMs = timeOffsetMs;
+        }
+        uint8_t* state = realloc(series->eventState, capacity * sizeof(uint8_t));
+        if (state != NULL) {
+            series->eventState = state;
+        }
+        uint16_t* minEnd = realloc(series->minEndTime, capacity * sizeof(uint16_t));
+        if (minEnd != NULL) {
+            series->minEndTime = minEnd;
+        }
+        uint16_t* maxEnd = realloc(series->maxEndTime, capacity * sizeof(uint16_t));
+        if (maxEnd != NULL) {
+            series->maxEndTime = maxEnd;
+        }
+        if (timeOffsetMs == NULL || state == NULL || minEnd == NULL || maxEnd == NULL) {
+            return false;
+        }
+        series->capacity = capacity;
+    }
+    if (series->count == 0) {
+        series->startTimeMs = timeMs;
+    }
+    series->timeOffsetMs[series->count] = (uint32_t)(timeMs - series->startTimeMs);
+    series->eventState[series->count] = eventState;
+    series->minEndTime[series->count] = minEndTime;
+    series->maxEndTime[series->count] = maxEndTime;
+    series->count++;
+    tl->stats.rows++;
+    return true;
+}
+
+
+static bool timeline_add_movement(libsm_spat_timeline_t* tl,
+                                  uint32_t intersection,
+                                  MovementState_t const* movement,
+                                  uint64_t timeMs)
+{
+    MovementEvent_t const* event = movement->state_time_speed.list.count > 0
+                                           ? movement->state_time_speed.list.array[0]
+                                           : NULL;
+    if (event == NULL) {
+        return true;
+    }
+    tl->stats.movements++;
+
+    uint8_t const eventState = (uint8_t)event->eventState;
+    uint16_t const minEnd =
+            event->timing ? (uint16_t)event->timing->minEndTime : LIBSM_SPAT_TIMEMARK_UNKNOWN;
+    uint16_t const maxEnd = event->timing && event->timing->maxEndTime
+                                    ? (uint16_t)*event->timing->maxEndTime
+                                    : LIBSM_SPAT_TIMEMARK_UNKNOWN;
+    libsm_spat_series_t* series = timeline_series(tl, intersection, (uint8_t)movement->signalGroup);
+    if (series == NULL) {
+        return false;
+    }
+
+    if (series->count > 0) {
+        if (timeMs < series->lastSeenMs) {
+            tl->stats.late++;
+            return true;
+        }
+        if (timeMs - series->startTimeMs > UINT32_MAX) {
+            tl->stats.dropped++;
+            return true;
+        }
+        size_t const last = series->count - 1;
+        bool const gap = timeMs - series->lastSeenMs > tl->gapMs;
+        if (gap && series->eventState[last] != MovementPhaseState_unavailable) {
+            if (!timeline_append(tl,
+                                 series,
+                                 series->lastSeenMs + tl->gapMs,
+                                 MovementPhaseState_unavailable,
+                                 LIBSM_SPAT_TIMEMARK_UNKNOWN,
+                                 LIBSM_SPAT_TIMEMARK_UNKNOWN)) {
+                return false;
+            }
+        } else if (!gap && series->eventState[last] == eventState
+                   && series->minEndTime[last] == minEnd && series->maxEndTime[last] == maxEnd) {
+            series->lastSeenMs = timeMs;
+            return true;
+        }
+    }
+    if (!timeline_append(tl, series, timeMs, eventState, minEnd, maxEnd)) {
+        return false;
+    }
+    series->lastSeenMs = timeMs;
+    return true;
+}
+
+
+// days since the epoch of January 1st of a year, proleptic Gregorian
+static int64_t timeline_year_start(int64_t year)
+{
+    int64_t const y = year - 1;
+    int64_t const era = (y >= 0 ? y : y - 399) / 400;
+    int64_t const yoe = y - era * 400;
+    int64_t const doe = yoe * 365 + yoe / 4 - yoe / 100 + 306;
+    return era * 146097 + doe - 719468;
+}
+
+
+static int64_t timeline_year_of(int64_t days)
+{
+    days += 719468;
+    int64_t const era = (days >= 0 ? days : days - 146096) / 146097;
+    int64_t const doe = days - era * 146097;
+    int64_t const yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    int64_t const doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    int64_t const mp = (5 * doy + 2) / 153;
+    return yoe + era * 400 + (mp >= 10);
+}
+
+
+uint64_t libsm_spat_timeline_state_time(SPAT_t const* spat,
+                                        IntersectionState_t const* state,
+                                        uint64_t rxTimeMs)
+{
+    MinuteOfTheYear_t const* moy =
+            state && state->moy ? state->moy : (spat ? spat->timeStamp : NULL);
+    DSecond_t const* dsecond = state ? state->timeStamp : NULL;
+    int64_t const rx = (int64_t)rxTimeMs;
+    bool const hasMoy = moy != NULL && *moy >= 0 && *moy < MinuteOfTheYear_unavailable;
+    bool const hasSecond = dsecond != NULL && *dsecond >= 0 && *dsecond < DSecond_unavailable;
+    // a leap second is folded into the last millisecond of the minute
+    int64_t const second = hasSecond ? (*dsecond < TIMELINE_MINUTE_MS ? *dsecond
+                                                                      : TIMELINE_MINUTE_MS - 1)
+                                     : 0;
+
+    if (hasMoy) {
+        int64_t const year = timeline_year_of(rx / TIMELINE_DAY_MS);
+        int64_t best = -1;
+        for (int64_t y = year - 1; y <= year + 1; y++) {
+            int64_t const minute =
+                    timeline_year_start(y) * TIMELINE_DAY_MS + (int64_t)*moy * TIMELINE_MINUTE_MS;
+            int64_t t = minute + second;
+            if (!hasSecond) {
+                // only the minute is known, stay within it
+                t = rx < minute ? minute : (rx >= minute + TIMELINE_MINUTE_MS ? minute : rx);
+            }
+            if (best < 0 || llabs(t - rx) < llabs(best - rx)) {
+                best = t;
+            }
+        }
+        return best < 0 ? rxTimeMs : (uint64_t)best;
+    }
+    if (hasSecond) {
+        int64_t t = rx - rx % TIMELINE_MINUTE_MS + second;
+        if (t - rx > TIMELINE_MINUTE_MS / 2) {
+            t -= TIMELINE_MINUTE_MS;
+        } else if (rx - t > TIMELINE_MINUTE_MS / 2) {
+            t += TIMELINE_MINUTE_MS;
+        }
+        return t < 0 ? rxTimeMs : (uint64_t)t;
+    }
+    return rxTimeMs;
+}
+
+
+libsm_rval_e libsm_spat_timeline_add(libsm_spat_timeline_t* tl,
+                                     SPAT_t const* spat,
+                                     uint64_t rxTimeMs)
+{
+    if (tl == NULL || spat == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    tl->stats.messages++;
+    for (int i = 0; i < spat->intersections.list.count; i++) {
+        IntersectionState_t const* state = spat->intersections.list.array[i];
+        if (state == NULL) {
+            continue;
+        }
+        uint32_t const region = state->id.region ? (uint32_t)(*state->id.region & 0xFFFF) : 0;
+        uint32_t const intersection = region << 16 | (uint32_t)(state->id.id & 0xFFFF);
+        uint64_t const timeMs = libsm_spat_timeline_state_time(spat, state, rxTimeMs);
+        for (int m = 0; m < state->states.list.count; m++) {
+            if (state->states.list.array[m] != NULL
+                && !timeline_add_movement(tl, intersection, state->states.list.array[m], timeMs)) {
+                return LIBSM_ALLOC_ERR;
+            }
+        }
+    }
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_spat_timeline_add_uper(libsm_spat_timeline_t* tl,
+                                          uint8_t const* encoded,
+                                          size_t len,
+                                          uint64_t rxTimeMs)
+{
+    if (tl == NULL || encoded == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    MessageFrame_t* mf = calloc(1, sizeof(MessageFrame_t));
+    if (mf == NULL) {
+        return LIBSM_ALLOC_ERR;
+    }
+    libsm_rval_e result = libsm_decode_messageframe(encoded, len, mf);
+    if (result == LIBSM_OK && libsm_mf_has_spat(mf)) {
+        result = libsm_spat_timeline_add(tl, &mf->value.choice.SPAT, rxTimeMs);
+    } else if (result != LIBSM_OK) {
+        result = LIBSM_FAIL_DECODING;
+    }
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    return result;
+}
+
+
+libsm_spat_series_t const* libsm_spat_timeline_series(libsm_spat_timeline_t const* tl,
+                                                      uint32_t intersection,
+                                                      uint8_t signalGroup)
+{
+    if (tl == NULL || tl->index == NULL) {
+        return NULL;
+    }
+    size_t const slot = timeline_lookup(tl, timeline_key(intersection, signalGroup));
+    return tl->index[slot] >= 0 ? &tl->series[tl->index[slot]] : NULL;
+}
+
+
+// number of rows at or before timeMs
+static size_t timeline_rows_until(libsm_spat_series_t const* series, uint64_t timeMs)
+{
+    if (series->count == 0 || timeMs < series->startTimeMs) {
+        return 0;
+    }
+    uint64_t const offset = timeMs - series->startTimeMs;
+    size_t lo = 0;
+    size_t hi = series->count;
+    while (lo < hi) {
+        size_t const mid = lo + (hi - lo) / 2;
+        if (series->timeOffsetMs[mid] <= offset) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+
+uint64_t libsm_spat_timeline_timemark(uint16_t timeMark, uint64_t sentMs)
+{
+    if (timeMark > LIBSM_SPAT_TIMEMARK_LEAP) {
+        return 0;
+    }
+    // a leap second is folded into the end of the hour
+    int64_t const mark = timeMark < LIBSM_SPAT_TIMEMARK_LEAP ? (int64_t)timeMark * 100
+                                                             : TIMELINE_HOUR_MS - 1;
+    int64_t const sent = (int64_t)sentMs;
+    int64_t t = sent - sent % TIMELINE_HOUR_MS + mark;
+    if (t - sent > TIMELINE_HOUR_MS / 2) {
+        t -= TIMELINE_HOUR_MS;
+    } else if (sent - t > TIMELINE_HOUR_MS / 2) {
+        t += TIMELINE_HOUR_MS;
+    }
+    return t < 0 ? 0 : (uint64_t)t;
+}
+
+
+libsm_rval_e libsm_spat_timeline_state_at(libsm_spat_timeline_t const* tl,
+                                          uint32_t intersection,
+                                          uint8_t signalGroup,
+                                          uint64_t timeMs,
+                                          libsm_spat_state_t* state)
+{
+    if (tl == NULL || state == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    *state = (libsm_spat_state_t){ .eventState = MovementPhaseState_unavailable };
+    libsm_spat_series_t const* series = libsm_spat_timeline_series(tl, intersection, signalGroup);
+    if (series == NULL || series->count == 0) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+
+    size_t const rows = timeline_rows_until(series, timeMs);
+    uint64_t const endMs = series->lastSeenMs + tl->gapMs;
+    if (rows == 0) {
+        state->untilMs = series->startTimeMs;
+        return LIBSM_OK;
+    }
+    if (rows == series->count && timeMs >= endMs) {
+        // nothing heard for too long after the last row
+        state->sinceMs = endMs;
+        return LIBSM_OK;
+    }
+
+    size_t const row = rows - 1;
+    state->eventState = series->eventState[row];
+    state->sinceMs = series->startTimeMs + series->timeOffsetMs[row];
+    state->untilMs =
+            rows < series->count ? series->startTimeMs + series->timeOffsetMs[rows] : endMs;
+    state->minEndMs = libsm_spat_timeline_timemark(series->minEndTime[row], state->sinceMs);
+    state->maxEndMs = libsm_spat_timeline_timemark(series->maxEndTime[row], state->sinceMs);
+    return LIBSM_OK;
+}
+
+
+void libsm_spat_timeline_range(libsm_spat_series_t const* series,
+                               uint64_t fromMs,
+                               uint64_t toMs,
+                               size_t* first,
+                               size_t* count)
+{
+    *first = 0;
+    *count = 0;
+    if (series == NULL || series->count == 0 || toMs <= fromMs) {
+        return;
+    }
+    size_t const atFrom = timeline_rows_until(series, fromMs);
+    size_t const start = atFrom > 0 ? atFrom - 1 : 0;
+    // rows starting before toMs
+    size_t const end = timeline_rows_until(series, toMs - 1);
+    if (end > start) {
+        *first = start;
+        *count = end - start;
+    }
+}
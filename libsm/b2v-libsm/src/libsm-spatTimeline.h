@@ -0,0 +1,188 @@
+/**
+ * @brief Compact SPaT timelines with point in time signal state queries
+ *
+ * Every (intersection, signalGroup) pair gets a series of state changes in
+ * columns. A row is only appended when the eventState, minEndTime or maxEndTime
+ * of the current MovementEvent differs from the previous row, so a signal
+ * repeating the same state at 10 Hz costs nothing until it changes. Rows are in
+ * time order, so the state at an instant is a binary search and a range is a
+ * contiguous run of rows.
+ *
+ * Message time comes from the IntersectionState moy and timeStamp, or the SPAT
+ * timeStamp, resolved against the receive time the same way as secMark in
+ * libsm-trajectory.h. TimeMarks are kept as sent, and are resolved to the hour
+ * of the row when queried.
+ *
+ * When a series is not heard from for more than gapMs, an unavailable row is
+ * added gapMs after its last report, so queries inside the gap do not return a
+ * stale state.
+ */
+
+#ifndef LIBSM_SPAT_TIMELINE_H
+#define LIBSM_SPAT_TIMELINE_H
+
+#include "SPAT.h"
+#include "libsm-error.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/** TimeMark is in 0.1 s since the hour, 36000 is a leap second, 36001 is unknown */
+#define LIBSM_SPAT_TIMEMARK_LEAP    36000
+#define LIBSM_SPAT_TIMEMARK_UNKNOWN 36001
+
+/** @brief State changes of one signal group, in columns */
+typedef struct {
+    uint32_t intersection;   /**< @brief region << 16 | id */
+    uint8_t signalGroup;
+    uint64_t startTimeMs;    /**< @brief time of the first row */
+    uint64_t lastSeenMs;     /**< @brief time of the latest report */
+    size_t count;
+    size_t capacity;
+    uint32_t* timeOffsetMs;  /**< @brief time of each row since startTimeMs */
+    uint8_t* eventState;     /**< @brief MovementPhaseState */
+    uint16_t* minEndTime;    /**< @brief TimeMark, LIBSM_SPAT_TIMEMARK_UNKNOWN if not sent */
+    uint16_t* maxEndTime;
+} libsm_spat_series_t;
+
+/** @brief Counters */
+typedef struct {
+    uint64_t messages;  /**< @brief SPATs taken */
+    uint64_t movements; /**< @brief MovementStates read */
+    uint64_t rows;      /**< @brief rows appended */
+    uint64_t late;      /**< @brief MovementStates older than their series, dropped */
+    uint64_t dropped;   /**< @brief MovementStates dropped, more than 49 days into a series */
+} libsm_spat_timeline_stats_t;
+
+/** @brief A set of series */
+typedef struct {
+    uint64_t gapMs;
+    libsm_spat_series_t* series;
+    size_t seriesCount;
+    size_t seriesCapacity;
+    int32_t* index;   /**< @brief open addressing table of series indices, -1 empty */
+    size_t indexMask;
+    libsm_spat_timeline_stats_t stats;
+} libsm_spat_timeline_t;
+
+/** @brief Signal state at an instant */
+typedef struct {
+    uint8_t eventState; /**< @brief MovementPhaseState, unavailable outside the series */
+    uint64_t sinceMs;   /**< @brief start of the row, 0 before the series */
+    uint64_t untilMs;   /**< @brief start of the next row, or when the series goes stale */
+    uint64_t minEndMs;  /**< @brief minEndTime resolved, 0 if unknown */
+    uint64_t maxEndMs;  /**< @brief maxEndTime resolved, 0 if unknown */
+} libsm_spat_state_t;
+
+
+/**
+ * @brief Initialize an empty timeline
+ *
+ * @param tl The timeline, free with libsm_spat_timeline_free
+ * @param gapMs A series is unavailable from gapMs after its last report
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG tl was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER gapMs was 0
+ * @retval LIBSM_ALLOC_ERR Allocation error
+ */
+libsm_rval_e libsm_spat_timeline_init(libsm_spat_timeline_t* tl, uint64_t gapMs);
+
+
+/**
+ * @brief Free a timeline
+ */
+void libsm_spat_timeline_free(libsm_spat_timeline_t* tl);
+
+
+/**
+ * @brief Time of a SPAT IntersectionState in ms since the epoch
+ *
+ * @param spat The message, its timeStamp is used when the intersection has no moy
+ * @param state The intersection
+ * @param rxTimeMs Receive or log time, returned when there is no usable time in the message
+ */
+uint64_t libsm_spat_timeline_state_time(SPAT_t const* spat,
+                                        IntersectionState_t const* state,
+                                        uint64_t rxTimeMs);
+
+
+/**
+ * @brief Append the changes in a decoded SPAT
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG tl or spat was NULL
+ * @retval LIBSM_ALLOC_ERR Allocation error
+ */
+libsm_rval_e libsm_spat_timeline_add(libsm_spat_timeline_t* tl,
+                                     SPAT_t const* spat,
+                                     uint64_t rxTimeMs);
+
+
+/**
+ * @brief Decode a UPER MessageFrame and append it if it is a SPAT
+ *
+ * Other messages are ignored.
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG tl or encoded was NULL
+ * @retval LIBSM_FAIL_DECODING The MessageFrame did not decode
+ * @retval LIBSM_ALLOC_ERR Allocation error
+ */
+libsm_rval_e libsm_spat_timeline_add_uper(libsm_spat_timeline_t* tl,
+                                          uint8_t const* encoded,
+                                          size_t len,
+                                          uint64_t rxTimeMs);
+
+
+/**
+ * @brief The series of a signal group, NULL if it was never seen
+ *
+ * The series is valid until the next add.
+ */
+libsm_spat_series_t const* libsm_spat_timeline_series(libsm_spat_timeline_t const* tl,
+                                                      uint32_t intersection,
+                                                      uint8_t signalGroup);
+
+
+/**
+ * @brief Signal state of a signal group at an instant
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG tl or state was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER The signal group was never seen
+ */
+libsm_rval_e libsm_spat_timeline_state_at(libsm_spat_timeline_t const* tl,
+                                          uint32_t intersection,
+                                          uint8_t signalGroup,
+                                          uint64_t timeMs,
+                                          libsm_spat_state_t* state);
+
+
+/**
+ * @brief Rows of a series that overlap [fromMs, toMs)
+ *
+ * The row in effect at fromMs is included.
+ *
+ * @param series The series
+ * @param first First row
+ * @param count Number of rows, 0 if none overlap
+ */
+void libsm_spat_timeline_range(libsm_spat_series_t const* series,
+                               uint64_t fromMs,
+                               uint64_t toMs,
+                               size_t* first,
+                               size_t* count);
+
+
+/**
+ * @brief Resolve a TimeMark against the time it was sent
+ *
+ * @return The instant within half an hour of sentMs with that TimeMark, 0 if unknown
+ */
+uint64_t libsm_spat_timeline_timemark(uint16_t timeMark, uint64_t sentMs);
+
+
+#endif // LIBSM_SPAT_TIMELINE_H
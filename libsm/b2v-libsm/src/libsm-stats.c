@@ -0,0 +1,100 @@
+#include "libsm-stats.h"
+#include "asn_application.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+
+static int compareBytes(void const* a, void const* b)
+{
+    uint64_t const x = ((libsm_stats_counters_t const*)a)->bytes;
+    uint64_t const y = ((libsm_stats_counters_t const*)b)->bytes;
+    return (x < y) - (x > y);
+}
+
+
+libsm_rval_e libsm_stats_snapshot(libsm_stats_t* stats)
+{
+    if (stats == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    memset(stats, 0, sizeof(*stats));
+#if LIBSM_STATS
+    // the snapshot allocates nothing the accounting counts, so one call is enough
+    size_t const count = asn_stats_get(NULL, NULL, NULL, 0);
+    if (count > 0) {
+        stats->types = calloc(count, sizeof(libsm_stats_counters_t));
+        if (stats->types == NULL) {
+            return LIBSM_ALLOC_ERR;
+        }
+    }
+    stats->count = asn_stats_get(&stats->total, &stats->untrackedFrees, stats->types, count);
+    qsort(stats->types, stats->count, sizeof(libsm_stats_counters_t), compareBytes);
+    return LIBSM_OK;
+#else
+    (void)compareBytes;
+    return LIBSM_FAIL;
+#endif
+}
+
+
+void libsm_stats_release(libsm_stats_t* stats)
+{
+    if (stats != NULL) {
+        free(stats->types);
+        memset(stats, 0, sizeof(*stats));
+    }
+}
+
+
+void libsm_stats_reset(void)
+{
+#if LIBSM_STATS
+    asn_stats_reset();
+#endif
+}
+
+
+static void dumpCounters(FILE* out, char const* name, libsm_stats_counters_t const* c)
+{
+    fprintf(out,
+            "%-40s %10llu %12llu %10llu %12llu %12llu\n",
+            name,
+            (unsigned long long)c->allocations,
+            (unsigned long long)c->bytes,
+            (unsigned long long)c->frees,
+            (unsigned long long)c->live_bytes,
+            (unsigned long long)c->peak_bytes);
+}
+
+
+libsm_rval_e libsm_stats_dump(FILE* out)
+{
+    if (out == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    libsm_stats_t stats;
+    libsm_rval_e const rval = libsm_stats_snapshot(&stats);
+    if (rval != LIBSM_OK) {
+        if (rval == LIBSM_FAIL) {
+            fprintf(out, "libsm was built without LIBSM_STATS\n");
+        }
+        return rval;
+    }
+    fprintf(out,
+            "%-40s %10s %12s %10s %12s %12s\n",
+            "type",
+            "allocs",
+            "bytes",
+            "frees",
+            "live bytes",
+            "peak bytes");
+    for (size_t i = 0; i < stats.count; i++) {
+        libsm_stats_counters_t const* c = &stats.types[i];
+        dumpCounters(out, c->type != NULL ? c->type->name : "(no type)", c);
+    }
+    dumpCounters(out, "total", &stats.total);
+    fprintf(out, "untracked frees: %llu\n", (unsigned long long)stats.untrackedFrees);
+    libsm_stats_release(&stats);
+    return LIBSM_OK;
+}
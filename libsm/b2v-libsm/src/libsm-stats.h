@@ -0,0 +1,84 @@
+/**
+ * @brief Allocation statistics of the codec runtime, per J2735 type
+ *
+ * Built with -DLIBSM_STATS=ON, every allocation the generated code makes is
+ * counted per thread and per type descriptor: allocations, bytes, frees, live
+ * bytes and the peak of live bytes. Allocations made by a UPER decoder are
+ * charged to the type it decodes, scratch space of the UPER encoder to the
+ * type being encoded, and the rest to no type.
+ *
+ * Memory allocated with plain calloc, e.g. by the libsm_alloc_init builders,
+ * is not counted, and freeing it with ASN_STRUCT_FREE shows up as untracked
+ * frees. So do frees of memory another thread decoded.
+ *
+ * Without LIBSM_STATS the accounting is compiled out, and these functions
+ * return LIBSM_FAIL.
+ */
+
+#ifndef LIBSM_STATS_H
+#define LIBSM_STATS_H
+
+#include "asn_stats.h"
+#include "libsm-error.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+
+/** @brief Counters of one type, type is NULL for allocations outside any type */
+typedef asn_stats_counters_t libsm_stats_counters_t;
+
+/** @brief Counters of the calling thread */
+typedef struct {
+    libsm_stats_counters_t total;  /**< @brief sum over all types */
+    uint64_t untrackedFrees;       /**< @brief frees of memory not counted by this thread */
+    libsm_stats_counters_t* types; /**< @brief per type, most bytes first */
+    size_t count;                  /**< @brief number of types */
+} libsm_stats_t;
+
+
+/**
+ * @brief Copy the counters of the calling thread
+ *
+ * @param stats Out the counters, release with libsm_stats_release
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG stats is NULL
+ * @retval LIBSM_FAIL libsm was built without LIBSM_STATS
+ * @retval LIBSM_ALLOC_ERR Allocation error
+ */
+libsm_rval_e libsm_stats_snapshot(libsm_stats_t* stats);
+
+
+/**
+ * @brief Release a snapshot
+ *
+ * @param stats Snapshot from libsm_stats_snapshot, may be NULL
+ */
+void libsm_stats_release(libsm_stats_t* stats);
+
+
+/**
+ * @brief Zero the counters of the calling thread
+ *
+ * Also releases the memory of the accounting, call it before a thread that
+ * decoded messages exits.
+ */
+void libsm_stats_reset(void);
+
+
+/**
+ * @brief Print the counters of the calling thread, one type per line
+ *
+ * @param out Where to print
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG out is NULL
+ * @retval LIBSM_FAIL libsm was built without LIBSM_STATS
+ * @retval LIBSM_ALLOC_ERR Allocation error
+ */
+libsm_rval_e libsm_stats_dump(FILE* out);
+
+
+#endif // LIBSM_STATS_H
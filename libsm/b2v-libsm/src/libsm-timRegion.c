@@ -0,0 +1,708 @@
+/**
+ * @brief Compiled TIM regions and bulk point-in-region tests
+ */
+
+#include "libsm-timRegion.h"
+#include "Circle.h"
+#include "GeographicalPath.h"
+#include "Node-LL-24B.h"
+#include "Node-LL-28B.h"
+#include "Node-LL-32B.h"
+#include "Node-LL-36B.h"
+#include "Node-LL-44B.h"
+#include "Node-LL-48B.h"
+#include "Node-LLmD-64b.h"
+#include "Node-XY-20b.h"
+#include "Node-XY-22b.h"
+#include "Node-XY-24b.h"
+#include "Node-XY-26b.h"
+#include "Node-XY-28b.h"
+#include "Node-XY-32b.h"
+#include "NodeLL.h"
+#include "NodeListLL.h"
+#include "NodeSetLL.h"
+#include "NodeSetXY.h"
+#include "NodeXY.h"
+#include "OffsetSystem.h"
+#include "RegionOffsets.h"
+#include "RegionPointSet.h"
+#include "ShapePointSet.h"
+#include "TravelerDataFrame.h"
+#include "ValidRegion.h"
+#include "j2735-defines.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+// HeadingSlice sectors are 22.5 degrees, 1800 Heading units
+#define TIM_REGION_SECTOR 1800
+
+// a corridor position further than this from the direction of travel is going the other way
+#define TIM_REGION_DIRECTION_TOLERANCE_DEG 90.0
+
+
+libsm_rval_e libsm_tim_regions_init(libsm_tim_regions_t* set, double defaultWidthM)
+{
+    if (set == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    *set = (libsm_tim_regions_t){ 0 };
+    if (!(defaultWidthM > 0)) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    set->defaultWidthM = defaultWidthM;
+    return LIBSM_OK;
+}
+
+
+void libsm_tim_regions_free(libsm_tim_regions_t* set)
+{
+    if (set == NULL) {
+        return;
+    }
+    free(set->regions);
+    free(set->points);
+    free(set->minLat);
+    free(set->maxLat);
+    free(set->minLong);
+    free(set->maxLong);
+    *set = (libsm_tim_regions_t){ 0 };
+}
+
+
+// grow the region array and the bounding box arrays together
+static bool tim_region_reserve(libsm_tim_regions_t* set, size_t need)
+{
+    if (need <= set->regionCapacity) {
+        return true;
+    }
+    size_t newCap = set->regionCapacity ? set->regionCapacity * 2 : 16;
+    while (newCap < need) {
+        newCap *= 2;
+    }
+    libsm_tim_region_t* regions = realloc(set->regions, newCap * sizeof(libsm_tim_region_t));
+    if (regions == NULL) {
+        return false;
+    }
+    set->regions = regions;
+    Latitude_t* minLat = realloc(set->minLat, newCap * sizeof(Latitude_t));
+    if (minLat == NULL) {
+        return false;
+    }
+    set->minLat = minLat;
+    Latitude_t* maxLat = realloc(set->maxLat, newCap * sizeof(Latitude_t));
+    if (maxLat == NULL) {
+        return false;
+    }
+    set->maxLat = maxLat;
+    Longitude_t* minLong = realloc(set->minLong, newCap * sizeof(Longitude_t));
+    if (minLong == NULL) {
+        return false;
+    }
+    set->minLong = minLong;
+    Longitude_t* maxLong = realloc(set->maxLong, newCap * sizeof(Longitude_t));
+    if (maxLong == NULL) {
+        return false;
+    }
+    set->maxLong = maxLong;
+    set->regionCapacity = newCap;
+    return true;
+}
+
+
+static bool tim_region_add_point(libsm_tim_regions_t* set, double east, double north)
+{
+    if (set->pointCount == set->pointCapacity) {
+        size_t const newCap = set->pointCapacity ? set->pointCapacity * 2 : 64;
+        libsm_tim_region_point_t* points =
+                realloc(set->points, newCap * sizeof(libsm_tim_region_point_t));
+        if (points == NULL) {
+            return false;
+        }
+        set->points = points;
+        set->pointCapacity = newCap;
+    }
+    set->points[set->pointCount++] = (libsm_tim_region_point_t){ east, north };
+    return true;
+}
+
+
+// named bits of a HeadingSlice, bit n of the result is named bit n
+static uint16_t tim_region_headings(HeadingSlice_t const* slice)
+{
+    uint16_t result = 0;
+    if (slice == NULL || slice->buf == NULL) {
+        return 0;
+    }
+    size_t const count = slice->size * 8 - (size_t)slice->bits_unused;
+    for (size_t n = 0; n < count && n < 16; n++) {
+        if (slice->buf[n / 8] & (0x80 >> (n % 8))) {
+            result |= (uint16_t)(1u << n);
+        }
+    }
+    // every sector set is the same as none set
+    return result == 0xFFFF ? 0 : result;
+}
+
+
+// offset of a node from the previous one in 1e-7 degrees, absolute for node_LatLon
+static bool tim_region_ll_delta(NodeOffsetPointLL_t const* delta,
+                                long* lat,
+                                long* Long,
+                                bool* absolute)
+{
+    *absolute = false;
+    switch (delta->present) {
+        case NodeOffsetPointLL_PR_node_LL1:
+            *lat = delta->choice.node_LL1->lat;
+            *Long = delta->choice.node_LL1->lon;
+            return true;
+        case NodeOffsetPointLL_PR_node_LL2:
+            *lat = delta->choice.node_LL2->lat;
+            *Long = delta->choice.node_LL2->lon;
+            return true;
+        case NodeOffsetPointLL_PR_node_LL3:
+            *lat = delta->choice.node_LL3->lat;
+            *Long = delta->choice.node_LL3->lon;
+            return true;
+        case NodeOffsetPointLL_PR_node_LL4:
+            *lat = delta->choice.node_LL4->lat;
+            *Long = delta->choice.node_LL4->lon;
+            return true;
+        case NodeOffsetPointLL_PR_node_LL5:
+            *lat = delta->choice.node_LL5->lat;
+            *Long = delta->choice.node_LL5->lon;
+            return true;
+        case NodeOffsetPointLL_PR_node_LL6:
+            *lat = delta->choice.node_LL6->lat;
+            *Long = delta->choice.node_LL6->lon;
+            return true;
+        case NodeOffsetPointLL_PR_node_LatLon:
+            *lat = delta->choice.node_LatLon->lat;
+            *Long = delta->choice.node_LatLon->lon;
+            *absolute = true;
+            return true;
+        default:
+            return false;
+    }
+}
+
+
+// offset of a node from the previous one in cm, absolute 1e-7 degrees for node_LatLon
+static bool tim_region_xy_delta(NodeOffsetPointXY_t const* delta,
+                                long* x,
+                                long* y,
+                                bool* absolute)
+{
+    *absolute = false;
+    switch (delta->present) {
+        case NodeOffsetPointXY_PR_node_XY1:
+            *x = delta->choice.node_XY1->x;
+            *y = delta->choice.node_XY1->y;
+            return true;
+        case NodeOffsetPointXY_PR_node_XY2:
+            *x = delta->choice.node_XY2->x;
+            *y = delta->choice.node_XY2->y;
+            return true;
+        case NodeOffsetPointXY_PR_node_XY3:
+            *x = delta->choice.node_XY3->x;
+            *y = delta->choice.node_XY3->y;
+            return true;
+        case NodeOffsetPointXY_PR_node_XY4:
+            *x = delta->choice.node_XY4->x;
+            *y = delta->choice.node_XY4->y;
+            return true;
+        case NodeOffsetPointXY_PR_node_XY5:
+            *x = delta->choice.node_XY5->x;
+            *y = delta->choice.node_XY5->y;
+            return true;
+        case NodeOffsetPointXY_PR_node_XY6:
+            *x = delta->choice.node_XY6->x;
+            *y = delta->choice.node_XY6->y;
+            return true;
+        case NodeOffsetPointXY_PR_node_LatLon:
+            *y = delta->choice.node_LatLon->lat;
+            *x = delta->choice.node_LatLon->lon;
+            *absolute = true;
+            return true;
+        default:
+            return false;
+    }
+}
+
+
+static bool tim_region_add_ll_nodes(libsm_tim_regions_t* set,
+                                    libsm_tim_region_t const* region,
+                                    NodeListLL_t const* list)
+{
+    if (list->present != NodeListLL_PR_nodes || list->choice.nodes == NULL) {
+        return true;
+    }
+    long lat = region->anchorLat;
+    long Long = region->anchorLong;
+    for (int i = 0; i < list->choice.nodes->list.count; i++) {
+        long dLat;
+        long dLong;
+        bool absolute;
+        if (!tim_region_ll_delta(&list->choice.nodes->list.array[i]->delta,
+                                 &dLat,
+                                 &dLong,
+                                 &absolute)) {
+            continue;
+        }
+        lat = absolute ? dLat : lat + dLat;
+        Long = absolute ? dLong : Long + dLong;
+        if (!tim_region_add_point(set,
+                                  (double)(Long - region->anchorLong) * region->metersPerLong,
+                                  (double)(lat - region->anchorLat) * region->metersPerLat)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+static bool tim_region_add_xy_nodes(libsm_tim_regions_t* set,
+                                    libsm_tim_region_t const* region,
+                                    NodeListXY_t const* list)
+{
+    if (list->present != NodeListXY_PR_nodes || list->choice.nodes == NULL) {
+        return true;
+    }
+    double east = 0;
+    double north = 0;
+    for (int i = 0; i < list->choice.nodes->list.count; i++) {
+        long x;
+        long y;
+        bool absolute;
+        if (!tim_region_xy_delta(&list->choice.nodes->list.array[i]->delta, &x, &y, &absolute)) {
+            continue;
+        }
+        if (absolute) {
+            east = (double)(x - region->anchorLong) * region->metersPerLong;
+            north = (double)(y - region->anchorLat) * region->metersPerLat;
+        } else {
+            east += (double)x / 100.0;
+            north += (double)y / 100.0;
+        }
+        if (!tim_region_add_point(set, east, north)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+static bool tim_region_add_offsets(libsm_tim_regions_t* set,
+                                   libsm_tim_region_t const* region,
+                                   RegionList_t const* list)
+{
+    long lat = 0;
+    long Long = 0;
+    for (int i = 0; i < list->list.count; i++) {
+        Long += list->list.array[i]->xOffset;
+        lat += list->list.array[i]->yOffset;
+        if (!tim_region_add_point(set,
+                                  (double)Long * region->metersPerLong,
+                                  (double)lat * region->metersPerLat)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+static double tim_region_distance_unit(DistanceUnits_t units)
+{
+    switch (units) {
+        case DistanceUnits_centimeter:
+            return 0.01;
+        case DistanceUnits_cm2_5:
+            return 0.025;
+        case DistanceUnits_decimeter:
+            return 0.1;
+        case DistanceUnits_kilometer:
+            return 1000.0;
+        case DistanceUnits_foot:
+            return 0.3048;
+        case DistanceUnits_yard:
+            return 0.9144;
+        case DistanceUnits_mile:
+            return 1609.344;
+        case DistanceUnits_meter:
+        default:
+            return 1.0;
+    }
+}
+
+
+static void tim_region_anchor(libsm_tim_region_t* region, Position3D_t const* anchor)
+{
+    double const metersPerLat = Latitude_m_per_unit;
+    region->anchorLat = anchor->lat;
+    region->anchorLong = anchor->Long;
+    region->metersPerLat = metersPerLat;
+    region->metersPerLong =
+            metersPerLat * cos((double)anchor->lat / Latitude_unit_deg * (M_PI / 180.0));
+}
+
+
+// bounding box of a region with its points added, widened by the corridor width or radius
+static void tim_region_bounds(libsm_tim_regions_t* set, size_t index)
+{
+    libsm_tim_region_t const* region = &set->regions[index];
+    double minEast = 0;
+    double maxEast = 0;
+    double minNorth = 0;
+    double maxNorth = 0;
+    double margin = region->shape == LIBSM_TIM_REGION_CIRCLE ? region->radiusM : 0;
+    if (region->shape == LIBSM_TIM_REGION_CORRIDOR) {
+        margin = region->halfWidthM;
+    }
+    for (uint32_t i = 0; i < region->pointCount; i++) {
+        libsm_tim_region_point_t const* p = &set->points[region->firstPoint + i];
+        if (i == 0 || p->east < minEast) {
+            minEast = p->east;
+        }
+        if (i == 0 || p->east > maxEast) {
+            maxEast = p->east;
+        }
+        if (i == 0 || p->north < minNorth) {
+            minNorth = p->north;
+        }
+        if (i == 0 || p->north > maxNorth) {
+            maxNorth = p->north;
+        }
+    }
+    set->minLat[index] =
+            region->anchorLat + (Latitude_t)floor((minNorth - margin) / region->metersPerLat);
+    set->maxLat[index] =
+            region->anchorLat + (Latitude_t)ceil((maxNorth + margin) / region->metersPerLat);
+    set->minLong[index] =
+            region->anchorLong + (Longitude_t)floor((minEast - margin) / region->metersPerLong);
+    set->maxLong[index] =
+            region->anchorLong + (Longitude_t)ceil((maxEast + margin) / region->metersPerLong);
+}
+
+
+/*
+ * Compile one GeographicalPath into set->regions[set->regionCount], returns
+ * false on allocation errors only. Regions that cannot be compiled are counted
+ * in skipped.
+ */
+static bool tim_region_add_path(libsm_tim_regions_t* set,
+                                GeographicalPath_t const* path,
+                                uint32_t timId,
+                                uint16_t frame,
+                                uint16_t index)
+{
+    if (!tim_region_reserve(set, set->regionCount + 1)) {
+        return false;
+    }
+    libsm_tim_region_t region = {
+        .timId = timId,
+        .frame = frame,
+        .region = index,
+        .shape = LIBSM_TIM_REGION_CORRIDOR,
+        .directionality = path->directionality ? (uint8_t)*path->directionality
+                                               : DirectionOfUse_unavailable,
+        .headings = tim_region_headings(path->direction),
+        .firstPoint = (uint32_t)set->pointCount,
+        .halfWidthM = (path->laneWidth ? (double)*path->laneWidth / 100.0 : set->defaultWidthM)
+                      / 2.0,
+    };
+    bool const closed = path->closedPath && *path->closedPath;
+    Position3D_t const* anchor = path->anchor;
+    bool added = true;
+    bool supported = true;
+    GeographicalPath__description_PR kind = GeographicalPath__description_PR_NOTHING;
+    if (path->description != NULL) {
+        kind = path->description->present;
+    }
+
+    if (kind == GeographicalPath__description_PR_path) {
+        OffsetSystem_t const* offsets = path->description->choice.path;
+        if (anchor != NULL) {
+            tim_region_anchor(&region, anchor);
+            if (offsets->offset.present == OffsetSystem__offset_PR_ll) {
+                added = tim_region_add_ll_nodes(set, &region, offsets->offset.choice.ll);
+            } else if (offsets->offset.present == OffsetSystem__offset_PR_xy) {
+                added = tim_region_add_xy_nodes(set, &region, offsets->offset.choice.xy);
+            }
+        }
+        region.shape = closed ? LIBSM_TIM_REGION_POLYGON : LIBSM_TIM_REGION_CORRIDOR;
+    } else if (kind == GeographicalPath__description_PR_oldRegion) {
+        ValidRegion_t const* valid = path->description->choice.oldRegion;
+        if (path->direction == NULL) {
+            region.headings = tim_region_headings(&valid->direction);
+        }
+        switch (valid->area.present) {
+            case ValidRegion__area_PR_shapePointSet: {
+                ShapePointSet_t const* shape = valid->area.choice.shapePointSet;
+                anchor = shape->anchor ? shape->anchor : anchor;
+                if (shape->laneWidth) {
+                    region.halfWidthM = (double)*shape->laneWidth / 200.0;
+                }
+                if (shape->directionality) {
+                    region.directionality = (uint8_t)*shape->directionality;
+                }
+                if (anchor != NULL) {
+                    tim_region_anchor(&region, anchor);
+                    added = tim_region_add_xy_nodes(set, &region, &shape->nodeList);
+                }
+                region.shape = closed ? LIBSM_TIM_REGION_POLYGON : LIBSM_TIM_REGION_CORRIDOR;
+            } break;
+            case ValidRegion__area_PR_circle: {
+                Circle_t const* circle = valid->area.choice.circle;
+                anchor = &circle->center;
+                tim_region_anchor(&region, anchor);
+                region.shape = LIBSM_TIM_REGION_CIRCLE;
+                region.radiusM = (double)circle->radius * tim_region_distance_unit(circle->units);
+            } break;
+            case ValidRegion__area_PR_regionPointSet: {
+                RegionPointSet_t const* points = valid->area.choice.regionPointSet;
+                anchor = points->anchor ? points->anchor : anchor;
+                if (anchor != NULL) {
+                    tim_region_anchor(&region, anchor);
+                    added = tim_region_add_offsets(set, &region, &points->nodeList);
+                }
+                region.shape = LIBSM_TIM_REGION_POLYGON;
+            } break;
+            default:
+                supported = false;
+                break;
+        }
+    } else {
+        supported = false;
+    }
+    if (!added) {
+        set->pointCount = region.firstPoint;
+        return false;
+    }
+
+    region.pointCount = (uint32_t)(set->pointCount - region.firstPoint);
+    size_t const minPoints = region.shape == LIBSM_TIM_REGION_POLYGON ? 3
+                           : region.shape == LIBSM_TIM_REGION_CORRIDOR ? 1
+                                                                       : 0;
+    if (!supported || anchor == NULL || region.pointCount < minPoints) {
+        set->pointCount = region.firstPoint;
+        set->skipped++;
+        return true;
+    }
+    set->regions[set->regionCount] = region;
+    tim_region_bounds(set, set->regionCount);
+    set->regionCount++;
+    return true;
+}
+
+
+libsm_rval_e libsm_tim_regions_add(libsm_tim_regions_t* set,
+                                   TravelerInformation_t const* tim,
+                                   uint32_t timId)
+{
+    if (set == NULL || tim == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    libsm_tim_regions_remove(set, timId);
+    for (int f = 0; f < tim->dataFrames.list.count; f++) {
+        TravelerDataFrame_t const* frame = tim->dataFrames.list.array[f];
+        for (int r = 0; r < frame->regions.list.count; r++) {
+            if (!tim_region_add_path(set,
+                                     frame->regions.list.array[r],
+                                     timId,
+                                     (uint16_t)f,
+                                     (uint16_t)r)) {
+                libsm_tim_regions_remove(set, timId);
+                return LIBSM_ALLOC_ERR;
+            }
+        }
+    }
+    return LIBSM_OK;
+}
+
+
+size_t libsm_tim_regions_remove(libsm_tim_regions_t* set, uint32_t timId)
+{
+    if (set == NULL) {
+        return 0;
+    }
+    // regions and their points are kept in insertion order, so compacting only moves down
+    size_t kept = 0;
+    size_t keptPoints = 0;
+    for (size_t r = 0; r < set->regionCount; r++) {
+        libsm_tim_region_t region = set->regions[r];
+        if (region.timId == timId) {
+            continue;
+        }
+        memmove(&set->points[keptPoints],
+                &set->points[region.firstPoint],
+                region.pointCount * sizeof(libsm_tim_region_point_t));
+        region.firstPoint = (uint32_t)keptPoints;
+        keptPoints += region.pointCount;
+        set->regions[kept] = region;
+        set->minLat[kept] = set->minLat[r];
+        set->maxLat[kept] = set->maxLat[r];
+        set->minLong[kept] = set->minLong[r];
+        set->maxLong[kept] = set->maxLong[r];
+        kept++;
+    }
+    size_t const removed = set->regionCount - kept;
+    set->regionCount = kept;
+    set->pointCount = keptPoints;
+    return removed;
+}
+
+
+static double tim_region_angle_diff(double a, double b)
+{
+    double const d = fmod(fabs(a - b), 360.0);
+    return d > 180.0 ? 360.0 - d : d;
+}
+
+
+static bool tim_region_in_corridor(libsm_tim_region_t const* region,
+                                   libsm_tim_region_point_t const* points,
+                                   double east,
+                                   double north,
+                                   Heading_t heading,
+                                   bool hasHeading)
+{
+    double const limit = region->halfWidthM * region->halfWidthM;
+    if (region->pointCount == 1) {
+        double const de = east - points[0].east;
+        double const dn = north - points[0].north;
+        return de * de + dn * dn <= limit;
+    }
+    double best = INFINITY;
+    double bearing = 0;
+    for (uint32_t i = 0; i + 1 < region->pointCount; i++) {
+        double const ax = points[i].east;
+        double const ay = points[i].north;
+        double const dx = points[i + 1].east - ax;
+        double const dy = points[i + 1].north - ay;
+        double const len2 = dx * dx + dy * dy;
+        double t = len2 > 0 ? ((east - ax) * dx + (north - ay) * dy) / len2 : 0;
+        t = t < 0 ? 0 : (t > 1 ? 1 : t);
+        double const ex = east - (ax + t * dx);
+        double const ey = north - (ay + t * dy);
+        double const d2 = ex * ex + ey * ey;
+        if (d2 < best) {
+            best = d2;
+            bearing = atan2(dx, dy) * (180.0 / M_PI);
+        }
+    }
+    if (best > limit) {
+        return false;
+    }
+    if (!hasHeading || (region->directionality != DirectionOfUse_forward &&
+                        region->directionality != DirectionOfUse_reverse)) {
+        return true;
+    }
+    if (region->directionality == DirectionOfUse_reverse) {
+        bearing += 180.0;
+    }
+    return tim_region_angle_diff((double)heading * 0.0125, bearing)
+           < TIM_REGION_DIRECTION_TOLERANCE_DEG;
+}
+
+
+// crossing number test
+static bool tim_region_in_polygon(libsm_tim_region_t const* region,
+                                  libsm_tim_region_point_t const* points,
+                                  double east,
+                                  double north)
+{
+    bool inside = false;
+    for (uint32_t i = 0, j = region->pointCount - 1; i < region->pointCount; j = i++) {
+        if ((points[i].north > north) != (points[j].north > north)) {
+            double const crossEast = points[i].east
+                                     + (north - points[i].north)
+                                               * (points[j].east - points[i].east)
+                                               / (points[j].north - points[i].north);
+            if (east < crossEast) {
+                inside = !inside;
+            }
+        }
+    }
+    return inside;
+}
+
+
+// everything but the bounding box
+static bool tim_region_test(libsm_tim_regions_t const* set,
+                            libsm_tim_region_t const* region,
+                            Latitude_t lat,
+                            Longitude_t Long,
+                            Heading_t heading)
+{
+    bool const hasHeading = heading >= 0 && heading < Heading_unavailable;
+    if (hasHeading && region->headings != 0
+        && !(region->headings & (1u << (heading / TIM_REGION_SECTOR)))) {
+        return false;
+    }
+    double const east = (double)(Long - region->anchorLong) * region->metersPerLong;
+    double const north = (double)(lat - region->anchorLat) * region->metersPerLat;
+    libsm_tim_region_point_t const* points = &set->points[region->firstPoint];
+    switch (region->shape) {
+        case LIBSM_TIM_REGION_CIRCLE:
+            return east * east + north * north <= region->radiusM * region->radiusM;
+        case LIBSM_TIM_REGION_POLYGON:
+            return tim_region_in_polygon(region, points, east, north);
+        case LIBSM_TIM_REGION_CORRIDOR:
+        default:
+            return tim_region_in_corridor(region, points, east, north, heading, hasHeading);
+    }
+}
+
+
+bool libsm_tim_regions_contains(libsm_tim_regions_t const* set,
+                                size_t index,
+                                Latitude_t lat,
+                                Longitude_t Long,
+                                Heading_t heading)
+{
+    if (set == NULL || index >= set->regionCount) {
+        return false;
+    }
+    if (lat < set->minLat[index] || lat > set->maxLat[index] || Long < set->minLong[index]
+        || Long > set->maxLong[index]) {
+        return false;
+    }
+    return tim_region_test(set, &set->regions[index], lat, Long, heading);
+}
+
+
+libsm_rval_e libsm_tim_regions_match(libsm_tim_regions_t const* set,
+                                     Latitude_t const* lats,
+                                     Longitude_t const* longs,
+                                     Heading_t const* headings,
+                                     size_t count,
+                                     libsm_tim_regions_cb callback,
+                                     void* user)
+{
+    if (set == NULL || lats == NULL || longs == NULL || callback == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    for (size_t r = 0; r < set->regionCount; r++) {
+        Latitude_t const minLat = set->minLat[r];
+        Latitude_t const maxLat = set->maxLat[r];
+        Longitude_t const minLong = set->minLong[r];
+        Longitude_t const maxLong = set->maxLong[r];
+        libsm_tim_region_t const* region = &set->regions[r];
+        for (size_t i = 0; i < count; i++) {
+            // non short circuit, the four compares are cheaper than the branches
+            bool const inBox = (lats[i] >= minLat) & (lats[i] <= maxLat) & (longs[i] >= minLong)
+                               & (longs[i] <= maxLong);
+            if (!inBox) {
+                continue;
+            }
+            Heading_t const heading = headings ? headings[i] : Heading_unavailable;
+            if (tim_region_test(set, region, lats[i], longs[i], heading)) {
+                callback(user, i, region);
+            }
+        }
+    }
+    return LIBSM_OK;
+}
@@ -0,0 +1,184 @@
+/**
+ * @brief Compiled TIM regions and bulk point-in-region tests
+ *
+ * libsm_tim_regions_add walks the TravelerDataFrame regions of a decoded TIM
+ * once and keeps every GeographicalPath as an absolute shape: a corridor along
+ * a path with half the lane width on each side, a polygon for closed paths and
+ * region point sets, or a circle. Each shape keeps its nodes in meters east and
+ * north of its anchor, its HeadingSlice and directionality, and a bounding box
+ * in Latitude_t/Longitude_t units.
+ *
+ * The bounding boxes are kept in separate arrays, so libsm_tim_regions_match
+ * rejects most (region, position) pairs with four integer compares over
+ * contiguous memory before any geometry is done.
+ *
+ * GeometricProjection regions and Zoom scales are not supported, such regions
+ * are counted in skipped.
+ */
+
+#ifndef LIBSM_TIM_REGION_H
+#define LIBSM_TIM_REGION_H
+
+#include "Heading.h"
+#include "Latitude.h"
+#include "Longitude.h"
+#include "TravelerInformation.h"
+#include "libsm-error.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/** @brief Region shapes */
+#define LIBSM_TIM_REGION_CORRIDOR 1
+#define LIBSM_TIM_REGION_POLYGON  2
+#define LIBSM_TIM_REGION_CIRCLE   3
+
+/** @brief One region node */
+typedef struct {
+    double east; /**< @brief meters from the region anchor */
+    double north;
+} libsm_tim_region_point_t;
+
+/** @brief One compiled GeographicalPath */
+typedef struct {
+    uint32_t timId;         /**< @brief as given to libsm_tim_regions_add */
+    uint16_t frame;         /**< @brief index of the TravelerDataFrame in the TIM */
+    uint16_t region;        /**< @brief index of the GeographicalPath in the frame */
+    uint8_t shape;          /**< @brief LIBSM_TIM_REGION_CORRIDOR, _POLYGON or _CIRCLE */
+    uint8_t directionality; /**< @brief DirectionOfUse, for corridors */
+    uint16_t headings;      /**< @brief HeadingSlice bits, bit n is named bit n, 0 for any */
+    Latitude_t anchorLat;
+    Longitude_t anchorLong;
+    double metersPerLat;
+    double metersPerLong;
+    uint32_t firstPoint;    /**< @brief index into points */
+    uint32_t pointCount;
+    double halfWidthM;      /**< @brief corridors */
+    double radiusM;         /**< @brief circles */
+} libsm_tim_region_t;
+
+/** @brief The regions of all active TIMs */
+typedef struct {
+    double defaultWidthM; /**< @brief corridor width when the TIM does not give one */
+
+    libsm_tim_region_t* regions;
+    size_t regionCount;
+    size_t regionCapacity;
+    libsm_tim_region_point_t* points;
+    size_t pointCount;
+    size_t pointCapacity;
+
+    // bounding boxes, one per region
+    Latitude_t* minLat;
+    Latitude_t* maxLat;
+    Longitude_t* minLong;
+    Longitude_t* maxLong;
+
+    size_t skipped; /**< @brief regions without an anchor or nodes, or not supported */
+} libsm_tim_regions_t;
+
+/**
+ * @brief Called by libsm_tim_regions_match for every position inside a region
+ *
+ * @param user As given to libsm_tim_regions_match
+ * @param position Index of the position
+ * @param region The region
+ */
+typedef void (*libsm_tim_regions_cb)(void* user,
+                                     size_t position,
+                                     libsm_tim_region_t const* region);
+
+
+/**
+ * @brief Initialize an empty set of regions
+ *
+ * @param set The set, free with libsm_tim_regions_free
+ * @param defaultWidthM Corridor width when a path has no laneWidth
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG set was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER defaultWidthM was not positive
+ */
+libsm_rval_e libsm_tim_regions_init(libsm_tim_regions_t* set, double defaultWidthM);
+
+
+/**
+ * @brief Free a set of regions
+ */
+void libsm_tim_regions_free(libsm_tim_regions_t* set);
+
+
+/**
+ * @brief Compile the regions of a decoded TIM
+ *
+ * Regions previously added with the same timId are replaced.
+ *
+ * @param set The set
+ * @param tim The message
+ * @param timId Caller chosen key, e.g. the packetID or msgCnt of the TIM
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG set or tim was NULL
+ * @retval LIBSM_ALLOC_ERR Allocation error, the TIM is not added
+ */
+libsm_rval_e libsm_tim_regions_add(libsm_tim_regions_t* set,
+                                   TravelerInformation_t const* tim,
+                                   uint32_t timId);
+
+
+/**
+ * @brief Remove the regions of a TIM
+ *
+ * @return Number of regions removed
+ */
+size_t libsm_tim_regions_remove(libsm_tim_regions_t* set, uint32_t timId);
+
+
+/**
+ * @brief Whether a position is inside one region
+ *
+ * The HeadingSlice and the directionality of corridors are only checked when
+ * heading is not Heading_unavailable.
+ *
+ * @param set The set
+ * @param index Index of the region
+ * @param lat Latitude of the position
+ * @param Long Longitude of the position
+ * @param heading Heading of the position
+ */
+bool libsm_tim_regions_contains(libsm_tim_regions_t const* set,
+                                size_t index,
+                                Latitude_t lat,
+                                Longitude_t Long,
+                                Heading_t heading);
+
+
+/**
+ * @brief Test positions against every region
+ *
+ * callback is called once for every (position, region) pair where the position
+ * is inside the region, region by region and in position order within a region.
+ *
+ * @param set The set
+ * @param lats count latitudes
+ * @param longs count longitudes
+ * @param headings count headings, or NULL to ignore headings
+ * @param count Number of positions
+ * @param callback Called for every match
+ * @param user Passed to callback
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG set, lats, longs or callback was NULL
+ */
+libsm_rval_e libsm_tim_regions_match(libsm_tim_regions_t const* set,
+                                     Latitude_t const* lats,
+                                     Longitude_t const* longs,
+                                     Heading_t const* headings,
+                                     size_t count,
+                                     libsm_tim_regions_cb callback,
+                                     void* user);
+
+
+#endif // LIBSM_TIM_REGION_H
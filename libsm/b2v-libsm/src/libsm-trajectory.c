@@ -0,0 +1,570 @@
+/**
+ * @brief Streaming trajectory reconstruction from BSM and PSM coreData
+ */
+
+#include "libsm-trajectory.h"
+#include "j2735-defines.h"
+#include "libsm-hash.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#define TRAJ_MINUTE_MS       60000
+#define TRAJ_SECMARK_LEAP    60999
+
+
+typedef struct {
+    uint64_t timeMs;
+    int32_t lat;
+    int32_t Long;
+    uint16_t speed;
+    uint16_t heading;
+    uint8_t msgCnt;
+} traj_point_t;
+
+struct libsm_traj_track {
+    uint64_t key;
+    bool inUse;
+
+    traj_point_t pending[LIBSM_TRAJ_REORDER_SIZE]; // oldest first
+    uint32_t pendingCount;
+    traj_point_t newest;
+
+    bool hasCommitted;
+    traj_point_t lastCommitted;
+
+    uint64_t trajectory;
+    uint64_t linkedFrom;
+    bool linkedTo;
+    uint32_t segment;
+    uint64_t segmentStartMs;
+    size_t segmentCount;
+
+    // maxSegmentPoints each, allocated on first use and kept with the slot
+    uint32_t* timeOffsetMs;
+    int32_t* lat;
+    int32_t* Long;
+    uint16_t* speed;
+    uint16_t* heading;
+    uint8_t* msgCnt;
+};
+
+
+static uint64_t traj_key(libsm_traj_sample_t const* sample)
+{
+    return ((uint64_t)sample->source << 32) | sample->id;
+}
+
+
+void libsm_traj_default_config(libsm_traj_config_t* config)
+{
+    if (config == NULL) {
+        return;
+    }
+    config->maxTracks = 4096;
+    config->maxSegmentPoints = 600;
+    config->reorderWindowMs = 1000;
+    config->gapMs = 5000;
+    config->linkWindowMs = 3000;
+    config->linkDistanceM = 30.0;
+}
+
+
+libsm_rval_e libsm_traj_init(libsm_traj_t* tr,
+                             libsm_traj_config_t const* config,
+                             libsm_traj_emit_f emit,
+                             void* user)
+{
+    if (tr == NULL || emit == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    *tr = (libsm_traj_t){ 0 };
+    if (config != NULL) {
+        tr->config = *config;
+    } else {
+        libsm_traj_default_config(&tr->config);
+    }
+    if (tr->config.maxTracks == 0 || tr->config.maxTracks > INT32_MAX
+        || tr->config.maxSegmentPoints == 0) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    tr->emit = emit;
+    tr->user = user;
+    tr->nextTrajectory = 1;
+
+    size_t const indexSize = libsm_index_size(tr->config.maxTracks);
+    tr->indexMask = indexSize - 1;
+
+    tr->tracks = calloc(tr->config.maxTracks, sizeof(libsm_traj_track_t));
+    tr->freeList = malloc(tr->config.maxTracks * sizeof(int32_t));
+    tr->index = libsm_index_alloc(indexSize);
+    if (tr->tracks == NULL || tr->freeList == NULL || tr->index == NULL) {
+        libsm_traj_free(tr);
+        return LIBSM_ALLOC_ERR;
+    }
+    // hand out low indices first
+    for (size_t i = 0; i < tr->config.maxTracks; i++) {
+        tr->freeList[i] = (int32_t)(tr->config.maxTracks - 1 - i);
+    }
+    tr->freeCount = tr->config.maxTracks;
+    return LIBSM_OK;
+}
+
+
+void libsm_traj_free(libsm_traj_t* tr)
+{
+    if (tr == NULL) {
+        return;
+    }
+    if (tr->tracks != NULL) {
+        for (size_t i = 0; i < tr->config.maxTracks; i++) {
+            free(tr->tracks[i].timeOffsetMs);
+        }
+    }
+    free(tr->tracks);
+    free(tr->freeList);
+    free(tr->index);
+    tr->tracks = NULL;
+    tr->freeList = NULL;
+    tr->index = NULL;
+}
+
+
+static libsm_rval_e traj_read_id(TemporaryID_t const* id, uint32_t* out)
+{
+    if (id->buf == NULL || id->size != 4) {
+        return LIBSM_FAIL_CONSTRAINT;
+    }
+    *out = ((uint32_t)id->buf[0] << 24) | ((uint32_t)id->buf[1] << 16)
+           | ((uint32_t)id->buf[2] << 8) | (uint32_t)id->buf[3];
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_traj_sample_from_bsm(BasicSafetyMessage_t const* bsm,
+                                        uint64_t rxTimeMs,
+                                        libsm_traj_sample_t* sample)
+{
+    if (bsm == NULL || sample == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    BSMcoreData_t const* core = &bsm->coreData;
+    *sample = (libsm_traj_sample_t){
+        .source = LIBSM_TRAJ_SOURCE_BSM,
+        .msgCnt = (uint8_t)core->msgCnt,
+        .secMark = (uint16_t)core->secMark,
+        .lat = core->lat,
+        .Long = core->Long,
+        .speed = (uint16_t)core->speed,
+        .heading = (uint16_t)core->heading,
+        .rxTimeMs = rxTimeMs,
+    };
+    return traj_read_id(&core->id, &sample->id);
+}
+
+
+libsm_rval_e libsm_traj_sample_from_psm(PersonalSafetyMessage_t const* psm,
+                                        uint64_t rxTimeMs,
+                                        libsm_traj_sample_t* sample)
+{
+    if (psm == NULL || sample == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    *sample = (libsm_traj_sample_t){
+        .source = LIBSM_TRAJ_SOURCE_PSM,
+        .msgCnt = (uint8_t)psm->msgCnt,
+        .secMark = (uint16_t)psm->secMark,
+        .lat = psm->position.lat,
+        .Long = psm->position.Long,
+        .speed = (uint16_t)psm->speed,
+        .heading = (uint16_t)psm->heading,
+        .rxTimeMs = rxTimeMs,
+    };
+    return traj_read_id(&psm->id, &sample->id);
+}
+
+
+uint64_t libsm_traj_sample_time(libsm_traj_sample_t const* sample)
+{
+    if (sample->secMark > TRAJ_SECMARK_LEAP) {
+        return sample->rxTimeMs;
+    }
+    // a leap second is folded into the last millisecond of the minute
+    int64_t const secMark
+            = sample->secMark < TRAJ_MINUTE_MS ? sample->secMark : TRAJ_MINUTE_MS - 1;
+    int64_t const rx = (int64_t)sample->rxTimeMs;
+    int64_t t = rx - rx % TRAJ_MINUTE_MS + secMark;
+
+    if (t - rx > TRAJ_MINUTE_MS / 2) {
+        t -= TRAJ_MINUTE_MS;
+    } else if (rx - t > TRAJ_MINUTE_MS / 2) {
+        t += TRAJ_MINUTE_MS;
+    }
+    return t < 0 ? sample->rxTimeMs : (uint64_t)t;
+}
+
+
+uint32_t libsm_traj_shard(libsm_traj_sample_t const* sample, uint32_t shards)
+{
+    if (sample == NULL || shards == 0) {
+        return 0;
+    }
+    return (uint32_t)(libsm_mix64(traj_key(sample)) % shards);
+}
+
+
+static uint64_t traj_track_key(void const* tracks, int32_t i)
+{
+    return ((libsm_traj_track_t const*)tracks)[i].key;
+}
+
+
+// index slot holding key, or the empty slot where it would go
+static size_t traj_lookup(libsm_traj_t const* tr, uint64_t key)
+{
+    return libsm_index_find(tr->index, tr->indexMask, key, traj_track_key, tr->tracks);
+}
+
+
+static double traj_distance(traj_point_t const* a, traj_point_t const* b)
+{
+    double const cosLat = cos((double)a->lat / Latitude_unit_deg * (M_PI / 180.0));
+    double const dy = (double)(b->lat - a->lat) * Latitude_m_per_unit;
+    double const dx = (double)(b->Long - a->Long) * Latitude_m_per_unit * cosLat;
+    return hypot(dx, dy);
+}
+
+
+static void traj_emit(libsm_traj_t* tr, libsm_traj_track_t* track, bool final)
+{
+    libsm_traj_segment_t const segment = {
+        .trajectory = track->trajectory,
+        .linkedFrom = track->linkedFrom,
+        .source = (libsm_traj_source_e)(track->key >> 32),
+        .id = (uint32_t)track->key,
+        .segment = track->segment,
+        .final = final,
+        .startTimeMs = track->segmentStartMs,
+        .count = track->segmentCount,
+        .timeOffsetMs = track->timeOffsetMs,
+        .lat = track->lat,
+        .Long = track->Long,
+        .speed = track->speed,
+        .heading = track->heading,
+        .msgCnt = track->msgCnt,
+    };
+    tr->emit(tr->user, &segment);
+    tr->stats.segments++;
+    track->segment++;
+    track->segmentCount = 0;
+}
+
+
+static void traj_start_trajectory(libsm_traj_t* tr, libsm_traj_track_t* track)
+{
+    track->trajectory = tr->nextTrajectory++;
+    track->linkedFrom = 0;
+    track->linkedTo = false;
+    track->segment = 0;
+    track->segmentCount = 0;
+    tr->stats.trajectories++;
+}
+
+
+static libsm_rval_e traj_commit(libsm_traj_t* tr,
+                                libsm_traj_track_t* track,
+                                traj_point_t const* point)
+{
+    size_t const points = tr->config.maxSegmentPoints;
+
+    if (track->timeOffsetMs == NULL) {
+        // one block per track, the widest column first so all stay aligned
+        uint8_t* block = malloc(points * (4 + 4 + 4 + 2 + 2 + 1));
+        if (block == NULL) {
+            return LIBSM_ALLOC_ERR;
+        }
+        track->timeOffsetMs = (uint32_t*)block;
+        track->lat = (int32_t*)(block + points * 4);
+        track->Long = (int32_t*)(block + points * 8);
+        track->speed = (uint16_t*)(block + points * 12);
+        track->heading = (uint16_t*)(block + points * 14);
+        track->msgCnt = block + points * 16;
+    }
+
+    if (track->hasCommitted && point->timeMs - track->lastCommitted.timeMs > tr->config.gapMs) {
+        if (track->segmentCount > 0) {
+            traj_emit(tr, track, true);
+        }
+        traj_start_trajectory(tr, track);
+    }
+    if (track->segmentCount == points) {
+        traj_emit(tr, track, false);
+    }
+    if (track->segmentCount == 0) {
+        track->segmentStartMs = point->timeMs;
+    }
+
+    size_t const i = track->segmentCount++;
+    track->timeOffsetMs[i] = (uint32_t)(point->timeMs - track->segmentStartMs);
+    track->lat[i] = point->lat;
+    track->Long[i] = point->Long;
+    track->speed[i] = point->speed;
+    track->heading[i] = point->heading;
+    track->msgCnt[i] = point->msgCnt;
+
+    track->lastCommitted = *point;
+    track->hasCommitted = true;
+    return LIBSM_OK;
+}
+
+
+// append the buffered samples up to and including uptoMs
+static libsm_rval_e traj_release(libsm_traj_t* tr, libsm_traj_track_t* track, uint64_t uptoMs)
+{
+    uint32_t released = 0;
+    libsm_rval_e err = LIBSM_OK;
+
+    while (released < track->pendingCount && track->pending[released].timeMs <= uptoMs) {
+        err = traj_commit(tr, track, &track->pending[released]);
+        if (err != LIBSM_OK) {
+            break;
+        }
+        released++;
+    }
+    if (released > 0) {
+        track->pendingCount -= released;
+        memmove(track->pending,
+                track->pending + released,
+                track->pendingCount * sizeof(traj_point_t));
+    }
+    return err;
+}
+
+
+static libsm_rval_e traj_finish(libsm_traj_t* tr, libsm_traj_track_t* track)
+{
+    libsm_rval_e const err = traj_release(tr, track, UINT64_MAX);
+
+    if (track->segmentCount > 0) {
+        traj_emit(tr, track, true);
+    }
+    libsm_index_remove(tr->index, tr->indexMask, traj_lookup(tr, track->key), traj_track_key,
+                       tr->tracks);
+    track->inUse = false;
+    tr->freeList[tr->freeCount++] = (int32_t)(track - tr->tracks);
+    return err;
+}
+
+
+// the trajectory of another ID that stopped just before point, close to it
+static libsm_traj_track_t* traj_find_link(libsm_traj_t* tr,
+                                          libsm_traj_track_t const* track,
+                                          traj_point_t const* point)
+{
+    libsm_traj_track_t* best = NULL;
+    double bestDistance = tr->config.linkDistanceM;
+
+    for (size_t i = 0; i < tr->config.maxTracks; i++) {
+        libsm_traj_track_t* other = &tr->tracks[i];
+
+        if (!other->inUse || other == track || other->linkedTo
+            || (other->key >> 32) != (track->key >> 32) || other->newest.timeMs > point->timeMs
+            || point->timeMs - other->newest.timeMs > tr->config.linkWindowMs) {
+            continue;
+        }
+        double const distance = traj_distance(&other->newest, point);
+        if (distance <= bestDistance) {
+            best = other;
+            bestDistance = distance;
+        }
+    }
+    return best;
+}
+
+
+static libsm_rval_e traj_create(libsm_traj_t* tr,
+                                size_t slot,
+                                uint64_t key,
+                                traj_point_t const* point,
+                                libsm_traj_track_t** created)
+{
+    if (tr->freeCount == 0) {
+        // make room by finishing whichever device was heard from longest ago
+        libsm_traj_track_t* stalest = NULL;
+        for (size_t i = 0; i < tr->config.maxTracks; i++) {
+            if (stalest == NULL || tr->tracks[i].newest.timeMs < stalest->newest.timeMs) {
+                stalest = &tr->tracks[i];
+            }
+        }
+        libsm_rval_e err = traj_finish(tr, stalest);
+        tr->stats.evicted++;
+        if (err != LIBSM_OK) {
+            return err;
+        }
+        slot = traj_lookup(tr, key);
+    }
+
+    int32_t const index = tr->freeList[--tr->freeCount];
+    libsm_traj_track_t* track = &tr->tracks[index];
+    uint32_t* columns = track->timeOffsetMs;
+    uint8_t* msgCnt = track->msgCnt;
+    uint16_t* heading = track->heading;
+    uint16_t* speed = track->speed;
+    int32_t* Long = track->Long;
+    int32_t* lat = track->lat;
+
+    *track = (libsm_traj_track_t){
+        .key = key,
+        .inUse = true,
+        .newest = *point,
+        .timeOffsetMs = columns,
+        .lat = lat,
+        .Long = Long,
+        .speed = speed,
+        .heading = heading,
+        .msgCnt = msgCnt,
+    };
+    tr->index[slot] = index;
+    traj_start_trajectory(tr, track);
+
+    if (tr->config.linkDistanceM > 0) {
+        libsm_traj_track_t* previous = traj_find_link(tr, track, point);
+        if (previous != NULL) {
+            previous->linkedTo = true;
+            track->linkedFrom = previous->trajectory;
+            tr->stats.linked++;
+        }
+    }
+    *created = track;
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_traj_add(libsm_traj_t* tr, libsm_traj_sample_t const* sample)
+{
+    libsm_rval_e err;
+
+    if (tr == NULL || sample == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (sample->lat < Latitude_min || sample->lat > Latitude_max || sample->Long < Longitude_min
+        || sample->Long > Longitude_max) {
+        return LIBSM_OK;
+    }
+    tr->stats.samples++;
+
+    traj_point_t const point = {
+        .timeMs = libsm_traj_sample_time(sample),
+        .lat = (int32_t)sample->lat,
+        .Long = (int32_t)sample->Long,
+        .speed = sample->speed,
+        .heading = sample->heading,
+        .msgCnt = sample->msgCnt,
+    };
+    uint64_t const key = traj_key(sample);
+    size_t const slot = traj_lookup(tr, key);
+    libsm_traj_track_t* track;
+
+    if (tr->index[slot] < 0) {
+        err = traj_create(tr, slot, key, &point, &track);
+        if (err != LIBSM_OK) {
+            return err;
+        }
+    } else {
+        track = &tr->tracks[tr->index[slot]];
+    }
+
+    if (track->hasCommitted && point.timeMs <= track->lastCommitted.timeMs) {
+        if (point.timeMs == track->lastCommitted.timeMs
+            && point.msgCnt == track->lastCommitted.msgCnt) {
+            tr->stats.duplicates++;
+        } else {
+            tr->stats.late++;
+        }
+        return LIBSM_OK;
+    }
+
+    // insertion sort into the reorder buffer, newest samples usually land at the end
+    uint32_t at = track->pendingCount;
+    while (at > 0 && track->pending[at - 1].timeMs > point.timeMs) {
+        at--;
+    }
+    if (at > 0 && track->pending[at - 1].timeMs == point.timeMs
+        && track->pending[at - 1].msgCnt == point.msgCnt) {
+        tr->stats.duplicates++;
+        return LIBSM_OK;
+    }
+    if (track->pendingCount == LIBSM_TRAJ_REORDER_SIZE) {
+        if (at == 0) {
+            // older than everything in a full buffer, it goes straight out
+            return traj_commit(tr, track, &point);
+        }
+        uint32_t const before = track->pendingCount;
+        err = traj_release(tr, track, track->pending[0].timeMs);
+        if (err != LIBSM_OK) {
+            return err;
+        }
+        at -= before - track->pendingCount;
+    }
+    memmove(&track->pending[at + 1],
+            &track->pending[at],
+            (track->pendingCount - at) * sizeof(traj_point_t));
+    track->pending[at] = point;
+    track->pendingCount++;
+
+    if (point.timeMs >= track->newest.timeMs) {
+        track->newest = point;
+    }
+    if (track->newest.timeMs >= tr->config.reorderWindowMs) {
+        return traj_release(tr, track, track->newest.timeMs - tr->config.reorderWindowMs);
+    }
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_traj_advance(libsm_traj_t* tr, uint64_t nowMs)
+{
+    libsm_rval_e result = LIBSM_OK;
+
+    if (tr == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    for (size_t i = 0; i < tr->config.maxTracks; i++) {
+        libsm_traj_track_t* track = &tr->tracks[i];
+        libsm_rval_e err = LIBSM_OK;
+
+        if (!track->inUse) {
+            continue;
+        }
+        if (nowMs >= track->newest.timeMs + tr->config.gapMs) {
+            err = traj_finish(tr, track);
+        } else if (nowMs >= tr->config.reorderWindowMs) {
+            err = traj_release(tr, track, nowMs - tr->config.reorderWindowMs);
+        }
+        if (err != LIBSM_OK) {
+            result = err;
+        }
+    }
+    return result;
+}
+
+
+libsm_rval_e libsm_traj_flush(libsm_traj_t* tr)
+{
+    libsm_rval_e result = LIBSM_OK;
+
+    if (tr == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    for (size_t i = 0; i < tr->config.maxTracks; i++) {
+        if (tr->tracks[i].inUse) {
+            libsm_rval_e err = traj_finish(tr, &tr->tracks[i]);
+            if (err != LIBSM_OK) {
+                result = err;
+            }
+        }
+    }
+    return result;
+}
@@ -0,0 +1,230 @@
+/**
+ * @brief Streaming trajectory reconstruction from BSM and PSM coreData
+ *
+ * Samples are fed in as they are read, in any order within reorderWindowMs
+ * per device. Each TemporaryID gets a small time sorted reorder buffer. Samples
+ * that leave it are appended to the trajectory being built. A trajectory is
+ * split when the time between two samples is more than gapMs, and is finished
+ * once nothing has been heard for gapMs. Long trajectories are emitted in
+ * segments of at most maxSegmentPoints, so memory stays bounded by maxTracks.
+ *
+ * secMark only counts milliseconds within the minute. It is resolved against
+ * the receive time: the sample time is the instant nearest to rxTimeMs that has
+ * that secMark.
+ *
+ * When a device starts using a new TemporaryID, the new trajectory is linked
+ * to a trajectory of another ID that stopped just before, close enough to
+ * where the new one starts.
+ *
+ * A tracker is single threaded and keeps no global state. To use more cores,
+ * run one tracker per thread and route samples with libsm_traj_shard. Links
+ * across an ID change are only found within a shard.
+ */
+
+#ifndef LIBSM_TRAJECTORY_H
+#define LIBSM_TRAJECTORY_H
+
+#include "libsm-error.h"
+#include <BasicSafetyMessage.h>
+#include <PersonalSafetyMessage.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/** Samples held back per device to put them in time order */
+#define LIBSM_TRAJ_REORDER_SIZE 32
+
+/** @brief Which message a sample came from */
+typedef enum {
+    LIBSM_TRAJ_SOURCE_BSM,
+    LIBSM_TRAJ_SOURCE_PSM,
+} libsm_traj_source_e;
+
+/** @brief One position report */
+typedef struct {
+    libsm_traj_source_e source;
+    uint32_t id;        /**< @brief TemporaryID, big endian */
+    uint8_t msgCnt;
+    uint16_t secMark;   /**< @brief DSecond, 65535 if unavailable */
+    Latitude_t lat;
+    Longitude_t Long;
+    uint16_t speed;     /**< @brief 0.02 m/s, Speed_t or Velocity_t */
+    uint16_t heading;   /**< @brief 0.0125 degrees */
+    uint64_t rxTimeMs;  /**< @brief receive or log time, ms since the epoch */
+} libsm_traj_sample_t;
+
+/**
+ * @brief A piece of a trajectory, in columns
+ *
+ * The arrays belong to the tracker and are only valid during the callback.
+ */
+typedef struct {
+    uint64_t trajectory; /**< @brief number of the trajectory, starting at 1 */
+    uint64_t linkedFrom; /**< @brief trajectory continued under a new ID, 0 if none */
+    libsm_traj_source_e source;
+    uint32_t id;
+    uint32_t segment;    /**< @brief index of this segment within the trajectory */
+    bool final;          /**< @brief this is the last segment of the trajectory */
+
+    uint64_t startTimeMs;         /**< @brief time of the first point */
+    size_t count;                 /**< @brief number of points */
+    const uint32_t* timeOffsetMs; /**< @brief time of each point since startTimeMs */
+    const int32_t* lat;
+    const int32_t* Long;
+    const uint16_t* speed;
+    const uint16_t* heading;
+    const uint8_t* msgCnt;
+} libsm_traj_segment_t;
+
+typedef void (*libsm_traj_emit_f)(void* user, libsm_traj_segment_t const* segment);
+
+/** @brief Tracker settings, see libsm_traj_default_config */
+typedef struct {
+    size_t maxTracks;         /**< @brief devices tracked at once, the stalest is finished early */
+    size_t maxSegmentPoints;  /**< @brief points per emitted segment */
+    uint64_t reorderWindowMs; /**< @brief how late a sample may arrive */
+    uint64_t gapMs;           /**< @brief silence that ends a trajectory */
+    uint64_t linkWindowMs;    /**< @brief how soon after an old ID a new one may take over */
+    double linkDistanceM;     /**< @brief how far apart, at most, 0 disables linking */
+} libsm_traj_config_t;
+
+/** @brief Counters */
+typedef struct {
+    uint64_t samples;      /**< @brief samples added */
+    uint64_t late;         /**< @brief dropped, older than what was already emitted */
+    uint64_t duplicates;   /**< @brief dropped, same time and msgCnt as a buffered sample */
+    uint64_t trajectories; /**< @brief trajectories started */
+    uint64_t segments;     /**< @brief segments emitted */
+    uint64_t linked;       /**< @brief trajectories linked across an ID change */
+    uint64_t evicted;      /**< @brief tracks finished early to make room */
+} libsm_traj_stats_t;
+
+typedef struct libsm_traj_track libsm_traj_track_t;
+
+/** @brief Tracker state */
+typedef struct {
+    libsm_traj_config_t config;
+    libsm_traj_emit_f emit;
+    void* user;
+
+    libsm_traj_track_t* tracks; /**< @brief maxTracks tracks */
+    int32_t* freeList;          /**< @brief unused track indices */
+    size_t freeCount;
+    int32_t* index;             /**< @brief open addressing table of track indices, -1 empty */
+    size_t indexMask;
+
+    uint64_t nextTrajectory;
+    libsm_traj_stats_t stats;
+} libsm_traj_t;
+
+
+/**
+ * @brief Default settings for 10 Hz BSM/PSM logs
+ *
+ * 4096 tracks, 600 point segments, 1 s reorder window, 5 s gap,
+ * link within 3 s and 30 m.
+ */
+void libsm_traj_default_config(libsm_traj_config_t* config);
+
+
+/**
+ * @brief Initialize a tracker
+ *
+ * @param tr The tracker, free with libsm_traj_free
+ * @param config Settings, NULL for the defaults
+ * @param emit Called with every segment
+ * @param user Passed to emit
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG tr or emit was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER maxTracks or maxSegmentPoints was 0
+ * @retval LIBSM_ALLOC_ERR Allocation error
+ */
+libsm_rval_e libsm_traj_init(libsm_traj_t* tr,
+                             libsm_traj_config_t const* config,
+                             libsm_traj_emit_f emit,
+                             void* user);
+
+
+/**
+ * @brief Free a tracker without emitting what it still holds, see libsm_traj_flush
+ */
+void libsm_traj_free(libsm_traj_t* tr);
+
+
+/**
+ * @brief Fill a sample from a decoded BSM
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG An argument was NULL
+ * @retval LIBSM_FAIL_CONSTRAINT The TemporaryID is not 4 bytes
+ */
+libsm_rval_e libsm_traj_sample_from_bsm(BasicSafetyMessage_t const* bsm,
+                                        uint64_t rxTimeMs,
+                                        libsm_traj_sample_t* sample);
+
+
+/**
+ * @brief Fill a sample from a decoded PSM
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG An argument was NULL
+ * @retval LIBSM_FAIL_CONSTRAINT The TemporaryID is not 4 bytes
+ */
+libsm_rval_e libsm_traj_sample_from_psm(PersonalSafetyMessage_t const* psm,
+                                        uint64_t rxTimeMs,
+                                        libsm_traj_sample_t* sample);
+
+
+/**
+ * @brief The time a sample was generated
+ *
+ * secMark resolved against rxTimeMs, or rxTimeMs if secMark is unavailable
+ */
+uint64_t libsm_traj_sample_time(libsm_traj_sample_t const* sample);
+
+
+/**
+ * @brief Add a sample
+ *
+ * Samples with an unavailable position are ignored.
+ *
+ * @retval LIBSM_OK Operation successful, including dropped samples
+ * @retval LIBSM_FAIL_NULL_ARG tr or sample was NULL
+ */
+libsm_rval_e libsm_traj_add(libsm_traj_t* tr, libsm_traj_sample_t const* sample);
+
+
+/**
+ * @brief Move time forward
+ *
+ * Buffered samples older than nowMs - reorderWindowMs are appended, and
+ * trajectories that have been silent for gapMs are finished and emitted.
+ * Call it every so often with the newest receive time read.
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG tr was NULL
+ */
+libsm_rval_e libsm_traj_advance(libsm_traj_t* tr, uint64_t nowMs);
+
+
+/**
+ * @brief Finish and emit every trajectory, at the end of the input
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG tr was NULL
+ */
+libsm_rval_e libsm_traj_flush(libsm_traj_t* tr);
+
+
+/**
+ * @brief The shard out of shards that a sample belongs to
+ *
+ * All samples of an ID go to the same shard.
+ */
+uint32_t libsm_traj_shard(libsm_traj_sample_t const* sample, uint32_t shards);
+
+
+#endif // LIBSM_TRAJECTORY_H
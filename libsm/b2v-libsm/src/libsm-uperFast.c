@@ -0,0 +1,403 @@
+/**
+ * @brief Specialised UPER codecs for the most frequent MessageFrames
+ */
+
+#include "libsm-uperFast.h"
+#include "libsm.h"
+#include "per_support.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+// MessageFrame ext bit and messageId, then at most two bytes of open type length
+#define UPER_FAST_HEADER_BYTES 4
+
+// unfragmented open type lengths
+#define UPER_FAST_MAX_LENGTH 16383
+
+
+/*
+ * Bytes are only stored below cap, but pos keeps counting so that a full
+ * buffer is told apart from a failed encoding at the end.
+ */
+typedef struct {
+    uint8_t* out;
+    size_t cap;
+    size_t pos;
+    uint64_t acc;
+    unsigned accBits;
+    bool failed;
+} uper_fast_writer_t;
+
+// past len the reader feeds zeros and sets overrun
+typedef struct {
+    uint8_t const* in;
+    size_t len;
+    size_t pos;
+    uint64_t acc;
+    unsigned accBits;
+    bool overrun;
+    bool failed;
+    bool allocFailed;
+} uper_fast_reader_t;
+
+
+static inline void uper_fast_put(uper_fast_writer_t* w, uint32_t value, unsigned bits)
+{
+    w->acc = (w->acc << bits) | value;
+    w->accBits += bits;
+    while (w->accBits >= 8) {
+        w->accBits -= 8;
+        if (w->pos < w->cap) {
+            w->out[w->pos] = (uint8_t)(w->acc >> w->accBits);
+        }
+        w->pos++;
+    }
+}
+
+
+// value - lb in bits, false when value is outside [lb, ub]
+static inline bool uper_fast_put_int(uper_fast_writer_t* w,
+                                     long value,
+                                     long lb,
+                                     long ub,
+                                     unsigned bits)
+{
+    if (value < lb || value > ub) {
+        return false;
+    }
+    uper_fast_put(w, (uint32_t)(value - lb), bits);
+    return true;
+}
+
+
+// a value in the root of an extensible constraint, after a 0 extension bit
+static inline bool uper_fast_put_ext_int(uper_fast_writer_t* w,
+                                         long value,
+                                         long lb,
+                                         long ub,
+                                         unsigned bits)
+{
+    uper_fast_put(w, 0, 1);
+    return uper_fast_put_int(w, value, lb, ub, bits);
+}
+
+
+// size - lb in bits when the size is not fixed, then the bytes
+static bool uper_fast_put_octets(uper_fast_writer_t* w,
+                                 OCTET_STRING_t const* s,
+                                 long lb,
+                                 long ub,
+                                 unsigned bits)
+{
+    if ((s->buf == NULL && s->size > 0) || (long)s->size < lb || (long)s->size > ub) {
+        return false;
+    }
+    uper_fast_put(w, (uint32_t)(s->size - lb), bits);
+    for (size_t i = 0; i < s->size; i++) {
+        uper_fast_put(w, s->buf[i], 8);
+    }
+    return true;
+}
+
+
+// a BIT STRING of a fixed size of at most 32 bits
+static bool uper_fast_put_bits(uper_fast_writer_t* w, BIT_STRING_t const* s, unsigned bits)
+{
+    size_t const size = (bits + 7) / 8;
+    if (s->buf == NULL || s->size != size || s->bits_unused != (int)(size * 8 - bits)) {
+        return false;
+    }
+    uint32_t value = 0;
+    for (size_t i = 0; i < size; i++) {
+        value = value << 8 | s->buf[i];
+    }
+    uper_fast_put(w, value >> s->bits_unused, bits);
+    return true;
+}
+
+
+static int uper_fast_output(void const* data, size_t size, void* key)
+{
+    uper_fast_writer_t* w = key;
+    if (w->pos < w->cap) {
+        memcpy(w->out + w->pos, data, size < w->cap - w->pos ? size : w->cap - w->pos);
+    }
+    w->pos += size;
+    return 0;
+}
+
+
+/*
+ * Hand the bit stream to the asn1c codec of a member, the same way
+ * constr_SEQUENCE does, and take back the bits it did not flush.
+ */
+static bool uper_fast_put_member(uper_fast_writer_t* w,
+                                 asn_TYPE_member_t const* elm,
+                                 void const* value)
+{
+    asn_per_outp_t po;
+    po.buffer = po.tmpspace;
+    po.nboff = w->accBits;
+    po.nbits = 8 * sizeof(po.tmpspace);
+    po.tmpspace[0] = (uint8_t)(w->acc << (8 - w->accBits));
+    po.output = uper_fast_output;
+    po.op_key = w;
+    po.flushed_bytes = 0;
+
+    asn_enc_rval_t const er = elm->type->op->uper_encoder(
+            elm->type, elm->encoding_constraints.per_constraints, value, &po);
+    if (er.encoded < 0) {
+        w->failed = true;
+        return false;
+    }
+    size_t const whole = (size_t)(po.buffer - po.tmpspace) + (po.nboff >> 3);
+    uper_fast_output(po.tmpspace, whole, w);
+    w->accBits = po.nboff & 0x07;
+    w->acc = po.tmpspace[whole] >> (8 - w->accBits);
+    return true;
+}
+
+
+static inline uint32_t uper_fast_get(uper_fast_reader_t* r, unsigned bits)
+{
+    while (r->accBits < bits) {
+        r->acc = (r->acc << 8) | (r->pos < r->len ? r->in[r->pos] : 0);
+        r->overrun |= r->pos >= r->len;
+        r->pos++;
+        r->accBits += 8;
+    }
+    r->accBits -= bits;
+    return (uint32_t)((r->acc >> r->accBits) & ((1ULL << bits) - 1));
+}
+
+
+// false when the value is past ub, which asn1c would not check
+static inline bool uper_fast_get_int(uper_fast_reader_t* r,
+                                     long* value,
+                                     long lb,
+                                     long ub,
+                                     unsigned bits)
+{
+    uint32_t const raw = uper_fast_get(r, bits);
+    if ((uint64_t)raw > (uint64_t)(ub - lb)) {
+        return false;
+    }
+    *value = lb + (long)raw;
+    return true;
+}
+
+
+// false for a value out of the root, encoded after a 1 extension bit
+static inline bool uper_fast_get_ext_int(uper_fast_reader_t* r,
+                                         long* value,
+                                         long lb,
+                                         long ub,
+                                         unsigned bits)
+{
+    return uper_fast_get(r, 1) == 0 && uper_fast_get_int(r, value, lb, ub, bits);
+}
+
+
+static void* uper_fast_alloc(uper_fast_reader_t* r, size_t size)
+{
+    void* const p = CALLOC(1, size);
+    r->allocFailed |= p == NULL;
+    return p;
+}
+
+
+// a zeroed element appended to a SEQUENCE OF
+static void* uper_fast_add(uper_fast_reader_t* r, void* list, size_t size)
+{
+    void* const p = uper_fast_alloc(r, size);
+    if (p != NULL && asn_sequence_add(list, p) != 0) {
+        FREEMEM(p);
+        r->allocFailed = true;
+        return NULL;
+    }
+    return p;
+}
+
+
+// asn1c keeps a terminating zero after OCTET and BIT STRINGs
+static bool uper_fast_get_octets(uper_fast_reader_t* r,
+                                 OCTET_STRING_t* s,
+                                 long lb,
+                                 long ub,
+                                 unsigned bits)
+{
+    long const size = lb + (long)uper_fast_get(r, bits);
+    if (size > ub) {
+        return false;
+    }
+    s->buf = uper_fast_alloc(r, (size_t)size + 1);
+    if (s->buf == NULL) {
+        return false;
+    }
+    s->size = (size_t)size;
+    for (long i = 0; i < size; i++) {
+        s->buf[i] = (uint8_t)uper_fast_get(r, 8);
+    }
+    return true;
+}
+
+
+static bool uper_fast_get_bits(uper_fast_reader_t* r, BIT_STRING_t* s, unsigned bits)
+{
+    size_t const size = (bits + 7) / 8;
+    s->buf = uper_fast_alloc(r, size + 1);
+    if (s->buf == NULL) {
+        return false;
+    }
+    s->size = size;
+    s->bits_unused = (int)(size * 8 - bits);
+    uint32_t const value = uper_fast_get(r, bits) << s->bits_unused;
+    for (size_t i = 0; i < size; i++) {
+        s->buf[i] = (uint8_t)(value >> (8 * (size - 1 - i)));
+    }
+    return true;
+}
+
+
+// the asn1c codec of a member, on storage the caller allocated
+static bool uper_fast_get_member(uper_fast_reader_t* r, asn_TYPE_member_t const* elm, void* value)
+{
+    if (r->overrun) {
+        return false;
+    }
+    asn_per_data_t pd = { 0 };
+    pd.buffer = r->in;
+    pd.nboff = r->pos * 8 - r->accBits;
+    pd.nbits = r->len * 8;
+    asn_dec_rval_t const dr = elm->type->op->uper_decoder(
+            NULL, elm->type, elm->encoding_constraints.per_constraints, &value, &pd);
+    if (dr.code != RC_OK) {
+        r->failed = true;
+        return false;
+    }
+    size_t const bits = (size_t)(pd.buffer - r->in) * 8 + pd.nboff;
+    r->pos = bits / 8;
+    r->acc = 0;
+    r->accBits = 0;
+    uper_fast_get(r, bits & 0x07);
+    return true;
+}
+
+
+#include "libsm-uperFastCodecs.h"
+
+
+libsm_rval_e libsm_uper_fast_encode(MessageFrame_t const* mf, uint8_t* encoded, size_t* len)
+{
+    if (mf == NULL || encoded == NULL || len == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (*len < UPER_FAST_HEADER_BYTES) {
+        return LIBSM_FAIL_ENCODING_BUFF_SIZE;
+    }
+
+    // the value goes after the longest header, and is moved down if the length fits one byte
+    uper_fast_writer_t w = { .out = encoded + UPER_FAST_HEADER_BYTES,
+                             .cap = *len - UPER_FAST_HEADER_BYTES };
+    if (!uper_fast_put_message(&w, mf)) {
+        return w.failed ? LIBSM_FAIL_ENCODING : LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    if (w.accBits > 0) {
+        uper_fast_put(&w, 0, 8 - w.accBits);
+    }
+
+    size_t const length = w.pos;
+    if (length > UPER_FAST_MAX_LENGTH) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    if (length > w.cap) {
+        return LIBSM_FAIL_ENCODING_BUFF_SIZE;
+    }
+    size_t header = UPER_FAST_HEADER_BYTES;
+    if (length < 128) {
+        header--;
+        memmove(encoded + header, encoded + UPER_FAST_HEADER_BYTES, length);
+        encoded[2] = (uint8_t)length;
+    } else {
+        encoded[2] = (uint8_t)(0x80 | (length >> 8));
+        encoded[3] = (uint8_t)length;
+    }
+    // MessageFrame extension bit, then a 15 bit messageId
+    encoded[0] = (uint8_t)(mf->messageId >> 8);
+    encoded[1] = (uint8_t)mf->messageId;
+    *len = header + length;
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_uper_fast_decode(uint8_t const* encoded, size_t len, MessageFrame_t* mf)
+{
+    if (encoded == NULL || mf == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    if (len < 3 || (encoded[0] & 0x80)) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    size_t header = 3;
+    size_t length = encoded[2];
+    if (encoded[2] & 0x80) {
+        if ((encoded[2] & 0x40) || len < 4) {
+            return LIBSM_FAIL_NO_VALID_PARAMETER;
+        }
+        header = 4;
+        length = (size_t)(encoded[2] & 0x3F) << 8 | encoded[3];
+    }
+    if (len - header < length) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+
+    mf->messageId = (encoded[0] & 0x7F) << 8 | encoded[1];
+    uper_fast_reader_t r = { .in = encoded + header, .len = length };
+    bool const ok = uper_fast_get_message(&r, mf);
+    if (r.allocFailed) {
+        return LIBSM_ALLOC_ERR;
+    }
+    if (r.failed) {
+        return LIBSM_FAIL_DECODING;
+    }
+    if (!ok || r.overrun) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    // as uper_open_type_get, a whole byte left over is not padding
+    if (length * 8 - (r.pos * 8 - r.accBits) >= 8) {
+        return LIBSM_FAIL_DECODING;
+    }
+    return LIBSM_OK;
+}
+
+
+libsm_rval_e libsm_uper_fast_encode_messageframe(MessageFrame_t* mf,
+                                                 uint8_t* encoded,
+                                                 size_t* len)
+{
+    if (mf != NULL && encoded != NULL && len != NULL) {
+        size_t fastLen = *len;
+        if (libsm_uper_fast_encode(mf, encoded, &fastLen) == LIBSM_OK) {
+            *len = fastLen;
+            return LIBSM_OK;
+        }
+    }
+    return libsm_encode_messageframe(mf, encoded, len);
+}
+
+
+libsm_rval_e libsm_uper_fast_decode_messageframe(uint8_t const* encoded,
+                                                 size_t len,
+                                                 MessageFrame_t* mf)
+{
+    if (encoded != NULL && mf != NULL) {
+        if (libsm_uper_fast_decode(encoded, len, mf) == LIBSM_OK) {
+            return LIBSM_OK;
+        }
+        ASN_STRUCT_RESET(asn_DEF_MessageFrame, mf);
+    }
+    return libsm_decode_messageframe(encoded, len, mf);
+}
@@ -0,0 +1,83 @@
+/**
+ * @brief Specialised UPER codecs for the most frequent MessageFrames
+ *
+ * The asn1c codec is table driven: every member of every SEQUENCE is reached
+ * through its descriptor and an indirect call, and every integer looks up its
+ * constraint at run time. For the MessageFrame values listed in
+ * tooling/uperFastTypes (BSM, PSM, SPAT and MapData), tooling/gen-uperFast.sh
+ * writes straight-line codecs from the asn1c tables instead, with the
+ * asn_PER_*_constr bounds of each field folded in as constants. Members the
+ * generator does not specialise, such as open types, strings of characters and
+ * BIT STRINGs of variable size, are passed to their asn1c codec in the same bit
+ * stream.
+ *
+ * The output is byte identical to libsm_encode_messageframe and
+ * libsm_decode_messageframe. Anything the specialised code does not handle
+ * exactly like asn1c (values outside their constraint, extensions, fragmented
+ * lengths, wrong sizes) is left to the generic codec.
+ */
+
+#ifndef LIBSM_UPER_FAST_H
+#define LIBSM_UPER_FAST_H
+
+#include "MessageFrame.h"
+#include "libsm-error.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/**
+ * @brief Encode a MessageFrame with the specialised codecs only
+ *
+ * @param mf The message
+ * @param encoded Output buffer
+ * @param len In the size of encoded, out the number of bytes encoded
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG An argument was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER The message needs the generic codec
+ * @retval LIBSM_FAIL_ENCODING_BUFF_SIZE encoded is too small
+ * @retval LIBSM_FAIL_ENCODING A member left to asn1c did not encode
+ */
+libsm_rval_e libsm_uper_fast_encode(MessageFrame_t const* mf, uint8_t* encoded, size_t* len);
+
+
+/**
+ * @brief Decode a MessageFrame with the specialised codecs only
+ *
+ * @param encoded UPER MessageFrame
+ * @param len Size of encoded
+ * @param mf Zeroed MessageFrame, free with ASN_STRUCT_FREE or ASN_STRUCT_RESET
+ *           whatever the result
+ *
+ * @retval LIBSM_OK Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG An argument was NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER The message needs the generic codec
+ * @retval LIBSM_FAIL_DECODING A member left to asn1c did not decode
+ * @retval LIBSM_ALLOC_ERR Allocation error
+ */
+libsm_rval_e libsm_uper_fast_decode(uint8_t const* encoded, size_t len, MessageFrame_t* mf);
+
+
+/**
+ * @brief libsm_encode_messageframe, with the specialised codecs
+ *
+ * Same arguments and results as libsm_encode_messageframe.
+ */
+libsm_rval_e libsm_uper_fast_encode_messageframe(MessageFrame_t* mf,
+                                                 uint8_t* encoded,
+                                                 size_t* len);
+
+
+/**
+ * @brief libsm_decode_messageframe, with the specialised codecs
+ *
+ * Same arguments and results as libsm_decode_messageframe.
+ */
+libsm_rval_e libsm_uper_fast_decode_messageframe(uint8_t const* encoded,
+                                                 size_t len,
+                                                 MessageFrame_t* mf);
+
+
+#endif // LIBSM_UPER_FAST_H
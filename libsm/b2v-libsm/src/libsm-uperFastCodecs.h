@@ -0,0 +1,3751 @@
+/*
+ * Generated by tooling/gen-uperFast.sh from the asn1c tables in src/j2735, do not edit
+ * Specialised: BasicSafetyMessage PersonalSafetyMessage SPAT MapData
+ * Included by libsm-uperFast.c only
+ */
+
+#ifndef LIBSM_UPER_FAST_CODECS_H
+#define LIBSM_UPER_FAST_CODECS_H
+
+
+static bool uper_fast_put_PositionalAccuracy(uper_fast_writer_t* w,
+                                             struct PositionalAccuracy const* s)
+{
+    bool ok = true;
+    ok &= uper_fast_put_int(w, s->semiMajor, 0, 255, 8);
+    ok &= uper_fast_put_int(w, s->semiMinor, 0, 255, 8);
+    ok &= uper_fast_put_int(w, s->orientation, 0, 65535, 16);
+    return ok;
+}
+
+
+static bool uper_fast_get_PositionalAccuracy(uper_fast_reader_t* r, struct PositionalAccuracy* s)
+{
+    bool ok = true;
+    ok &= uper_fast_get_int(r, &s->semiMajor, 0, 255, 8);
+    ok &= uper_fast_get_int(r, &s->semiMinor, 0, 255, 8);
+    ok &= uper_fast_get_int(r, &s->orientation, 0, 65535, 16);
+    return ok;
+}
+
+
+static bool uper_fast_put_AccelerationSet4Way(uper_fast_writer_t* w,
+                                              struct AccelerationSet4Way const* s)
+{
+    bool ok = true;
+    ok &= uper_fast_put_int(w, s->Long, -2000, 2001, 12);
+    ok &= uper_fast_put_int(w, s->lat, -2000, 2001, 12);
+    ok &= uper_fast_put_int(w, s->vert, -127, 127, 8);
+    ok &= uper_fast_put_int(w, s->yaw, -32767, 32767, 16);
+    return ok;
+}
+
+
+static bool uper_fast_get_AccelerationSet4Way(uper_fast_reader_t* r, struct AccelerationSet4Way* s)
+{
+    bool ok = true;
+    ok &= uper_fast_get_int(r, &s->Long, -2000, 2001, 12);
+    ok &= uper_fast_get_int(r, &s->lat, -2000, 2001, 12);
+    ok &= uper_fast_get_int(r, &s->vert, -127, 127, 8);
+    ok &= uper_fast_get_int(r, &s->yaw, -32767, 32767, 16);
+    return ok;
+}
+
+
+static bool uper_fast_put_BrakeSystemStatus(uper_fast_writer_t* w,
+                                            struct BrakeSystemStatus const* s)
+{
+    bool ok = true;
+    ok &= uper_fast_put_bits(w, &s->wheelBrakes, 5);
+    ok &= uper_fast_put_int(w, s->traction, 0, 3, 2);
+    ok &= uper_fast_put_int(w, s->abs, 0, 3, 2);
+    ok &= uper_fast_put_int(w, s->scs, 0, 3, 2);
+    ok &= uper_fast_put_int(w, s->brakeBoost, 0, 2, 2);
+    ok &= uper_fast_put_int(w, s->auxBrakes, 0, 3, 2);
+    return ok;
+}
+
+
+static bool uper_fast_get_BrakeSystemStatus(uper_fast_reader_t* r, struct BrakeSystemStatus* s)
+{
+    bool ok = true;
+    ok &= uper_fast_get_bits(r, &s->wheelBrakes, 5);
+    ok &= uper_fast_get_int(r, &s->traction, 0, 3, 2);
+    ok &= uper_fast_get_int(r, &s->abs, 0, 3, 2);
+    ok &= uper_fast_get_int(r, &s->scs, 0, 3, 2);
+    ok &= uper_fast_get_int(r, &s->brakeBoost, 0, 2, 2);
+    ok &= uper_fast_get_int(r, &s->auxBrakes, 0, 3, 2);
+    return ok;
+}
+
+
+static bool uper_fast_put_VehicleSize(uper_fast_writer_t* w, struct VehicleSize const* s)
+{
+    bool ok = true;
+    ok &= uper_fast_put_int(w, s->width, 0, 1023, 10);
+    ok &= uper_fast_put_int(w, s->length, 0, 4095, 12);
+    return ok;
+}
+
+
+static bool uper_fast_get_VehicleSize(uper_fast_reader_t* r, struct VehicleSize* s)
+{
+    bool ok = true;
+    ok &= uper_fast_get_int(r, &s->width, 0, 1023, 10);
+    ok &= uper_fast_get_int(r, &s->length, 0, 4095, 12);
+    return ok;
+}
+
+
+static bool uper_fast_put_BSMcoreData(uper_fast_writer_t* w, struct BSMcoreData const* s)
+{
+    bool ok = true;
+    ok &= uper_fast_put_int(w, s->msgCnt, 0, 127, 7);
+    ok &= uper_fast_put_octets(w, &s->id, 4, 4, 0);
+    ok &= uper_fast_put_int(w, s->secMark, 0, 65535, 16);
+    ok &= uper_fast_put_int(w, s->lat, -900000000, 900000001, 31);
+    ok &= uper_fast_put_int(w, s->Long, -1799999999, 1800000001, 32);
+    ok &= uper_fast_put_int(w, s->elev, -4096, 61439, 16);
+    ok &= uper_fast_put_PositionalAccuracy(w, &s->accuracy);
+    ok &= uper_fast_put_int(w, s->transmission, 0, 7, 3);
+    ok &= uper_fast_put_int(w, s->speed, 0, 8191, 13);
+    ok &= uper_fast_put_int(w, s->heading, 0, 28800, 15);
+    ok &= uper_fast_put_int(w, s->angle, -126, 127, 8);
+    ok &= uper_fast_put_AccelerationSet4Way(w, &s->accelSet);
+    ok &= uper_fast_put_BrakeSystemStatus(w, &s->brakes);
+    ok &= uper_fast_put_VehicleSize(w, &s->size);
+    return ok;
+}
+
+
+static bool uper_fast_get_BSMcoreData(uper_fast_reader_t* r, struct BSMcoreData* s)
+{
+    bool ok = true;
+    ok &= uper_fast_get_int(r, &s->msgCnt, 0, 127, 7);
+    ok &= uper_fast_get_octets(r, &s->id, 4, 4, 0);
+    ok &= uper_fast_get_int(r, &s->secMark, 0, 65535, 16);
+    ok &= uper_fast_get_int(r, &s->lat, -900000000, 900000001, 31);
+    ok &= uper_fast_get_int(r, &s->Long, -1799999999, 1800000001, 32);
+    ok &= uper_fast_get_int(r, &s->elev, -4096, 61439, 16);
+    ok &= uper_fast_get_PositionalAccuracy(r, &s->accuracy);
+    ok &= uper_fast_get_int(r, &s->transmission, 0, 7, 3);
+    ok &= uper_fast_get_int(r, &s->speed, 0, 8191, 13);
+    ok &= uper_fast_get_int(r, &s->heading, 0, 28800, 15);
+    ok &= uper_fast_get_int(r, &s->angle, -126, 127, 8);
+    ok &= uper_fast_get_AccelerationSet4Way(r, &s->accelSet);
+    ok &= uper_fast_get_BrakeSystemStatus(r, &s->brakes);
+    ok &= uper_fast_get_VehicleSize(r, &s->size);
+    return ok;
+}
+
+
+static bool uper_fast_put_BasicSafetyMessage(uper_fast_writer_t* w,
+                                             struct BasicSafetyMessage const* s)
+{
+    uper_fast_put(w, 0, 1);
+    uper_fast_put(w, s->partII != NULL, 1);
+    uper_fast_put(w, s->regional != NULL, 1);
+    bool ok = true;
+    ok &= uper_fast_put_BSMcoreData(w, &s->coreData);
+    if (s->partII != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_BasicSafetyMessage.elements[1], s->partII);
+    }
+    if (s->regional != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_BasicSafetyMessage.elements[2], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_BasicSafetyMessage(uper_fast_reader_t* r, struct BasicSafetyMessage* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    uint32_t const present = uper_fast_get(r, 2);
+    bool ok = true;
+    ok &= uper_fast_get_BSMcoreData(r, &s->coreData);
+    if (present & (1u << 1)) {
+        s->partII = uper_fast_alloc(r, sizeof(*s->partII));
+        if (s->partII == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_BasicSafetyMessage.elements[1], s->partII);
+    }
+    if (present & (1u << 0)) {
+        s->regional = uper_fast_alloc(r, sizeof(*s->regional));
+        if (s->regional == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_BasicSafetyMessage.elements[2], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_Position3D(uper_fast_writer_t* w, struct Position3D const* s)
+{
+    uper_fast_put(w, 0, 1);
+    uper_fast_put(w, s->elevation != NULL, 1);
+    uper_fast_put(w, s->regional != NULL, 1);
+    bool ok = true;
+    ok &= uper_fast_put_int(w, s->lat, -900000000, 900000001, 31);
+    ok &= uper_fast_put_int(w, s->Long, -1799999999, 1800000001, 32);
+    if (s->elevation != NULL) {
+        ok &= uper_fast_put_int(w, *s->elevation, -4096, 61439, 16);
+    }
+    if (s->regional != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_Position3D.elements[3], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_Position3D(uper_fast_reader_t* r, struct Position3D* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    uint32_t const present = uper_fast_get(r, 2);
+    bool ok = true;
+    ok &= uper_fast_get_int(r, &s->lat, -900000000, 900000001, 31);
+    ok &= uper_fast_get_int(r, &s->Long, -1799999999, 1800000001, 32);
+    if (present & (1u << 1)) {
+        s->elevation = uper_fast_alloc(r, sizeof(*s->elevation));
+        if (s->elevation == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->elevation, -4096, 61439, 16);
+    }
+    if (present & (1u << 0)) {
+        s->regional = uper_fast_alloc(r, sizeof(*s->regional));
+        if (s->regional == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_Position3D.elements[3], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_DDateTime(uper_fast_writer_t* w, struct DDateTime const* s)
+{
+    uper_fast_put(w, s->year != NULL, 1);
+    uper_fast_put(w, s->month != NULL, 1);
+    uper_fast_put(w, s->day != NULL, 1);
+    uper_fast_put(w, s->hour != NULL, 1);
+    uper_fast_put(w, s->minute != NULL, 1);
+    uper_fast_put(w, s->second != NULL, 1);
+    uper_fast_put(w, s->offset != NULL, 1);
+    bool ok = true;
+    if (s->year != NULL) {
+        ok &= uper_fast_put_int(w, *s->year, 0, 4095, 12);
+    }
+    if (s->month != NULL) {
+        ok &= uper_fast_put_int(w, *s->month, 0, 12, 4);
+    }
+    if (s->day != NULL) {
+        ok &= uper_fast_put_int(w, *s->day, 0, 31, 5);
+    }
+    if (s->hour != NULL) {
+        ok &= uper_fast_put_int(w, *s->hour, 0, 31, 5);
+    }
+    if (s->minute != NULL) {
+        ok &= uper_fast_put_int(w, *s->minute, 0, 60, 6);
+    }
+    if (s->second != NULL) {
+        ok &= uper_fast_put_int(w, *s->second, 0, 65535, 16);
+    }
+    if (s->offset != NULL) {
+        ok &= uper_fast_put_int(w, *s->offset, -840, 840, 11);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_DDateTime(uper_fast_reader_t* r, struct DDateTime* s)
+{
+    uint32_t const present = uper_fast_get(r, 7);
+    bool ok = true;
+    if (present & (1u << 6)) {
+        s->year = uper_fast_alloc(r, sizeof(*s->year));
+        if (s->year == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->year, 0, 4095, 12);
+    }
+    if (present & (1u << 5)) {
+        s->month = uper_fast_alloc(r, sizeof(*s->month));
+        if (s->month == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->month, 0, 12, 4);
+    }
+    if (present & (1u << 4)) {
+        s->day = uper_fast_alloc(r, sizeof(*s->day));
+        if (s->day == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->day, 0, 31, 5);
+    }
+    if (present & (1u << 3)) {
+        s->hour = uper_fast_alloc(r, sizeof(*s->hour));
+        if (s->hour == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->hour, 0, 31, 5);
+    }
+    if (present & (1u << 2)) {
+        s->minute = uper_fast_alloc(r, sizeof(*s->minute));
+        if (s->minute == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->minute, 0, 60, 6);
+    }
+    if (present & (1u << 1)) {
+        s->second = uper_fast_alloc(r, sizeof(*s->second));
+        if (s->second == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->second, 0, 65535, 16);
+    }
+    if (present & (1u << 0)) {
+        s->offset = uper_fast_alloc(r, sizeof(*s->offset));
+        if (s->offset == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->offset, -840, 840, 11);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_TransmissionAndSpeed(uper_fast_writer_t* w,
+                                               struct TransmissionAndSpeed const* s)
+{
+    bool ok = true;
+    ok &= uper_fast_put_int(w, s->transmisson, 0, 7, 3);
+    ok &= uper_fast_put_int(w, s->speed, 0, 8191, 13);
+    return ok;
+}
+
+
+static bool uper_fast_get_TransmissionAndSpeed(uper_fast_reader_t* r,
+                                               struct TransmissionAndSpeed* s)
+{
+    bool ok = true;
+    ok &= uper_fast_get_int(r, &s->transmisson, 0, 7, 3);
+    ok &= uper_fast_get_int(r, &s->speed, 0, 8191, 13);
+    return ok;
+}
+
+
+static bool uper_fast_put_PositionConfidenceSet(uper_fast_writer_t* w,
+                                                struct PositionConfidenceSet const* s)
+{
+    bool ok = true;
+    ok &= uper_fast_put_int(w, s->pos, 0, 15, 4);
+    ok &= uper_fast_put_int(w, s->elevation, 0, 15, 4);
+    return ok;
+}
+
+
+static bool uper_fast_get_PositionConfidenceSet(uper_fast_reader_t* r,
+                                                struct PositionConfidenceSet* s)
+{
+    bool ok = true;
+    ok &= uper_fast_get_int(r, &s->pos, 0, 15, 4);
+    ok &= uper_fast_get_int(r, &s->elevation, 0, 15, 4);
+    return ok;
+}
+
+
+static bool uper_fast_put_SpeedandHeadingandThrottleConfidence(
+        uper_fast_writer_t* w, struct SpeedandHeadingandThrottleConfidence const* s)
+{
+    bool ok = true;
+    ok &= uper_fast_put_int(w, s->heading, 0, 7, 3);
+    ok &= uper_fast_put_int(w, s->speed, 0, 7, 3);
+    ok &= uper_fast_put_int(w, s->throttle, 0, 3, 2);
+    return ok;
+}
+
+
+static bool uper_fast_get_SpeedandHeadingandThrottleConfidence(
+        uper_fast_reader_t* r, struct SpeedandHeadingandThrottleConfidence* s)
+{
+    bool ok = true;
+    ok &= uper_fast_get_int(r, &s->heading, 0, 7, 3);
+    ok &= uper_fast_get_int(r, &s->speed, 0, 7, 3);
+    ok &= uper_fast_get_int(r, &s->throttle, 0, 3, 2);
+    return ok;
+}
+
+
+static bool uper_fast_put_FullPositionVector(uper_fast_writer_t* w,
+                                             struct FullPositionVector const* s)
+{
+    uper_fast_put(w, 0, 1);
+    uper_fast_put(w, s->utcTime != NULL, 1);
+    uper_fast_put(w, s->elevation != NULL, 1);
+    uper_fast_put(w, s->heading != NULL, 1);
+    uper_fast_put(w, s->speed != NULL, 1);
+    uper_fast_put(w, s->posAccuracy != NULL, 1);
+    uper_fast_put(w, s->timeConfidence != NULL, 1);
+    uper_fast_put(w, s->posConfidence != NULL, 1);
+    uper_fast_put(w, s->speedConfidence != NULL, 1);
+    bool ok = true;
+    if (s->utcTime != NULL) {
+        ok &= uper_fast_put_DDateTime(w, s->utcTime);
+    }
+    ok &= uper_fast_put_int(w, s->Long, -1799999999, 1800000001, 32);
+    ok &= uper_fast_put_int(w, s->lat, -900000000, 900000001, 31);
+    if (s->elevation != NULL) {
+        ok &= uper_fast_put_int(w, *s->elevation, -4096, 61439, 16);
+    }
+    if (s->heading != NULL) {
+        ok &= uper_fast_put_int(w, *s->heading, 0, 28800, 15);
+    }
+    if (s->speed != NULL) {
+        ok &= uper_fast_put_TransmissionAndSpeed(w, s->speed);
+    }
+    if (s->posAccuracy != NULL) {
+        ok &= uper_fast_put_PositionalAccuracy(w, s->posAccuracy);
+    }
+    if (s->timeConfidence != NULL) {
+        ok &= uper_fast_put_int(w, *s->timeConfidence, 0, 39, 6);
+    }
+    if (s->posConfidence != NULL) {
+        ok &= uper_fast_put_PositionConfidenceSet(w, s->posConfidence);
+    }
+    if (s->speedConfidence != NULL) {
+        ok &= uper_fast_put_SpeedandHeadingandThrottleConfidence(w, s->speedConfidence);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_FullPositionVector(uper_fast_reader_t* r, struct FullPositionVector* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    uint32_t const present = uper_fast_get(r, 8);
+    bool ok = true;
+    if (present & (1u << 7)) {
+        s->utcTime = uper_fast_alloc(r, sizeof(*s->utcTime));
+        if (s->utcTime == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_DDateTime(r, s->utcTime);
+    }
+    ok &= uper_fast_get_int(r, &s->Long, -1799999999, 1800000001, 32);
+    ok &= uper_fast_get_int(r, &s->lat, -900000000, 900000001, 31);
+    if (present & (1u << 6)) {
+        s->elevation = uper_fast_alloc(r, sizeof(*s->elevation));
+        if (s->elevation == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->elevation, -4096, 61439, 16);
+    }
+    if (present & (1u << 5)) {
+        s->heading = uper_fast_alloc(r, sizeof(*s->heading));
+        if (s->heading == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->heading, 0, 28800, 15);
+    }
+    if (present & (1u << 4)) {
+        s->speed = uper_fast_alloc(r, sizeof(*s->speed));
+        if (s->speed == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_TransmissionAndSpeed(r, s->speed);
+    }
+    if (present & (1u << 3)) {
+        s->posAccuracy = uper_fast_alloc(r, sizeof(*s->posAccuracy));
+        if (s->posAccuracy == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_PositionalAccuracy(r, s->posAccuracy);
+    }
+    if (present & (1u << 2)) {
+        s->timeConfidence = uper_fast_alloc(r, sizeof(*s->timeConfidence));
+        if (s->timeConfidence == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->timeConfidence, 0, 39, 6);
+    }
+    if (present & (1u << 1)) {
+        s->posConfidence = uper_fast_alloc(r, sizeof(*s->posConfidence));
+        if (s->posConfidence == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_PositionConfidenceSet(r, s->posConfidence);
+    }
+    if (present & (1u << 0)) {
+        s->speedConfidence = uper_fast_alloc(r, sizeof(*s->speedConfidence));
+        if (s->speedConfidence == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_SpeedandHeadingandThrottleConfidence(r, s->speedConfidence);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_PathHistoryPoint(uper_fast_writer_t* w, struct PathHistoryPoint const* s)
+{
+    uper_fast_put(w, 0, 1);
+    uper_fast_put(w, s->speed != NULL, 1);
+    uper_fast_put(w, s->posAccuracy != NULL, 1);
+    uper_fast_put(w, s->heading != NULL, 1);
+    bool ok = true;
+    ok &= uper_fast_put_int(w, s->latOffset, -131072, 131071, 18);
+    ok &= uper_fast_put_int(w, s->lonOffset, -131072, 131071, 18);
+    ok &= uper_fast_put_int(w, s->elevationOffset, -2048, 2047, 12);
+    ok &= uper_fast_put_int(w, s->timeOffset, 1, 65535, 16);
+    if (s->speed != NULL) {
+        ok &= uper_fast_put_int(w, *s->speed, 0, 8191, 13);
+    }
+    if (s->posAccuracy != NULL) {
+        ok &= uper_fast_put_PositionalAccuracy(w, s->posAccuracy);
+    }
+    if (s->heading != NULL) {
+        ok &= uper_fast_put_int(w, *s->heading, 0, 240, 8);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_PathHistoryPoint(uper_fast_reader_t* r, struct PathHistoryPoint* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    uint32_t const present = uper_fast_get(r, 3);
+    bool ok = true;
+    ok &= uper_fast_get_int(r, &s->latOffset, -131072, 131071, 18);
+    ok &= uper_fast_get_int(r, &s->lonOffset, -131072, 131071, 18);
+    ok &= uper_fast_get_int(r, &s->elevationOffset, -2048, 2047, 12);
+    ok &= uper_fast_get_int(r, &s->timeOffset, 1, 65535, 16);
+    if (present & (1u << 2)) {
+        s->speed = uper_fast_alloc(r, sizeof(*s->speed));
+        if (s->speed == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->speed, 0, 8191, 13);
+    }
+    if (present & (1u << 1)) {
+        s->posAccuracy = uper_fast_alloc(r, sizeof(*s->posAccuracy));
+        if (s->posAccuracy == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_PositionalAccuracy(r, s->posAccuracy);
+    }
+    if (present & (1u << 0)) {
+        s->heading = uper_fast_alloc(r, sizeof(*s->heading));
+        if (s->heading == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->heading, 0, 240, 8);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_PathHistoryPointList(uper_fast_writer_t* w,
+                                               struct PathHistoryPointList const* s)
+{
+    if (s->list.count < 1 || s->list.count > 23) {
+        return false;
+    }
+    uper_fast_put(w, (uint32_t)(s->list.count - 1), 5);
+    bool ok = true;
+    for (int i = 0; i < s->list.count; i++) {
+        if (s->list.array[i] == NULL) {
+            return false;
+        }
+        ok &= uper_fast_put_PathHistoryPoint(w, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_PathHistoryPointList(uper_fast_reader_t* r,
+                                               struct PathHistoryPointList* s)
+{
+    long const count = 1 + (long)uper_fast_get(r, 5);
+    if (count > 23) {
+        return false;
+    }
+    bool ok = true;
+    for (long i = 0; i < count && !r->overrun; i++) {
+        if (uper_fast_add(r, &s->list, sizeof(**s->list.array)) == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_PathHistoryPoint(r, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_PathHistory(uper_fast_writer_t* w, struct PathHistory const* s)
+{
+    uper_fast_put(w, 0, 1);
+    uper_fast_put(w, s->initialPosition != NULL, 1);
+    uper_fast_put(w, s->currGNSSstatus != NULL, 1);
+    bool ok = true;
+    if (s->initialPosition != NULL) {
+        ok &= uper_fast_put_FullPositionVector(w, s->initialPosition);
+    }
+    if (s->currGNSSstatus != NULL) {
+        ok &= uper_fast_put_bits(w, s->currGNSSstatus, 8);
+    }
+    ok &= uper_fast_put_PathHistoryPointList(w, &s->crumbData);
+    return ok;
+}
+
+
+static bool uper_fast_get_PathHistory(uper_fast_reader_t* r, struct PathHistory* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    uint32_t const present = uper_fast_get(r, 2);
+    bool ok = true;
+    if (present & (1u << 1)) {
+        s->initialPosition = uper_fast_alloc(r, sizeof(*s->initialPosition));
+        if (s->initialPosition == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_FullPositionVector(r, s->initialPosition);
+    }
+    if (present & (1u << 0)) {
+        s->currGNSSstatus = uper_fast_alloc(r, sizeof(*s->currGNSSstatus));
+        if (s->currGNSSstatus == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_bits(r, s->currGNSSstatus, 8);
+    }
+    ok &= uper_fast_get_PathHistoryPointList(r, &s->crumbData);
+    return ok;
+}
+
+
+static bool uper_fast_put_PathPrediction(uper_fast_writer_t* w, struct PathPrediction const* s)
+{
+    uper_fast_put(w, 0, 1);
+    bool ok = true;
+    ok &= uper_fast_put_int(w, s->radiusOfCurve, -32767, 32767, 16);
+    ok &= uper_fast_put_int(w, s->confidence, 0, 200, 8);
+    return ok;
+}
+
+
+static bool uper_fast_get_PathPrediction(uper_fast_reader_t* r, struct PathPrediction* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    bool ok = true;
+    ok &= uper_fast_get_int(r, &s->radiusOfCurve, -32767, 32767, 16);
+    ok &= uper_fast_get_int(r, &s->confidence, 0, 200, 8);
+    return ok;
+}
+
+
+static bool uper_fast_put_PropelledInformation(uper_fast_writer_t* w,
+                                               struct PropelledInformation const* s)
+{
+    bool ok = true;
+    switch (s->present) {
+        case PropelledInformation_PR_human:
+            uper_fast_put(w, 0, 1);
+            uper_fast_put(w, 0, 2);
+            ok &= uper_fast_put_ext_int(w, s->choice.human, 0, 5, 3);
+            break;
+        case PropelledInformation_PR_animal:
+            uper_fast_put(w, 0, 1);
+            uper_fast_put(w, 1, 2);
+            ok &= uper_fast_put_ext_int(w, s->choice.animal, 0, 3, 2);
+            break;
+        case PropelledInformation_PR_motor:
+            uper_fast_put(w, 0, 1);
+            uper_fast_put(w, 2, 2);
+            ok &= uper_fast_put_ext_int(w, s->choice.motor, 0, 5, 3);
+            break;
+        default:
+            return false;
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_PropelledInformation(uper_fast_reader_t* r,
+                                               struct PropelledInformation* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    bool ok = true;
+    switch (uper_fast_get(r, 2)) {
+        case 0:
+            s->present = PropelledInformation_PR_human;
+            ok &= uper_fast_get_ext_int(r, &s->choice.human, 0, 5, 3);
+            break;
+        case 1:
+            s->present = PropelledInformation_PR_animal;
+            ok &= uper_fast_get_ext_int(r, &s->choice.animal, 0, 3, 2);
+            break;
+        case 2:
+            s->present = PropelledInformation_PR_motor;
+            ok &= uper_fast_get_ext_int(r, &s->choice.motor, 0, 5, 3);
+            break;
+        default:
+            return false;
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_PersonalSafetyMessage(uper_fast_writer_t* w,
+                                                struct PersonalSafetyMessage const* s)
+{
+    uper_fast_put(w, 0, 1);
+    uper_fast_put(w, s->accelSet != NULL, 1);
+    uper_fast_put(w, s->pathHistory != NULL, 1);
+    uper_fast_put(w, s->pathPrediction != NULL, 1);
+    uper_fast_put(w, s->propulsion != NULL, 1);
+    uper_fast_put(w, s->useState != NULL, 1);
+    uper_fast_put(w, s->crossRequest != NULL, 1);
+    uper_fast_put(w, s->crossState != NULL, 1);
+    uper_fast_put(w, s->clusterSize != NULL, 1);
+    uper_fast_put(w, s->clusterRadius != NULL, 1);
+    uper_fast_put(w, s->eventResponderType != NULL, 1);
+    uper_fast_put(w, s->activityType != NULL, 1);
+    uper_fast_put(w, s->activitySubType != NULL, 1);
+    uper_fast_put(w, s->assistType != NULL, 1);
+    uper_fast_put(w, s->sizing != NULL, 1);
+    uper_fast_put(w, s->attachment != NULL, 1);
+    uper_fast_put(w, s->attachmentRadius != NULL, 1);
+    uper_fast_put(w, s->animalType != NULL, 1);
+    uper_fast_put(w, s->regional != NULL, 1);
+    bool ok = true;
+    ok &= uper_fast_put_ext_int(w, s->basicType, 0, 4, 3);
+    ok &= uper_fast_put_int(w, s->secMark, 0, 65535, 16);
+    ok &= uper_fast_put_int(w, s->msgCnt, 0, 127, 7);
+    ok &= uper_fast_put_octets(w, &s->id, 4, 4, 0);
+    ok &= uper_fast_put_Position3D(w, &s->position);
+    ok &= uper_fast_put_PositionalAccuracy(w, &s->accuracy);
+    ok &= uper_fast_put_int(w, s->speed, 0, 8191, 13);
+    ok &= uper_fast_put_int(w, s->heading, 0, 28800, 15);
+    if (s->accelSet != NULL) {
+        ok &= uper_fast_put_AccelerationSet4Way(w, s->accelSet);
+    }
+    if (s->pathHistory != NULL) {
+        ok &= uper_fast_put_PathHistory(w, s->pathHistory);
+    }
+    if (s->pathPrediction != NULL) {
+        ok &= uper_fast_put_PathPrediction(w, s->pathPrediction);
+    }
+    if (s->propulsion != NULL) {
+        ok &= uper_fast_put_PropelledInformation(w, s->propulsion);
+    }
+    if (s->useState != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_PersonalSafetyMessage.elements[12], s->useState);
+    }
+    if (s->crossRequest != NULL) {
+        uper_fast_put(w, *s->crossRequest != 0, 1);
+    }
+    if (s->crossState != NULL) {
+        uper_fast_put(w, *s->crossState != 0, 1);
+    }
+    if (s->clusterSize != NULL) {
+        ok &= uper_fast_put_ext_int(w, *s->clusterSize, 0, 3, 2);
+    }
+    if (s->clusterRadius != NULL) {
+        ok &= uper_fast_put_int(w, *s->clusterRadius, 0, 100, 7);
+    }
+    if (s->eventResponderType != NULL) {
+        ok &= uper_fast_put_ext_int(w, *s->eventResponderType, 0, 7, 3);
+    }
+    if (s->activityType != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_PersonalSafetyMessage.elements[18], s->activityType);
+    }
+    if (s->activitySubType != NULL) {
+        ok &= uper_fast_put_member(w,
+                                   &asn_DEF_PersonalSafetyMessage.elements[19],
+                                   s->activitySubType);
+    }
+    if (s->assistType != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_PersonalSafetyMessage.elements[20], s->assistType);
+    }
+    if (s->sizing != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_PersonalSafetyMessage.elements[21], s->sizing);
+    }
+    if (s->attachment != NULL) {
+        ok &= uper_fast_put_ext_int(w, *s->attachment, 0, 6, 3);
+    }
+    if (s->attachmentRadius != NULL) {
+        ok &= uper_fast_put_int(w, *s->attachmentRadius, 0, 200, 8);
+    }
+    if (s->animalType != NULL) {
+        ok &= uper_fast_put_ext_int(w, *s->animalType, 0, 3, 2);
+    }
+    if (s->regional != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_PersonalSafetyMessage.elements[25], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_PersonalSafetyMessage(uper_fast_reader_t* r,
+                                                struct PersonalSafetyMessage* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    uint32_t const present = uper_fast_get(r, 18);
+    bool ok = true;
+    ok &= uper_fast_get_ext_int(r, &s->basicType, 0, 4, 3);
+    ok &= uper_fast_get_int(r, &s->secMark, 0, 65535, 16);
+    ok &= uper_fast_get_int(r, &s->msgCnt, 0, 127, 7);
+    ok &= uper_fast_get_octets(r, &s->id, 4, 4, 0);
+    ok &= uper_fast_get_Position3D(r, &s->position);
+    ok &= uper_fast_get_PositionalAccuracy(r, &s->accuracy);
+    ok &= uper_fast_get_int(r, &s->speed, 0, 8191, 13);
+    ok &= uper_fast_get_int(r, &s->heading, 0, 28800, 15);
+    if (present & (1u << 17)) {
+        s->accelSet = uper_fast_alloc(r, sizeof(*s->accelSet));
+        if (s->accelSet == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_AccelerationSet4Way(r, s->accelSet);
+    }
+    if (present & (1u << 16)) {
+        s->pathHistory = uper_fast_alloc(r, sizeof(*s->pathHistory));
+        if (s->pathHistory == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_PathHistory(r, s->pathHistory);
+    }
+    if (present & (1u << 15)) {
+        s->pathPrediction = uper_fast_alloc(r, sizeof(*s->pathPrediction));
+        if (s->pathPrediction == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_PathPrediction(r, s->pathPrediction);
+    }
+    if (present & (1u << 14)) {
+        s->propulsion = uper_fast_alloc(r, sizeof(*s->propulsion));
+        if (s->propulsion == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_PropelledInformation(r, s->propulsion);
+    }
+    if (present & (1u << 13)) {
+        s->useState = uper_fast_alloc(r, sizeof(*s->useState));
+        if (s->useState == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_PersonalSafetyMessage.elements[12], s->useState);
+    }
+    if (present & (1u << 12)) {
+        s->crossRequest = uper_fast_alloc(r, sizeof(*s->crossRequest));
+        if (s->crossRequest == NULL) {
+            return false;
+        }
+        *s->crossRequest = (BOOLEAN_t)uper_fast_get(r, 1);
+    }
+    if (present & (1u << 11)) {
+        s->crossState = uper_fast_alloc(r, sizeof(*s->crossState));
+        if (s->crossState == NULL) {
+            return false;
+        }
+        *s->crossState = (BOOLEAN_t)uper_fast_get(r, 1);
+    }
+    if (present & (1u << 10)) {
+        s->clusterSize = uper_fast_alloc(r, sizeof(*s->clusterSize));
+        if (s->clusterSize == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_ext_int(r, s->clusterSize, 0, 3, 2);
+    }
+    if (present & (1u << 9)) {
+        s->clusterRadius = uper_fast_alloc(r, sizeof(*s->clusterRadius));
+        if (s->clusterRadius == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->clusterRadius, 0, 100, 7);
+    }
+    if (present & (1u << 8)) {
+        s->eventResponderType = uper_fast_alloc(r, sizeof(*s->eventResponderType));
+        if (s->eventResponderType == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_ext_int(r, s->eventResponderType, 0, 7, 3);
+    }
+    if (present & (1u << 7)) {
+        s->activityType = uper_fast_alloc(r, sizeof(*s->activityType));
+        if (s->activityType == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_PersonalSafetyMessage.elements[18], s->activityType);
+    }
+    if (present & (1u << 6)) {
+        s->activitySubType = uper_fast_alloc(r, sizeof(*s->activitySubType));
+        if (s->activitySubType == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r,
+                                   &asn_DEF_PersonalSafetyMessage.elements[19],
+                                   s->activitySubType);
+    }
+    if (present & (1u << 5)) {
+        s->assistType = uper_fast_alloc(r, sizeof(*s->assistType));
+        if (s->assistType == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_PersonalSafetyMessage.elements[20], s->assistType);
+    }
+    if (present & (1u << 4)) {
+        s->sizing = uper_fast_alloc(r, sizeof(*s->sizing));
+        if (s->sizing == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_PersonalSafetyMessage.elements[21], s->sizing);
+    }
+    if (present & (1u << 3)) {
+        s->attachment = uper_fast_alloc(r, sizeof(*s->attachment));
+        if (s->attachment == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_ext_int(r, s->attachment, 0, 6, 3);
+    }
+    if (present & (1u << 2)) {
+        s->attachmentRadius = uper_fast_alloc(r, sizeof(*s->attachmentRadius));
+        if (s->attachmentRadius == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->attachmentRadius, 0, 200, 8);
+    }
+    if (present & (1u << 1)) {
+        s->animalType = uper_fast_alloc(r, sizeof(*s->animalType));
+        if (s->animalType == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_ext_int(r, s->animalType, 0, 3, 2);
+    }
+    if (present & (1u << 0)) {
+        s->regional = uper_fast_alloc(r, sizeof(*s->regional));
+        if (s->regional == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_PersonalSafetyMessage.elements[25], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_IntersectionReferenceID(uper_fast_writer_t* w,
+                                                  struct IntersectionReferenceID const* s)
+{
+    uper_fast_put(w, s->region != NULL, 1);
+    bool ok = true;
+    if (s->region != NULL) {
+        ok &= uper_fast_put_int(w, *s->region, 0, 65535, 16);
+    }
+    ok &= uper_fast_put_int(w, s->id, 0, 65535, 16);
+    return ok;
+}
+
+
+static bool uper_fast_get_IntersectionReferenceID(uper_fast_reader_t* r,
+                                                  struct IntersectionReferenceID* s)
+{
+    uint32_t const present = uper_fast_get(r, 1);
+    bool ok = true;
+    if (present & (1u << 0)) {
+        s->region = uper_fast_alloc(r, sizeof(*s->region));
+        if (s->region == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->region, 0, 65535, 16);
+    }
+    ok &= uper_fast_get_int(r, &s->id, 0, 65535, 16);
+    return ok;
+}
+
+
+static bool uper_fast_put_EnabledLaneList(uper_fast_writer_t* w, struct EnabledLaneList const* s)
+{
+    if (s->list.count < 1 || s->list.count > 16) {
+        return false;
+    }
+    uper_fast_put(w, (uint32_t)(s->list.count - 1), 4);
+    bool ok = true;
+    for (int i = 0; i < s->list.count; i++) {
+        if (s->list.array[i] == NULL) {
+            return false;
+        }
+        ok &= uper_fast_put_int(w, *s->list.array[i], 0, 255, 8);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_EnabledLaneList(uper_fast_reader_t* r, struct EnabledLaneList* s)
+{
+    long const count = 1 + (long)uper_fast_get(r, 4);
+    if (count > 16) {
+        return false;
+    }
+    bool ok = true;
+    for (long i = 0; i < count && !r->overrun; i++) {
+        if (uper_fast_add(r, &s->list, sizeof(**s->list.array)) == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->list.array[i], 0, 255, 8);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_TimeChangeDetails(uper_fast_writer_t* w,
+                                            struct TimeChangeDetails const* s)
+{
+    uper_fast_put(w, s->startTime != NULL, 1);
+    uper_fast_put(w, s->maxEndTime != NULL, 1);
+    uper_fast_put(w, s->likelyTime != NULL, 1);
+    uper_fast_put(w, s->confidence != NULL, 1);
+    uper_fast_put(w, s->nextTime != NULL, 1);
+    bool ok = true;
+    if (s->startTime != NULL) {
+        ok &= uper_fast_put_int(w, *s->startTime, 0, 36111, 16);
+    }
+    ok &= uper_fast_put_int(w, s->minEndTime, 0, 36111, 16);
+    if (s->maxEndTime != NULL) {
+        ok &= uper_fast_put_int(w, *s->maxEndTime, 0, 36111, 16);
+    }
+    if (s->likelyTime != NULL) {
+        ok &= uper_fast_put_int(w, *s->likelyTime, 0, 36111, 16);
+    }
+    if (s->confidence != NULL) {
+        ok &= uper_fast_put_int(w, *s->confidence, 0, 15, 4);
+    }
+    if (s->nextTime != NULL) {
+        ok &= uper_fast_put_int(w, *s->nextTime, 0, 36111, 16);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_TimeChangeDetails(uper_fast_reader_t* r, struct TimeChangeDetails* s)
+{
+    uint32_t const present = uper_fast_get(r, 5);
+    bool ok = true;
+    if (present & (1u << 4)) {
+        s->startTime = uper_fast_alloc(r, sizeof(*s->startTime));
+        if (s->startTime == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->startTime, 0, 36111, 16);
+    }
+    ok &= uper_fast_get_int(r, &s->minEndTime, 0, 36111, 16);
+    if (present & (1u << 3)) {
+        s->maxEndTime = uper_fast_alloc(r, sizeof(*s->maxEndTime));
+        if (s->maxEndTime == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->maxEndTime, 0, 36111, 16);
+    }
+    if (present & (1u << 2)) {
+        s->likelyTime = uper_fast_alloc(r, sizeof(*s->likelyTime));
+        if (s->likelyTime == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->likelyTime, 0, 36111, 16);
+    }
+    if (present & (1u << 1)) {
+        s->confidence = uper_fast_alloc(r, sizeof(*s->confidence));
+        if (s->confidence == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->confidence, 0, 15, 4);
+    }
+    if (present & (1u << 0)) {
+        s->nextTime = uper_fast_alloc(r, sizeof(*s->nextTime));
+        if (s->nextTime == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->nextTime, 0, 36111, 16);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_AdvisorySpeed(uper_fast_writer_t* w, struct AdvisorySpeed const* s)
+{
+    uper_fast_put(w, 0, 1);
+    uper_fast_put(w, s->speed != NULL, 1);
+    uper_fast_put(w, s->confidence != NULL, 1);
+    uper_fast_put(w, s->distance != NULL, 1);
+    uper_fast_put(w, s->Class != NULL, 1);
+    uper_fast_put(w, s->regional != NULL, 1);
+    bool ok = true;
+    ok &= uper_fast_put_ext_int(w, s->type, 0, 3, 2);
+    if (s->speed != NULL) {
+        ok &= uper_fast_put_int(w, *s->speed, 0, 500, 9);
+    }
+    if (s->confidence != NULL) {
+        ok &= uper_fast_put_int(w, *s->confidence, 0, 7, 3);
+    }
+    if (s->distance != NULL) {
+        ok &= uper_fast_put_int(w, *s->distance, 0, 10000, 14);
+    }
+    if (s->Class != NULL) {
+        ok &= uper_fast_put_int(w, *s->Class, 0, 255, 8);
+    }
+    if (s->regional != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_AdvisorySpeed.elements[5], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_AdvisorySpeed(uper_fast_reader_t* r, struct AdvisorySpeed* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    uint32_t const present = uper_fast_get(r, 5);
+    bool ok = true;
+    ok &= uper_fast_get_ext_int(r, &s->type, 0, 3, 2);
+    if (present & (1u << 4)) {
+        s->speed = uper_fast_alloc(r, sizeof(*s->speed));
+        if (s->speed == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->speed, 0, 500, 9);
+    }
+    if (present & (1u << 3)) {
+        s->confidence = uper_fast_alloc(r, sizeof(*s->confidence));
+        if (s->confidence == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->confidence, 0, 7, 3);
+    }
+    if (present & (1u << 2)) {
+        s->distance = uper_fast_alloc(r, sizeof(*s->distance));
+        if (s->distance == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->distance, 0, 10000, 14);
+    }
+    if (present & (1u << 1)) {
+        s->Class = uper_fast_alloc(r, sizeof(*s->Class));
+        if (s->Class == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->Class, 0, 255, 8);
+    }
+    if (present & (1u << 0)) {
+        s->regional = uper_fast_alloc(r, sizeof(*s->regional));
+        if (s->regional == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_AdvisorySpeed.elements[5], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_AdvisorySpeedList(uper_fast_writer_t* w,
+                                            struct AdvisorySpeedList const* s)
+{
+    if (s->list.count < 1 || s->list.count > 16) {
+        return false;
+    }
+    uper_fast_put(w, (uint32_t)(s->list.count - 1), 4);
+    bool ok = true;
+    for (int i = 0; i < s->list.count; i++) {
+        if (s->list.array[i] == NULL) {
+            return false;
+        }
+        ok &= uper_fast_put_AdvisorySpeed(w, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_AdvisorySpeedList(uper_fast_reader_t* r, struct AdvisorySpeedList* s)
+{
+    long const count = 1 + (long)uper_fast_get(r, 4);
+    if (count > 16) {
+        return false;
+    }
+    bool ok = true;
+    for (long i = 0; i < count && !r->overrun; i++) {
+        if (uper_fast_add(r, &s->list, sizeof(**s->list.array)) == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_AdvisorySpeed(r, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_MovementEvent(uper_fast_writer_t* w, struct MovementEvent const* s)
+{
+    uper_fast_put(w, 0, 1);
+    uper_fast_put(w, s->timing != NULL, 1);
+    uper_fast_put(w, s->speeds != NULL, 1);
+    uper_fast_put(w, s->regional != NULL, 1);
+    bool ok = true;
+    ok &= uper_fast_put_int(w, s->eventState, 0, 9, 4);
+    if (s->timing != NULL) {
+        ok &= uper_fast_put_TimeChangeDetails(w, s->timing);
+    }
+    if (s->speeds != NULL) {
+        ok &= uper_fast_put_AdvisorySpeedList(w, s->speeds);
+    }
+    if (s->regional != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_MovementEvent.elements[3], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_MovementEvent(uper_fast_reader_t* r, struct MovementEvent* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    uint32_t const present = uper_fast_get(r, 3);
+    bool ok = true;
+    ok &= uper_fast_get_int(r, &s->eventState, 0, 9, 4);
+    if (present & (1u << 2)) {
+        s->timing = uper_fast_alloc(r, sizeof(*s->timing));
+        if (s->timing == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_TimeChangeDetails(r, s->timing);
+    }
+    if (present & (1u << 1)) {
+        s->speeds = uper_fast_alloc(r, sizeof(*s->speeds));
+        if (s->speeds == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_AdvisorySpeedList(r, s->speeds);
+    }
+    if (present & (1u << 0)) {
+        s->regional = uper_fast_alloc(r, sizeof(*s->regional));
+        if (s->regional == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_MovementEvent.elements[3], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_MovementEventList(uper_fast_writer_t* w,
+                                            struct MovementEventList const* s)
+{
+    if (s->list.count < 1 || s->list.count > 16) {
+        return false;
+    }
+    uper_fast_put(w, (uint32_t)(s->list.count - 1), 4);
+    bool ok = true;
+    for (int i = 0; i < s->list.count; i++) {
+        if (s->list.array[i] == NULL) {
+            return false;
+        }
+        ok &= uper_fast_put_MovementEvent(w, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_MovementEventList(uper_fast_reader_t* r, struct MovementEventList* s)
+{
+    long const count = 1 + (long)uper_fast_get(r, 4);
+    if (count > 16) {
+        return false;
+    }
+    bool ok = true;
+    for (long i = 0; i < count && !r->overrun; i++) {
+        if (uper_fast_add(r, &s->list, sizeof(**s->list.array)) == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_MovementEvent(r, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_ConnectionManeuverAssist(uper_fast_writer_t* w,
+                                                   struct ConnectionManeuverAssist const* s)
+{
+    uper_fast_put(w, 0, 1);
+    uper_fast_put(w, s->queueLength != NULL, 1);
+    uper_fast_put(w, s->availableStorageLength != NULL, 1);
+    uper_fast_put(w, s->waitOnStop != NULL, 1);
+    uper_fast_put(w, s->pedBicycleDetect != NULL, 1);
+    uper_fast_put(w, s->regional != NULL, 1);
+    bool ok = true;
+    ok &= uper_fast_put_int(w, s->connectionID, 0, 255, 8);
+    if (s->queueLength != NULL) {
+        ok &= uper_fast_put_int(w, *s->queueLength, 0, 10000, 14);
+    }
+    if (s->availableStorageLength != NULL) {
+        ok &= uper_fast_put_int(w, *s->availableStorageLength, 0, 10000, 14);
+    }
+    if (s->waitOnStop != NULL) {
+        uper_fast_put(w, *s->waitOnStop != 0, 1);
+    }
+    if (s->pedBicycleDetect != NULL) {
+        uper_fast_put(w, *s->pedBicycleDetect != 0, 1);
+    }
+    if (s->regional != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_ConnectionManeuverAssist.elements[5], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_ConnectionManeuverAssist(uper_fast_reader_t* r,
+                                                   struct ConnectionManeuverAssist* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    uint32_t const present = uper_fast_get(r, 5);
+    bool ok = true;
+    ok &= uper_fast_get_int(r, &s->connectionID, 0, 255, 8);
+    if (present & (1u << 4)) {
+        s->queueLength = uper_fast_alloc(r, sizeof(*s->queueLength));
+        if (s->queueLength == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->queueLength, 0, 10000, 14);
+    }
+    if (present & (1u << 3)) {
+        s->availableStorageLength = uper_fast_alloc(r, sizeof(*s->availableStorageLength));
+        if (s->availableStorageLength == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->availableStorageLength, 0, 10000, 14);
+    }
+    if (present & (1u << 2)) {
+        s->waitOnStop = uper_fast_alloc(r, sizeof(*s->waitOnStop));
+        if (s->waitOnStop == NULL) {
+            return false;
+        }
+        *s->waitOnStop = (BOOLEAN_t)uper_fast_get(r, 1);
+    }
+    if (present & (1u << 1)) {
+        s->pedBicycleDetect = uper_fast_alloc(r, sizeof(*s->pedBicycleDetect));
+        if (s->pedBicycleDetect == NULL) {
+            return false;
+        }
+        *s->pedBicycleDetect = (BOOLEAN_t)uper_fast_get(r, 1);
+    }
+    if (present & (1u << 0)) {
+        s->regional = uper_fast_alloc(r, sizeof(*s->regional));
+        if (s->regional == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_ConnectionManeuverAssist.elements[5], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_ManeuverAssistList(uper_fast_writer_t* w,
+                                             struct ManeuverAssistList const* s)
+{
+    if (s->list.count < 1 || s->list.count > 16) {
+        return false;
+    }
+    uper_fast_put(w, (uint32_t)(s->list.count - 1), 4);
+    bool ok = true;
+    for (int i = 0; i < s->list.count; i++) {
+        if (s->list.array[i] == NULL) {
+            return false;
+        }
+        ok &= uper_fast_put_ConnectionManeuverAssist(w, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_ManeuverAssistList(uper_fast_reader_t* r, struct ManeuverAssistList* s)
+{
+    long const count = 1 + (long)uper_fast_get(r, 4);
+    if (count > 16) {
+        return false;
+    }
+    bool ok = true;
+    for (long i = 0; i < count && !r->overrun; i++) {
+        if (uper_fast_add(r, &s->list, sizeof(**s->list.array)) == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_ConnectionManeuverAssist(r, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_MovementState(uper_fast_writer_t* w, struct MovementState const* s)
+{
+    uper_fast_put(w, 0, 1);
+    uper_fast_put(w, s->movementName != NULL, 1);
+    uper_fast_put(w, s->maneuverAssistList != NULL, 1);
+    uper_fast_put(w, s->regional != NULL, 1);
+    bool ok = true;
+    if (s->movementName != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_MovementState.elements[0], s->movementName);
+    }
+    ok &= uper_fast_put_int(w, s->signalGroup, 0, 255, 8);
+    ok &= uper_fast_put_MovementEventList(w, &s->state_time_speed);
+    if (s->maneuverAssistList != NULL) {
+        ok &= uper_fast_put_ManeuverAssistList(w, s->maneuverAssistList);
+    }
+    if (s->regional != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_MovementState.elements[4], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_MovementState(uper_fast_reader_t* r, struct MovementState* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    uint32_t const present = uper_fast_get(r, 3);
+    bool ok = true;
+    if (present & (1u << 2)) {
+        s->movementName = uper_fast_alloc(r, sizeof(*s->movementName));
+        if (s->movementName == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_MovementState.elements[0], s->movementName);
+    }
+    ok &= uper_fast_get_int(r, &s->signalGroup, 0, 255, 8);
+    ok &= uper_fast_get_MovementEventList(r, &s->state_time_speed);
+    if (present & (1u << 1)) {
+        s->maneuverAssistList = uper_fast_alloc(r, sizeof(*s->maneuverAssistList));
+        if (s->maneuverAssistList == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_ManeuverAssistList(r, s->maneuverAssistList);
+    }
+    if (present & (1u << 0)) {
+        s->regional = uper_fast_alloc(r, sizeof(*s->regional));
+        if (s->regional == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_MovementState.elements[4], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_MovementList(uper_fast_writer_t* w, struct MovementList const* s)
+{
+    if (s->list.count < 1 || s->list.count > 255) {
+        return false;
+    }
+    uper_fast_put(w, (uint32_t)(s->list.count - 1), 8);
+    bool ok = true;
+    for (int i = 0; i < s->list.count; i++) {
+        if (s->list.array[i] == NULL) {
+            return false;
+        }
+        ok &= uper_fast_put_MovementState(w, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_MovementList(uper_fast_reader_t* r, struct MovementList* s)
+{
+    long const count = 1 + (long)uper_fast_get(r, 8);
+    if (count > 255) {
+        return false;
+    }
+    bool ok = true;
+    for (long i = 0; i < count && !r->overrun; i++) {
+        if (uper_fast_add(r, &s->list, sizeof(**s->list.array)) == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_MovementState(r, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_IntersectionState(uper_fast_writer_t* w,
+                                            struct IntersectionState const* s)
+{
+    uper_fast_put(w, 0, 1);
+    uper_fast_put(w, s->name != NULL, 1);
+    uper_fast_put(w, s->moy != NULL, 1);
+    uper_fast_put(w, s->timeStamp != NULL, 1);
+    uper_fast_put(w, s->enabledLanes != NULL, 1);
+    uper_fast_put(w, s->maneuverAssistList != NULL, 1);
+    uper_fast_put(w, s->regional != NULL, 1);
+    bool ok = true;
+    if (s->name != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_IntersectionState.elements[0], s->name);
+    }
+    ok &= uper_fast_put_IntersectionReferenceID(w, &s->id);
+    ok &= uper_fast_put_int(w, s->revision, 0, 127, 7);
+    ok &= uper_fast_put_bits(w, &s->status, 16);
+    if (s->moy != NULL) {
+        ok &= uper_fast_put_int(w, *s->moy, 0, 527040, 20);
+    }
+    if (s->timeStamp != NULL) {
+        ok &= uper_fast_put_int(w, *s->timeStamp, 0, 65535, 16);
+    }
+    if (s->enabledLanes != NULL) {
+        ok &= uper_fast_put_EnabledLaneList(w, s->enabledLanes);
+    }
+    ok &= uper_fast_put_MovementList(w, &s->states);
+    if (s->maneuverAssistList != NULL) {
+        ok &= uper_fast_put_ManeuverAssistList(w, s->maneuverAssistList);
+    }
+    if (s->regional != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_IntersectionState.elements[9], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_IntersectionState(uper_fast_reader_t* r, struct IntersectionState* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    uint32_t const present = uper_fast_get(r, 6);
+    bool ok = true;
+    if (present & (1u << 5)) {
+        s->name = uper_fast_alloc(r, sizeof(*s->name));
+        if (s->name == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_IntersectionState.elements[0], s->name);
+    }
+    ok &= uper_fast_get_IntersectionReferenceID(r, &s->id);
+    ok &= uper_fast_get_int(r, &s->revision, 0, 127, 7);
+    ok &= uper_fast_get_bits(r, &s->status, 16);
+    if (present & (1u << 4)) {
+        s->moy = uper_fast_alloc(r, sizeof(*s->moy));
+        if (s->moy == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->moy, 0, 527040, 20);
+    }
+    if (present & (1u << 3)) {
+        s->timeStamp = uper_fast_alloc(r, sizeof(*s->timeStamp));
+        if (s->timeStamp == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->timeStamp, 0, 65535, 16);
+    }
+    if (present & (1u << 2)) {
+        s->enabledLanes = uper_fast_alloc(r, sizeof(*s->enabledLanes));
+        if (s->enabledLanes == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_EnabledLaneList(r, s->enabledLanes);
+    }
+    ok &= uper_fast_get_MovementList(r, &s->states);
+    if (present & (1u << 1)) {
+        s->maneuverAssistList = uper_fast_alloc(r, sizeof(*s->maneuverAssistList));
+        if (s->maneuverAssistList == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_ManeuverAssistList(r, s->maneuverAssistList);
+    }
+    if (present & (1u << 0)) {
+        s->regional = uper_fast_alloc(r, sizeof(*s->regional));
+        if (s->regional == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_IntersectionState.elements[9], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_IntersectionStateList(uper_fast_writer_t* w,
+                                                struct IntersectionStateList const* s)
+{
+    if (s->list.count < 1 || s->list.count > 32) {
+        return false;
+    }
+    uper_fast_put(w, (uint32_t)(s->list.count - 1), 5);
+    bool ok = true;
+    for (int i = 0; i < s->list.count; i++) {
+        if (s->list.array[i] == NULL) {
+            return false;
+        }
+        ok &= uper_fast_put_IntersectionState(w, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_IntersectionStateList(uper_fast_reader_t* r,
+                                                struct IntersectionStateList* s)
+{
+    long const count = 1 + (long)uper_fast_get(r, 5);
+    if (count > 32) {
+        return false;
+    }
+    bool ok = true;
+    for (long i = 0; i < count && !r->overrun; i++) {
+        if (uper_fast_add(r, &s->list, sizeof(**s->list.array)) == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_IntersectionState(r, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_SPAT(uper_fast_writer_t* w, struct SPAT const* s)
+{
+    uper_fast_put(w, 0, 1);
+    uper_fast_put(w, s->timeStamp != NULL, 1);
+    uper_fast_put(w, s->name != NULL, 1);
+    uper_fast_put(w, s->regional != NULL, 1);
+    bool ok = true;
+    if (s->timeStamp != NULL) {
+        ok &= uper_fast_put_int(w, *s->timeStamp, 0, 527040, 20);
+    }
+    if (s->name != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_SPAT.elements[1], s->name);
+    }
+    ok &= uper_fast_put_IntersectionStateList(w, &s->intersections);
+    if (s->regional != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_SPAT.elements[3], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_SPAT(uper_fast_reader_t* r, struct SPAT* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    uint32_t const present = uper_fast_get(r, 3);
+    bool ok = true;
+    if (present & (1u << 2)) {
+        s->timeStamp = uper_fast_alloc(r, sizeof(*s->timeStamp));
+        if (s->timeStamp == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->timeStamp, 0, 527040, 20);
+    }
+    if (present & (1u << 1)) {
+        s->name = uper_fast_alloc(r, sizeof(*s->name));
+        if (s->name == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_SPAT.elements[1], s->name);
+    }
+    ok &= uper_fast_get_IntersectionStateList(r, &s->intersections);
+    if (present & (1u << 0)) {
+        s->regional = uper_fast_alloc(r, sizeof(*s->regional));
+        if (s->regional == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_SPAT.elements[3], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_RegulatorySpeedLimit(uper_fast_writer_t* w,
+                                               struct RegulatorySpeedLimit const* s)
+{
+    bool ok = true;
+    ok &= uper_fast_put_ext_int(w, s->type, 0, 12, 4);
+    ok &= uper_fast_put_int(w, s->speed, 0, 8191, 13);
+    return ok;
+}
+
+
+static bool uper_fast_get_RegulatorySpeedLimit(uper_fast_reader_t* r,
+                                               struct RegulatorySpeedLimit* s)
+{
+    bool ok = true;
+    ok &= uper_fast_get_ext_int(r, &s->type, 0, 12, 4);
+    ok &= uper_fast_get_int(r, &s->speed, 0, 8191, 13);
+    return ok;
+}
+
+
+static bool uper_fast_put_SpeedLimitList(uper_fast_writer_t* w, struct SpeedLimitList const* s)
+{
+    if (s->list.count < 1 || s->list.count > 9) {
+        return false;
+    }
+    uper_fast_put(w, (uint32_t)(s->list.count - 1), 4);
+    bool ok = true;
+    for (int i = 0; i < s->list.count; i++) {
+        if (s->list.array[i] == NULL) {
+            return false;
+        }
+        ok &= uper_fast_put_RegulatorySpeedLimit(w, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_SpeedLimitList(uper_fast_reader_t* r, struct SpeedLimitList* s)
+{
+    long const count = 1 + (long)uper_fast_get(r, 4);
+    if (count > 9) {
+        return false;
+    }
+    bool ok = true;
+    for (long i = 0; i < count && !r->overrun; i++) {
+        if (uper_fast_add(r, &s->list, sizeof(**s->list.array)) == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_RegulatorySpeedLimit(r, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_LaneTypeAttributes(uper_fast_writer_t* w,
+                                             struct LaneTypeAttributes const* s)
+{
+    bool ok = true;
+    switch (s->present) {
+        case LaneTypeAttributes_PR_vehicle:
+            uper_fast_put(w, 0, 1);
+            uper_fast_put(w, 0, 3);
+            ok &= uper_fast_put_member(w,
+                                       &asn_DEF_LaneTypeAttributes.elements[0],
+                                       &s->choice.vehicle);
+            break;
+        case LaneTypeAttributes_PR_crosswalk:
+            uper_fast_put(w, 0, 1);
+            uper_fast_put(w, 1, 3);
+            ok &= uper_fast_put_bits(w, &s->choice.crosswalk, 16);
+            break;
+        case LaneTypeAttributes_PR_bikeLane:
+            uper_fast_put(w, 0, 1);
+            uper_fast_put(w, 2, 3);
+            ok &= uper_fast_put_bits(w, &s->choice.bikeLane, 16);
+            break;
+        case LaneTypeAttributes_PR_sidewalk:
+            uper_fast_put(w, 0, 1);
+            uper_fast_put(w, 3, 3);
+            ok &= uper_fast_put_bits(w, &s->choice.sidewalk, 16);
+            break;
+        case LaneTypeAttributes_PR_median:
+            uper_fast_put(w, 0, 1);
+            uper_fast_put(w, 4, 3);
+            ok &= uper_fast_put_bits(w, &s->choice.median, 16);
+            break;
+        case LaneTypeAttributes_PR_striping:
+            uper_fast_put(w, 0, 1);
+            uper_fast_put(w, 5, 3);
+            ok &= uper_fast_put_bits(w, &s->choice.striping, 16);
+            break;
+        case LaneTypeAttributes_PR_trackedVehicle:
+            uper_fast_put(w, 0, 1);
+            uper_fast_put(w, 6, 3);
+            ok &= uper_fast_put_bits(w, &s->choice.trackedVehicle, 16);
+            break;
+        case LaneTypeAttributes_PR_parking:
+            uper_fast_put(w, 0, 1);
+            uper_fast_put(w, 7, 3);
+            ok &= uper_fast_put_bits(w, &s->choice.parking, 16);
+            break;
+        default:
+            return false;
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_LaneTypeAttributes(uper_fast_reader_t* r, struct LaneTypeAttributes* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    bool ok = true;
+    switch (uper_fast_get(r, 3)) {
+        case 0:
+            s->present = LaneTypeAttributes_PR_vehicle;
+            ok &= uper_fast_get_member(r,
+                                       &asn_DEF_LaneTypeAttributes.elements[0],
+                                       &s->choice.vehicle);
+            break;
+        case 1:
+            s->present = LaneTypeAttributes_PR_crosswalk;
+            ok &= uper_fast_get_bits(r, &s->choice.crosswalk, 16);
+            break;
+        case 2:
+            s->present = LaneTypeAttributes_PR_bikeLane;
+            ok &= uper_fast_get_bits(r, &s->choice.bikeLane, 16);
+            break;
+        case 3:
+            s->present = LaneTypeAttributes_PR_sidewalk;
+            ok &= uper_fast_get_bits(r, &s->choice.sidewalk, 16);
+            break;
+        case 4:
+            s->present = LaneTypeAttributes_PR_median;
+            ok &= uper_fast_get_bits(r, &s->choice.median, 16);
+            break;
+        case 5:
+            s->present = LaneTypeAttributes_PR_striping;
+            ok &= uper_fast_get_bits(r, &s->choice.striping, 16);
+            break;
+        case 6:
+            s->present = LaneTypeAttributes_PR_trackedVehicle;
+            ok &= uper_fast_get_bits(r, &s->choice.trackedVehicle, 16);
+            break;
+        case 7:
+            s->present = LaneTypeAttributes_PR_parking;
+            ok &= uper_fast_get_bits(r, &s->choice.parking, 16);
+            break;
+        default:
+            return false;
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_LaneAttributes(uper_fast_writer_t* w, struct LaneAttributes const* s)
+{
+    uper_fast_put(w, s->regional != NULL, 1);
+    bool ok = true;
+    ok &= uper_fast_put_bits(w, &s->directionalUse, 2);
+    ok &= uper_fast_put_bits(w, &s->sharedWith, 10);
+    ok &= uper_fast_put_LaneTypeAttributes(w, &s->laneType);
+    if (s->regional != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_LaneAttributes.elements[3], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_LaneAttributes(uper_fast_reader_t* r, struct LaneAttributes* s)
+{
+    uint32_t const present = uper_fast_get(r, 1);
+    bool ok = true;
+    ok &= uper_fast_get_bits(r, &s->directionalUse, 2);
+    ok &= uper_fast_get_bits(r, &s->sharedWith, 10);
+    ok &= uper_fast_get_LaneTypeAttributes(r, &s->laneType);
+    if (present & (1u << 0)) {
+        s->regional = uper_fast_alloc(r, sizeof(*s->regional));
+        if (s->regional == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_LaneAttributes.elements[3], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_Node_XY_20b(uper_fast_writer_t* w, struct Node_XY_20b const* s)
+{
+    bool ok = true;
+    ok &= uper_fast_put_int(w, s->x, -512, 511, 10);
+    ok &= uper_fast_put_int(w, s->y, -512, 511, 10);
+    return ok;
+}
+
+
+static bool uper_fast_get_Node_XY_20b(uper_fast_reader_t* r, struct Node_XY_20b* s)
+{
+    bool ok = true;
+    ok &= uper_fast_get_int(r, &s->x, -512, 511, 10);
+    ok &= uper_fast_get_int(r, &s->y, -512, 511, 10);
+    return ok;
+}
+
+
+static bool uper_fast_put_Node_XY_22b(uper_fast_writer_t* w, struct Node_XY_22b const* s)
+{
+    bool ok = true;
+    ok &= uper_fast_put_int(w, s->x, -1024, 1023, 11);
+    ok &= uper_fast_put_int(w, s->y, -1024, 1023, 11);
+    return ok;
+}
+
+
+static bool uper_fast_get_Node_XY_22b(uper_fast_reader_t* r, struct Node_XY_22b* s)
+{
+    bool ok = true;
+    ok &= uper_fast_get_int(r, &s->x, -1024, 1023, 11);
+    ok &= uper_fast_get_int(r, &s->y, -1024, 1023, 11);
+    return ok;
+}
+
+
+static bool uper_fast_put_Node_XY_24b(uper_fast_writer_t* w, struct Node_XY_24b const* s)
+{
+    bool ok = true;
+    ok &= uper_fast_put_int(w, s->x, -2048, 2047, 12);
+    ok &= uper_fast_put_int(w, s->y, -2048, 2047, 12);
+    return ok;
+}
+
+
+static bool uper_fast_get_Node_XY_24b(uper_fast_reader_t* r, struct Node_XY_24b* s)
+{
+    bool ok = true;
+    ok &= uper_fast_get_int(r, &s->x, -2048, 2047, 12);
+    ok &= uper_fast_get_int(r, &s->y, -2048, 2047, 12);
+    return ok;
+}
+
+
+static bool uper_fast_put_Node_XY_26b(uper_fast_writer_t* w, struct Node_XY_26b const* s)
+{
+    bool ok = true;
+    ok &= uper_fast_put_int(w, s->x, -4096, 4095, 13);
+    ok &= uper_fast_put_int(w, s->y, -4096, 4095, 13);
+    return ok;
+}
+
+
+static bool uper_fast_get_Node_XY_26b(uper_fast_reader_t* r, struct Node_XY_26b* s)
+{
+    bool ok = true;
+    ok &= uper_fast_get_int(r, &s->x, -4096, 4095, 13);
+    ok &= uper_fast_get_int(r, &s->y, -4096, 4095, 13);
+    return ok;
+}
+
+
+static bool uper_fast_put_Node_XY_28b(uper_fast_writer_t* w, struct Node_XY_28b const* s)
+{
+    bool ok = true;
+    ok &= uper_fast_put_int(w, s->x, -8192, 8191, 14);
+    ok &= uper_fast_put_int(w, s->y, -8192, 8191, 14);
+    return ok;
+}
+
+
+static bool uper_fast_get_Node_XY_28b(uper_fast_reader_t* r, struct Node_XY_28b* s)
+{
+    bool ok = true;
+    ok &= uper_fast_get_int(r, &s->x, -8192, 8191, 14);
+    ok &= uper_fast_get_int(r, &s->y, -8192, 8191, 14);
+    return ok;
+}
+
+
+static bool uper_fast_put_Node_XY_32b(uper_fast_writer_t* w, struct Node_XY_32b const* s)
+{
+    bool ok = true;
+    ok &= uper_fast_put_int(w, s->x, -32768, 32767, 16);
+    ok &= uper_fast_put_int(w, s->y, -32768, 32767, 16);
+    return ok;
+}
+
+
+static bool uper_fast_get_Node_XY_32b(uper_fast_reader_t* r, struct Node_XY_32b* s)
+{
+    bool ok = true;
+    ok &= uper_fast_get_int(r, &s->x, -32768, 32767, 16);
+    ok &= uper_fast_get_int(r, &s->y, -32768, 32767, 16);
+    return ok;
+}
+
+
+static bool uper_fast_put_Node_LLmD_64b(uper_fast_writer_t* w, struct Node_LLmD_64b const* s)
+{
+    bool ok = true;
+    ok &= uper_fast_put_int(w, s->lon, -1799999999, 1800000001, 32);
+    ok &= uper_fast_put_int(w, s->lat, -900000000, 900000001, 31);
+    return ok;
+}
+
+
+static bool uper_fast_get_Node_LLmD_64b(uper_fast_reader_t* r, struct Node_LLmD_64b* s)
+{
+    bool ok = true;
+    ok &= uper_fast_get_int(r, &s->lon, -1799999999, 1800000001, 32);
+    ok &= uper_fast_get_int(r, &s->lat, -900000000, 900000001, 31);
+    return ok;
+}
+
+
+static bool uper_fast_put_NodeOffsetPointXY(uper_fast_writer_t* w,
+                                            struct NodeOffsetPointXY const* s)
+{
+    bool ok = true;
+    switch (s->present) {
+        case NodeOffsetPointXY_PR_node_XY1:
+            uper_fast_put(w, 0, 3);
+            if (s->choice.node_XY1 == NULL) {
+                return false;
+            }
+            ok &= uper_fast_put_Node_XY_20b(w, s->choice.node_XY1);
+            break;
+        case NodeOffsetPointXY_PR_node_XY2:
+            uper_fast_put(w, 1, 3);
+            if (s->choice.node_XY2 == NULL) {
+                return false;
+            }
+            ok &= uper_fast_put_Node_XY_22b(w, s->choice.node_XY2);
+            break;
+        case NodeOffsetPointXY_PR_node_XY3:
+            uper_fast_put(w, 2, 3);
+            if (s->choice.node_XY3 == NULL) {
+                return false;
+            }
+            ok &= uper_fast_put_Node_XY_24b(w, s->choice.node_XY3);
+            break;
+        case NodeOffsetPointXY_PR_node_XY4:
+            uper_fast_put(w, 3, 3);
+            if (s->choice.node_XY4 == NULL) {
+                return false;
+            }
+            ok &= uper_fast_put_Node_XY_26b(w, s->choice.node_XY4);
+            break;
+        case NodeOffsetPointXY_PR_node_XY5:
+            uper_fast_put(w, 4, 3);
+            if (s->choice.node_XY5 == NULL) {
+                return false;
+            }
+            ok &= uper_fast_put_Node_XY_28b(w, s->choice.node_XY5);
+            break;
+        case NodeOffsetPointXY_PR_node_XY6:
+            uper_fast_put(w, 5, 3);
+            if (s->choice.node_XY6 == NULL) {
+                return false;
+            }
+            ok &= uper_fast_put_Node_XY_32b(w, s->choice.node_XY6);
+            break;
+        case NodeOffsetPointXY_PR_node_LatLon:
+            uper_fast_put(w, 6, 3);
+            if (s->choice.node_LatLon == NULL) {
+                return false;
+            }
+            ok &= uper_fast_put_Node_LLmD_64b(w, s->choice.node_LatLon);
+            break;
+        case NodeOffsetPointXY_PR_regional:
+            uper_fast_put(w, 7, 3);
+            if (s->choice.regional == NULL) {
+                return false;
+            }
+            ok &= uper_fast_put_member(w,
+                                       &asn_DEF_NodeOffsetPointXY.elements[7],
+                                       s->choice.regional);
+            break;
+        default:
+            return false;
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_NodeOffsetPointXY(uper_fast_reader_t* r, struct NodeOffsetPointXY* s)
+{
+    bool ok = true;
+    switch (uper_fast_get(r, 3)) {
+        case 0:
+            s->present = NodeOffsetPointXY_PR_node_XY1;
+            {
+                s->choice.node_XY1 = uper_fast_alloc(r, sizeof(*s->choice.node_XY1));
+                if (s->choice.node_XY1 == NULL) {
+                    return false;
+                }
+                ok &= uper_fast_get_Node_XY_20b(r, s->choice.node_XY1);
+            }
+            break;
+        case 1:
+            s->present = NodeOffsetPointXY_PR_node_XY2;
+            {
+                s->choice.node_XY2 = uper_fast_alloc(r, sizeof(*s->choice.node_XY2));
+                if (s->choice.node_XY2 == NULL) {
+                    return false;
+                }
+                ok &= uper_fast_get_Node_XY_22b(r, s->choice.node_XY2);
+            }
+            break;
+        case 2:
+            s->present = NodeOffsetPointXY_PR_node_XY3;
+            {
+                s->choice.node_XY3 = uper_fast_alloc(r, sizeof(*s->choice.node_XY3));
+                if (s->choice.node_XY3 == NULL) {
+                    return false;
+                }
+                ok &= uper_fast_get_Node_XY_24b(r, s->choice.node_XY3);
+            }
+            break;
+        case 3:
+            s->present = NodeOffsetPointXY_PR_node_XY4;
+            {
+                s->choice.node_XY4 = uper_fast_alloc(r, sizeof(*s->choice.node_XY4));
+                if (s->choice.node_XY4 == NULL) {
+                    return false;
+                }
+                ok &= uper_fast_get_Node_XY_26b(r, s->choice.node_XY4);
+            }
+            break;
+        case 4:
+            s->present = NodeOffsetPointXY_PR_node_XY5;
+            {
+                s->choice.node_XY5 = uper_fast_alloc(r, sizeof(*s->choice.node_XY5));
+                if (s->choice.node_XY5 == NULL) {
+                    return false;
+                }
+                ok &= uper_fast_get_Node_XY_28b(r, s->choice.node_XY5);
+            }
+            break;
+        case 5:
+            s->present = NodeOffsetPointXY_PR_node_XY6;
+            {
+                s->choice.node_XY6 = uper_fast_alloc(r, sizeof(*s->choice.node_XY6));
+                if (s->choice.node_XY6 == NULL) {
+                    return false;
+                }
+                ok &= uper_fast_get_Node_XY_32b(r, s->choice.node_XY6);
+            }
+            break;
+        case 6:
+            s->present = NodeOffsetPointXY_PR_node_LatLon;
+            {
+                s->choice.node_LatLon = uper_fast_alloc(r, sizeof(*s->choice.node_LatLon));
+                if (s->choice.node_LatLon == NULL) {
+                    return false;
+                }
+                ok &= uper_fast_get_Node_LLmD_64b(r, s->choice.node_LatLon);
+            }
+            break;
+        case 7:
+            s->present = NodeOffsetPointXY_PR_regional;
+            {
+                s->choice.regional = uper_fast_alloc(r, sizeof(*s->choice.regional));
+                if (s->choice.regional == NULL) {
+                    return false;
+                }
+                ok &= uper_fast_get_member(r,
+                                           &asn_DEF_NodeOffsetPointXY.elements[7],
+                                           s->choice.regional);
+            }
+            break;
+        default:
+            return false;
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_NodeAttributeXYList(uper_fast_writer_t* w,
+                                              struct NodeAttributeXYList const* s)
+{
+    if (s->list.count < 1 || s->list.count > 8) {
+        return false;
+    }
+    uper_fast_put(w, (uint32_t)(s->list.count - 1), 3);
+    bool ok = true;
+    for (int i = 0; i < s->list.count; i++) {
+        if (s->list.array[i] == NULL) {
+            return false;
+        }
+        ok &= uper_fast_put_ext_int(w, *s->list.array[i], 0, 11, 4);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_NodeAttributeXYList(uper_fast_reader_t* r, struct NodeAttributeXYList* s)
+{
+    long const count = 1 + (long)uper_fast_get(r, 3);
+    if (count > 8) {
+        return false;
+    }
+    bool ok = true;
+    for (long i = 0; i < count && !r->overrun; i++) {
+        if (uper_fast_add(r, &s->list, sizeof(**s->list.array)) == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_ext_int(r, s->list.array[i], 0, 11, 4);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_SegmentAttributeXYList(uper_fast_writer_t* w,
+                                                 struct SegmentAttributeXYList const* s)
+{
+    if (s->list.count < 1 || s->list.count > 8) {
+        return false;
+    }
+    uper_fast_put(w, (uint32_t)(s->list.count - 1), 3);
+    bool ok = true;
+    for (int i = 0; i < s->list.count; i++) {
+        if (s->list.array[i] == NULL) {
+            return false;
+        }
+        ok &= uper_fast_put_ext_int(w, *s->list.array[i], 0, 37, 6);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_SegmentAttributeXYList(uper_fast_reader_t* r,
+                                                 struct SegmentAttributeXYList* s)
+{
+    long const count = 1 + (long)uper_fast_get(r, 3);
+    if (count > 8) {
+        return false;
+    }
+    bool ok = true;
+    for (long i = 0; i < count && !r->overrun; i++) {
+        if (uper_fast_add(r, &s->list, sizeof(**s->list.array)) == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_ext_int(r, s->list.array[i], 0, 37, 6);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_LaneDataAttribute(uper_fast_writer_t* w,
+                                            struct LaneDataAttribute const* s)
+{
+    bool ok = true;
+    switch (s->present) {
+        case LaneDataAttribute_PR_pathEndPointAngle:
+            uper_fast_put(w, 0, 1);
+            uper_fast_put(w, 0, 3);
+            ok &= uper_fast_put_int(w, s->choice.pathEndPointAngle, -150, 150, 9);
+            break;
+        case LaneDataAttribute_PR_laneCrownPointCenter:
+            uper_fast_put(w, 0, 1);
+            uper_fast_put(w, 1, 3);
+            ok &= uper_fast_put_int(w, s->choice.laneCrownPointCenter, -128, 127, 8);
+            break;
+        case LaneDataAttribute_PR_laneCrownPointLeft:
+            uper_fast_put(w, 0, 1);
+            uper_fast_put(w, 2, 3);
+            ok &= uper_fast_put_int(w, s->choice.laneCrownPointLeft, -128, 127, 8);
+            break;
+        case LaneDataAttribute_PR_laneCrownPointRight:
+            uper_fast_put(w, 0, 1);
+            uper_fast_put(w, 3, 3);
+            ok &= uper_fast_put_int(w, s->choice.laneCrownPointRight, -128, 127, 8);
+            break;
+        case LaneDataAttribute_PR_laneAngle:
+            uper_fast_put(w, 0, 1);
+            uper_fast_put(w, 4, 3);
+            ok &= uper_fast_put_int(w, s->choice.laneAngle, -180, 180, 9);
+            break;
+        case LaneDataAttribute_PR_speedLimits:
+            uper_fast_put(w, 0, 1);
+            uper_fast_put(w, 5, 3);
+            if (s->choice.speedLimits == NULL) {
+                return false;
+            }
+            ok &= uper_fast_put_SpeedLimitList(w, s->choice.speedLimits);
+            break;
+        case LaneDataAttribute_PR_regional:
+            uper_fast_put(w, 0, 1);
+            uper_fast_put(w, 6, 3);
+            if (s->choice.regional == NULL) {
+                return false;
+            }
+            ok &= uper_fast_put_member(w,
+                                       &asn_DEF_LaneDataAttribute.elements[6],
+                                       s->choice.regional);
+            break;
+        default:
+            return false;
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_LaneDataAttribute(uper_fast_reader_t* r, struct LaneDataAttribute* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    bool ok = true;
+    switch (uper_fast_get(r, 3)) {
+        case 0:
+            s->present = LaneDataAttribute_PR_pathEndPointAngle;
+            ok &= uper_fast_get_int(r, &s->choice.pathEndPointAngle, -150, 150, 9);
+            break;
+        case 1:
+            s->present = LaneDataAttribute_PR_laneCrownPointCenter;
+            ok &= uper_fast_get_int(r, &s->choice.laneCrownPointCenter, -128, 127, 8);
+            break;
+        case 2:
+            s->present = LaneDataAttribute_PR_laneCrownPointLeft;
+            ok &= uper_fast_get_int(r, &s->choice.laneCrownPointLeft, -128, 127, 8);
+            break;
+        case 3:
+            s->present = LaneDataAttribute_PR_laneCrownPointRight;
+            ok &= uper_fast_get_int(r, &s->choice.laneCrownPointRight, -128, 127, 8);
+            break;
+        case 4:
+            s->present = LaneDataAttribute_PR_laneAngle;
+            ok &= uper_fast_get_int(r, &s->choice.laneAngle, -180, 180, 9);
+            break;
+        case 5:
+            s->present = LaneDataAttribute_PR_speedLimits;
+            {
+                s->choice.speedLimits = uper_fast_alloc(r, sizeof(*s->choice.speedLimits));
+                if (s->choice.speedLimits == NULL) {
+                    return false;
+                }
+                ok &= uper_fast_get_SpeedLimitList(r, s->choice.speedLimits);
+            }
+            break;
+        case 6:
+            s->present = LaneDataAttribute_PR_regional;
+            {
+                s->choice.regional = uper_fast_alloc(r, sizeof(*s->choice.regional));
+                if (s->choice.regional == NULL) {
+                    return false;
+                }
+                ok &= uper_fast_get_member(r,
+                                           &asn_DEF_LaneDataAttribute.elements[6],
+                                           s->choice.regional);
+            }
+            break;
+        default:
+            return false;
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_LaneDataAttributeList(uper_fast_writer_t* w,
+                                                struct LaneDataAttributeList const* s)
+{
+    if (s->list.count < 1 || s->list.count > 8) {
+        return false;
+    }
+    uper_fast_put(w, (uint32_t)(s->list.count - 1), 3);
+    bool ok = true;
+    for (int i = 0; i < s->list.count; i++) {
+        if (s->list.array[i] == NULL) {
+            return false;
+        }
+        ok &= uper_fast_put_LaneDataAttribute(w, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_LaneDataAttributeList(uper_fast_reader_t* r,
+                                                struct LaneDataAttributeList* s)
+{
+    long const count = 1 + (long)uper_fast_get(r, 3);
+    if (count > 8) {
+        return false;
+    }
+    bool ok = true;
+    for (long i = 0; i < count && !r->overrun; i++) {
+        if (uper_fast_add(r, &s->list, sizeof(**s->list.array)) == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_LaneDataAttribute(r, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_NodeAttributeSetXY(uper_fast_writer_t* w,
+                                             struct NodeAttributeSetXY const* s)
+{
+    uper_fast_put(w, 0, 1);
+    uper_fast_put(w, s->localNode != NULL, 1);
+    uper_fast_put(w, s->disabled != NULL, 1);
+    uper_fast_put(w, s->enabled != NULL, 1);
+    uper_fast_put(w, s->data != NULL, 1);
+    uper_fast_put(w, s->dWidth != NULL, 1);
+    uper_fast_put(w, s->dElevation != NULL, 1);
+    uper_fast_put(w, s->regional != NULL, 1);
+    bool ok = true;
+    if (s->localNode != NULL) {
+        ok &= uper_fast_put_NodeAttributeXYList(w, s->localNode);
+    }
+    if (s->disabled != NULL) {
+        ok &= uper_fast_put_SegmentAttributeXYList(w, s->disabled);
+    }
+    if (s->enabled != NULL) {
+        ok &= uper_fast_put_SegmentAttributeXYList(w, s->enabled);
+    }
+    if (s->data != NULL) {
+        ok &= uper_fast_put_LaneDataAttributeList(w, s->data);
+    }
+    if (s->dWidth != NULL) {
+        ok &= uper_fast_put_int(w, *s->dWidth, -512, 511, 10);
+    }
+    if (s->dElevation != NULL) {
+        ok &= uper_fast_put_int(w, *s->dElevation, -512, 511, 10);
+    }
+    if (s->regional != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_NodeAttributeSetXY.elements[6], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_NodeAttributeSetXY(uper_fast_reader_t* r, struct NodeAttributeSetXY* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    uint32_t const present = uper_fast_get(r, 7);
+    bool ok = true;
+    if (present & (1u << 6)) {
+        s->localNode = uper_fast_alloc(r, sizeof(*s->localNode));
+        if (s->localNode == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_NodeAttributeXYList(r, s->localNode);
+    }
+    if (present & (1u << 5)) {
+        s->disabled = uper_fast_alloc(r, sizeof(*s->disabled));
+        if (s->disabled == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_SegmentAttributeXYList(r, s->disabled);
+    }
+    if (present & (1u << 4)) {
+        s->enabled = uper_fast_alloc(r, sizeof(*s->enabled));
+        if (s->enabled == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_SegmentAttributeXYList(r, s->enabled);
+    }
+    if (present & (1u << 3)) {
+        s->data = uper_fast_alloc(r, sizeof(*s->data));
+        if (s->data == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_LaneDataAttributeList(r, s->data);
+    }
+    if (present & (1u << 2)) {
+        s->dWidth = uper_fast_alloc(r, sizeof(*s->dWidth));
+        if (s->dWidth == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->dWidth, -512, 511, 10);
+    }
+    if (present & (1u << 1)) {
+        s->dElevation = uper_fast_alloc(r, sizeof(*s->dElevation));
+        if (s->dElevation == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->dElevation, -512, 511, 10);
+    }
+    if (present & (1u << 0)) {
+        s->regional = uper_fast_alloc(r, sizeof(*s->regional));
+        if (s->regional == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_NodeAttributeSetXY.elements[6], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_NodeXY(uper_fast_writer_t* w, struct NodeXY const* s)
+{
+    uper_fast_put(w, 0, 1);
+    uper_fast_put(w, s->attributes != NULL, 1);
+    bool ok = true;
+    ok &= uper_fast_put_NodeOffsetPointXY(w, &s->delta);
+    if (s->attributes != NULL) {
+        ok &= uper_fast_put_NodeAttributeSetXY(w, s->attributes);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_NodeXY(uper_fast_reader_t* r, struct NodeXY* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    uint32_t const present = uper_fast_get(r, 1);
+    bool ok = true;
+    ok &= uper_fast_get_NodeOffsetPointXY(r, &s->delta);
+    if (present & (1u << 0)) {
+        s->attributes = uper_fast_alloc(r, sizeof(*s->attributes));
+        if (s->attributes == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_NodeAttributeSetXY(r, s->attributes);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_NodeSetXY(uper_fast_writer_t* w, struct NodeSetXY const* s)
+{
+    if (s->list.count < 2 || s->list.count > 63) {
+        return false;
+    }
+    uper_fast_put(w, (uint32_t)(s->list.count - 2), 6);
+    bool ok = true;
+    for (int i = 0; i < s->list.count; i++) {
+        if (s->list.array[i] == NULL) {
+            return false;
+        }
+        ok &= uper_fast_put_NodeXY(w, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_NodeSetXY(uper_fast_reader_t* r, struct NodeSetXY* s)
+{
+    long const count = 2 + (long)uper_fast_get(r, 6);
+    if (count > 63) {
+        return false;
+    }
+    bool ok = true;
+    for (long i = 0; i < count && !r->overrun; i++) {
+        if (uper_fast_add(r, &s->list, sizeof(**s->list.array)) == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_NodeXY(r, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_ComputedLane__offsetXaxis(uper_fast_writer_t* w,
+                                                    struct ComputedLane__offsetXaxis const* s)
+{
+    bool ok = true;
+    switch (s->present) {
+        case ComputedLane__offsetXaxis_PR_small:
+            uper_fast_put(w, 0, 1);
+            ok &= uper_fast_put_int(w, s->choice.small, -2047, 2047, 12);
+            break;
+        case ComputedLane__offsetXaxis_PR_large:
+            uper_fast_put(w, 1, 1);
+            ok &= uper_fast_put_int(w, s->choice.large, -32767, 32767, 16);
+            break;
+        default:
+            return false;
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_ComputedLane__offsetXaxis(uper_fast_reader_t* r,
+                                                    struct ComputedLane__offsetXaxis* s)
+{
+    bool ok = true;
+    switch (uper_fast_get(r, 1)) {
+        case 0:
+            s->present = ComputedLane__offsetXaxis_PR_small;
+            ok &= uper_fast_get_int(r, &s->choice.small, -2047, 2047, 12);
+            break;
+        case 1:
+            s->present = ComputedLane__offsetXaxis_PR_large;
+            ok &= uper_fast_get_int(r, &s->choice.large, -32767, 32767, 16);
+            break;
+        default:
+            return false;
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_ComputedLane__offsetYaxis(uper_fast_writer_t* w,
+                                                    struct ComputedLane__offsetYaxis const* s)
+{
+    bool ok = true;
+    switch (s->present) {
+        case ComputedLane__offsetYaxis_PR_small:
+            uper_fast_put(w, 0, 1);
+            ok &= uper_fast_put_int(w, s->choice.small, -2047, 2047, 12);
+            break;
+        case ComputedLane__offsetYaxis_PR_large:
+            uper_fast_put(w, 1, 1);
+            ok &= uper_fast_put_int(w, s->choice.large, -32767, 32767, 16);
+            break;
+        default:
+            return false;
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_ComputedLane__offsetYaxis(uper_fast_reader_t* r,
+                                                    struct ComputedLane__offsetYaxis* s)
+{
+    bool ok = true;
+    switch (uper_fast_get(r, 1)) {
+        case 0:
+            s->present = ComputedLane__offsetYaxis_PR_small;
+            ok &= uper_fast_get_int(r, &s->choice.small, -2047, 2047, 12);
+            break;
+        case 1:
+            s->present = ComputedLane__offsetYaxis_PR_large;
+            ok &= uper_fast_get_int(r, &s->choice.large, -32767, 32767, 16);
+            break;
+        default:
+            return false;
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_ComputedLane(uper_fast_writer_t* w, struct ComputedLane const* s)
+{
+    uper_fast_put(w, 0, 1);
+    uper_fast_put(w, s->rotateXY != NULL, 1);
+    uper_fast_put(w, s->scaleXaxis != NULL, 1);
+    uper_fast_put(w, s->scaleYaxis != NULL, 1);
+    uper_fast_put(w, s->regional != NULL, 1);
+    bool ok = true;
+    ok &= uper_fast_put_int(w, s->referenceLaneId, 0, 255, 8);
+    ok &= uper_fast_put_ComputedLane__offsetXaxis(w, &s->offsetXaxis);
+    ok &= uper_fast_put_ComputedLane__offsetYaxis(w, &s->offsetYaxis);
+    if (s->rotateXY != NULL) {
+        ok &= uper_fast_put_int(w, *s->rotateXY, 0, 28800, 15);
+    }
+    if (s->scaleXaxis != NULL) {
+        ok &= uper_fast_put_int(w, *s->scaleXaxis, -2048, 2047, 12);
+    }
+    if (s->scaleYaxis != NULL) {
+        ok &= uper_fast_put_int(w, *s->scaleYaxis, -2048, 2047, 12);
+    }
+    if (s->regional != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_ComputedLane.elements[6], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_ComputedLane(uper_fast_reader_t* r, struct ComputedLane* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    uint32_t const present = uper_fast_get(r, 4);
+    bool ok = true;
+    ok &= uper_fast_get_int(r, &s->referenceLaneId, 0, 255, 8);
+    ok &= uper_fast_get_ComputedLane__offsetXaxis(r, &s->offsetXaxis);
+    ok &= uper_fast_get_ComputedLane__offsetYaxis(r, &s->offsetYaxis);
+    if (present & (1u << 3)) {
+        s->rotateXY = uper_fast_alloc(r, sizeof(*s->rotateXY));
+        if (s->rotateXY == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->rotateXY, 0, 28800, 15);
+    }
+    if (present & (1u << 2)) {
+        s->scaleXaxis = uper_fast_alloc(r, sizeof(*s->scaleXaxis));
+        if (s->scaleXaxis == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->scaleXaxis, -2048, 2047, 12);
+    }
+    if (present & (1u << 1)) {
+        s->scaleYaxis = uper_fast_alloc(r, sizeof(*s->scaleYaxis));
+        if (s->scaleYaxis == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->scaleYaxis, -2048, 2047, 12);
+    }
+    if (present & (1u << 0)) {
+        s->regional = uper_fast_alloc(r, sizeof(*s->regional));
+        if (s->regional == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_ComputedLane.elements[6], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_NodeListXY(uper_fast_writer_t* w, struct NodeListXY const* s)
+{
+    bool ok = true;
+    switch (s->present) {
+        case NodeListXY_PR_nodes:
+            uper_fast_put(w, 0, 1);
+            uper_fast_put(w, 0, 1);
+            if (s->choice.nodes == NULL) {
+                return false;
+            }
+            ok &= uper_fast_put_NodeSetXY(w, s->choice.nodes);
+            break;
+        case NodeListXY_PR_computed:
+            uper_fast_put(w, 0, 1);
+            uper_fast_put(w, 1, 1);
+            if (s->choice.computed == NULL) {
+                return false;
+            }
+            ok &= uper_fast_put_ComputedLane(w, s->choice.computed);
+            break;
+        default:
+            return false;
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_NodeListXY(uper_fast_reader_t* r, struct NodeListXY* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    bool ok = true;
+    switch (uper_fast_get(r, 1)) {
+        case 0:
+            s->present = NodeListXY_PR_nodes;
+            {
+                s->choice.nodes = uper_fast_alloc(r, sizeof(*s->choice.nodes));
+                if (s->choice.nodes == NULL) {
+                    return false;
+                }
+                ok &= uper_fast_get_NodeSetXY(r, s->choice.nodes);
+            }
+            break;
+        case 1:
+            s->present = NodeListXY_PR_computed;
+            {
+                s->choice.computed = uper_fast_alloc(r, sizeof(*s->choice.computed));
+                if (s->choice.computed == NULL) {
+                    return false;
+                }
+                ok &= uper_fast_get_ComputedLane(r, s->choice.computed);
+            }
+            break;
+        default:
+            return false;
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_ConnectingLane(uper_fast_writer_t* w, struct ConnectingLane const* s)
+{
+    uper_fast_put(w, s->maneuver != NULL, 1);
+    bool ok = true;
+    ok &= uper_fast_put_int(w, s->lane, 0, 255, 8);
+    if (s->maneuver != NULL) {
+        ok &= uper_fast_put_bits(w, s->maneuver, 12);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_ConnectingLane(uper_fast_reader_t* r, struct ConnectingLane* s)
+{
+    uint32_t const present = uper_fast_get(r, 1);
+    bool ok = true;
+    ok &= uper_fast_get_int(r, &s->lane, 0, 255, 8);
+    if (present & (1u << 0)) {
+        s->maneuver = uper_fast_alloc(r, sizeof(*s->maneuver));
+        if (s->maneuver == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_bits(r, s->maneuver, 12);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_Connection(uper_fast_writer_t* w, struct Connection const* s)
+{
+    uper_fast_put(w, s->remoteIntersection != NULL, 1);
+    uper_fast_put(w, s->signalGroup != NULL, 1);
+    uper_fast_put(w, s->userClass != NULL, 1);
+    uper_fast_put(w, s->connectionID != NULL, 1);
+    bool ok = true;
+    ok &= uper_fast_put_ConnectingLane(w, &s->connectingLane);
+    if (s->remoteIntersection != NULL) {
+        ok &= uper_fast_put_IntersectionReferenceID(w, s->remoteIntersection);
+    }
+    if (s->signalGroup != NULL) {
+        ok &= uper_fast_put_int(w, *s->signalGroup, 0, 255, 8);
+    }
+    if (s->userClass != NULL) {
+        ok &= uper_fast_put_int(w, *s->userClass, 0, 255, 8);
+    }
+    if (s->connectionID != NULL) {
+        ok &= uper_fast_put_int(w, *s->connectionID, 0, 255, 8);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_Connection(uper_fast_reader_t* r, struct Connection* s)
+{
+    uint32_t const present = uper_fast_get(r, 4);
+    bool ok = true;
+    ok &= uper_fast_get_ConnectingLane(r, &s->connectingLane);
+    if (present & (1u << 3)) {
+        s->remoteIntersection = uper_fast_alloc(r, sizeof(*s->remoteIntersection));
+        if (s->remoteIntersection == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_IntersectionReferenceID(r, s->remoteIntersection);
+    }
+    if (present & (1u << 2)) {
+        s->signalGroup = uper_fast_alloc(r, sizeof(*s->signalGroup));
+        if (s->signalGroup == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->signalGroup, 0, 255, 8);
+    }
+    if (present & (1u << 1)) {
+        s->userClass = uper_fast_alloc(r, sizeof(*s->userClass));
+        if (s->userClass == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->userClass, 0, 255, 8);
+    }
+    if (present & (1u << 0)) {
+        s->connectionID = uper_fast_alloc(r, sizeof(*s->connectionID));
+        if (s->connectionID == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->connectionID, 0, 255, 8);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_ConnectsToList(uper_fast_writer_t* w, struct ConnectsToList const* s)
+{
+    if (s->list.count < 1 || s->list.count > 16) {
+        return false;
+    }
+    uper_fast_put(w, (uint32_t)(s->list.count - 1), 4);
+    bool ok = true;
+    for (int i = 0; i < s->list.count; i++) {
+        if (s->list.array[i] == NULL) {
+            return false;
+        }
+        ok &= uper_fast_put_Connection(w, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_ConnectsToList(uper_fast_reader_t* r, struct ConnectsToList* s)
+{
+    long const count = 1 + (long)uper_fast_get(r, 4);
+    if (count > 16) {
+        return false;
+    }
+    bool ok = true;
+    for (long i = 0; i < count && !r->overrun; i++) {
+        if (uper_fast_add(r, &s->list, sizeof(**s->list.array)) == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_Connection(r, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_OverlayLaneList(uper_fast_writer_t* w, struct OverlayLaneList const* s)
+{
+    if (s->list.count < 1 || s->list.count > 5) {
+        return false;
+    }
+    uper_fast_put(w, (uint32_t)(s->list.count - 1), 3);
+    bool ok = true;
+    for (int i = 0; i < s->list.count; i++) {
+        if (s->list.array[i] == NULL) {
+            return false;
+        }
+        ok &= uper_fast_put_int(w, *s->list.array[i], 0, 255, 8);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_OverlayLaneList(uper_fast_reader_t* r, struct OverlayLaneList* s)
+{
+    long const count = 1 + (long)uper_fast_get(r, 3);
+    if (count > 5) {
+        return false;
+    }
+    bool ok = true;
+    for (long i = 0; i < count && !r->overrun; i++) {
+        if (uper_fast_add(r, &s->list, sizeof(**s->list.array)) == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->list.array[i], 0, 255, 8);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_GenericLane(uper_fast_writer_t* w, struct GenericLane const* s)
+{
+    uper_fast_put(w, 0, 1);
+    uper_fast_put(w, s->name != NULL, 1);
+    uper_fast_put(w, s->ingressApproach != NULL, 1);
+    uper_fast_put(w, s->egressApproach != NULL, 1);
+    uper_fast_put(w, s->maneuvers != NULL, 1);
+    uper_fast_put(w, s->connectsTo != NULL, 1);
+    uper_fast_put(w, s->overlays != NULL, 1);
+    uper_fast_put(w, s->regional != NULL, 1);
+    bool ok = true;
+    ok &= uper_fast_put_int(w, s->laneID, 0, 255, 8);
+    if (s->name != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_GenericLane.elements[1], s->name);
+    }
+    if (s->ingressApproach != NULL) {
+        ok &= uper_fast_put_int(w, *s->ingressApproach, 0, 15, 4);
+    }
+    if (s->egressApproach != NULL) {
+        ok &= uper_fast_put_int(w, *s->egressApproach, 0, 15, 4);
+    }
+    ok &= uper_fast_put_LaneAttributes(w, &s->laneAttributes);
+    if (s->maneuvers != NULL) {
+        ok &= uper_fast_put_bits(w, s->maneuvers, 12);
+    }
+    ok &= uper_fast_put_NodeListXY(w, &s->nodeList);
+    if (s->connectsTo != NULL) {
+        ok &= uper_fast_put_ConnectsToList(w, s->connectsTo);
+    }
+    if (s->overlays != NULL) {
+        ok &= uper_fast_put_OverlayLaneList(w, s->overlays);
+    }
+    if (s->regional != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_GenericLane.elements[9], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_GenericLane(uper_fast_reader_t* r, struct GenericLane* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    uint32_t const present = uper_fast_get(r, 7);
+    bool ok = true;
+    ok &= uper_fast_get_int(r, &s->laneID, 0, 255, 8);
+    if (present & (1u << 6)) {
+        s->name = uper_fast_alloc(r, sizeof(*s->name));
+        if (s->name == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_GenericLane.elements[1], s->name);
+    }
+    if (present & (1u << 5)) {
+        s->ingressApproach = uper_fast_alloc(r, sizeof(*s->ingressApproach));
+        if (s->ingressApproach == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->ingressApproach, 0, 15, 4);
+    }
+    if (present & (1u << 4)) {
+        s->egressApproach = uper_fast_alloc(r, sizeof(*s->egressApproach));
+        if (s->egressApproach == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->egressApproach, 0, 15, 4);
+    }
+    ok &= uper_fast_get_LaneAttributes(r, &s->laneAttributes);
+    if (present & (1u << 3)) {
+        s->maneuvers = uper_fast_alloc(r, sizeof(*s->maneuvers));
+        if (s->maneuvers == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_bits(r, s->maneuvers, 12);
+    }
+    ok &= uper_fast_get_NodeListXY(r, &s->nodeList);
+    if (present & (1u << 2)) {
+        s->connectsTo = uper_fast_alloc(r, sizeof(*s->connectsTo));
+        if (s->connectsTo == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_ConnectsToList(r, s->connectsTo);
+    }
+    if (present & (1u << 1)) {
+        s->overlays = uper_fast_alloc(r, sizeof(*s->overlays));
+        if (s->overlays == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_OverlayLaneList(r, s->overlays);
+    }
+    if (present & (1u << 0)) {
+        s->regional = uper_fast_alloc(r, sizeof(*s->regional));
+        if (s->regional == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_GenericLane.elements[9], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_LaneList(uper_fast_writer_t* w, struct LaneList const* s)
+{
+    if (s->list.count < 1 || s->list.count > 255) {
+        return false;
+    }
+    uper_fast_put(w, (uint32_t)(s->list.count - 1), 8);
+    bool ok = true;
+    for (int i = 0; i < s->list.count; i++) {
+        if (s->list.array[i] == NULL) {
+            return false;
+        }
+        ok &= uper_fast_put_GenericLane(w, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_LaneList(uper_fast_reader_t* r, struct LaneList* s)
+{
+    long const count = 1 + (long)uper_fast_get(r, 8);
+    if (count > 255) {
+        return false;
+    }
+    bool ok = true;
+    for (long i = 0; i < count && !r->overrun; i++) {
+        if (uper_fast_add(r, &s->list, sizeof(**s->list.array)) == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_GenericLane(r, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_SignalControlZone(uper_fast_writer_t* w,
+                                            struct SignalControlZone const* s)
+{
+    uper_fast_put(w, 0, 1);
+    bool ok = true;
+    ok &= uper_fast_put_member(w, &asn_DEF_SignalControlZone.elements[0], &s->zone);
+    return ok;
+}
+
+
+static bool uper_fast_get_SignalControlZone(uper_fast_reader_t* r, struct SignalControlZone* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    bool ok = true;
+    ok &= uper_fast_get_member(r, &asn_DEF_SignalControlZone.elements[0], &s->zone);
+    return ok;
+}
+
+
+static bool uper_fast_put_PreemptPriorityList(uper_fast_writer_t* w,
+                                              struct PreemptPriorityList const* s)
+{
+    if (s->list.count < 1 || s->list.count > 32) {
+        return false;
+    }
+    uper_fast_put(w, (uint32_t)(s->list.count - 1), 5);
+    bool ok = true;
+    for (int i = 0; i < s->list.count; i++) {
+        if (s->list.array[i] == NULL) {
+            return false;
+        }
+        ok &= uper_fast_put_SignalControlZone(w, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_PreemptPriorityList(uper_fast_reader_t* r, struct PreemptPriorityList* s)
+{
+    long const count = 1 + (long)uper_fast_get(r, 5);
+    if (count > 32) {
+        return false;
+    }
+    bool ok = true;
+    for (long i = 0; i < count && !r->overrun; i++) {
+        if (uper_fast_add(r, &s->list, sizeof(**s->list.array)) == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_SignalControlZone(r, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_IntersectionGeometry(uper_fast_writer_t* w,
+                                               struct IntersectionGeometry const* s)
+{
+    uper_fast_put(w, 0, 1);
+    uper_fast_put(w, s->name != NULL, 1);
+    uper_fast_put(w, s->laneWidth != NULL, 1);
+    uper_fast_put(w, s->speedLimits != NULL, 1);
+    uper_fast_put(w, s->preemptPriorityData != NULL, 1);
+    uper_fast_put(w, s->regional != NULL, 1);
+    bool ok = true;
+    if (s->name != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_IntersectionGeometry.elements[0], s->name);
+    }
+    ok &= uper_fast_put_IntersectionReferenceID(w, &s->id);
+    ok &= uper_fast_put_int(w, s->revision, 0, 127, 7);
+    ok &= uper_fast_put_Position3D(w, &s->refPoint);
+    if (s->laneWidth != NULL) {
+        ok &= uper_fast_put_int(w, *s->laneWidth, 0, 32767, 15);
+    }
+    if (s->speedLimits != NULL) {
+        ok &= uper_fast_put_SpeedLimitList(w, s->speedLimits);
+    }
+    ok &= uper_fast_put_LaneList(w, &s->laneSet);
+    if (s->preemptPriorityData != NULL) {
+        ok &= uper_fast_put_PreemptPriorityList(w, s->preemptPriorityData);
+    }
+    if (s->regional != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_IntersectionGeometry.elements[8], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_IntersectionGeometry(uper_fast_reader_t* r,
+                                               struct IntersectionGeometry* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    uint32_t const present = uper_fast_get(r, 5);
+    bool ok = true;
+    if (present & (1u << 4)) {
+        s->name = uper_fast_alloc(r, sizeof(*s->name));
+        if (s->name == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_IntersectionGeometry.elements[0], s->name);
+    }
+    ok &= uper_fast_get_IntersectionReferenceID(r, &s->id);
+    ok &= uper_fast_get_int(r, &s->revision, 0, 127, 7);
+    ok &= uper_fast_get_Position3D(r, &s->refPoint);
+    if (present & (1u << 3)) {
+        s->laneWidth = uper_fast_alloc(r, sizeof(*s->laneWidth));
+        if (s->laneWidth == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->laneWidth, 0, 32767, 15);
+    }
+    if (present & (1u << 2)) {
+        s->speedLimits = uper_fast_alloc(r, sizeof(*s->speedLimits));
+        if (s->speedLimits == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_SpeedLimitList(r, s->speedLimits);
+    }
+    ok &= uper_fast_get_LaneList(r, &s->laneSet);
+    if (present & (1u << 1)) {
+        s->preemptPriorityData = uper_fast_alloc(r, sizeof(*s->preemptPriorityData));
+        if (s->preemptPriorityData == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_PreemptPriorityList(r, s->preemptPriorityData);
+    }
+    if (present & (1u << 0)) {
+        s->regional = uper_fast_alloc(r, sizeof(*s->regional));
+        if (s->regional == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_IntersectionGeometry.elements[8], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_IntersectionGeometryList(uper_fast_writer_t* w,
+                                                   struct IntersectionGeometryList const* s)
+{
+    if (s->list.count < 1 || s->list.count > 32) {
+        return false;
+    }
+    uper_fast_put(w, (uint32_t)(s->list.count - 1), 5);
+    bool ok = true;
+    for (int i = 0; i < s->list.count; i++) {
+        if (s->list.array[i] == NULL) {
+            return false;
+        }
+        ok &= uper_fast_put_IntersectionGeometry(w, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_IntersectionGeometryList(uper_fast_reader_t* r,
+                                                   struct IntersectionGeometryList* s)
+{
+    long const count = 1 + (long)uper_fast_get(r, 5);
+    if (count > 32) {
+        return false;
+    }
+    bool ok = true;
+    for (long i = 0; i < count && !r->overrun; i++) {
+        if (uper_fast_add(r, &s->list, sizeof(**s->list.array)) == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_IntersectionGeometry(r, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_RoadSegmentReferenceID(uper_fast_writer_t* w,
+                                                 struct RoadSegmentReferenceID const* s)
+{
+    uper_fast_put(w, s->region != NULL, 1);
+    bool ok = true;
+    if (s->region != NULL) {
+        ok &= uper_fast_put_int(w, *s->region, 0, 65535, 16);
+    }
+    ok &= uper_fast_put_int(w, s->id, 0, 65535, 16);
+    return ok;
+}
+
+
+static bool uper_fast_get_RoadSegmentReferenceID(uper_fast_reader_t* r,
+                                                 struct RoadSegmentReferenceID* s)
+{
+    uint32_t const present = uper_fast_get(r, 1);
+    bool ok = true;
+    if (present & (1u << 0)) {
+        s->region = uper_fast_alloc(r, sizeof(*s->region));
+        if (s->region == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->region, 0, 65535, 16);
+    }
+    ok &= uper_fast_get_int(r, &s->id, 0, 65535, 16);
+    return ok;
+}
+
+
+static bool uper_fast_put_RoadLaneSetList(uper_fast_writer_t* w, struct RoadLaneSetList const* s)
+{
+    if (s->list.count < 1 || s->list.count > 255) {
+        return false;
+    }
+    uper_fast_put(w, (uint32_t)(s->list.count - 1), 8);
+    bool ok = true;
+    for (int i = 0; i < s->list.count; i++) {
+        if (s->list.array[i] == NULL) {
+            return false;
+        }
+        ok &= uper_fast_put_GenericLane(w, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_RoadLaneSetList(uper_fast_reader_t* r, struct RoadLaneSetList* s)
+{
+    long const count = 1 + (long)uper_fast_get(r, 8);
+    if (count > 255) {
+        return false;
+    }
+    bool ok = true;
+    for (long i = 0; i < count && !r->overrun; i++) {
+        if (uper_fast_add(r, &s->list, sizeof(**s->list.array)) == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_GenericLane(r, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_RoadSegment(uper_fast_writer_t* w, struct RoadSegment const* s)
+{
+    uper_fast_put(w, 0, 1);
+    uper_fast_put(w, s->name != NULL, 1);
+    uper_fast_put(w, s->laneWidth != NULL, 1);
+    uper_fast_put(w, s->speedLimits != NULL, 1);
+    uper_fast_put(w, s->regional != NULL, 1);
+    bool ok = true;
+    if (s->name != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_RoadSegment.elements[0], s->name);
+    }
+    ok &= uper_fast_put_RoadSegmentReferenceID(w, &s->id);
+    ok &= uper_fast_put_int(w, s->revision, 0, 127, 7);
+    ok &= uper_fast_put_Position3D(w, &s->refPoint);
+    if (s->laneWidth != NULL) {
+        ok &= uper_fast_put_int(w, *s->laneWidth, 0, 32767, 15);
+    }
+    if (s->speedLimits != NULL) {
+        ok &= uper_fast_put_SpeedLimitList(w, s->speedLimits);
+    }
+    ok &= uper_fast_put_RoadLaneSetList(w, &s->roadLaneSet);
+    if (s->regional != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_RoadSegment.elements[7], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_RoadSegment(uper_fast_reader_t* r, struct RoadSegment* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    uint32_t const present = uper_fast_get(r, 4);
+    bool ok = true;
+    if (present & (1u << 3)) {
+        s->name = uper_fast_alloc(r, sizeof(*s->name));
+        if (s->name == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_RoadSegment.elements[0], s->name);
+    }
+    ok &= uper_fast_get_RoadSegmentReferenceID(r, &s->id);
+    ok &= uper_fast_get_int(r, &s->revision, 0, 127, 7);
+    ok &= uper_fast_get_Position3D(r, &s->refPoint);
+    if (present & (1u << 2)) {
+        s->laneWidth = uper_fast_alloc(r, sizeof(*s->laneWidth));
+        if (s->laneWidth == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->laneWidth, 0, 32767, 15);
+    }
+    if (present & (1u << 1)) {
+        s->speedLimits = uper_fast_alloc(r, sizeof(*s->speedLimits));
+        if (s->speedLimits == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_SpeedLimitList(r, s->speedLimits);
+    }
+    ok &= uper_fast_get_RoadLaneSetList(r, &s->roadLaneSet);
+    if (present & (1u << 0)) {
+        s->regional = uper_fast_alloc(r, sizeof(*s->regional));
+        if (s->regional == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_RoadSegment.elements[7], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_RoadSegmentList(uper_fast_writer_t* w, struct RoadSegmentList const* s)
+{
+    if (s->list.count < 1 || s->list.count > 32) {
+        return false;
+    }
+    uper_fast_put(w, (uint32_t)(s->list.count - 1), 5);
+    bool ok = true;
+    for (int i = 0; i < s->list.count; i++) {
+        if (s->list.array[i] == NULL) {
+            return false;
+        }
+        ok &= uper_fast_put_RoadSegment(w, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_RoadSegmentList(uper_fast_reader_t* r, struct RoadSegmentList* s)
+{
+    long const count = 1 + (long)uper_fast_get(r, 5);
+    if (count > 32) {
+        return false;
+    }
+    bool ok = true;
+    for (long i = 0; i < count && !r->overrun; i++) {
+        if (uper_fast_add(r, &s->list, sizeof(**s->list.array)) == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_RoadSegment(r, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_DataParameters(uper_fast_writer_t* w, struct DataParameters const* s)
+{
+    uper_fast_put(w, 0, 1);
+    uper_fast_put(w, s->processMethod != NULL, 1);
+    uper_fast_put(w, s->processAgency != NULL, 1);
+    uper_fast_put(w, s->lastCheckedDate != NULL, 1);
+    uper_fast_put(w, s->geoidUsed != NULL, 1);
+    bool ok = true;
+    if (s->processMethod != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_DataParameters.elements[0], s->processMethod);
+    }
+    if (s->processAgency != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_DataParameters.elements[1], s->processAgency);
+    }
+    if (s->lastCheckedDate != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_DataParameters.elements[2], s->lastCheckedDate);
+    }
+    if (s->geoidUsed != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_DataParameters.elements[3], s->geoidUsed);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_DataParameters(uper_fast_reader_t* r, struct DataParameters* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    uint32_t const present = uper_fast_get(r, 4);
+    bool ok = true;
+    if (present & (1u << 3)) {
+        s->processMethod = uper_fast_alloc(r, sizeof(*s->processMethod));
+        if (s->processMethod == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_DataParameters.elements[0], s->processMethod);
+    }
+    if (present & (1u << 2)) {
+        s->processAgency = uper_fast_alloc(r, sizeof(*s->processAgency));
+        if (s->processAgency == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_DataParameters.elements[1], s->processAgency);
+    }
+    if (present & (1u << 1)) {
+        s->lastCheckedDate = uper_fast_alloc(r, sizeof(*s->lastCheckedDate));
+        if (s->lastCheckedDate == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_DataParameters.elements[2], s->lastCheckedDate);
+    }
+    if (present & (1u << 0)) {
+        s->geoidUsed = uper_fast_alloc(r, sizeof(*s->geoidUsed));
+        if (s->geoidUsed == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_DataParameters.elements[3], s->geoidUsed);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_RestrictionUserType(uper_fast_writer_t* w,
+                                              struct RestrictionUserType const* s)
+{
+    bool ok = true;
+    switch (s->present) {
+        case RestrictionUserType_PR_basicType:
+            uper_fast_put(w, 0, 1);
+            uper_fast_put(w, 0, 1);
+            ok &= uper_fast_put_ext_int(w, s->choice.basicType, 0, 13, 4);
+            break;
+        case RestrictionUserType_PR_regional:
+            uper_fast_put(w, 0, 1);
+            uper_fast_put(w, 1, 1);
+            if (s->choice.regional == NULL) {
+                return false;
+            }
+            ok &= uper_fast_put_member(w,
+                                       &asn_DEF_RestrictionUserType.elements[1],
+                                       s->choice.regional);
+            break;
+        default:
+            return false;
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_RestrictionUserType(uper_fast_reader_t* r, struct RestrictionUserType* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    bool ok = true;
+    switch (uper_fast_get(r, 1)) {
+        case 0:
+            s->present = RestrictionUserType_PR_basicType;
+            ok &= uper_fast_get_ext_int(r, &s->choice.basicType, 0, 13, 4);
+            break;
+        case 1:
+            s->present = RestrictionUserType_PR_regional;
+            {
+                s->choice.regional = uper_fast_alloc(r, sizeof(*s->choice.regional));
+                if (s->choice.regional == NULL) {
+                    return false;
+                }
+                ok &= uper_fast_get_member(r,
+                                           &asn_DEF_RestrictionUserType.elements[1],
+                                           s->choice.regional);
+            }
+            break;
+        default:
+            return false;
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_RestrictionUserTypeList(uper_fast_writer_t* w,
+                                                  struct RestrictionUserTypeList const* s)
+{
+    if (s->list.count < 1 || s->list.count > 16) {
+        return false;
+    }
+    uper_fast_put(w, (uint32_t)(s->list.count - 1), 4);
+    bool ok = true;
+    for (int i = 0; i < s->list.count; i++) {
+        if (s->list.array[i] == NULL) {
+            return false;
+        }
+        ok &= uper_fast_put_RestrictionUserType(w, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_RestrictionUserTypeList(uper_fast_reader_t* r,
+                                                  struct RestrictionUserTypeList* s)
+{
+    long const count = 1 + (long)uper_fast_get(r, 4);
+    if (count > 16) {
+        return false;
+    }
+    bool ok = true;
+    for (long i = 0; i < count && !r->overrun; i++) {
+        if (uper_fast_add(r, &s->list, sizeof(**s->list.array)) == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_RestrictionUserType(r, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_RestrictionClassAssignment(uper_fast_writer_t* w,
+                                                     struct RestrictionClassAssignment const* s)
+{
+    bool ok = true;
+    ok &= uper_fast_put_int(w, s->id, 0, 255, 8);
+    ok &= uper_fast_put_RestrictionUserTypeList(w, &s->users);
+    return ok;
+}
+
+
+static bool uper_fast_get_RestrictionClassAssignment(uper_fast_reader_t* r,
+                                                     struct RestrictionClassAssignment* s)
+{
+    bool ok = true;
+    ok &= uper_fast_get_int(r, &s->id, 0, 255, 8);
+    ok &= uper_fast_get_RestrictionUserTypeList(r, &s->users);
+    return ok;
+}
+
+
+static bool uper_fast_put_RestrictionClassList(uper_fast_writer_t* w,
+                                               struct RestrictionClassList const* s)
+{
+    if (s->list.count < 1 || s->list.count > 254) {
+        return false;
+    }
+    uper_fast_put(w, (uint32_t)(s->list.count - 1), 8);
+    bool ok = true;
+    for (int i = 0; i < s->list.count; i++) {
+        if (s->list.array[i] == NULL) {
+            return false;
+        }
+        ok &= uper_fast_put_RestrictionClassAssignment(w, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_RestrictionClassList(uper_fast_reader_t* r,
+                                               struct RestrictionClassList* s)
+{
+    long const count = 1 + (long)uper_fast_get(r, 8);
+    if (count > 254) {
+        return false;
+    }
+    bool ok = true;
+    for (long i = 0; i < count && !r->overrun; i++) {
+        if (uper_fast_add(r, &s->list, sizeof(**s->list.array)) == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_RestrictionClassAssignment(r, s->list.array[i]);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_MapData(uper_fast_writer_t* w, struct MapData const* s)
+{
+    uper_fast_put(w, 0, 1);
+    uper_fast_put(w, s->timeStamp != NULL, 1);
+    uper_fast_put(w, s->layerType != NULL, 1);
+    uper_fast_put(w, s->layerID != NULL, 1);
+    uper_fast_put(w, s->intersections != NULL, 1);
+    uper_fast_put(w, s->roadSegments != NULL, 1);
+    uper_fast_put(w, s->dataParameters != NULL, 1);
+    uper_fast_put(w, s->restrictionList != NULL, 1);
+    uper_fast_put(w, s->regional != NULL, 1);
+    bool ok = true;
+    if (s->timeStamp != NULL) {
+        ok &= uper_fast_put_int(w, *s->timeStamp, 0, 527040, 20);
+    }
+    ok &= uper_fast_put_int(w, s->msgIssueRevision, 0, 127, 7);
+    if (s->layerType != NULL) {
+        ok &= uper_fast_put_ext_int(w, *s->layerType, 0, 7, 3);
+    }
+    if (s->layerID != NULL) {
+        ok &= uper_fast_put_int(w, *s->layerID, 0, 100, 7);
+    }
+    if (s->intersections != NULL) {
+        ok &= uper_fast_put_IntersectionGeometryList(w, s->intersections);
+    }
+    if (s->roadSegments != NULL) {
+        ok &= uper_fast_put_RoadSegmentList(w, s->roadSegments);
+    }
+    if (s->dataParameters != NULL) {
+        ok &= uper_fast_put_DataParameters(w, s->dataParameters);
+    }
+    if (s->restrictionList != NULL) {
+        ok &= uper_fast_put_RestrictionClassList(w, s->restrictionList);
+    }
+    if (s->regional != NULL) {
+        ok &= uper_fast_put_member(w, &asn_DEF_MapData.elements[8], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_get_MapData(uper_fast_reader_t* r, struct MapData* s)
+{
+    if (uper_fast_get(r, 1)) {
+        return false;
+    }
+    uint32_t const present = uper_fast_get(r, 8);
+    bool ok = true;
+    if (present & (1u << 7)) {
+        s->timeStamp = uper_fast_alloc(r, sizeof(*s->timeStamp));
+        if (s->timeStamp == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->timeStamp, 0, 527040, 20);
+    }
+    ok &= uper_fast_get_int(r, &s->msgIssueRevision, 0, 127, 7);
+    if (present & (1u << 6)) {
+        s->layerType = uper_fast_alloc(r, sizeof(*s->layerType));
+        if (s->layerType == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_ext_int(r, s->layerType, 0, 7, 3);
+    }
+    if (present & (1u << 5)) {
+        s->layerID = uper_fast_alloc(r, sizeof(*s->layerID));
+        if (s->layerID == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_int(r, s->layerID, 0, 100, 7);
+    }
+    if (present & (1u << 4)) {
+        s->intersections = uper_fast_alloc(r, sizeof(*s->intersections));
+        if (s->intersections == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_IntersectionGeometryList(r, s->intersections);
+    }
+    if (present & (1u << 3)) {
+        s->roadSegments = uper_fast_alloc(r, sizeof(*s->roadSegments));
+        if (s->roadSegments == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_RoadSegmentList(r, s->roadSegments);
+    }
+    if (present & (1u << 2)) {
+        s->dataParameters = uper_fast_alloc(r, sizeof(*s->dataParameters));
+        if (s->dataParameters == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_DataParameters(r, s->dataParameters);
+    }
+    if (present & (1u << 1)) {
+        s->restrictionList = uper_fast_alloc(r, sizeof(*s->restrictionList));
+        if (s->restrictionList == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_RestrictionClassList(r, s->restrictionList);
+    }
+    if (present & (1u << 0)) {
+        s->regional = uper_fast_alloc(r, sizeof(*s->regional));
+        if (s->regional == NULL) {
+            return false;
+        }
+        ok &= uper_fast_get_member(r, &asn_DEF_MapData.elements[8], s->regional);
+    }
+    return ok;
+}
+
+
+static bool uper_fast_put_message(uper_fast_writer_t* w, MessageFrame_t const* mf)
+{
+    switch (mf->value.present) {
+        case MessageFrame__value_PR_BasicSafetyMessage:
+            if (mf->messageId != DSRCmsgID_basicSafetyMessage) {
+                return false;
+            }
+            return uper_fast_put_BasicSafetyMessage(w, &mf->value.choice.BasicSafetyMessage);
+        case MessageFrame__value_PR_PersonalSafetyMessage:
+            if (mf->messageId != DSRCmsgID_personalSafetyMessage) {
+                return false;
+            }
+            return uper_fast_put_PersonalSafetyMessage(w, &mf->value.choice.PersonalSafetyMessage);
+        case MessageFrame__value_PR_SPAT:
+            if (mf->messageId != DSRCmsgID_signalPhaseAndTimingMessage) {
+                return false;
+            }
+            return uper_fast_put_SPAT(w, &mf->value.choice.SPAT);
+        case MessageFrame__value_PR_MapData:
+            if (mf->messageId != DSRCmsgID_mapData) {
+                return false;
+            }
+            return uper_fast_put_MapData(w, &mf->value.choice.MapData);
+        default:
+            return false;
+    }
+}
+
+
+static bool uper_fast_get_message(uper_fast_reader_t* r, MessageFrame_t* mf)
+{
+    switch (mf->messageId) {
+        case DSRCmsgID_basicSafetyMessage:
+            mf->value.present = MessageFrame__value_PR_BasicSafetyMessage;
+            return uper_fast_get_BasicSafetyMessage(r, &mf->value.choice.BasicSafetyMessage);
+        case DSRCmsgID_personalSafetyMessage:
+            mf->value.present = MessageFrame__value_PR_PersonalSafetyMessage;
+            return uper_fast_get_PersonalSafetyMessage(r, &mf->value.choice.PersonalSafetyMessage);
+        case DSRCmsgID_signalPhaseAndTimingMessage:
+            mf->value.present = MessageFrame__value_PR_SPAT;
+            return uper_fast_get_SPAT(r, &mf->value.choice.SPAT);
+        case DSRCmsgID_mapData:
+            mf->value.present = MessageFrame__value_PR_MapData;
+            return uper_fast_get_MapData(r, &mf->value.choice.MapData);
+        default:
+            return false;
+    }
+}
+
+#endif // LIBSM_UPER_FAST_CODECS_H
@@ -16,11 +16,12 @@
 
 #include <BasicSafetyMessage.h>
 #include <MessageFrame.h>
+#include <PartIIcontent.h>
 #include <PersonalSafetyMessage.h>
+#include <RegionalExtension.h>
 #include <SPAT.h>
 #include <asn_system.h>
 
-#include <errno.h>
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
@@ -164,7 +165,10 @@ libsm_rval_e libsm_init_bit_string(BIT_STRING_t* bit_string, size_t bits)
  * To access the PSM, use something like: PersonalSafetyMessage_t PSM = mf->value.choice.PersonalSafetyMessage;
  * NOTE: The caller is responsible for freeing mf with ASN_STRUCT_FREE
  */
-libsm_rval_e libsm_decode_messageframe(const uint8_t* encoded, size_t len, MessageFrame_t* mf)
+static libsm_rval_e decode_messageframe(asn_codec_ctx_t const* ctx,
+                                        const uint8_t* encoded,
+                                        size_t len,
+                                        MessageFrame_t* mf)
 {
     asn_dec_rval_t rval;
 
@@ -175,7 +179,7 @@ libsm_rval_e libsm_decode_messageframe(const uint8_t* encoded, size_t len, Messa
         return LIBSM_FAIL_DECODING_BUFF_SIZE;
     }
 
-    rval = asn_decode(0,
+    rval = asn_decode(ctx,
                       ATS_UNALIGNED_BASIC_PER,
                       &asn_DEF_MessageFrame,
                       (void**)&mf,
@@ -196,8 +200,70 @@ libsm_rval_e libsm_decode_messageframe(const uint8_t* encoded, size_t len, Messa
 }
 
 
+libsm_rval_e libsm_decode_messageframe(const uint8_t* encoded, size_t len, MessageFrame_t* mf)
+{
+    return decode_messageframe(NULL, encoded, len, mf);
+}
+
+
+libsm_rval_e libsm_decode_messageframe_borrowed(const uint8_t* encoded,
+                                                size_t len,
+                                                MessageFrame_t* mf,
+                                                size_t minSize,
+                                                asn_borrow_arena_t* arena)
+{
+    if (minSize == 0) {
+        return LIBSM_FAIL_NO_VALID_PARAMETER;
+    }
+    // the stack bound uper_decode() sets without a context, kept with one
+    asn_codec_ctx_t const ctx = { .max_stack_size = 30000,
+                                  .borrow_min = minSize,
+                                  .borrow_arena = arena };
+    return decode_messageframe(&ctx, encoded, len, mf);
+}
+
+
+asn_TYPE_descriptor_t const* const libsm_bsm_extension_types[] = {
+    &asn_DEF_BSMpartIIExtension,
+    &asn_DEF_Reg_BasicSafetyMessage,
+    NULL,
+};
+
+
+libsm_rval_e libsm_decode_messageframe_opaque(const uint8_t* encoded,
+                                              size_t len,
+                                              MessageFrame_t* mf,
+                                              asn_TYPE_descriptor_t const* const* types)
+{
+    if (types == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    // the stack bound uper_decode() sets without a context, kept with one
+    asn_codec_ctx_t const ctx = { .max_stack_size = 30000, .opaque_open_types = types };
+    return decode_messageframe(&ctx, encoded, len, mf);
+}
+
+
+libsm_rval_e libsm_materialize_open_types(asn_TYPE_descriptor_t const* td, void* sptr)
+{
+    if (td == NULL || sptr == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
+    for (unsigned i = 0; i < td->elements_count; i++) {
+        if ((td->elements[i].flags & ATF_OPEN_TYPE)
+            && OPEN_TYPE_uper_materialize(td, sptr, &td->elements[i]) != 0) {
+            return LIBSM_FAIL_DECODING;
+        }
+    }
+    return LIBSM_OK;
+}
+
+
 libsm_rval_e libsm_encode_messageframe(MessageFrame_t* mf, uint8_t* encoded, size_t* len)
 {
+    if (mf == NULL || encoded == NULL || len == NULL) {
+        return LIBSM_FAIL_NULL_ARG;
+    }
     asn_enc_rval_t enc_res = asn_encode_to_buffer(0,
                                                   ATS_UNALIGNED_BASIC_PER,
                                                   &asn_DEF_MessageFrame,
@@ -206,21 +272,9 @@ libsm_rval_e libsm_encode_messageframe(MessageFrame_t* mf, uint8_t* encoded, siz
                                                   *len);
 
     if (enc_res.encoded == -1) {
-        //printf("Failed to encode MessageFrame of type %s\n", enc_res.failed_type->name);
-        switch (errno) {
-            case EINVAL:
-                //printf("MessageFrame encode to buffer EINVAL: Incorrect parameters to the function, such as NULLs\n");
-                break;
-            case ENOENT:
-                //printf("MessageFrame encode to buffer ENOENT: Encoding transfer syntax is not defined (for this type)\n");
-                break;
-            case EBADF:
-                //printf("MessageFrame encode to buffer EBADF: The structure has invalid form or content constraint failed\n");
-                return LIBSM_FAIL_CONSTRAINT;
-                break;
-            default:
-                //printf("MessageFrame encode to buffer ERRNO IS BROKEN\n");
-                break;
+        // the test asn1c uses to set errno to EBADF, without relying on errno
+        if (enc_res.failed_type != NULL && enc_res.failed_type->op->uper_encoder != NULL) {
+            return LIBSM_FAIL_CONSTRAINT;
         }
         return LIBSM_FAIL_ENCODING;
     } else if ((size_t)enc_res.encoded > *len) {
@@ -419,212 +473,8 @@ const char* libsm_str_basic_vehicle_class(BasicVehicleClass_t type)
  */
 BasicVehicleClass_t libsm_basic_vehicle_class_from_str(char* type)
 {
-    if (strcmp(type, "specialVehicleClass") == 0) {
-        return BasicVehicleClass_specialVehicleClass;
-    }
-    if (strcmp(type, "passenger_Vehicle_TypeUnknown") == 0
-        || strcmp(type, "passenger-Vehicle-TypeUnknown") == 0) {
-        return BasicVehicleClass_passenger_Vehicle_TypeUnknown;
-    }
-    if (strcmp(type, "passenger_Vehicle_TypeOther") == 0
-        || strcmp(type, "passenger-Vehicle-TypeOther") == 0) {
-        return BasicVehicleClass_passenger_Vehicle_TypeOther;
-    }
-    if (strcmp(type, "lightTruck_Vehicle_TypeUnknown") == 0
-        || strcmp(type, "lightTruck-Vehicle-TypeUnknown") == 0) {
-        return BasicVehicleClass_lightTruck_Vehicle_TypeUnknown;
-    }
-    if (strcmp(type, "lightTruck_Vehicle_TypeOther") == 0
-        || strcmp(type, "lightTruck-Vehicle-TypeOther") == 0) {
-        return BasicVehicleClass_lightTruck_Vehicle_TypeOther;
-    }
-    if (strcmp(type, "truck_Vehicle_TypeUnknown") == 0
-        || strcmp(type, "truck-Vehicle-TypeUnknown") == 0) {
-        return BasicVehicleClass_truck_Vehicle_TypeUnknown;
-    }
-    if (strcmp(type, "truck_Vehicle_TypeOther") == 0
-        || strcmp(type, "truck-Vehicle-TypeOther") == 0) {
-        return BasicVehicleClass_truck_Vehicle_TypeOther;
-    }
-    if (strcmp(type, "truck_axleCnt2") == 0 || strcmp(type, "truck-axleCnt2") == 0) {
-        return BasicVehicleClass_truck_axleCnt2;
-    }
-    if (strcmp(type, "truck_axleCnt3") == 0 || strcmp(type, "truck-axleCnt3") == 0) {
-        return BasicVehicleClass_truck_axleCnt3;
-    }
-    if (strcmp(type, "truck_axleCnt4") == 0 || strcmp(type, "truck-axleCnt4") == 0) {
-        return BasicVehicleClass_truck_axleCnt4;
-    }
-    if (strcmp(type, "truck_axleCnt4Trailer") == 0
-        || strcmp(type, "truck-axleCnt4Trailer") == 0) {
-        return BasicVehicleClass_truck_axleCnt4Trailer;
-    }
-    if (strcmp(type, "truck_axleCnt5Trailer") == 0
-        || strcmp(type, "truck-axleCnt5Trailer") == 0) {
-        return BasicVehicleClass_truck_axleCnt5Trailer;
-    }
-    if (strcmp(type, "truck_axleCnt6Trailer") == 0
-        || strcmp(type, "truck-axleCnt6Trailer") == 0) {
-        return BasicVehicleClass_truck_axleCnt6Trailer;
-    }
-    if (strcmp(type, "truck_axleCnt5MultiTrailer") == 0
-        || strcmp(type, "truck-axleCnt5MultiTrailer") == 0) {
-        return BasicVehicleClass_truck_axleCnt5MultiTrailer;
-    }
-    if (strcmp(type, "truck_axleCnt6MultiTrailer") == 0
-        || strcmp(type, "truck-axleCnt6MultiTrailer") == 0) {
-        return BasicVehicleClass_truck_axleCnt6MultiTrailer;
-    }
-    if (strcmp(type, "truck_axleCnt7MultiTrailer") == 0
-        || strcmp(type, "truck-axleCnt7MultiTrailer") == 0) {
-        return BasicVehicleClass_truck_axleCnt7MultiTrailer;
-    }
-    if (strcmp(type, "motorcycle_TypeUnknown") == 0
-        || strcmp(type, "motorcycle-TypeUnknown") == 0) {
-        return BasicVehicleClass_motorcycle_TypeUnknown;
-    }
-    if (strcmp(type, "motorcycle_TypeOther") == 0 || strcmp(type, "motorcycle-TypeOther") == 0) {
-        return BasicVehicleClass_motorcycle_TypeOther;
-    }
-    if (strcmp(type, "motorcycle_Cruiser_Standard") == 0
-        || strcmp(type, "motorcycle-Cruiser-Standard") == 0) {
-        return BasicVehicleClass_motorcycle_Cruiser_Standard;
-    }
-    if (strcmp(type, "motorcycle_SportUnclad") == 0
-        || strcmp(type, "motorcycle-SportUnclad") == 0) {
-        return BasicVehicleClass_motorcycle_SportUnclad;
-    }
-    if (strcmp(type, "motorcycle_SportTouring") == 0
-        || strcmp(type, "motorcycle-SportTouring") == 0) {
-        return BasicVehicleClass_motorcycle_SportTouring;
-    }
-    if (strcmp(type, "motorcycle_SuperSport") == 0
-        || strcmp(type, "motorcycle-SuperSport") == 0) {
-        return BasicVehicleClass_motorcycle_SuperSport;
-    }
-    if (strcmp(type, "motorcycle_Touring") == 0 || strcmp(type, "motorcycle-Touring") == 0) {
-        return BasicVehicleClass_motorcycle_Touring;
-    }
-    if (strcmp(type, "motorcycle_Trike") == 0 || strcmp(type, "motorcycle-Trike") == 0) {
-        return BasicVehicleClass_motorcycle_Trike;
-    }
-    if (strcmp(type, "motorcycle_wPassengers") == 0
-        || strcmp(type, "motorcycle-wPassengers") == 0) {
-        return BasicVehicleClass_motorcycle_wPassengers;
-    }
-    if (strcmp(type, "transit_TypeUnknown") == 0 || strcmp(type, "transit-TypeUnknown") == 0) {
-        return BasicVehicleClass_transit_TypeUnknown;
-    }
-    if (strcmp(type, "transit_TypeOther") == 0 || strcmp(type, "transit-TypeOther") == 0) {
-        return BasicVehicleClass_transit_TypeOther;
-    }
-    if (strcmp(type, "transit_BRT") == 0 || strcmp(type, "transit-BRT") == 0) {
-        return BasicVehicleClass_transit_BRT;
-    }
-    if (strcmp(type, "transit_ExpressBus") == 0 || strcmp(type, "transit-ExpressBus") == 0) {
-        return BasicVehicleClass_transit_ExpressBus;
-    }
-    if (strcmp(type, "transit_LocalBus") == 0 || strcmp(type, "transit-LocalBus") == 0) {
-        return BasicVehicleClass_transit_LocalBus;
-    }
-    if (strcmp(type, "transit_SchoolBus") == 0 || strcmp(type, "transit-SchoolBus") == 0) {
-        return BasicVehicleClass_transit_SchoolBus;
-    }
-    if (strcmp(type, "transit_FixedGuideway") == 0
-        || strcmp(type, "transit-FixedGuideway") == 0) {
-        return BasicVehicleClass_transit_FixedGuideway;
-    }
-    if (strcmp(type, "transit_Paratransit") == 0 || strcmp(type, "transit-Paratransit") == 0) {
-        return BasicVehicleClass_transit_Paratransit;
-    }
-    if (strcmp(type, "transit_Paratransit_Ambulance") == 0
-        || strcmp(type, "transit-Paratransit-Ambulance") == 0) {
-        return BasicVehicleClass_transit_Paratransit_Ambulance;
-    }
-    if (strcmp(type, "emergency_TypeUnknown") == 0
-        || strcmp(type, "emergency-TypeUnknown") == 0) {
-        return BasicVehicleClass_emergency_TypeUnknown;
-    }
-    if (strcmp(type, "emergency_TypeOther") == 0 || strcmp(type, "emergency-TypeOther") == 0) {
-        return BasicVehicleClass_emergency_TypeOther;
-    }
-    if (strcmp(type, "emergency_Fire_Light_Vehicle") == 0
-        || strcmp(type, "emergency-Fire-Light-Vehicle") == 0) {
-        return BasicVehicleClass_emergency_Fire_Light_Vehicle;
-    }
-    if (strcmp(type, "emergency_Fire_Heavy_Vehicle") == 0
-        || strcmp(type, "emergency-Fire-Heavy-Vehicle") == 0) {
-        return BasicVehicleClass_emergency_Fire_Heavy_Vehicle;
-    }
-    if (strcmp(type, "emergency_Fire_Paramedic_Vehicle") == 0
-        || strcmp(type, "emergency-Fire-Paramedic-Vehicle") == 0) {
-        return BasicVehicleClass_emergency_Fire_Paramedic_Vehicle;
-    }
-    if (strcmp(type, "emergency_Fire_Ambulance_Vehicle") == 0
-        || strcmp(type, "emergency-Fire-Ambulance-Vehicle") == 0) {
-        return BasicVehicleClass_emergency_Fire_Ambulance_Vehicle;
-    }
-    if (strcmp(type, "emergency_Police_Light_Vehicle") == 0
-        || strcmp(type, "emergency-Police-Light-Vehicle") == 0) {
-        return BasicVehicleClass_emergency_Police_Light_Vehicle;
-    }
-    if (strcmp(type, "emergency_Police_Heavy_Vehicle") == 0
-        || strcmp(type, "emergency-Police-Heavy-Vehicle") == 0) {
-        return BasicVehicleClass_emergency_Police_Heavy_Vehicle;
-    }
-    if (strcmp(type, "emergency_Other_Responder") == 0
-        || strcmp(type, "emergency-Other-Responder") == 0) {
-        return BasicVehicleClass_emergency_Other_Responder;
-    }
-    if (strcmp(type, "emergency_Other_Ambulance") == 0
-        || strcmp(type, "emergency-Other-Ambulance") == 0) {
-        return BasicVehicleClass_emergency_Other_Ambulance;
-    }
-    if (strcmp(type, "otherTraveler_TypeUnknown") == 0
-        || strcmp(type, "otherTraveler-TypeUnknown") == 0) {
-        return BasicVehicleClass_otherTraveler_TypeUnknown;
-    }
-    if (strcmp(type, "otherTraveler_TypeOther") == 0
-        || strcmp(type, "otherTraveler-TypeOther") == 0) {
-        return BasicVehicleClass_otherTraveler_TypeOther;
-    }
-    if (strcmp(type, "otherTraveler_Pedestrian") == 0
-        || strcmp(type, "otherTraveler-Pedestrian") == 0) {
-        return BasicVehicleClass_otherTraveler_Pedestrian;
-    }
-    if (strcmp(type, "otherTraveler_Visually_Disabled") == 0
-        || strcmp(type, "otherTraveler-Visually-Disabled") == 0) {
-        return BasicVehicleClass_otherTraveler_Visually_Disabled;
-    }
-    if (strcmp(type, "otherTraveler_Physically_Disabled") == 0
-        || strcmp(type, "otherTraveler-Physically-Disabled") == 0) {
-        return BasicVehicleClass_otherTraveler_Physically_Disabled;
-    }
-    if (strcmp(type, "otherTraveler_Bicycle") == 0
-        || strcmp(type, "otherTraveler-Bicycle") == 0) {
-        return BasicVehicleClass_otherTraveler_Bicycle;
-    }
-    if (strcmp(type, "otherTraveler_Vulnerable_Roadworker") == 0
-        || strcmp(type, "otherTraveler-Vulnerable-Roadworker") == 0) {
-        return BasicVehicleClass_otherTraveler_Vulnerable_Roadworker;
-    }
-    if (strcmp(type, "infrastructure_TypeUnknown") == 0
-        || strcmp(type, "infrastructure-TypeUnknown") == 0) {
-        return BasicVehicleClass_infrastructure_TypeUnknown;
-    }
-    if (strcmp(type, "infrastructure_Fixed") == 0 || strcmp(type, "infrastructure-Fixed") == 0) {
-        return BasicVehicleClass_infrastructure_Fixed;
-    }
-    if (strcmp(type, "infrastructure_Movable") == 0
-        || strcmp(type, "infrastructure-Movable") == 0) {
-        return BasicVehicleClass_infrastructure_Movable;
-    }
-    if (strcmp(type, "equipped_CargoTrailer") == 0
-        || strcmp(type, "equipped-CargoTrailer") == 0) {
-        return BasicVehicleClass_equipped_CargoTrailer;
-    }
-
-    return BasicVehicleClass_unknownVehicleClass;
+    libsm_enum_t const* e = libsm_enum_from_name(&asn_DEF_BasicVehicleClass, type, strlen(type));
+    return e != NULL ? e->value : BasicVehicleClass_unknownVehicleClass;
 }
 
 
@@ -655,23 +505,10 @@ const char* libsm_str_personal_device_user_type(PersonalDeviceUserType_t type)
  */
 PersonalDeviceUserType_t libsm_personal_device_user_type_from_str(char* deviceType)
 {
-    if (strcasecmp(deviceType, "unavailable") == 0) {
-        return PersonalDeviceUserType_unavailable;
-    }
-    if (strcmp(deviceType, "pedestrian") == 0 || strcmp(deviceType, "aPEDESTRIAN") == 0) {
-        return PersonalDeviceUserType_aPEDESTRIAN;
-    }
-    if (strcmp(deviceType, "pedalcyclist") == 0 || strcmp(deviceType, "aPEDALCYCLIST") == 0) {
-        return PersonalDeviceUserType_aPEDALCYCLIST;
-    }
-    if (strcmp(deviceType, "public safety worker") == 0
-        || strcmp(deviceType, "aPUBLICSAFETYWORKER") == 0) {
-        return PersonalDeviceUserType_aPUBLICSAFETYWORKER;
-    }
-    if (strcmp(deviceType, "animal") == 0 || strcmp(deviceType, "anANIMAL") == 0) {
-        return PersonalDeviceUserType_anANIMAL;
-    }
-    return PersonalDeviceUserType_unavailable;
+    // the table has "pedestrian", "public safety worker" and so on too
+    libsm_enum_t const* e
+            = libsm_enum_from_name(&asn_DEF_PersonalDeviceUserType, deviceType, strlen(deviceType));
+    return e != NULL ? e->value : PersonalDeviceUserType_unavailable;
 }
 
 
@@ -9,9 +9,28 @@
 #include "j2945-defines.h"
 #include "libsm-SPAT.h"
 #include "libsm-TIM.h"
+#include "libsm-anonymize.h"
+#include "libsm-conflict.h"
+#include "libsm-corpus.h"
+#include "libsm-dedup.h"
+#include "libsm-enum.h"
 #include "libsm-error.h"
+#include "libsm-geohash.h"
+#include "libsm-hex.h"
+#include "libsm-itis.h"
+#include "libsm-map.h"
+#include "libsm-mapBuilder.h"
+#include "libsm-oer.h"
 #include "libsm-pathHistory.h"
+#include "libsm-pathHistoryGenerator.h"
 #include "libsm-per.h"
+#include "libsm-pipeline.h"
+#include "libsm-spatBuilder.h"
+#include "libsm-spatTimeline.h"
+#include "libsm-stats.h"
+#include "libsm-timRegion.h"
+#include "libsm-trajectory.h"
+#include "libsm-uperFast.h"
 #include "libsm-version.h"
 #include "octet-helpers.h"
 
@@ -38,6 +57,78 @@ libsm_rval_e libsm_init_bsm(BasicSafetyMessage_t* bsm);
 libsm_rval_e libsm_decode_messageframe(const uint8_t* encoded, size_t len, MessageFrame_t* mf);
 
 
+/**
+ * @brief libsm_decode_messageframe() without copying the large OCTET STRINGs, RTCM messages
+ *
+ * OCTET STRINGs of at least minSize octets are borrowed: a byte aligned one points into encoded,
+ * any other one is copied into arena, and only when that is NULL or full to the heap as usual.
+ * Borrowed strings are not NUL terminated, must not be written to, and stay valid only as long
+ * as encoded and the arena do. ASN_STRUCT_FREE of mf leaves them alone, OCTET_STRING_is_borrowed
+ * tells them apart. Reset arena->used to reuse the arena once mf is freed.
+ *
+ * @param encoded The UPER-encoded MessageFrame, must outlive mf
+ * @param len Its length
+ * @param mf The MessageFrame to decode into, free with ASN_STRUCT_FREE
+ * @param minSize The least size of a borrowed OCTET STRING, 1 or more
+ * @param arena Memory for the unaligned ones, NULL to allocate those, must outlive mf
+ * @retval LIBSM_OK  Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG  mf is NULL
+ * @retval LIBSM_FAIL_NO_VALID_PARAMETER  minSize is 0
+ * @retval LIBSM_FAIL_DECODING  encoded is not a MessageFrame
+ */
+libsm_rval_e libsm_decode_messageframe_borrowed(const uint8_t* encoded,
+                                                size_t len,
+                                                MessageFrame_t* mf,
+                                                size_t minSize,
+                                                asn_borrow_arena_t* arena);
+
+
+/**
+ * @brief The types whose open types a BSM relay need not decode, Part II and regional extensions
+ *
+ * NULL terminated, for libsm_decode_messageframe_opaque
+ */
+extern asn_TYPE_descriptor_t const* const libsm_bsm_extension_types[];
+
+
+/**
+ * @brief libsm_decode_messageframe() keeping the open types of some types encoded
+ *
+ * The open type members of the types in types are kept as they were encoded, of any type, even
+ * one this version of J2735 does not know. Such an open type is absent, present is 0, and
+ * OPEN_TYPE_get_opaque has its octets. libsm_encode_messageframe puts them back bit for bit, so
+ * relaying a BSM without touching its extensions costs what its coreData does.
+ * libsm_materialize_open_types decodes them where that is wanted. JER encoding needs them decoded.
+ *
+ * @param encoded The UPER-encoded MessageFrame
+ * @param len Its length
+ * @param mf The MessageFrame to decode into, free with ASN_STRUCT_FREE
+ * @param types The types, NULL terminated, libsm_bsm_extension_types
+ * @retval LIBSM_OK  Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG  mf or types is NULL
+ * @retval LIBSM_FAIL_DECODING  encoded is not a MessageFrame
+ */
+libsm_rval_e libsm_decode_messageframe_opaque(const uint8_t* encoded,
+                                              size_t len,
+                                              MessageFrame_t* mf,
+                                              asn_TYPE_descriptor_t const* const* types);
+
+
+/**
+ * @brief Decode the open types of a structure that libsm_decode_messageframe_opaque kept encoded
+ *
+ * Only the open type members of sptr itself: &asn_DEF_BSMpartIIExtension and one entry of a BSM's
+ * partII decode its partII-Value. Open types decoded already are left as they are.
+ *
+ * @param td The type of sptr
+ * @param sptr The structure
+ * @retval LIBSM_OK  Operation successful
+ * @retval LIBSM_FAIL_NULL_ARG  td or sptr is NULL
+ * @retval LIBSM_FAIL_DECODING  An open type does not decode, it stays encoded
+ */
+libsm_rval_e libsm_materialize_open_types(asn_TYPE_descriptor_t const* td, void* sptr);
+
+
 /**
  * Given a mf/psm/bsm and buffer, wrap the psm/bsm in a MessageFrame, then UPER-encode it.
  * If LIBSM_OK is returned, the UPER-encoded message is in encoded and the size of encoded message is *len.
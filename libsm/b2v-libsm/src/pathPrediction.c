@@ -3,116 +3,190 @@
 #include <math.h>
 
 
-double libsm_pp_radius_filter(double curvature, libsm_pp_filter_state_t* const state)
+// Confidence lookup table, J2945/1 2020-04 Table A3.
+// Segment i interpolates between thresholds[i - 1] and thresholds[i], the
+// per-segment constants are precomputed so the lookup is a single indexed load.
+#define CONFIDENCE_THRESHOLD_COUNT 11
+
+static double const confidenceThresholds[CONFIDENCE_THRESHOLD_COUNT]
+        = { 25.0, 20.0, 15.0, 10.0, 5.0, 2.5, 2.0, 1.5, 1.0, 0.5, 0.0 };
+static double const confidenceValues[CONFIDENCE_THRESHOLD_COUNT]
+        = { 0.0, 10.0, 20.0, 30.0, 40.0, 50.0, 60.0, 70.0, 80.0, 90.0, 100.0 };
+
+// lower threshold, value delta, threshold delta and lower value for each segment.
+// Index 0 (above the first threshold) and index 11 (below the last) are
+// handled as clamps, their entries only need to be harmless.
+static double const confidenceSegLowerBound[CONFIDENCE_THRESHOLD_COUNT + 1]
+        = { 25.0, 25.0, 20.0, 15.0, 10.0, 5.0, 2.5, 2.0, 1.5, 1.0, 0.5, 0.0 };
+static double const confidenceSegConfDelta[CONFIDENCE_THRESHOLD_COUNT + 1]
+        = { 0.0,  10.0 - 0.0,  20.0 - 10.0, 30.0 - 20.0, 40.0 - 30.0, 50.0 - 40.0,
+            60.0 - 50.0, 70.0 - 60.0, 80.0 - 70.0, 90.0 - 80.0, 100.0 - 90.0, 0.0 };
+static double const confidenceSegBoundDelta[CONFIDENCE_THRESHOLD_COUNT + 1]
+        = { 1.0,       20.0 - 25.0, 15.0 - 20.0, 10.0 - 15.0, 5.0 - 10.0, 2.5 - 5.0,
+            2.0 - 2.5, 1.5 - 2.0,   1.0 - 1.5,   0.5 - 1.0,   0.0 - 0.5,  1.0 };
+static double const confidenceSegLowerConf[CONFIDENCE_THRESHOLD_COUNT + 1]
+        = { 0.0, 0.0, 10.0, 20.0, 30.0, 40.0, 50.0, 60.0, 70.0, 80.0, 90.0, 100.0 };
+
+
+/**
+ * One step of the radius filter.
+ * Written without branches so that it can be inlined into the batch loop
+ * and if-converted by the compiler; libsm_pp_radius_filter uses it too so
+ * the scalar and batch paths are bit-identical.
+ */
+static inline double pp_radius_step(double curvature, libsm_pp_filter_state_t* const state)
 {
     const double w0 = (M_PI * 2.0 * curvatureCutoffFrequency);
     const double w02_Ts2 = ((w0 * w0) * (curvatureSamplingPeriod * curvatureSamplingPeriod));
     const double two_w0_Zeta_Ts = (2.0 * w0 * curvatureDampingFactor * curvatureSamplingPeriod);
     const double maxCurvature = 1.0 / curvatureMaxRadius;
 
-    double filteredCurvature;
+    int const initializing = (state->initCount < 2);
 
-    if (state->initCount < 2) {
-        state->initCount++;
-        filteredCurvature = curvature;
-    } else {
-        filteredCurvature = (2.0 + two_w0_Zeta_Ts) * state->Y_n_minus1;
-        filteredCurvature += w02_Ts2 * curvature;
-        filteredCurvature -= state->Y_n_minus2;
-        filteredCurvature /= (1.0 + two_w0_Zeta_Ts + w02_Ts2);
-    }
+    double filteredCurvature = (2.0 + two_w0_Zeta_Ts) * state->Y_n_minus1;
+    filteredCurvature += w02_Ts2 * curvature;
+    filteredCurvature -= state->Y_n_minus2;
+    filteredCurvature /= (1.0 + two_w0_Zeta_Ts + w02_Ts2);
+    filteredCurvature = initializing ? curvature : filteredCurvature;
+    state->initCount += initializing;
 
     state->Y_n_minus2 = state->Y_n_minus1;
     state->Y_n_minus1 = filteredCurvature;
 
-    bool const signIsNegative = (filteredCurvature < 0.0);
-    filteredCurvature = fmax(fabs(filteredCurvature), maxCurvature);
-    if (signIsNegative) {
-        filteredCurvature = -filteredCurvature;
-    }
+    double const magnitude = fmax(fabs(filteredCurvature), maxCurvature);
+    filteredCurvature = (filteredCurvature < 0.0) ? -magnitude : magnitude;
 
     return 1.0 / filteredCurvature;
 }
 
 
-// J2945/1 2020-04 Figure A19/A20
-double libsm_pp_confidence_filter(double yawRate, libsm_pp_filter_state_t* const state)
+/**
+ * One step of the confidence filter, before the lookup.
+ * Returns the filtered yaw rate.
+ */
+static inline double pp_confidence_step(double yawRate, libsm_pp_filter_state_t* const state)
 {
     const double w0 = (M_PI * 2.0 * confidenceCutoffFrequency);
     const double w02_Ts2 = ((w0 * w0) * (confidenceSamplingPeriod * confidenceSamplingPeriod));
     const double w02_Ts = ((w0 * w0) * confidenceSamplingPeriod);
     const double two_w0_Zeta_Ts = (2.0 * w0 * confidenceDampingFactor * confidenceSamplingPeriod);
 
-    double filteredConfidence;
+    int const initializing = (state->initCount < 2);
 
-    if (state->initCount < 2) {
-        state->initCount++;
-        filteredConfidence = yawRate;
-    } else {
-        filteredConfidence = ((2.0 + two_w0_Zeta_Ts) * state->Y_n_minus1);
-        filteredConfidence += w02_Ts * (yawRate - state->u_n_minus1);
-        filteredConfidence -= state->Y_n_minus2;
-        filteredConfidence /= (w02_Ts2 + two_w0_Zeta_Ts + 1.0);
-    }
+    double filteredConfidence = ((2.0 + two_w0_Zeta_Ts) * state->Y_n_minus1);
+    filteredConfidence += w02_Ts * (yawRate - state->u_n_minus1);
+    filteredConfidence -= state->Y_n_minus2;
+    filteredConfidence /= (w02_Ts2 + two_w0_Zeta_Ts + 1.0);
+    filteredConfidence = initializing ? yawRate : filteredConfidence;
+    state->initCount += initializing;
 
     state->u_n_minus1 = yawRate;
     state->Y_n_minus2 = state->Y_n_minus1;
     state->Y_n_minus1 = filteredConfidence;
 
-    return confidenceLookup(fabs(filteredConfidence));
+    return filteredConfidence;
 }
 
 
-double confidenceLookup(double confidenceFiltered)
+static inline double pp_confidence_lookup(double confidenceFiltered)
 {
-    static double const thresholds[11] = { 25.0, 20.0, 15.0, 10.0, 5.0, 2.5,
-                                           2.0,  1.5,  1.0,  0.5,  0.0 };
-    static double const values[11] = { 0.0,  10.0, 20.0, 30.0, 40.0, 50.0,
-                                       60.0, 70.0, 80.0, 90.0, 100.0 };
-
-    // Linear interpolation
-    for (int i = 0; i < 11; i++) {
-        if (confidenceFiltered >= thresholds[i]) {
-            if (i == 0) {
-                return values[i];
-            } else {
-                double const lowerConf = values[i - 1];
-                double const upperConf = values[i];
-                double const lowerBound = thresholds[i - 1];
-                double const upperBound = thresholds[i];
-                double finalConfidence = confidenceFiltered - lowerBound;
-                finalConfidence *= (upperConf - lowerConf);
-                finalConfidence /= (upperBound - lowerBound);
-                finalConfidence += lowerConf;
-                return finalConfidence;
-            }
-        }
+    // The segment is the number of thresholds the value is not above or equal to.
+    // Written as !(>=) so a NaN falls off the end of the table, like the linear search did.
+    int segment = 0;
+    for (int i = 0; i < CONFIDENCE_THRESHOLD_COUNT; i++) {
+        segment += !(confidenceFiltered >= confidenceThresholds[i]);
     }
-    return 100.0;
+
+    // Linear interpolation, same operation order as J2945/1 so results are unchanged
+    double finalConfidence = confidenceFiltered - confidenceSegLowerBound[segment];
+    finalConfidence *= confidenceSegConfDelta[segment];
+    finalConfidence /= confidenceSegBoundDelta[segment];
+    finalConfidence += confidenceSegLowerConf[segment];
+
+    finalConfidence = (segment == 0) ? confidenceValues[0] : finalConfidence;
+    finalConfidence = (segment == CONFIDENCE_THRESHOLD_COUNT) ? 100.0 : finalConfidence;
+    return finalConfidence;
 }
 
 
-void libsm_calculatePathPrediction(PathPrediction_t* const pp, double speed, double yawRate)
+static inline void pp_calculate(libsm_pp_ctx_t* const ctx,
+                                double speed,
+                                double yawRate,
+                                RadiusOfCurvature_t* const radiusOfCurve,
+                                Confidence_t* const confidence)
 {
-    static libsm_pp_filter_state_t radiusState = { 0 };
-    static libsm_pp_filter_state_t confidenceState = { 0 };
     double const YawRateRadPerS = yawRate * (M_PI / 180.0);
 
+    double const turningCurvature = YawRateRadPerS / speed;
+
     double curvature = 1.0 / (double)vruMaxCurveRadius;
+    curvature = (speed < vruStationarySpeedThresh) ? turningCurvature : curvature;
+
+    double const FilteredRadius_Raw = pp_radius_step(curvature, &ctx->radiusState);
+    double const FilteredConfidence
+            = pp_confidence_lookup(fabs(pp_confidence_step(yawRate, &ctx->confidenceState)));
+
+    long const scaledRadius = (RadiusOfCurvature_t)(curvatureRadiusUnit * FilteredRadius_Raw);
+    *radiusOfCurve = (labs(scaledRadius) >= vruMaxCurveRadius) ? RadiusOfCurvature_straight
+                                                                : scaledRadius;
+    *confidence = (Confidence_t)(curvatureConfidenceUnit * FilteredConfidence);
+}
+
+
+double libsm_pp_radius_filter(double curvature, libsm_pp_filter_state_t* const state)
+{
+    return pp_radius_step(curvature, state);
+}
+
+
+// J2945/1 2020-04 Figure A19/A20
+double libsm_pp_confidence_filter(double yawRate, libsm_pp_filter_state_t* const state)
+{
+    return confidenceLookup(fabs(pp_confidence_step(yawRate, state)));
+}
 
-    if (speed < vruStationarySpeedThresh) {
-        curvature = YawRateRadPerS / speed;
+
+double confidenceLookup(double confidenceFiltered)
+{
+    return pp_confidence_lookup(confidenceFiltered);
+}
+
+
+void libsm_pp_ctx_init(libsm_pp_ctx_t* const ctx)
+{
+    if (ctx == NULL) {
+        return;
     }
+    ctx->radiusState = (libsm_pp_filter_state_t){ 0 };
+    ctx->confidenceState = (libsm_pp_filter_state_t){ 0 };
+}
 
-    double FilteredRadius_Raw = libsm_pp_radius_filter(curvature, &radiusState);
-    ;
-    double FilteredConfidence = libsm_pp_confidence_filter(yawRate, &confidenceState);
 
-    long scaledRadius = (RadiusOfCurvature_t)(curvatureRadiusUnit * FilteredRadius_Raw);
-    if (labs(scaledRadius) >= vruMaxCurveRadius) {
-        pp->radiusOfCurve = RadiusOfCurvature_straight;
-    } else {
-        pp->radiusOfCurve = scaledRadius;
+void libsm_calculatePathPrediction_ctx(libsm_pp_ctx_t* const ctx,
+                                       PathPrediction_t* const pp,
+                                       double speed,
+                                       double yawRate)
+{
+    pp_calculate(ctx, speed, yawRate, &pp->radiusOfCurve, &pp->confidence);
+}
+
+
+void libsm_calculatePathPrediction_batch(libsm_pp_ctx_t* const ctx,
+                                         size_t count,
+                                         double const* const speed,
+                                         double const* const yawRate,
+                                         RadiusOfCurvature_t* const radiusOfCurve,
+                                         Confidence_t* const confidence)
+{
+    for (size_t i = 0; i < count; i++) {
+        pp_calculate(&ctx[i], speed[i], yawRate[i], &radiusOfCurve[i], &confidence[i]);
     }
-    pp->confidence = (Confidence_t)(curvatureConfidenceUnit * FilteredConfidence);
+}
+
+
+void libsm_calculatePathPrediction(PathPrediction_t* const pp, double speed, double yawRate)
+{
+    static ASN_THREAD_LOCAL libsm_pp_ctx_t defaultCtx;
+
+    libsm_calculatePathPrediction_ctx(&defaultCtx, pp, speed, yawRate);
 }
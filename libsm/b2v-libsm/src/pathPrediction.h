@@ -13,6 +13,17 @@ typedef struct {
 } libsm_pp_filter_state_t;
 
 
+/**
+ * Path prediction state for a single device.
+ * One of these is needed for each vehicle or VRU being tracked.
+ * Zero-initialize it, or use libsm_pp_ctx_init.
+ */
+typedef struct {
+    libsm_pp_filter_state_t radiusState;
+    libsm_pp_filter_state_t confidenceState;
+} libsm_pp_ctx_t;
+
+
 /**
  * @brief libsm path prediction radius second order filter.
  *
@@ -43,11 +54,29 @@ double libsm_pp_radius_filter(double curvature, libsm_pp_filter_state_t* const s
 double libsm_pp_confidence_filter(double yawRate, libsm_pp_filter_state_t* const state);
 
 
+/**
+ * @brief Map a filtered yaw rate onto a confidence percentage
+ *
+ * @details Reference: J2945/1 2020-04 Table A3
+ *          Table driven, no data dependent branches.
+ *
+ * @param confidenceFiltered The absolute filtered yaw rate in degrees/second.
+ *
+ * @return The confidence in the range 0 to 100 percent.
+ **/
 double confidenceLookup(double confidenceFiltered);
 
 
 /**
- * @brief Path prediction entry point
+ * @brief Reset a path prediction context
+ *
+ * @param ctx The context to reset
+ */
+void libsm_pp_ctx_init(libsm_pp_ctx_t* const ctx);
+
+
+/**
+ * @brief Path prediction for one device
  *
  * CAUTION: This is does not strictly conform to J2735 and J2945.
  *
@@ -57,10 +86,45 @@ double confidenceLookup(double confidenceFiltered);
  *          J2735: Confidence ::= INTEGER (0..200) LSB units of 0.5 percent
  *          J2945/1 Table A3 shows this is based on yaw rate.
  *
+ * @param ctx The state for this device.
  * @param pp Path prediction output.
  * @param speed Vehicle speed in meters per second.
  * @param yawRate Yaw rate in degrees per second.
  */
+void libsm_calculatePathPrediction_ctx(libsm_pp_ctx_t* const ctx,
+                                       PathPrediction_t* const pp,
+                                       double speed,
+                                       double yawRate);
+
+
+/**
+ * @brief Path prediction for many devices at once
+ *
+ * Runs one filter step for each of count devices. Inputs and outputs are
+ * structure-of-arrays, element i of every array belongs to ctx[i].
+ * The results are bit-identical to calling libsm_calculatePathPrediction_ctx
+ * once per device.
+ *
+ * @param ctx Array of count contexts, one per device.
+ * @param count Number of devices.
+ * @param speed Array of speeds in meters per second.
+ * @param yawRate Array of yaw rates in degrees per second.
+ * @param radiusOfCurve Output array of radius, J2735 units.
+ * @param confidence Output array of confidence, J2735 units.
+ */
+void libsm_calculatePathPrediction_batch(libsm_pp_ctx_t* const ctx,
+                                         size_t count,
+                                         double const* const speed,
+                                         double const* const yawRate,
+                                         RadiusOfCurvature_t* const radiusOfCurve,
+                                         Confidence_t* const confidence);
+
+
+/**
+ * Path prediction using a context per thread.
+ *
+ * DEPRECATED, only able to track one device per thread. See libsm_calculatePathPrediction_ctx
+ */
 void libsm_calculatePathPrediction(PathPrediction_t* const pp, double speed, double yawRate);
 
 
@@ -1,6 +1,9 @@
 #include "CppUTest/TestHarness_c.h"
 #include "pathPrediction.h"
 
+#include <math.h>
+#include <string.h>
+
 TEST_C(path_prediction, radius_filter_constant)
 {
     double const tolerance = 1e8;
@@ -115,3 +118,91 @@ TEST_C(path_prediction, confidenceLookup_interpolate)
 
     CHECK_EQUAL_C_REAL(expectedResult, actualResult, tolerance);
 }
+
+// The linear threshold search confidenceLookup used before it became table driven
+static double referenceConfidenceLookup(double confidenceFiltered)
+{
+    static double const thresholds[11] = { 25.0, 20.0, 15.0, 10.0, 5.0, 2.5,
+                                           2.0,  1.5,  1.0,  0.5,  0.0 };
+    static double const values[11] = { 0.0,  10.0, 20.0, 30.0, 40.0, 50.0,
+                                       60.0, 70.0, 80.0, 90.0, 100.0 };
+
+    for (int i = 0; i < 11; i++) {
+        if (confidenceFiltered >= thresholds[i]) {
+            if (i == 0) {
+                return values[i];
+            }
+            double finalConfidence = confidenceFiltered - thresholds[i - 1];
+            finalConfidence *= (values[i] - values[i - 1]);
+            finalConfidence /= (thresholds[i] - thresholds[i - 1]);
+            finalConfidence += values[i - 1];
+            return finalConfidence;
+        }
+    }
+    return 100.0;
+}
+
+TEST_C(path_prediction, confidenceLookup_matches_reference)
+{
+    for (double x = -1.0; x < 30.0; x += 0.01) {
+        double const expected = referenceConfidenceLookup(x);
+        double const actual = confidenceLookup(x);
+        CHECK_C(memcmp(&expected, &actual, sizeof(double)) == 0);
+    }
+    CHECK_EQUAL_C_REAL(100.0, confidenceLookup(NAN), 0.0);
+    CHECK_EQUAL_C_REAL(0.0, confidenceLookup(INFINITY), 0.0);
+}
+
+TEST_C(path_prediction, ctx_devices_are_independent)
+{
+    libsm_pp_ctx_t turning;
+    libsm_pp_ctx_t straight;
+    libsm_pp_ctx_t alone;
+    PathPrediction_t ppTurning;
+    PathPrediction_t ppStraight;
+    PathPrediction_t ppAlone;
+
+    libsm_pp_ctx_init(&turning);
+    libsm_pp_ctx_init(&straight);
+    libsm_pp_ctx_init(&alone);
+
+    for (int i = 0; i < 20; i++) {
+        libsm_calculatePathPrediction_ctx(&turning, &ppTurning, 0.5, 20.0);
+        libsm_calculatePathPrediction_ctx(&straight, &ppStraight, 10.0, 0.0);
+        libsm_calculatePathPrediction_ctx(&alone, &ppAlone, 10.0, 0.0);
+    }
+    CHECK_EQUAL_C_LONG(ppAlone.radiusOfCurve, ppStraight.radiusOfCurve);
+    CHECK_EQUAL_C_LONG(ppAlone.confidence, ppStraight.confidence);
+    CHECK_C(ppTurning.confidence != ppStraight.confidence);
+}
+
+TEST_C(path_prediction, batch_matches_scalar)
+{
+    enum { devices = 37, steps = 50 };
+    libsm_pp_ctx_t scalarCtx[devices] = { { { 0 } } };
+    libsm_pp_ctx_t batchCtx[devices] = { { { 0 } } };
+    double speed[devices];
+    double yawRate[devices];
+    RadiusOfCurvature_t radius[devices];
+    Confidence_t confidence[devices];
+    unsigned int seed = 2945;
+
+    for (int step = 0; step < steps; step++) {
+        for (int d = 0; d < devices; d++) {
+            seed = seed * 1103515245 + 12345;
+            speed[d] = (double)(seed % 3000) / 1000.0;
+            seed = seed * 1103515245 + 12345;
+            yawRate[d] = ((double)(seed % 8000) / 100.0) - 40.0;
+        }
+
+        libsm_calculatePathPrediction_batch(batchCtx, devices, speed, yawRate, radius, confidence);
+
+        for (int d = 0; d < devices; d++) {
+            PathPrediction_t pp;
+            libsm_calculatePathPrediction_ctx(&scalarCtx[d], &pp, speed[d], yawRate[d]);
+            CHECK_EQUAL_C_LONG(pp.radiusOfCurve, radius[d]);
+            CHECK_EQUAL_C_LONG(pp.confidence, confidence[d]);
+        }
+    }
+    CHECK_C(memcmp(scalarCtx, batchCtx, sizeof(scalarCtx)) == 0);
+}
@@ -0,0 +1,387 @@
+/*
+ * testAnonymize.c
+ * Tests for anonymizing captured frames in place
+ *
+ * Did you know? Documentation for how to write more tests is at https://cpputest.github.io/manual.html
+ */
+#include "CppUTest/TestHarness_c.h"
+#include "libsm.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define BATCH 300
+#define SLOT 2048
+
+
+static uint8_t const ID[4] = { 0x01, 0x02, 0x03, 0x04 };
+
+
+// A BSM at a known place and time, with path history and prediction if partII
+static size_t encodeBsm(long lat, long msgCnt, int partII, uint8_t* encoded, size_t len)
+{
+    MessageFrame_t* mf = libsm_alloc_init_mf_bsm();
+    CHECK_C(mf != NULL);
+    BSMcoreData_t* core = &libsm_get_bsm(mf)->coreData;
+    core->msgCnt = msgCnt;
+    memcpy(core->id.buf, ID, sizeof(ID));
+    core->secMark = 12345;
+    core->lat = lat;
+    core->Long = -834567891;
+    core->elev = 2345;
+    core->speed = 1234;
+    if (partII) {
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_init_bsm_path_history(libsm_get_bsm(mf)));
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_set_path_prediction(libsm_get_bsm(mf), 150, 32767));
+    }
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, encoded, &len));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    return len;
+}
+
+
+static MessageFrame_t* decode(uint8_t const* encoded, size_t len)
+{
+    MessageFrame_t* mf = calloc(1, sizeof(MessageFrame_t));
+    CHECK_C(mf != NULL);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_decode_messageframe(encoded, len, mf));
+    return mf;
+}
+
+
+TEST_C(anonymize, bsm_in_place)
+{
+    uint8_t encoded[512];
+    size_t const original = encodeBsm(423456789, 7, 0, encoded, sizeof(encoded));
+    uint8_t copy[512];
+    memcpy(copy, encoded, original);
+
+    libsm_anonymize_t anon;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_anonymize_default(&anon));
+    size_t len = original;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_anonymize_frame(&anon, encoded, &len));
+    CHECK_EQUAL_C_INT(original, len);
+
+    MessageFrame_t* mf = decode(encoded, len);
+    BSMcoreData_t const* core = &libsm_get_bsm(mf)->coreData;
+    CHECK_EQUAL_C_LONG(7, core->msgCnt);
+    CHECK_EQUAL_C_LONG(12000, core->secMark);
+    CHECK_EQUAL_C_LONG(423460000, core->lat);
+    CHECK_EQUAL_C_LONG(-834570000, core->Long);
+    CHECK_EQUAL_C_LONG(2300, core->elev);
+    CHECK_EQUAL_C_LONG(1234, core->speed);
+    CHECK_C(memcmp(core->id.buf, ID, sizeof(ID)) != 0);
+    uint8_t pseudonym[4];
+    memcpy(pseudonym, core->id.buf, sizeof(pseudonym));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+
+    // the same key gives the same frame
+    uint8_t again[512];
+    memcpy(again, copy, original);
+    len = original;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_anonymize_frame(&anon, again, &len));
+    CHECK_C(memcmp(encoded, again, original) == 0);
+
+    // another key another pseudonym, and the id is kept when asked
+    anon.key[0] = 0x5a;
+    memcpy(again, copy, original);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_anonymize_frame(&anon, again, &len));
+    mf = decode(again, len);
+    CHECK_C(memcmp(libsm_get_bsm(mf)->coreData.id.buf, pseudonym, sizeof(pseudonym)) != 0);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+
+    anon.pseudonymizeId = false;
+    memcpy(again, copy, original);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_anonymize_frame(&anon, again, &len));
+    mf = decode(again, len);
+    CHECK_C(memcmp(libsm_get_bsm(mf)->coreData.id.buf, ID, sizeof(ID)) == 0);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
+
+
+TEST_C(anonymize, unavailable_kept)
+{
+    MessageFrame_t* mf = libsm_alloc_init_mf_bsm();
+    CHECK_C(mf != NULL);
+    uint8_t encoded[512];
+    size_t len = sizeof(encoded);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, encoded, &len));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+
+    libsm_anonymize_t anon;
+    libsm_anonymize_default(&anon);
+    anon.positionJitter = 1000;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_anonymize_frame(&anon, encoded, &len));
+    mf = decode(encoded, len);
+    BSMcoreData_t const* core = &libsm_get_bsm(mf)->coreData;
+    CHECK_EQUAL_C_LONG(DSecond_unavailable, core->secMark);
+    CHECK_EQUAL_C_LONG(Latitude_unavailable, core->lat);
+    CHECK_EQUAL_C_LONG(Longitude_unavailable, core->Long);
+    CHECK_EQUAL_C_LONG(Elevation_unavailable, core->elev);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
+
+
+TEST_C(anonymize, jitter)
+{
+    libsm_anonymize_t anon;
+    libsm_anonymize_default(&anon);
+    anon.positionGrid = 0;
+    anon.positionJitter = 500;
+
+    int moved = 0;
+    for (long msgCnt = 0; msgCnt < 50; msgCnt++) {
+        uint8_t encoded[512];
+        size_t len = encodeBsm(423456789, msgCnt, 0, encoded, sizeof(encoded));
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_anonymize_frame(&anon, encoded, &len));
+        MessageFrame_t* mf = decode(encoded, len);
+        BSMcoreData_t const* core = &libsm_get_bsm(mf)->coreData;
+        CHECK_C(labs(core->lat - 423456789) <= 500);
+        CHECK_C(labs(core->Long + 834567891) <= 500);
+        moved += core->lat != 423456789;
+        ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    }
+    CHECK_C(moved > 40);
+
+    // never past the pole
+    for (long msgCnt = 0; msgCnt < 10; msgCnt++) {
+        uint8_t encoded[512];
+        size_t len = encodeBsm(899999900, msgCnt, 0, encoded, sizeof(encoded));
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_anonymize_frame(&anon, encoded, &len));
+        MessageFrame_t* mf = decode(encoded, len);
+        CHECK_C(libsm_get_bsm(mf)->coreData.lat <= 900000000);
+        ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    }
+}
+
+
+TEST_C(anonymize, drop_path_history)
+{
+    uint8_t encoded[512];
+    size_t const original = encodeBsm(423456789, 7, 1, encoded, sizeof(encoded));
+    uint8_t copy[512];
+    memcpy(copy, encoded, original);
+
+    libsm_anonymize_t anon;
+    libsm_anonymize_default(&anon);
+    size_t len = original;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_anonymize_frame(&anon, encoded, &len));
+    CHECK_C(len < original);
+    MessageFrame_t* mf = decode(encoded, len);
+    BasicSafetyMessage_t* bsm = libsm_get_bsm(mf);
+    CHECK_EQUAL_C_LONG(423460000, bsm->coreData.lat);
+    VehicleSafetyExtensions_t* vse = libsm_get_partII_elem(
+            bsm, BSMpartIIExtension__partII_Value_PR_VehicleSafetyExtensions);
+    CHECK_C(vse != NULL);
+    CHECK_C(vse->pathHistory == NULL);
+    CHECK_C(vse->pathPrediction != NULL);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+
+    // kept, and patched in place
+    anon.dropPathHistory = false;
+    len = original;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_anonymize_frame(&anon, copy, &len));
+    CHECK_EQUAL_C_INT(original, len);
+    mf = decode(copy, len);
+    vse = libsm_get_partII_elem(libsm_get_bsm(mf),
+                                BSMpartIIExtension__partII_Value_PR_VehicleSafetyExtensions);
+    CHECK_C(vse->pathHistory != NULL);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
+
+
+TEST_C(anonymize, psm)
+{
+    MessageFrame_t* mf = libsm_alloc_init_mf_psm();
+    CHECK_C(mf != NULL);
+    PersonalSafetyMessage_t* psm = libsm_get_psm(mf);
+    psm->msgCnt = 3;
+    memcpy(psm->id.buf, ID, sizeof(ID));
+    psm->secMark = 45678;
+    psm->position.lat = -123456789;
+    psm->position.Long = 1000004999;
+    psm->position.elevation = calloc(1, sizeof(Common_Elevation_t));
+    *psm->position.elevation = 149;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_init_psm_path_history(psm));
+    uint8_t encoded[512];
+    size_t len = sizeof(encoded);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, encoded, &len));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    size_t const original = len;
+
+    libsm_anonymize_t anon;
+    libsm_anonymize_default(&anon);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_anonymize_frame(&anon, encoded, &len));
+    CHECK_C(len < original);
+    mf = decode(encoded, len);
+    psm = libsm_get_psm(mf);
+    CHECK_EQUAL_C_LONG(45000, psm->secMark);
+    CHECK_EQUAL_C_LONG(-123460000, psm->position.lat);
+    CHECK_EQUAL_C_LONG(1000000000, psm->position.Long);
+    CHECK_EQUAL_C_LONG(100, *psm->position.elevation);
+    CHECK_C(memcmp(psm->id.buf, ID, sizeof(ID)) != 0);
+    CHECK_C(psm->pathHistory == NULL);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
+
+
+// A PSM at a known place and time with a path history, and an elevation if asked
+static size_t encodePsm(int elevation, uint8_t* encoded, size_t len)
+{
+    MessageFrame_t* mf = libsm_alloc_init_mf_psm();
+    CHECK_C(mf != NULL);
+    PersonalSafetyMessage_t* psm = libsm_get_psm(mf);
+    psm->msgCnt = 3;
+    memcpy(psm->id.buf, ID, sizeof(ID));
+    psm->secMark = 45678;
+    psm->position.lat = -123456789;
+    psm->position.Long = 1000004999;
+    if (elevation) {
+        psm->position.elevation = calloc(1, sizeof(Common_Elevation_t));
+        *psm->position.elevation = 149;
+    }
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_init_psm_path_history(psm));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, encoded, &len));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    return len;
+}
+
+
+TEST_C(anonymize, psm_patched_like_reencoded)
+{
+    for (int elevation = 0; elevation < 2; elevation++) {
+        uint8_t patched[512];
+        size_t const original = encodePsm(elevation, patched, sizeof(patched));
+        uint8_t reencoded[512];
+        memcpy(reencoded, patched, original);
+
+        // the path history is kept so the PSM is patched, and dropped so it is re-encoded
+        libsm_anonymize_t anon;
+        libsm_anonymize_default(&anon);
+        anon.positionJitter = 500;
+        anon.dropPathHistory = false;
+        size_t offset = 0;
+        size_t len = original;
+        libsm_anonymize_stats_t stats;
+        CHECK_EQUAL_C_INT(LIBSM_OK,
+                          libsm_anonymize_batch(&anon, patched, &offset, &len, NULL, 1, 1, &stats));
+        CHECK_EQUAL_C_INT(1, stats.patched);
+        CHECK_EQUAL_C_INT(original, len);
+
+        anon.dropPathHistory = true;
+        size_t reencodedLen = original;
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_anonymize_batch(&anon, reencoded, &offset,
+                                                          &reencodedLen, NULL, 1, 1, &stats));
+        CHECK_EQUAL_C_INT(1, stats.reencoded);
+
+        // without its path history the patched PSM encodes to the same bytes
+        MessageFrame_t* mf = decode(patched, len);
+        PersonalSafetyMessage_t* psm = libsm_get_psm(mf);
+        CHECK_C(psm->pathHistory != NULL);
+        CHECK_C(memcmp(psm->id.buf, ID, sizeof(ID)) != 0);
+        CHECK_EQUAL_C_INT(elevation, psm->position.elevation != NULL);
+        ASN_STRUCT_FREE(asn_DEF_PathHistory, psm->pathHistory);
+        psm->pathHistory = NULL;
+        uint8_t expected[512];
+        size_t expectedLen = sizeof(expected);
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, expected, &expectedLen));
+        ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+        CHECK_EQUAL_C_INT(expectedLen, reencodedLen);
+        CHECK_C(memcmp(expected, reencoded, reencodedLen) == 0);
+    }
+}
+
+
+TEST_C(anonymize, batch_threads)
+{
+    libsm_corpus_config_t config;
+    libsm_corpus_default_config(&config);
+    uint8_t* original = malloc(BATCH * SLOT);
+    uint8_t* data = malloc(BATCH * SLOT);
+    size_t offsets[BATCH];
+    size_t originalLens[BATCH];
+    size_t lens[BATCH];
+    size_t single[BATCH];
+    libsm_rval_e results[BATCH];
+    for (size_t i = 0; i < BATCH; i++) {
+        offsets[i] = i * SLOT;
+        originalLens[i] = SLOT;
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_corpus_message(&config, i, original + offsets[i],
+                                                         &originalLens[i]));
+    }
+
+    libsm_anonymize_t anon;
+    libsm_anonymize_default(&anon);
+    anon.positionJitter = 100;
+    libsm_anonymize_stats_t stats;
+    memcpy(data, original, BATCH * SLOT);
+    memcpy(single, originalLens, sizeof(single));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_anonymize_batch(&anon, data, offsets, single, NULL, BATCH,
+                                                      1, &stats));
+    uint8_t* expected = malloc(BATCH * SLOT);
+    memcpy(expected, data, BATCH * SLOT);
+
+    memcpy(data, original, BATCH * SLOT);
+    memcpy(lens, originalLens, sizeof(lens));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_anonymize_batch(&anon, data, offsets, lens, results, BATCH,
+                                                      7, &stats));
+    CHECK_EQUAL_C_INT(BATCH, stats.patched + stats.reencoded + stats.untouched);
+    CHECK_EQUAL_C_INT(0, stats.failed);
+    CHECK_C(stats.patched > 0);
+    CHECK_C(stats.reencoded > 0);
+    CHECK_C(stats.untouched > 0);
+
+    uint64_t untouched = 0;
+    for (size_t i = 0; i < BATCH; i++) {
+        CHECK_EQUAL_C_INT(LIBSM_OK, results[i]);
+        CHECK_EQUAL_C_INT(single[i], lens[i]);
+        CHECK_C(memcmp(expected + offsets[i], data + offsets[i], lens[i]) == 0);
+        MessageFrame_t* mf = decode(data + offsets[i], lens[i]);
+        if (mf->messageId != DSRCmsgID_basicSafetyMessage
+            && mf->messageId != DSRCmsgID_personalSafetyMessage) {
+            untouched++;
+            CHECK_EQUAL_C_INT(originalLens[i], lens[i]);
+            CHECK_C(memcmp(original + offsets[i], data + offsets[i], lens[i]) == 0);
+        }
+        ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    }
+    CHECK_EQUAL_C_INT(untouched, stats.untouched);
+
+    free(original);
+    free(data);
+    free(expected);
+}
+
+
+TEST_C(anonymize, bad_arguments)
+{
+    libsm_anonymize_t anon;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_anonymize_default(NULL));
+    libsm_anonymize_default(&anon);
+    uint8_t encoded[512];
+    size_t const original = encodeBsm(423456789, 7, 1, encoded, sizeof(encoded));
+    size_t len = original;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_anonymize_frame(NULL, encoded, &len));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_anonymize_frame(&anon, encoded, NULL));
+
+    anon.elevationGrid = -1;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_anonymize_frame(&anon, encoded, &len));
+    size_t offset = 0;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER,
+                      libsm_anonymize_batch(&anon, encoded, &offset, &len, NULL, 1, 1, NULL));
+    anon.elevationGrid = 100;
+
+    // cut short, left as it was
+    uint8_t copy[512];
+    memcpy(copy, encoded, original);
+    len = original / 2;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_DECODING, libsm_anonymize_frame(&anon, encoded, &len));
+    CHECK_EQUAL_C_INT(original / 2, len);
+    CHECK_C(memcmp(copy, encoded, original) == 0);
+    libsm_anonymize_stats_t stats;
+    libsm_rval_e result;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL,
+                      libsm_anonymize_batch(&anon, encoded, &offset, &len, &result, 1, 0, &stats));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_DECODING, result);
+    CHECK_EQUAL_C_INT(1, stats.failed);
+}
@@ -0,0 +1,201 @@
+/*
+ * testBorrow.c
+ * Tests for decoding MessageFrames with borrowed OCTET STRINGs
+ *
+ * Did you know? Documentation for how to write more tests is at https://cpputest.github.io/manual.html
+ */
+#include "CppUTest/TestHarness_c.h"
+#include "libsm.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define MESSAGES 4
+
+
+/*
+ * RTCM corrections of MESSAGES messages of size octets, message i all i + 1.
+ * Each message has a 10 bit length in front, so exactly one of them is byte
+ * aligned, whatever the position of the first
+ */
+static size_t encodeRtcm(size_t size, uint8_t* encoded, size_t len)
+{
+    MessageFrame_t* mf = calloc(1, sizeof(MessageFrame_t));
+    CHECK_C(mf != NULL);
+    mf->messageId = DSRCmsgID_rtcmCorrections;
+    mf->value.present = MessageFrame__value_PR_RTCMcorrections;
+    RTCMcorrections_t* rtcm = &mf->value.choice.RTCMcorrections;
+    rtcm->msgCnt = 5;
+    rtcm->rev = RTCM_Revision_rtcmRev3;
+
+    uint8_t octets[1023];
+    for (int i = 0; i < MESSAGES; i++) {
+        memset(octets, i + 1, size);
+        RTCMmessage_t* message
+                = OCTET_STRING_new_fromBuf(&asn_DEF_RTCMmessage, (char*)octets, size);
+        CHECK_C(message != NULL);
+        CHECK_EQUAL_C_INT(0, ASN_SEQUENCE_ADD(&rtcm->msgs.list, message));
+    }
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, encoded, &len));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    return len;
+}
+
+
+static int inside(void const* p, void const* buf, size_t len)
+{
+    return (uint8_t const*)p >= (uint8_t const*)buf
+           && (uint8_t const*)p < (uint8_t const*)buf + len;
+}
+
+
+static void checkMessages(MessageFrame_t const* mf, size_t size)
+{
+    RTCMcorrections_t const* rtcm = &mf->value.choice.RTCMcorrections;
+    CHECK_EQUAL_C_INT(MessageFrame__value_PR_RTCMcorrections, mf->value.present);
+    CHECK_EQUAL_C_INT(MESSAGES, rtcm->msgs.list.count);
+    for (int i = 0; i < MESSAGES; i++) {
+        RTCMmessage_t const* message = rtcm->msgs.list.array[i];
+        CHECK_EQUAL_C_INT(size, message->size);
+        for (size_t j = 0; j < size; j++) {
+            CHECK_EQUAL_C_INT(i + 1, message->buf[j]);
+        }
+    }
+}
+
+
+TEST_C(borrow, aligned_and_arena)
+{
+    uint8_t encoded[4096];
+    size_t const len = encodeRtcm(500, encoded, sizeof(encoded));
+    uint8_t memory[2048];
+    asn_borrow_arena_t arena = { memory, sizeof(memory), 0 };
+
+    MessageFrame_t* mf = calloc(1, sizeof(MessageFrame_t));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_decode_messageframe_borrowed(encoded, len, mf, 64, &arena));
+    checkMessages(mf, 500);
+
+    int aligned = 0;
+    RTCMmessageList_t const* msgs = &mf->value.choice.RTCMcorrections.msgs;
+    for (int i = 0; i < MESSAGES; i++) {
+        RTCMmessage_t const* message = msgs->list.array[i];
+        CHECK_C(OCTET_STRING_is_borrowed(message));
+        if (inside(message->buf, encoded, len)) {
+            aligned++;
+        } else {
+            CHECK_C(inside(message->buf, memory, arena.used));
+        }
+    }
+    CHECK_EQUAL_C_INT(1, aligned);
+    CHECK_EQUAL_C_INT((MESSAGES - 1) * 500, arena.used);
+
+    // the same octets again
+    uint8_t reencoded[4096];
+    size_t relen = sizeof(reencoded);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, reencoded, &relen));
+    CHECK_EQUAL_C_INT(len, relen);
+    CHECK_C(memcmp(encoded, reencoded, len) == 0);
+
+    // leaves encoded and the arena alone
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
+
+
+TEST_C(borrow, arena_full)
+{
+    uint8_t encoded[4096];
+    size_t const len = encodeRtcm(300, encoded, sizeof(encoded));
+    uint8_t memory[700];
+    asn_borrow_arena_t arena = { memory, sizeof(memory), 0 };
+
+    MessageFrame_t* mf = calloc(1, sizeof(MessageFrame_t));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_decode_messageframe_borrowed(encoded, len, mf, 1, &arena));
+    checkMessages(mf, 300);
+
+    // two fit, the third unaligned one is allocated
+    int borrowed = 0;
+    RTCMmessageList_t const* msgs = &mf->value.choice.RTCMcorrections.msgs;
+    for (int i = 0; i < MESSAGES; i++) {
+        RTCMmessage_t const* message = msgs->list.array[i];
+        if (OCTET_STRING_is_borrowed(message)) {
+            borrowed++;
+        } else {
+            CHECK_C(!inside(message->buf, encoded, len));
+            CHECK_C(!inside(message->buf, memory, sizeof(memory)));
+            CHECK_EQUAL_C_INT(0, message->buf[message->size]);
+        }
+    }
+    CHECK_EQUAL_C_INT(3, borrowed);
+    CHECK_EQUAL_C_INT(600, arena.used);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+
+    // no arena, only the aligned one
+    mf = calloc(1, sizeof(MessageFrame_t));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_decode_messageframe_borrowed(encoded, len, mf, 1, NULL));
+    checkMessages(mf, 300);
+    borrowed = 0;
+    msgs = &mf->value.choice.RTCMcorrections.msgs;
+    for (int i = 0; i < MESSAGES; i++) {
+        borrowed += OCTET_STRING_is_borrowed(msgs->list.array[i]);
+    }
+    CHECK_EQUAL_C_INT(1, borrowed);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
+
+
+TEST_C(borrow, min_size)
+{
+    uint8_t encoded[4096];
+    size_t const len = encodeRtcm(100, encoded, sizeof(encoded));
+    uint8_t memory[1024];
+    asn_borrow_arena_t arena = { memory, sizeof(memory), 0 };
+
+    // too small to borrow, copied as libsm_decode_messageframe does
+    MessageFrame_t* mf = calloc(1, sizeof(MessageFrame_t));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_decode_messageframe_borrowed(encoded, len, mf, 101, &arena));
+    checkMessages(mf, 100);
+    RTCMmessageList_t const* msgs = &mf->value.choice.RTCMcorrections.msgs;
+    for (int i = 0; i < MESSAGES; i++) {
+        CHECK_C(!OCTET_STRING_is_borrowed(msgs->list.array[i]));
+    }
+    CHECK_EQUAL_C_INT(0, arena.used);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+
+    mf = calloc(1, sizeof(MessageFrame_t));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER,
+                      libsm_decode_messageframe_borrowed(encoded, len, mf, 0, &arena));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG,
+                      libsm_decode_messageframe_borrowed(encoded, len, NULL, 1, &arena));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_DECODING,
+                      libsm_decode_messageframe_borrowed(encoded, len / 2, mf, 1, &arena));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
+
+
+TEST_C(borrow, replace_borrowed)
+{
+    uint8_t encoded[4096];
+    size_t const len = encodeRtcm(200, encoded, sizeof(encoded));
+
+    MessageFrame_t* mf = calloc(1, sizeof(MessageFrame_t));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_decode_messageframe_borrowed(encoded, len, mf, 1, NULL));
+    RTCMmessageList_t const* msgs = &mf->value.choice.RTCMcorrections.msgs;
+    RTCMmessage_t* message = NULL;
+    for (int i = 0; i < MESSAGES; i++) {
+        if (OCTET_STRING_is_borrowed(msgs->list.array[i])) {
+            message = msgs->list.array[i];
+        }
+    }
+    CHECK_C(message != NULL);
+
+    // owns its octets again, and the decoded buffer is untouched
+    CHECK_EQUAL_C_INT(0, OCTET_STRING_fromBuf(message, "\x2a", 1));
+    CHECK_C(!OCTET_STRING_is_borrowed(message));
+    CHECK_C(!inside(message->buf, encoded, len));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+
+    uint8_t again[4096];
+    CHECK_EQUAL_C_INT(len, encodeRtcm(200, again, sizeof(again)));
+    CHECK_C(memcmp(encoded, again, len) == 0);
+}
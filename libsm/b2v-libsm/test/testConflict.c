@@ -0,0 +1,258 @@
+/*
+ * testConflict.c
+ * Tests for the VRU to vehicle conflict detection
+ *
+ * Did you know? Documentation for how to write more tests is at https://cpputest.github.io/manual.html
+ */
+#include "CppUTest/TestHarness_c.h"
+#include "libsm.h"
+
+#include <math.h>
+#include <string.h>
+
+#define REF_LAT  334150000
+#define REF_LONG -1119260000
+#define EPOCH_MS 1704067200000ULL
+
+static libsm_conflict_event_t events[16];
+static size_t eventCount;
+
+
+static void collect(void* user, libsm_conflict_event_t const* event)
+{
+    (void)user;
+    if (eventCount < sizeof(events) / sizeof(events[0])) {
+        events[eventCount] = *event;
+    }
+    eventCount++;
+}
+
+
+// an actor at east/north meters from the reference, moving at speed m/s towards headingDeg
+static libsm_traj_sample_t actorAt(libsm_traj_source_e source,
+                                   uint32_t id,
+                                   double east,
+                                   double north,
+                                   double speed,
+                                   double headingDeg,
+                                   uint64_t timeMs)
+{
+    double const metersPerUnit = Latitude_m_per_unit;
+    double const cosLat = cos((double)REF_LAT / Latitude_unit_deg * (M_PI / 180.0));
+    libsm_traj_sample_t sample = {
+        .source = source,
+        .id = id,
+        .secMark = (uint16_t)(timeMs % 60000),
+        .lat = REF_LAT + lround(north / metersPerUnit),
+        .Long = REF_LONG + lround(east / (metersPerUnit * cosLat)),
+        .speed = (uint16_t)lround(speed / 0.02),
+        .heading = (uint16_t)lround(headingDeg / 0.0125),
+        .rxTimeMs = timeMs,
+    };
+    return sample;
+}
+
+
+static void setup(libsm_conflict_t* eng, libsm_conflict_config_t const* config)
+{
+    eventCount = 0;
+    memset(events, 0, sizeof(events));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_conflict_init(eng, config, collect, NULL));
+}
+
+
+TEST_C(conflict, invalid_args)
+{
+    libsm_conflict_t eng;
+    libsm_conflict_config_t config;
+    libsm_traj_sample_t sample = actorAt(LIBSM_TRAJ_SOURCE_PSM, 1, 0, 0, 0, 0, EPOCH_MS);
+
+    libsm_conflict_default_config(&config, REF_LAT, REF_LONG);
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_conflict_init(NULL, &config, collect, NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_conflict_init(&eng, NULL, collect, NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_conflict_init(&eng, &config, NULL, NULL));
+    config.cellSizeM = 0;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER,
+                      libsm_conflict_init(&eng, &config, collect, NULL));
+
+    libsm_conflict_default_config(&config, REF_LAT, REF_LONG);
+    setup(&eng, &config);
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_conflict_update(NULL, &sample));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_conflict_update(&eng, NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_conflict_step(NULL, EPOCH_MS));
+    libsm_conflict_free(&eng);
+}
+
+
+TEST_C(conflict, pair_head_on)
+{
+    libsm_conflict_config_t config;
+    double const standing[4] = { 0, 0, 0, 0 };
+    double const approaching[4] = { 0, 20, 0, -10 };
+    double const leaving[4] = { 0, 20, 0, 10 };
+    double ttc;
+    double pet;
+
+    libsm_conflict_default_config(&config, REF_LAT, REF_LONG);
+    libsm_conflict_pair(&config, standing, approaching, &ttc, &pet);
+    CHECK_EQUAL_C_REAL((20 - config.collisionRadiusM) / 10, ttc, 1e-9);
+    CHECK_C(pet < 0);
+
+    libsm_conflict_pair(&config, standing, leaving, &ttc, &pet);
+    CHECK_C(ttc < 0);
+    CHECK_C(pet < 0);
+}
+
+
+TEST_C(conflict, pair_crossing)
+{
+    libsm_conflict_config_t config;
+    // pedestrian reaches the crossing point in 2 s, the vehicle in 3 s
+    double const walking[4] = { 0, -3, 0, 1.5 };
+    double const driving[4] = { -30, 0, 10, 0 };
+    double ttc;
+    double pet;
+
+    libsm_conflict_default_config(&config, REF_LAT, REF_LONG);
+    libsm_conflict_pair(&config, walking, driving, &ttc, &pet);
+    CHECK_EQUAL_C_REAL(1.0, pet, 1e-9);
+    // they pass just inside the collision radius, about when the car gets there
+    CHECK_EQUAL_C_REAL(3.0, ttc, 0.5);
+
+    // and it works both ways round
+    libsm_conflict_pair(&config, driving, walking, &ttc, &pet);
+    CHECK_EQUAL_C_REAL(1.0, pet, 1e-9);
+}
+
+
+TEST_C(conflict, engine_reports_nearby_pairs)
+{
+    libsm_conflict_t eng;
+    libsm_conflict_config_t config;
+    libsm_traj_sample_t sample;
+
+    libsm_conflict_default_config(&config, REF_LAT, REF_LONG);
+    setup(&eng, &config);
+
+    // pedestrian walking north towards the crosswalk, a car coming from the west
+    sample = actorAt(LIBSM_TRAJ_SOURCE_PSM, 0x10, 0, -3, 1.5, 0, EPOCH_MS);
+    libsm_conflict_update(&eng, &sample);
+    sample = actorAt(LIBSM_TRAJ_SOURCE_BSM, 0x20, -30, 0, 10, 90, EPOCH_MS);
+    libsm_conflict_update(&eng, &sample);
+    // a car far away, never paired
+    sample = actorAt(LIBSM_TRAJ_SOURCE_BSM, 0x30, 400, 400, 10, 270, EPOCH_MS);
+    libsm_conflict_update(&eng, &sample);
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_conflict_step(&eng, EPOCH_MS));
+    CHECK_EQUAL_C_INT(1, (int)eventCount);
+    CHECK_EQUAL_C_ULONG(1, eng.stats.pairsChecked);
+    CHECK_EQUAL_C_UINT(0x10, events[0].vruId);
+    CHECK_EQUAL_C_UINT(0x20, events[0].vehicleId);
+    CHECK_EQUAL_C_REAL(1.0, events[0].petS, 0.05);
+    CHECK_EQUAL_C_REAL(30.1, events[0].distanceM, 0.2);
+
+    // extrapolated 100 ms on, the same pair is not reported again yet
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_conflict_step(&eng, EPOCH_MS + 100));
+    CHECK_EQUAL_C_INT(1, (int)eventCount);
+    CHECK_EQUAL_C_ULONG(2, eng.stats.pairsChecked);
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_conflict_step(&eng, EPOCH_MS + 1000));
+    CHECK_EQUAL_C_INT(2, (int)eventCount);
+    CHECK_EQUAL_C_REAL(20.0, -events[1].vehicleEast, 0.2);
+
+    // nobody has reported for a while
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_conflict_step(&eng, EPOCH_MS + 5000));
+    CHECK_EQUAL_C_ULONG(3, eng.stats.expired);
+    libsm_conflict_free(&eng);
+}
+
+
+TEST_C(conflict, repeat_is_per_pair)
+{
+    libsm_conflict_t eng;
+    libsm_conflict_config_t config;
+    libsm_traj_sample_t sample;
+
+    libsm_conflict_default_config(&config, REF_LAT, REF_LONG);
+    setup(&eng, &config);
+
+    // one pedestrian, cars coming from the west and from the east
+    sample = actorAt(LIBSM_TRAJ_SOURCE_PSM, 0x10, 0, -3, 1.5, 0, EPOCH_MS);
+    libsm_conflict_update(&eng, &sample);
+    sample = actorAt(LIBSM_TRAJ_SOURCE_BSM, 0x20, -30, 0, 10, 90, EPOCH_MS);
+    libsm_conflict_update(&eng, &sample);
+    sample = actorAt(LIBSM_TRAJ_SOURCE_BSM, 0x21, 30, 1, 10, 270, EPOCH_MS);
+    libsm_conflict_update(&eng, &sample);
+
+    for (uint64_t t = 0; t < config.repeatMs; t += 100) {
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_conflict_step(&eng, EPOCH_MS + t));
+    }
+    CHECK_EQUAL_C_ULONG(20, eng.stats.pairsChecked);
+    CHECK_EQUAL_C_INT(2, (int)eventCount);
+    CHECK_EQUAL_C_UINT(0x10, events[0].vruId);
+    CHECK_EQUAL_C_UINT(0x10, events[1].vruId);
+    CHECK_C(events[0].vehicleId != events[1].vehicleId);
+
+    // both pairs are reported again once repeatMs has passed
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_conflict_step(&eng, EPOCH_MS + config.repeatMs));
+    CHECK_EQUAL_C_INT(4, (int)eventCount);
+    CHECK_C(events[2].vehicleId != events[3].vehicleId);
+    libsm_conflict_free(&eng);
+}
+
+
+TEST_C(conflict, budget_resumes_next_step)
+{
+    libsm_conflict_t eng;
+    libsm_conflict_config_t config;
+    libsm_traj_sample_t sample;
+
+    libsm_conflict_default_config(&config, REF_LAT, REF_LONG);
+    config.maxPairChecks = 1;
+    setup(&eng, &config);
+
+    sample = actorAt(LIBSM_TRAJ_SOURCE_PSM, 0x10, 0, -3, 1.5, 0, EPOCH_MS);
+    libsm_conflict_update(&eng, &sample);
+    sample = actorAt(LIBSM_TRAJ_SOURCE_PSM, 0x11, 0, 3, 1.5, 180, EPOCH_MS);
+    libsm_conflict_update(&eng, &sample);
+    sample = actorAt(LIBSM_TRAJ_SOURCE_BSM, 0x20, -30, 0, 10, 90, EPOCH_MS);
+    libsm_conflict_update(&eng, &sample);
+
+    libsm_conflict_step(&eng, EPOCH_MS);
+    CHECK_EQUAL_C_INT(1, (int)eventCount);
+    CHECK_EQUAL_C_ULONG(1, eng.stats.budgetExhausted);
+    libsm_conflict_step(&eng, EPOCH_MS);
+    CHECK_EQUAL_C_INT(2, (int)eventCount);
+    CHECK_C(events[0].vruId != events[1].vruId);
+    libsm_conflict_free(&eng);
+}
+
+
+TEST_C(conflict, bsm_and_psm_ids_are_separate)
+{
+    libsm_conflict_t eng;
+    libsm_conflict_config_t config;
+    libsm_traj_sample_t sample;
+
+    libsm_conflict_default_config(&config, REF_LAT, REF_LONG);
+    config.maxActors = 2;
+    setup(&eng, &config);
+
+    sample = actorAt(LIBSM_TRAJ_SOURCE_PSM, 0x10, 0, -3, 1.5, 0, EPOCH_MS);
+    libsm_conflict_update(&eng, &sample);
+    sample = actorAt(LIBSM_TRAJ_SOURCE_BSM, 0x10, -30, 0, 10, 90, EPOCH_MS);
+    libsm_conflict_update(&eng, &sample);
+    sample = actorAt(LIBSM_TRAJ_SOURCE_BSM, 0x11, -30, 0, 10, 90, EPOCH_MS);
+    libsm_conflict_update(&eng, &sample);
+    CHECK_EQUAL_C_ULONG(1, eng.stats.dropped);
+
+    // an older report does not replace a newer one
+    sample = actorAt(LIBSM_TRAJ_SOURCE_BSM, 0x10, 500, 500, 10, 90, EPOCH_MS - 100);
+    libsm_conflict_update(&eng, &sample);
+
+    libsm_conflict_step(&eng, EPOCH_MS);
+    CHECK_EQUAL_C_INT(1, (int)eventCount);
+    CHECK_EQUAL_C_UINT(0x10, events[0].vruId);
+    CHECK_EQUAL_C_UINT(0x10, events[0].vehicleId);
+    libsm_conflict_free(&eng);
+}
@@ -0,0 +1,157 @@
+/*
+ * testCorpus.c
+ * Check synthetic corpora are reproducible, valid and shaped as configured
+ *
+ * Did you know? Documentation for how to write more tests is at https://cpputest.github.io/manual.html
+ */
+#include "CppUTest/TestHarness_c.h"
+#include "libsm.h"
+
+#include <string.h>
+
+#define CORPUS_SIZE 300
+#define SLOT 4096
+
+
+TEST_C(corpus, invalid_args)
+{
+    libsm_corpus_config_t config;
+    MessageFrame_t* mf = NULL;
+    uint8_t encoded[SLOT];
+    size_t len = sizeof(encoded);
+
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_corpus_default_config(NULL));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_corpus_default_config(&config));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_corpus_build(NULL, 0, &mf));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_corpus_build(&config, 0, NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_corpus_message(&config, 0, NULL, &len));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_corpus_write_record(NULL, encoded, 1));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_corpus_read_record(NULL, encoded, &len));
+
+    config.bsmWeight = config.psmWeight = config.spatWeight = config.timWeight = 0;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_corpus_build(&config, 0, &mf));
+    libsm_corpus_default_config(&config);
+    config.pathHistoryMax = 24;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_corpus_build(&config, 0, &mf));
+    libsm_corpus_default_config(&config);
+    config.intersectionsMin = 5;
+    config.intersectionsMax = 4;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_corpus_build(&config, 0, &mf));
+    CHECK_C(mf == NULL);
+}
+
+
+// Every message decodes, and building it again, alone, gives the same bytes
+TEST_C(corpus, reproducible_and_valid)
+{
+    libsm_corpus_config_t config;
+    libsm_corpus_default_config(&config);
+    config.seed = 2040;
+    int kinds[4] = { 0 };
+
+    for (uint64_t i = 0; i < CORPUS_SIZE; i++) {
+        uint8_t encoded[SLOT];
+        size_t len = sizeof(encoded);
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_corpus_message(&config, i, encoded, &len));
+
+        MessageFrame_t mf = { 0 };
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_decode_messageframe(encoded, len, &mf));
+        kinds[0] += libsm_mf_has_bsm(&mf);
+        kinds[1] += libsm_mf_has_psm(&mf);
+        kinds[2] += libsm_mf_has_spat(&mf);
+        kinds[3] += libsm_mf_has_tim(&mf);
+        ASN_STRUCT_RESET(asn_DEF_MessageFrame, &mf);
+
+        uint8_t again[SLOT];
+        size_t againLen = sizeof(again);
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_corpus_message(&config, i, again, &againLen));
+        CHECK_EQUAL_C_ULONG(len, againLen);
+        CHECK_C(memcmp(encoded, again, len) == 0);
+    }
+    CHECK_EQUAL_C_INT(CORPUS_SIZE, kinds[0] + kinds[1] + kinds[2] + kinds[3]);
+    CHECK_C(kinds[0] > kinds[1] && kinds[1] > kinds[3] && kinds[3] > 0);
+
+    // another seed, another corpus
+    uint8_t first[SLOT];
+    uint8_t other[SLOT];
+    size_t firstLen = sizeof(first);
+    size_t otherLen = sizeof(other);
+    libsm_corpus_message(&config, 0, first, &firstLen);
+    config.seed++;
+    libsm_corpus_message(&config, 0, other, &otherLen);
+    CHECK_C(firstLen != otherLen || memcmp(first, other, firstLen) != 0);
+}
+
+
+TEST_C(corpus, configured_shapes)
+{
+    libsm_corpus_config_t config;
+    libsm_corpus_default_config(&config);
+    config.psmWeight = config.timWeight = 0;
+    config.partIIPercent = 100;
+    config.pathHistoryMin = config.pathHistoryMax = 7;
+    config.intersectionsMin = config.intersectionsMax = 3;
+
+    for (uint64_t i = 0; i < CORPUS_SIZE / 4; i++) {
+        MessageFrame_t* mf;
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_corpus_build(&config, i, &mf));
+        if (libsm_mf_has_bsm(mf)) {
+            VehicleSafetyExtensions_t* vse = libsm_get_partII_elem(
+                    libsm_get_bsm(mf),
+                    BSMpartIIExtension__partII_Value_PR_VehicleSafetyExtensions);
+            CHECK_C(vse != NULL && vse->pathHistory != NULL && vse->pathPrediction != NULL);
+            CHECK_EQUAL_C_INT(7, vse->pathHistory->crumbData.list.count);
+        } else {
+            CHECK_C(libsm_mf_has_spat(mf));
+            CHECK_EQUAL_C_INT(3, libsm_get_spat(mf)->intersections.list.count);
+        }
+        ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    }
+}
+
+
+TEST_C(corpus, records_round_trip)
+{
+    libsm_corpus_config_t config;
+    libsm_corpus_default_config(&config);
+    FILE* file = tmpfile();
+    CHECK_C(file != NULL);
+
+    for (uint64_t i = 0; i < 20; i++) {
+        uint8_t encoded[SLOT];
+        size_t len = sizeof(encoded);
+        libsm_corpus_message(&config, i, encoded, &len);
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_corpus_write_record(file, encoded, len));
+    }
+    rewind(file);
+
+    for (uint64_t i = 0; i < 20; i++) {
+        uint8_t expected[SLOT];
+        size_t expectedLen = sizeof(expected);
+        libsm_corpus_message(&config, i, expected, &expectedLen);
+
+        uint8_t record[SLOT];
+        size_t len = i == 3 ? 2 : sizeof(record);
+        if (i == 3) {
+            // too small, the record is skipped and its size reported
+            CHECK_EQUAL_C_INT(LIBSM_FAIL_DECODING_BUFF_SIZE,
+                              libsm_corpus_read_record(file, record, &len));
+            CHECK_EQUAL_C_ULONG(expectedLen, len);
+            continue;
+        }
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_corpus_read_record(file, record, &len));
+        CHECK_EQUAL_C_ULONG(expectedLen, len);
+        CHECK_C(memcmp(expected, record, len) == 0);
+    }
+    size_t len = SLOT;
+    uint8_t record[SLOT];
+    CHECK_EQUAL_C_INT(LIBSM_FAIL, libsm_corpus_read_record(file, record, &len));
+    fclose(file);
+
+    // a record cut short
+    file = tmpfile();
+    CHECK_C(fwrite("\x00\x00\x00\x10\x01", 1, 5, file) == 5);
+    rewind(file);
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_DECODING, libsm_corpus_read_record(file, record, &len));
+    fclose(file);
+}
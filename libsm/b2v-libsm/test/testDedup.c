@@ -0,0 +1,216 @@
+/*
+ * testDedup.c
+ * Tests for the streaming duplicate detector
+ *
+ * Did you know? Documentation for how to write more tests is at https://cpputest.github.io/manual.html
+ */
+#include "CppUTest/TestHarness_c.h"
+#include "libsm.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static uint8_t const bsm_nopartII[]
+        = { 0x00, 0x14, 0x25, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xA4, 0xE9, 0x00,
+            0xEB, 0x49, 0xD2, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x80,
+            0xFD, 0xFA, 0x1F, 0xA1, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00 };
+static uint8_t const psm[] = { 0x00, 0x20, 0x1A, 0x00, 0x00, 0x04, 0x00, 0x14, 0x15, 0x09,
+                               0x09, 0x09, 0x08, 0x4E, 0xF7, 0xF7, 0x91, 0x39, 0xBA, 0x86,
+                               0x22, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x50, 0x10, 0xE0 };
+
+
+static uint64_t idOf(TemporaryID_t const* id)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < id->size; i++) {
+        value = (value << 8) | id->buf[i];
+    }
+    return value;
+}
+
+
+static uint64_t decodedKey(uint8_t const* encoded, size_t len)
+{
+    MessageFrame_t* mf = calloc(1, sizeof(MessageFrame_t));
+    uint64_t key = 0;
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_decode_messageframe(encoded, len, mf));
+    if (mf->value.present == MessageFrame__value_PR_BasicSafetyMessage) {
+        BSMcoreData_t const* core = &mf->value.choice.BasicSafetyMessage.coreData;
+        key = (1ULL << 63) | (idOf(&core->id) << 23) | ((uint64_t)core->msgCnt << 16)
+              | (uint64_t)core->secMark;
+    } else {
+        PersonalSafetyMessage_t const* p = &mf->value.choice.PersonalSafetyMessage;
+        key = (1ULL << 63) | (1ULL << 62) | (idOf(&p->id) << 23) | ((uint64_t)p->msgCnt << 16)
+              | (uint64_t)p->secMark;
+    }
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    return key;
+}
+
+
+TEST_C(dedup, null_args)
+{
+    libsm_dedup_t dedup;
+    libsm_dedup_result_t result;
+    uint64_t key;
+
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_dedup_init(NULL, 16, 100));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_dedup_init(&dedup, 0, 100));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_dedup_init(&dedup, 16, 0));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_dedup_init(&dedup, 16, 100));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_dedup_key_from_uper(NULL, 1, &key));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_dedup_key_from_uper(psm, sizeof(psm), NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_dedup_check(NULL, psm, sizeof(psm), 0, &result));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_dedup_check(&dedup, NULL, 1, 0, &result));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_dedup_check(&dedup, psm, sizeof(psm), 0, NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_DECODING_BUFF_SIZE, libsm_dedup_check(&dedup, psm, 0, 0, &result));
+    libsm_dedup_free(&dedup);
+    libsm_dedup_free(NULL);
+}
+
+
+TEST_C(dedup, key_matches_decoded_fields)
+{
+    uint64_t key;
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_dedup_key_from_uper(bsm_nopartII, sizeof(bsm_nopartII), &key));
+    CHECK_EQUAL_C_ULONGLONG(decodedKey(bsm_nopartII, sizeof(bsm_nopartII)), key);
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_dedup_key_from_uper(psm, sizeof(psm), &key));
+    CHECK_EQUAL_C_ULONGLONG(decodedKey(psm, sizeof(psm)), key);
+
+    // truncated before secMark/msgCnt/id
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_DECODING, libsm_dedup_key_from_uper(psm, 8, &key));
+}
+
+
+TEST_C(dedup, first_seen_then_repeats)
+{
+    libsm_dedup_t dedup;
+    libsm_dedup_result_t result;
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_dedup_init(&dedup, 64, 1000));
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_dedup_check(&dedup, psm, sizeof(psm), 5000, &result));
+    CHECK_EQUAL_C_INT(LIBSM_DEDUP_FIRST_SEEN, result.status);
+    CHECK_EQUAL_C_UINT(0, result.copies);
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_dedup_check(&dedup, psm, sizeof(psm), 5030, &result));
+    CHECK_EQUAL_C_INT(LIBSM_DEDUP_REPEAT, result.status);
+    CHECK_EQUAL_C_UINT(1, result.copies);
+    CHECK_EQUAL_C_ULONGLONG(30, result.sinceFirstMs);
+    CHECK_EQUAL_C_ULONGLONG(30, result.sincePreviousMs);
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_dedup_check(&dedup, psm, sizeof(psm), 5100, &result));
+    CHECK_EQUAL_C_INT(LIBSM_DEDUP_REPEAT, result.status);
+    CHECK_EQUAL_C_UINT(2, result.copies);
+    CHECK_EQUAL_C_ULONGLONG(100, result.sinceFirstMs);
+    CHECK_EQUAL_C_ULONGLONG(70, result.sincePreviousMs);
+
+    // a different message is not a repeat
+    CHECK_EQUAL_C_INT(LIBSM_OK,
+                      libsm_dedup_check(&dedup, bsm_nopartII, sizeof(bsm_nopartII), 5100, &result));
+    CHECK_EQUAL_C_INT(LIBSM_DEDUP_FIRST_SEEN, result.status);
+
+    libsm_dedup_free(&dedup);
+}
+
+
+TEST_C(dedup, same_key_different_content_conflicts)
+{
+    libsm_dedup_t dedup;
+    libsm_dedup_result_t result;
+    uint8_t changed[sizeof(psm)];
+
+    // change the last byte, well past the key fields
+    memcpy(changed, psm, sizeof(psm));
+    changed[sizeof(changed) - 1] ^= 0x20;
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_dedup_init(&dedup, 64, 1000));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_dedup_check(&dedup, psm, sizeof(psm), 0, &result));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_dedup_check(&dedup, changed, sizeof(changed), 10, &result));
+    CHECK_EQUAL_C_INT(LIBSM_DEDUP_CONFLICT, result.status);
+    CHECK_EQUAL_C_UINT(0, result.copies);
+
+    // the original is still remembered
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_dedup_check(&dedup, psm, sizeof(psm), 20, &result));
+    CHECK_EQUAL_C_INT(LIBSM_DEDUP_REPEAT, result.status);
+    CHECK_EQUAL_C_UINT(1, result.copies);
+
+    libsm_dedup_free(&dedup);
+}
+
+
+TEST_C(dedup, window_expiry)
+{
+    libsm_dedup_t dedup;
+    libsm_dedup_result_t result;
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_dedup_init(&dedup, 64, 1000));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_dedup_check(&dedup, psm, sizeof(psm), 0, &result));
+
+    // carried into the next generation
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_dedup_check(&dedup, psm, sizeof(psm), 1500, &result));
+    CHECK_EQUAL_C_INT(LIBSM_DEDUP_REPEAT, result.status);
+    CHECK_EQUAL_C_ULONGLONG(1500, result.sinceFirstMs);
+
+    // long gone after more than two windows of silence
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_dedup_check(&dedup, psm, sizeof(psm), 4000, &result));
+    CHECK_EQUAL_C_INT(LIBSM_DEDUP_FIRST_SEEN, result.status);
+
+    libsm_dedup_free(&dedup);
+}
+
+
+TEST_C(dedup, other_messages_use_content_hash)
+{
+    libsm_dedup_t dedup;
+    libsm_dedup_result_t result;
+    uint8_t const other[] = { 0x00, 0x13, 0x04, 0xDE, 0xAD, 0xBE, 0xEF };
+    uint8_t otherChanged[sizeof(other)];
+    uint64_t key;
+
+    memcpy(otherChanged, other, sizeof(other));
+    otherChanged[6] = 0xEE;
+
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_DECODING, libsm_dedup_key_from_uper(other, sizeof(other), &key));
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_dedup_init(&dedup, 64, 1000));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_dedup_check(&dedup, other, sizeof(other), 0, &result));
+    CHECK_EQUAL_C_INT(LIBSM_DEDUP_FIRST_SEEN, result.status);
+    CHECK_C(result.key != 0);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_dedup_check(&dedup, other, sizeof(other), 5, &result));
+    CHECK_EQUAL_C_INT(LIBSM_DEDUP_REPEAT, result.status);
+    CHECK_EQUAL_C_INT(LIBSM_OK,
+                      libsm_dedup_check(&dedup, otherChanged, sizeof(otherChanged), 5, &result));
+    CHECK_EQUAL_C_INT(LIBSM_DEDUP_FIRST_SEEN, result.status);
+
+    libsm_dedup_free(&dedup);
+}
+
+
+TEST_C(dedup, capacity_is_bounded)
+{
+    libsm_dedup_t dedup;
+    libsm_dedup_result_t result;
+    uint8_t frame[sizeof(bsm_nopartII)];
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_dedup_init(&dedup, 10, 1000));
+    CHECK_EQUAL_C_ULONG(16, dedup.capacity);
+
+    // far more distinct messages than fit, every one of them is new
+    memcpy(frame, bsm_nopartII, sizeof(frame));
+    for (uint32_t i = 0; i < 1000; i++) {
+        frame[5] = (uint8_t)i;
+        frame[6] = (uint8_t)(i >> 8);
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_dedup_check(&dedup, frame, sizeof(frame), i, &result));
+        CHECK_EQUAL_C_INT(LIBSM_DEDUP_FIRST_SEEN, result.status);
+    }
+
+    // and the most recent one is still there
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_dedup_check(&dedup, frame, sizeof(frame), 999, &result));
+    CHECK_EQUAL_C_INT(LIBSM_DEDUP_REPEAT, result.status);
+
+    libsm_dedup_free(&dedup);
+}
@@ -0,0 +1,151 @@
+/*
+ * testEnum.c
+ * Tests for the names of ENUMERATED and named INTEGER values, and their JER
+ *
+ * Did you know? Documentation for how to write more tests is at https://cpputest.github.io/manual.html
+ */
+#include "CppUTest/TestHarness_c.h"
+#include "libsm.h"
+
+#include "AntiLockBrakeStatus.h"
+#include "LightbarInUse.h"
+#include "MovementPhaseState.h"
+#include "RequestSubRole.h"
+#include "TransmissionState.h"
+#include "jer_decoder.h"
+#include "jer_encoder.h"
+
+#include <string.h>
+
+
+static int collectJer(void const* buffer, size_t size, void* key)
+{
+    char* text = key;
+    size_t const len = strlen(text);
+    memcpy(text + len, buffer, size);
+    text[len + size] = '\0';
+    return 0;
+}
+
+
+TEST_C(enum_names, every_enumerated_name)
+{
+    asn_TYPE_descriptor_t const* types[] = {
+        &asn_DEF_AntiLockBrakeStatus, &asn_DEF_LightbarInUse, &asn_DEF_MovementPhaseState,
+        &asn_DEF_PersonalDeviceUserType, &asn_DEF_RequestSubRole, &asn_DEF_TransmissionState,
+    };
+    for (size_t t = 0; t < sizeof(types) / sizeof(types[0]); t++) {
+        asn_INTEGER_specifics_t const* specs = types[t]->specifics;
+        CHECK_C(specs->map_count > 0);
+        for (unsigned i = 0; i < specs->map_count; i++) {
+            asn_INTEGER_enum_map_t const* map = &specs->value2enum[i];
+            libsm_enum_t const* e = libsm_enum_from_name(types[t], map->enum_name, map->enum_len);
+            CHECK_C(e != NULL);
+            CHECK_EQUAL_C_LONG(map->nat_value, e->value);
+            CHECK_EQUAL_C_STRING(types[t]->name, e->type);
+        }
+    }
+}
+
+
+TEST_C(enum_names, spellings)
+{
+    libsm_enum_t const* e = libsm_enum_from_name(&asn_DEF_MovementPhaseState, "stop-And-Remain", 15);
+    CHECK_C(e != NULL);
+    CHECK_EQUAL_C_LONG(MovementPhaseState_stop_And_Remain, e->value);
+    CHECK_C(libsm_enum_from_name(&asn_DEF_MovementPhaseState, "stop_And_Remain", 15) == e);
+
+    // case matters, the name is of the type, and all of it
+    CHECK_C(libsm_enum_from_name(&asn_DEF_MovementPhaseState, "stop-and-remain", 15) == NULL);
+    CHECK_C(libsm_enum_from_name(&asn_DEF_TransmissionState, "stop-And-Remain", 15) == NULL);
+    CHECK_C(libsm_enum_from_name(&asn_DEF_TransmissionState, "parking", 4) != NULL);
+    CHECK_C(libsm_enum_from_name(&asn_DEF_TransmissionState, "parking", 7) == NULL);
+    CHECK_C(libsm_enum_from_name(&asn_DEF_TransmissionState, "par", 3) == NULL);
+    CHECK_C(libsm_enum_from_name(&asn_DEF_TransmissionState, "", 0) == NULL);
+    CHECK_C(libsm_enum_from_name(&asn_DEF_TransmissionState, NULL, 4) == NULL);
+    CHECK_C(libsm_enum_from_name(NULL, "park", 4) == NULL);
+    // no names
+    CHECK_C(libsm_enum_from_name(&asn_DEF_MessageFrame, "park", 4) == NULL);
+}
+
+
+TEST_C(enum_names, basic_vehicle_class)
+{
+    // every class the other way round
+    size_t named = 0;
+    for (BasicVehicleClass_t type = 0; type <= 255; type++) {
+        char const* name = libsm_str_basic_vehicle_class(type);
+        if (strcmp(name, "unknownVehicleClass") == 0 && type != 0) {
+            continue;
+        }
+        named++;
+        char spelling[64];
+        strcpy(spelling, name);
+        CHECK_EQUAL_C_LONG(type, libsm_basic_vehicle_class_from_str(spelling));
+        for (char* c = spelling; *c != '\0'; c++) {
+            if (*c == '-') {
+                *c = '_';
+            }
+        }
+        CHECK_EQUAL_C_LONG(type, libsm_basic_vehicle_class_from_str(spelling));
+    }
+    CHECK_EQUAL_C_INT(56, named);
+
+    CHECK_EQUAL_C_LONG(BasicVehicleClass_unknownVehicleClass,
+                       libsm_basic_vehicle_class_from_str("truck"));
+    CHECK_EQUAL_C_LONG(BasicVehicleClass_unknownVehicleClass,
+                       libsm_basic_vehicle_class_from_str(""));
+}
+
+
+TEST_C(enum_names, personal_device_user_type)
+{
+    CHECK_EQUAL_C_LONG(PersonalDeviceUserType_aPEDESTRIAN,
+                       libsm_personal_device_user_type_from_str("aPEDESTRIAN"));
+    CHECK_EQUAL_C_LONG(PersonalDeviceUserType_aPEDESTRIAN,
+                       libsm_personal_device_user_type_from_str("pedestrian"));
+    CHECK_EQUAL_C_LONG(PersonalDeviceUserType_aPEDALCYCLIST,
+                       libsm_personal_device_user_type_from_str("pedalcyclist"));
+    CHECK_EQUAL_C_LONG(PersonalDeviceUserType_aPUBLICSAFETYWORKER,
+                       libsm_personal_device_user_type_from_str("public safety worker"));
+    CHECK_EQUAL_C_LONG(PersonalDeviceUserType_anANIMAL,
+                       libsm_personal_device_user_type_from_str("animal"));
+    CHECK_EQUAL_C_LONG(PersonalDeviceUserType_unavailable,
+                       libsm_personal_device_user_type_from_str("UNAVAILABLE"));
+    CHECK_EQUAL_C_LONG(PersonalDeviceUserType_unavailable,
+                       libsm_personal_device_user_type_from_str("driver"));
+}
+
+
+TEST_C(enum_names, jer_round_trip)
+{
+    char const* names[] = { "\"neutral\"", "\"park\"", "\"reverseGears\"", "\"unavailable\"" };
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        TransmissionState_t* state = NULL;
+        asn_dec_rval_t const dec
+                = jer_decode(NULL, &asn_DEF_TransmissionState, (void**)&state, names[i],
+                             strlen(names[i]));
+        CHECK_EQUAL_C_INT(RC_OK, dec.code);
+        CHECK_EQUAL_C_INT(strlen(names[i]), dec.consumed);
+
+        char text[32] = "";
+        asn_enc_rval_t const enc
+                = jer_encode(&asn_DEF_TransmissionState, state, JER_F_MINIFIED, collectJer, text);
+        CHECK_EQUAL_C_INT(strlen(names[i]), enc.encoded);
+        CHECK_EQUAL_C_STRING(names[i], text);
+        ASN_STRUCT_FREE(asn_DEF_TransmissionState, state);
+    }
+
+    TransmissionState_t* state = NULL;
+    asn_dec_rval_t const dec
+            = jer_decode(NULL, &asn_DEF_TransmissionState, (void**)&state, "\"parked\"", 8);
+    CHECK_C(dec.code != RC_OK);
+    ASN_STRUCT_FREE(asn_DEF_TransmissionState, state);
+
+    TransmissionState_t const unknown = 9;
+    char text[32] = "";
+    CHECK_EQUAL_C_INT(
+            -1,
+            jer_encode(&asn_DEF_TransmissionState, &unknown, JER_F_MINIFIED, collectJer, text)
+                    .encoded);
+}
@@ -0,0 +1,227 @@
+/*
+ * testGeohash.c
+ * Tests for the geohash conversions
+ *
+ * Did you know? Documentation for how to write more tests is at https://cpputest.github.io/manual.html
+ */
+#include "CppUTest/TestHarness_c.h"
+#include "libsm.h"
+
+#include <string.h>
+
+
+// the textbook bisection, one bit at a time in degrees
+static uint64_t referenceGeohash(Latitude_t lat, Longitude_t Long, unsigned precision)
+{
+    double latRange[2] = { -90.0, 90.0 };
+    double longRange[2] = { -180.0, 180.0 };
+    double const latDeg = (double)lat / Latitude_unit_deg;
+    double const longDeg = (double)Long / Latitude_unit_deg;
+    uint64_t hash = 0;
+
+    for (unsigned bit = 0; bit < 5 * precision; bit++) {
+        double* range = (bit % 2 == 0) ? longRange : latRange;
+        double const value = (bit % 2 == 0) ? longDeg : latDeg;
+        double const mid = (range[0] + range[1]) / 2;
+
+        hash <<= 1;
+        if (value >= mid) {
+            hash |= 1;
+            range[0] = mid;
+        } else {
+            range[1] = mid;
+        }
+    }
+    return hash;
+}
+
+
+static uint32_t nextRandom(uint32_t* state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+
+TEST_C(geohash, invalid_args)
+{
+    uint64_t hash;
+    unsigned precision;
+    libsm_geohash_box_t box;
+    char text[LIBSM_GEOHASH_MAX_PRECISION + 1];
+
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_geohash_encode(0, 0, 5, NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_geohash_encode(0, 0, 0, &hash));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_geohash_encode(0, 0, 13, &hash));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_CONSTRAINT,
+                      libsm_geohash_encode(Latitude_unavailable, 0, 5, &hash));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_CONSTRAINT,
+                      libsm_geohash_encode(0, Longitude_unavailable, 5, &hash));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_geohash_encode_batch(NULL, NULL, 0, 5, &hash));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_geohash_decode(0, 5, NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_geohash_decode(0, 0, &box));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_geohash_to_string(0, 5, NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_geohash_to_string(0, 13, text));
+
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_geohash_from_string(NULL, &hash, &precision));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER,
+                      libsm_geohash_from_string("", &hash, &precision));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER,
+                      libsm_geohash_from_string("9t9pa", &hash, &precision));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER,
+                      libsm_geohash_from_string("0123456789bcd", &hash, &precision));
+}
+
+
+TEST_C(geohash, known_points)
+{
+    uint64_t hash;
+    unsigned precision;
+    char text[LIBSM_GEOHASH_MAX_PRECISION + 1];
+
+    // the example from the original geohash.org announcement
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_geohash_encode(576491100, 104074400, 11, &hash));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_geohash_to_string(hash, 11, text));
+    CHECK_EQUAL_C_STRING("u4pruydqqvj", text);
+
+    // the notebook focus area
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_geohash_from_string("9T9P75YD", &hash, &precision));
+    CHECK_EQUAL_C_UINT(8, precision);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_geohash_to_string(hash, precision, text));
+    CHECK_EQUAL_C_STRING("9t9p75yd", text);
+}
+
+
+TEST_C(geohash, matches_reference)
+{
+    uint32_t seed = 29;
+    Latitude_t const edgeLat[] = { 0, -1, 1, Latitude_min, Latitude_max, 3515625, -3515625 };
+    Longitude_t const edgeLong[] = { 0, -1, 1, Longitude_min, Longitude_max, 7031250, -7031250 };
+
+    for (size_t i = 0; i < sizeof(edgeLat) / sizeof(edgeLat[0]); i++) {
+        for (unsigned precision = 1; precision <= LIBSM_GEOHASH_MAX_PRECISION; precision++) {
+            uint64_t hash;
+            CHECK_EQUAL_C_INT(LIBSM_OK,
+                              libsm_geohash_encode(edgeLat[i], edgeLong[i], precision, &hash));
+            CHECK_EQUAL_C_ULONG(referenceGeohash(edgeLat[i], edgeLong[i], precision), hash);
+        }
+    }
+
+    for (int i = 0; i < 100000; i++) {
+        Latitude_t const lat = (Latitude_t)(nextRandom(&seed) % 1800000001U) - 900000000;
+        Longitude_t const Long = (Longitude_t)(nextRandom(&seed) % 3599999999U) - 1799999999;
+        uint64_t hash;
+
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_geohash_encode(lat, Long, 12, &hash));
+        CHECK_EQUAL_C_ULONG(referenceGeohash(lat, Long, 12), hash);
+    }
+}
+
+
+TEST_C(geohash, batch_matches_single)
+{
+    uint32_t seed = 2735;
+    Latitude_t lat[257];
+    Longitude_t Long[257];
+    uint64_t hash[257];
+
+    for (size_t i = 0; i < 257; i++) {
+        lat[i] = 334150000 + (Latitude_t)(nextRandom(&seed) % 100000);
+        Long[i] = -1119260000 + (Longitude_t)(nextRandom(&seed) % 100000);
+    }
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_geohash_encode_batch(lat, Long, 257, 9, hash));
+    for (size_t i = 0; i < 257; i++) {
+        uint64_t single;
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_geohash_encode(lat[i], Long[i], 9, &single));
+        CHECK_EQUAL_C_ULONG(single, hash[i]);
+    }
+}
+
+
+TEST_C(geohash, box_is_exact)
+{
+    uint64_t hash;
+    uint64_t other;
+    unsigned precision;
+    libsm_geohash_box_t box;
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_geohash_from_string("9t9p75yd", &hash, &precision));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_geohash_decode(hash, precision, &box));
+
+    // the notebook focus area, in Tucson
+    CHECK_C(box.minLat > 322300000 && box.maxLat < 322400000);
+    CHECK_C(box.minLong > -1109600000 && box.maxLong < -1109500000);
+
+    libsm_geohash_encode(box.minLat, box.minLong, precision, &other);
+    CHECK_EQUAL_C_ULONG(hash, other);
+    libsm_geohash_encode(box.maxLat, box.maxLong, precision, &other);
+    CHECK_EQUAL_C_ULONG(hash, other);
+    libsm_geohash_encode(box.minLat - 1, box.minLong, precision, &other);
+    CHECK_C(hash != other);
+    libsm_geohash_encode(box.maxLat, box.maxLong + 1, precision, &other);
+    CHECK_C(hash != other);
+
+    // the whole world in one character
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_geohash_decode(31, 1, &box));
+    CHECK_EQUAL_C_LONG(Latitude_max, box.maxLat);
+    CHECK_EQUAL_C_LONG(1800000000, box.maxLong);
+}
+
+
+TEST_C(geohash, neighbors)
+{
+    uint64_t hash;
+    uint64_t neighbor;
+    unsigned precision;
+    libsm_geohash_box_t box;
+    libsm_geohash_box_t neighborBox;
+
+    libsm_geohash_from_string("9t9p75yd", &hash, &precision);
+    libsm_geohash_decode(hash, precision, &box);
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_geohash_neighbor(hash, precision, 1, 0, &neighbor));
+    libsm_geohash_decode(neighbor, precision, &neighborBox);
+    CHECK_EQUAL_C_LONG(box.maxLat + 1, neighborBox.minLat);
+    CHECK_EQUAL_C_LONG(box.minLong, neighborBox.minLong);
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_geohash_neighbor(hash, precision, -1, -1, &neighbor));
+    libsm_geohash_decode(neighbor, precision, &neighborBox);
+    CHECK_EQUAL_C_LONG(box.minLat - 1, neighborBox.maxLat);
+    CHECK_EQUAL_C_LONG(box.minLong - 1, neighborBox.maxLong);
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_geohash_neighbor(neighbor, precision, 1, 1, &neighbor));
+    CHECK_EQUAL_C_ULONG(hash, neighbor);
+
+    // east of "z" wraps around to "b", north of it is past the pole
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_geohash_neighbor(31, 1, 0, 1, &neighbor));
+    CHECK_EQUAL_C_ULONG(10, neighbor);
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_CONSTRAINT, libsm_geohash_neighbor(31, 1, 1, 0, &neighbor));
+}
+
+
+TEST_C(geohash, prefix_range)
+{
+    uint64_t prefix;
+    uint64_t hash;
+    uint64_t first;
+    uint64_t last;
+    unsigned precision;
+    libsm_geohash_box_t box;
+
+    libsm_geohash_from_string("9t9p75yd", &prefix, &precision);
+    libsm_geohash_decode(prefix, precision, &box);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_geohash_range(prefix, precision, 12, &first, &last));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER,
+                      libsm_geohash_range(prefix, precision, 7, &first, &last));
+
+    libsm_geohash_encode(box.minLat, box.minLong, 12, &hash);
+    CHECK_C(hash >= first && hash <= last);
+    libsm_geohash_encode(box.maxLat, box.maxLong, 12, &hash);
+    CHECK_C(hash >= first && hash <= last);
+    libsm_geohash_encode(box.maxLat + 1, box.maxLong, 12, &hash);
+    CHECK_C(hash < first || hash > last);
+}
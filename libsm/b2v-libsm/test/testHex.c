@@ -0,0 +1,143 @@
+/*
+ * testHex.c
+ * Check every hex codec variant the cpu runs against printf, and the JER strings built on it
+ *
+ * Did you know? Documentation for how to write more tests is at https://cpputest.github.io/manual.html
+ */
+#include "CppUTest/TestHarness_c.h"
+#include "asn_hex.h"
+#include "libsm.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define MAX_BYTES 200
+
+static asn_hex_impl_e const impls[] = { ASN_HEX_SCALAR, ASN_HEX_SSSE3, ASN_HEX_AVX2 };
+
+
+static void fillBytes(uint8_t* bytes, size_t len, uint32_t seed)
+{
+    for (size_t i = 0; i < len; i++) {
+        seed = seed * 1103515245u + 12345u;
+        bytes[i] = (uint8_t)(seed >> 16);
+    }
+}
+
+
+// Lengths around every vector width, both cases, against printf
+TEST_C(hex, variants_match_printf)
+{
+    for (size_t v = 0; v < sizeof(impls) / sizeof(impls[0]); v++) {
+        if (!asn_hex_supported(impls[v])) {
+            continue;
+        }
+        for (size_t len = 0; len <= MAX_BYTES; len++) {
+            uint8_t bytes[MAX_BYTES];
+            uint8_t decoded[MAX_BYTES];
+            char expected[2 * MAX_BYTES + 1] = { 0 };
+            char hex[2 * MAX_BYTES + 1] = { 0 };
+            fillBytes(bytes, len, (uint32_t)len);
+            for (int lower = 0; lower < 2; lower++) {
+                for (size_t i = 0; i < len; i++) {
+                    snprintf(expected + 2 * i, 3, lower ? "%02x" : "%02X", bytes[i]);
+                }
+                asn_hex_encode_with(impls[v], bytes, len, hex, lower);
+                CHECK_EQUAL_C_STRING(expected, hex);
+
+                memset(decoded, 0, sizeof(decoded));
+                CHECK_EQUAL_C_LONG((long)len,
+                                   (long)asn_hex_decode_with(impls[v], hex, 2 * len, decoded));
+                CHECK_C(memcmp(bytes, decoded, len) == 0);
+            }
+        }
+    }
+    CHECK_C(asn_hex_supported(asn_hex_best()));
+}
+
+
+// A bad char anywhere, in the vector part or the tail, fails the whole string
+TEST_C(hex, variants_reject_bad_digits)
+{
+    char const bad[] = { 'g', 'G', '/', ':', '@', '`', ' ', '\0', (char)0x80, (char)0xC1 };
+    char hex[130];
+    uint8_t decoded[65];
+    memset(hex, 'a', sizeof(hex));
+
+    for (size_t v = 0; v < sizeof(impls) / sizeof(impls[0]); v++) {
+        if (!asn_hex_supported(impls[v])) {
+            continue;
+        }
+        CHECK_EQUAL_C_LONG(-1, (long)asn_hex_decode_with(impls[v], hex, 129, decoded));
+        for (size_t pos = 0; pos < sizeof(hex); pos++) {
+            for (size_t b = 0; b < sizeof(bad); b++) {
+                hex[pos] = bad[b];
+                CHECK_EQUAL_C_LONG(
+                        -1, (long)asn_hex_decode_with(impls[v], hex, sizeof(hex), decoded));
+            }
+            hex[pos] = pos % 2 ? 'F' : '9';
+        }
+        CHECK_EQUAL_C_LONG(65, (long)asn_hex_decode_with(impls[v], hex, sizeof(hex), decoded));
+        memset(hex, 'a', sizeof(hex));
+    }
+}
+
+
+TEST_C(hex, libsm_wrappers)
+{
+    uint8_t const bytes[] = { 0x00, 0x20, 0x1A, 0xFF };
+    uint8_t decoded[4];
+    size_t len = sizeof(decoded);
+    char hex[9];
+
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_hex_encode(NULL, 1, hex, sizeof(hex), false));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_hex_encode(bytes, 4, NULL, sizeof(hex), false));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_ENCODING_BUFF_SIZE, libsm_hex_encode(bytes, 4, hex, 8, false));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_hex_encode(bytes, 4, hex, sizeof(hex), false));
+    CHECK_EQUAL_C_STRING("00201AFF", hex);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_hex_encode(bytes, 4, hex, sizeof(hex), true));
+    CHECK_EQUAL_C_STRING("00201aff", hex);
+
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_hex_decode(hex, 8, decoded, NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_DECODING, libsm_hex_decode("00201aF", 7, decoded, &len));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_DECODING, libsm_hex_decode("00201aFx", 8, decoded, &len));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_DECODING_BUFF_SIZE,
+                      libsm_hex_decode("00201aFF00", 10, decoded, &len));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_hex_decode("00201aFF", 8, decoded, &len));
+    CHECK_EQUAL_C_INT(4, (int)len);
+    CHECK_C(memcmp(bytes, decoded, sizeof(bytes)) == 0);
+}
+
+
+// TemporaryID is an OCTET STRING and the brakes a BIT STRING, both are hex in JER
+TEST_C(hex, jer_strings_round_trip)
+{
+    MessageFrame_t* mf = libsm_alloc_init_mf_bsm();
+    BSMcoreData_t* core = &mf->value.choice.BasicSafetyMessage.coreData;
+    uint8_t const id[] = { 0x12, 0xAB, 0xCD, 0xEF };
+    memcpy(core->id.buf, id, sizeof(id));
+    core->brakes.wheelBrakes.buf[0] = 0xA8;
+
+    asn_encode_to_new_buffer_result_t res
+            = asn_encode_to_new_buffer(0, ATS_JER, &asn_DEF_MessageFrame, mf);
+    CHECK_C(res.buffer != NULL);
+    CHECK_C(strstr(res.buffer, "\"12ABCDEF\"") != NULL);
+    CHECK_C(strstr(res.buffer, "\"A8\"") != NULL);
+
+    MessageFrame_t* back = NULL;
+    asn_dec_rval_t const rval = asn_decode(0,
+                                           ATS_JER,
+                                           &asn_DEF_MessageFrame,
+                                           (void**)&back,
+                                           res.buffer,
+                                           (size_t)res.result.encoded);
+    free(res.buffer);
+    CHECK_EQUAL_C_INT(RC_OK, rval.code);
+    BSMcoreData_t* backCore = &back->value.choice.BasicSafetyMessage.coreData;
+    CHECK_EQUAL_C_INT(4, (int)backCore->id.size);
+    CHECK_C(memcmp(id, backCore->id.buf, sizeof(id)) == 0);
+    CHECK_EQUAL_C_INT(0xA8, backCore->brakes.wheelBrakes.buf[0]);
+
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, back);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
@@ -0,0 +1,189 @@
+/*
+ * testItis.c
+ * Tests for the ITIS code and phrase lookup
+ *
+ * Did you know? Documentation for how to write more tests is at https://cpputest.github.io/manual.html
+ */
+// first, for the ITIScodes names of j2540, see libsm-TIM.h
+#include "libsm-itis.h"
+
+#include "CppUTest/TestHarness_c.h"
+#include "libsm.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+
+static ITIScodesAndText_t* buildContent(void)
+{
+    ITIScodesAndText_t* content = calloc(1, sizeof(ITIScodesAndText_t));
+    CHECK_C(content != NULL);
+    CHECK_C(ASN_SEQUENCE_ADD(&content->list,
+                             libsm_alloc_init_ITIScodesAndText__Member_itis(
+                                     ITIScodes_stop_and_go_traffic))
+            == 0);
+    CHECK_C(ASN_SEQUENCE_ADD(&content->list,
+                             libsm_alloc_init_ITIScodesAndText__Member_text("near exit 12"))
+            == 0);
+    // not an ITIS code
+    CHECK_C(ASN_SEQUENCE_ADD(&content->list,
+                             libsm_alloc_init_ITIScodesAndText__Member_itis(12))
+            == 0);
+    return content;
+}
+
+
+TEST_C(itis, from_code)
+{
+    libsm_itis_t const* itis = libsm_itis_from_code(ITIScodes_speed_limit);
+    CHECK_C(itis != NULL);
+    CHECK_EQUAL_C_INT(ITIScodes_speed_limit, itis->code);
+    CHECK_EQUAL_C_STRING("speed-limit", itis->name);
+    CHECK_EQUAL_C_STRING("TrafficConditions", libsm_itis_category(itis));
+
+    itis = libsm_itis_from_code(513);
+    CHECK_C(itis != NULL);
+    CHECK_EQUAL_C_STRING("accident", itis->name);
+    CHECK_EQUAL_C_STRING("AccidentsAndIncidents", libsm_itis_category(itis));
+
+    // the lowest and highest codes
+    CHECK_C(libsm_itis_from_code(257) != NULL);
+    CHECK_C(libsm_itis_from_code(13641) != NULL);
+
+    CHECK_C(libsm_itis_from_code(0) == NULL);
+    CHECK_C(libsm_itis_from_code(256) == NULL);
+    CHECK_C(libsm_itis_from_code(13642) == NULL);
+    CHECK_C(libsm_itis_from_code(-1) == NULL);
+    CHECK_EQUAL_C_STRING("", libsm_itis_category(NULL));
+}
+
+
+TEST_C(itis, from_name)
+{
+    char const* spellings[]
+            = { "stop-and-go-traffic", "stop_and_go_traffic", "stop and go traffic" };
+    for (size_t i = 0; i < sizeof(spellings) / sizeof(spellings[0]); i++) {
+        libsm_itis_t const* itis = libsm_itis_from_name(spellings[i], strlen(spellings[i]));
+        CHECK_C(itis != NULL);
+        CHECK_EQUAL_C_INT(ITIScodes_stop_and_go_traffic, itis->code);
+    }
+
+    // case matters, names are mixed case
+    CHECK_C(libsm_itis_from_name("information-available-on-TV", 27) != NULL);
+    CHECK_C(libsm_itis_from_name("information-available-on-tv", 27) == NULL);
+    // need not be NUL terminated, prefixes and longer names do not match
+    CHECK_C(libsm_itis_from_name("accidentally", 8) == libsm_itis_from_code(513));
+    CHECK_C(libsm_itis_from_name("acciden", 7) == NULL);
+    CHECK_C(libsm_itis_from_name("accidents", 9) == NULL);
+    CHECK_C(libsm_itis_from_name("", 0) == NULL);
+    CHECK_C(libsm_itis_from_name(NULL, 3) == NULL);
+}
+
+
+TEST_C(itis, every_code_round_trips)
+{
+    char name[128];
+    size_t count = 0;
+    for (long code = 0; code <= 65535; code++) {
+        libsm_itis_t const* itis = libsm_itis_from_code(code);
+        if (itis == NULL) {
+            continue;
+        }
+        count++;
+        CHECK_EQUAL_C_INT(code, itis->code);
+        CHECK_C(libsm_itis_category(itis)[0] != '\0');
+        size_t const len = strlen(itis->name);
+        CHECK_C(len < sizeof(name));
+        CHECK_C(libsm_itis_from_name(itis->name, len) == itis);
+
+        memcpy(name, itis->name, len);
+        for (size_t i = 0; i < len; i++) {
+            if (name[i] == '-') {
+                name[i] = '_';
+            }
+        }
+        CHECK_C(libsm_itis_from_name(name, len) == itis);
+    }
+    CHECK_EQUAL_C_INT(2456, count);
+}
+
+
+TEST_C(itis, phrase_member)
+{
+    ITIScodesAndText_t* content = calloc(1, sizeof(ITIScodesAndText_t));
+    CHECK_C(content != NULL);
+
+    ITIScodesAndText__Member* member
+            = libsm_alloc_init_ITIScodesAndText__Member_phrase("prepare to stop");
+    CHECK_C(member != NULL);
+    CHECK_C(ASN_SEQUENCE_ADD(&content->list, member) == 0);
+    CHECK_EQUAL_C_INT(ITIScodesAndText__Member__item_PR_itis, member->item.present);
+    CHECK_EQUAL_C_INT(ITIScodes_prepare_to_stop, member->item.choice.itis);
+
+    member = libsm_alloc_init_ITIScodesAndText__Member_phrase("prepare for a long wait");
+    CHECK_C(member != NULL);
+    CHECK_C(ASN_SEQUENCE_ADD(&content->list, member) == 0);
+    CHECK_EQUAL_C_INT(ITIScodesAndText__Member__item_PR_text, member->item.present);
+    CHECK_EQUAL_C_INT(23, member->item.choice.text.size);
+
+    CHECK_C(libsm_alloc_init_ITIScodesAndText__Member_phrase(NULL) == NULL);
+    ASN_STRUCT_FREE(asn_DEF_ITIScodesAndText, content);
+}
+
+
+TEST_C(itis, render)
+{
+    ITIScodesAndText_t* content = buildContent();
+    char text[64];
+    size_t len = 0;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_itis_render(content, text, sizeof(text), &len));
+    CHECK_EQUAL_C_STRING("stop and go traffic, near exit 12, 12", text);
+    CHECK_EQUAL_C_INT(strlen(text), len);
+
+    // the NUL needs room too
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_itis_render(content, text, len + 1, NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_ENCODING_BUFF_SIZE,
+                      libsm_itis_render(content, text, len, NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_ENCODING_BUFF_SIZE, libsm_itis_render(content, text, 0, NULL));
+
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_itis_render(NULL, text, sizeof(text), NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_itis_render(content, NULL, sizeof(text), NULL));
+
+    ITIScodesAndText_t empty = { 0 };
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_itis_render(&empty, text, sizeof(text), &len));
+    CHECK_EQUAL_C_STRING("", text);
+    CHECK_EQUAL_C_INT(0, len);
+
+    ASN_STRUCT_FREE(asn_DEF_ITIScodesAndText, content);
+}
+
+
+TEST_C(itis, render_batch)
+{
+    ITIScodesAndText_t* first = buildContent();
+    ITIScodesAndText_t* second = calloc(1, sizeof(ITIScodesAndText_t));
+    CHECK_C(second != NULL);
+    CHECK_C(ASN_SEQUENCE_ADD(&second->list,
+                             libsm_alloc_init_ITIScodesAndText__Member_phrase("accident"))
+            == 0);
+    ITIScodesAndText_t const* contents[] = { first, second, first };
+
+    char text[128];
+    size_t offsets[3];
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_itis_render_batch(contents, 3, text, sizeof(text), offsets));
+    CHECK_EQUAL_C_INT(0, offsets[0]);
+    CHECK_EQUAL_C_STRING("stop and go traffic, near exit 12, 12", text + offsets[0]);
+    CHECK_EQUAL_C_STRING("accident", text + offsets[1]);
+    CHECK_EQUAL_C_STRING("stop and go traffic, near exit 12, 12", text + offsets[2]);
+
+    size_t const needed = offsets[2] + strlen(text + offsets[2]) + 1;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_itis_render_batch(contents, 3, text, needed, offsets));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_ENCODING_BUFF_SIZE,
+                      libsm_itis_render_batch(contents, 3, text, needed - 1, offsets));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_itis_render_batch(contents, 0, text, 0, offsets));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG,
+                      libsm_itis_render_batch(NULL, 3, text, sizeof(text), offsets));
+
+    ASN_STRUCT_FREE(asn_DEF_ITIScodesAndText, first);
+    ASN_STRUCT_FREE(asn_DEF_ITIScodesAndText, second);
+}
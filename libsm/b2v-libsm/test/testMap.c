@@ -0,0 +1,361 @@
+/*
+ * testMap.c
+ * Tests for the MapData lane compiler and map matching
+ *
+ * Did you know? Documentation for how to write more tests is at https://cpputest.github.io/manual.html
+ */
+#include "CppUTest/TestHarness_c.h"
+#include "libsm.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#define REF_LAT  334150000
+#define REF_LONG -1119260000
+#define INTERSECTION_ID 1234
+
+
+static NodeXY_t* node(long x, long y)
+{
+    NodeXY_t* n = calloc(1, sizeof(NodeXY_t));
+    n->delta.present = NodeOffsetPointXY_PR_node_XY6;
+    n->delta.choice.node_XY6 = calloc(1, sizeof(Node_XY_32b_t));
+    n->delta.choice.node_XY6->x = x;
+    n->delta.choice.node_XY6->y = y;
+    return n;
+}
+
+
+static GenericLane_t* lane(IntersectionGeometry_t* geometry, LaneID_t laneId, uint8_t direction)
+{
+    GenericLane_t* l = calloc(1, sizeof(GenericLane_t));
+    l->laneID = laneId;
+    libsm_init_bit_string(&l->laneAttributes.directionalUse, 2);
+    // named bit 0, ingressPath, is the first bit
+    l->laneAttributes.directionalUse.buf[0] = (uint8_t)((direction & LIBSM_MAP_INGRESS ? 0x80 : 0)
+                                                       | (direction & LIBSM_MAP_EGRESS ? 0x40 : 0));
+    libsm_init_bit_string(&l->laneAttributes.sharedWith, 10);
+    l->laneAttributes.laneType.present = LaneTypeAttributes_PR_vehicle;
+    libsm_init_bit_string(&l->laneAttributes.laneType.choice.vehicle, 8);
+    ASN_SEQUENCE_ADD(&geometry->laneSet.list, l);
+    return l;
+}
+
+
+static void nodes(GenericLane_t* l, NodeXY_t* a, NodeXY_t* b, NodeXY_t* c)
+{
+    l->nodeList.present = NodeListXY_PR_nodes;
+    l->nodeList.choice.nodes = calloc(1, sizeof(NodeSetXY_t));
+    ASN_SEQUENCE_ADD(&l->nodeList.choice.nodes->list, a);
+    ASN_SEQUENCE_ADD(&l->nodeList.choice.nodes->list, b);
+    if (c != NULL) {
+        ASN_SEQUENCE_ADD(&l->nodeList.choice.nodes->list, c);
+    }
+}
+
+
+static void computed(GenericLane_t* l, LaneID_t reference, long offsetX)
+{
+    l->nodeList.present = NodeListXY_PR_computed;
+    l->nodeList.choice.computed = calloc(1, sizeof(ComputedLane_t));
+    l->nodeList.choice.computed->referenceLaneId = reference;
+    l->nodeList.choice.computed->offsetXaxis.present = ComputedLane__offsetXaxis_PR_large;
+    l->nodeList.choice.computed->offsetXaxis.choice.large = offsetX;
+    l->nodeList.choice.computed->offsetYaxis.present = ComputedLane__offsetYaxis_PR_small;
+    l->nodeList.choice.computed->offsetYaxis.choice.small = 0;
+}
+
+
+/*
+ * South leg of one intersection, 3.6 m lanes:
+ * - lane 1, ingress, 1.8 m east of the center, from 10 m to 70 m south
+ * - lane 2, egress, 1.8 m west of the center, from 10 m to 70 m south
+ * - lane 3, ingress, computed from lane 1 3.6 m further east
+ * - lane 4, computed from lane 9 which does not exist
+ * The MAP goes through UPER and back, like a received one.
+ */
+static MessageFrame_t* southLeg(Common_MsgCount_t revision)
+{
+    MessageFrame_t* mf = calloc(1, sizeof(MessageFrame_t));
+    mf->messageId = DSRCmsgID_mapData;
+    mf->value.present = MessageFrame__value_PR_MapData;
+    MapData_t* map = &mf->value.choice.MapData;
+    map->msgIssueRevision = revision;
+    map->intersections = calloc(1, sizeof(IntersectionGeometryList_t));
+
+    IntersectionGeometry_t* geometry = calloc(1, sizeof(IntersectionGeometry_t));
+    geometry->id.id = INTERSECTION_ID;
+    geometry->refPoint.lat = REF_LAT;
+    geometry->refPoint.Long = REF_LONG;
+    geometry->laneWidth = calloc(1, sizeof(LaneWidth_t));
+    *geometry->laneWidth = 360;
+    ASN_SEQUENCE_ADD(&map->intersections->list, geometry);
+
+    GenericLane_t* l = lane(geometry, 1, LIBSM_MAP_INGRESS);
+    nodes(l, node(180, -1000), node(0, -3000), node(0, -3000));
+    l->maneuvers = calloc(1, sizeof(AllowedManeuvers_t));
+    libsm_init_bit_string(l->maneuvers, 12);
+    l->maneuvers->buf[0] = 0xC0; // straight and left
+    l->connectsTo = calloc(1, sizeof(ConnectsToList_t));
+    Connection_t* connection = calloc(1, sizeof(Connection_t));
+    connection->connectingLane.lane = 5;
+    connection->signalGroup = calloc(1, sizeof(SignalGroupID_t));
+    *connection->signalGroup = 2;
+    ASN_SEQUENCE_ADD(&l->connectsTo->list, connection);
+
+    l = lane(geometry, 2, LIBSM_MAP_EGRESS);
+    nodes(l, node(-180, -1000), node(0, -6000), NULL);
+    l = lane(geometry, 3, LIBSM_MAP_INGRESS);
+    computed(l, 1, 360);
+    l = lane(geometry, 4, LIBSM_MAP_INGRESS);
+    computed(l, 9, 360);
+
+    uint8_t encoded[512];
+    size_t len = sizeof(encoded);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, encoded, &len));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+
+    mf = calloc(1, sizeof(MessageFrame_t));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_decode_messageframe(encoded, len, mf));
+    return mf;
+}
+
+
+static void position(double east, double north, Latitude_t* lat, Longitude_t* Long)
+{
+    double const metersPerUnit = Latitude_m_per_unit;
+    double const cosLat = cos((double)REF_LAT / Latitude_unit_deg * (M_PI / 180.0));
+    *lat = REF_LAT + lround(north / metersPerUnit);
+    *Long = REF_LONG + lround(east / (metersPerUnit * cosLat));
+}
+
+
+static void matchAt(libsm_map_t const* map,
+                    double east,
+                    double north,
+                    Heading_t heading,
+                    libsm_map_match_t* match)
+{
+    Latitude_t lat;
+    Longitude_t Long;
+    position(east, north, &lat, &Long);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_match(map, lat, Long, heading, match));
+}
+
+
+TEST_C(map, invalid_args)
+{
+    MessageFrame_t* mf = southLeg(1);
+    libsm_map_config_t config;
+    libsm_map_t map;
+    libsm_map_match_t match;
+    libsm_map_cache_t cache;
+    MapData_t empty = { 0 };
+
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_map_compile(NULL, NULL, &map));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG,
+                      libsm_map_compile(&mf->value.choice.MapData, NULL, NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_map_compile(&empty, NULL, &map));
+    libsm_map_default_config(&config);
+    config.cellSizeM = 0;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER,
+                      libsm_map_compile(&mf->value.choice.MapData, &config, &map));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG,
+                      libsm_map_match(NULL, REF_LAT, REF_LONG, Heading_unavailable, &match));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_map_cache_init(&cache, NULL, 0));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
+
+
+TEST_C(map, compile_lanes)
+{
+    MessageFrame_t* mf = southLeg(1);
+    libsm_map_t map;
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_compile(&mf->value.choice.MapData, NULL, &map));
+    CHECK_EQUAL_C_ULONG(3, map.laneCount);
+    CHECK_EQUAL_C_ULONG(1, map.skippedLanes);
+    CHECK_EQUAL_C_ULONG(8, map.pointCount);
+
+    libsm_map_lane_t const* lane = libsm_map_find_lane(&map, INTERSECTION_ID, 1);
+    CHECK_C(lane != NULL);
+    CHECK_EQUAL_C_INT(LIBSM_MAP_INGRESS, lane->direction);
+    CHECK_EQUAL_C_INT(LaneTypeAttributes_PR_vehicle, lane->laneType);
+    CHECK_EQUAL_C_UINT(0x3, lane->maneuvers);
+    CHECK_EQUAL_C_UINT(3, lane->pointCount);
+    CHECK_EQUAL_C_REAL(60.0, lane->lengthM, 1e-9);
+    CHECK_EQUAL_C_REAL(3.6, map.points[lane->firstPoint].widthM, 1e-9);
+    CHECK_EQUAL_C_REAL(-70.0, map.points[lane->firstPoint + 2].north, 1e-9);
+    CHECK_EQUAL_C_UINT(1, lane->connectionCount);
+    CHECK_EQUAL_C_UINT(5, map.connections[lane->firstConnection].laneId);
+    CHECK_EQUAL_C_INT(2, map.connections[lane->firstConnection].signalGroup);
+    CHECK_EQUAL_C_UINT(LIBSM_MAP_NO_REMOTE,
+                       map.connections[lane->firstConnection].remoteIntersection);
+
+    // lat/Long of the first node, 1.8 m east and 10 m south of the reference point
+    Latitude_t lat;
+    Longitude_t Long;
+    position(1.8, -10.0, &lat, &Long);
+    CHECK_EQUAL_C_LONG(lat, map.points[lane->firstPoint].lat);
+    CHECK_EQUAL_C_LONG(Long, map.points[lane->firstPoint].Long);
+
+    lane = libsm_map_find_lane(&map, INTERSECTION_ID, 3);
+    CHECK_C(lane != NULL);
+    CHECK_C(lane->computed);
+    CHECK_EQUAL_C_UINT(3, lane->pointCount);
+    CHECK_EQUAL_C_REAL(5.4, map.points[lane->firstPoint + 1].east, 1e-9);
+    CHECK_EQUAL_C_REAL(-40.0, map.points[lane->firstPoint + 1].north, 1e-9);
+
+    CHECK_C(libsm_map_find_lane(&map, INTERSECTION_ID, 4) == NULL);
+    libsm_map_free(&map);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
+
+
+TEST_C(map, match_position)
+{
+    MessageFrame_t* mf = southLeg(1);
+    libsm_map_t map;
+    libsm_map_match_t match;
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_compile(&mf->value.choice.MapData, NULL, &map));
+
+    matchAt(&map, 1.5, -25.0, Heading_unavailable, &match);
+    CHECK_C(match.matched);
+    CHECK_EQUAL_C_UINT(1, match.laneId);
+    CHECK_EQUAL_C_UINT(INTERSECTION_ID, match.intersection);
+    CHECK_EQUAL_C_REAL(0.3, match.distanceM, 0.02);
+    CHECK_EQUAL_C_REAL(15.0, match.alongM, 0.02);
+    CHECK_C(match.inside);
+
+    matchAt(&map, 3.9, -50.0, Heading_unavailable, &match);
+    CHECK_C(match.matched);
+    CHECK_EQUAL_C_UINT(3, match.laneId);
+    CHECK_C(match.inside);
+
+    // past the end of a lane, but close enough
+    matchAt(&map, -1.8, -73.0, Heading_unavailable, &match);
+    CHECK_C(match.matched);
+    CHECK_EQUAL_C_UINT(2, match.laneId);
+    CHECK_EQUAL_C_REAL(3.0, match.distanceM, 0.02);
+    CHECK_C(!match.inside);
+
+    matchAt(&map, 100.0, 100.0, Heading_unavailable, &match);
+    CHECK_C(!match.matched);
+    matchAt(&map, 20.0, -30.0, Heading_unavailable, &match);
+    CHECK_C(!match.matched);
+    libsm_map_free(&map);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
+
+
+TEST_C(map, match_heading)
+{
+    MessageFrame_t* mf = southLeg(1);
+    libsm_map_t map;
+    libsm_map_match_t match;
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_compile(&mf->value.choice.MapData, NULL, &map));
+
+    // on the center line, a bit closer to lane 1
+    matchAt(&map, 0.2, -30.0, Heading_unavailable, &match);
+    CHECK_EQUAL_C_UINT(1, match.laneId);
+    // driving north is lane 1 towards the stop line
+    matchAt(&map, 0.2, -30.0, 0, &match);
+    CHECK_EQUAL_C_UINT(1, match.laneId);
+    // driving south can only be lane 2 leaving the intersection
+    matchAt(&map, 0.2, -30.0, 14400, &match);
+    CHECK_C(match.matched);
+    CHECK_EQUAL_C_UINT(2, match.laneId);
+    // driving east matches nothing
+    matchAt(&map, 0.2, -30.0, 7200, &match);
+    CHECK_C(!match.matched);
+    libsm_map_free(&map);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
+
+
+TEST_C(map, match_batch)
+{
+    MessageFrame_t* mf = southLeg(1);
+    libsm_map_t map;
+    Latitude_t lats[64];
+    Longitude_t longs[64];
+    Heading_t headings[64];
+    libsm_map_match_t matches[64];
+    libsm_map_match_t match;
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_compile(&mf->value.choice.MapData, NULL, &map));
+    for (int i = 0; i < 64; i++) {
+        position(-8.0 + 0.25 * i, -5.0 - 1.1 * i, &lats[i], &longs[i]);
+        headings[i] = (i % 2) ? 0 : 14400;
+    }
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_match_batch(&map, lats, longs, headings, 64, matches));
+    for (int i = 0; i < 64; i++) {
+        libsm_map_match(&map, lats[i], longs[i], headings[i], &match);
+        CHECK_EQUAL_C_INT(match.matched, matches[i].matched);
+        CHECK_EQUAL_C_UINT(match.lane, matches[i].lane);
+        CHECK_EQUAL_C_REAL(match.alongM, matches[i].alongM, 0);
+    }
+    libsm_map_free(&map);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
+
+
+TEST_C(map, cache_by_revision)
+{
+    MessageFrame_t* first = southLeg(1);
+    MessageFrame_t* next = southLeg(2);
+    libsm_map_cache_t cache;
+    libsm_map_t const* a;
+    libsm_map_t const* b;
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_cache_init(&cache, NULL, 4));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_cache_get(&cache, &first->value.choice.MapData, &a));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_cache_get(&cache, &first->value.choice.MapData, &b));
+    CHECK_C(a == b);
+    CHECK_EQUAL_C_ULONG(1, cache.compiles);
+    CHECK_EQUAL_C_ULONG(1, cache.hits);
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_cache_get(&cache, &next->value.choice.MapData, &b));
+    CHECK_EQUAL_C_ULONG(2, cache.compiles);
+    CHECK_EQUAL_C_UINT(2, b->msgIssueRevision);
+    CHECK_EQUAL_C_ULONG(3, b->laneCount);
+    libsm_map_cache_free(&cache);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, first);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, next);
+}
+
+
+TEST_C(map, cache_by_intersections)
+{
+    MessageFrame_t* single = southLeg(1);
+    MessageFrame_t* corridor = southLeg(1);
+    libsm_map_cache_t cache;
+    libsm_map_t const* a;
+    libsm_map_t const* b;
+
+    // the same first intersection, and one more lane at a second one
+    IntersectionGeometry_t* geometry = libsm_add_map_intersectionGeometry(
+            &corridor->value.choice.MapData, INTERSECTION_ID + 1, REF_LAT + 1000, REF_LONG);
+    GenericLane_t* l = libsm_add_map_genericLane(
+            geometry, 1, LIBSM_MAP_INGRESS, LaneTypeAttributes_PR_vehicle);
+    CHECK_C(libsm_add_map_nodeXY(l, 180, -1000) != NULL);
+    CHECK_C(libsm_add_map_nodeXY(l, 0, -3000) != NULL);
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_cache_init(&cache, NULL, 4));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_cache_get(&cache, &single->value.choice.MapData, &a));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_cache_get(&cache, &corridor->value.choice.MapData, &b));
+    CHECK_C(a != b);
+    CHECK_EQUAL_C_ULONG(2, cache.compiles);
+    CHECK_EQUAL_C_ULONG(3, a->laneCount);
+    CHECK_EQUAL_C_ULONG(4, b->laneCount);
+    CHECK_C(libsm_map_find_lane(b, INTERSECTION_ID + 1, 1) != NULL);
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_cache_get(&cache, &single->value.choice.MapData, &b));
+    CHECK_C(a == b);
+    CHECK_EQUAL_C_ULONG(1, cache.hits);
+    libsm_map_cache_free(&cache);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, single);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, corridor);
+}
@@ -0,0 +1,257 @@
+/*
+ * testMapBuilder.c
+ * Tests for the MapData builders and the cache of encoded MAPs
+ *
+ * Did you know? Documentation for how to write more tests is at https://cpputest.github.io/manual.html
+ */
+#include "CppUTest/TestHarness_c.h"
+#include "libsm.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define REF_LAT  334150000
+#define REF_LONG -1119260000
+
+
+/*
+ * One intersection, lane 1 ingress with nodes of three offset sizes and a
+ * connection to lane 2, lane 2 egress
+ */
+static MessageFrame_t* buildMap(IntersectionID_t id, Common_MsgCount_t revision)
+{
+    MessageFrame_t* mf = libsm_alloc_init_mf_map();
+    CHECK_C(mf != NULL);
+    MapData_t* map = libsm_get_map(mf);
+    map->msgIssueRevision = revision;
+    IntersectionGeometry_t* geometry
+            = libsm_add_map_intersectionGeometry(map, id, REF_LAT, REF_LONG);
+    CHECK_C(geometry != NULL);
+
+    GenericLane_t* lane = libsm_add_map_genericLane(
+            geometry, 1, LIBSM_MAP_INGRESS, LaneTypeAttributes_PR_vehicle);
+    CHECK_C(libsm_add_map_nodeXY(lane, 180, -1000) != NULL);
+    CHECK_C(libsm_add_map_nodeXY(lane, 0, -3000) != NULL);
+    CHECK_C(libsm_add_map_nodeXY(lane, 10, -20000) != NULL);
+    CHECK_C(libsm_add_map_connection(lane, 2, 4) != NULL);
+    CHECK_C(libsm_add_map_connection(lane, 3, LIBSM_MAP_NO_SIGNAL_GROUP) != NULL);
+
+    lane = libsm_add_map_genericLane(
+            geometry, 2, LIBSM_MAP_EGRESS, LaneTypeAttributes_PR_sidewalk);
+    CHECK_C(libsm_add_map_nodeXY(lane, -180, -1000) != NULL);
+    CHECK_C(libsm_add_map_nodeXY(lane, 0, -500) != NULL);
+    return mf;
+}
+
+
+TEST_C(test_map, nodeXY_choice)
+{
+    CHECK_EQUAL_C_INT(NodeOffsetPointXY_PR_node_XY1, libsm_map_nodeXY_choice(0, 0));
+    CHECK_EQUAL_C_INT(NodeOffsetPointXY_PR_node_XY1, libsm_map_nodeXY_choice(511, -512));
+    CHECK_EQUAL_C_INT(NodeOffsetPointXY_PR_node_XY2, libsm_map_nodeXY_choice(0, -513));
+    CHECK_EQUAL_C_INT(NodeOffsetPointXY_PR_node_XY2, libsm_map_nodeXY_choice(512, 0));
+    CHECK_EQUAL_C_INT(NodeOffsetPointXY_PR_node_XY3, libsm_map_nodeXY_choice(2047, 1024));
+    CHECK_EQUAL_C_INT(NodeOffsetPointXY_PR_node_XY4, libsm_map_nodeXY_choice(-4096, 0));
+    CHECK_EQUAL_C_INT(NodeOffsetPointXY_PR_node_XY5, libsm_map_nodeXY_choice(0, 8191));
+    CHECK_EQUAL_C_INT(NodeOffsetPointXY_PR_node_XY6, libsm_map_nodeXY_choice(8192, 0));
+    CHECK_EQUAL_C_INT(NodeOffsetPointXY_PR_node_XY6, libsm_map_nodeXY_choice(32767, -32768));
+    CHECK_EQUAL_C_INT(NodeOffsetPointXY_PR_NOTHING, libsm_map_nodeXY_choice(32768, 0));
+    CHECK_EQUAL_C_INT(NodeOffsetPointXY_PR_NOTHING, libsm_map_nodeXY_choice(0, -32769));
+    CHECK_C(libsm_alloc_init_NodeXY(0, 40000) == NULL);
+
+    NodeXY_t* node = libsm_alloc_init_NodeXY(-700, 20);
+    CHECK_EQUAL_C_INT(NodeOffsetPointXY_PR_node_XY2, node->delta.present);
+    CHECK_EQUAL_C_LONG(-700, node->delta.choice.node_XY2->x);
+    CHECK_EQUAL_C_LONG(20, node->delta.choice.node_XY2->y);
+    ASN_STRUCT_FREE(asn_DEF_NodeXY, node);
+}
+
+
+TEST_C(test_map, invalid_args)
+{
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_init_map(NULL));
+    CHECK_C(libsm_add_map_intersectionGeometry(NULL, 1, REF_LAT, REF_LONG) == NULL);
+    CHECK_C(libsm_add_map_genericLane(NULL, 1, 0, LaneTypeAttributes_PR_vehicle) == NULL);
+    CHECK_C(libsm_add_map_nodeXY(NULL, 0, 0) == NULL);
+    CHECK_C(libsm_add_map_connection(NULL, 1, 1) == NULL);
+
+    MessageFrame_t* mf = buildMap(1, 0);
+    IntersectionGeometry_t* geometry = libsm_get_map(mf)->intersections->list.array[0];
+    CHECK_C(libsm_add_map_genericLane(geometry, 3, 0, LaneTypeAttributes_PR_NOTHING) == NULL);
+    GenericLane_t* lane = geometry->laneSet.list.array[0];
+    CHECK_C(libsm_add_map_nodeXY(lane, 40000, 0) == NULL);
+    CHECK_EQUAL_C_INT(3, lane->nodeList.choice.nodes->list.count);
+
+    // nodes only go into a node list, not a computed lane
+    lane = libsm_add_map_genericLane(geometry, 3, 0, LaneTypeAttributes_PR_vehicle);
+    lane->nodeList.present = NodeListXY_PR_computed;
+    lane->nodeList.choice.computed = calloc(1, sizeof(ComputedLane_t));
+    CHECK_C(libsm_add_map_nodeXY(lane, 0, 0) == NULL);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+
+    mf = libsm_alloc_init_mf_spat();
+    CHECK_C(!libsm_mf_has_map(mf));
+    CHECK_C(libsm_get_map(mf) == NULL);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
+
+
+// What the builders make goes through UPER and the lane compiler as it was built
+TEST_C(test_map, build_encode_compile)
+{
+    MessageFrame_t* mf = buildMap(1234, 7);
+    uint8_t encoded[512];
+    size_t len = sizeof(encoded);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, encoded, &len));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+
+    MessageFrame_t decoded = { 0 };
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_decode_messageframe(encoded, len, &decoded));
+    CHECK_C(libsm_mf_has_map(&decoded));
+    MapData_t* map = libsm_get_map(&decoded);
+    CHECK_EQUAL_C_INT(7, (int)map->msgIssueRevision);
+    IntersectionGeometry_t* geometry = map->intersections->list.array[0];
+    CHECK_EQUAL_C_INT(1234, (int)geometry->id.id);
+    CHECK_EQUAL_C_LONG(REF_LAT, geometry->refPoint.lat);
+    CHECK_EQUAL_C_LONG(REF_LONG, geometry->refPoint.Long);
+    NodeSetXY_t* nodes = geometry->laneSet.list.array[0]->nodeList.choice.nodes;
+    CHECK_EQUAL_C_INT(NodeOffsetPointXY_PR_node_XY2, nodes->list.array[0]->delta.present);
+    CHECK_EQUAL_C_INT(NodeOffsetPointXY_PR_node_XY4, nodes->list.array[1]->delta.present);
+    CHECK_EQUAL_C_INT(NodeOffsetPointXY_PR_node_XY6, nodes->list.array[2]->delta.present);
+    CHECK_EQUAL_C_INT(LaneTypeAttributes_PR_sidewalk,
+                      geometry->laneSet.list.array[1]->laneAttributes.laneType.present);
+
+    libsm_map_t compiled;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_compile(map, NULL, &compiled));
+    CHECK_EQUAL_C_INT(2, (int)compiled.laneCount);
+    libsm_map_lane_t const* lane = libsm_map_find_lane(&compiled, 1234, 1);
+    CHECK_C(lane != NULL);
+    CHECK_EQUAL_C_INT(LIBSM_MAP_INGRESS, lane->direction);
+    CHECK_EQUAL_C_INT(3, (int)lane->pointCount);
+    CHECK_EQUAL_C_INT(2, (int)lane->connectionCount);
+    CHECK_EQUAL_C_INT(4, compiled.connections[lane->firstConnection].signalGroup);
+    CHECK_EQUAL_C_INT(LIBSM_MAP_NO_SIGNAL_GROUP,
+                      compiled.connections[lane->firstConnection + 1].signalGroup);
+    CHECK_EQUAL_C_INT(LIBSM_MAP_EGRESS, libsm_map_find_lane(&compiled, 1234, 2)->direction);
+    libsm_map_free(&compiled);
+    ASN_STRUCT_RESET(asn_DEF_MessageFrame, &decoded);
+}
+
+
+TEST_C(test_map, uper_cache_by_revision)
+{
+    libsm_map_uper_cache_t cache;
+    uint8_t const* encoded;
+    uint8_t const* again;
+    size_t len;
+    size_t againLen;
+    MessageFrame_t* mf = buildMap(1234, 1);
+
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_map_uper_cache_init(NULL, 1, 512));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_map_uper_cache_init(&cache, 0, 512));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_map_uper_cache_init(&cache, 1, 0));
+
+    // too small a slot fails, and is not cached
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_uper_cache_init(&cache, 1, 4));
+    for (int i = 0; i < 2; i++) {
+        CHECK_EQUAL_C_INT(LIBSM_FAIL_ENCODING_BUFF_SIZE,
+                          libsm_map_uper_cache_get(&cache, mf, &encoded, &len));
+    }
+    CHECK_EQUAL_C_INT(0, (int)cache.encodes);
+    libsm_map_uper_cache_free(&cache);
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_map_uper_cache_get(&cache, mf, &encoded, &len));
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_uper_cache_init(&cache, 2, 512));
+    MessageFrame_t* spat = libsm_alloc_init_mf_spat();
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER,
+                      libsm_map_uper_cache_get(&cache, spat, &encoded, &len));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, spat);
+
+    uint8_t expected[512];
+    size_t expectedLen = sizeof(expected);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, expected, &expectedLen));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_uper_cache_get(&cache, mf, &encoded, &len));
+    CHECK_EQUAL_C_INT((int)expectedLen, (int)len);
+    CHECK_C(memcmp(expected, encoded, len) == 0);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_uper_cache_get(&cache, mf, &again, &againLen));
+    CHECK_C(again == encoded);
+    CHECK_EQUAL_C_INT(1, (int)cache.encodes);
+    CHECK_EQUAL_C_INT(1, (int)cache.hits);
+
+    // an edit without a new revision keeps the old bytes until invalidated
+    MapData_t* map = libsm_get_map(mf);
+    map->intersections->list.array[0]->refPoint.lat += 100;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_uper_cache_get(&cache, mf, &again, &againLen));
+    CHECK_C(memcmp(expected, again, againLen) == 0);
+    libsm_map_uper_cache_invalidate(&cache, map);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_uper_cache_get(&cache, mf, &again, &againLen));
+    CHECK_C(memcmp(expected, again, againLen) != 0);
+    CHECK_EQUAL_C_INT(2, (int)cache.encodes);
+
+    map->msgIssueRevision = 2;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_uper_cache_get(&cache, mf, &again, &againLen));
+    CHECK_EQUAL_C_INT(3, (int)cache.encodes);
+
+    // two more intersections, the least recently used one is dropped
+    MessageFrame_t* other = buildMap(99, 1);
+    MessageFrame_t* third = buildMap(100, 1);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_uper_cache_get(&cache, other, &again, &againLen));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_uper_cache_get(&cache, mf, &again, &againLen));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_uper_cache_get(&cache, third, &again, &againLen));
+    CHECK_EQUAL_C_INT(5, (int)cache.encodes);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_uper_cache_get(&cache, mf, &again, &againLen));
+    CHECK_EQUAL_C_INT(5, (int)cache.encodes);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_uper_cache_get(&cache, other, &again, &againLen));
+    CHECK_EQUAL_C_INT(6, (int)cache.encodes);
+
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, third);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, other);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    libsm_map_uper_cache_free(&cache);
+}
+
+
+TEST_C(test_map, uper_cache_by_intersections)
+{
+    libsm_map_uper_cache_t cache;
+    uint8_t const* encoded;
+    uint8_t const* again;
+    size_t len;
+    size_t againLen;
+    uint8_t expected[512];
+    size_t expectedLen = sizeof(expected);
+
+    // the same first intersection, a second one in only one of them
+    MessageFrame_t* single = buildMap(1234, 1);
+    MessageFrame_t* corridor = buildMap(1234, 1);
+    IntersectionGeometry_t* geometry = libsm_add_map_intersectionGeometry(
+            libsm_get_map(corridor), 1235, REF_LAT + 1000, REF_LONG);
+    CHECK_C(geometry != NULL);
+    GenericLane_t* lane = libsm_add_map_genericLane(
+            geometry, 1, LIBSM_MAP_INGRESS, LaneTypeAttributes_PR_vehicle);
+    CHECK_C(libsm_add_map_nodeXY(lane, 180, -1000) != NULL);
+    CHECK_C(libsm_add_map_nodeXY(lane, 0, -3000) != NULL);
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_uper_cache_init(&cache, 2, 512));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_uper_cache_get(&cache, single, &encoded, &len));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(corridor, expected, &expectedLen));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_uper_cache_get(&cache, corridor, &again, &againLen));
+    CHECK_EQUAL_C_INT(2, (int)cache.encodes);
+    CHECK_C(again != encoded);
+    CHECK_EQUAL_C_INT((int)expectedLen, (int)againLen);
+    CHECK_C(memcmp(expected, again, againLen) == 0);
+
+    // both stay cached, and invalidating one leaves the other
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_uper_cache_get(&cache, single, &again, &againLen));
+    CHECK_C(again == encoded);
+    CHECK_EQUAL_C_INT(1, (int)cache.hits);
+    libsm_map_uper_cache_invalidate(&cache, libsm_get_map(corridor));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_uper_cache_get(&cache, single, &again, &againLen));
+    CHECK_EQUAL_C_INT(2, (int)cache.hits);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_map_uper_cache_get(&cache, corridor, &again, &againLen));
+    CHECK_EQUAL_C_INT(3, (int)cache.encodes);
+
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, corridor);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, single);
+    libsm_map_uper_cache_free(&cache);
+}
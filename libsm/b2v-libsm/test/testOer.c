@@ -0,0 +1,370 @@
+/*
+ * testOer.c
+ * Check the OER codec round trips UPER MessageFrames of every shape libsm builds
+ *
+ * Did you know? Documentation for how to write more tests is at https://cpputest.github.io/manual.html
+ */
+#include "CppUTest/TestHarness_c.h"
+#include "libsm.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define CORPUS_SIZE 200
+
+
+// xorshift, so every run checks the same corpus
+static uint32_t nextRandom(uint32_t* state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+
+static MessageFrame_t* buildBsm(uint32_t* seed)
+{
+    MessageFrame_t* mf = libsm_alloc_init_mf_bsm();
+    BasicSafetyMessage_t* bsm = &mf->value.choice.BasicSafetyMessage;
+    BSMcoreData_t* core = &bsm->coreData;
+    core->msgCnt = nextRandom(seed) % 128;
+    core->id.buf[0] = (uint8_t)nextRandom(seed);
+    core->secMark = nextRandom(seed) % 65536;
+    core->lat = -900000000 + (long)(nextRandom(seed) % 1800000001);
+    core->Long = -1799999999 + (long)(nextRandom(seed) % 3600000000u);
+    core->elev = -4096 + (long)(nextRandom(seed) % 65536);
+    core->speed = nextRandom(seed) % 8192;
+    core->heading = nextRandom(seed) % 28801;
+    core->angle = -126 + (long)(nextRandom(seed) % 254);
+    core->brakes.wheelBrakes.buf[0] = (uint8_t)(nextRandom(seed) & 0xF8);
+    core->size.width = nextRandom(seed) % 1024;
+    core->size.length = nextRandom(seed) % 4096;
+    if (nextRandom(seed) % 2) {
+        libsm_init_bsm_path_history(bsm);
+        VehicleSafetyExtensions_t* vse = libsm_get_partII_elem(
+                bsm,
+                BSMpartIIExtension__partII_Value_PR_VehicleSafetyExtensions);
+        int const crumbs = (int)(nextRandom(seed) % 22);
+        for (int i = 0; i < crumbs; i++) {
+            PathHistoryPoint_t* point = libsm_alloc_init_PathHistoryPoint();
+            point->latOffset = -131072 + (long)(nextRandom(seed) % 262144);
+            point->lonOffset = -131072 + (long)(nextRandom(seed) % 262144);
+            point->timeOffset = 1 + nextRandom(seed) % 65535;
+            ASN_SEQUENCE_ADD(&vse->pathHistory->crumbData.list, point);
+        }
+        if (nextRandom(seed) % 2) {
+            libsm_set_path_prediction(bsm, nextRandom(seed) % 201, nextRandom(seed) % 32768);
+        }
+    }
+    return mf;
+}
+
+
+static MessageFrame_t* buildPsm(uint32_t* seed)
+{
+    MessageFrame_t* mf = libsm_alloc_init_mf_psm();
+    PersonalSafetyMessage_t* psm = &mf->value.choice.PersonalSafetyMessage;
+    psm->msgCnt = nextRandom(seed) % 128;
+    psm->secMark = nextRandom(seed) % 65536;
+    psm->position.lat = -900000000 + (long)(nextRandom(seed) % 1800000001);
+    psm->position.Long = -1799999999 + (long)(nextRandom(seed) % 3600000000u);
+    psm->speed = nextRandom(seed) % 8192;
+    psm->heading = nextRandom(seed) % 28801;
+    return mf;
+}
+
+
+static MessageFrame_t* buildSpat(uint32_t* seed)
+{
+    MessageFrame_t* mf = libsm_alloc_init_mf_spat();
+    SPAT_t* spat = libsm_get_spat(mf);
+    int const intersections = 1 + (int)(nextRandom(seed) % 3);
+    for (int i = 0; i < intersections; i++) {
+        IntersectionState_t* intersection = i == 0
+                                                    ? spat->intersections.list.array[0]
+                                                    : libsm_add_spat_intersectionState(spat);
+        intersection->id.id = nextRandom(seed) % 65536;
+        intersection->revision = nextRandom(seed) % 128;
+        int const states = (int)(nextRandom(seed) % 8);
+        for (int s = 0; s < states; s++) {
+            MovementState_t* state = libsm_add_spat_intersectionState_movementState(intersection);
+            state->signalGroup = nextRandom(seed) % 256;
+            MovementEvent_t* event = state->state_time_speed.list.array[0];
+            event->eventState = nextRandom(seed) % 10;
+            if (nextRandom(seed) % 2) {
+                event = libsm_add_spat_movementState_movementEvent(state);
+                event->eventState = nextRandom(seed) % 10;
+            }
+        }
+    }
+    return mf;
+}
+
+
+static MessageFrame_t* buildTim(uint32_t* seed)
+{
+    MessageFrame_t* mf = libsm_alloc_init_partial_mf_tim();
+    TravelerInformation_t* tim = libsm_get_tim(mf);
+    tim->msgCnt = nextRandom(seed) % 128;
+
+    TravelerDataFrame_t* frame = libsm_alloc_init_partial_TravelerDataFrame();
+    libsm_init_TravelerDataFrame_msgId_choice_FurtherInfoID(frame);
+    GeographicalPath_t* path = libsm_alloc_init_GeographicalPath();
+    ASN_SEQUENCE_ADD(&frame->regions.list, path);
+
+    ITIScodesAndText_t* advisory = libsm_alloc_init_ITIScodesAndText();
+    char text[32];
+    snprintf(text, sizeof(text), "Stop sign %u ahead", nextRandom(seed) % 1000);
+    ITIScodesAndText__Member* member = libsm_alloc_init_ITIScodesAndText__Member_text(text);
+    ASN_SEQUENCE_ADD(&advisory->list, &member->item);
+    frame->content.choice.advisory = advisory;
+    frame->content.present = TravelerDataFrame__content_PR_advisory;
+    ASN_SEQUENCE_ADD(&tim->dataFrames.list, frame);
+    return mf;
+}
+
+
+static MessageFrame_t* buildAny(uint32_t* seed, int i)
+{
+    switch (i % 4) {
+        case 0:
+            return buildBsm(seed);
+        case 1:
+            return buildPsm(seed);
+        case 2:
+            return buildSpat(seed);
+        default:
+            return buildTim(seed);
+    }
+}
+
+
+// UPER -> OER -> UPER has to give the same bytes, and OER has to decode to the same structure
+static void checkRoundTrip(MessageFrame_t* mf)
+{
+    uint8_t uper[1024];
+    uint8_t oer[2048];
+    uint8_t back[1024];
+    size_t uperLen = sizeof(uper);
+    size_t oerLen = sizeof(oer);
+    size_t backLen = sizeof(back);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, uper, &uperLen));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_transcode_uper_to_oer(uper, uperLen, oer, &oerLen));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_transcode_oer_to_uper(oer, oerLen, back, &backLen));
+    CHECK_EQUAL_C_ULONG(uperLen, backLen);
+    CHECK_C(memcmp(uper, back, uperLen) == 0);
+
+    MessageFrame_t decoded = { 0 };
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_decode_messageframe_oer(oer, oerLen, &decoded));
+    CHECK_EQUAL_C_INT(0,
+                      asn_DEF_MessageFrame.op->compare_struct(&asn_DEF_MessageFrame, mf, &decoded));
+    ASN_STRUCT_RESET(asn_DEF_MessageFrame, &decoded);
+}
+
+
+TEST_C(oer, invalid_args)
+{
+    uint8_t buf[64];
+    size_t len = sizeof(buf);
+    size_t offset = 0;
+    size_t done = 0;
+    MessageFrame_t mf = { 0 };
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_encode_messageframe_oer(NULL, buf, &len));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_encode_messageframe_oer(&mf, NULL, &len));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_encode_messageframe_oer(&mf, buf, NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_decode_messageframe_oer(NULL, 1, &mf));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_decode_messageframe_oer(buf, 1, NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_DECODING_BUFF_SIZE, libsm_decode_messageframe_oer(buf, 0, &mf));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG,
+                      libsm_transcode_uper_to_oer_archive(NULL, NULL, 0, buf, &len, &done));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_oer_archive_next(buf, len, NULL, &mf));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_DECODING_BUFF_SIZE, libsm_oer_archive_next(buf, 0, &offset, &mf));
+}
+
+
+TEST_C(oer, bsm_layout)
+{
+    MessageFrame_t* mf = libsm_alloc_init_mf_bsm();
+    BSMcoreData_t* core = &mf->value.choice.BasicSafetyMessage.coreData;
+    core->msgCnt = 0x42;
+    core->id.buf[0] = 0xDE;
+    core->id.buf[1] = 0xAD;
+    core->id.buf[2] = 0xBE;
+    core->id.buf[3] = 0xEF;
+    core->secMark = 0x1234;
+    core->lat = 0x12345678;
+
+    uint8_t oer[128];
+    size_t len = sizeof(oer);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe_oer(mf, oer, &len));
+    uint8_t const expected[] = { 0x00, 0x00, 0x14, 0x2F, 0x00, 0x42, 0xDE, 0xAD,
+                                 0xBE, 0xEF, 0x12, 0x34, 0x12, 0x34, 0x56, 0x78 };
+    CHECK_EQUAL_C_ULONG(51, len);
+    CHECK_C(memcmp(expected, oer, sizeof(expected)) == 0);
+
+    size_t small = len - 1;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_ENCODING_BUFF_SIZE,
+                      libsm_encode_messageframe_oer(mf, oer, &small));
+
+    // OER has no room for a value outside the constraint
+    core->msgCnt = 128;
+    len = sizeof(oer);
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_CONSTRAINT, libsm_encode_messageframe_oer(mf, oer, &len));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
+
+
+TEST_C(oer, uper_round_trip)
+{
+    uint32_t seed = 37;
+    for (int i = 0; i < CORPUS_SIZE; i++) {
+        MessageFrame_t* mf = buildAny(&seed, i);
+        checkRoundTrip(mf);
+        ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    }
+}
+
+
+TEST_C(oer, damaged_input)
+{
+    uint32_t seed = 41;
+    for (int i = 0; i < CORPUS_SIZE; i++) {
+        MessageFrame_t* mf = buildAny(&seed, i);
+        uint8_t oer[2048];
+        size_t len = sizeof(oer);
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe_oer(mf, oer, &len));
+        ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+
+        // every truncation fails, the MessageFrame value is a length prefixed open type
+        for (size_t cut = 1; cut < len; cut++) {
+            MessageFrame_t decoded = { 0 };
+            CHECK_C(libsm_decode_messageframe_oer(oer, cut, &decoded) != LIBSM_OK);
+            ASN_STRUCT_RESET(asn_DEF_MessageFrame, &decoded);
+        }
+        // flipped bytes either decode to something or fail, but never crash or leak
+        uint8_t damaged[2048];
+        memcpy(damaged, oer, len);
+        damaged[nextRandom(&seed) % len] ^= (uint8_t)(1 + nextRandom(&seed) % 255);
+        MessageFrame_t decoded = { 0 };
+        libsm_decode_messageframe_oer(damaged, len, &decoded);
+        ASN_STRUCT_RESET(asn_DEF_MessageFrame, &decoded);
+    }
+}
+
+
+TEST_C(oer, rejects_values_outside_the_constraint)
+{
+    uint32_t seed = 43;
+    MessageFrame_t* mf = buildBsm(&seed);
+    uint8_t oer[2048];
+    uint8_t damaged[2048];
+    uint8_t uper[1024];
+    size_t len = sizeof(oer);
+    size_t uperLen = sizeof(uper);
+    MessageFrame_t decoded = { 0 };
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe_oer(mf, oer, &len));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_decode_messageframe_oer(oer, len, &decoded));
+    ASN_STRUCT_RESET(asn_DEF_MessageFrame, &decoded);
+
+    // the MessageFrame preamble, messageId, the open type length and the BSM preamble,
+    // then msgCnt, id, secMark and lat
+    size_t const core = 4 + (oer[3] < 0x80 ? 0 : (oer[3] & 0x7F)) + 1;
+    memcpy(damaged, oer, len);
+    damaged[core] = 0x80;
+    decoded = (MessageFrame_t){ 0 };
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_DECODING, libsm_decode_messageframe_oer(damaged, len, &decoded));
+    ASN_STRUCT_RESET(asn_DEF_MessageFrame, &decoded);
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_DECODING,
+                      libsm_transcode_oer_to_uper(damaged, len, uper, &uperLen));
+
+    memcpy(damaged, oer, len);
+    memset(&damaged[core + 7], 0xFF, 4);
+    damaged[core + 7] = 0x7F;
+    decoded = (MessageFrame_t){ 0 };
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_DECODING, libsm_decode_messageframe_oer(damaged, len, &decoded));
+    ASN_STRUCT_RESET(asn_DEF_MessageFrame, &decoded);
+}
+
+
+TEST_C(oer, skips_unknown_extensions)
+{
+    MessageFrame_t* mf = libsm_alloc_init_mf_bsm();
+    uint8_t oer[128];
+    size_t len = sizeof(oer);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe_oer(mf, oer, &len));
+
+    // a later revision of the BSM with one extension addition, an open type of two bytes
+    uint8_t const addition[] = { 0x02, 0x07, 0x80, 0x02, 0xAB, 0xCD };
+    memcpy(oer + len, addition, sizeof(addition));
+    oer[3] += sizeof(addition);
+    oer[4] |= 0x80;
+
+    MessageFrame_t decoded = { 0 };
+    CHECK_EQUAL_C_INT(LIBSM_OK,
+                      libsm_decode_messageframe_oer(oer, len + sizeof(addition), &decoded));
+    CHECK_EQUAL_C_INT(0,
+                      asn_DEF_MessageFrame.op->compare_struct(&asn_DEF_MessageFrame, mf, &decoded));
+    ASN_STRUCT_RESET(asn_DEF_MessageFrame, &decoded);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
+
+
+TEST_C(oer, archive_round_trip)
+{
+    uint32_t seed = 43;
+    uint8_t* uper = malloc(CORPUS_SIZE * 1024);
+    uint8_t const* messages[CORPUS_SIZE];
+    size_t lens[CORPUS_SIZE];
+    for (int i = 0; i < CORPUS_SIZE; i++) {
+        MessageFrame_t* mf = buildAny(&seed, i);
+        lens[i] = 1024;
+        messages[i] = uper + i * 1024;
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, uper + i * 1024, &lens[i]));
+        ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    }
+
+    size_t archiveSize = CORPUS_SIZE * 2048;
+    uint8_t* archive = malloc(archiveSize);
+    size_t done = 0;
+    size_t small = 100;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_ENCODING_BUFF_SIZE,
+                      libsm_transcode_uper_to_oer_archive(messages,
+                                                          lens,
+                                                          CORPUS_SIZE,
+                                                          archive,
+                                                          &small,
+                                                          &done));
+    CHECK_C(done < CORPUS_SIZE);
+    CHECK_C(small <= 100);
+
+    CHECK_EQUAL_C_INT(LIBSM_OK,
+                      libsm_transcode_uper_to_oer_archive(messages,
+                                                          lens,
+                                                          CORPUS_SIZE,
+                                                          archive,
+                                                          &archiveSize,
+                                                          &done));
+    CHECK_EQUAL_C_ULONG(CORPUS_SIZE, done);
+
+    size_t offset = 0;
+    for (int i = 0; i < CORPUS_SIZE; i++) {
+        MessageFrame_t mf = { 0 };
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_oer_archive_next(archive, archiveSize, &offset, &mf));
+        uint8_t back[1024];
+        size_t backLen = sizeof(back);
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(&mf, back, &backLen));
+        CHECK_EQUAL_C_ULONG(lens[i], backLen);
+        CHECK_C(memcmp(messages[i], back, backLen) == 0);
+        ASN_STRUCT_RESET(asn_DEF_MessageFrame, &mf);
+    }
+    CHECK_EQUAL_C_ULONG(archiveSize, offset);
+    MessageFrame_t mf = { 0 };
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_DECODING_BUFF_SIZE,
+                      libsm_oer_archive_next(archive, archiveSize, &offset, &mf));
+    free(archive);
+    free(uper);
+}
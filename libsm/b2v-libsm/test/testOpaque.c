@@ -0,0 +1,227 @@
+/*
+ * testOpaque.c
+ * Tests for relaying BSMs with their Part II and regional extensions kept encoded
+ *
+ * Did you know? Documentation for how to write more tests is at https://cpputest.github.io/manual.html
+ */
+#include "CppUTest/TestHarness_c.h"
+#include "libsm.h"
+
+#include "OPEN_TYPE.h"
+#include "PartIIcontent.h"
+#include "RegionalExtension.h"
+#include "jer_encoder.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+
+// A BSM with path history and prediction in its Part II
+static size_t encodeBsm(uint8_t* encoded, size_t len)
+{
+    MessageFrame_t* mf = libsm_alloc_init_mf_bsm();
+    CHECK_C(mf != NULL);
+    BasicSafetyMessage_t* bsm = libsm_get_bsm(mf);
+    bsm->coreData.speed = 1234;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_init_bsm_path_history(bsm));
+    VehicleSafetyExtensions_t* vse = libsm_get_partII_elem(
+            bsm, BSMpartIIExtension__partII_Value_PR_VehicleSafetyExtensions);
+    CHECK_C(vse != NULL);
+    for (int i = 0; i < 5; i++) {
+        PathHistoryPoint_t* point = libsm_alloc_init_PathHistoryPoint();
+        point->latOffset = -100 * i;
+        point->lonOffset = 50 * i;
+        point->timeOffset = 10 * (i + 1);
+        ASN_SEQUENCE_ADD(&vse->pathHistory->crumbData.list, point);
+    }
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_set_path_prediction(bsm, 150, 32767));
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, encoded, &len));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    return len;
+}
+
+
+static int countJer(void const* buffer, size_t size, void* key)
+{
+    (void)buffer;
+    *(size_t*)key += size;
+    return 0;
+}
+
+
+TEST_C(opaque, relay_bit_exact)
+{
+    uint8_t encoded[512];
+    size_t const len = encodeBsm(encoded, sizeof(encoded));
+
+    MessageFrame_t* mf = calloc(1, sizeof(MessageFrame_t));
+    CHECK_EQUAL_C_INT(LIBSM_OK,
+                      libsm_decode_messageframe_opaque(
+                              encoded, len, mf, libsm_bsm_extension_types));
+    BasicSafetyMessage_t* bsm = libsm_get_bsm(mf);
+    CHECK_C(bsm != NULL);
+    CHECK_EQUAL_C_LONG(1234, bsm->coreData.speed);
+    CHECK_C(bsm->partII != NULL);
+    CHECK_EQUAL_C_INT(1, bsm->partII->list.count);
+    BSMpartIIExtension_t* part = bsm->partII->list.array[0];
+    CHECK_EQUAL_C_LONG(PartII_Id_vehicleSafetyExt, part->partII_Id);
+    CHECK_EQUAL_C_INT(BSMpartIIExtension__partII_Value_PR_NOTHING, part->partII_Value.present);
+    asn_open_type_opaque_t const* opaque
+            = OPEN_TYPE_get_opaque(asn_DEF_BSMpartIIExtension.elements[1].type,
+                                   &part->partII_Value);
+    CHECK_C(opaque != NULL);
+    CHECK_C(opaque->size > 1);
+
+    // the same bits back
+    uint8_t reencoded[512];
+    size_t relen = sizeof(reencoded);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, reencoded, &relen));
+    CHECK_EQUAL_C_INT(len, relen);
+    CHECK_C(memcmp(encoded, reencoded, len) == 0);
+
+    // and with coreData rewritten, what the classic decoder makes of it
+    bsm->coreData.speed = 99;
+    relen = sizeof(reencoded);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, reencoded, &relen));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+
+    MessageFrame_t* original = calloc(1, sizeof(MessageFrame_t));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_decode_messageframe(encoded, len, original));
+    MessageFrame_t* relayed = calloc(1, sizeof(MessageFrame_t));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_decode_messageframe(reencoded, relen, relayed));
+    CHECK_EQUAL_C_LONG(99, libsm_get_bsm(relayed)->coreData.speed);
+    CHECK_EQUAL_C_INT(0,
+                      asn_DEF_BSMpartIIExtension.op->compare_struct(
+                              &asn_DEF_BSMpartIIExtension,
+                              libsm_get_bsm(original)->partII->list.array[0],
+                              libsm_get_bsm(relayed)->partII->list.array[0]));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, original);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, relayed);
+}
+
+
+TEST_C(opaque, materialize)
+{
+    uint8_t encoded[512];
+    size_t const len = encodeBsm(encoded, sizeof(encoded));
+
+    MessageFrame_t* mf = calloc(1, sizeof(MessageFrame_t));
+    CHECK_EQUAL_C_INT(LIBSM_OK,
+                      libsm_decode_messageframe_opaque(
+                              encoded, len, mf, libsm_bsm_extension_types));
+    BSMpartIIExtension_t* part = libsm_get_bsm(mf)->partII->list.array[0];
+
+    // JER needs it decoded
+    size_t jer = 0;
+    CHECK_EQUAL_C_INT(
+            -1, jer_encode(&asn_DEF_MessageFrame, mf, JER_F_MINIFIED, countJer, &jer).encoded);
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_materialize_open_types(&asn_DEF_BSMpartIIExtension, part));
+    CHECK_EQUAL_C_INT(BSMpartIIExtension__partII_Value_PR_VehicleSafetyExtensions,
+                      part->partII_Value.present);
+    CHECK_C(OPEN_TYPE_get_opaque(asn_DEF_BSMpartIIExtension.elements[1].type,
+                                 &part->partII_Value)
+            == NULL);
+    VehicleSafetyExtensions_t* vse = &part->partII_Value.choice.VehicleSafetyExtensions;
+    CHECK_C(vse->pathHistory != NULL);
+    CHECK_EQUAL_C_INT(6, vse->pathHistory->crumbData.list.count);
+    CHECK_EQUAL_C_LONG(-400, vse->pathHistory->crumbData.list.array[5]->latOffset);
+
+    // once is enough
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_materialize_open_types(&asn_DEF_BSMpartIIExtension, part));
+    CHECK_C(jer_encode(&asn_DEF_MessageFrame, mf, JER_F_MINIFIED, countJer, &jer).encoded > 0);
+
+    uint8_t reencoded[512];
+    size_t relen = sizeof(reencoded);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, reencoded, &relen));
+    CHECK_EQUAL_C_INT(len, relen);
+    CHECK_C(memcmp(encoded, reencoded, len) == 0);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_materialize_open_types(NULL, part));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG,
+                      libsm_decode_messageframe_opaque(encoded, len, NULL,
+                                                       libsm_bsm_extension_types));
+}
+
+
+TEST_C(opaque, copy_and_compare)
+{
+    uint8_t encoded[512];
+    size_t const len = encodeBsm(encoded, sizeof(encoded));
+
+    MessageFrame_t* mf = calloc(1, sizeof(MessageFrame_t));
+    CHECK_EQUAL_C_INT(LIBSM_OK,
+                      libsm_decode_messageframe_opaque(
+                              encoded, len, mf, libsm_bsm_extension_types));
+    MessageFrame_t* copy = NULL;
+    CHECK_EQUAL_C_INT(0, asn_DEF_MessageFrame.op->copy_struct(
+                                 &asn_DEF_MessageFrame, (void**)&copy, mf));
+    CHECK_EQUAL_C_INT(0, asn_DEF_MessageFrame.op->compare_struct(&asn_DEF_MessageFrame, mf, copy));
+    CHECK_EQUAL_C_INT(0, asn_check_constraints(&asn_DEF_MessageFrame, copy, NULL, NULL));
+
+    uint8_t reencoded[512];
+    size_t relen = sizeof(reencoded);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(copy, reencoded, &relen));
+    CHECK_EQUAL_C_INT(len, relen);
+    CHECK_C(memcmp(encoded, reencoded, len) == 0);
+
+    // an opaque one is not a decoded one
+    BSMpartIIExtension_t* part = libsm_get_bsm(copy)->partII->list.array[0];
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_materialize_open_types(&asn_DEF_BSMpartIIExtension, part));
+    CHECK_C(asn_DEF_MessageFrame.op->compare_struct(&asn_DEF_MessageFrame, mf, copy) != 0);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, copy);
+}
+
+
+TEST_C(opaque, unknown_regional)
+{
+    uint8_t encoded[512];
+    size_t len = encodeBsm(encoded, sizeof(encoded));
+    MessageFrame_t* mf = calloc(1, sizeof(MessageFrame_t));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_decode_messageframe(encoded, len, mf));
+
+    // a region this J2735 has no type for, 2 octets of it as they would arrive
+    BasicSafetyMessage_t* bsm = libsm_get_bsm(mf);
+    bsm->regional = calloc(1, sizeof(*bsm->regional));
+    Reg_BasicSafetyMessage_t* reg = calloc(1, sizeof(Reg_BasicSafetyMessage_t));
+    reg->regionId = 99;
+    asn_open_type_opaque_t* opaque = malloc(sizeof(asn_open_type_opaque_t) + 3);
+    opaque->buf = (uint8_t*)(opaque + 1);
+    opaque->size = 3;
+    memcpy(opaque->buf, "\x02\xab\xcd", 3);
+    reg->regExtValue._asn_ctx.ptr = opaque;
+    reg->regExtValue._asn_ctx.phase = ASN_OPEN_TYPE_OPAQUE;
+    ASN_SEQUENCE_ADD(&bsm->regional->list, reg);
+    len = sizeof(encoded);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, encoded, &len));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+
+    // only a relay takes it
+    mf = calloc(1, sizeof(MessageFrame_t));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_DECODING, libsm_decode_messageframe(encoded, len, mf));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+
+    mf = calloc(1, sizeof(MessageFrame_t));
+    CHECK_EQUAL_C_INT(LIBSM_OK,
+                      libsm_decode_messageframe_opaque(
+                              encoded, len, mf, libsm_bsm_extension_types));
+    reg = libsm_get_bsm(mf)->regional->list.array[0];
+    CHECK_EQUAL_C_LONG(99, reg->regionId);
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_DECODING,
+                      libsm_materialize_open_types(&asn_DEF_Reg_BasicSafetyMessage, reg));
+    opaque = (asn_open_type_opaque_t*)OPEN_TYPE_get_opaque(
+            asn_DEF_Reg_BasicSafetyMessage.elements[1].type, &reg->regExtValue);
+    CHECK_C(opaque != NULL);
+    CHECK_EQUAL_C_INT(3, opaque->size);
+    CHECK_C(memcmp(opaque->buf, "\x02\xab\xcd", 3) == 0);
+
+    uint8_t reencoded[512];
+    size_t relen = sizeof(reencoded);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, reencoded, &relen));
+    CHECK_EQUAL_C_INT(len, relen);
+    CHECK_C(memcmp(encoded, reencoded, len) == 0);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
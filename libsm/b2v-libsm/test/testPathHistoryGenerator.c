@@ -0,0 +1,246 @@
+/*
+ * testPathHistoryGenerator.c
+ * Tests for the incremental concise path history generator
+ *
+ * Did you know? Documentation for how to write more tests is at https://cpputest.github.io/manual.html
+ */
+#include "CppUTest/TestHarness_c.h"
+#include "libsm.h"
+
+#include <math.h>
+
+// a point near the intersections the DriveAZ data was collected at
+#define ORIGIN_LAT  334150000
+#define ORIGIN_LONG -1119260000
+
+// 10 Hz fixes, meters east/north of the origin
+static libsm_ph_fix_t fixAt(double east, double north, uint64_t timeMs)
+{
+    double const metersPerUnit = Latitude_m_per_unit;
+    double const cosLat = cos((double)ORIGIN_LAT / Latitude_unit_deg * (M_PI / 180.0));
+    libsm_ph_fix_t fix = {
+        .lat = ORIGIN_LAT + lround(north / metersPerUnit),
+        .Long = ORIGIN_LONG + lround(east / (metersPerUnit * cosLat)),
+        .elev = 3400,
+        .timeMs = timeMs,
+    };
+    return fix;
+}
+
+TEST_C(path_history_generator, null_args)
+{
+    libsm_ph_gen_t gen;
+    libsm_ph_fix_t fix = fixAt(0, 0, 0);
+
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_ph_gen_init(NULL));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_ph_gen_init(&gen));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_ph_gen_add_fix(NULL, &fix));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_ph_gen_add_fix(&gen, NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_ph_gen_fill_path_history(&gen, NULL));
+}
+
+TEST_C(path_history_generator, not_enough_history)
+{
+    libsm_ph_gen_t gen;
+    libsm_ph_fix_t fix = fixAt(0, 0, 1000);
+    PathHistory_t* ph = libsm_alloc_init_path_history();
+
+    libsm_ph_gen_init(&gen);
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_CONSTRAINT, libsm_ph_gen_fill_path_history(&gen, ph));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_ph_gen_add_fix(&gen, &fix));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_CONSTRAINT, libsm_ph_gen_fill_path_history(&gen, ph));
+
+    fix.lat = Latitude_unavailable;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_CONSTRAINT, libsm_ph_gen_add_fix(&gen, &fix));
+    fix = fixAt(1, 0, 900);
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_CONSTRAINT, libsm_ph_gen_add_fix(&gen, &fix));
+
+    ASN_STRUCT_FREE(asn_DEF_PathHistory, ph);
+}
+
+TEST_C(path_history_generator, straight_line_is_one_point)
+{
+    libsm_ph_gen_t gen;
+    PathHistory_t* ph = libsm_alloc_init_path_history();
+
+    libsm_ph_gen_init(&gen);
+    // 1.5 m/s north for 40 seconds
+    for (int i = 0; i <= 400; i++) {
+        libsm_ph_fix_t fix = fixAt(0, 0.15 * i, 100 * i);
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_ph_gen_add_fix(&gen, &fix));
+    }
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_ph_gen_fill_path_history(&gen, ph));
+
+    CHECK_EQUAL_C_INT(1, ph->crumbData.list.count);
+    PathHistoryPoint_t* point = ph->crumbData.list.array[0];
+    CHECK_EQUAL_C_LONG(4000, point->timeOffset);
+    CHECK_C(point->latOffset < -5000 && point->latOffset > -6000);
+    CHECK_C(labs(point->lonOffset) < 10);
+    CHECK_EQUAL_C_LONG(0, point->elevationOffset);
+
+    ASN_STRUCT_FREE(asn_DEF_PathHistory, ph);
+}
+
+TEST_C(path_history_generator, corner_is_kept)
+{
+    libsm_ph_gen_t gen;
+    PathHistory_t* ph = libsm_alloc_init_path_history();
+    uint64_t time = 0;
+
+    libsm_ph_gen_init(&gen);
+    // 20m east, then 20m north
+    for (int i = 0; i <= 20; i++, time += 100) {
+        libsm_ph_fix_t fix = fixAt(i, 0, time);
+        libsm_ph_gen_add_fix(&gen, &fix);
+    }
+    for (int i = 1; i <= 20; i++, time += 100) {
+        libsm_ph_fix_t fix = fixAt(20, i, time);
+        libsm_ph_gen_add_fix(&gen, &fix);
+    }
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_ph_gen_fill_path_history(&gen, ph));
+
+    // newest first: the corner, then the start
+    CHECK_EQUAL_C_INT(2, ph->crumbData.list.count);
+    libsm_ph_fix_t const corner = fixAt(20, 0, 2000);
+    libsm_ph_fix_t const start = fixAt(0, 0, 0);
+    libsm_ph_fix_t const now = fixAt(20, 20, 4000);
+    CHECK_EQUAL_C_LONG(corner.lat - now.lat, ph->crumbData.list.array[0]->latOffset);
+    CHECK_EQUAL_C_LONG(corner.Long - now.Long, ph->crumbData.list.array[0]->lonOffset);
+    CHECK_EQUAL_C_LONG(200, ph->crumbData.list.array[0]->timeOffset);
+    CHECK_EQUAL_C_LONG(start.lat - now.lat, ph->crumbData.list.array[1]->latOffset);
+    CHECK_EQUAL_C_LONG(400, ph->crumbData.list.array[1]->timeOffset);
+
+    ASN_STRUCT_FREE(asn_DEF_PathHistory, ph);
+}
+
+TEST_C(path_history_generator, staircase_is_capped)
+{
+    libsm_ph_gen_t gen;
+    PathHistory_t* ph = libsm_alloc_init_path_history();
+    double east = 0.0;
+    double north = 0.0;
+
+    libsm_ph_gen_init(&gen);
+    gen.minDistance = 0;
+    // 3 meter legs alternating east and north, every corner needs a point
+    for (int i = 0; i < 2000; i++) {
+        libsm_ph_fix_t fix = fixAt(east, north, 100 * i);
+        libsm_ph_gen_add_fix(&gen, &fix);
+        if ((i / 20) % 2) {
+            north += 0.15;
+        } else {
+            east += 0.15;
+        }
+    }
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_ph_gen_fill_path_history(&gen, ph));
+    CHECK_EQUAL_C_INT(vruMaxPHistPoints, ph->crumbData.list.count);
+
+    ASN_STRUCT_FREE(asn_DEF_PathHistory, ph);
+}
+
+TEST_C(path_history_generator, min_distance)
+{
+    libsm_ph_gen_t gen;
+    PathHistory_t* ph = libsm_alloc_init_path_history();
+    double east = 0.0;
+    double north = 0.0;
+
+    libsm_ph_gen_init(&gen);
+    CHECK_C(gen.minDistance == vruMinPHistDistance);
+    // the staircase again, its corners are closer than vruMinPHistDistance
+    for (int i = 0; i < 2000; i++) {
+        libsm_ph_fix_t fix = fixAt(east, north, 100 * i);
+        libsm_ph_gen_add_fix(&gen, &fix);
+        if ((i / 20) % 2) {
+            north += 0.15;
+        } else {
+            east += 0.15;
+        }
+    }
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_ph_gen_fill_path_history(&gen, ph));
+    CHECK_C(ph->crumbData.list.count > 1);
+
+    // from the current position to each point in turn
+    double const cosLat = cos((double)ORIGIN_LAT / Latitude_unit_deg * (M_PI / 180.0));
+    long lat = 0;
+    long lon = 0;
+    for (int i = 0; i < ph->crumbData.list.count; i++) {
+        PathHistoryPoint_t const* point = ph->crumbData.list.array[i];
+        double const dy = (double)(point->latOffset - lat) * Latitude_m_per_unit;
+        double const dx = (double)(point->lonOffset - lon) * Latitude_m_per_unit * cosLat;
+        CHECK_C(hypot(dx, dy) >= vruMinPHistDistance - 0.01);
+        lat = point->latOffset;
+        lon = point->lonOffset;
+    }
+
+    // without a minimum every corner is back
+    int const spaced = ph->crumbData.list.count;
+    gen.minDistance = 0;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_ph_gen_fill_path_history(&gen, ph));
+    CHECK_C(ph->crumbData.list.count > spaced);
+
+    ASN_STRUCT_FREE(asn_DEF_PathHistory, ph);
+}
+
+TEST_C(path_history_generator, fill_psm_reuses_points_and_encodes)
+{
+    libsm_ph_gen_t gen;
+    MessageFrame_t* mf = libsm_alloc_init_mf_psm();
+    PersonalSafetyMessage_t* psm = libsm_get_psm(mf);
+    uint8_t encoded[512];
+    size_t len;
+    uint64_t time = 0;
+
+    libsm_ph_gen_init(&gen);
+    for (int i = 0; i <= 20; i++, time += 100) {
+        libsm_ph_fix_t fix = fixAt(i, 0, time);
+        libsm_ph_gen_add_fix(&gen, &fix);
+    }
+    for (int i = 1; i <= 20; i++, time += 100) {
+        libsm_ph_fix_t fix = fixAt(20, i, time);
+        libsm_ph_gen_add_fix(&gen, &fix);
+    }
+    psm->position.lat = gen.last.lat;
+    psm->position.Long = gen.last.Long;
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_ph_gen_fill_psm(&gen, psm));
+    PathHistoryPoint_t* first = psm->pathHistory->crumbData.list.array[0];
+
+    libsm_ph_fix_t fix = fixAt(20, 20.1, time);
+    libsm_ph_gen_add_fix(&gen, &fix);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_ph_gen_fill_psm(&gen, psm));
+    CHECK_C(first == psm->pathHistory->crumbData.list.array[0]);
+
+    len = sizeof(encoded);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, encoded, &len));
+
+    MessageFrame_t* decoded = calloc(1, sizeof(MessageFrame_t));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_decode_messageframe(encoded, len, decoded));
+    CHECK_EQUAL_C_INT(2, libsm_get_psm(decoded)->pathHistory->crumbData.list.count);
+
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, decoded);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
+
+TEST_C(path_history_generator, fill_bsm)
+{
+    libsm_ph_gen_t gen;
+    MessageFrame_t* mf = libsm_alloc_init_mf_bsm();
+    BasicSafetyMessage_t* bsm = libsm_get_bsm(mf);
+
+    libsm_ph_gen_init(&gen);
+    for (int i = 0; i <= 10; i++) {
+        libsm_ph_fix_t fix = fixAt(0, i, 100 * i);
+        libsm_ph_gen_add_fix(&gen, &fix);
+    }
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_ph_gen_fill_bsm(&gen, bsm));
+
+    VehicleSafetyExtensions_t* vse = libsm_get_partII_elem(
+            bsm,
+            BSMpartIIExtension__partII_Value_PR_VehicleSafetyExtensions);
+    CHECK_C(vse != NULL);
+    CHECK_EQUAL_C_INT(1, vse->pathHistory->crumbData.list.count);
+    CHECK_EQUAL_C_LONG(100, vse->pathHistory->crumbData.list.array[0]->timeOffset);
+
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
@@ -0,0 +1,241 @@
+/*
+ * testPipeline.c
+ * Check the ingest pipeline hands every frame to the sink of its type, once, and throttles
+ *
+ * Did you know? Documentation for how to write more tests is at https://cpputest.github.io/manual.html
+ */
+#include "CppUTest/TestHarness_c.h"
+#include "libsm.h"
+
+#include <stdatomic.h>
+#include <string.h>
+
+#define FRAMES 1000
+#define SLOT 4096
+
+
+typedef struct {
+    atomic_ulong frames;
+    atomic_ulong lats;
+    atomic_ulong wrongType;
+    long messageId;
+} counter_t;
+
+
+static void countFrame(void* user, unsigned worker, MessageFrame_t* mf)
+{
+    counter_t* counter = user;
+    (void)worker;
+    atomic_fetch_add(&counter->frames, 1);
+    if (mf->messageId != counter->messageId) {
+        atomic_fetch_add(&counter->wrongType, 1);
+    }
+    if (libsm_mf_has_bsm(mf)) {
+        long const lat = mf->value.choice.BasicSafetyMessage.coreData.lat;
+        atomic_fetch_add(&counter->lats, (unsigned long)lat);
+    }
+}
+
+
+static void countError(void* user,
+                       unsigned worker,
+                       uint8_t const* encoded,
+                       size_t len,
+                       libsm_rval_e rval)
+{
+    counter_t* counter = user;
+    (void)worker;
+    (void)encoded;
+    (void)len;
+    (void)rval;
+    atomic_fetch_add(&counter->frames, 1);
+}
+
+
+static void blockFrame(void* user, unsigned worker, MessageFrame_t* mf)
+{
+    atomic_bool* release = user;
+    (void)worker;
+    (void)mf;
+    while (!atomic_load(release)) {
+    }
+}
+
+
+TEST_C(pipeline, invalid_args)
+{
+    libsm_pipeline_t pipeline;
+    libsm_pipeline_config_t config;
+    libsm_pipeline_stats_t stats;
+    uint8_t frame[2] = { 0 };
+
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_pipeline_default_config(NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_pipeline_init(NULL, NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_pipeline_start(NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_pipeline_stats(NULL, &stats));
+    libsm_pipeline_free(NULL);
+
+    libsm_pipeline_default_config(&config);
+    config.batchesPerWorker = 3;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_pipeline_init(&pipeline, &config));
+    libsm_pipeline_default_config(&config);
+    config.batchSize = LIBSM_PIPELINE_BATCH_MAX + 1;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_pipeline_init(&pipeline, &config));
+
+    libsm_pipeline_default_config(&config);
+    config.workers = 2;
+    config.batchBytes = 1024;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_pipeline_init(&pipeline, &config));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_pipeline_submit(&pipeline, frame, 2));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_pipeline_drain(&pipeline));
+    for (long id = 0; id < LIBSM_PIPELINE_SINKS_MAX; id++) {
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_pipeline_set_sink(&pipeline, id, countFrame, NULL));
+    }
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_pipeline_set_sink(&pipeline, 3, NULL, NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER,
+                      libsm_pipeline_set_sink(&pipeline, 99, countFrame, NULL));
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_pipeline_start(&pipeline));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_pipeline_start(&pipeline));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER,
+                      libsm_pipeline_set_sink(&pipeline, -1, countFrame, NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_pipeline_submit(&pipeline, NULL, 2));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_DECODING_BUFF_SIZE, libsm_pipeline_submit(&pipeline, frame, 0));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_DECODING_BUFF_SIZE,
+                      libsm_pipeline_submit(&pipeline, frame, 1025));
+    libsm_pipeline_free(&pipeline);
+    CHECK_C(pipeline.state == NULL);
+}
+
+
+// BSMs and PSMs reach their own sinks, SPaTs the default one, TIMs are skipped
+TEST_C(pipeline, frames_reach_their_sinks)
+{
+    libsm_corpus_config_t corpusConfig;
+    libsm_corpus_default_config(&corpusConfig);
+    corpusConfig.seed = 2042;
+    libsm_pipeline_config_t config;
+    libsm_pipeline_default_config(&config);
+    config.workers = 3;
+    config.batchSize = 7;
+    config.batchesPerWorker = 2;
+    libsm_pipeline_t pipeline;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_pipeline_init(&pipeline, &config));
+
+    counter_t bsm = { .messageId = DSRCmsgID_basicSafetyMessage };
+    counter_t psm = { .messageId = DSRCmsgID_personalSafetyMessage };
+    counter_t spat = { .messageId = DSRCmsgID_signalPhaseAndTimingMessage };
+    libsm_pipeline_set_sink(&pipeline, DSRCmsgID_basicSafetyMessage, countFrame, &bsm);
+    libsm_pipeline_set_sink(&pipeline, DSRCmsgID_personalSafetyMessage, countFrame, &psm);
+    libsm_pipeline_set_sink(&pipeline, DSRCmsgID_travelerInformation, NULL, NULL);
+    libsm_pipeline_set_sink(&pipeline, -1, countFrame, &spat);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_pipeline_start(&pipeline));
+
+    unsigned long expected[4] = { 0 };
+    unsigned long lats = 0;
+    for (uint64_t i = 0; i < FRAMES; i++) {
+        uint8_t encoded[SLOT];
+        size_t len = sizeof(encoded);
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_corpus_message(&corpusConfig, i, encoded, &len));
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_pipeline_submit(&pipeline, encoded, len));
+
+        MessageFrame_t mf = { 0 };
+        libsm_decode_messageframe(encoded, len, &mf);
+        expected[0] += libsm_mf_has_bsm(&mf);
+        expected[1] += libsm_mf_has_psm(&mf);
+        expected[2] += mf.messageId == DSRCmsgID_signalPhaseAndTimingMessage;
+        expected[3] += mf.messageId == DSRCmsgID_travelerInformation;
+        if (libsm_mf_has_bsm(&mf)) {
+            lats += (unsigned long)mf.value.choice.BasicSafetyMessage.coreData.lat;
+        }
+        ASN_STRUCT_RESET(asn_DEF_MessageFrame, &mf);
+    }
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_pipeline_drain(&pipeline));
+
+    CHECK_EQUAL_C_ULONG(expected[0], atomic_load(&bsm.frames));
+    CHECK_EQUAL_C_ULONG(expected[1], atomic_load(&psm.frames));
+    CHECK_EQUAL_C_ULONG(expected[2], atomic_load(&spat.frames));
+    CHECK_EQUAL_C_ULONG(lats, atomic_load(&bsm.lats));
+    CHECK_EQUAL_C_ULONG(0, atomic_load(&bsm.wrongType) + atomic_load(&psm.wrongType)
+                                   + atomic_load(&spat.wrongType));
+    CHECK_C(expected[3] > 0);
+
+    libsm_pipeline_stats_t stats;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_pipeline_stats(&pipeline, &stats));
+    CHECK_EQUAL_C_ULONG(FRAMES, stats.submitted);
+    CHECK_EQUAL_C_ULONG(expected[0] + expected[1] + expected[2], stats.decoded);
+    CHECK_EQUAL_C_ULONG(expected[3], stats.dropped);
+    CHECK_EQUAL_C_ULONG(0, stats.failed);
+    libsm_pipeline_free(&pipeline);
+}
+
+
+TEST_C(pipeline, damaged_frames_reach_the_error_sink)
+{
+    libsm_pipeline_t pipeline;
+    libsm_pipeline_config_t config;
+    libsm_pipeline_default_config(&config);
+    config.workers = 2;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_pipeline_init(&pipeline, &config));
+    counter_t bsm = { .messageId = DSRCmsgID_basicSafetyMessage };
+    counter_t errors = { 0 };
+    libsm_pipeline_set_sink(&pipeline, DSRCmsgID_basicSafetyMessage, countFrame, &bsm);
+    libsm_pipeline_set_error_sink(&pipeline, countError, &errors);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_pipeline_start(&pipeline));
+
+    MessageFrame_t* mf = libsm_alloc_init_mf_bsm();
+    uint8_t encoded[SLOT];
+    size_t len = sizeof(encoded);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, encoded, &len));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_pipeline_submit(&pipeline, encoded, len));
+    // a BSM header, cut short
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_pipeline_submit(&pipeline, encoded, 4));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_pipeline_drain(&pipeline));
+
+    CHECK_EQUAL_C_ULONG(1, atomic_load(&bsm.frames));
+    CHECK_EQUAL_C_ULONG(1, atomic_load(&errors.frames));
+    libsm_pipeline_stats_t stats;
+    libsm_pipeline_stats(&pipeline, &stats);
+    CHECK_EQUAL_C_ULONG(1, stats.failed);
+    libsm_pipeline_free(&pipeline);
+}
+
+
+// With the only worker stuck in a sink, try_submit refuses once every batch is taken
+TEST_C(pipeline, back_pressure)
+{
+    libsm_pipeline_t pipeline;
+    libsm_pipeline_config_t config;
+    libsm_pipeline_default_config(&config);
+    config.workers = 1;
+    config.batchSize = 1;
+    config.batchesPerWorker = 4;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_pipeline_init(&pipeline, &config));
+    atomic_bool release = false;
+    libsm_pipeline_set_sink(&pipeline, -1, blockFrame, &release);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_pipeline_start(&pipeline));
+
+    MessageFrame_t* mf = libsm_alloc_init_mf_bsm();
+    uint8_t encoded[SLOT];
+    size_t len = sizeof(encoded);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, encoded, &len));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+
+    unsigned accepted = 0;
+    while (libsm_pipeline_try_submit(&pipeline, encoded, len) == LIBSM_OK) {
+        accepted++;
+    }
+    CHECK_EQUAL_C_UINT(4, accepted);
+    libsm_pipeline_stats_t stats;
+    libsm_pipeline_stats(&pipeline, &stats);
+    CHECK_EQUAL_C_ULONG(4, stats.submitted);
+    CHECK_C(stats.stalls > 0);
+
+    atomic_store(&release, true);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_pipeline_submit(&pipeline, encoded, len));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_pipeline_drain(&pipeline));
+    libsm_pipeline_stats(&pipeline, &stats);
+    CHECK_EQUAL_C_ULONG(5, stats.decoded);
+    libsm_pipeline_free(&pipeline);
+}
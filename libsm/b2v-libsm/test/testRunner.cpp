@@ -54,6 +54,194 @@ TEST_C_WRAPPER(path_history, store_and_access_psm)
 TEST_C_WRAPPER(path_history, store_and_access_bsm)
 TEST_C_WRAPPER(path_history, store_and_access_psm_pointers)
 
+TEST_GROUP_C_WRAPPER(path_prediction){};
+TEST_C_WRAPPER(path_prediction, radius_filter_constant)
+TEST_C_WRAPPER(path_prediction, radius_filter)
+TEST_C_WRAPPER(path_prediction, radius_filter_max_radius)
+TEST_C_WRAPPER(path_prediction, confidence_filter_constant)
+TEST_C_WRAPPER(path_prediction, confidence_filter)
+TEST_C_WRAPPER(path_prediction, confidence_filter_negative)
+TEST_C_WRAPPER(path_prediction, confidenceLookup_min)
+TEST_C_WRAPPER(path_prediction, confidenceLookup_max)
+TEST_C_WRAPPER(path_prediction, confidenceLookup_interpolate)
+TEST_C_WRAPPER(path_prediction, confidenceLookup_matches_reference)
+TEST_C_WRAPPER(path_prediction, ctx_devices_are_independent)
+TEST_C_WRAPPER(path_prediction, batch_matches_scalar)
+
+TEST_GROUP_C_WRAPPER(path_history_generator){};
+TEST_C_WRAPPER(path_history_generator, null_args)
+TEST_C_WRAPPER(path_history_generator, not_enough_history)
+TEST_C_WRAPPER(path_history_generator, straight_line_is_one_point)
+TEST_C_WRAPPER(path_history_generator, corner_is_kept)
+TEST_C_WRAPPER(path_history_generator, staircase_is_capped)
+TEST_C_WRAPPER(path_history_generator, min_distance)
+TEST_C_WRAPPER(path_history_generator, fill_psm_reuses_points_and_encodes)
+TEST_C_WRAPPER(path_history_generator, fill_bsm)
+
+TEST_GROUP_C_WRAPPER(dedup){};
+TEST_C_WRAPPER(dedup, null_args)
+TEST_C_WRAPPER(dedup, key_matches_decoded_fields)
+TEST_C_WRAPPER(dedup, first_seen_then_repeats)
+TEST_C_WRAPPER(dedup, same_key_different_content_conflicts)
+TEST_C_WRAPPER(dedup, window_expiry)
+TEST_C_WRAPPER(dedup, other_messages_use_content_hash)
+TEST_C_WRAPPER(dedup, capacity_is_bounded)
+
+TEST_GROUP_C_WRAPPER(geohash){};
+TEST_C_WRAPPER(geohash, invalid_args)
+TEST_C_WRAPPER(geohash, known_points)
+TEST_C_WRAPPER(geohash, matches_reference)
+TEST_C_WRAPPER(geohash, batch_matches_single)
+TEST_C_WRAPPER(geohash, box_is_exact)
+TEST_C_WRAPPER(geohash, neighbors)
+TEST_C_WRAPPER(geohash, prefix_range)
+
+TEST_GROUP_C_WRAPPER(trajectory){};
+TEST_C_WRAPPER(trajectory, invalid_args)
+TEST_C_WRAPPER(trajectory, secMark_wraps_around_the_minute)
+TEST_C_WRAPPER(trajectory, out_of_order_within_window)
+TEST_C_WRAPPER(trajectory, duplicates_and_late_samples_are_dropped)
+TEST_C_WRAPPER(trajectory, gaps_split_trajectories)
+TEST_C_WRAPPER(trajectory, long_trajectories_are_segmented)
+TEST_C_WRAPPER(trajectory, advance_finishes_silent_devices)
+TEST_C_WRAPPER(trajectory, id_change_is_linked)
+TEST_C_WRAPPER(trajectory, memory_is_bounded)
+TEST_C_WRAPPER(trajectory, samples_from_messages)
+
+TEST_GROUP_C_WRAPPER(conflict){};
+TEST_C_WRAPPER(conflict, invalid_args)
+TEST_C_WRAPPER(conflict, pair_head_on)
+TEST_C_WRAPPER(conflict, pair_crossing)
+TEST_C_WRAPPER(conflict, engine_reports_nearby_pairs)
+TEST_C_WRAPPER(conflict, repeat_is_per_pair)
+TEST_C_WRAPPER(conflict, budget_resumes_next_step)
+TEST_C_WRAPPER(conflict, bsm_and_psm_ids_are_separate)
+
+TEST_GROUP_C_WRAPPER(map){};
+TEST_C_WRAPPER(map, invalid_args);
+TEST_C_WRAPPER(map, compile_lanes);
+TEST_C_WRAPPER(map, match_position);
+TEST_C_WRAPPER(map, match_heading);
+TEST_C_WRAPPER(map, match_batch);
+TEST_C_WRAPPER(map, cache_by_revision);
+TEST_C_WRAPPER(map, cache_by_intersections);
+
+TEST_GROUP_C_WRAPPER(spat_timeline){};
+TEST_C_WRAPPER(spat_timeline, invalid_args);
+TEST_C_WRAPPER(spat_timeline, message_time);
+TEST_C_WRAPPER(spat_timeline, only_changes_are_stored);
+TEST_C_WRAPPER(spat_timeline, gaps_and_late_reports);
+TEST_C_WRAPPER(spat_timeline, range);
+TEST_C_WRAPPER(spat_timeline, add_uper);
+
+TEST_GROUP_C_WRAPPER(tim_region){};
+TEST_C_WRAPPER(tim_region, invalid_args);
+TEST_C_WRAPPER(tim_region, corridor);
+TEST_C_WRAPPER(tim_region, polygons_and_circles);
+TEST_C_WRAPPER(tim_region, heading_slice);
+TEST_C_WRAPPER(tim_region, match_and_remove);
+TEST_C_WRAPPER(tim_region, skipped_regions);
+
+TEST_GROUP_C_WRAPPER(uper_fast){};
+TEST_C_WRAPPER(uper_fast, invalid_args);
+TEST_C_WRAPPER(uper_fast, core_matches_generic);
+TEST_C_WRAPPER(uper_fast, part_ii_matches_generic);
+TEST_C_WRAPPER(uper_fast, falls_back_to_generic);
+TEST_C_WRAPPER(uper_fast, damaged_input_matches_generic);
+TEST_C_WRAPPER(uper_fast, corpus_matches_generic);
+TEST_C_WRAPPER(uper_fast, random_psm_matches_generic);
+TEST_C_WRAPPER(uper_fast, random_spat_matches_generic);
+TEST_C_WRAPPER(uper_fast, map_matches_generic);
+TEST_C_WRAPPER(uper_fast, random_map_matches_generic);
+
+TEST_GROUP_C_WRAPPER(oer){};
+TEST_C_WRAPPER(oer, invalid_args);
+TEST_C_WRAPPER(oer, bsm_layout);
+TEST_C_WRAPPER(oer, uper_round_trip);
+TEST_C_WRAPPER(oer, damaged_input);
+TEST_C_WRAPPER(oer, rejects_values_outside_the_constraint);
+TEST_C_WRAPPER(oer, skips_unknown_extensions);
+TEST_C_WRAPPER(oer, archive_round_trip);
+
+TEST_GROUP_C_WRAPPER(stats){};
+TEST_C_WRAPPER(stats, invalid_args);
+TEST_C_WRAPPER(stats, decode_is_counted_per_type);
+TEST_C_WRAPPER(stats, members_give_the_type_back);
+TEST_C_WRAPPER(stats, builder_frees_are_untracked);
+
+TEST_GROUP_C_WRAPPER(corpus){};
+TEST_C_WRAPPER(corpus, invalid_args);
+TEST_C_WRAPPER(corpus, reproducible_and_valid);
+TEST_C_WRAPPER(corpus, configured_shapes);
+TEST_C_WRAPPER(corpus, records_round_trip);
+
+TEST_GROUP_C_WRAPPER(threads){};
+TEST_C_WRAPPER(threads, random_fill_is_per_thread);
+TEST_C_WRAPPER(threads, path_prediction_context_is_per_thread);
+TEST_C_WRAPPER(threads, encode_ignores_errno);
+
+TEST_GROUP_C_WRAPPER(pipeline){};
+TEST_C_WRAPPER(pipeline, invalid_args);
+TEST_C_WRAPPER(pipeline, frames_reach_their_sinks);
+TEST_C_WRAPPER(pipeline, damaged_frames_reach_the_error_sink);
+TEST_C_WRAPPER(pipeline, back_pressure);
+
+TEST_GROUP_C_WRAPPER(hex){};
+TEST_C_WRAPPER(hex, variants_match_printf);
+TEST_C_WRAPPER(hex, variants_reject_bad_digits);
+TEST_C_WRAPPER(hex, libsm_wrappers);
+TEST_C_WRAPPER(hex, jer_strings_round_trip);
+
+TEST_GROUP_C_WRAPPER(spatBuilder){};
+TEST_C_WRAPPER(spatBuilder, invalid_args);
+TEST_C_WRAPPER(spatBuilder, same_as_node_builders);
+TEST_C_WRAPPER(spatBuilder, reuse);
+TEST_C_WRAPPER(spatBuilder, unsigned_integers);
+
+TEST_GROUP_C_WRAPPER(test_map){};
+TEST_C_WRAPPER(test_map, nodeXY_choice);
+TEST_C_WRAPPER(test_map, invalid_args);
+TEST_C_WRAPPER(test_map, build_encode_compile);
+TEST_C_WRAPPER(test_map, uper_cache_by_revision);
+TEST_C_WRAPPER(test_map, uper_cache_by_intersections);
+
+TEST_GROUP_C_WRAPPER(itis){};
+TEST_C_WRAPPER(itis, from_code);
+TEST_C_WRAPPER(itis, from_name);
+TEST_C_WRAPPER(itis, every_code_round_trips);
+TEST_C_WRAPPER(itis, phrase_member);
+TEST_C_WRAPPER(itis, render);
+TEST_C_WRAPPER(itis, render_batch);
+
+TEST_GROUP_C_WRAPPER(enum_names){};
+TEST_C_WRAPPER(enum_names, every_enumerated_name);
+TEST_C_WRAPPER(enum_names, spellings);
+TEST_C_WRAPPER(enum_names, basic_vehicle_class);
+TEST_C_WRAPPER(enum_names, personal_device_user_type);
+TEST_C_WRAPPER(enum_names, jer_round_trip);
+
+TEST_GROUP_C_WRAPPER(borrow){};
+TEST_C_WRAPPER(borrow, aligned_and_arena);
+TEST_C_WRAPPER(borrow, arena_full);
+TEST_C_WRAPPER(borrow, min_size);
+TEST_C_WRAPPER(borrow, replace_borrowed);
+
+TEST_GROUP_C_WRAPPER(opaque){};
+TEST_C_WRAPPER(opaque, relay_bit_exact);
+TEST_C_WRAPPER(opaque, materialize);
+TEST_C_WRAPPER(opaque, copy_and_compare);
+TEST_C_WRAPPER(opaque, unknown_regional);
+
+TEST_GROUP_C_WRAPPER(anonymize){};
+TEST_C_WRAPPER(anonymize, bsm_in_place);
+TEST_C_WRAPPER(anonymize, unavailable_kept);
+TEST_C_WRAPPER(anonymize, jitter);
+TEST_C_WRAPPER(anonymize, drop_path_history);
+TEST_C_WRAPPER(anonymize, psm);
+TEST_C_WRAPPER(anonymize, psm_patched_like_reencoded);
+TEST_C_WRAPPER(anonymize, batch_threads);
+TEST_C_WRAPPER(anonymize, bad_arguments);
+
 TEST_GROUP_C_WRAPPER(j2735_rangeCoercion){};
 TEST_C_WRAPPER(j2735_rangeCoercion, acceleration_valid)
 TEST_C_WRAPPER(j2735_rangeCoercion, acceleration_above)
@@ -0,0 +1,226 @@
+/*
+ * testSpatBuilder.c
+ * Check SPaTs from the pool backed builder encode the same as from the node by node builders
+ *
+ * Did you know? Documentation for how to write more tests is at https://cpputest.github.io/manual.html
+ */
+#include "CppUTest/TestHarness_c.h"
+#include "libsm.h"
+
+#include <string.h>
+
+#define SLOT 2048
+#define SIGNALS 16
+
+
+static void fillSignals(libsm_spat_signal_t* signals, size_t count, unsigned seed)
+{
+    for (size_t s = 0; s < count; s++) {
+        signals[s].signalGroup = (uint8_t)(s + 1);
+        signals[s].eventState = (uint8_t)((s + seed) % 10);
+        signals[s].minEndTime = (uint16_t)((s * 37 + seed) % 36000);
+        signals[s].maxEndTime = s % 3 == 0 ? LIBSM_SPAT_TIME_UNKNOWN
+                                           : (uint16_t)((s * 37 + seed + 50) % 36000);
+    }
+    signals[0].minEndTime = LIBSM_SPAT_TIME_UNKNOWN;
+}
+
+
+// The same SPaT, built node by node
+static MessageFrame_t* buildClassic(libsm_spat_intersection_t const* intersections, size_t count)
+{
+    MessageFrame_t* mf = libsm_alloc_init_mf_spat();
+    SPAT_t* spat = libsm_get_spat(mf);
+    for (size_t i = 0; i < count; i++) {
+        libsm_spat_intersection_t const* in = &intersections[i];
+        IntersectionState_t* out = i == 0 ? spat->intersections.list.array[0]
+                                          : libsm_add_spat_intersectionState(spat);
+        out->id.id = in->id;
+        out->revision = in->revision;
+        out->status.buf[0] = (uint8_t)(in->status >> 8);
+        out->status.buf[1] = (uint8_t)in->status;
+        if (in->moy != LIBSM_SPAT_MOY_UNKNOWN) {
+            out->moy = calloc(1, sizeof(MinuteOfTheYear_t));
+            *out->moy = in->moy;
+        }
+        if (in->timeStamp != LIBSM_SPAT_DSECOND_UNKNOWN) {
+            out->timeStamp = calloc(1, sizeof(DSecond_t));
+            *out->timeStamp = in->timeStamp;
+        }
+        for (size_t s = 0; s < in->signalCount; s++) {
+            MovementState_t* state = s == 0 ? out->states.list.array[0]
+                                            : libsm_add_spat_intersectionState_movementState(out);
+            MovementEvent_t* event = state->state_time_speed.list.array[0];
+            state->signalGroup = in->signals[s].signalGroup;
+            event->eventState = in->signals[s].eventState;
+            bool const hasMax = in->signals[s].maxEndTime != LIBSM_SPAT_TIME_UNKNOWN;
+            if (in->signals[s].minEndTime != LIBSM_SPAT_TIME_UNKNOWN || hasMax) {
+                event->timing = calloc(1, sizeof(TimeChangeDetails_t));
+                event->timing->minEndTime = in->signals[s].minEndTime;
+                if (hasMax) {
+                    event->timing->maxEndTime = calloc(1, sizeof(SPAT_TimeMark_t));
+                    *event->timing->maxEndTime = in->signals[s].maxEndTime;
+                }
+            }
+        }
+    }
+    return mf;
+}
+
+
+static void checkSameAsClassic(libsm_spat_builder_t* builder,
+                               libsm_spat_intersection_t const* intersections,
+                               size_t count)
+{
+    uint8_t pooled[SLOT];
+    uint8_t classic[SLOT];
+    size_t pooledLen = sizeof(pooled);
+    size_t classicLen = sizeof(classic);
+
+    CHECK_EQUAL_C_INT(LIBSM_OK,
+                      libsm_spat_builder_encode(builder, intersections, count, pooled, &pooledLen));
+    MessageFrame_t* mf = buildClassic(intersections, count);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, classic, &classicLen));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    CHECK_EQUAL_C_INT((int)classicLen, (int)pooledLen);
+    CHECK_C(pooledLen > 0);
+    CHECK_C(memcmp(classic, pooled, classicLen) == 0);
+}
+
+
+TEST_C(spatBuilder, invalid_args)
+{
+    libsm_spat_builder_t builder;
+    libsm_spat_signal_t signals[SIGNALS];
+    fillSignals(signals, SIGNALS, 0);
+    libsm_spat_intersection_t intersection = { .signals = signals, .signalCount = SIGNALS };
+    uint8_t encoded[SLOT];
+    size_t len = sizeof(encoded);
+
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_spat_builder_init(NULL, 1, 1));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_spat_builder_init(&builder, 0, 1));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER,
+                      libsm_spat_builder_init(&builder, LIBSM_SPAT_MAX_INTERSECTIONS + 1, 1));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER,
+                      libsm_spat_builder_init(&builder, 1, LIBSM_SPAT_MAX_SIGNALS + 1));
+    CHECK_C(builder.pool == NULL);
+    libsm_spat_builder_free(NULL);
+    libsm_spat_builder_free(&builder);
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_spat_builder_init(&builder, 2, SIGNALS - 1));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_spat_builder_build(&builder, NULL, 1));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER,
+                      libsm_spat_builder_build(&builder, &intersection, 0));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER,
+                      libsm_spat_builder_build(&builder, &intersection, 3));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER,
+                      libsm_spat_builder_build(&builder, &intersection, 1));
+    intersection.signalCount = 0;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER,
+                      libsm_spat_builder_build(&builder, &intersection, 1));
+    intersection.signalCount = 1;
+    intersection.signals = NULL;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_spat_builder_build(&builder, &intersection, 1));
+
+    // out of range values are left to the encoder
+    intersection.signals = signals;
+    signals[0].eventState = 10;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_CONSTRAINT,
+                      libsm_spat_builder_encode(&builder, &intersection, 1, encoded, &len));
+    libsm_spat_builder_free(&builder);
+    CHECK_C(builder.mf == NULL);
+}
+
+
+TEST_C(spatBuilder, same_as_node_builders)
+{
+    libsm_spat_builder_t builder;
+    libsm_spat_signal_t signals[2][SIGNALS];
+    fillSignals(signals[0], SIGNALS, 3);
+    fillSignals(signals[1], 3, 7);
+    libsm_spat_intersection_t const intersections[] = {
+        { 1201, 5, 0x8000, 270000, 59000, signals[0], SIGNALS },
+        { 65535, 127, 0x0123, LIBSM_SPAT_MOY_UNKNOWN, LIBSM_SPAT_DSECOND_UNKNOWN, signals[1], 3 },
+    };
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_spat_builder_init(&builder, 2, SIGNALS));
+    checkSameAsClassic(&builder, intersections, 2);
+    checkSameAsClassic(&builder, &intersections[1], 1);
+    libsm_spat_builder_free(&builder);
+
+    // larger than the open type encodes on the stack
+    libsm_spat_intersection_t many[12];
+    for (size_t i = 0; i < 12; i++) {
+        many[i] = intersections[0];
+        many[i].id = (uint16_t)i;
+    }
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_spat_builder_init(&builder, 12, SIGNALS));
+    checkSameAsClassic(&builder, many, 12);
+    libsm_spat_builder_free(&builder);
+}
+
+
+// Shrinking and growing again leaves nothing of the earlier SPaTs behind
+TEST_C(spatBuilder, reuse)
+{
+    libsm_spat_builder_t builder;
+    libsm_spat_signal_t signals[SIGNALS];
+    libsm_spat_intersection_t intersections[3];
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_spat_builder_init(&builder, 3, SIGNALS));
+
+    for (unsigned tick = 0; tick < 50; tick++) {
+        size_t const count = 1 + tick % 3;
+        fillSignals(signals, SIGNALS, tick);
+        for (size_t i = 0; i < count; i++) {
+            intersections[i] = (libsm_spat_intersection_t){
+                .id = (uint16_t)(100 + i),
+                .revision = (uint8_t)(tick % 128),
+                .status = (uint16_t)(tick * 7),
+                .moy = tick % 2 ? LIBSM_SPAT_MOY_UNKNOWN : 1000 + tick,
+                .timeStamp = (uint16_t)(tick % 4 ? tick * 100 : LIBSM_SPAT_DSECOND_UNKNOWN),
+                .signals = signals,
+                .signalCount = 1 + (tick * 5 + i) % SIGNALS,
+            };
+        }
+        checkSameAsClassic(&builder, intersections, count);
+    }
+
+    MessageFrame_t mf = { 0 };
+    uint8_t encoded[SLOT];
+    size_t len = sizeof(encoded);
+    intersections[0].signalCount = 2;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_spat_builder_encode(&builder, intersections, 1, encoded, &len));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_decode_messageframe(encoded, len, &mf));
+    SPAT_t* spat = libsm_get_spat(&mf);
+    CHECK_EQUAL_C_INT(1, spat->intersections.list.count);
+    CHECK_EQUAL_C_INT(2, spat->intersections.list.array[0]->states.list.count);
+    CHECK_C(spat->intersections.list.array[0]->states.list.array[0]->state_time_speed.list.array[0]
+                    ->timing
+            == NULL);
+    ASN_STRUCT_RESET(asn_DEF_MessageFrame, &mf);
+    libsm_spat_builder_free(&builder);
+}
+
+
+// The stack encoding of integers keeps unsigned types unsigned, StationIDs above 2^31 included
+TEST_C(spatBuilder, unsigned_integers)
+{
+    unsigned long const ids[] = { 0, 0x7FFFFFFFUL, 0x80000000UL, 4294967295UL };
+    for (size_t i = 0; i < sizeof(ids) / sizeof(ids[0]); i++) {
+        StationID_t id = ids[i];
+        uint8_t encoded[8];
+        asn_enc_rval_t const er
+                = uper_encode_to_buffer(&asn_DEF_StationID, NULL, &id, encoded, sizeof(encoded));
+        CHECK_EQUAL_C_INT(32, er.encoded);
+        for (int b = 0; b < 4; b++) {
+            CHECK_EQUAL_C_INT((uint8_t)(ids[i] >> (24 - 8 * b)), encoded[b]);
+        }
+        StationID_t* decoded = NULL;
+        asn_dec_rval_t const dr
+                = uper_decode_complete(NULL, &asn_DEF_StationID, (void**)&decoded, encoded, 4);
+        CHECK_EQUAL_C_INT(RC_OK, dr.code);
+        CHECK_C(decoded != NULL);
+        CHECK_C(*decoded == ids[i]);
+        ASN_STRUCT_FREE(asn_DEF_StationID, decoded);
+    }
+}
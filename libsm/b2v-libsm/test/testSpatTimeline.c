@@ -0,0 +1,255 @@
+/*
+ * testSpatTimeline.c
+ * Tests for the SPaT timeline store
+ *
+ * Did you know? Documentation for how to write more tests is at https://cpputest.github.io/manual.html
+ */
+#include "CppUTest/TestHarness_c.h"
+#include "libsm.h"
+
+#include <stdlib.h>
+
+// 2024-01-01T00:00:00Z, minute 0 of a leap year
+#define EPOCH_MS 1704067200000ULL
+#define INTERSECTION_ID 1234
+
+
+// a SPAT with one intersection and one movement, stamped msSinceEpoch after EPOCH_MS
+static SPAT_t* spatAt(uint64_t msSinceEpoch,
+                      SignalGroupID_t signalGroup,
+                      MovementPhaseState_t eventState,
+                      long minEndTime,
+                      long maxEndTime)
+{
+    SPAT_t* spat = calloc(1, sizeof(SPAT_t));
+    IntersectionState_t* state = calloc(1, sizeof(IntersectionState_t));
+    state->id.id = INTERSECTION_ID;
+    libsm_init_bit_string(&state->status, 16);
+    state->moy = calloc(1, sizeof(MinuteOfTheYear_t));
+    *state->moy = (MinuteOfTheYear_t)(msSinceEpoch / 60000);
+    state->timeStamp = calloc(1, sizeof(DSecond_t));
+    *state->timeStamp = (DSecond_t)(msSinceEpoch % 60000);
+    ASN_SEQUENCE_ADD(&spat->intersections.list, state);
+
+    MovementState_t* movement = calloc(1, sizeof(MovementState_t));
+    movement->signalGroup = signalGroup;
+    ASN_SEQUENCE_ADD(&state->states.list, movement);
+    MovementEvent_t* event = calloc(1, sizeof(MovementEvent_t));
+    event->eventState = eventState;
+    event->timing = calloc(1, sizeof(TimeChangeDetails_t));
+    event->timing->minEndTime = minEndTime;
+    if (maxEndTime >= 0) {
+        event->timing->maxEndTime = calloc(1, sizeof(SPAT_TimeMark_t));
+        *event->timing->maxEndTime = maxEndTime;
+    }
+    ASN_SEQUENCE_ADD(&movement->state_time_speed.list, event);
+    return spat;
+}
+
+
+static void add(libsm_spat_timeline_t* tl,
+                uint64_t msSinceEpoch,
+                SignalGroupID_t signalGroup,
+                MovementPhaseState_t eventState,
+                long minEndTime,
+                long maxEndTime)
+{
+    SPAT_t* spat = spatAt(msSinceEpoch, signalGroup, eventState, minEndTime, maxEndTime);
+    // received 40 ms after it was sent
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_spat_timeline_add(tl, spat, EPOCH_MS + msSinceEpoch + 40));
+    ASN_STRUCT_FREE(asn_DEF_SPAT, spat);
+}
+
+
+/*
+ * 10 Hz for 60 s: red until 30 s with minEndTime 30 s, then green until 60 s
+ * with minEndTime 50 s and maxEndTime 60 s
+ */
+static void cycle(libsm_spat_timeline_t* tl, SignalGroupID_t signalGroup)
+{
+    for (uint64_t t = 0; t < 60000; t += 100) {
+        if (t < 30000) {
+            add(tl, t, signalGroup, MovementPhaseState_stop_And_Remain, 300, -1);
+        } else {
+            add(tl, t, signalGroup, MovementPhaseState_protected_Movement_Allowed, 500, 600);
+        }
+    }
+}
+
+
+TEST_C(spat_timeline, invalid_args)
+{
+    libsm_spat_timeline_t tl;
+    libsm_spat_state_t state;
+
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_spat_timeline_init(NULL, 1000));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_spat_timeline_init(&tl, 0));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_spat_timeline_init(&tl, 1000));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_spat_timeline_add(&tl, NULL, EPOCH_MS));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_spat_timeline_add_uper(&tl, NULL, 0, EPOCH_MS));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER,
+                      libsm_spat_timeline_state_at(&tl, INTERSECTION_ID, 1, EPOCH_MS, &state));
+    CHECK_C(libsm_spat_timeline_series(&tl, INTERSECTION_ID, 1) == NULL);
+    libsm_spat_timeline_free(&tl);
+}
+
+
+TEST_C(spat_timeline, message_time)
+{
+    SPAT_t* spat = spatAt(9500, 1, MovementPhaseState_dark, 0, -1);
+    IntersectionState_t* state = spat->intersections.list.array[0];
+
+    CHECK_EQUAL_C_ULONGLONG(EPOCH_MS + 9500,
+                            libsm_spat_timeline_state_time(spat, state, EPOCH_MS + 10000));
+
+    // the last second of 2023 received just after new year
+    *state->moy = 365 * 1440 - 1;
+    *state->timeStamp = 59000;
+    CHECK_EQUAL_C_ULONGLONG(EPOCH_MS - 1000,
+                            libsm_spat_timeline_state_time(spat, state, EPOCH_MS + 500));
+
+    // 2024 has 366 days
+    *state->moy = 366 * 1440 - 1;
+    CHECK_EQUAL_C_ULONGLONG(EPOCH_MS + 366ULL * 86400000 - 1000,
+                            libsm_spat_timeline_state_time(spat,
+                                                           state,
+                                                           EPOCH_MS + 366ULL * 86400000 - 900));
+
+    // only the DSecond
+    free(state->moy);
+    state->moy = NULL;
+    *state->timeStamp = 59900;
+    CHECK_EQUAL_C_ULONGLONG(EPOCH_MS + 120000 - 100,
+                            libsm_spat_timeline_state_time(spat, state, EPOCH_MS + 120050));
+
+    // nothing usable
+    *state->timeStamp = DSecond_unavailable;
+    CHECK_EQUAL_C_ULONGLONG(EPOCH_MS + 7,
+                            libsm_spat_timeline_state_time(spat, state, EPOCH_MS + 7));
+    ASN_STRUCT_FREE(asn_DEF_SPAT, spat);
+}
+
+
+TEST_C(spat_timeline, only_changes_are_stored)
+{
+    libsm_spat_timeline_t tl;
+    libsm_spat_state_t state;
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_spat_timeline_init(&tl, 2000));
+    cycle(&tl, 2);
+    CHECK_EQUAL_C_ULONG(600, tl.stats.movements);
+    CHECK_EQUAL_C_ULONG(2, tl.stats.rows);
+
+    libsm_spat_series_t const* series = libsm_spat_timeline_series(&tl, INTERSECTION_ID, 2);
+    CHECK_C(series != NULL);
+    CHECK_EQUAL_C_ULONG(2, series->count);
+    CHECK_EQUAL_C_ULONGLONG(EPOCH_MS, series->startTimeMs);
+    CHECK_EQUAL_C_UINT(30000, series->timeOffsetMs[1]);
+
+    CHECK_EQUAL_C_INT(LIBSM_OK,
+                      libsm_spat_timeline_state_at(
+                              &tl, INTERSECTION_ID, 2, EPOCH_MS + 12345, &state));
+    CHECK_EQUAL_C_INT(MovementPhaseState_stop_And_Remain, state.eventState);
+    CHECK_EQUAL_C_ULONGLONG(EPOCH_MS, state.sinceMs);
+    CHECK_EQUAL_C_ULONGLONG(EPOCH_MS + 30000, state.untilMs);
+    CHECK_EQUAL_C_ULONGLONG(EPOCH_MS + 30000, state.minEndMs);
+    CHECK_EQUAL_C_ULONGLONG(0, state.maxEndMs);
+
+    CHECK_EQUAL_C_INT(LIBSM_OK,
+                      libsm_spat_timeline_state_at(
+                              &tl, INTERSECTION_ID, 2, EPOCH_MS + 30000, &state));
+    CHECK_EQUAL_C_INT(MovementPhaseState_protected_Movement_Allowed, state.eventState);
+    CHECK_EQUAL_C_ULONGLONG(EPOCH_MS + 50000, state.minEndMs);
+    CHECK_EQUAL_C_ULONGLONG(EPOCH_MS + 60000, state.maxEndMs);
+    // the last report was at 59.9 s
+    CHECK_EQUAL_C_ULONGLONG(EPOCH_MS + 59900 + 2000, state.untilMs);
+
+    // before the first report, and after it went quiet
+    libsm_spat_timeline_state_at(&tl, INTERSECTION_ID, 2, EPOCH_MS - 1, &state);
+    CHECK_EQUAL_C_INT(MovementPhaseState_unavailable, state.eventState);
+    CHECK_EQUAL_C_ULONGLONG(EPOCH_MS, state.untilMs);
+    libsm_spat_timeline_state_at(&tl, INTERSECTION_ID, 2, EPOCH_MS + 62000, &state);
+    CHECK_EQUAL_C_INT(MovementPhaseState_unavailable, state.eventState);
+    libsm_spat_timeline_free(&tl);
+}
+
+
+TEST_C(spat_timeline, gaps_and_late_reports)
+{
+    libsm_spat_timeline_t tl;
+    libsm_spat_state_t state;
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_spat_timeline_init(&tl, 2000));
+    add(&tl, 0, 1, MovementPhaseState_stop_And_Remain, 300, -1);
+    add(&tl, 1000, 1, MovementPhaseState_stop_And_Remain, 300, -1);
+    // silent for 9 s, then the same state again
+    add(&tl, 10000, 1, MovementPhaseState_stop_And_Remain, 300, -1);
+    add(&tl, 9000, 1, MovementPhaseState_dark, 300, -1);
+    CHECK_EQUAL_C_ULONG(1, tl.stats.late);
+    CHECK_EQUAL_C_ULONG(3, tl.stats.rows);
+
+    libsm_spat_timeline_state_at(&tl, INTERSECTION_ID, 1, EPOCH_MS + 2999, &state);
+    CHECK_EQUAL_C_INT(MovementPhaseState_stop_And_Remain, state.eventState);
+    libsm_spat_timeline_state_at(&tl, INTERSECTION_ID, 1, EPOCH_MS + 3000, &state);
+    CHECK_EQUAL_C_INT(MovementPhaseState_unavailable, state.eventState);
+    CHECK_EQUAL_C_ULONGLONG(EPOCH_MS + 10000, state.untilMs);
+    libsm_spat_timeline_state_at(&tl, INTERSECTION_ID, 1, EPOCH_MS + 10000, &state);
+    CHECK_EQUAL_C_INT(MovementPhaseState_stop_And_Remain, state.eventState);
+    libsm_spat_timeline_free(&tl);
+}
+
+
+TEST_C(spat_timeline, range)
+{
+    libsm_spat_timeline_t tl;
+    size_t first;
+    size_t count;
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_spat_timeline_init(&tl, 2000));
+    cycle(&tl, 2);
+    cycle(&tl, 4);
+    CHECK_EQUAL_C_ULONG(2, tl.seriesCount);
+    libsm_spat_series_t const* series = libsm_spat_timeline_series(&tl, INTERSECTION_ID, 4);
+
+    libsm_spat_timeline_range(series, EPOCH_MS + 1000, EPOCH_MS + 2000, &first, &count);
+    CHECK_EQUAL_C_ULONG(0, first);
+    CHECK_EQUAL_C_ULONG(1, count);
+    libsm_spat_timeline_range(series, EPOCH_MS + 1000, EPOCH_MS + 30001, &first, &count);
+    CHECK_EQUAL_C_ULONG(0, first);
+    CHECK_EQUAL_C_ULONG(2, count);
+    libsm_spat_timeline_range(series, EPOCH_MS + 30000, EPOCH_MS + 90000, &first, &count);
+    CHECK_EQUAL_C_ULONG(1, first);
+    CHECK_EQUAL_C_ULONG(1, count);
+    libsm_spat_timeline_range(series, EPOCH_MS - 5000, EPOCH_MS, &first, &count);
+    CHECK_EQUAL_C_ULONG(0, count);
+    libsm_spat_timeline_free(&tl);
+}
+
+
+TEST_C(spat_timeline, add_uper)
+{
+    libsm_spat_timeline_t tl;
+    libsm_spat_state_t state;
+    MessageFrame_t* mf = calloc(1, sizeof(MessageFrame_t));
+    SPAT_t* spat = spatAt(4200, 7, MovementPhaseState_permissive_clearance, 100, 120);
+    uint8_t encoded[256];
+    size_t len = sizeof(encoded);
+
+    mf->messageId = DSRCmsgID_signalPhaseAndTimingMessage;
+    mf->value.present = MessageFrame__value_PR_SPAT;
+    mf->value.choice.SPAT = *spat;
+    free(spat);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, encoded, &len));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_spat_timeline_init(&tl, 2000));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_spat_timeline_add_uper(&tl, encoded, len, EPOCH_MS + 4250));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_DECODING, libsm_spat_timeline_add_uper(&tl, encoded, 3, EPOCH_MS));
+    CHECK_EQUAL_C_INT(LIBSM_OK,
+                      libsm_spat_timeline_state_at(
+                              &tl, INTERSECTION_ID, 7, EPOCH_MS + 4200, &state));
+    CHECK_EQUAL_C_INT(MovementPhaseState_permissive_clearance, state.eventState);
+    CHECK_EQUAL_C_ULONGLONG(EPOCH_MS + 10000, state.minEndMs);
+    CHECK_EQUAL_C_ULONGLONG(EPOCH_MS + 12000, state.maxEndMs);
+    libsm_spat_timeline_free(&tl);
+}
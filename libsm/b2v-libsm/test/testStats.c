@@ -0,0 +1,206 @@
+/*
+ * testStats.c
+ * Allocation statistics of the codec runtime, both with and without LIBSM_STATS
+ *
+ * Did you know? Documentation for how to write more tests is at https://cpputest.github.io/manual.html
+ */
+#include "CppUTest/TestHarness_c.h"
+#include "libsm.h"
+
+#include <string.h>
+
+static uint8_t const encoded_bsm_mf_valid[] = {
+    0x00, 0x14, 0x30, 0x40, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xA4, 0xE9, 0x00, 0xEB,
+    0x49, 0xD2, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x80, 0xFD, 0xFA,
+    0x1F, 0xA1, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x48, 0x00, 0x40,
+    0x20, 0x20, 0x34, 0x00, 0xAA, 0x00
+};
+
+
+#if LIBSM_STATS
+static void putBit(uint8_t* buf, size_t* bit, unsigned value)
+{
+    if (value) {
+        buf[*bit / 8] |= (uint8_t)(0x80 >> (*bit % 8));
+    }
+    (*bit)++;
+}
+
+
+static libsm_stats_counters_t const* findType(libsm_stats_t const* stats,
+                                              asn_TYPE_descriptor_t const* td)
+{
+    for (size_t i = 0; i < stats->count; i++) {
+        if (stats->types[i].type == td) {
+            return &stats->types[i];
+        }
+    }
+    return NULL;
+}
+#endif
+
+
+TEST_C(stats, invalid_args)
+{
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_stats_snapshot(NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_stats_dump(NULL));
+    libsm_stats_release(NULL);
+}
+
+
+TEST_C(stats, decode_is_counted_per_type)
+{
+    libsm_stats_reset();
+    MessageFrame_t mf = { 0 };
+    CHECK_EQUAL_C_INT(LIBSM_OK,
+                      libsm_decode_messageframe(encoded_bsm_mf_valid,
+                                                sizeof(encoded_bsm_mf_valid),
+                                                &mf));
+
+    libsm_stats_t stats;
+    libsm_rval_e rval = libsm_stats_snapshot(&stats);
+#if LIBSM_STATS
+    CHECK_EQUAL_C_INT(LIBSM_OK, rval);
+    CHECK_C(stats.total.allocations > 0);
+    CHECK_C(stats.total.live_bytes > 0);
+    CHECK_C(stats.total.peak_bytes >= stats.total.live_bytes);
+    CHECK_EQUAL_C_ULONG(0, stats.untrackedFrees);
+
+    // the core data is inline, each of the two part II elements is allocated by its own
+    // decoder, which also reads its partII-Value into a buffer it frees again
+    CHECK_C(findType(&stats, &asn_DEF_BSMcoreData) == NULL);
+    libsm_stats_counters_t const* partII = findType(&stats, &asn_DEF_BSMpartIIExtension);
+    CHECK_C(partII != NULL);
+    CHECK_EQUAL_C_ULONG(4, partII->allocations);
+    CHECK_EQUAL_C_ULONG(2, partII->frees);
+    CHECK_C(partII->live_bytes > 0 && partII->live_bytes < partII->bytes);
+    uint64_t sum = 0;
+    for (size_t i = 0; i < stats.count; i++) {
+        sum += stats.types[i].bytes;
+        CHECK_C(i == 0 || stats.types[i - 1].bytes >= stats.types[i].bytes);
+    }
+    CHECK_EQUAL_C_ULONG(stats.total.bytes, sum);
+    libsm_stats_release(&stats);
+
+    ASN_STRUCT_RESET(asn_DEF_MessageFrame, &mf);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_stats_snapshot(&stats));
+    CHECK_EQUAL_C_ULONG(stats.total.allocations, stats.total.frees);
+    CHECK_EQUAL_C_ULONG(0, stats.total.live_bytes);
+    CHECK_C(stats.total.peak_bytes > 0);
+    libsm_stats_release(&stats);
+
+    libsm_stats_reset();
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_stats_snapshot(&stats));
+    CHECK_EQUAL_C_ULONG(0, stats.total.allocations);
+    CHECK_EQUAL_C_ULONG(0, stats.count);
+    libsm_stats_release(&stats);
+#else
+    CHECK_EQUAL_C_INT(LIBSM_FAIL, rval);
+    CHECK_EQUAL_C_ULONG(0, stats.count);
+    CHECK_C(stats.types == NULL);
+    ASN_STRUCT_RESET(asn_DEF_MessageFrame, &mf);
+#endif
+}
+
+
+TEST_C(stats, members_give_the_type_back)
+{
+#if LIBSM_STATS
+    // a BSM without part II, and the same BSM with an unknown extension
+    MessageFrame_t* mf = libsm_alloc_init_mf_bsm();
+    uint8_t plain[64] = { 0 };
+    asn_enc_rval_t const er = uper_encode_to_buffer(
+            &asn_DEF_BasicSafetyMessage, NULL, libsm_get_bsm(mf), plain, sizeof(plain));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    CHECK_C(er.encoded > 3);
+    size_t const bits = (size_t)er.encoded;
+
+    uint8_t extended[64] = { 0 };
+    size_t bit = 0;
+    putBit(extended, &bit, 1);
+    for (size_t i = 1; i < bits; i++) {
+        putBit(extended, &bit, plain[i / 8] & (0x80 >> (i % 8)));
+    }
+    // a bitmap of one bit, set, then an open type of one octet
+    for (int i = 0; i < 7; i++) {
+        putBit(extended, &bit, 0);
+    }
+    putBit(extended, &bit, 1);
+    for (int i = 0; i < 7; i++) {
+        putBit(extended, &bit, 0);
+    }
+    putBit(extended, &bit, 1);
+    for (int i = 0; i < 8; i++) {
+        putBit(extended, &bit, 0);
+    }
+
+    libsm_stats_t before;
+    libsm_stats_t after;
+    BasicSafetyMessage_t* bsm = NULL;
+    libsm_stats_reset();
+    CHECK_EQUAL_C_INT(RC_OK,
+                      uper_decode_complete(NULL, &asn_DEF_BasicSafetyMessage, (void**)&bsm,
+                                           plain, (bits + 7) / 8).code);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_stats_snapshot(&before));
+    ASN_STRUCT_FREE(asn_DEF_BasicSafetyMessage, bsm);
+    bsm = NULL;
+    libsm_stats_reset();
+    CHECK_EQUAL_C_INT(RC_OK,
+                      uper_decode_complete(NULL, &asn_DEF_BasicSafetyMessage, (void**)&bsm,
+                                           extended, (bit + 7) / 8).code);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_stats_snapshot(&after));
+    ASN_STRUCT_FREE(asn_DEF_BasicSafetyMessage, bsm);
+
+    // the extension bitmap and the skipped extension are the BSM's, not its last member's
+    libsm_stats_counters_t const* plainBsm = findType(&before, &asn_DEF_BasicSafetyMessage);
+    libsm_stats_counters_t const* extendedBsm = findType(&after, &asn_DEF_BasicSafetyMessage);
+    CHECK_C(plainBsm != NULL && extendedBsm != NULL);
+    CHECK_C(after.total.allocations > before.total.allocations);
+    CHECK_EQUAL_C_ULONG(after.total.allocations - before.total.allocations,
+                        extendedBsm->allocations - plainBsm->allocations);
+    CHECK_EQUAL_C_ULONG(before.count, after.count);
+    for (size_t i = 0; i < after.count; i++) {
+        if (after.types[i].type != &asn_DEF_BasicSafetyMessage) {
+            libsm_stats_counters_t const* same = findType(&before, after.types[i].type);
+            CHECK_C(same != NULL);
+            CHECK_EQUAL_C_ULONG(same->allocations, after.types[i].allocations);
+        }
+    }
+    libsm_stats_release(&before);
+    libsm_stats_release(&after);
+
+    // a block grown by another type still belongs to the one that allocated it
+    libsm_stats_reset();
+    asn_stats_set_type(&asn_DEF_BasicSafetyMessage);
+    void* block = asn_stats_malloc(8);
+    asn_stats_set_type(&asn_DEF_BSMcoreData);
+    block = asn_stats_realloc(block, 64);
+    asn_stats_set_type(NULL);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_stats_snapshot(&after));
+    CHECK_C(findType(&after, &asn_DEF_BSMcoreData) == NULL);
+    CHECK_EQUAL_C_ULONG(64, findType(&after, &asn_DEF_BasicSafetyMessage)->live_bytes);
+    libsm_stats_release(&after);
+    asn_stats_free(block);
+    libsm_stats_reset();
+#endif
+}
+
+
+TEST_C(stats, builder_frees_are_untracked)
+{
+    libsm_stats_reset();
+    MessageFrame_t* mf = libsm_alloc_init_mf_bsm();
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+
+    libsm_stats_t stats;
+    libsm_rval_e rval = libsm_stats_snapshot(&stats);
+#if LIBSM_STATS
+    CHECK_EQUAL_C_INT(LIBSM_OK, rval);
+    CHECK_EQUAL_C_ULONG(0, stats.total.allocations);
+    CHECK_C(stats.untrackedFrees > 0);
+#else
+    CHECK_EQUAL_C_INT(LIBSM_FAIL, rval);
+#endif
+    libsm_stats_release(&stats);
+    libsm_stats_reset();
+}
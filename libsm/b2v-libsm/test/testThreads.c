@@ -0,0 +1,100 @@
+/*
+ * testThreads.c
+ * Check the state that is left in libsm is per thread, and results do not depend on errno
+ *
+ * Did you know? Documentation for how to write more tests is at https://cpputest.github.io/manual.html
+ */
+#include "CppUTest/TestHarness_c.h"
+#include "libsm.h"
+#include "pathPrediction.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <string.h>
+
+#define FILLS 32
+
+
+static void fillCores(unsigned seed, long* lats)
+{
+    asn_random_seed(seed);
+    for (int i = 0; i < FILLS; i++) {
+        BSMcoreData_t* core = NULL;
+        asn_random_fill(&asn_DEF_BSMcoreData, (void**)&core, 256);
+        lats[i] = core->lat;
+        ASN_STRUCT_FREE(asn_DEF_BSMcoreData, core);
+    }
+}
+
+
+static void* fillCoresThread(void* lats)
+{
+    fillCores(41, lats);
+    return NULL;
+}
+
+
+TEST_C(threads, random_fill_is_per_thread)
+{
+    long here[FILLS];
+    long there[FILLS];
+
+    // seed this thread, and draw from it while the other thread runs
+    asn_random_seed(41);
+    pthread_t thread;
+    CHECK_EQUAL_C_INT(0, pthread_create(&thread, NULL, fillCoresThread, there));
+    for (int i = 0; i < FILLS; i++) {
+        asn_random_between(0, 1000);
+    }
+    pthread_join(thread, NULL);
+
+    fillCores(41, here);
+    CHECK_C(memcmp(here, there, sizeof(here)) == 0);
+}
+
+
+static void* predictThread(void* pp)
+{
+    libsm_calculatePathPrediction(pp, 10.0, 5.0);
+    return NULL;
+}
+
+
+TEST_C(threads, path_prediction_context_is_per_thread)
+{
+    PathPrediction_t mine = { 0 };
+    PathPrediction_t theirs = { 0 };
+    PathPrediction_t fresh = { 0 };
+
+    // after a few calls here, a new thread starts from a fresh context
+    for (int i = 0; i < 10; i++) {
+        libsm_calculatePathPrediction(&mine, 10.0, 5.0);
+    }
+    pthread_t thread;
+    CHECK_EQUAL_C_INT(0, pthread_create(&thread, NULL, predictThread, &theirs));
+    pthread_join(thread, NULL);
+
+    libsm_pp_ctx_t ctx;
+    libsm_pp_ctx_init(&ctx);
+    libsm_calculatePathPrediction_ctx(&ctx, &fresh, 10.0, 5.0);
+    CHECK_EQUAL_C_INT(fresh.radiusOfCurve, theirs.radiusOfCurve);
+    CHECK_EQUAL_C_INT(fresh.confidence, theirs.confidence);
+}
+
+
+TEST_C(threads, encode_ignores_errno)
+{
+    MessageFrame_t* mf = libsm_alloc_init_mf_bsm();
+    uint8_t encoded[512];
+    size_t len = sizeof(encoded);
+
+    errno = EBADF;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, encoded, &len));
+
+    mf->value.choice.BasicSafetyMessage.coreData.msgCnt = 128;
+    errno = 0;
+    len = sizeof(encoded);
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_CONSTRAINT, libsm_encode_messageframe(mf, encoded, &len));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_encode_messageframe(mf, encoded, NULL));
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
@@ -0,0 +1,381 @@
+/*
+ * testTimRegion.c
+ * Tests for compiled TIM regions
+ *
+ * Did you know? Documentation for how to write more tests is at https://cpputest.github.io/manual.html
+ */
+#include "CppUTest/TestHarness_c.h"
+#include "libsm.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#define REF_LAT  334150000
+#define REF_LONG -1119260000
+
+
+static double metersPerLat(void)
+{
+    return Latitude_m_per_unit;
+}
+
+
+static double metersPerLong(void)
+{
+    return metersPerLat() * cos((double)REF_LAT / Latitude_unit_deg * (M_PI / 180.0));
+}
+
+
+static Latitude_t latAt(double north)
+{
+    return REF_LAT + lround(north / metersPerLat());
+}
+
+
+static Longitude_t longAt(double east)
+{
+    return REF_LONG + lround(east / metersPerLong());
+}
+
+
+static Position3D_t* anchorAt(double east, double north)
+{
+    Position3D_t* anchor = libsm_alloc_init_Position3D();
+    anchor->lat = latAt(north);
+    anchor->Long = longAt(east);
+    return anchor;
+}
+
+
+// a path from the anchor going north for lengthM
+static GeographicalPath_t* northPath(long laneWidthCm, double lengthM)
+{
+    GeographicalPath_t* path = libsm_alloc_init_GeographicalPath();
+    path->anchor = anchorAt(0, 0);
+    path->laneWidth = libsm_alloc_init_LaneWidth();
+    *path->laneWidth = laneWidthCm;
+    libsm_init_partial_GeographicalPath_description_choice_path(path);
+    OffsetSystem_t* offsets = path->description->choice.path;
+    NodeListLL_t* list = libsm_alloc_init_partial_NodeListLL();
+    list->choice.nodes = libsm_alloc_init_partial_NodeSetLL();
+    ASN_SEQUENCE_ADD(&list->choice.nodes->list,
+                     libsm_alloc_init_NodeLL(NodeOffsetPointLL_PR_node_LL6, 0, 0));
+    ASN_SEQUENCE_ADD(&list->choice.nodes->list,
+                     libsm_alloc_init_NodeLL(NodeOffsetPointLL_PR_node_LL6,
+                                             (int)lround(lengthM / metersPerLat()),
+                                             0));
+    offsets->offset.present = OffsetSystem__offset_PR_ll;
+    offsets->offset.choice.ll = list;
+    return path;
+}
+
+
+static NodeXY_t* nodeXY(long x, long y)
+{
+    NodeXY_t* n = calloc(1, sizeof(NodeXY_t));
+    n->delta.present = NodeOffsetPointXY_PR_node_XY6;
+    n->delta.choice.node_XY6 = calloc(1, sizeof(Node_XY_32b_t));
+    n->delta.choice.node_XY6->x = x;
+    n->delta.choice.node_XY6->y = y;
+    return n;
+}
+
+
+// a closed path, a square of sideM from the anchor to the north east
+static GeographicalPath_t* squarePath(double sideM)
+{
+    long const side = lround(sideM * 100);
+    GeographicalPath_t* path = libsm_alloc_init_GeographicalPath();
+    path->anchor = anchorAt(0, 0);
+    path->closedPath = libsm_alloc_init_BOOLEAN();
+    *path->closedPath = 1;
+    libsm_init_partial_GeographicalPath_description_choice_path(path);
+    OffsetSystem_t* offsets = path->description->choice.path;
+    offsets->offset.present = OffsetSystem__offset_PR_xy;
+    offsets->offset.choice.xy = calloc(1, sizeof(NodeListXY_t));
+    offsets->offset.choice.xy->present = NodeListXY_PR_nodes;
+    offsets->offset.choice.xy->choice.nodes = calloc(1, sizeof(NodeSetXY_t));
+    NodeSetXY_t* nodes = offsets->offset.choice.xy->choice.nodes;
+    ASN_SEQUENCE_ADD(&nodes->list, nodeXY(0, 0));
+    ASN_SEQUENCE_ADD(&nodes->list, nodeXY(side, 0));
+    ASN_SEQUENCE_ADD(&nodes->list, nodeXY(0, side));
+    ASN_SEQUENCE_ADD(&nodes->list, nodeXY(-side, 0));
+    return path;
+}
+
+
+static GeographicalPath_t* circlePath(double east, double north, long radius, long units)
+{
+    GeographicalPath_t* path = libsm_alloc_init_GeographicalPath();
+    path->description = libsm_alloc_init_partial_GeographicalPath__description();
+    path->description->present = GeographicalPath__description_PR_oldRegion;
+    ValidRegion_t* region = calloc(1, sizeof(ValidRegion_t));
+    libsm_init_HeadingSlice(&region->direction);
+    region->area.present = ValidRegion__area_PR_circle;
+    region->area.choice.circle = calloc(1, sizeof(Circle_t));
+    region->area.choice.circle->center.lat = latAt(north);
+    region->area.choice.circle->center.Long = longAt(east);
+    region->area.choice.circle->radius = radius;
+    region->area.choice.circle->units = units;
+    path->description->choice.oldRegion = region;
+    return path;
+}
+
+
+// a triangle of offsets from the anchor, given in meters
+static GeographicalPath_t* trianglePath(double sideM)
+{
+    GeographicalPath_t* path = libsm_alloc_init_GeographicalPath();
+    path->anchor = anchorAt(0, 0);
+    path->description = libsm_alloc_init_partial_GeographicalPath__description();
+    path->description->present = GeographicalPath__description_PR_oldRegion;
+    ValidRegion_t* region = calloc(1, sizeof(ValidRegion_t));
+    libsm_init_HeadingSlice(&region->direction);
+    region->area.present = ValidRegion__area_PR_regionPointSet;
+    region->area.choice.regionPointSet = calloc(1, sizeof(RegionPointSet_t));
+    long const x = lround(sideM / metersPerLong());
+    long const y = lround(sideM / metersPerLat());
+    long const offsets[3][2] = { { 0, 0 }, { x, 0 }, { -x, y } };
+    for (int i = 0; i < 3; i++) {
+        RegionOffsets_t* offset = calloc(1, sizeof(RegionOffsets_t));
+        offset->xOffset = offsets[i][0];
+        offset->yOffset = offsets[i][1];
+        ASN_SEQUENCE_ADD(&region->area.choice.regionPointSet->nodeList.list, offset);
+    }
+    path->description->choice.oldRegion = region;
+    return path;
+}
+
+
+static TravelerInformation_t* timWith(GeographicalPath_t* a, GeographicalPath_t* b)
+{
+    TravelerInformation_t* tim = calloc(1, sizeof(TravelerInformation_t));
+    TravelerDataFrame_t* frame = libsm_alloc_init_partial_TravelerDataFrame();
+    ASN_SEQUENCE_ADD(&frame->regions.list, a);
+    if (b != NULL) {
+        ASN_SEQUENCE_ADD(&frame->regions.list, b);
+    }
+    ASN_SEQUENCE_ADD(&tim->dataFrames.list, frame);
+    return tim;
+}
+
+
+static bool inside(libsm_tim_regions_t const* set, double east, double north, Heading_t heading)
+{
+    return libsm_tim_regions_contains(set, 0, latAt(north), longAt(east), heading);
+}
+
+
+typedef struct {
+    size_t count;
+    size_t positions[8];
+    uint32_t timIds[8];
+} hits_t;
+
+
+static void onHit(void* user, size_t position, libsm_tim_region_t const* region)
+{
+    hits_t* hits = user;
+    if (hits->count < 8) {
+        hits->positions[hits->count] = position;
+        hits->timIds[hits->count] = region->timId;
+    }
+    hits->count++;
+}
+
+
+TEST_C(tim_region, invalid_args)
+{
+    libsm_tim_regions_t set;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_tim_regions_init(NULL, 3.6));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_tim_regions_init(&set, 0));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_tim_regions_init(&set, 3.6));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_tim_regions_add(&set, NULL, 1));
+
+    Latitude_t lat = REF_LAT;
+    Longitude_t Long = REF_LONG;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG,
+                      libsm_tim_regions_match(&set, &lat, &Long, NULL, 1, NULL, NULL));
+    CHECK_C(!libsm_tim_regions_contains(&set, 0, lat, Long, 0));
+    CHECK_EQUAL_C_ULONG(0, libsm_tim_regions_remove(&set, 1));
+    libsm_tim_regions_free(&set);
+}
+
+
+TEST_C(tim_region, corridor)
+{
+    libsm_tim_regions_t set;
+    libsm_tim_regions_init(&set, 3.6);
+    GeographicalPath_t* path = northPath(400, 100);
+    path->directionality = libsm_alloc_init_DirectionOfUse();
+    *path->directionality = DirectionOfUse_forward;
+    TravelerInformation_t* tim = timWith(path, NULL);
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_tim_regions_add(&set, tim, 7));
+    CHECK_EQUAL_C_ULONG(1, set.regionCount);
+    CHECK_EQUAL_C_INT(LIBSM_TIM_REGION_CORRIDOR, set.regions[0].shape);
+    CHECK_EQUAL_C_ULONG(2, set.regions[0].pointCount);
+    CHECK_EQUAL_C_REAL(2.0, set.regions[0].halfWidthM, 1e-9);
+    CHECK_EQUAL_C_REAL(100.0, set.points[1].north, 0.01);
+
+    CHECK_C(inside(&set, 0, 50, 0));
+    CHECK_C(inside(&set, 1.5, 50, 0));
+    CHECK_C(!inside(&set, 3, 50, 0));
+    CHECK_C(!inside(&set, -3, 50, 0));
+    CHECK_C(inside(&set, 0, 101.5, 0));
+    CHECK_C(!inside(&set, 0, 103, 0));
+    CHECK_C(!inside(&set, 0, -3, 0));
+
+    // only travel along the path counts when the heading is known
+    CHECK_C(inside(&set, 0, 50, 28000));
+    CHECK_C(!inside(&set, 0, 50, 14400));
+    CHECK_C(inside(&set, 0, 50, Heading_unavailable));
+
+    *path->directionality = DirectionOfUse_reverse;
+    libsm_tim_regions_add(&set, tim, 7);
+    CHECK_EQUAL_C_ULONG(1, set.regionCount);
+    CHECK_C(!inside(&set, 0, 50, 0));
+    CHECK_C(inside(&set, 0, 50, 14400));
+
+    ASN_STRUCT_FREE(asn_DEF_TravelerInformation, tim);
+    libsm_tim_regions_free(&set);
+}
+
+
+TEST_C(tim_region, polygons_and_circles)
+{
+    libsm_tim_regions_t set;
+    libsm_tim_regions_init(&set, 3.6);
+    TravelerInformation_t* square = timWith(squarePath(20), NULL);
+    TravelerInformation_t* triangle = timWith(trianglePath(30), NULL);
+    TravelerInformation_t* circles = timWith(circlePath(0, 0, 50, DistanceUnits_meter),
+                                             circlePath(0, 0, 100, DistanceUnits_foot));
+
+    libsm_tim_regions_add(&set, square, 1);
+    CHECK_EQUAL_C_INT(LIBSM_TIM_REGION_POLYGON, set.regions[0].shape);
+    CHECK_C(inside(&set, 10, 10, Heading_unavailable));
+    CHECK_C(inside(&set, 19, 1, Heading_unavailable));
+    CHECK_C(!inside(&set, 21, 10, Heading_unavailable));
+    CHECK_C(!inside(&set, -1, 10, Heading_unavailable));
+    CHECK_C(!inside(&set, 10, 21, Heading_unavailable));
+    libsm_tim_regions_remove(&set, 1);
+
+    libsm_tim_regions_add(&set, triangle, 2);
+    CHECK_EQUAL_C_INT(LIBSM_TIM_REGION_POLYGON, set.regions[0].shape);
+    CHECK_EQUAL_C_ULONG(3, set.regions[0].pointCount);
+    CHECK_C(inside(&set, 15, 5, Heading_unavailable));
+    CHECK_C(!inside(&set, 20, 20, Heading_unavailable));
+    CHECK_C(!inside(&set, 15, -1, Heading_unavailable));
+    libsm_tim_regions_remove(&set, 2);
+
+    libsm_tim_regions_add(&set, circles, 3);
+    CHECK_EQUAL_C_ULONG(2, set.regionCount);
+    CHECK_EQUAL_C_INT(LIBSM_TIM_REGION_CIRCLE, set.regions[0].shape);
+    CHECK_EQUAL_C_REAL(30.48, set.regions[1].radiusM, 1e-9);
+    CHECK_C(inside(&set, 0, 49, Heading_unavailable));
+    CHECK_C(inside(&set, -35, -35, Heading_unavailable));
+    CHECK_C(!inside(&set, 0, 51, Heading_unavailable));
+    CHECK_C(libsm_tim_regions_contains(&set, 1, latAt(30), longAt(0), Heading_unavailable));
+    CHECK_C(!libsm_tim_regions_contains(&set, 1, latAt(31), longAt(0), Heading_unavailable));
+
+    ASN_STRUCT_FREE(asn_DEF_TravelerInformation, square);
+    ASN_STRUCT_FREE(asn_DEF_TravelerInformation, triangle);
+    ASN_STRUCT_FREE(asn_DEF_TravelerInformation, circles);
+    libsm_tim_regions_free(&set);
+}
+
+
+TEST_C(tim_region, heading_slice)
+{
+    libsm_tim_regions_t set;
+    libsm_tim_regions_init(&set, 3.6);
+    GeographicalPath_t* path = northPath(400, 100);
+    // from000-0to022-5degrees and from337-5to360-0degrees
+    path->direction = libsm_alloc_init_HeadingSlice();
+    path->direction->buf[0] = 0x80;
+    path->direction->buf[1] = 0x01;
+    TravelerInformation_t* tim = timWith(path, NULL);
+
+    libsm_tim_regions_add(&set, tim, 1);
+    CHECK_EQUAL_C_UINT(0x8001, set.regions[0].headings);
+    CHECK_C(inside(&set, 0, 50, 100));
+    CHECK_C(inside(&set, 0, 50, 28700));
+    CHECK_C(!inside(&set, 0, 50, 1800));
+    CHECK_C(!inside(&set, 0, 50, 14400));
+    CHECK_C(inside(&set, 0, 50, Heading_unavailable));
+
+    // every sector is any heading
+    path->direction->buf[0] = 0xFF;
+    path->direction->buf[1] = 0xFF;
+    libsm_tim_regions_add(&set, tim, 1);
+    CHECK_EQUAL_C_UINT(0, set.regions[0].headings);
+    CHECK_C(inside(&set, 0, 50, 14400));
+
+    ASN_STRUCT_FREE(asn_DEF_TravelerInformation, tim);
+    libsm_tim_regions_free(&set);
+}
+
+
+TEST_C(tim_region, match_and_remove)
+{
+    libsm_tim_regions_t set;
+    libsm_tim_regions_init(&set, 3.6);
+    TravelerInformation_t* corridor = timWith(northPath(400, 100), NULL);
+    TravelerInformation_t* circle = timWith(circlePath(0, 200, 20, DistanceUnits_meter), NULL);
+    libsm_tim_regions_add(&set, corridor, 10);
+    libsm_tim_regions_add(&set, circle, 20);
+    CHECK_EQUAL_C_ULONG(2, set.regionCount);
+
+    Latitude_t const lats[4] = { latAt(50), latAt(150), latAt(205), latAt(99) };
+    Longitude_t const longs[4] = { longAt(0), longAt(0), longAt(5), longAt(-1) };
+    hits_t hits = { 0 };
+    CHECK_EQUAL_C_INT(LIBSM_OK,
+                      libsm_tim_regions_match(&set, lats, longs, NULL, 4, onHit, &hits));
+    CHECK_EQUAL_C_ULONG(3, hits.count);
+    CHECK_EQUAL_C_ULONG(0, hits.positions[0]);
+    CHECK_EQUAL_C_UINT(10, hits.timIds[0]);
+    CHECK_EQUAL_C_ULONG(3, hits.positions[1]);
+    CHECK_EQUAL_C_UINT(10, hits.timIds[1]);
+    CHECK_EQUAL_C_ULONG(2, hits.positions[2]);
+    CHECK_EQUAL_C_UINT(20, hits.timIds[2]);
+
+    // removing the first TIM moves the circle down
+    CHECK_EQUAL_C_ULONG(1, libsm_tim_regions_remove(&set, 10));
+    CHECK_EQUAL_C_ULONG(1, set.regionCount);
+    CHECK_EQUAL_C_ULONG(0, set.pointCount);
+    hits = (hits_t){ 0 };
+    libsm_tim_regions_match(&set, lats, longs, NULL, 4, onHit, &hits);
+    CHECK_EQUAL_C_ULONG(1, hits.count);
+    CHECK_EQUAL_C_ULONG(2, hits.positions[0]);
+
+    // and adding it back puts its points after the circle
+    libsm_tim_regions_add(&set, corridor, 10);
+    CHECK_EQUAL_C_ULONG(2, set.regionCount);
+    CHECK_EQUAL_C_UINT(0, set.regions[1].firstPoint);
+    CHECK_C(libsm_tim_regions_contains(&set, 1, latAt(50), longAt(0), 0));
+
+    ASN_STRUCT_FREE(asn_DEF_TravelerInformation, corridor);
+    ASN_STRUCT_FREE(asn_DEF_TravelerInformation, circle);
+    libsm_tim_regions_free(&set);
+}
+
+
+TEST_C(tim_region, skipped_regions)
+{
+    libsm_tim_regions_t set;
+    libsm_tim_regions_init(&set, 3.6);
+    GeographicalPath_t* noAnchor = northPath(400, 100);
+    ASN_STRUCT_FREE(asn_DEF_Position3D, noAnchor->anchor);
+    noAnchor->anchor = NULL;
+    GeographicalPath_t* noDescription = libsm_alloc_init_GeographicalPath();
+    noDescription->anchor = anchorAt(0, 0);
+    TravelerInformation_t* tim = timWith(noAnchor, noDescription);
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_tim_regions_add(&set, tim, 1));
+    CHECK_EQUAL_C_ULONG(0, set.regionCount);
+    CHECK_EQUAL_C_ULONG(0, set.pointCount);
+    CHECK_EQUAL_C_ULONG(2, set.skipped);
+
+    ASN_STRUCT_FREE(asn_DEF_TravelerInformation, tim);
+    libsm_tim_regions_free(&set);
+}
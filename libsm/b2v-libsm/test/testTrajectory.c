@@ -0,0 +1,333 @@
+/*
+ * testTrajectory.c
+ * Tests for the streaming trajectory reconstruction
+ *
+ * Did you know? Documentation for how to write more tests is at https://cpputest.github.io/manual.html
+ */
+#include "CppUTest/TestHarness_c.h"
+#include "libsm.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define ORIGIN_LAT  334150000
+#define ORIGIN_LONG -1119260000
+// 2024-01-01T00:00:00Z
+#define EPOCH_MS 1704067200000ULL
+
+typedef struct {
+    libsm_traj_segment_t segment;
+    uint64_t firstTimeMs;
+    uint64_t lastTimeMs;
+    bool ordered;
+} captured_t;
+
+static captured_t captured[64];
+static size_t capturedCount;
+
+
+static void capture(void* user, libsm_traj_segment_t const* segment)
+{
+    (void)user;
+    if (capturedCount == sizeof(captured) / sizeof(captured[0])) {
+        return;
+    }
+    captured_t* c = &captured[capturedCount++];
+    c->segment = *segment;
+    c->firstTimeMs = segment->startTimeMs + segment->timeOffsetMs[0];
+    c->lastTimeMs = segment->startTimeMs + segment->timeOffsetMs[segment->count - 1];
+    c->ordered = true;
+    for (size_t i = 1; i < segment->count; i++) {
+        c->ordered = c->ordered && segment->timeOffsetMs[i] > segment->timeOffsetMs[i - 1];
+    }
+    // the arrays go away after the callback
+    c->segment.timeOffsetMs = NULL;
+    c->segment.lat = NULL;
+    c->segment.Long = NULL;
+    c->segment.speed = NULL;
+    c->segment.heading = NULL;
+    c->segment.msgCnt = NULL;
+}
+
+
+// a 10 Hz report taken at timeMs and received 20 ms later
+static libsm_traj_sample_t sampleAt(uint32_t id, uint64_t timeMs, int32_t northUnits)
+{
+    libsm_traj_sample_t sample = {
+        .source = LIBSM_TRAJ_SOURCE_BSM,
+        .id = id,
+        .msgCnt = (uint8_t)((timeMs / 100) % 128),
+        .secMark = (uint16_t)(timeMs % 60000),
+        .lat = ORIGIN_LAT + northUnits,
+        .Long = ORIGIN_LONG,
+        .speed = 500,
+        .heading = 0,
+        .rxTimeMs = timeMs + 20,
+    };
+    return sample;
+}
+
+
+static void setup(libsm_traj_t* tr, libsm_traj_config_t const* config)
+{
+    capturedCount = 0;
+    memset(captured, 0, sizeof(captured));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_traj_init(tr, config, capture, NULL));
+}
+
+
+TEST_C(trajectory, invalid_args)
+{
+    libsm_traj_t tr;
+    libsm_traj_config_t config;
+    libsm_traj_sample_t sample = sampleAt(1, EPOCH_MS, 0);
+
+    libsm_traj_default_config(&config);
+    config.maxTracks = 0;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_traj_init(NULL, NULL, capture, NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_traj_init(&tr, NULL, NULL, NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_traj_init(&tr, &config, capture, NULL));
+
+    setup(&tr, NULL);
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_traj_add(NULL, &sample));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_traj_add(&tr, NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_traj_advance(NULL, 0));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_traj_flush(NULL));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_traj_sample_from_bsm(NULL, 0, &sample));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_traj_sample_from_psm(NULL, 0, &sample));
+
+    // no position, nothing to track
+    sample.lat = Latitude_unavailable;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_traj_add(&tr, &sample));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_traj_flush(&tr));
+    CHECK_EQUAL_C_INT(0, (int)capturedCount);
+    libsm_traj_free(&tr);
+}
+
+
+TEST_C(trajectory, secMark_wraps_around_the_minute)
+{
+    libsm_traj_sample_t sample = { 0 };
+
+    // sent just before the minute, received just after
+    sample.rxTimeMs = EPOCH_MS + 60050;
+    sample.secMark = 59950;
+    CHECK_EQUAL_C_ULONG(EPOCH_MS + 59950, libsm_traj_sample_time(&sample));
+
+    // a clock a little ahead of the receiver
+    sample.rxTimeMs = EPOCH_MS + 59990;
+    sample.secMark = 30;
+    CHECK_EQUAL_C_ULONG(EPOCH_MS + 60030, libsm_traj_sample_time(&sample));
+
+    sample.secMark = 65535;
+    CHECK_EQUAL_C_ULONG(EPOCH_MS + 59990, libsm_traj_sample_time(&sample));
+}
+
+
+TEST_C(trajectory, out_of_order_within_window)
+{
+    libsm_traj_t tr;
+    // every pair swapped, across a minute boundary
+    int const order[] = { 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14 };
+
+    setup(&tr, NULL);
+    for (size_t i = 0; i < sizeof(order) / sizeof(order[0]); i++) {
+        libsm_traj_sample_t sample = sampleAt(7, EPOCH_MS + 59500 + (uint64_t)order[i] * 100, order[i]);
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_traj_add(&tr, &sample));
+    }
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_traj_flush(&tr));
+
+    CHECK_EQUAL_C_INT(1, (int)capturedCount);
+    CHECK_EQUAL_C_INT(16, (int)captured[0].segment.count);
+    CHECK_C(captured[0].ordered);
+    CHECK_C(captured[0].segment.final);
+    CHECK_EQUAL_C_ULONG(EPOCH_MS + 59500, captured[0].firstTimeMs);
+    CHECK_EQUAL_C_ULONG(EPOCH_MS + 61000, captured[0].lastTimeMs);
+    CHECK_EQUAL_C_ULONG(0, tr.stats.late);
+    libsm_traj_free(&tr);
+}
+
+
+TEST_C(trajectory, duplicates_and_late_samples_are_dropped)
+{
+    libsm_traj_t tr;
+    libsm_traj_sample_t sample;
+
+    setup(&tr, NULL);
+    for (uint64_t i = 0; i < 30; i++) {
+        sample = sampleAt(7, EPOCH_MS + i * 100, (int32_t)i);
+        libsm_traj_add(&tr, &sample);
+        // relayed a second time
+        libsm_traj_add(&tr, &sample);
+    }
+    // well behind the reorder window
+    sample = sampleAt(7, EPOCH_MS + 100, 1);
+    sample.msgCnt = 99;
+    libsm_traj_add(&tr, &sample);
+    libsm_traj_flush(&tr);
+
+    CHECK_EQUAL_C_INT(1, (int)capturedCount);
+    CHECK_EQUAL_C_INT(30, (int)captured[0].segment.count);
+    CHECK_EQUAL_C_ULONG(30, tr.stats.duplicates);
+    CHECK_EQUAL_C_ULONG(1, tr.stats.late);
+    libsm_traj_free(&tr);
+}
+
+
+TEST_C(trajectory, gaps_split_trajectories)
+{
+    libsm_traj_t tr;
+
+    setup(&tr, NULL);
+    for (uint64_t i = 0; i < 20; i++) {
+        libsm_traj_sample_t sample = sampleAt(7, EPOCH_MS + i * 100, 0);
+        libsm_traj_add(&tr, &sample);
+    }
+    for (uint64_t i = 0; i < 20; i++) {
+        libsm_traj_sample_t sample = sampleAt(7, EPOCH_MS + 30000 + i * 100, 0);
+        libsm_traj_add(&tr, &sample);
+    }
+    libsm_traj_flush(&tr);
+
+    CHECK_EQUAL_C_INT(2, (int)capturedCount);
+    CHECK_C(captured[0].segment.final && captured[1].segment.final);
+    CHECK_C(captured[0].segment.trajectory != captured[1].segment.trajectory);
+    CHECK_EQUAL_C_INT(20, (int)captured[0].segment.count);
+    CHECK_EQUAL_C_INT(20, (int)captured[1].segment.count);
+    CHECK_EQUAL_C_ULONG(EPOCH_MS + 30000, captured[1].firstTimeMs);
+    libsm_traj_free(&tr);
+}
+
+
+TEST_C(trajectory, long_trajectories_are_segmented)
+{
+    libsm_traj_t tr;
+    libsm_traj_config_t config;
+
+    libsm_traj_default_config(&config);
+    config.maxSegmentPoints = 10;
+    setup(&tr, &config);
+    for (uint64_t i = 0; i < 25; i++) {
+        libsm_traj_sample_t sample = sampleAt(7, EPOCH_MS + i * 100, 0);
+        libsm_traj_add(&tr, &sample);
+    }
+    libsm_traj_flush(&tr);
+
+    CHECK_EQUAL_C_INT(3, (int)capturedCount);
+    for (size_t i = 0; i < 3; i++) {
+        CHECK_EQUAL_C_ULONG(captured[0].segment.trajectory, captured[i].segment.trajectory);
+        CHECK_EQUAL_C_UINT(i, captured[i].segment.segment);
+        CHECK_EQUAL_C_INT(i == 2, captured[i].segment.final);
+    }
+    CHECK_EQUAL_C_INT(5, (int)captured[2].segment.count);
+    CHECK_EQUAL_C_ULONG(EPOCH_MS + 1000, captured[1].firstTimeMs);
+    libsm_traj_free(&tr);
+}
+
+
+TEST_C(trajectory, advance_finishes_silent_devices)
+{
+    libsm_traj_t tr;
+
+    setup(&tr, NULL);
+    for (uint64_t i = 0; i < 10; i++) {
+        libsm_traj_sample_t sample = sampleAt(7, EPOCH_MS + i * 100, 0);
+        libsm_traj_add(&tr, &sample);
+    }
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_traj_advance(&tr, EPOCH_MS + 2000));
+    CHECK_EQUAL_C_INT(0, (int)capturedCount);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_traj_advance(&tr, EPOCH_MS + 10000));
+    CHECK_EQUAL_C_INT(1, (int)capturedCount);
+    CHECK_EQUAL_C_INT(10, (int)captured[0].segment.count);
+    CHECK_EQUAL_C_UINT(7, captured[0].segment.id);
+    libsm_traj_free(&tr);
+}
+
+
+TEST_C(trajectory, id_change_is_linked)
+{
+    libsm_traj_t tr;
+
+    setup(&tr, NULL);
+    // old id drives north for 2 s, the new id carries on 300 ms later
+    for (uint64_t i = 0; i < 20; i++) {
+        libsm_traj_sample_t sample = sampleAt(0xAAAA, EPOCH_MS + i * 100, (int32_t)i * 100);
+        libsm_traj_add(&tr, &sample);
+    }
+    for (uint64_t i = 0; i < 20; i++) {
+        libsm_traj_sample_t sample
+                = sampleAt(0xBBBB, EPOCH_MS + 2200 + i * 100, 2200 + (int32_t)i * 100);
+        libsm_traj_add(&tr, &sample);
+    }
+    // somebody else, a kilometer away
+    libsm_traj_sample_t far = sampleAt(0xCCCC, EPOCH_MS + 2300, 100000);
+    libsm_traj_add(&tr, &far);
+    libsm_traj_flush(&tr);
+
+    CHECK_EQUAL_C_INT(3, (int)capturedCount);
+    CHECK_EQUAL_C_ULONG(1, tr.stats.linked);
+    for (size_t i = 0; i < capturedCount; i++) {
+        libsm_traj_segment_t const* s = &captured[i].segment;
+        if (s->id == 0xBBBB) {
+            CHECK_EQUAL_C_ULONG(1, s->linkedFrom);
+        } else {
+            CHECK_EQUAL_C_ULONG(0, s->linkedFrom);
+        }
+    }
+    libsm_traj_free(&tr);
+}
+
+
+TEST_C(trajectory, memory_is_bounded)
+{
+    libsm_traj_t tr;
+    libsm_traj_config_t config;
+
+    libsm_traj_default_config(&config);
+    config.maxTracks = 2;
+    setup(&tr, &config);
+    for (uint32_t id = 1; id <= 3; id++) {
+        for (uint64_t i = 0; i < 5; i++) {
+            libsm_traj_sample_t sample = sampleAt(id, EPOCH_MS + id * 1000 + i * 100, 0);
+            sample.lat += (int32_t)id * 100000;
+            libsm_traj_add(&tr, &sample);
+        }
+    }
+    CHECK_EQUAL_C_ULONG(1, tr.stats.evicted);
+    CHECK_EQUAL_C_INT(1, (int)capturedCount);
+    CHECK_EQUAL_C_UINT(1, captured[0].segment.id);
+    libsm_traj_flush(&tr);
+    CHECK_EQUAL_C_INT(3, (int)capturedCount);
+    libsm_traj_free(&tr);
+}
+
+
+TEST_C(trajectory, samples_from_messages)
+{
+    // PSM from smoketest.c
+    uint8_t const psm[] = { 0x00, 0x20, 0x1A, 0x00, 0x00, 0x04, 0x00, 0x14, 0x15, 0x09,
+                            0x09, 0x09, 0x08, 0x4E, 0xF7, 0xF7, 0x91, 0x39, 0xBA, 0x86,
+                            0x22, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x50, 0x10, 0xE0 };
+    MessageFrame_t* mf = calloc(1, sizeof(MessageFrame_t));
+    libsm_traj_sample_t sample;
+
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_decode_messageframe(psm, sizeof(psm), mf));
+    PersonalSafetyMessage_t const* p = &mf->value.choice.PersonalSafetyMessage;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_traj_sample_from_psm(p, EPOCH_MS, &sample));
+    CHECK_EQUAL_C_INT(LIBSM_TRAJ_SOURCE_PSM, sample.source);
+    CHECK_EQUAL_C_LONG(p->position.lat, sample.lat);
+    CHECK_EQUAL_C_LONG(p->position.Long, sample.Long);
+    CHECK_EQUAL_C_UINT(p->secMark, sample.secMark);
+    CHECK_EQUAL_C_UINT(p->msgCnt, sample.msgCnt);
+    CHECK_EQUAL_C_UINT(((uint32_t)p->id.buf[0] << 24) | ((uint32_t)p->id.buf[1] << 16)
+                               | ((uint32_t)p->id.buf[2] << 8) | p->id.buf[3],
+                       sample.id);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+
+    // every sample of an id lands on the same shard
+    CHECK_C(libsm_traj_shard(&sample, 8) < 8);
+    sample.rxTimeMs += 1000;
+    uint32_t const shard = libsm_traj_shard(&sample, 8);
+    sample.lat += 1000;
+    CHECK_EQUAL_C_UINT(shard, libsm_traj_shard(&sample, 8));
+}
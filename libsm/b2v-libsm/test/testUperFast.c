@@ -0,0 +1,493 @@
+/*
+ * testUperFast.c
+ * Check the specialised UPER codecs against the generic asn1c codec
+ *
+ * Did you know? Documentation for how to write more tests is at https://cpputest.github.io/manual.html
+ */
+#include "CppUTest/TestHarness_c.h"
+#include "libsm.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define CORPUS_SIZE 2000
+
+// bytes asn_random_fill may use for one message, and room for its encoding
+#define FILL_LENGTH 2048
+#define BUFFER_SIZE 8192
+
+
+// xorshift, so every run checks the same corpus
+static uint32_t nextRandom(uint32_t* state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+
+// a value within the constraint of the generated type, often one of its bounds
+static long randomIn(uint32_t* seed, asn_per_constraints_t const* constraints)
+{
+    long const lb = constraints->value.lower_bound;
+    long const ub = constraints->value.upper_bound;
+    uint32_t const pick = nextRandom(seed) % 8;
+    if (pick == 0) {
+        return lb;
+    }
+    if (pick == 1) {
+        return ub;
+    }
+    uint64_t const r = (uint64_t)nextRandom(seed) << 32 | nextRandom(seed);
+    return lb + (long)(r % ((uint64_t)(ub - lb) + 1));
+}
+
+
+static MessageFrame_t* randomBsm(uint32_t* seed, bool withPartII)
+{
+    MessageFrame_t* mf = calloc(1, sizeof(MessageFrame_t));
+    mf->messageId = DSRCmsgID_basicSafetyMessage;
+    mf->value.present = MessageFrame__value_PR_BasicSafetyMessage;
+    BasicSafetyMessage_t* bsm = &mf->value.choice.BasicSafetyMessage;
+    libsm_init_bsm(bsm);
+    BSMcoreData_t* core = &bsm->coreData;
+
+    core->msgCnt = randomIn(seed, &asn_PER_type_Common_MsgCount_constr_1);
+    for (int i = 0; i < 4; i++) {
+        core->id.buf[i] = (uint8_t)nextRandom(seed);
+    }
+    core->secMark = randomIn(seed, &asn_PER_type_DSecond_constr_1);
+    core->lat = randomIn(seed, &asn_PER_type_Latitude_constr_1);
+    core->Long = randomIn(seed, &asn_PER_type_Longitude_constr_1);
+    core->elev = randomIn(seed, &asn_PER_type_Common_Elevation_constr_1);
+    core->accuracy.semiMajor = randomIn(seed, &asn_PER_type_SemiMajorAxisAccuracy_constr_1);
+    core->accuracy.semiMinor = randomIn(seed, &asn_PER_type_SemiMinorAxisAccuracy_constr_1);
+    core->accuracy.orientation =
+            randomIn(seed, &asn_PER_type_SemiMajorAxisOrientation_constr_1);
+    core->transmission = randomIn(seed, &asn_PER_type_TransmissionState_constr_1);
+    core->speed = randomIn(seed, &asn_PER_type_Speed_constr_1);
+    core->heading = randomIn(seed, &asn_PER_type_Heading_constr_1);
+    core->angle = randomIn(seed, &asn_PER_type_SteeringWheelAngle_constr_1);
+    core->accelSet.Long = randomIn(seed, &asn_PER_type_Acceleration_constr_1);
+    core->accelSet.lat = randomIn(seed, &asn_PER_type_Acceleration_constr_1);
+    core->accelSet.vert = randomIn(seed, &asn_PER_type_VerticalAcceleration_constr_1);
+    core->accelSet.yaw = randomIn(seed, &asn_PER_type_YawRate_constr_1);
+    core->brakes.wheelBrakes.buf[0] = (uint8_t)(nextRandom(seed) & 0xF8);
+    core->brakes.traction = randomIn(seed, &asn_PER_type_TractionControlStatus_constr_1);
+    core->brakes.abs = randomIn(seed, &asn_PER_type_AntiLockBrakeStatus_constr_1);
+    core->brakes.scs = randomIn(seed, &asn_PER_type_StabilityControlStatus_constr_1);
+    core->brakes.brakeBoost = randomIn(seed, &asn_PER_type_BrakeBoostApplied_constr_1);
+    core->brakes.auxBrakes = randomIn(seed, &asn_PER_type_AuxiliaryBrakeStatus_constr_1);
+    core->size.width = randomIn(seed, &asn_PER_type_VehicleWidth_constr_1);
+    core->size.length = randomIn(seed, &asn_PER_type_VehicleLength_constr_1);
+
+    if (withPartII) {
+        libsm_init_bsm_path_history(bsm);
+        VehicleSafetyExtensions_t* vse = libsm_get_partII_elem(
+                bsm,
+                BSMpartIIExtension__partII_Value_PR_VehicleSafetyExtensions);
+        int const crumbs = (int)(nextRandom(seed) % 22);
+        for (int i = 0; i < crumbs; i++) {
+            PathHistoryPoint_t* point = libsm_alloc_init_PathHistoryPoint();
+            point->latOffset = randomIn(seed, &asn_PER_type_OffsetLL_B18_constr_1);
+            point->lonOffset = randomIn(seed, &asn_PER_type_OffsetLL_B18_constr_1);
+            point->elevationOffset = randomIn(seed, &asn_PER_type_VertOffset_B12_constr_1);
+            point->timeOffset = randomIn(seed, &asn_PER_type_TimeOffset_constr_1);
+            ASN_SEQUENCE_ADD(&vse->pathHistory->crumbData.list, point);
+        }
+        if (nextRandom(seed) % 2) {
+            libsm_set_path_prediction(bsm,
+                                      randomIn(seed, &asn_PER_type_Confidence_constr_1),
+                                      randomIn(seed, &asn_PER_type_RadiusOfCurvature_constr_1));
+        }
+    }
+    return mf;
+}
+
+
+// a MAP of up to 3 intersections, with node offsets of every size
+static MessageFrame_t* randomMap(uint32_t* seed)
+{
+    MessageFrame_t* mf = libsm_alloc_init_mf_map();
+    MapData_t* map = libsm_get_map(mf);
+    map->msgIssueRevision = randomIn(seed, &asn_PER_type_Common_MsgCount_constr_1);
+    if (nextRandom(seed) % 2) {
+        map->timeStamp = calloc(1, sizeof(*map->timeStamp));
+        *map->timeStamp = randomIn(seed, &asn_PER_type_MinuteOfTheYear_constr_1);
+    }
+    int const intersections = 1 + (int)(nextRandom(seed) % 3);
+    for (int i = 0; i < intersections; i++) {
+        IntersectionGeometry_t* geometry = libsm_add_map_intersectionGeometry(
+                map,
+                randomIn(seed, &asn_PER_type_IntersectionID_constr_1),
+                randomIn(seed, &asn_PER_type_Latitude_constr_1),
+                randomIn(seed, &asn_PER_type_Longitude_constr_1));
+        if (nextRandom(seed) % 2) {
+            geometry->laneWidth = calloc(1, sizeof(*geometry->laneWidth));
+            *geometry->laneWidth = randomIn(seed, &asn_PER_type_LaneWidth_constr_1);
+        }
+        int const lanes = 1 + (int)(nextRandom(seed) % 6);
+        for (int l = 1; l <= lanes; l++) {
+            GenericLane_t* lane = libsm_add_map_genericLane(
+                    geometry,
+                    l,
+                    (uint8_t)(nextRandom(seed) % 4),
+                    (LaneTypeAttributes_PR)(1 + nextRandom(seed) % 8));
+            int const nodes = 2 + (int)(nextRandom(seed) % 7);
+            for (int n = 0; n < nodes; n++) {
+                long const range = 1L << (9 + nextRandom(seed) % 7);
+                libsm_add_map_nodeXY(lane,
+                                     (long)(nextRandom(seed) % (uint32_t)range) - range / 2,
+                                     (long)(nextRandom(seed) % (uint32_t)range) - range / 2);
+            }
+            if (l < lanes && nextRandom(seed) % 2) {
+                libsm_add_map_connection(lane, l + 1, (long)(nextRandom(seed) % 256) - 1);
+            }
+        }
+    }
+    return mf;
+}
+
+
+// encode with both codecs, then decode the result with both and compare the structures
+static void checkSameAsGeneric(MessageFrame_t* mf)
+{
+    static uint8_t generic[BUFFER_SIZE];
+    static uint8_t fast[BUFFER_SIZE];
+    size_t genericLen = sizeof(generic);
+    size_t fastLen = sizeof(fast);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, generic, &genericLen));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_uper_fast_encode(mf, fast, &fastLen));
+    CHECK_EQUAL_C_ULONG(genericLen, fastLen);
+    CHECK_C(memcmp(generic, fast, genericLen) == 0);
+
+    MessageFrame_t genericMf = { 0 };
+    MessageFrame_t fastMf = { 0 };
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_decode_messageframe(generic, genericLen, &genericMf));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_uper_fast_decode(generic, genericLen, &fastMf));
+    CHECK_EQUAL_C_INT(0, asn_DEF_MessageFrame.op->compare_struct(&asn_DEF_MessageFrame,
+                                                                  &genericMf,
+                                                                  &fastMf));
+    ASN_STRUCT_RESET(asn_DEF_MessageFrame, &genericMf);
+    ASN_STRUCT_RESET(asn_DEF_MessageFrame, &fastMf);
+}
+
+
+// a RegionalExtension or a list of them, whose open type asn_random_fill can not fill
+static bool holdsOpenType(asn_TYPE_descriptor_t const* td)
+{
+    if (td->op == &asn_OP_SEQUENCE_OF) {
+        td = td->elements[0].type;
+    }
+    for (unsigned i = 0; i < td->elements_count; i++) {
+        if (td->elements[i].flags & ATF_OPEN_TYPE) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+// asn_random_fill, going down SEQUENCEs, SEQUENCE OFs and CHOICEs here to leave open types out
+
+static void randomFill(uint32_t* seed,
+                       asn_TYPE_descriptor_t const* td,
+                       asn_encoding_constraints_t const* constraints,
+                       void** sptr)
+{
+    if (td->op == &asn_OP_SEQUENCE) {
+        asn_SEQUENCE_specifics_t const* specs = td->specifics;
+        if (*sptr == NULL) {
+            *sptr = calloc(1, specs->struct_size);
+        }
+        for (unsigned i = 0; i < td->elements_count; i++) {
+            asn_TYPE_member_t const* elm = &td->elements[i];
+            if (holdsOpenType(elm->type) || (elm->optional && nextRandom(seed) % 2)) {
+                continue;
+            }
+            void* member = (char*)*sptr + elm->memb_offset;
+            void** memberPtr = (elm->flags & ATF_POINTER) ? member : &member;
+            randomFill(seed, elm->type, &elm->encoding_constraints, memberPtr);
+        }
+    } else if (td->op == &asn_OP_SEQUENCE_OF) {
+        asn_SET_OF_specifics_t const* specs = td->specifics;
+        if (*sptr == NULL) {
+            *sptr = calloc(1, specs->struct_size);
+        }
+        asn_per_constraints_t const* pc = constraints->per_constraints != NULL
+                                                  ? constraints->per_constraints
+                                                  : td->encoding_constraints.per_constraints;
+        long const lb = pc->size.lower_bound;
+        long const ub = pc->size.upper_bound < lb + 3 ? pc->size.upper_bound : lb + 3;
+        long const count = lb + (long)(nextRandom(seed) % (uint32_t)(ub - lb + 1));
+        for (long i = 0; i < count; i++) {
+            void* element = NULL;
+            randomFill(seed, td->elements[0].type, &td->elements[0].encoding_constraints, &element);
+            asn_sequence_add(*sptr, element);
+        }
+    } else if (td->op == &asn_OP_CHOICE) {
+        asn_CHOICE_specifics_t const* specs = td->specifics;
+        if (*sptr == NULL) {
+            *sptr = calloc(1, specs->struct_size);
+        }
+        unsigned i = nextRandom(seed) % td->elements_count;
+        if (holdsOpenType(td->elements[i].type)) {
+            i = (i + 1) % td->elements_count;
+        }
+        asn_TYPE_member_t const* elm = &td->elements[i];
+        void* member = (char*)*sptr + elm->memb_offset;
+        void** memberPtr = (elm->flags & ATF_POINTER) ? member : &member;
+        randomFill(seed, elm->type, &elm->encoding_constraints, memberPtr);
+        CHECK_EQUAL_C_UINT(sizeof(int), specs->pres_size);
+        *(int*)((char*)*sptr + specs->pres_offset) = (int)i + 1;
+    } else {
+        CHECK_EQUAL_C_INT(ARFILL_OK, td->op->random_fill(td, sptr, constraints, FILL_LENGTH).code);
+    }
+}
+
+
+/*
+ * A random value of a generated type, which may have extensions or values
+ * outside the root. Returns whether the specialised codec took it, after
+ * checking it gives what asn1c gives whenever it does.
+ */
+static bool checkRandomFill(uint32_t* seed, asn_TYPE_descriptor_t* td, DSRCmsgID_t id, int present)
+{
+    MessageFrame_t* mf = calloc(1, sizeof(MessageFrame_t));
+    mf->messageId = id;
+    mf->value.present = present;
+    void* value = &mf->value.choice;
+    randomFill(seed, td, &td->encoding_constraints, &value);
+
+    static uint8_t generic[BUFFER_SIZE];
+    static uint8_t fast[BUFFER_SIZE];
+    size_t genericLen = sizeof(generic);
+    size_t fastLen = sizeof(fast);
+    libsm_rval_e const genericRval = libsm_encode_messageframe(mf, generic, &genericLen);
+    libsm_rval_e const fastRval = libsm_uper_fast_encode(mf, fast, &fastLen);
+    if (fastRval == LIBSM_OK) {
+        CHECK_EQUAL_C_INT(LIBSM_OK, genericRval);
+        CHECK_EQUAL_C_ULONG(genericLen, fastLen);
+        CHECK_C(memcmp(generic, fast, genericLen) == 0);
+    }
+    if (genericRval == LIBSM_OK) {
+        MessageFrame_t genericMf = { 0 };
+        MessageFrame_t fastMf = { 0 };
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_decode_messageframe(generic, genericLen, &genericMf));
+        libsm_rval_e const decodeRval = libsm_uper_fast_decode(generic, genericLen, &fastMf);
+        // what the specialised encoder takes, the specialised decoder takes back
+        if (fastRval == LIBSM_OK) {
+            CHECK_EQUAL_C_INT(LIBSM_OK, decodeRval);
+        }
+        if (decodeRval == LIBSM_OK) {
+            CHECK_EQUAL_C_INT(0, asn_DEF_MessageFrame.op->compare_struct(&asn_DEF_MessageFrame,
+                                                                          &genericMf,
+                                                                          &fastMf));
+        }
+        ASN_STRUCT_RESET(asn_DEF_MessageFrame, &genericMf);
+        ASN_STRUCT_RESET(asn_DEF_MessageFrame, &fastMf);
+    }
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    return fastRval == LIBSM_OK;
+}
+
+
+static void checkRandomFills(asn_TYPE_descriptor_t* td, DSRCmsgID_t id, int present)
+{
+    uint32_t seed = 3500000;
+    asn_random_seed(35);
+    int taken = 0;
+    for (int i = 0; i < CORPUS_SIZE / 4; i++) {
+        taken += checkRandomFill(&seed, td, id, present);
+    }
+    // the rest has values outside the root, or is missing an open type it needs
+    CHECK_C(taken > CORPUS_SIZE / 8);
+}
+
+
+
+TEST_C(uper_fast, invalid_args)
+{
+    uint8_t buf[64];
+    size_t len = sizeof(buf);
+    MessageFrame_t mf = { 0 };
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_uper_fast_encode(NULL, buf, &len));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_uper_fast_decode(NULL, 0, &mf));
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NULL_ARG, libsm_uper_fast_decode(buf, sizeof(buf), NULL));
+}
+
+
+TEST_C(uper_fast, core_matches_generic)
+{
+    uint32_t seed = 35;
+    for (int i = 0; i < CORPUS_SIZE; i++) {
+        MessageFrame_t* mf = randomBsm(&seed, false);
+        checkSameAsGeneric(mf);
+        ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    }
+}
+
+
+TEST_C(uper_fast, part_ii_matches_generic)
+{
+    uint32_t seed = 350;
+    for (int i = 0; i < CORPUS_SIZE / 4; i++) {
+        MessageFrame_t* mf = randomBsm(&seed, true);
+        checkSameAsGeneric(mf);
+        ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    }
+}
+
+
+TEST_C(uper_fast, falls_back_to_generic)
+{
+    uint32_t seed = 3500;
+    uint8_t generic[512];
+    uint8_t fast[512];
+    size_t genericLen = sizeof(generic);
+    size_t fastLen = sizeof(fast);
+    MessageFrame_t* mf = randomBsm(&seed, false);
+
+    // outside its constraint, only asn1c decides what happens
+    mf->value.choice.BasicSafetyMessage.coreData.heading = 28801;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_uper_fast_encode(mf, fast, &fastLen));
+    CHECK_EQUAL_C_INT(libsm_encode_messageframe(mf, generic, &genericLen),
+                      libsm_uper_fast_encode_messageframe(mf, fast, &fastLen));
+    mf->value.choice.BasicSafetyMessage.coreData.heading = 0;
+
+    // too small a buffer
+    fastLen = 20;
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_ENCODING_BUFF_SIZE, libsm_uper_fast_encode(mf, fast, &fastLen));
+    genericLen = 20;
+    fastLen = 20;
+    CHECK_EQUAL_C_INT(libsm_encode_messageframe(mf, generic, &genericLen),
+                      libsm_uper_fast_encode_messageframe(mf, fast, &fastLen));
+
+    // messages missing from tooling/uperFastTypes go through the generic codec both ways
+    libsm_corpus_config_t config;
+    libsm_corpus_default_config(&config);
+    config.bsmWeight = 0;
+    config.psmWeight = 0;
+    config.spatWeight = 0;
+    MessageFrame_t* tim = NULL;
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_corpus_build(&config, 0, &tim));
+    genericLen = sizeof(generic);
+    fastLen = sizeof(fast);
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER, libsm_uper_fast_encode(tim, fast, &fastLen));
+    fastLen = sizeof(fast);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(tim, generic, &genericLen));
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_uper_fast_encode_messageframe(tim, fast, &fastLen));
+    CHECK_EQUAL_C_ULONG(genericLen, fastLen);
+    CHECK_C(memcmp(generic, fast, genericLen) == 0);
+
+    MessageFrame_t decoded = { 0 };
+    CHECK_EQUAL_C_INT(LIBSM_FAIL_NO_VALID_PARAMETER,
+                      libsm_uper_fast_decode(fast, fastLen, &decoded));
+    ASN_STRUCT_RESET(asn_DEF_MessageFrame, &decoded);
+    CHECK_EQUAL_C_INT(LIBSM_OK, libsm_uper_fast_decode_messageframe(fast, fastLen, &decoded));
+    CHECK_EQUAL_C_INT(DSRCmsgID_travelerInformation, decoded.messageId);
+
+    ASN_STRUCT_RESET(asn_DEF_MessageFrame, &decoded);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, tim);
+    ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+}
+
+
+// flipped bits and truncations decode to the same result either way, for every message
+TEST_C(uper_fast, damaged_input_matches_generic)
+{
+    uint32_t seed = 35000;
+    libsm_corpus_config_t config;
+    libsm_corpus_default_config(&config);
+    config.bsmWeight = 0;
+    config.timWeight = 0;
+    for (int i = 0; i < CORPUS_SIZE; i++) {
+        MessageFrame_t* mf = NULL;
+        if (i % 4 == 0) {
+            CHECK_EQUAL_C_INT(LIBSM_OK, libsm_corpus_build(&config, (uint64_t)i, &mf));
+        } else if (i % 4 == 1) {
+            mf = randomMap(&seed);
+        } else {
+            mf = randomBsm(&seed, i % 4 == 2);
+        }
+        static uint8_t encoded[BUFFER_SIZE];
+        size_t len = sizeof(encoded);
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_encode_messageframe(mf, encoded, &len));
+        ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+
+        int const flips = (int)(nextRandom(&seed) % 3);
+        for (int f = 0; f < flips; f++) {
+            size_t const bit = nextRandom(&seed) % (len * 8);
+            encoded[bit / 8] ^= (uint8_t)(0x80 >> (bit % 8));
+        }
+        if (nextRandom(&seed) % 4 == 0) {
+            len = 1 + nextRandom(&seed) % len;
+        }
+
+        MessageFrame_t genericMf = { 0 };
+        MessageFrame_t fastMf = { 0 };
+        libsm_rval_e const genericRval = libsm_decode_messageframe(encoded, len, &genericMf);
+        libsm_rval_e const fastRval = libsm_uper_fast_decode_messageframe(encoded, len, &fastMf);
+        CHECK_EQUAL_C_INT(genericRval, fastRval);
+        if (genericRval == LIBSM_OK) {
+            CHECK_EQUAL_C_INT(0, asn_DEF_MessageFrame.op->compare_struct(&asn_DEF_MessageFrame,
+                                                                          &genericMf,
+                                                                          &fastMf));
+        }
+        ASN_STRUCT_RESET(asn_DEF_MessageFrame, &genericMf);
+        ASN_STRUCT_RESET(asn_DEF_MessageFrame, &fastMf);
+    }
+}
+
+
+// PSMs and SPATs as libsm builds them
+TEST_C(uper_fast, corpus_matches_generic)
+{
+    libsm_corpus_config_t config;
+    libsm_corpus_default_config(&config);
+    config.bsmWeight = 0;
+    config.timWeight = 0;
+    config.intersectionsMax = 8;
+    for (uint64_t i = 0; i < CORPUS_SIZE / 4; i++) {
+        MessageFrame_t* mf = NULL;
+        CHECK_EQUAL_C_INT(LIBSM_OK, libsm_corpus_build(&config, i, &mf));
+        checkSameAsGeneric(mf);
+        ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    }
+}
+
+
+TEST_C(uper_fast, random_psm_matches_generic)
+{
+    checkRandomFills(&asn_DEF_PersonalSafetyMessage,
+                     DSRCmsgID_personalSafetyMessage,
+                     MessageFrame__value_PR_PersonalSafetyMessage);
+}
+
+
+TEST_C(uper_fast, random_spat_matches_generic)
+{
+    checkRandomFills(&asn_DEF_SPAT,
+                     DSRCmsgID_signalPhaseAndTimingMessage,
+                     MessageFrame__value_PR_SPAT);
+}
+
+
+TEST_C(uper_fast, map_matches_generic)
+{
+    uint32_t seed = 350000;
+    for (int i = 0; i < CORPUS_SIZE / 4; i++) {
+        MessageFrame_t* mf = randomMap(&seed);
+        checkSameAsGeneric(mf);
+        ASN_STRUCT_FREE(asn_DEF_MessageFrame, mf);
+    }
+}
+
+
+TEST_C(uper_fast, random_map_matches_generic)
+{
+    checkRandomFills(&asn_DEF_MapData, DSRCmsgID_mapData, MessageFrame__value_PR_MapData);
+}
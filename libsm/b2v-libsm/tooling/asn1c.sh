@@ -107,6 +107,171 @@ buildASN1c() {
         cd .. || die "can't cd"
     fi
 }
+
+# allocation accounting behind LIBSM_STATS, see tooling/skeletons/asn_stats.h
+# pass in the asn1c output dir, works on an already instrumented dir too
+instrumentSkeletons() {
+    outputDir=$1
+    skeletons="$(dirname "${BASH_SOURCE[0]}")/skeletons"
+
+    cp "$skeletons"/asn_stats.[ch] "$outputDir"/
+    if [ -f "$outputDir"/Makefile.am.libasncodec ] \
+        && ! grep -q asn_stats "$outputDir"/Makefile.am.libasncodec; then
+        printf 'ASN_MODULE_HDRS+=asn_stats.h\nASN_MODULE_SRCS+=asn_stats.c\n' \
+            >> "$outputDir"/Makefile.am.libasncodec
+    fi
+    grep -q ASN_STATS_TYPE "$outputDir"/asn_internal.h && return
+
+    sed -i '/^#define\tCALLOC(nmemb, size)\tcalloc(nmemb, size)$/,/^#define\tFREEMEM(ptr)\t\tfree(ptr)$/c\
+#if\tLIBSM_STATS\
+#include "asn_stats.h"\
+#define\tCALLOC(nmemb, size)\tasn_stats_calloc(nmemb, size)\
+#define\tMALLOC(size)\t\tasn_stats_malloc(size)\
+#define\tREALLOC(oldptr, size)\tasn_stats_realloc(oldptr, size)\
+#define\tFREEMEM(ptr)\t\tasn_stats_free(ptr)\
+#define\tASN_STATS_TYPE(td)\tasn_stats_set_type(td)\
+#else\
+#define\tCALLOC(nmemb, size)\tcalloc(nmemb, size)\
+#define\tMALLOC(size)\t\tmalloc(size)\
+#define\tREALLOC(oldptr, size)\trealloc(oldptr, size)\
+#define\tFREEMEM(ptr)\t\tfree(ptr)\
+#define\tASN_STATS_TYPE(td)\tdo{}while(0)\
+#endif' "$outputDir"/asn_internal.h
+
+    # charge decoder allocations to the type being decoded
+    for f in "$outputDir"/*_uper.c; do
+        sed -i '/_decode_uper(/,/asn_per_data_t \*pd) {/{/asn_per_data_t \*pd) {/a\    ASN_STATS_TYPE(td);
+}' "$f"
+    done
+    # and back to the parent once a member is decoded
+    sed -i 's/^\(\s*\)if(ASN_SET_ADD(list, ptr) == 0) {/\1ASN_STATS_TYPE(td);\n&/' \
+        "$outputDir"/constr_SET_OF_uper.c
+    sed -i 's/^\(\s*\)if(rv.code != RC_OK) {$/\1ASN_STATS_TYPE(td);\n&/' \
+        "$outputDir"/constr_SEQUENCE_uper.c
+    sed -i 's/^\(\s*\)if(rv.code != RC_OK)$/\1ASN_STATS_TYPE(td);\n&/' \
+        "$outputDir"/constr_CHOICE_uper.c
+    # and encoder allocations to the type being encoded
+    sed -i 's/^\(\s*\)er = td->op->uper_encoder(td, constraints, sptr, &po);/\1ASN_STATS_TYPE(td);\n&\n\1ASN_STATS_TYPE(0);/' \
+        "$outputDir"/uper_encoder.c
+    sed -i 's/^\(\s*\)rval = td->op->uper_decoder(opt_codec_ctx, td, 0, sptr, &pd);/&\n\1ASN_STATS_TYPE(0);/' \
+        "$outputDir"/uper_decoder.c
+}
+# no process wide mutable state in the runtime, so one libsm can be shared by threads
+# pass in the asn1c output dir, works on an already converted dir too
+reentrantSkeletons() {
+    outputDir=$1
+    grep -q ASN_THREAD_LOCAL "$outputDir"/asn_system.h && return
+
+    sed -i 's|^#endif\t/\* ASN_SYSTEM_H \*/$|/* Storage of state that is per thread */\
+#if __STDC_VERSION__ >= 201112L\
+#define ASN_THREAD_LOCAL _Thread_local\
+#elif defined(_MSC_VER)\
+#define ASN_THREAD_LOCAL __declspec(thread)\
+#else\
+#define ASN_THREAD_LOCAL __thread\
+#endif\
+\
+&|' "$outputDir"/asn_system.h
+
+    # the debug indentation was a tentative definition in every object
+    sed -i 's/^int asn_debug_indent;$/extern ASN_THREAD_LOCAL int asn_debug_indent;/' \
+        "$outputDir"/asn_internal.h
+    printf '%s\n' '' \
+        '#if ASN_EMIT_DEBUG == 1 && __STDC_VERSION__ >= 199901L && !defined(ASN_THREAD_SAFE)' \
+        'ASN_THREAD_LOCAL int asn_debug_indent;' \
+        '#endif' >> "$outputDir"/asn_internal.c
+
+    sed -i 's/^\tstatic char buf\[2\]\[32\];$/\tstatic ASN_THREAD_LOCAL char buf[2][32];/; s/^\tstatic int n;$/\tstatic ASN_THREAD_LOCAL int n;/' \
+        "$outputDir"/asn_bit_data.c
+    sed -i 's/^    static unsigned lengths\[\] = {/    static const unsigned lengths[] = {/' \
+        "$outputDir"/BIT_STRING_rfill.c
+
+    # random fill draws from its own generator instead of rand()
+    sed -i '/^#ifdef HAVE_RANDOM$/,/^#endif$/c\
+            value = (value << 24) | (asn__random() % max);' "$outputDir"/asn_random_fill.c
+    sed -i '/^static uintmax_t$/i\
+/* xorshift32, per thread, so fills are reentrant and the same on every libc */\
+static ASN_THREAD_LOCAL uint32_t asn_random_state = 2463534242u;\
+\
+void\
+asn_random_seed(unsigned int seed) {\
+    asn_random_state = seed ? seed : 2463534242u;\
+}\
+\
+static long\
+asn__random(void) {\
+    uint32_t x = asn_random_state;\
+    x ^= x << 13;\
+    x ^= x >> 17;\
+    x ^= x << 5;\
+    asn_random_state = x;\
+    return (long)(x >> 1);\
+}\
+' "$outputDir"/asn_random_fill.c
+    sed -i 's/^intmax_t asn_random_between(intmax_t min, intmax_t max);$/&\
+\
+\/*\
+ * Seed the generator of the calling thread, asn_random_fill draws from it.\
+ *\/\
+void asn_random_seed(unsigned int seed);/' "$outputDir"/asn_random_fill.h
+}
+# shared hex codec, see tooling/skeletons/asn_hex.h, used by the OCTET and BIT STRING JER codecs
+# pass in the asn1c output dir, works on an already converted dir too
+hexSkeletons() {
+    outputDir=$1
+    skeletons="$(dirname "${BASH_SOURCE[0]}")/skeletons"
+
+    cp "$skeletons"/asn_hex.[ch] "$outputDir"/
+    if [ -f "$outputDir"/Makefile.am.libasncodec ] \
+        && ! grep -q asn_hex "$outputDir"/Makefile.am.libasncodec; then
+        printf 'ASN_MODULE_HDRS+=asn_hex.h\nASN_MODULE_SRCS+=asn_hex.c\n' \
+            >> "$outputDir"/Makefile.am.libasncodec
+    fi
+    grep -q asn_hex "$outputDir"/OCTET_STRING_jer.c && return
+    patch -d "$outputDir" -p0 --forward < "$skeletons"/asn_hex_jer.diff || die "asn_hex_jer.diff"
+}
+# UPER encoding without the heap, for integers and open types that fit on the stack
+# pass in the asn1c output dir, works on an already converted dir too
+noallocSkeletons() {
+    outputDir=$1
+    skeletons="$(dirname "${BASH_SOURCE[0]}")/skeletons"
+
+    grep -q UPER_OPEN_TYPE_LOCAL "$outputDir"/uper_opentype.c && return
+    patch -d "$outputDir" -p0 --forward < "$skeletons"/asn_uper_noalloc.diff \
+        || die "asn_uper_noalloc.diff"
+}
+# JER names of ENUMERATED values go straight to and from the native long
+# pass in the asn1c output dir, works on an already converted dir too
+enumSkeletons() {
+    outputDir=$1
+    skeletons="$(dirname "${BASH_SOURCE[0]}")/skeletons"
+
+    # only modules with ENUMERATED types have the skeletons
+    [ -f "$outputDir"/NativeEnumerated_jer.c ] || return 0
+    grep -q NativeEnumerated__jer_body_decode "$outputDir"/NativeEnumerated_jer.c && return
+    patch -d "$outputDir" -p0 --forward < "$skeletons"/asn_jer_enum.diff \
+        || die "asn_jer_enum.diff"
+}
+# UPER decoding that borrows large OCTET STRINGs instead of copying them, see asn_codecs.h
+# pass in the asn1c output dir, works on an already converted dir too
+borrowSkeletons() {
+    outputDir=$1
+    skeletons="$(dirname "${BASH_SOURCE[0]}")/skeletons"
+
+    grep -q borrow_arena "$outputDir"/asn_codecs.h && return
+    patch -d "$outputDir" -p0 --forward < "$skeletons"/asn_uper_borrow.diff \
+        || die "asn_uper_borrow.diff"
+}
+# open types UPER decoders keep encoded and encoders put back as they were, see OPEN_TYPE.h
+# pass in the asn1c output dir, works on an already converted dir too
+opaqueSkeletons() {
+    outputDir=$1
+    skeletons="$(dirname "${BASH_SOURCE[0]}")/skeletons"
+
+    grep -q opaque_open_types "$outputDir"/asn_codecs.h && return
+    patch -d "$outputDir" -p0 --forward < "$skeletons"/asn_uper_opaque.diff \
+        || die "asn_uper_opaque.diff"
+}
 compileASN() {
     tmp_dir=$1
     input_name=$2
@@ -140,6 +305,14 @@ compileASN() {
     # change what word asn1c uses
     sed -i 's/\*free/*asn_free/; s/->free/->asn_free/' "$outputDir"/asn_SE*.[ch]
 
+    instrumentSkeletons "$outputDir"
+    reentrantSkeletons "$outputDir"
+    hexSkeletons "$outputDir"
+    noallocSkeletons "$outputDir"
+    enumSkeletons "$outputDir"
+    borrowSkeletons "$outputDir"
+    opaqueSkeletons "$outputDir"
+
 
     # make CMakeLists.files.txt
     echo "set(${input_name^}_HEADERS" > "$outputDir"/CMakeLists.files.txt
@@ -167,7 +340,14 @@ include(CheckCompilerFlag)
 # you just do "cmake -DJ2735_EMIT_DEBUG=ON .." to set
 option(${input_name^}_EMIT_DEBUG "enable ASN_EMIT_DEBUG for ${input_name^}" OFF)
 
-add_library(${input_name} SHARED \${${input_name^}_SRCS} \${${input_name^}_HEADERS})
+if(${input_name^}_ROOT_TYPES)
+    asn_type_closure(${input_name^}_SRCS ${input_name^}_HEADERS \${CMAKE_CURRENT_SOURCE_DIR} \${${input_name^}_ROOT_TYPES})
+    list(LENGTH ${input_name^}_SRCS ${input_name}_count)
+    message("-- ${input_name}: \${${input_name}_count} sources reachable from \${${input_name^}_ROOT_TYPES}")
+endif()
+
+add_library(${input_name} \${LIBSM_LIBRARY_TYPE} \${${input_name^}_SRCS} \${${input_name^}_HEADERS})
+libsm_library_options(${input_name})
 
 filter_supported_flags(${input_name^}_CFLAGS "C"
         -Wall
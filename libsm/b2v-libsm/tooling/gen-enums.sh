@@ -0,0 +1,205 @@
+#!/usr/bin/env bash
+set -euo pipefail
+DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" >/dev/null 2>&1 && pwd )"
+ROOT=$(realpath "$DIR/../")
+
+# shellcheck disable=SC2120
+h () {
+    # if arguments, print them
+    [ $# == 0 ] || echo "$*"
+
+  cat <<EOF
+Usage: $0 [OPTION]...
+Regenerate src/libsm-enumTable.h, the perfect hash of libsm-enum.c over the
+names of every ENUMERATED and named INTEGER type in src/j2735
+  -h, --help       display this help and exit
+EOF
+
+    # if args, exit 1 else exit 0
+    [ $# == 0 ] || exit 1
+    exit 0
+}
+
+case "${1:-}" in
+    -h|--help) h ;;
+    "") ;;
+    *) h "unexpected argument '$1'" ;;
+esac
+
+j2735="$ROOT/src/j2735"
+out="$ROOT/src/libsm-enumTable.h"
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+# ASN.1 type name, value name and value, tab separated, of every top level
+# ENUMERATED, from the value2enum map in front of its descriptor
+for source in $(grep -l '&asn_OP_NativeEnumerated,' "$j2735"/*.c | LC_ALL=C sort); do
+    awk '
+        /_value2enum_1\[\] = \{/ { inMap = 1; n = 0; next }
+        inMap && /^\};/ { inMap = 0; next }
+        inMap && /^\t\{ / {
+            split($0, field, "\"")
+            value = $2
+            sub(/,$/, "", value)
+            names[n] = field[2]
+            values[n++] = value
+            next
+        }
+        /^asn_TYPE_descriptor_t asn_DEF_/ {
+            getline type
+            getline
+            getline op
+            if (op !~ /asn_OP_NativeEnumerated/) {
+                next
+            }
+            gsub(/[\t",]/, "", type)
+            for (i = 0; i < n; i++) {
+                printf "%s\t%s\t%s\n", type, names[i], values[i]
+            }
+        }
+    ' "$source" >> "$tmp/names"
+done
+
+# and every INTEGER with named numbers, which asn1c only has as #defines
+for header in $(grep -l '^#define [A-Za-z0-9_]*	(([A-Za-z0-9_]*_t)-\?[0-9]*)$' "$j2735"/*.h \
+                    | LC_ALL=C sort); do
+    source="${header%.h}.c"
+    [ -f "$source" ] || continue
+    type=$(grep -A1 '^asn_TYPE_descriptor_t asn_DEF_' "$source" | sed -n '2s/[\t",]//gp')
+    # C names are the ASN.1 names with - as _
+    sed -n -E 's/^#define ([A-Za-z0-9]+(_[A-Za-z0-9]+)*)_([A-Za-z0-9_]+)\t\(\(\1_t\)(-?[0-9]+)\)$/\3\t\4/p' \
+        "$header" \
+        | awk -F'\t' -v type="$type" '{ gsub(/_/, "-", $1); printf "%s\t%s\t%s\n", type, $1, $2 }' \
+        >> "$tmp/names"
+done
+
+# spellings libsm accepted before the tables, beside the ASN.1 names
+printf '%s\n' \
+    "PersonalDeviceUserType	pedestrian	1" \
+    "PersonalDeviceUserType	pedalcyclist	2" \
+    "PersonalDeviceUserType	public safety worker	3" \
+    "PersonalDeviceUserType	animal	4" \
+    > "$tmp/aliases"
+
+LC_ALL=C sort -t"$(printf '\t')" -k1,1 -k3,3n "$tmp/names" > "$tmp/sorted"
+cat "$tmp/aliases" >> "$tmp/sorted"
+[ "$(cut -f1,2 "$tmp/sorted" | tr '_' '-' | LC_ALL=C sort | uniq -d | wc -l)" -eq 0 ] \
+    || { echo "duplicate names"; exit 1; }
+
+# Hash and displace: a key is the type name, ':' and the value name with _ as
+# -. h1 picks the bucket, each bucket has the displacement d that moves all of
+# its keys to free slots (h2 + d * h3) % slots. libsm-enum.c hashes the same.
+LC_ALL=C awk -F'\t' -v out="$tmp/table" '
+    BEGIN {
+        n = 0
+        for (i = 1; i < 256; i++) {
+            ord[sprintf("%c", i)] = i
+        }
+    }
+    {
+        type[n] = $1
+        name[n] = $2
+        value[n] = $3
+        key = $1 ":" $2
+        gsub(/_/, "-", key)
+        a = 5381
+        b = 0
+        for (i = 1; i <= length(key); i++) {
+            c = ord[substr(key, i, 1)]
+            a = (a * 33 + c) % 4294967296
+            b = (b * 131 + c) % 4294967296
+        }
+        h1[n] = a
+        h2[n] = b
+        h3[n] = int(a / 65536)
+        if (h3[n] % 2 == 0) {
+            h3[n]++
+        }
+        n++
+    }
+    END {
+        for (slots = 1; slots < 2 * n; slots *= 2) {
+        }
+        for (buckets = 1; buckets * 4 < n; buckets *= 2) {
+        }
+        for (k = 0; k < n; k++) {
+            bucket = h1[k] % buckets
+            members[bucket, size[bucket]++] = k
+        }
+        # biggest buckets first, while most slots are free
+        for (want = n; want > 0; want--) {
+            for (bucket = 0; bucket < buckets; bucket++) {
+                if (size[bucket] != want) {
+                    continue
+                }
+                for (d = 0; d < 65536; d++) {
+                    ok = 1
+                    for (j = 0; j < want && ok; j++) {
+                        k = members[bucket, j]
+                        s = (h2[k] + d * h3[k]) % slots
+                        if (s in slot || trial[s] == bucket "/" d) {
+                            ok = 0
+                        }
+                        trial[s] = bucket "/" d
+                    }
+                    if (ok) {
+                        break
+                    }
+                }
+                if (!ok) {
+                    print "no displacement for bucket " bucket > "/dev/stderr"
+                    exit 1
+                }
+                displacement[bucket] = d
+                for (j = 0; j < want; j++) {
+                    k = members[bucket, j]
+                    slot[(h2[k] + d * h3[k]) % slots] = k + 1
+                }
+            }
+        }
+
+        printf "#define LIBSM_ENUM_COUNT %d\n", n > out
+        printf "#define LIBSM_ENUM_BUCKETS %d\n", buckets > out
+        printf "#define LIBSM_ENUM_SLOTS %d\n\n", slots > out
+        print "// sorted by type and value, the aliases last" > out
+        print "static libsm_enum_t const enumNames[LIBSM_ENUM_COUNT] = {" > out
+        for (k = 0; k < n; k++) {
+            printf "    { \"%s\", \"%s\", %s },\n", type[k], name[k], value[k] > out
+        }
+        print "};\n" > out
+        print "// displacement of each bucket" > out
+        print "static uint16_t const enumDisplacements[LIBSM_ENUM_BUCKETS] = {" > out
+        for (bucket = 0; bucket < buckets; bucket++) {
+            printf "%s%d,", (bucket % 12 == 0 ? "    " : " "), displacement[bucket] > out
+            if (bucket % 12 == 11 || bucket == buckets - 1) {
+                print "" > out
+            }
+        }
+        print "};\n" > out
+        print "// 1 + index into enumNames, 0 for a free slot" > out
+        print "static uint16_t const enumSlots[LIBSM_ENUM_SLOTS] = {" > out
+        for (s = 0; s < slots; s++) {
+            printf "%s%d,", (s % 16 == 0 ? "    " : " "), (s in slot ? slot[s] : 0) > out
+            if (s % 16 == 15) {
+                print "" > out
+            }
+        }
+        print "};" > out
+    }
+' "$tmp/sorted"
+
+{
+    echo "/*"
+    echo " * Generated by tooling/gen-enums.sh from the ENUMERATED and named INTEGER types in"
+    echo " * src/j2735, do not edit"
+    echo " * Included by libsm-enum.c only"
+    echo " */"
+    echo ""
+    echo "#ifndef LIBSM_ENUM_TABLE_H"
+    echo "#define LIBSM_ENUM_TABLE_H"
+    echo ""
+    cat "$tmp/table"
+    echo ""
+    echo "#endif // LIBSM_ENUM_TABLE_H"
+} > "$out"
+echo "wrote $out"
@@ -0,0 +1,86 @@
+#!/usr/bin/env bash
+set -euo pipefail
+DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" >/dev/null 2>&1 && pwd )"
+ROOT=$(realpath "$DIR/../")
+
+# shellcheck disable=SC2120
+h () {
+    # if arguments, print them
+    [ $# == 0 ] || echo "$*"
+
+  cat <<EOF
+Usage: $0 [OPTION]...
+Regenerate src/libsm-itisTable.h, the ITIS code and name tables of libsm-itis.c,
+from the ITIS category enums in src/j2540
+  -h, --help       display this help and exit
+EOF
+
+    # if args, exit 1 else exit 0
+    [ $# == 0 ] || exit 1
+    exit 0
+}
+
+case "${1:-}" in
+    -h|--help) h ;;
+    "") ;;
+    *) h "unexpected argument '$1'" ;;
+esac
+
+j2540="$ROOT/src/j2540"
+out="$ROOT/src/libsm-itisTable.h"
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+# code, category and ASN.1 name of every ITIS code. Every code is in exactly one
+# category type, ITIScodes is their union and ITISgroups names the categories.
+categories=()
+for header in $(grep -l 'From ASN.1 module "J2540ITIS"' "$j2540"/*.h | LC_ALL=C sort); do
+    type=$(basename "$header" .h)
+    case "$type" in
+        ITIScodes|ITISgroups) continue ;;
+    esac
+    grep -qP "^\t${type}_\w+\t= " "$header" || continue
+    categories+=("$type")
+    # C names are the ASN.1 names with - as _
+    grep -P "^\t${type}_\w+\t= " "$header" \
+        | sed -E "s/^\t${type}_(\w+)\t= ([0-9]+).*/\2 ${#categories[@]} \1/; s/_/-/g" \
+        >> "$tmp/codes"
+done
+LC_ALL=C sort -n -k1,1 "$tmp/codes" > "$tmp/byCode"
+[ "$(cut -d' ' -f1 "$tmp/byCode" | uniq -d | wc -l)" -eq 0 ] || { echo "duplicate ITIS codes"; exit 1; }
+[ "$(cut -d' ' -f3 "$tmp/byCode" | LC_ALL=C sort | uniq -d | wc -l)" -eq 0 ] \
+    || { echo "duplicate ITIS names"; exit 1; }
+
+{
+    echo "/*"
+    echo " * Generated by tooling/gen-itis.sh from the ITIS enums in src/j2540, do not edit"
+    echo " * Included by libsm-itis.c only"
+    echo " */"
+    echo ""
+    echo "#ifndef LIBSM_ITIS_TABLE_H"
+    echo "#define LIBSM_ITIS_TABLE_H"
+    echo ""
+    echo "#define LIBSM_ITIS_COUNT $(wc -l < "$tmp/byCode")"
+    echo ""
+    echo "static char const* const itisCategories[] = {"
+    echo "    \"\","
+    for type in "${categories[@]}"; do
+        echo "    \"$type\","
+    done
+    echo "};"
+    echo ""
+    echo "// sorted by code"
+    echo "static libsm_itis_t const itisByCode[LIBSM_ITIS_COUNT] = {"
+    awk '{ printf "    { %s, %s, \"%s\" },\n", $1, $2, $3 }' "$tmp/byCode"
+    echo "};"
+    echo ""
+    echo "// indices into itisByCode, sorted by name"
+    echo "static uint16_t const itisByName[LIBSM_ITIS_COUNT] = {"
+    awk '{ print NR - 1, $3 }' "$tmp/byCode" | LC_ALL=C sort -k2,2 \
+        | awk '{ printf "%s%s", (NR % 12 == 1 ? "    " : " "), $1 "," } NR % 12 == 0 { print "" }
+               END { if (NR % 12) print "" }'
+    echo "};"
+    echo ""
+    echo "#endif // LIBSM_ITIS_TABLE_H"
+} > "$out"
+echo "wrote $out"
@@ -66,3 +66,6 @@ compileASN "$tmpDir" j2735 "${inputFiles[@]}"
 
 rm -rf "$ROOT/src/j2735"
 cp -r "$tmp_dir/output" "$ROOT/src/j2735"
+
+# the specialised UPER codecs fold in the constraints of these tables
+"$DIR/gen-uperFast.sh"
@@ -0,0 +1,668 @@
+#!/usr/bin/env bash
+set -euo pipefail
+DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" >/dev/null 2>&1 && pwd )"
+ROOT=$(realpath "$DIR/../")
+
+# shellcheck disable=SC2120
+h () {
+    # if arguments, print them
+    [ $# == 0 ] || echo "$*"
+
+  cat <<EOF
+Usage: $0 [OPTION]... [TYPE]...
+Regenerate src/libsm-uperFastCodecs.h, the straight-line UPER codecs of
+libsm-uperFast.c, from the asn1c tables in src/j2735. Each TYPE is a
+MessageFrame value to specialise, with everything it contains, by default the
+ones listed in tooling/uperFastTypes
+  -h, --help       display this help and exit
+EOF
+
+    # if args, exit 1 else exit 0
+    [ $# == 0 ] || exit 1
+    exit 0
+}
+
+case "${1:-}" in
+    -h|--help) h ;;
+    -*) h "unexpected argument '$1'" ;;
+esac
+
+if [ $# -gt 0 ]; then
+    types="$*"
+else
+    types=$(grep -v '^#' "$DIR/uperFastTypes" | xargs)
+fi
+
+j2735="$ROOT/src/j2735"
+out="$ROOT/src/libsm-uperFastCodecs.h"
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+# Read the PER constraints, member tables, specifics, enum maps and descriptors
+# asn1c wrote, keyed by file and symbol, since asn1c reuses the names of inner
+# types from file to file. Then walk the types from each MessageFrame value
+# and write an encode and a decode function for every SEQUENCE, SEQUENCE OF
+# and CHOICE on the way. Constrained INTEGERs, ENUMERATEDs whose root is 0..n,
+# BOOLEANs, OCTET STRINGs of a bounded size and BIT STRINGs of a fixed size are
+# written inline with their bounds as constants. Anything else, open types and
+# members with a DEFAULT included, is handed to the asn1c codec of its member.
+LC_ALL=C awk -v types="$types" -v out="$tmp/codecs" '
+    function trim(s) {
+        sub(/\/\*.*/, "", s)
+        gsub(/^[ \t&]+/, "", s)
+        gsub(/[ \t,]+$/, "", s)
+        return s
+    }
+
+    function declared(line) {
+        sub(/(\[[0-9]*\])? (CC_NOTUSED )?= \{.*$/, "", line)
+        sub(/.* /, "", line)
+        defined[file, line] = 1
+        definedIn[line] = file
+        definitions[line]++
+        return file SUBSEP line
+    }
+
+    # what name means in file f, its own definitions first
+    function resolve(f, name) {
+        if (name == "") {
+            return ""
+        }
+        if ((f, name) in defined) {
+            return f SUBSEP name
+        }
+        if (definitions[name] == 1) {
+            return definedIn[name] SUBSEP name
+        }
+        return ""
+    }
+
+    function row(k, which, line,   f) {
+        sub(/^[^{]*\{/, "", line)
+        sub(/\}.*/, "", line)
+        split(line, f, ",")
+        per[k, which, "constrained"] = f[1] ~ /APC_CONSTRAINED/
+        per[k, which, "ext"] = f[1] ~ /APC_EXTENSIBLE/
+        per[k, which, "rb"] = trim(f[2]) + 0
+        per[k, which, "eb"] = trim(f[3]) + 0
+        per[k, which, "lb"] = trim(f[4])
+        per[k, which, "ub"] = trim(f[5])
+    }
+
+    FNR == 1 {
+        file = FILENAME
+        sub(/.*\//, "", file)
+        sub(/\.c$/, "", file)
+        state = ""
+    }
+
+    file == "MessageFrame" && /aioc__value, &asn_DEF_DSRCmsgID, &asn_VAL_[0-9]+_/ {
+        id = $0
+        sub(/.*&asn_VAL_[0-9]+_/, "", id)
+        sub(/[^A-Za-z0-9_].*/, "", id)
+        getline
+        t = $0
+        sub(/.*&asn_DEF_/, "", t)
+        sub(/[^A-Za-z0-9_].*/, "", t)
+        messageId[t] = "DSRCmsgID_" id
+        next
+    }
+
+    state == "" && /asn_per_constraints_t asn_PER_[A-Za-z0-9_]+ CC_NOTUSED = \{$/ {
+        k = declared($0)
+        getline
+        row(k, "v", $0)
+        getline
+        row(k, "s", $0)
+        next
+    }
+
+    state == "" && /asn_TYPE_member_t asn_MBR_[A-Za-z0-9_]+\[\] = \{$/ {
+        mbr = declared($0)
+        mbrFile[mbr] = file
+        members[mbr] = 0
+        state = "mbr"
+        next
+    }
+    state == "mbr" && /^\};/ {
+        state = ""
+        next
+    }
+    state == "mbr" && /^\t\{ ATF_/ {
+        m = members[mbr]++
+        line = $0
+        sub(/^\t\{ /, "", line)
+        split(line, f, ",")
+        mFlags[mbr, m] = trim(f[1])
+        mOptional[mbr, m] = trim(f[2]) + 0
+        field = ""
+        if (line ~ /offsetof\(/) {
+            field = line
+            sub(/.*offsetof\(struct [A-Za-z0-9_]+, /, "", field)
+            sub(/\).*/, "", field)
+        }
+        mField[mbr, m] = field
+        step = "type"
+        next
+    }
+    state == "mbr" && step == "type" && /^\t\t&asn_DEF_/ {
+        mType[mbr, m] = trim($0)
+        step = "select"
+        next
+    }
+    state == "mbr" && step == "select" {
+        mSelect[mbr, m] = trim($0) != "0"
+        step = "per"
+        next
+    }
+    state == "mbr" && step == "per" && /^#if .*ASN_DISABLE_UPER_SUPPORT/ {
+        getline
+        mPer[mbr, m] = trim($0) == "0" ? "" : trim($0)
+        step = "default"
+        next
+    }
+    state == "mbr" && step == "default" && /^\t\t\},$/ {
+        getline
+        mDefault[mbr, m] = $0 !~ /No default value/
+        step = ""
+        next
+    }
+
+    state == "" && /asn_(SEQUENCE|SET_OF|CHOICE|INTEGER)_specifics_t asn_SPC_[A-Za-z0-9_]+ = \{$/ {
+        spc = declared($0)
+        sFirstExt[spc] = -1
+        sExtStart[spc] = -1
+        state = "spc"
+        next
+    }
+    state == "spc" && /^\};/ {
+        state = ""
+        next
+    }
+    state == "spc" && /sizeof\(struct / && !(spc in sStruct) {
+        s = $0
+        sub(/.*sizeof\(struct /, "", s)
+        sub(/\).*/, "", s)
+        sStruct[spc] = s
+        next
+    }
+    state == "spc" && /First extension addition/ {
+        sFirstExt[spc] = trim($0) + 0
+        next
+    }
+    state == "spc" && /Extensions start/ {
+        sExtStart[spc] = trim($0) + 0
+        next
+    }
+    state == "spc" && /_canonical_/ {
+        sCanonical[spc] = 1
+        next
+    }
+    state == "spc" && /_value2enum_/ {
+        s = $0
+        sub(/,.*/, "", s)
+        sMap[spc] = trim(s)
+        next
+    }
+    state == "spc" && /Number of elements in the maps/ {
+        sMapCount[spc] = trim($0) + 0
+        next
+    }
+    state == "spc" && /Extensions before this member/ {
+        sExtension[spc] = trim($0) + 0
+        next
+    }
+
+    state == "" && /asn_INTEGER_enum_map_t asn_MAP_[A-Za-z0-9_]+_value2enum_[0-9]+\[\] = \{$/ {
+        map = declared($0)
+        values[map] = 0
+        state = "map"
+        next
+    }
+    state == "map" && /^\};/ {
+        state = ""
+        next
+    }
+    state == "map" && /^\t\{ / {
+        v = $0
+        sub(/^\t\{ /, "", v)
+        sub(/,.*/, "", v)
+        mapValue[map, values[map]++] = v + 0
+        next
+    }
+
+    state == "" && /asn_TYPE_descriptor_t asn_DEF_[A-Za-z0-9_]+ = \{$/ {
+        def = declared($0)
+        dFile[def] = file
+        state = "def"
+        next
+    }
+    state == "def" && /^\};/ {
+        state = ""
+        next
+    }
+    state == "def" && /^\t&asn_OP_/ {
+        o = trim($0)
+        sub(/^asn_OP_/, "", o)
+        dOp[def] = o
+        next
+    }
+    state == "def" && /^#if .*ASN_DISABLE_UPER_SUPPORT/ && !(def in dPer) {
+        getline
+        dPer[def] = trim($0) == "0" ? "" : trim($0)
+        next
+    }
+    state == "def" && /^\tasn_MBR_/ {
+        dMbr[def] = trim($0)
+        next
+    }
+    state == "def" && /^\t&asn_SPC_/ {
+        s = trim($0)
+        sub(/[ \t].*/, "", s)
+        dSpc[def] = s
+        next
+    }
+
+    function symbol(k,   parts) {
+        split(k, parts, SUBSEP)
+        return parts[2]
+    }
+
+    function fileOf(k,   parts) {
+        split(k, parts, SUBSEP)
+        return parts[1]
+    }
+
+    function constrained(pc, which) {
+        return pc != "" && per[pc, which, "constrained"]
+    }
+
+    # number of root values of an ENUMERATED encoded as its own index, 0 if not so
+    function enumRoot(def, pc,   spc, map, root, i) {
+        spc = resolve(dFile[def], dSpc[def])
+        if (spc == "" || !constrained(pc, "v") || per[pc, "v", "rb"] > 32) {
+            return 0
+        }
+        map = resolve(fileOf(spc), sMap[spc])
+        root = sExtension[spc] ? sExtension[spc] - 1 : sMapCount[spc]
+        if (map == "" || root < 1 || per[pc, "v", "lb"] + 0 != 0 \
+            || per[pc, "v", "ub"] + 0 != root - 1) {
+            return 0
+        }
+        for (i = 0; i < root; i++) {
+            if (mapValue[map, i] != i) {
+                return 0
+            }
+        }
+        return root
+    }
+
+    function kindOf(def, pc,   op, spc, mbr, m, i, n) {
+        op = dOp[def]
+        if (def in inProgress) {
+            return "generic"
+        }
+        if (op == "NativeInteger") {
+            return constrained(pc, "v") && per[pc, "v", "rb"] <= 32 ? "int" : "generic"
+        }
+        if (op == "NativeEnumerated") {
+            return enumRoot(def, pc) > 0 ? "enum" : "generic"
+        }
+        if (op == "BOOLEAN") {
+            return "bool"
+        }
+        if (op == "OCTET_STRING") {
+            return constrained(pc, "s") && !per[pc, "s", "ext"] && !constrained(pc, "v") \
+                   && per[pc, "s", "eb"] >= 0 && per[pc, "s", "ub"] + 0 < 65536 \
+                   ? "octets" : "generic"
+        }
+        if (op == "BIT_STRING") {
+            return constrained(pc, "s") && !per[pc, "s", "ext"] \
+                   && per[pc, "s", "lb"] == per[pc, "s", "ub"] && per[pc, "s", "ub"] + 0 <= 32 \
+                   ? "bits" : "generic"
+        }
+        spc = resolve(dFile[def], dSpc[def])
+        mbr = resolve(dFile[def], dMbr[def])
+        if (spc == "" || mbr == "" || !(spc in sStruct) || pc != resolve(dFile[def], dPer[def])) {
+            return "generic"
+        }
+        if (op == "SEQUENCE_OF") {
+            return constrained(pc, "s") && per[pc, "s", "eb"] >= 0 && per[pc, "s", "eb"] <= 16 \
+                   ? "seqof" : "generic"
+        }
+        if (op == "SEQUENCE") {
+            n = 0
+            for (m = 0; m < members[mbr]; m++) {
+                if (mDefault[mbr, m] || mSelect[mbr, m] || mFlags[mbr, m] ~ /ATF_OPEN_TYPE/) {
+                    return "generic"
+                }
+                if (sFirstExt[spc] >= 0 && m >= sFirstExt[spc] && mFlags[mbr, m] !~ /ATF_POINTER/) {
+                    return "generic"
+                }
+                if ((sFirstExt[spc] < 0 || m < sFirstExt[spc]) && mOptional[mbr, m]) {
+                    n++
+                }
+            }
+            return n <= 32 ? "seq" : "generic"
+        }
+        if (op == "CHOICE") {
+            n = sExtStart[spc] >= 0 ? sExtStart[spc] : members[mbr]
+            if (sCanonical[spc] || !constrained(pc, "v") || per[pc, "v", "rb"] > 16 \
+                || per[pc, "v", "ext"] != (sExtStart[spc] >= 0) \
+                || per[pc, "v", "ub"] + 0 != n - 1) {
+                return "generic"
+            }
+            for (m = 0; m < members[mbr]; m++) {
+                if (mSelect[mbr, m] || mFlags[mbr, m] ~ /ATF_OPEN_TYPE/) {
+                    return "generic"
+                }
+            }
+            return "choice"
+        }
+        return "generic"
+    }
+
+    # the name of a type asn1c wrote a file for, "" for a type inside another
+    function named(def,   name, f) {
+        name = symbol(def)
+        sub(/^asn_DEF_/, "", name)
+        f = dFile[def]
+        gsub(/-/, "_", f)
+        return f == name ? name : ""
+    }
+
+    # the C name of the functions of a type
+    function cname(def) {
+        return named(def) != "" ? named(def) : sStruct[resolve(dFile[def], dSpc[def])]
+    }
+
+    function signature(put, name, st,   head, io, arg) {
+        head = "static bool uper_fast_" (put ? "put_" : "get_") name "("
+        io = put ? "uper_fast_writer_t* w" : "uper_fast_reader_t* r"
+        arg = "struct " st (put ? " const* s" : "* s")
+        if (length(head io ", " arg ")") <= 100) {
+            return head io ", " arg ")\n{\n"
+        }
+        if (length(head) + length(arg ")") <= 100) {
+            return head io ",\n" sprintf("%" length(head) "s", "") arg ")\n{\n"
+        }
+        return head "\n        " io ", " arg ")\n{\n"
+    }
+
+    # the PER constraints of member m of type def, its own or those of the type
+    function perOf(mbr, m, def) {
+        if (mPer[mbr, m] != "") {
+            return resolve(mbrFile[mbr], mPer[mbr, m])
+        }
+        return resolve(dFile[def], dPer[def])
+    }
+
+    # a call on one line, or one argument a line aligned after the parenthesis
+    function call(ind, text,   open, head, args, n, a, i, pad, s) {
+        if (length(ind text) <= 100) {
+            return ind text "\n"
+        }
+        open = index(text, "(")
+        head = substr(text, 1, open)
+        args = substr(text, open + 1)
+        sub(/\);$/, "", args)
+        n = split(args, a, ", ")
+        pad = sprintf("%" (length(ind) + open) "s", "")
+        s = ind head a[1] ",\n"
+        for (i = 2; i < n; i++) {
+            s = s pad a[i] ",\n"
+        }
+        return s pad a[n] ");\n"
+    }
+
+    # what encodes or decodes the value lv at addr, a member elm of its parent
+    function code(put, def, pc, lv, addr, elm, ind,   kind, io, lb, ub) {
+        kind = kindOf(def, pc)
+        io = put ? "w" : "r"
+        if (kind == "int" || kind == "enum") {
+            lb = kind == "int" ? per[pc, "v", "lb"] : 0
+            ub = kind == "int" ? per[pc, "v", "ub"] : enumRoot(def, pc) - 1
+            return call(ind, "ok &= uper_fast_" (put ? "put" : "get") \
+                             (per[pc, "v", "ext"] ? "_ext_int(" : "_int(") io ", " \
+                             (put ? lv : addr) ", " lb ", " ub ", " per[pc, "v", "rb"] ");")
+        }
+        if (kind == "bool") {
+            return put ? ind "uper_fast_put(w, " lv " != 0, 1);\n" \
+                       : ind lv " = (BOOLEAN_t)uper_fast_get(r, 1);\n"
+        }
+        if (kind == "octets") {
+            return call(ind, "ok &= uper_fast_" (put ? "put" : "get") "_octets(" io ", " addr ", " \
+                             per[pc, "s", "lb"] ", " per[pc, "s", "ub"] ", " \
+                             per[pc, "s", "eb"] ");")
+        }
+        if (kind == "bits") {
+            return call(ind, "ok &= uper_fast_" (put ? "put" : "get") "_bits(" io ", " addr ", " \
+                             per[pc, "s", "ub"] ");")
+        }
+        if (kind == "generic") {
+            return call(ind, "ok &= uper_fast_" (put ? "put" : "get") "_member(" io ", " elm ", " \
+                             addr ");")
+        }
+        if (!(def in access)) {
+            access[def] = named(def) != "" ? "asn_DEF_" named(def) "." : substr(elm, 2) ".type->"
+        }
+        emit(def, pc, kind)
+        return call(ind, "ok &= uper_fast_" (put ? "put_" : "get_") cname(def) "(" io ", " \
+                         addr ");")
+    }
+
+    # a member that is a pointer, allocated when decoded
+    function member(put, mbr, m, parent, elm, ind, present,   def, pc, lv, addr, s) {
+        def = resolve(mbrFile[mbr], mType[mbr, m])
+        pc = perOf(mbr, m, def)
+        if (mFlags[mbr, m] !~ /ATF_POINTER/) {
+            return code(put, def, pc, parent "->" mField[mbr, m], "&" parent "->" mField[mbr, m],
+                        elm, ind)
+        }
+        lv = "*" parent "->" mField[mbr, m]
+        addr = parent "->" mField[mbr, m]
+        if (put && mOptional[mbr, m]) {
+            return ind "if (" addr " != NULL) {\n" code(put, def, pc, lv, addr, elm, ind "    ") \
+                   ind "}\n"
+        }
+        if (put) {
+            return ind "if (" addr " == NULL) {\n" ind "    return false;\n" ind "}\n" \
+                   code(put, def, pc, lv, addr, elm, ind)
+        }
+        s = ind "    " addr " = uper_fast_alloc(r, sizeof(" lv "));\n" \
+            ind "    if (" addr " == NULL) {\n" ind "        return false;\n" ind "    }\n" \
+            code(put, def, pc, lv, addr, elm, ind "    ")
+        if (present != "") {
+            return ind "if (" present ") {\n" s ind "}\n"
+        }
+        return ind "{\n" s ind "}\n"
+    }
+
+    function emitSequence(def, name, st, put, mbr, spc,   s, m, root, n, k, elm) {
+        root = sFirstExt[spc] >= 0 ? sFirstExt[spc] : members[mbr]
+        n = 0
+        for (m = 0; m < root; m++) {
+            n += mOptional[mbr, m] != 0
+        }
+        if (put) {
+            s = signature(1, name, st)
+            if (sFirstExt[spc] >= 0) {
+                for (m = root; m < members[mbr]; m++) {
+                    s = s "    if (s->" mField[mbr, m] " != NULL) {\n        return false;\n    }\n"
+                }
+                s = s "    uper_fast_put(w, 0, 1);\n"
+            }
+            for (m = 0; m < root; m++) {
+                if (mOptional[mbr, m]) {
+                    s = s "    uper_fast_put(w, s->" mField[mbr, m] " != NULL, 1);\n"
+                }
+            }
+        } else {
+            s = signature(0, name, st)
+            if (sFirstExt[spc] >= 0) {
+                s = s "    if (uper_fast_get(r, 1)) {\n        return false;\n    }\n"
+            }
+            if (n > 0) {
+                s = s "    uint32_t const present = uper_fast_get(r, " n ");\n"
+            }
+        }
+        s = s "    bool ok = true;\n"
+        k = n
+        for (m = 0; m < root; m++) {
+            elm = "&" access[def] "elements[" m "]"
+            if (mOptional[mbr, m]) {
+                k--
+            }
+            s = s member(put, mbr, m, "s", elm, "    ",
+                         mOptional[mbr, m] ? "present & (1u << " k ")" : "")
+        }
+        return s "    return ok;\n}\n"
+    }
+
+    function emitSequenceOf(def, name, st, put, pc, mbr,   s, lb, ub, eb, elm, ed, epc) {
+        lb = per[pc, "s", "lb"]
+        ub = per[pc, "s", "ub"]
+        eb = per[pc, "s", "eb"]
+        elm = "&" access[def] "elements[0]"
+        ed = resolve(mbrFile[mbr], mType[mbr, 0])
+        epc = perOf(mbr, 0, ed)
+        if (put) {
+            s = signature(1, name, st)
+            s = s "    if (s->list.count < " lb " || s->list.count > " ub ") {\n" \
+                  "        return false;\n    }\n"
+            if (per[pc, "s", "ext"]) {
+                s = s "    uper_fast_put(w, 0, 1);\n"
+            }
+            if (eb > 0) {
+                s = s "    uper_fast_put(w, (uint32_t)(s->list.count - " lb "), " eb ");\n"
+            }
+            s = s "    bool ok = true;\n    for (int i = 0; i < s->list.count; i++) {\n" \
+                  "        if (s->list.array[i] == NULL) {\n            return false;\n        }\n"
+            s = s code(put, ed, epc, "*s->list.array[i]", "s->list.array[i]", elm, "        ")
+        } else {
+            s = signature(0, name, st)
+            if (per[pc, "s", "ext"]) {
+                s = s "    if (uper_fast_get(r, 1)) {\n        return false;\n    }\n"
+            }
+            s = s "    long const count = " lb \
+                  (eb > 0 ? " + (long)uper_fast_get(r, " eb ")" : "") ";\n"
+            if (eb > 0) {
+                s = s "    if (count > " ub ") {\n        return false;\n    }\n"
+            }
+            s = s "    bool ok = true;\n    for (long i = 0; i < count && !r->overrun; i++) {\n" \
+                  "        if (uper_fast_add(r, &s->list, sizeof(**s->list.array)) == NULL) {\n" \
+                  "            return false;\n        }\n"
+            s = s code(put, ed, epc, "*s->list.array[i]", "s->list.array[i]", elm, "        ")
+        }
+        return s "    }\n    return ok;\n}\n"
+    }
+
+    function emitChoice(def, name, st, put, pc, mbr, spc,   s, m, root, alt, elm) {
+        root = sExtStart[spc] >= 0 ? sExtStart[spc] : members[mbr]
+        if (put) {
+            s = signature(1, name, st)
+            s = s "    bool ok = true;\n    switch (s->present) {\n"
+        } else {
+            s = signature(0, name, st)
+            if (per[pc, "v", "ext"]) {
+                s = s "    if (uper_fast_get(r, 1)) {\n        return false;\n    }\n"
+            }
+            s = s "    bool ok = true;\n    switch (uper_fast_get(r, " per[pc, "v", "rb"] ")) {\n"
+        }
+        for (m = 0; m < root; m++) {
+            alt = mField[mbr, m]
+            sub(/^choice\./, "", alt)
+            elm = "&" access[def] "elements[" m "]"
+            if (put) {
+                s = s "        case " st "_PR_" alt ":\n"
+                if (per[pc, "v", "ext"]) {
+                    s = s "            uper_fast_put(w, 0, 1);\n"
+                }
+                if (per[pc, "v", "rb"] > 0) {
+                    s = s "            uper_fast_put(w, " m ", " per[pc, "v", "rb"] ");\n"
+                }
+            } else {
+                s = s "        case " m ":\n            s->present = " st "_PR_" alt ";\n"
+            }
+            s = s member(put, mbr, m, "s", elm, "            ", "") "            break;\n"
+        }
+        return s "        default:\n            return false;\n    }\n    return ok;\n}\n"
+    }
+
+    # the functions of a type, after those of the types it contains
+    function emit(def, pc, kind,   name, st, spc, mbr, putCode, getCode) {
+        if (def in emitted) {
+            return
+        }
+        emitted[def] = 1
+        inProgress[def] = 1
+        name = cname(def)
+        spc = resolve(dFile[def], dSpc[def])
+        mbr = resolve(dFile[def], dMbr[def])
+        st = sStruct[spc]
+        if (kind == "seq") {
+            putCode = emitSequence(def, name, st, 1, mbr, spc)
+            getCode = emitSequence(def, name, st, 0, mbr, spc)
+        } else if (kind == "seqof") {
+            putCode = emitSequenceOf(def, name, st, 1, pc, mbr)
+            getCode = emitSequenceOf(def, name, st, 0, pc, mbr)
+        } else {
+            putCode = emitChoice(def, name, st, 1, pc, mbr, spc)
+            getCode = emitChoice(def, name, st, 0, pc, mbr, spc)
+        }
+        delete inProgress[def]
+        printf "\n\n%s\n\n%s", putCode, getCode > out
+    }
+
+    END {
+        n = split(types, roots, " ")
+        for (i = 1; i <= n; i++) {
+            def = resolve(roots[i], "asn_DEF_" roots[i])
+            pc = resolve(dFile[def], dPer[def])
+            if (!(roots[i] in messageId) || def == "" || kindOf(def, pc) != "seq") {
+                print "can not specialise " roots[i] > "/dev/stderr"
+                exit 1
+            }
+            access[def] = "asn_DEF_" roots[i] "."
+            emit(def, pc, "seq")
+        }
+
+        printf "\n\n%s\n%s\n%s\n", \
+               "static bool uper_fast_put_message(uper_fast_writer_t* w, MessageFrame_t const* mf)",
+               "{", "    switch (mf->value.present) {" > out
+        for (i = 1; i <= n; i++) {
+            printf "        case MessageFrame__value_PR_%s:\n", roots[i] > out
+            printf "            if (mf->messageId != %s) {\n", messageId[roots[i]] > out
+            printf "                return false;\n            }\n" > out
+            printf "%s", call("            ", "return uper_fast_put_" roots[i] \
+                              "(w, &mf->value.choice." roots[i] ");") > out
+        }
+        printf "        default:\n            return false;\n    }\n}\n" > out
+
+        printf "\n\n%s\n%s\n%s\n", \
+               "static bool uper_fast_get_message(uper_fast_reader_t* r, MessageFrame_t* mf)",
+               "{", "    switch (mf->messageId) {" > out
+        for (i = 1; i <= n; i++) {
+            printf "        case %s:\n", messageId[roots[i]] > out
+            printf "            mf->value.present = MessageFrame__value_PR_%s;\n", roots[i] > out
+            printf "%s", call("            ", "return uper_fast_get_" roots[i] \
+                              "(r, &mf->value.choice." roots[i] ");") > out
+        }
+        printf "        default:\n            return false;\n    }\n}\n" > out
+    }
+' "$j2735"/*.c
+
+{
+    echo "/*"
+    echo " * Generated by tooling/gen-uperFast.sh from the asn1c tables in src/j2735, do not edit"
+    echo " * Specialised: $types"
+    echo " * Included by libsm-uperFast.c only"
+    echo " */"
+    echo ""
+    echo "#ifndef LIBSM_UPER_FAST_CODECS_H"
+    echo "#define LIBSM_UPER_FAST_CODECS_H"
+    cat "$tmp/codecs"
+    echo ""
+    echo "#endif // LIBSM_UPER_FAST_CODECS_H"
+} > "$out"
+echo "wrote $out"
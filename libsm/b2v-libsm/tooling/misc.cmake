@@ -13,3 +13,64 @@ function(filter_supported_flags ret lang)
     endforeach()
     set(${ret} ${output} PARENT_SCOPE)
 endfunction()
+
+
+# LIBSM_STATIC and LIBSM_LTO for one of the libsm libraries
+function(libsm_library_options target)
+    if(LIBSM_STATIC)
+        set_target_properties(${target} PROPERTIES C_VISIBILITY_PRESET hidden)
+    endif()
+    if(LIBSM_LTO)
+        set_target_properties(${target} PROPERTIES INTERPROCEDURAL_OPTIMIZATION ON)
+    endif()
+endfunction()
+
+
+# Keep in srcs and headers only the generated files of dir reachable from the root types.
+# Follows the quoted #includes from <root>.h, a header brings in its own .c and
+# _<codec>.c files. The asn1c skeletons call each other without always including
+# each other, so the files not generated from an ASN.1 module are always kept.
+function(asn_type_closure srcs headers dir)
+    set(queue)
+    foreach(file IN LISTS ${srcs} ${headers})
+        file(STRINGS ${dir}/${file} generated LIMIT_INPUT 300 REGEX "From ASN.1 module")
+        if(NOT generated)
+            list(APPEND queue ${file})
+        endif()
+    endforeach()
+    foreach(root IN LISTS ARGN)
+        list(APPEND queue ${root}.h)
+    endforeach()
+    set(reached)
+    while(queue)
+        list(POP_FRONT queue file)
+        if(reached_${file} OR NOT EXISTS ${dir}/${file})
+            continue()
+        endif()
+        set(reached_${file} TRUE)
+        list(APPEND reached ${file})
+        file(STRINGS ${dir}/${file} includes REGEX "^#include \"[^\"]+\"")
+        foreach(line IN LISTS includes)
+            string(REGEX REPLACE "^#include \"([^\"]+)\".*" "\\1" included "${line}")
+            list(APPEND queue ${included})
+        endforeach()
+        if(file MATCHES "^(.*)\\.h$")
+            file(GLOB sources RELATIVE ${dir} ${dir}/${CMAKE_MATCH_1}.c ${dir}/${CMAKE_MATCH_1}_*.c)
+            list(APPEND queue ${sources})
+        endif()
+    endwhile()
+    set(keptSrcs)
+    set(keptHeaders)
+    foreach(file IN LISTS ${srcs})
+        if(reached_${file})
+            list(APPEND keptSrcs ${file})
+        endif()
+    endforeach()
+    foreach(file IN LISTS ${headers})
+        if(reached_${file})
+            list(APPEND keptHeaders ${file})
+        endif()
+    endforeach()
+    set(${srcs} ${keptSrcs} PARENT_SCOPE)
+    set(${headers} ${keptHeaders} PARENT_SCOPE)
+endfunction()
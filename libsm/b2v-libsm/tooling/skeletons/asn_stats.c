@@ -0,0 +1,257 @@
+/*
+ * Allocation accounting for the ASN.1 support code, see asn_stats.h.
+ * Not part of asn1c, copied into the generated code by tooling/asn1c.sh.
+ */
+#include "asn_stats.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define	ASN_STATS_MIN_SIZE	64	/* Initial slots of each table */
+
+typedef struct asn_stats_block_s {
+	void *ptr;	/* NULL: free slot */
+	const struct asn_TYPE_descriptor_s *type;
+	size_t size;
+} asn_stats_block_t;
+
+/*
+ * Both tables are open addressing with linear probing, on the type and on
+ * the block pointer. Their memory comes from plain calloc and free.
+ */
+typedef struct asn_stats_thread_s {
+	asn_stats_counters_t total;
+	asn_stats_counters_t untyped;
+	uint64_t untracked_frees;
+	asn_stats_counters_t *types;	/* type NULL: free slot */
+	size_t types_size;
+	size_t types_count;
+	asn_stats_block_t *blocks;
+	size_t blocks_size;
+	size_t blocks_count;
+	const struct asn_TYPE_descriptor_s *current;
+} asn_stats_thread_t;
+
+static _Thread_local asn_stats_thread_t asn_stats;
+
+static size_t
+asn_stats_hash(uintptr_t key, size_t size) {
+	uint64_t h = (uint64_t)key * 0x9E3779B97F4A7C15ULL;
+	return (size_t)(h >> 32) & (size - 1);
+}
+
+static asn_stats_counters_t *
+asn_stats_type_counters(const struct asn_TYPE_descriptor_s *td) {
+	asn_stats_thread_t *st = &asn_stats;
+	size_t i;
+
+	if(!td) return &st->untyped;
+
+	if(2 * (st->types_count + 1) > st->types_size) {
+		size_t size = st->types_size ? 2 * st->types_size : ASN_STATS_MIN_SIZE;
+		asn_stats_counters_t *types = calloc(size, sizeof(types[0]));
+		if(!types) return &st->untyped;
+		for(i = 0; i < st->types_size; i++) {
+			if(st->types[i].type) {
+				size_t j = asn_stats_hash((uintptr_t)st->types[i].type, size);
+				while(types[j].type) j = (j + 1) & (size - 1);
+				types[j] = st->types[i];
+			}
+		}
+		free(st->types);
+		st->types = types;
+		st->types_size = size;
+	}
+
+	i = asn_stats_hash((uintptr_t)td, st->types_size);
+	while(st->types[i].type && st->types[i].type != td)
+		i = (i + 1) & (st->types_size - 1);
+	if(!st->types[i].type) {
+		st->types[i].type = td;
+		st->types_count++;
+	}
+	return &st->types[i];
+}
+
+static void
+asn_stats_charge(asn_stats_counters_t *c, size_t size) {
+	c->allocations++;
+	c->bytes += size;
+	c->live_bytes += size;
+	if(c->live_bytes > c->peak_bytes) c->peak_bytes = c->live_bytes;
+}
+
+static void
+asn_stats_discharge(asn_stats_counters_t *c, size_t size) {
+	c->frees++;
+	c->live_bytes -= size;
+}
+
+/*
+ * Remember a block, 0 if the table cannot grow.
+ */
+static int
+asn_stats_put_block(const asn_stats_block_t *block) {
+	asn_stats_thread_t *st = &asn_stats;
+	size_t i;
+
+	if(2 * (st->blocks_count + 1) > st->blocks_size) {
+		size_t new_size = st->blocks_size ? 2 * st->blocks_size : ASN_STATS_MIN_SIZE;
+		asn_stats_block_t *blocks = calloc(new_size, sizeof(blocks[0]));
+		if(!blocks) return 0;
+		for(i = 0; i < st->blocks_size; i++) {
+			if(st->blocks[i].ptr) {
+				size_t j = asn_stats_hash((uintptr_t)st->blocks[i].ptr, new_size);
+				while(blocks[j].ptr) j = (j + 1) & (new_size - 1);
+				blocks[j] = st->blocks[i];
+			}
+		}
+		free(st->blocks);
+		st->blocks = blocks;
+		st->blocks_size = new_size;
+	}
+
+	i = asn_stats_hash((uintptr_t)block->ptr, st->blocks_size);
+	while(st->blocks[i].ptr) i = (i + 1) & (st->blocks_size - 1);
+	st->blocks[i] = *block;
+	st->blocks_count++;
+	return 1;
+}
+
+/*
+ * Forget a block, 0 if it was not remembered.
+ */
+static int
+asn_stats_take_block(const void *ptr, asn_stats_block_t *block) {
+	asn_stats_thread_t *st = &asn_stats;
+	size_t mask = st->blocks_size - 1;
+	size_t i, j;
+
+	if(!st->blocks_size) return 0;
+	i = asn_stats_hash((uintptr_t)ptr, st->blocks_size);
+	while(st->blocks[i].ptr != ptr) {
+		if(!st->blocks[i].ptr) return 0;
+		i = (i + 1) & mask;
+	}
+	*block = st->blocks[i];
+
+	/* Shift back the blocks that probed past this slot */
+	for(j = (i + 1) & mask; st->blocks[j].ptr; j = (j + 1) & mask) {
+		size_t home = asn_stats_hash((uintptr_t)st->blocks[j].ptr, st->blocks_size);
+		if(i <= j ? (i < home && home <= j) : (i < home || home <= j))
+			continue;
+		st->blocks[i] = st->blocks[j];
+		i = j;
+	}
+	st->blocks[i].ptr = NULL;
+	st->blocks_count--;
+	return 1;
+}
+
+/*
+ * Count a new block of type td. A block the table has no room for is not
+ * counted, and its free will be an untracked free.
+ */
+static void
+asn_stats_allocated(void *ptr, size_t size,
+                    const struct asn_TYPE_descriptor_s *td) {
+	asn_stats_thread_t *st = &asn_stats;
+	asn_stats_block_t block;
+
+	block.ptr = ptr;
+	block.type = td;
+	block.size = size;
+	if(!asn_stats_put_block(&block)) return;
+	asn_stats_charge(&st->total, size);
+	asn_stats_charge(asn_stats_type_counters(block.type), size);
+}
+
+static void
+asn_stats_freed(const asn_stats_block_t *block) {
+	asn_stats_discharge(&asn_stats.total, block->size);
+	asn_stats_discharge(asn_stats_type_counters(block->type), block->size);
+}
+
+void *
+asn_stats_calloc(size_t nmemb, size_t size) {
+	void *ptr = calloc(nmemb, size);
+	if(ptr) asn_stats_allocated(ptr, nmemb * size, asn_stats.current);
+	return ptr;
+}
+
+void *
+asn_stats_malloc(size_t size) {
+	void *ptr = malloc(size);
+	if(ptr) asn_stats_allocated(ptr, size, asn_stats.current);
+	return ptr;
+}
+
+void *
+asn_stats_realloc(void *oldptr, size_t size) {
+	asn_stats_block_t old;
+	int moved = oldptr != NULL;
+	int tracked = moved && asn_stats_take_block(oldptr, &old);
+	void *ptr = realloc(oldptr, size);
+
+	if(!ptr) {
+		/* The old block is still there, and its slot is still free */
+		if(tracked) asn_stats_put_block(&old);
+		return ptr;
+	}
+	if(tracked)
+		asn_stats_freed(&old);
+	else if(moved)
+		asn_stats.untracked_frees++;
+	/* A grown block still belongs to the type that allocated it */
+	asn_stats_allocated(ptr, size, tracked ? old.type : asn_stats.current);
+	return ptr;
+}
+
+void
+asn_stats_free(void *ptr) {
+	asn_stats_block_t block;
+	if(ptr) {
+		if(asn_stats_take_block(ptr, &block))
+			asn_stats_freed(&block);
+		else
+			asn_stats.untracked_frees++;
+	}
+	free(ptr);
+}
+
+void
+asn_stats_set_type(const struct asn_TYPE_descriptor_s *td) {
+	asn_stats.current = td;
+}
+
+size_t
+asn_stats_get(asn_stats_counters_t *total, uint64_t *untracked_frees,
+              asn_stats_counters_t *types, size_t capacity) {
+	asn_stats_thread_t *st = &asn_stats;
+	size_t count = 0;
+	size_t i;
+
+	if(total) *total = st->total;
+	if(untracked_frees) *untracked_frees = st->untracked_frees;
+	if(st->untyped.allocations) {
+		if(types && count < capacity) types[count] = st->untyped;
+		count++;
+	}
+	for(i = 0; i < st->types_size; i++) {
+		if(st->types[i].type) {
+			if(types && count < capacity) types[count] = st->types[i];
+			count++;
+		}
+	}
+	return count;
+}
+
+void
+asn_stats_reset(void) {
+	asn_stats_thread_t *st = &asn_stats;
+	const struct asn_TYPE_descriptor_s *current = st->current;
+	free(st->types);
+	free(st->blocks);
+	memset(st, 0, sizeof(*st));
+	st->current = current;
+}